@@ -0,0 +1,102 @@
+// inference.cpp: a convolutional layer followed by a classifier in low-precision formats
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/blas/blas.hpp>
+
+// a 3x3 convolution of a batch of 8 RGB 32x32 images to 16 channels, a classifier of the flattened
+// feature maps to 10 classes, and a softmax, in the arithmetic of Scalar with the sums in Accumulator
+// and the weights stored as Weight. Reports the storage of the weights, the largest difference of the
+// probabilities with the double precision evaluation, and the number of images whose class agrees.
+template<typename Scalar, typename Weight, typename Accumulator, bool Packed>
+void Layer(const std::string& label) {
+	using namespace sw::universal::blas;
+	std::mt19937_64 engine(1);  // the same problem for every configuration
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	tensor<double, 4> image({ 8, 3, 32, 32 }), filters({ 16, 3, 3, 3 });
+	tensor<double, 2> classifier({ 16 * 32 * 32, 10 });
+	for (size_t i = 0; i < image.size(); ++i) image.data()[i] = dist(engine);
+	for (size_t i = 0; i < filters.size(); ++i) filters.data()[i] = 0.25 * dist(engine);
+	for (size_t i = 0; i < classifier.size(); ++i) classifier.data()[i] = 0.05 * dist(engine);
+	conv2d_params same{ 1, 1, 1 };
+
+	// double precision reference
+	tensor<double, 4> featuresd(conv2d_extents(image.extents(), filters.extents(), same));
+	tensor<double, 2> logitsd({ 8, 10 }), probabilitiesd({ 8, 10 });
+	conv2d<double>(image, filters, featuresd, same);
+	matmul<double>(featuresd.reshape<2>({ 8, 16 * 32 * 32 }), classifier, logitsd);
+	softmax<double>(logitsd, probabilitiesd);
+
+	tensor<Scalar, 4> x(image), features(featuresd.extents());
+	tensor<Scalar, 2> logits({ 8, 10 }), probabilities({ 8, 10 });
+	size_t bytes;
+	auto start = std::chrono::steady_clock::now();
+	if constexpr (Packed) {
+		packed_tensor<Weight, 4> w(filters);
+		packed_tensor<Weight, 2> c(classifier);
+		bytes = w.bytes() + c.bytes();
+		conv2d<Accumulator>(x, w, features, same);
+		matmul<Accumulator>(features.template reshape<2>({ 8, 16 * 32 * 32 }), c, logits);
+	}
+	else {
+		tensor<Weight, 4> w(filters);
+		tensor<Weight, 2> c(classifier);
+		bytes = (w.size() + c.size()) * sizeof(Weight);
+		conv2d<Accumulator>(x, w, features, same);
+		matmul<Accumulator>(features.template reshape<2>({ 8, 16 * 32 * 32 }), c, logits);
+	}
+	softmax<double>(logits, probabilities);
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	double maxError = 0.0;
+	size_t agreements = 0;
+	for (size_t n = 0; n < 8; ++n) {
+		size_t best = 0, bestd = 0;
+		for (size_t k = 0; k < 10; ++k) {
+			maxError = std::max(maxError, std::fabs(double(probabilities(n, k)) - probabilitiesd(n, k)));
+			if (probabilities(n, k) > probabilities(n, best)) best = k;
+			if (probabilitiesd(n, k) > probabilitiesd(n, bestd)) bestd = k;
+		}
+		if (best == bestd) ++agreements;
+	}
+	std::cout << std::setw(40) << std::left << label << std::right
+		<< std::setw(10) << bytes
+		<< std::setw(14) << std::scientific << std::setprecision(3) << maxError
+		<< std::setw(8) << agreements << "/8"
+		<< std::setw(10) << std::fixed << std::setprecision(3) << elapsed << '\n';
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::cout << std::setw(40) << std::left << "activations / weights / accumulator" << std::right
+		<< std::setw(10) << "bytes" << std::setw(14) << "max error" << std::setw(10) << "argmax" << std::setw(10) << "seconds" << '\n';
+	Layer<float, float, float, false>("float / float / float");
+	Layer<posit<8, 0>, posit<8, 0>, quire<8, 0>, false>("posit<8,0> / posit<8,0> / quire");
+	Layer<posit<8, 0>, posit<8, 0>, quire<8, 0>, true>("posit<8,0> / packed posit<8,0> / quire");
+	Layer<cfloat<8, 4>, cfloat<8, 4>, float, false>("cfloat<8,4> / cfloat<8,4> / float");
+	Layer<cfloat<8, 4>, posit<4, 0>, float, true>("cfloat<8,4> / packed posit<4,0> / float");
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
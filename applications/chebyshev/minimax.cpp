@@ -0,0 +1,85 @@
+// minimax.cpp: generate per-format minimax kernels of exp and log1p and print their coefficient tables
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/functions/minimax.hpp>
+
+/*
+A math library for a number system evaluates exp(x) as exp(x) = 2^k * exp(r), with k = round(x / ln2)
+and r = x - k*ln2 in [-ln2/2, ln2/2]. The kernel exp(r) is a polynomial whose degree only needs to be
+high enough for the precision of the format: a posit<16,1> needs degree 3, a posit<32,2> degree 7.
+Evaluating the kernel in the format itself avoids the round trip through double of every call.
+
+This program generates the kernels and prints the tables that a math library compiles in.
+The output is committed in number/posit/math/minimax_tables.hpp and number/cfloat/math/minimax_tables.hpp.
+*/
+
+struct Exp { template<typename Real> Real operator()(const Real& x) const { using std::exp; return exp(x); } };
+struct Log1p { template<typename Real> Real operator()(const Real& x) const { using std::log1p; return log1p(x); } };
+
+constexpr long double ln2    = 0.693147180559945309417232121458176568L;
+constexpr long double ln2half = ln2 / 2.0L;
+
+// exp(x) with the argument reduction and reconstruction in Scalar and the kernel from the table
+template<typename Scalar, size_t Degree>
+Scalar exp_with_kernel(const sw::function::polynomial_kernel<Scalar, Degree>& kernel, const Scalar& x) {
+	int k = int(std::lround(double(x) / double(ln2)));
+	Scalar r = x - Scalar(double(k)) * Scalar(double(ln2));
+	return Scalar(std::ldexp(double(kernel(r)), k));
+}
+
+template<typename Scalar, size_t Degree>
+void GenerateExp(const std::string& name, const std::string& tag) {
+	using namespace sw::function;
+	auto kernel = minimax_kernel<Scalar, Degree>(Exp(), -ln2half, ln2half);
+	emit(std::cout, "exp_" + tag, kernel, "exp(x) on [-ln2/2, ln2/2] for " + name);
+
+	// largest relative error of exp on [-4, 4] against the long double reference
+	double maxError = 0.0;
+	for (int i = -4000; i <= 4000; ++i) {
+		Scalar x = Scalar(double(i) / 1000.0);
+		long double ref = std::exp((long double)double(x));
+		double e = double(std::fabs(((long double)double(exp_with_kernel(kernel, x)) - ref) / ref));
+		if (e > maxError) maxError = e;
+	}
+	std::cout << "// largest relative error of exp on [-4, 4] : " << maxError << "\n\n";
+}
+
+template<typename Scalar, size_t Degree>
+void GenerateLog1p(const std::string& name, const std::string& tag) {
+	using namespace sw::function;
+	auto kernel = minimax_kernel<Scalar, Degree>(Log1p(), -0.25L, 0.5L, approximation_error::absolute);
+	emit(std::cout, "log1p_" + tag, kernel, "log1p(x) on [-1/4, 1/2] for " + name);
+	std::cout << '\n';
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	GenerateExp<posit<16, 1>, 3>("posit<16,1>", "posit16");
+	GenerateExp<posit<32, 2>, 7>("posit<32,2>", "posit32");
+	GenerateExp<cfloat<32, 8, uint32_t, true, false, false>, 6>("cfloat<32,8>", "cfloat32");
+	GenerateLog1p<posit<16, 1>, 5>("posit<16,1>", "posit16");
+	GenerateLog1p<posit<32, 2>, 12>("posit<32,2>", "posit32");
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -15,11 +15,6 @@
 #include <universal/number/integer/integer.hpp>
 #include <universal/number/integer/primes.hpp>
 
-template<size_t nbits, typename BlockType>
-bool miller_rabin(const sw::universal::integer<nbits, BlockType>& a, int reps) {
-	return true;
-}
-
 int main(int argc, char** argv)
 try {
 	using namespace std;
@@ -54,13 +49,11 @@ try {
 			while (!factors.empty()) {
 				Integer factor = factors.top();
 				factors.pop();
-				/*
-				if (miller_rabin(factor, 25)) {
+				if (isProbablePrime(factor, 25)) {
 					// factor is prime
 					cout << factor << endl;
 					continue;
 				}
-				*/
 				Integer result = fermatFactorization(factor);
 				if (result == 1) {
 					cout << "factor " << factor << " exponent " << result << endl;
@@ -13,11 +13,73 @@
 #define INTEGER_THROW_ARITHMETIC_EXCEPTION 1
 #include <universal/number/integer/integer.hpp>
 
+/*
+ Pollard's rho with Brent's cycle detection: iterate x -> x^2 + c mod N and
+ accumulate the products of |x - y| so that a gcd is only needed every m steps.
+ The iteration runs on residues of a modular_context, so the modulus is never
+ divided at the bit level inside the loop.
+ */
+template<size_t nbits, typename BlockType>
+sw::universal::integer<nbits, BlockType> pollardRho(const sw::universal::integer<nbits, BlockType>& N, unsigned c) {
+	using namespace sw::universal;
+	using Integer = integer<nbits, BlockType>;
+	using Context = modular_context<nbits, BlockType>;
+	using Residue = typename Context::residue;
+	if (N.iseven()) return Integer(2);
+	Context ctx(N);
+	Residue cr = ctx.enter(Integer(c));
+	auto f = [&](const Residue& x) { return ctx.add(ctx.sqr(x), cr); };
+	auto g = [&](const Residue& q) { return gcd(ctx.leave(q), N); };
+
+	constexpr size_t m = 64;
+	Residue y = ctx.enter(Integer(2)), x{}, ys{}, q = ctx.one();
+	Integer d(1);
+	for (size_t r = 1; d == 1; r <<= 1) {
+		x = y;
+		for (size_t i = 0; i < r; ++i) y = f(y);
+		for (size_t k = 0; k < r && d == 1; k += m) {
+			ys = y;
+			for (size_t i = 0; i < m && i < r - k; ++i) {
+				y = f(y);
+				q = ctx.mul(q, ctx.sub(x, y));
+			}
+			d = g(q);
+		}
+	}
+	if (d == N) {
+		// the batch overshot: backtrack one step at a time
+		do {
+			ys = f(ys);
+			d = g(ctx.sub(x, ys));
+		} while (d == 1);
+	}
+	return d;
+}
+
 int main(int argc, char** argv)
 try {
 	using namespace std;
 	using namespace sw::universal;
 
+	constexpr size_t nbits = 128;
+	using Integer = integer<nbits, uint32_t>;
+
+	// products of two primes of increasing size
+	vector< pair<uint64_t, uint64_t> > semiprimes = {
+		{ 10007ull, 10009ull },
+		{ 1000003ull, 1000033ull },
+		{ 1000000007ull, 1000000009ull },
+		{ 4294967291ull, 1000000000039ull },
+	};
+	for (auto p : semiprimes) {
+		Integer N = Integer(p.first) * Integer(p.second);
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		Integer factor = N;
+		for (unsigned c = 1; factor == N; ++c) factor = pollardRho(N, c);
+		chrono::steady_clock::time_point end = chrono::steady_clock::now();
+		double elapsed = chrono::duration_cast<chrono::duration<double>>(end - begin).count();
+		cout << N << " = " << factor << " * " << N / factor << " in " << elapsed << " seconds\n";
+	}
 
 	return EXIT_SUCCESS;
 }
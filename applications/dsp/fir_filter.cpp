@@ -8,6 +8,7 @@
 // enable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 1
 #include <universal/number/posit/posit.hpp>
+#include <universal/dsp/dsp.hpp>
 
 /*
 
@@ -50,7 +51,7 @@ try {
 		weights[i] = 0.5f;
 	}
 
-	// dot product
+	// dot product: every multiply and every add rounds
 	posit<nbits, es> fir;
 	fir = 0.0f;
 	for (size_t i = 0; i < vecSize; i++) {
@@ -58,6 +59,40 @@ try {
 	}
 	cout << "Value is " << fir << endl;
 
+	// the same dot product as the output of a streaming filter with a quire accumulator: a single rounding
+	{
+		// the delay line holds the most recent sample first, so feed the reversed sinusoid to align it with the weights
+		vector<double> taps(vecSize, 0.5);
+		dsp::fir_filter< posit<nbits, es>, posit<nbits, es>, quire<nbits, es> > filter(taps);
+		posit<nbits, es> y;
+		for (size_t i = 0; i < vecSize; i++) y = filter(sinusoid[vecSize - 1 - i]);
+		cout << "Value is " << y << " with quire accumulation" << endl;
+	}
+
+	// streaming lowpass filter over a noisy sinusoid, processed in blocks of samples
+	{
+		const size_t nrTaps = 31;
+		const size_t blockSize = 64;
+		dsp::fir_filter< posit<nbits, es>, posit<nbits, es>, quire<nbits, es> > lowpass(dsp::lowpass(nrTaps, 0.05));
+		vector< posit<nbits, es> > block(blockSize), filtered(blockSize);
+		double maxError = 0.0;
+		for (size_t b = 0; b < 8; ++b) {
+			for (size_t i = 0; i < blockSize; ++i) {
+				size_t n = b * blockSize + i;
+				block[i] = sin(2.0 * pi * double(n) / 128.0) + 0.25 * sin(2.0 * pi * 0.4 * double(n));
+			}
+			lowpass.process(block.data(), filtered.data(), blockSize);
+			if (b == 0) continue; // skip the transient of the filter
+			for (size_t i = 0; i < blockSize; ++i) {
+				// the passband tone is delayed by the (nrTaps-1)/2 samples of the linear phase filter
+				size_t n = b * blockSize + i - (nrTaps - 1) / 2;
+				double error = std::abs(double(filtered[i]) - sin(2.0 * pi * double(n) / 128.0));
+				if (error > maxError) maxError = error;
+			}
+		}
+		cout << "31-tap lowpass filter removes the 0.4 fs tone, max deviation from the 1/128 fs tone : " << maxError << endl;
+	}
+
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
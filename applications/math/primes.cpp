@@ -6,6 +6,7 @@
 //
 // This file is part of the universal number project, which is released under an MIT Open Source license.
 #include <iostream>
+#include <chrono>
 #include <universal/number/integer/integer.hpp>
 #include <universal/number/integer/math_functions.hpp>
 #include <universal/number/integer/primes.hpp>
@@ -33,6 +34,17 @@ try {
 	primeNumbersInRange(a, b, v);
 	cout << v.size() << " prime numbers in range [" << a << ", " << b << ")" << endl;
 
+	cout << "\nCount prime numbers in large ranges with the segmented sieve\n";
+	for (size_t nrThreads : { size_t(1), size_t(0) }) {
+		uint64_t low = 1000000000000ull, high = low + 1000000000ull;
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		uint64_t count = countPrimes(low, high, nrThreads);
+		chrono::steady_clock::time_point end = chrono::steady_clock::now();
+		double elapsed = chrono::duration_cast<chrono::duration<double>>(end - begin).count();
+		cout << count << " prime numbers in range [" << low << ", " << high << ") in " << elapsed << " seconds using "
+			<< (nrThreads == 0 ? default_concurrency() : nrThreads) << " thread(s)" << endl;
+	}
+
 	cout << "\nCheck primeness of a couple of values around 1k\n";
 	a = 1024 + 1;
 	for ( a = 1025; a < 1050; a += 2) { // skip the even numbers
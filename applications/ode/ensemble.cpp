@@ -0,0 +1,107 @@
+// ensemble.cpp: integrate an ensemble of Lotka-Volterra systems with the batched Runge-Kutta integrators
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <universal/number/posit/posit.hpp>
+#include <universal/ode/ode.hpp>
+
+/*
+Ensemble simulations integrate the same small model for many parameter sets. The ensemble stores the
+states in structure-of-arrays layout, and the integrators advance the whole batch with no allocation
+per step. Here every system is a predator-prey model
+
+	x' =  alpha x - beta x y
+	y' = -gamma y + delta x y
+
+whose parameters are part of the state, so that a single right-hand side serves the whole batch.
+*/
+
+template<typename Scalar>
+struct LotkaVolterra {
+	void operator()(const Scalar& t, const sw::universal::ode::system_view<const Scalar>& u, const sw::universal::ode::system_view<Scalar>& dudt) const {
+		Scalar xy = u[0] * u[1];
+		dudt[0] = u[2] * u[0] - u[3] * xy;
+		dudt[1] = u[5] * xy - u[4] * u[1];
+		for (size_t i = 2; i < 6; ++i) dudt[i] = Scalar(0.0);
+	}
+};
+
+template<typename Scalar>
+void Initialize(sw::universal::ode::ensemble<Scalar>& u) {
+	for (size_t s = 0; s < u.size(); ++s) {
+		double variation = double(s % 100) / 100.0;
+		u(s, 0) = Scalar(10.0 + 5.0 * variation);   // prey
+		u(s, 1) = Scalar(5.0);                      // predators
+		u(s, 2) = Scalar(1.1);                      // alpha
+		u(s, 3) = Scalar(0.4);                      // beta
+		u(s, 4) = Scalar(0.4 + 0.1 * variation);    // gamma
+		u(s, 5) = Scalar(0.1);                      // delta
+	}
+}
+
+template<typename Scalar, typename Accumulator>
+void Simulate(const std::string& name, size_t N, const sw::universal::ode::ensemble<double>* reference, size_t nrThreads) {
+	using namespace sw::universal::ode;
+	ensemble<Scalar> u(N, 6);
+	Initialize(u);
+	adaptive_runge_kutta<dormand_prince, Scalar, Accumulator> integrator(N, 6, 1.0e-6, 1.0e-6, nrThreads);
+	auto begin = std::chrono::steady_clock::now();
+	integrator.integrate(LotkaVolterra<Scalar>(), 0.0, 20.0, u);
+	auto end = std::chrono::steady_clock::now();
+	double elapsed = std::chrono::duration<double>(end - begin).count();
+	size_t steps = 0;
+	for (size_t s = 0; s < N; ++s) steps += integrator.accepted(s) + integrator.rejected(s);
+	std::cout << std::setw(30) << name << " : " << std::setw(8) << steps << " steps " << std::setw(10) << elapsed << " sec";
+	if (reference) {
+		double maxDifference = 0.0;
+		for (size_t s = 0; s < N; ++s) maxDifference = std::max(maxDifference, std::fabs(double(u(s, 0)) - (*reference)(s, 0)));
+		std::cout << "   largest prey difference with double : " << maxDifference;
+	}
+	std::cout << '\n';
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+	using namespace sw::universal::ode;
+
+	size_t N = 100;
+	size_t nrThreads = default_concurrency();
+
+	ensemble<double> reference(N, 6);
+	Initialize(reference);
+	adaptive_runge_kutta<dormand_prince, double> integrator(N, 6, 1.0e-6, 1.0e-6, nrThreads);
+	integrator.integrate(LotkaVolterra<double>(), 0.0, 20.0, reference);
+
+	std::cout << N << " Lotka-Volterra systems over [0, 20] with Dormand-Prince 5(4) on " << nrThreads << " threads\n";
+	Simulate<double, double>("double", N, nullptr, nrThreads);
+	Simulate<posit<32, 2>, posit<32, 2>>("posit<32,2>", N, &reference, nrThreads);
+	Simulate<posit<32, 2>, quire<32, 2>>("posit<32,2> with quire", N, &reference, nrThreads);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
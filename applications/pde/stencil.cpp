@@ -0,0 +1,104 @@
+// stencil.cpp: Laplace's equation on large grids with the matrix-free stencil solvers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#ifdef _MSC_VER
+#pragma warning(disable : 4514)   // unreferenced inline function has been removed
+#endif
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/blas.hpp>
+
+/*
+The precision study of laplace.cpp: Laplace's equation on the unit square with u = 1 on the left half
+of the bottom border, u = -1 on the upper half of the right border, and u = 0 elsewhere on the border.
+The dense laplace2D() operator limits that study to grids of about 64 x 64; the stencil operator only
+stores the grid, so the same relaxation runs on grids of thousands of points per side.
+
+usage: stencil [n]      n x n interior points, 256 by default
+*/
+
+template<typename Scalar>
+void BoundaryConditions(sw::universal::blas::grid2D<Scalar>& u) {
+	size_t n = u.extent(0);
+	for (size_t i = 1; i <= n / 2; ++i) u(i, 0) = Scalar(1.0);
+	for (size_t j = n / 2 + 1; j <= n; ++j) u(n + 1, j) = Scalar(-1.0);
+}
+
+template<typename Scalar>
+void Solve(const std::string& name, size_t n, size_t nrSweeps, const sw::universal::blas::grid2D<double>* reference, sw::universal::blas::grid2D<double>* solution = nullptr) {
+	using namespace sw::universal::blas;
+	grid2D<Scalar> u(n, n), f(n, n);
+	BoundaryConditions(u);
+	const double pi = 3.14159265358979323846;
+	Scalar omega(2.0 / (1.0 + std::sin(pi / double(n + 1))));
+	auto begin = std::chrono::steady_clock::now();
+	sor(laplacian<Scalar, 2>(), f, u, omega, nrSweeps);
+	auto end = std::chrono::steady_clock::now();
+	double elapsed = std::chrono::duration<double>(end - begin).count();
+	double r = residual(laplacian<Scalar, 2>(), u, f);
+	std::cout << std::setw(14) << name << " : residual " << std::setw(12) << r << "  " << std::setw(10) << elapsed << " sec";
+	if (reference) {
+		double maxDifference = 0.0;
+		for (size_t j = 1; j <= n; ++j) for (size_t i = 1; i <= n; ++i) maxDifference = std::max(maxDifference, std::fabs(double(u(i, j)) - (*reference)(i, j)));
+		std::cout << "  largest difference with double " << maxDifference;
+	}
+	std::cout << '\n';
+	if (solution) {
+		for (size_t j = 0; j <= n + 1; ++j) for (size_t i = 0; i <= n + 1; ++i) (*solution)(i, j) = double(u(i, j));
+	}
+}
+
+// Jacobi sweeps with and without temporal blocking
+void TemporalBlocking(size_t n, size_t nrSweeps) {
+	using namespace sw::universal::blas;
+	for (size_t T : { 1, 4, 8 }) {
+		grid2D<double> u(n, n), f(n, n);
+		BoundaryConditions(u);
+		auto begin = std::chrono::steady_clock::now();
+		jacobi(laplacian<double, 2>(), f, u, nrSweeps, 1.0, 0, T);
+		auto end = std::chrono::steady_clock::now();
+		double elapsed = std::chrono::duration<double>(end - begin).count();
+		std::cout << "Jacobi " << nrSweeps << " sweeps, temporal block " << T << " : " << elapsed << " sec, "
+			<< double(n) * double(n) * double(nrSweeps) / elapsed / 1.0e6 << " Mupdates/sec\n";
+	}
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+	using namespace sw::universal::blas;
+
+	size_t n = (argc > 1 ? size_t(std::atoi(argv[1])) : 256);
+	size_t nrSweeps = 2 * n;
+
+	std::cout << "Laplace's equation on a " << n << " x " << n << " grid, " << nrSweeps << " red-black SOR sweeps\n";
+	grid2D<double> reference(n, n);
+	Solve<double>("double", n, nrSweeps, nullptr, &reference);
+	Solve<float>("float", n, nrSweeps, &reference);
+	Solve<posit<32, 2>>("posit<32,2>", n, nrSweeps, &reference);
+	Solve<posit<16, 1>>("posit<16,1>", n, nrSweeps, &reference);
+
+	TemporalBlocking(4 * n, 32);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,174 @@
+// posit_functions.cpp: ULP accuracy of the posit elementary functions against a quad-double reference
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <cmath>
+#include <universal/number/posit/posit.hpp>
+
+/*
+   The posit elementary functions evaluate in double, dd_real, or qd_real depending on the
+   width of the posit, and round the result once. The previous implementation was a shim
+   that evaluated posit(std::f(double(x))). The benchmark samples arguments, rounds the
+   qd_real value of the function into the posit as the reference, and reports the maximum
+   and average distance in units in the last place for both implementations, together with
+   the fraction of correctly rounded results.
+ */
+
+// the distance in ulps between two posits of the same sign is the distance of their encodings
+template<size_t nbits, size_t es>
+double UlpDistance(const sw::universal::posit<nbits, es>& a, const sw::universal::posit<nbits, es>& b) {
+	if (a.isnar() || b.isnar()) return (a.isnar() && b.isnar()) ? 0.0 : 1.0e300;
+	sw::universal::posit<nbits, es> lo = (a < b ? a : b), hi = (a < b ? b : a);
+	double ulps = 0.0;
+	// walk the encodings for small distances, fall back on the difference of the encodings for large ones
+	for (int i = 0; i < 64 && lo != hi; ++i) { ++lo; ++ulps; }
+	if (lo != hi) {
+		sw::universal::bitblock<nbits> la = lo.get(), lb = hi.get();
+		double distance = 0.0;
+		for (int i = int(nbits) - 1; i >= 0; --i) distance = 2.0 * distance + (double(lb[size_t(i)]) - double(la[size_t(i)]));
+		ulps += std::fabs(distance);
+	}
+	return ulps;
+}
+
+struct Statistics {
+	double maxUlp{ 0.0 };
+	double sumUlp{ 0.0 };
+	size_t correct{ 0 };
+	size_t samples{ 0 };
+	void add(double ulp) {
+		maxUlp = std::max(maxUlp, ulp);
+		sumUlp += ulp;
+		if (ulp == 0.0) ++correct;
+		++samples;
+	}
+};
+
+template<size_t nbits, size_t es, typename Reference, typename Native, typename Shim>
+void Measure(const std::string& tag, const std::string& function, double lo, double hi, size_t nrOfSamples, Reference reference, Native native, Shim shim) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 engine(nbits);
+	std::uniform_real_distribution<double> d(lo, hi);
+	Statistics extended, viaDouble;
+	for (size_t i = 0; i < nrOfSamples; ++i) {
+		Posit x(d(engine));
+		Posit ref = internal::posit_from_extended<nbits, es>(reference(internal::posit_to_extended<qd_real>(x)));
+		extended.add(UlpDistance(native(x), ref));
+		viaDouble.add(UlpDistance(shim(x), ref));
+	}
+	auto print = [&](const std::string& version, const Statistics& s) {
+		std::cout << std::setw(14) << tag << std::setw(8) << function << std::setw(10) << version
+			<< std::setw(14) << std::setprecision(6) << s.maxUlp
+			<< std::setw(14) << s.sumUlp / double(s.samples)
+			<< std::setw(12) << std::setprecision(4) << 100.0 * double(s.correct) / double(s.samples) << "%\n";
+	};
+	print("extended", extended);
+	print("double", viaDouble);
+}
+
+template<size_t nbits, size_t es>
+void Functions(const std::string& tag, size_t nrOfSamples) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	Measure<nbits, es>(tag, "exp", -20.0, 20.0, nrOfSamples,
+		[](const qd_real& v) { return exp(v); },
+		[](const Posit& x) { return sw::universal::exp(x); },
+		[](const Posit& x) { return Posit(std::exp(double(x))); });
+	Measure<nbits, es>(tag, "log", 1.0e-6, 1.0e6, nrOfSamples,
+		[](const qd_real& v) { return log(v); },
+		[](const Posit& x) { return sw::universal::log(x); },
+		[](const Posit& x) { return Posit(std::log(double(x))); });
+	Measure<nbits, es>(tag, "sin", -10.0, 10.0, nrOfSamples,
+		[](const qd_real& v) { return sin(v); },
+		[](const Posit& x) { return sw::universal::sin(x); },
+		[](const Posit& x) { return Posit(std::sin(double(x))); });
+	Measure<nbits, es>(tag, "atan", -4.0, 4.0, nrOfSamples,
+		[](const qd_real& v) { return atan(v); },
+		[](const Posit& x) { return sw::universal::atan(x); },
+		[](const Posit& x) { return Posit(std::atan(double(x))); });
+	Measure<nbits, es>(tag, "tanh", -3.0, 3.0, nrOfSamples,
+		[](const qd_real& v) { return tanh(v); },
+		[](const Posit& x) { return sw::universal::tanh(x); },
+		[](const Posit& x) { return Posit(std::tanh(double(x))); });
+	Measure<nbits, es>(tag, "pow", 0.1, 3.0, nrOfSamples,
+		[](const qd_real& v) { return pow(v, qd_real(2.5)); },
+		[](const Posit& x) { return sw::universal::pow(x, Posit(2.5)); },
+		[](const Posit& x) { return Posit(std::pow(double(x), 2.5)); });
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::cout << "ULP error of the posit elementary functions against a correctly rounded quad-double reference\n";
+	std::cout << std::setw(14) << "type" << std::setw(8) << "func" << std::setw(10) << "version"
+		<< std::setw(14) << "max ulp" << std::setw(14) << "avg ulp" << std::setw(13) << "correct\n";
+	Functions<16, 1>("posit<16,1>", 10000);
+	Functions<32, 2>("posit<32,2>", 10000);
+	Functions<64, 3>("posit<64,3>", 2000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O2, single core Linux sandbox
+The double shim double-rounds every result of posit<64,3>, which carries up to 59 fraction bits.
+
+ULP error of the posit elementary functions against a correctly rounded quad-double reference
+          type    func   version       max ulp       avg ulp     correct
+   posit<16,1>     exp  extended             0             0         100%
+   posit<16,1>     exp    double             0             0         100%
+   posit<16,1>     log  extended             0             0         100%
+   posit<16,1>     log    double             0             0         100%
+   posit<16,1>     sin  extended             0             0         100%
+   posit<16,1>     sin    double             0             0         100%
+   posit<16,1>    atan  extended             0             0         100%
+   posit<16,1>    atan    double             0             0         100%
+   posit<16,1>    tanh  extended             0             0         100%
+   posit<16,1>    tanh    double             0             0         100%
+   posit<16,1>     pow  extended             0             0         100%
+   posit<16,1>     pow    double             0             0         100%
+   posit<32,2>     exp  extended             0             0         100%
+   posit<32,2>     exp    double             0             0         100%
+   posit<32,2>     log  extended             0             0         100%
+   posit<32,2>     log    double             0             0         100%
+   posit<32,2>     sin  extended             0             0         100%
+   posit<32,2>     sin    double             0             0         100%
+   posit<32,2>    atan  extended             0             0         100%
+   posit<32,2>    atan    double             0             0         100%
+   posit<32,2>    tanh  extended             0             0         100%
+   posit<32,2>    tanh    double             0             0         100%
+   posit<32,2>     pow  extended             0             0         100%
+   posit<32,2>     pow    double             0             0         100%
+   posit<64,3>     exp  extended             0             0         100%
+   posit<64,3>     exp    double            32        8.1975         5.5%
+   posit<64,3>     log  extended             0             0         100%
+   posit<64,3>     log    double            32       16.5995        1.35%
+   posit<64,3>     sin  extended             0             0         100%
+   posit<64,3>     sin    double            32        15.606         1.8%
+   posit<64,3>    atan  extended             0             0         100%
+   posit<64,3>    atan    double            32        15.676        1.55%
+   posit<64,3>    tanh  extended             0             0         100%
+   posit<64,3>    tanh    double           119        22.166           1%
+   posit<64,3>     pow  extended             0             0         100%
+   posit<64,3>     pow    double            32        15.796        1.55%
+ */
@@ -0,0 +1,129 @@
+// reduction.cpp: throughput and accuracy of exact reductions with adaptive precision floating-point expansions
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <algorithm>
+// configure the adaptivefloat arithmetic class
+#define ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/adaptivefloat/adaptivefloat.hpp>
+
+/*
+   An exact reduction with adaptivefloat costs a grow-expansion step per term, which is
+   linear in the number of components of the running sum. Compression keeps that number
+   close to the dynamic range of the data divided by 53, so the cost per term depends on
+   the spread of the exponents and not on the length of the reduction.
+
+   The references are the naive double accumulation and Kahan's compensated summation.
+   The data is an ill-conditioned sum: a wide range sequence followed by its negation,
+   shuffled, plus a single one, so that the exact sum is 1.
+ */
+
+volatile double sink;  // keeps the results alive
+
+std::vector<double> IllConditionedSum(size_t n, int range) {
+	std::mt19937_64 engine(n);
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-range, range);
+	std::vector<double> v;
+	for (size_t i = 0; i < n / 2; ++i) {
+		double x = std::ldexp(mantissa(engine), exponent(engine));
+		v.push_back(x);
+		v.push_back(-x);
+	}
+	v.push_back(1.0);
+	std::shuffle(v.begin(), v.end(), engine);
+	return v;
+}
+
+template<typename Reduction>
+double Measure(const std::vector<double>& v, Reduction reduce, double& result, size_t nrOfRepetitions) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) result = reduce(v);
+	steady_clock::time_point end = steady_clock::now();
+	sink = result;
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	return double(v.size() * nrOfRepetitions) / elapsed / 1.0e6;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	auto naive = [](const std::vector<double>& v) {
+		double sum{ 0.0 };
+		for (double x : v) sum += x;
+		return sum;
+	};
+	auto kahan = [](const std::vector<double>& v) {
+		double sum{ 0.0 }, c{ 0.0 };
+		for (double x : v) {
+			double y = x - c;
+			double t = sum + y;
+			c = (t - sum) - y;
+			sum = t;
+		}
+		return sum;
+	};
+	auto exact = [](const std::vector<double>& v) {
+		adaptivefloat sum;
+		for (double x : v) sum += x;
+		return double(sum);
+	};
+
+	constexpr size_t N = 100000;
+	std::cout << "reduction of " << N << " terms whose exact sum is 1: throughput in Mterms/s and result\n";
+	std::cout << std::setw(8) << "range" << std::setw(12) << "double" << std::setw(12) << "result"
+		<< std::setw(12) << "kahan" << std::setw(12) << "result" << std::setw(14) << "adaptivefloat" << std::setw(10) << "result"
+		<< std::setw(16) << "fresh blocks" << '\n';
+	for (int range : { 10, 50, 200, 1000 }) {
+		std::vector<double> v = IllConditionedSum(N, range);
+		double r1, r2, r3;
+		double t1 = Measure(v, naive, r1, 20);
+		double t2 = Measure(v, kahan, r2, 20);
+		Measure(v, exact, r3, 1);  // warm up the arena
+		expansion_arena::statistics before = expansion_arena::stats();
+		double t3 = Measure(v, exact, r3, 5);
+		expansion_arena::statistics after = expansion_arena::stats();
+		uint64_t fresh = (after.allocations - before.allocations) - (after.recycled - before.recycled);
+		std::cout << std::setw(8) << (std::string("2^") + std::to_string(range)) << std::fixed << std::setprecision(1)
+			<< std::setw(12) << t1 << std::setw(12) << std::defaultfloat << std::setprecision(4) << r1
+			<< std::setw(12) << std::fixed << std::setprecision(1) << t2 << std::setw(12) << std::defaultfloat << std::setprecision(4) << r2
+			<< std::setw(14) << std::fixed << std::setprecision(1) << t3 << std::setw(10) << std::defaultfloat << r3
+			<< std::setw(16) << fresh << '\n';
+	}
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O3, single core Linux sandbox
+
+reduction of 100000 terms whose exact sum is 1: throughput in Mterms/s and result
+   range      double      result       kahan      result adaptivefloat    result    fresh blocks
+    2^10      1212.3           1       305.9           1          37.7         1               0
+    2^50      1250.2      -121.9       307.6     -0.4229          25.4         1               0
+   2^200      1250.0   9.594e+45       309.1   2.275e+44          15.9         1               0
+  2^1000      1249.1 -1.529e+286       309.0  1.179e+285           2.7         1               0
+ */
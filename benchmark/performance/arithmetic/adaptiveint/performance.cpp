@@ -0,0 +1,179 @@
+// performance.cpp: throughput of adaptive precision integers compared to fixed-size integer<nbits>
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <limits>
+// configure the integer arithmetic classes
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#define ADAPTIVEINT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/integer/integer.hpp>
+#include <universal/number/adaptiveint/adaptiveint.hpp>
+
+/*
+   An integer<nbits> always processes all of its limbs, while an adaptiveint only
+   touches the limbs of the value it holds, and keeps values of up to two limbs
+   inline without a heap allocation. The operands below fill half of nbits so that
+   their products are representable in integer<nbits>.
+
+   The second table sweeps the multiplication algorithms of adaptiveint on large
+   operands to tune the Karatsuba and Toom-3 thresholds for the target machine.
+ */
+
+constexpr size_t N = 256;
+volatile bool sink;  // keeps the results alive
+
+// random limbs that fill nrLimbs, the divisors get half as many
+std::vector<uint32_t> RandomLimbs(std::mt19937_64& engine, size_t nrLimbs) {
+	std::vector<uint32_t> limbs(nrLimbs);
+	for (uint32_t& l : limbs) l = uint32_t(engine());
+	limbs.back() |= 1u;
+	return limbs;
+}
+
+template<typename Integer>
+Integer Compose(const std::vector<uint32_t>& limbs) {
+	Integer v{ 0 };
+	for (size_t i = limbs.size(); i-- > 0;) {
+		v <<= 32;
+		v += Integer(static_cast<long long>(limbs[i]));
+	}
+	return v;
+}
+
+template<typename Integer>
+double Measure(int op, size_t nbits, size_t nrOfRepetitions) {
+	using namespace std::chrono;
+	std::mt19937_64 engine(nbits);
+	std::vector<Integer> a(N), b(N), c(N);
+	for (size_t i = 0; i < N; ++i) {
+		a[i] = Compose<Integer>(RandomLimbs(engine, nbits / 64));
+		b[i] = Compose<Integer>(RandomLimbs(engine, (op == 3 ? nbits / 128 : nbits / 64)));
+	}
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		switch (op) {
+		case 0: for (size_t i = 0; i < N; ++i) c[i] = a[i] + b[i]; break;
+		case 1: for (size_t i = 0; i < N; ++i) c[i] = a[i] - b[i]; break;
+		case 2: for (size_t i = 0; i < N; ++i) c[i] = a[i] * b[i]; break;
+		default: for (size_t i = 0; i < N; ++i) c[i] = a[i] / b[i]; break;
+		}
+	}
+	steady_clock::time_point end = steady_clock::now();
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	sink = c[N / 2] == c[N / 3];
+	return double(N * nrOfRepetitions) / elapsed / 1.0e6;
+}
+
+template<size_t nbits>
+void CompareWithInteger(size_t nrOfRepetitions) {
+	using namespace sw::universal;
+	const char* opname[] = { "add", "sub", "mul", "div" };
+	for (int op = 0; op < 4; ++op) {
+		// the bit-serial multiply and divide of integer<nbits> are two orders of magnitude slower
+		double fixed = Measure< integer<nbits, uint32_t> >(op, nbits, (op < 2 ? nrOfRepetitions : 1));
+		double adaptive = Measure< adaptiveint >(op, nbits, nrOfRepetitions);
+		std::cout << std::setw(6) << nbits << std::setw(6) << opname[op] << std::fixed << std::setprecision(3)
+			<< std::setw(16) << fixed << std::setw(16) << adaptive << '\n' << std::defaultfloat;
+	}
+}
+
+// microseconds per product of two operands of nrLimbs limbs
+double MeasureMultiplication(size_t nrLimbs, size_t karatsubaThreshold, size_t toom3Threshold, size_t nrOfRepetitions) {
+	using namespace std::chrono;
+	using namespace sw::universal;
+	std::mt19937_64 engine(nrLimbs);
+	adaptiveint a, b, c;
+	a.setlimbs(RandomLimbs(engine, nrLimbs), false);
+	b.setlimbs(RandomLimbs(engine, nrLimbs), true);
+	adaptiveint::karatsubaThreshold = karatsubaThreshold;
+	adaptiveint::toom3Threshold = toom3Threshold;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) c = a * b;
+	steady_clock::time_point end = steady_clock::now();
+	adaptiveint::karatsubaThreshold = ADAPTIVEINT_KARATSUBA_THRESHOLD;
+	adaptiveint::toom3Threshold = ADAPTIVEINT_TOOM3_THRESHOLD;
+	sink = c.isodd();
+	return duration_cast<duration<double>>(end - begin).count() / double(nrOfRepetitions) * 1.0e6;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::cout << "adaptiveint vs integer<nbits, uint32_t> throughput in Mops/s\n";
+	std::cout << std::setw(6) << "nbits" << std::setw(6) << "op" << std::setw(16) << "integer<nbits>" << std::setw(16) << "adaptiveint" << '\n';
+	CompareWithInteger<128>(200);
+	CompareWithInteger<256>(100);
+	CompareWithInteger<512>(20);
+	CompareWithInteger<1024>(10);
+
+	constexpr size_t never = std::numeric_limits<size_t>::max();
+	std::cout << "\nadaptiveint multiplication in microseconds per product\n";
+	std::cout << std::setw(8) << "limbs" << std::setw(14) << "basecase" << std::setw(14) << "karatsuba" << std::setw(14) << "toom-3" << std::setw(14) << "default" << '\n';
+	for (size_t nrLimbs : { 16, 32, 64, 128, 256, 512, 1024, 2048 }) {
+		size_t nrOfRepetitions = std::max<size_t>(2, 400000 / (nrLimbs * nrLimbs));
+		double basecase = MeasureMultiplication(nrLimbs, never, never, nrOfRepetitions);
+		double karatsuba = MeasureMultiplication(nrLimbs, 16, never, nrOfRepetitions);
+		double toom3 = MeasureMultiplication(nrLimbs, 16, 48, nrOfRepetitions);
+		double tuned = MeasureMultiplication(nrLimbs, ADAPTIVEINT_KARATSUBA_THRESHOLD, ADAPTIVEINT_TOOM3_THRESHOLD, nrOfRepetitions);
+		std::cout << std::setw(8) << nrLimbs << std::fixed << std::setprecision(2)
+			<< std::setw(14) << basecase << std::setw(14) << karatsuba << std::setw(14) << toom3 << std::setw(14) << tuned
+			<< '\n' << std::defaultfloat;
+	}
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O3, single core Linux sandbox
+
+adaptiveint vs integer<nbits, uint32_t> throughput in Mops/s
+ nbits    op  integer<nbits>     adaptiveint
+   128   add          81.021          13.785
+   128   sub          68.104          16.384
+   128   mul           0.008           6.667
+   128   div           0.020          14.796
+   256   add          17.228           8.795
+   256   sub           8.059          10.590
+   256   mul           0.004           9.072
+   256   div           0.007           2.858
+   512   add           8.661           8.561
+   512   sub           4.102          10.709
+   512   mul           0.001           5.456
+   512   div           0.003           2.935
+  1024   add           3.904           8.705
+  1024   sub           1.816           9.715
+  1024   mul           0.000           2.353
+  1024   div           0.001           2.000
+
+adaptiveint multiplication in microseconds per product
+   limbs      basecase     karatsuba        toom-3       default
+      16          0.50          0.64          0.66          0.47
+      32          1.57          1.99          2.02          1.59
+      64          5.96          6.51          7.61          5.24
+     128         23.03         19.38         20.16         16.43
+     256         95.08         60.75         72.63         49.50
+     512        380.64        192.67        266.72        138.49
+    1024       1423.60        491.11        492.25        411.00
+    2048       5675.16       1747.09       1767.00       1383.47
+ */
@@ -97,6 +97,49 @@ areal<64,11,uint64_t>   decode             1000000 per       0.0017222sec -> 580
 */
 }
 
+// The generic workloads of the performance runner start from the all ones encoding, which is a NaN
+// for areals, so they only measure the special case short-cut. These workloads keep the operands finite.
+
+// exact operand 2^scale * 1.f with the two leading fraction bits f, built from the encoding
+// as not all configurations convert from double
+template<typename Scalar>
+Scalar Operand(int scale, uint64_t f) {
+	Scalar v;
+	uint64_t raw = uint64_t(scale + Scalar::EXP_BIAS) << (Scalar::fbits + 1);
+	v.setbits(raw | (f << (Scalar::fbits - 1)));
+	return v;
+}
+
+template<typename Scalar>
+void ArealAdditionSubtractionWorkload(uint64_t NR_OPS) {
+	Scalar a = Operand<Scalar>(0, 0), b = Operand<Scalar>(-2, 2), c;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		c = a + b;
+		a = c - b;
+	}
+	if (a.isnan()) std::cout << "NaN in addition workload\n";
+}
+
+template<typename Scalar>
+void ArealMultiplicationWorkload(uint64_t NR_OPS) {
+	Scalar a = Operand<Scalar>(0, 2), b = Operand<Scalar>(0, 1), d = Operand<Scalar>(-1, 2), c;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		c = a * b;
+		a = c * d;  // stays in the range [1, 2)
+	}
+	if (a.isnan()) std::cout << "NaN in multiplication workload\n";
+}
+
+template<typename Scalar>
+void ArealDivisionWorkload(uint64_t NR_OPS) {
+	Scalar a = Operand<Scalar>(0, 2), b = Operand<Scalar>(0, 1), d = Operand<Scalar>(-1, 2), c;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		c = a / b;
+		a = c / d;
+	}
+	if (a.isnan()) std::cout << "NaN in division workload\n";
+}
+
 // measure performance of arithmetic operators
 void TestArithmeticOperatorPerformance() {
 	using namespace std;
@@ -105,36 +148,52 @@ void TestArithmeticOperatorPerformance() {
 
 	uint64_t NR_OPS = 1000000;
 
-	PerformanceRunner("areal<8,2,uint8_t>      add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<8,2,uint8_t> >, NR_OPS);
-	PerformanceRunner("areal<16,5,uint16_t>    add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
-	PerformanceRunner("areal<32,8,uint32_t>    add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
-	PerformanceRunner("areal<64,11,uint64_t>   add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
-//	PerformanceRunner("areal<128,15,uint64_t>  add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
-//	PerformanceRunner("areal<256,15,uint64_t   add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
-//	PerformanceRunner("areal<512,15,uint64_t>  add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
-//	PerformanceRunner("areal<1024,15,uint64_t> add/subtract   ", AdditionSubtractionWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
+	PerformanceRunner("areal<8,2,uint8_t>      add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<8,2,uint8_t> >, NR_OPS);
+	PerformanceRunner("areal<16,5,uint16_t>    add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
+	PerformanceRunner("areal<32,8,uint32_t>    add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
+	PerformanceRunner("areal<64,11,uint64_t>   add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
+//	PerformanceRunner("areal<128,15,uint64_t>  add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
+//	PerformanceRunner("areal<256,15,uint64_t   add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
+//	PerformanceRunner("areal<512,15,uint64_t>  add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
+//	PerformanceRunner("areal<1024,15,uint64_t> add/subtract   ", ArealAdditionSubtractionWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
 
 	NR_OPS = 1024 * 32;
-	PerformanceRunner("areal<8,2,uint16_t>     division       ", DivisionWorkload< sw::universal::areal<8,2,uint16_t> >, NR_OPS);
-	PerformanceRunner("areal<16,5,uint16_t>    division       ", DivisionWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
-	PerformanceRunner("areal<32,8,uint32_t>    division       ", DivisionWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
-	PerformanceRunner("areal<64,11,uint64_t>   division       ", DivisionWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
-//	PerformanceRunner("areal<128,15,uint64_t>  division       ", DivisionWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
-//	PerformanceRunner("areal<256,15,uint64_t   division       ", DivisionWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
-//	PerformanceRunner("areal<512,15,uint64_t>  division       ", DivisionWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
-//	PerformanceRunner("areal<1024,15,uint64_t> division       ", DivisionWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
+	PerformanceRunner("areal<8,2,uint16_t>     division       ", ArealDivisionWorkload< sw::universal::areal<8,2,uint16_t> >, NR_OPS);
+	PerformanceRunner("areal<16,5,uint16_t>    division       ", ArealDivisionWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
+	PerformanceRunner("areal<32,8,uint32_t>    division       ", ArealDivisionWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
+	PerformanceRunner("areal<64,11,uint64_t>   division       ", ArealDivisionWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
+//	PerformanceRunner("areal<128,15,uint64_t>  division       ", ArealDivisionWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
+//	PerformanceRunner("areal<256,15,uint64_t   division       ", ArealDivisionWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
+//	PerformanceRunner("areal<512,15,uint64_t>  division       ", ArealDivisionWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
+//	PerformanceRunner("areal<1024,15,uint64_t> division       ", ArealDivisionWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
 
 	// multiplication is the slowest operator
 
 	NR_OPS = 1024 * 32;
-	PerformanceRunner("areal<8,2,uint16_t>     multiplication ", MultiplicationWorkload< sw::universal::areal<8,2,uint16_t> >, NR_OPS);
-	PerformanceRunner("areal<16,5,uint16_t>    multiplication ", MultiplicationWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
-	PerformanceRunner("areal<32,8,uint32_t>    multiplication ", MultiplicationWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
-	PerformanceRunner("areal<64,11,uint64_t>   multiplication ", MultiplicationWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
-//	PerformanceRunner("areal<128,15,uint64_t>  multiplication ", MultiplicationWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
-//	PerformanceRunner("areal<256,15,uint64_t   multiplication ", MultiplicationWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
-//	PerformanceRunner("areal<512,15,uint64_t>  multiplication ", MultiplicationWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
-//	PerformanceRunner("areal<1024,15,uint64_t> multiplication ", MultiplicationWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
+	PerformanceRunner("areal<8,2,uint16_t>     multiplication ", ArealMultiplicationWorkload< sw::universal::areal<8,2,uint16_t> >, NR_OPS);
+	PerformanceRunner("areal<16,5,uint16_t>    multiplication ", ArealMultiplicationWorkload< sw::universal::areal<16,5,uint16_t> >, NR_OPS);
+	PerformanceRunner("areal<32,8,uint32_t>    multiplication ", ArealMultiplicationWorkload< sw::universal::areal<32,8,uint32_t> >, NR_OPS);
+	PerformanceRunner("areal<64,11,uint64_t>   multiplication ", ArealMultiplicationWorkload< sw::universal::areal<64,11,uint64_t> >, NR_OPS);
+//	PerformanceRunner("areal<128,15,uint64_t>  multiplication ", ArealMultiplicationWorkload< sw::universal::areal<128,15,uint64_t> >, NR_OPS / 2);
+//	PerformanceRunner("areal<256,15,uint64_t   multiplication ", ArealMultiplicationWorkload< sw::universal::areal<256,15,uint64_t> >, NR_OPS / 4);
+//	PerformanceRunner("areal<512,15,uint64_t>  multiplication ", ArealMultiplicationWorkload< sw::universal::areal<512,15,uint64_t> >, NR_OPS / 8);
+//	PerformanceRunner("areal<1024,15,uint64_t> multiplication ", ArealMultiplicationWorkload< sw::universal::areal<1024,15,uint64_t> >, NR_OPS / 16);
+
+/*
+10/19/2026: blocktriple based arithmetic with uncertainty bit propagation on finite operands
+areal<8,2,uint8_t>      add/subtract       1000000 per        0.101843sec ->   9 Mops/sec
+areal<16,5,uint16_t>    add/subtract       1000000 per       0.0755109sec ->  13 Mops/sec
+areal<32,8,uint32_t>    add/subtract       1000000 per        0.129296sec ->   7 Mops/sec
+areal<64,11,uint64_t>   add/subtract       1000000 per        0.267581sec ->   3 Mops/sec
+areal<8,2,uint16_t>     division             32768 per      0.00120672sec ->  27 Mops/sec
+areal<16,5,uint16_t>    division             32768 per      0.00215575sec ->  15 Mops/sec
+areal<32,8,uint32_t>    division             32768 per      0.00391881sec ->   8 Mops/sec
+areal<64,11,uint64_t>   division             32768 per       0.0161361sec ->   2 Mops/sec
+areal<8,2,uint16_t>     multiplication       32768 per      0.00102918sec ->  31 Mops/sec
+areal<16,5,uint16_t>    multiplication       32768 per      0.00235241sec ->  13 Mops/sec
+areal<32,8,uint32_t>    multiplication       32768 per      0.00591812sec ->   5 Mops/sec
+areal<64,11,uint64_t>   multiplication       32768 per       0.0276695sec ->   1 Mops/sec
+*/
 
 }
 
@@ -0,0 +1,43 @@
+// latency.cpp: histograms of the batch-averaged operator latency of classic floats over randomized operand streams
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+// configure the cfloat arithmetic class
+#define CFLOAT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/performance/latency.hpp>
+
+// usage: cfloat_latency [--json <file>]
+template<typename Scalar>
+void MeasureLatency(const std::string& tag, std::vector<sw::universal::LatencyMeasurement>& results, size_t nrOfOperands) {
+	using namespace sw::universal;
+	std::vector<Scalar> a = GenerateOperandStream<Scalar>(nrOfOperands, 1);
+	std::vector<Scalar> b = GenerateOperandStream<Scalar>(nrOfOperands, 2);
+	MeasureArithmeticLatency(tag, a, b, results);
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	std::vector<LatencyMeasurement> results;
+	MeasureLatency< cfloat<8, 2, uint8_t> >("cfloat<8,2,uint8_t>", results, 100000);
+	MeasureLatency< cfloat<16, 5, uint16_t> >("cfloat<16,5,uint16_t>", results, 100000);
+	MeasureLatency< cfloat<32, 8, uint32_t> >("cfloat<32,8,uint32_t>", results, 50000);
+
+	return LatencyBenchmarkReport(argc, argv, "cfloat operator latency", results);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
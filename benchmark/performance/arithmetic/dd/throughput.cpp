@@ -0,0 +1,107 @@
+// throughput.cpp: arithmetic throughput of the double-double and quad-double number systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <universal/number/qd/qd.hpp>
+#include <universal/number/posit/posit.hpp>
+
+/*
+   dd_real and qd_real are meant to replace the 128-bit posit as the extended precision
+   reference of the verification suites. The benchmark runs the same dependent-free
+   vector kernels for double, dd_real (106 bits), qd_real (212 bits), and posit<128,4>,
+   and reports the throughput in Mops/s together with the slowdown relative to double.
+ */
+
+volatile double sink;  // keeps the results alive
+
+template<typename Real>
+std::vector<Real> Operands(size_t n, uint64_t seed) {
+	std::mt19937_64 engine(seed);
+	std::uniform_real_distribution<double> d(0.5, 2.0);
+	std::vector<Real> v(n);
+	for (auto& x : v) {
+		double hi = d(engine);
+		x = Real(hi) + Real(hi * d(engine) * 1.0e-17);
+	}
+	return v;
+}
+
+template<typename Real, typename Kernel>
+double Measure(size_t n, size_t nrOfRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	std::vector<Real> a = Operands<Real>(n, 1), b = Operands<Real>(n, 2), c(n);
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		for (size_t i = 0; i < n; ++i) c[i] = kernel(a[i], b[i]);
+	}
+	steady_clock::time_point end = steady_clock::now();
+	sink = double(c[n / 2]);
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	return double(n * nrOfRepetitions) / elapsed / 1.0e6;
+}
+
+// reports the throughput of Real, and its slowdown relative to the reference row unless reference is nullptr
+template<typename Real>
+void Report(const std::string& tag, size_t n, size_t nrOfRepetitions, const double* reference, double result[4]) {
+	using std::sqrt;
+	using sw::universal::sqrt;
+	result[0] = Measure<Real>(n, nrOfRepetitions, [](const Real& x, const Real& y) { return x + y; });
+	result[1] = Measure<Real>(n, nrOfRepetitions, [](const Real& x, const Real& y) { return x * y; });
+	result[2] = Measure<Real>(n, nrOfRepetitions, [](const Real& x, const Real& y) { return x / y; });
+	result[3] = Measure<Real>(n, nrOfRepetitions, [](const Real& x, const Real&) { return sqrt(x); });
+	std::cout << std::setw(14) << tag;
+	for (int i = 0; i < 4; ++i) {
+		std::cout << std::setw(10) << std::fixed << std::setprecision(2) << result[i];
+		if (reference != nullptr) std::cout << std::setw(8) << std::setprecision(0) << reference[i] / result[i] << 'x'; else std::cout << std::setw(9) << ' ';
+	}
+	std::cout << '\n';
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	constexpr size_t N = 10000;
+	std::cout << "throughput in Mops/s and slowdown relative to double\n";
+	std::cout << std::setw(14) << "type" << std::setw(19) << "add" << std::setw(19) << "mul" << std::setw(19) << "div" << std::setw(19) << "sqrt" << '\n';
+	double ref[4], dd[4], qd[4], p128[4];
+	Report<double>("double", N, 1000, nullptr, ref);
+	Report<dd_real>("dd_real", N, 100, ref, dd);
+	Report<qd_real>("qd_real", N, 20, ref, qd);
+	Report<posit<128, 4>>("posit<128,4>", N / 10, 1, ref, p128);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O3, single core Linux sandbox
+The double kernels vectorize, the multi-component kernels do not.
+
+throughput in Mops/s and slowdown relative to double
+          type                add                mul                div               sqrt
+        double   2493.24            1442.51            1138.21             402.08
+       dd_real    171.14      15x    148.07      10x     27.67      41x     65.23       6x
+       qd_real     10.83     230x     22.60      64x      1.81     630x      0.98     409x
+  posit<128,4>      0.11   22555x      0.01  199836x      0.00  543380x      0.24    1705x
+ */
@@ -0,0 +1,39 @@
+// latency.cpp: histograms of the batch-averaged operator latency of adaptive precision decimals over randomized operand streams
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <universal/number/decimal/decimal.hpp>
+#include <universal/performance/latency.hpp>
+
+// usage: decimal_latency [--json <file>]
+template<typename Scalar>
+void MeasureLatency(const std::string& tag, std::vector<sw::universal::LatencyMeasurement>& results, size_t nrOfOperands) {
+	using namespace sw::universal;
+	std::vector<Scalar> a = GenerateOperandStream<Scalar>(nrOfOperands, 1);
+	std::vector<Scalar> b = GenerateOperandStream<Scalar>(nrOfOperands, 2);
+	MeasureArithmeticLatency(tag, a, b, results);
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	std::vector<LatencyMeasurement> results;
+	MeasureLatency< decimal >("decimal", results, 20000);
+
+	return LatencyBenchmarkReport(argc, argv, "decimal operator latency", results);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
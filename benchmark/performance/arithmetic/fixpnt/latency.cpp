@@ -0,0 +1,44 @@
+// latency.cpp: histograms of the batch-averaged operator latency of fixed-point numbers over randomized operand streams
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+// configure the fixpnt arithmetic class
+#define FIXPNT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/performance/latency.hpp>
+
+// usage: fixpnt_latency [--json <file>]
+template<typename Scalar>
+void MeasureLatency(const std::string& tag, std::vector<sw::universal::LatencyMeasurement>& results, size_t nrOfOperands) {
+	using namespace sw::universal;
+	std::vector<Scalar> a = GenerateOperandStream<Scalar>(nrOfOperands, 1);
+	std::vector<Scalar> b = GenerateOperandStream<Scalar>(nrOfOperands, 2);
+	MeasureArithmeticLatency(tag, a, b, results);
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	std::vector<LatencyMeasurement> results;
+	MeasureLatency< fixpnt<8, 4, Modulo, uint8_t> >("fixpnt<8,4,Modulo>", results, 100000);
+	MeasureLatency< fixpnt<16, 8, Modulo, uint16_t> >("fixpnt<16,8,Modulo>", results, 100000);
+	MeasureLatency< fixpnt<32, 16, Modulo, uint32_t> >("fixpnt<32,16,Modulo>", results, 50000);
+	MeasureLatency< fixpnt<32, 16, Saturating, uint32_t> >("fixpnt<32,16,Saturating>", results, 50000);
+
+	return LatencyBenchmarkReport(argc, argv, "fixpnt operator latency", results);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,98 @@
+// modexp.cpp: performance of modular exponentiation on arbitrary precision integers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <iomanip>
+#include <chrono>
+#include <random>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/integer/integer.hpp>
+
+/*
+   Modular exponentiation is the workhorse of primality testing and public key
+   cryptography. The reference implementation below is square-and-multiply with
+   the generic integer operators, which reduce with the bit-serial long division.
+   The modular_context reduces at the word level with Montgomery multiplication.
+*/
+
+// random odd value of the given number of bits with the most significant bit set
+template<size_t nbits>
+sw::universal::integer<nbits, uint32_t> RandomOdd(std::mt19937_64& engine, size_t bits) {
+	using Integer = sw::universal::integer<nbits, uint32_t>;
+	Integer v(0);
+	for (size_t i = 0; i < bits; i += 32) {
+		v <<= 32;
+		v += Integer(engine() & 0xFFFF'FFFFu);
+	}
+	v.setbit(bits - 1);
+	v.setbit(0);
+	return v;
+}
+
+// square-and-multiply with the generic integer operators: the integer must hold the square of the modulus
+template<size_t nbits, typename BlockType>
+sw::universal::integer<nbits, BlockType> ReferencePowmod(sw::universal::integer<nbits, BlockType> base, const sw::universal::integer<nbits, BlockType>& exponent, const sw::universal::integer<nbits, BlockType>& m) {
+	sw::universal::integer<nbits, BlockType> result(1);
+	base %= m;
+	for (size_t i = 0; i < nbits - 1; ++i) {
+		if (exponent.at(i)) result = (result * base) % m;
+		base = (base * base) % m;
+	}
+	return result;
+}
+
+template<size_t bits>
+void MeasureModexp(size_t nrOfExponentiations, bool reference) {
+	using namespace std::chrono;
+	constexpr size_t nbits = 2 * bits + 32;
+	using Integer = sw::universal::integer<nbits, uint32_t>;
+	std::mt19937_64 engine(bits);
+	Integer m = RandomOdd<nbits>(engine, bits);
+	Integer base = RandomOdd<nbits>(engine, bits - 1);
+	Integer exponent = RandomOdd<nbits>(engine, bits);
+
+	steady_clock::time_point begin = steady_clock::now();
+	sw::universal::modular_context<nbits, uint32_t> ctx(m);
+	Integer result;
+	for (size_t i = 0; i < nrOfExponentiations; ++i) result = ctx.powmod(base, exponent);
+	steady_clock::time_point end = steady_clock::now();
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	std::cout << std::setw(5) << bits << "-bit modexp  modular_context : " << std::setw(12) << (1000.0 * elapsed / double(nrOfExponentiations)) << " msec\n";
+
+	if (reference) {
+		begin = steady_clock::now();
+		Integer ref = ReferencePowmod(base, exponent, m);
+		end = steady_clock::now();
+		elapsed = duration_cast<duration<double>>(end - begin).count();
+		std::cout << std::setw(5) << bits << "-bit modexp  integer ops     : " << std::setw(12) << (1000.0 * elapsed) << " msec" << (ref == result ? "" : "   MISMATCH") << '\n';
+	}
+}
+
+int main(int argc, char** argv)
+try {
+	std::cout << "modular exponentiation performance\n";
+
+	MeasureModexp<128>(1000, true);
+	MeasureModexp<256>(200, true);
+	MeasureModexp<512>(50, false);
+	MeasureModexp<1024>(10, false);
+	MeasureModexp<2048>(2, false);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
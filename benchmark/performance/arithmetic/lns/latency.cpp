@@ -0,0 +1,43 @@
+// latency.cpp: histograms of the batch-averaged operator latency of logarithmic numbers over randomized operand streams
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+// configure the lns arithmetic class
+#define LNS_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/lns/lns.hpp>
+#include <universal/performance/latency.hpp>
+
+// usage: lns_latency [--json <file>]
+template<typename Scalar>
+void MeasureLatency(const std::string& tag, std::vector<sw::universal::LatencyMeasurement>& results, size_t nrOfOperands) {
+	using namespace sw::universal;
+	std::vector<Scalar> a = GenerateOperandStream<Scalar>(nrOfOperands, 1);
+	std::vector<Scalar> b = GenerateOperandStream<Scalar>(nrOfOperands, 2);
+	MeasureArithmeticLatency(tag, a, b, results);
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	std::vector<LatencyMeasurement> results;
+	MeasureLatency< lns<8> >("lns<8>", results, 100000);
+	MeasureLatency< lns<16> >("lns<16>", results, 100000);
+	MeasureLatency< lns<32> >("lns<32>", results, 50000);
+
+	return LatencyBenchmarkReport(argc, argv, "lns operator latency", results);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
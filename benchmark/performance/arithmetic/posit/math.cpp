@@ -0,0 +1,102 @@
+// math.cpp: throughput of the posit elementary functions against the double shims they replace
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <universal/number/posit/posit.hpp>
+
+/*
+   The posit elementary functions replace posit(std::f(double(x))) by a table lookup for
+   posits of 16 bits or less, and by an evaluation in double, dd_real, or qd_real followed
+   by a single rounding for wider posits. The benchmark reports the throughput in Kops/s of
+   both versions. The table of a function is filled before the timing starts.
+ */
+
+volatile double sink;  // keeps the results alive
+
+template<typename Posit, typename Function>
+double Measure(const std::vector<Posit>& arguments, size_t nrOfRepetitions, Function f) {
+	using namespace std::chrono;
+	std::vector<Posit> results(arguments.size());
+	results[0] = f(arguments[0]);  // fills the table of a small posit
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		for (size_t i = 0; i < arguments.size(); ++i) results[i] = f(arguments[i]);
+	}
+	steady_clock::time_point end = steady_clock::now();
+	sink = double(results[arguments.size() / 2]);
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	return double(arguments.size() * nrOfRepetitions) / elapsed / 1.0e3;
+}
+
+template<size_t nbits, size_t es>
+void Report(const std::string& tag, size_t n, size_t nrOfRepetitions) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 engine(nbits);
+	std::uniform_real_distribution<double> d(0.1, 4.0);
+	std::vector<Posit> arguments(n);
+	for (auto& x : arguments) x = d(engine);
+
+	double native[4], shim[4];
+	native[0] = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return sw::universal::exp(x); });
+	shim[0]   = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return Posit(std::exp(double(x))); });
+	native[1] = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return sw::universal::log(x); });
+	shim[1]   = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return Posit(std::log(double(x))); });
+	native[2] = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return sw::universal::sin(x); });
+	shim[2]   = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return Posit(std::sin(double(x))); });
+	native[3] = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return sw::universal::tanh(x); });
+	shim[3]   = Measure(arguments, nrOfRepetitions, [](const Posit& x) { return Posit(std::tanh(double(x))); });
+	std::cout << std::setw(14) << tag;
+	for (int i = 0; i < 4; ++i) {
+		std::cout << std::setw(10) << std::fixed << std::setprecision(1) << native[i] << std::setw(10) << shim[i];
+	}
+	std::cout << '\n';
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::cout << "throughput in Kops/s of the posit elementary functions: native and double shim\n";
+	std::cout << std::setw(14) << "type" << std::setw(20) << "exp" << std::setw(20) << "log" << std::setw(20) << "sin" << std::setw(20) << "tanh" << '\n';
+	Report< 8, 0>("posit<8,0>", 1000, 100);
+	Report<16, 1>("posit<16,1>", 1000, 100);
+	Report<32, 2>("posit<32,2>", 1000, 10);
+	Report<64, 3>("posit<64,3>", 1000, 1);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O3, single core Linux sandbox
+The table lookup of the small posits is two orders of magnitude faster than the shim; posit<32,2>
+gains by avoiding the generic conversions, posit<64,3> pays for the dd_real evaluation.
+
+throughput in Kops/s of the posit elementary functions: native and double shim
+          type                 exp                 log                 sin                tanh
+    posit<8,0>  470685.7    5610.3  414944.6    5744.8  312112.8    5028.2  336480.5    3655.9
+   posit<16,1>  353755.6    2518.9  248820.0    2613.3  357918.8    2651.8  372833.8    2882.7
+   posit<32,2>    1828.6    1212.2    1606.5    1347.3    1814.6    1055.4    1640.9    1325.2
+   posit<64,3>     517.7     728.4     507.3     656.3     426.7     682.8     417.6     621.5
+ */
@@ -0,0 +1,96 @@
+// sqrt_latency.cpp: throughput of the integer square root of posits and cfloats against the double shim
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+
+/*
+   sqrt and rsqrt of posits up to 64 bits and of cfloats up to 64 bits compute an integer
+   square root on the significand with a fixed number of Newton steps, which makes them
+   correctly rounded and their latency independent of the argument. The benchmark reports
+   the throughput in Kops/s for arguments near 1 and for arguments spread over the dynamic
+   range, together with the shim Real(std::sqrt(double(x))) that the generic sqrt used to be.
+ */
+
+volatile double sink;  // keeps the results alive
+
+template<typename Real, typename Function>
+double Measure(const std::vector<Real>& arguments, size_t nrOfRepetitions, Function f) {
+	using namespace std::chrono;
+	std::vector<Real> results(arguments.size());
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		for (size_t i = 0; i < arguments.size(); ++i) results[i] = f(arguments[i]);
+	}
+	steady_clock::time_point end = steady_clock::now();
+	sink = double(results[arguments.size() / 2]);
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	return double(arguments.size() * nrOfRepetitions) / elapsed / 1.0e3;
+}
+
+template<typename Real>
+void Report(const std::string& tag, size_t n, size_t nrOfRepetitions) {
+	using namespace sw::universal;
+	std::mt19937_64 engine(1);
+	std::uniform_real_distribution<double> nearOne(0.5, 2.0), exponent(-60.0, 60.0);
+	std::vector<Real> unit(n), wide(n);
+	for (size_t i = 0; i < n; ++i) {
+		unit[i] = nearOne(engine);
+		wide[i] = std::pow(2.0, exponent(engine)) * nearOne(engine);
+	}
+	auto root = [](const Real& x) { return sw::universal::sqrt(x); };
+	auto rroot = [](const Real& x) { return sw::universal::rsqrt(x); };
+	auto shim = [](const Real& x) { return Real(std::sqrt(double(x))); };
+	std::cout << std::setw(16) << tag << std::fixed << std::setprecision(1)
+		<< std::setw(12) << Measure(unit, nrOfRepetitions, root) << std::setw(12) << Measure(wide, nrOfRepetitions, root)
+		<< std::setw(12) << Measure(unit, nrOfRepetitions, rroot) << std::setw(12) << Measure(wide, nrOfRepetitions, rroot)
+		<< std::setw(12) << Measure(unit, nrOfRepetitions, shim) << std::setw(12) << Measure(wide, nrOfRepetitions, shim) << '\n';
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::cout << "throughput in Kops/s for arguments near 1 and over the dynamic range\n";
+	std::cout << std::setw(16) << "type" << std::setw(24) << "sqrt" << std::setw(24) << "rsqrt" << std::setw(24) << "double shim" << '\n';
+	Report<posit<32, 2>>("posit<32,2>", 10000, 10);
+	Report<posit<64, 3>>("posit<64,3>", 10000, 10);
+	Report<cfloat<32, 8, uint32_t, true, false, false>>("cfloat<32,8>", 10000, 10);
+	Report<cfloat<64, 11, uint32_t, true, false, false>>("cfloat<64,11>", 10000, 10);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
+
+/*
+Date run : 10/19/2026
+Compiler : g++ -std=c++20 -O3, single core Linux sandbox
+The integer root does not depend on the argument, and avoids the two generic conversions of the shim.
+
+throughput in Kops/s for arguments near 1 and over the dynamic range
+            type                    sqrt                   rsqrt             double shim
+     posit<32,2>      7017.5      6685.5      6138.9      6498.7      1481.3      1465.6
+     posit<64,3>      4180.8      4804.6      3837.9      3530.2       671.1       746.6
+    cfloat<32,8>     10920.1     10377.5      9871.0      8166.8      5230.0      5774.8
+   cfloat<64,11>     10615.9     10142.0      8514.8      8799.4      2162.4      2225.1
+ */
@@ -0,0 +1,133 @@
+// interval.cpp: throughput of valid arithmetic compared to a naive interval<double>
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+// run the valid endpoints on the fast posit specializations
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#define VALID_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/valid/valid.hpp>
+
+/*
+   A valid computes both endpoints with directed rounding, so an interval operation should
+   cost about two posit operations. The reference is the textbook interval<double>, which
+   computes the endpoints in round to nearest and widens each of them by one ulp with
+   std::nextafter to stay rigorous.
+ */
+
+struct interval {
+	double lo, hi;
+	interval() : lo{ 0.0 }, hi{ 0.0 } {}
+	interval(double v) : lo{ v }, hi{ v } {}
+	interval(double l, double h) : lo{ l }, hi{ h } {}
+};
+inline interval outward(double l, double h) {
+	return interval(std::nextafter(l, -INFINITY), std::nextafter(h, INFINITY));
+}
+inline interval operator+(const interval& a, const interval& b) { return outward(a.lo + b.lo, a.hi + b.hi); }
+inline interval operator-(const interval& a, const interval& b) { return outward(a.lo - b.hi, a.hi - b.lo); }
+inline interval operator*(const interval& a, const interval& b) {
+	double p[4] = { a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi };
+	return outward(*std::min_element(p, p + 4), *std::max_element(p, p + 4));
+}
+inline interval operator/(const interval& a, const interval& b) {
+	if (b.lo <= 0.0 && b.hi >= 0.0) return interval(-INFINITY, INFINITY);
+	double q[4] = { a.lo / b.lo, a.lo / b.hi, a.hi / b.lo, a.hi / b.hi };
+	return outward(*std::min_element(q, q + 4), *std::max_element(q, q + 4));
+}
+
+constexpr size_t N = 1024 * 4;
+volatile bool sink;  // keeps the results alive
+
+// operands away from zero so that the quotients stay finite
+template<typename Interval>
+std::vector<Interval> Samples(size_t seed) {
+	std::vector<Interval> v(N);
+	for (size_t i = 0; i < N; ++i) v[i] = Interval(1.0 + double((i * 7 + seed) % 97) / 16.0);
+	return v;
+}
+
+template<typename Interval, typename Op>
+double Measure(Op op, size_t nrOfRepetitions) {
+	using namespace std::chrono;
+	std::vector<Interval> a = Samples<Interval>(1), b = Samples<Interval>(3), c(N);
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		for (size_t i = 0; i < N; ++i) c[i] = op(a[i], b[i]);
+	}
+	steady_clock::time_point end = steady_clock::now();
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	sink = c[N / 2].lo < c[N / 2].hi;
+	return double(N * nrOfRepetitions) / elapsed / 1.0e6;
+}
+
+template<typename Valid>
+double MeasureValid(int op, size_t nrOfRepetitions) {
+	using namespace std::chrono;
+	std::vector<Valid> a(N), b(N), c(N);
+	for (size_t i = 0; i < N; ++i) {
+		a[i] = 1.0 + double((i * 7 + 1) % 97) / 16.0;
+		b[i] = 1.0 + double((i * 7 + 3) % 97) / 16.0;
+	}
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		switch (op) {
+		case 0: for (size_t i = 0; i < N; ++i) c[i] = a[i] + b[i]; break;
+		case 1: for (size_t i = 0; i < N; ++i) c[i] = a[i] - b[i]; break;
+		case 2: for (size_t i = 0; i < N; ++i) c[i] = a[i] * b[i]; break;
+		default: for (size_t i = 0; i < N; ++i) c[i] = a[i] / b[i]; break;
+		}
+	}
+	steady_clock::time_point end = steady_clock::now();
+	double elapsed = duration_cast<duration<double>>(end - begin).count();
+	sink = c[N / 2].isopen();
+	return double(N * nrOfRepetitions) / elapsed / 1.0e6;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	constexpr size_t nrOfRepetitions = 100;
+	const char* opname[] = { "add", "sub", "mul", "div" };
+
+	std::cout << "interval throughput in Mops/s: valid vs interval<double>\n";
+	std::cout << std::setw(6) << "op" << std::setw(18) << "interval<double>" << std::setw(14) << "valid<16,1>" << std::setw(14) << "valid<32,2>" << '\n';
+	for (int op = 0; op < 4; ++op) {
+		double reference{ 0 };
+		switch (op) {
+		case 0: reference = Measure<interval>([](const interval& a, const interval& b) { return a + b; }, nrOfRepetitions); break;
+		case 1: reference = Measure<interval>([](const interval& a, const interval& b) { return a - b; }, nrOfRepetitions); break;
+		case 2: reference = Measure<interval>([](const interval& a, const interval& b) { return a * b; }, nrOfRepetitions); break;
+		default: reference = Measure<interval>([](const interval& a, const interval& b) { return a / b; }, nrOfRepetitions); break;
+		}
+		double v16 = MeasureValid<valid<16, 1>>(op, nrOfRepetitions);
+		double v32 = MeasureValid<valid<32, 2>>(op, nrOfRepetitions);
+		std::cout << std::setw(6) << opname[op] << std::fixed << std::setprecision(2)
+			<< std::setw(18) << reference << std::setw(14) << v16 << std::setw(14) << v32
+			<< '\n' << std::defaultfloat;
+	}
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -1,60 +1,63 @@
-// gemm.cpp: data flow performance measurement of mixed-precision matrix-matrix product
+// gemm.cpp: operation count profile of the matrix-matrix product across number systems
 //
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
-// enable the following define to show the intermediate steps in the fused-dot product
-// #define POSIT_VERBOSE_OUTPUT
-#define POSIT_TRACE_MUL
-#define QUIRE_TRACE_ADD
 // enable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 1
 #include <universal/number/posit/posit.hpp>
-// enable operation counts
-#define DECIMAL_OPERATIONS_COUNT 1
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/number/lns/lns.hpp>
 #include <universal/number/decimal/decimal.hpp>
-#define BLAS_TRACE_ROUNDING_EVENTS 1
+// enable operation counts: set to 0 to compile the kernels without instrumentation
+#define INSTRUMENTED_OPERATIONS_COUNT 1
+#include <universal/utility/instrumented.hpp>
 #include <universal/blas/blas.hpp>
 #include <universal/blas/generators.hpp>
 
-template<typename Scalar>
-std::string conditional_fdp(const sw::universal::blas::vector< Scalar >& a, const sw::universal::blas::vector< Scalar >& b) {
-	return std::string("no FDP for non-posit value_type");
-}
-template<size_t nbits, size_t es>
-std::string conditional_fdp(const sw::universal::blas::vector< sw::universal::posit<nbits, es> >& a, const sw::universal::blas::vector< sw::universal::posit<nbits, es> >& b) {
-	using namespace std;
-	stringstream ss;
-	ss << sw::universal::fdp(a, b);
-	return ss.str();
-}
-
-#if DECIMAL_OPERATIONS_COUNT
-
-// create the static storage for the occurrence measurements of the decimal number system
-bool sw::universal::decimal::enableAdd = true;
-sw::universal::occurrence<sw::universal::decimal> sw::universal::decimal::ops;
+// profile the operations of a matrix-matrix product and a matrix-vector product
+// executed in the number system Number
+template<typename Number>
+void ProfileGemm(const std::string& tag, int N) {
+	using namespace sw::universal;
+	using namespace sw::universal::blas;
+	using Scalar = instrumented<Number>;
+	using Matrix = matrix<Scalar>;
+	using Vector = vector<Scalar>;
 
-#endif
+	instrumentation<Number>::reset();
+	Matrix A, B, C;
+	Vector x(N, Scalar(1)), b;
+	{
+		instrumentation_region<Number> region("setup");
+		A = eye<Scalar>(N);
+		B = frank<Scalar>(N);
+	}
+	{
+		instrumentation_region<Number> region("gemm");
+		C = A * B;
+	}
+	{
+		instrumentation_region<Number> region("matvec");
+		b = C * x;
+	}
+	instrumentation<Number>::report(std::cout, tag);
+	std::cout << '\n';
+}
 
 int main(int argc, char** argv)
 try {
-	using namespace std;
-	using namespace sw::universal::blas;
-
-	using Scalar = decimal;
-	using Matrix = matrix<Scalar>;
+	using namespace sw::universal;
 
-	constexpr size_t N = 5;
+	constexpr int N = 15;
 
-	Matrix A = eye<Scalar>(N);
-	Matrix B = frank<Scalar>(N);
-	decimal proxy;
-	proxy.resetStats();
-	Matrix C = A * B;
-	cout << C << endl;
-	proxy.printStats(cout);
+	ProfileGemm< posit<32, 2> >("posit<32,2>", N);
+	ProfileGemm< cfloat<32, 8, uint32_t> >("cfloat<32,8,uint32_t>", N);
+	ProfileGemm< fixpnt<16, 8, Saturating, uint16_t> >("fixpnt<16,8,Saturating,uint16_t>", N);
+	ProfileGemm< lns<16> >("lns<16>", N);
+	ProfileGemm< decimal >("decimal", N);
 
 	return EXIT_SUCCESS;
 }
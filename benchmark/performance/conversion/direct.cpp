@@ -0,0 +1,98 @@
+// direct.cpp: throughput of the direct conversions between Universal number systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+// configure the number systems
+#define POSIT_FAST_POSIT_32_2 1
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/adapters/adapt_direct_conversion.hpp>
+
+/*
+   Mixed-precision pipelines convert whole arrays between formats at every stage boundary.
+   For each pair of formats this benchmark compares the throughput of the direct,
+   triple-based conversion with the round trip through double that convert_to and the
+   assignment operators take.
+ */
+
+constexpr size_t N = 1024 * 16;
+
+// a sample of values that spans the dynamic range of the narrowest formats
+template<typename Source>
+std::vector<Source> Samples() {
+	std::vector<Source> v(N);
+	for (size_t i = 0; i < N; ++i) v[i] = (double(i % 2000) - 1000.0) / 8.0 + 1.0 / double(i + 1);
+	return v;
+}
+
+template<typename Source, typename Target>
+void MeasureConversion(const std::string& src, const std::string& tgt) {
+	using namespace std::chrono;
+	std::vector<Source> samples = Samples<Source>();
+	std::vector<Target> direct(N), roundtrip(N);
+	constexpr size_t nrOfRepetitions = 5;
+
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) sw::universal::convert_direct(samples.data(), direct.data(), N);
+	steady_clock::time_point end = steady_clock::now();
+	double directElapsed = duration_cast<duration<double>>(end - begin).count();
+
+	begin = steady_clock::now();
+	for (size_t r = 0; r < nrOfRepetitions; ++r) {
+		for (size_t i = 0; i < N; ++i) roundtrip[i] = double(samples[i]);
+	}
+	end = steady_clock::now();
+	double roundtripElapsed = duration_cast<duration<double>>(end - begin).count();
+
+	double conversions = double(N * nrOfRepetitions);
+	std::cout << std::setw(14) << src << " -> " << std::setw(14) << tgt
+		<< std::setw(12) << std::fixed << std::setprecision(2) << (conversions / directElapsed / 1.0e6) << " Mconv/s direct"
+		<< std::setw(12) << (conversions / roundtripElapsed / 1.0e6) << " Mconv/s through double"
+		<< std::setw(8) << std::setprecision(1) << (roundtripElapsed / directElapsed) << "x\n" << std::defaultfloat;
+}
+
+// all targets for one source format
+template<typename Source>
+void MeasureSource(const std::string& src) {
+	using namespace sw::universal;
+	MeasureConversion<Source, posit<16, 1>>(src, "posit<16,1>");
+	MeasureConversion<Source, posit<32, 2>>(src, "posit<32,2>");
+	MeasureConversion<Source, cfloat<16, 5, uint16_t, true, false, false>>(src, "cfloat<16,5>");
+	MeasureConversion<Source, cfloat<32, 8, uint32_t, true, false, false>>(src, "cfloat<32,8>");
+	MeasureConversion<Source, fixpnt<32, 16, Modulo, uint32_t>>(src, "fixpnt<32,16>");
+	MeasureConversion<Source, integer<32, uint32_t>>(src, "integer<32>");
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace sw::universal;
+
+	std::cout << "conversion throughput: direct vs through double\n";
+
+	MeasureSource<posit<16, 1>>("posit<16,1>");
+	MeasureSource<posit<32, 2>>("posit<32,2>");
+	MeasureSource<cfloat<16, 5, uint16_t, true, false, false>>("cfloat<16,5>");
+	MeasureSource<cfloat<32, 8, uint32_t, true, false, false>>("cfloat<32,8>");
+	MeasureSource<fixpnt<32, 16, Modulo, uint32_t>>("fixpnt<32,16>");
+	MeasureSource<integer<32, uint32_t>>("integer<32>");
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
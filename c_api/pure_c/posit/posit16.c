@@ -0,0 +1,34 @@
+// posit16.c: the posit16_t type of the C API of the posit library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// pull in the posit C API definitions
+#include <universal/number/posit/posit_c_api.h>
+
+// pull in the source code to be compiled as a C library
+#include <universal/number/posit/specialized/posit_16_1.h>
+
+// posit->posit conversions round once: every posit32 is exact in double
+posit16_t posit16_fromp32(posit32_t p) {
+	return posit16_fromd(posit32_tod(p));
+}
+
+// logic functions
+// cmp returns -1 if a < b, 0 if a == b, and 1 if a > b
+int posit16_cmpp16(posit16_t a, posit16_t b) {
+	// posits are ordered as signed integers
+	int16_t x = (int16_t)a.v, y = (int16_t)b.v;
+	return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+// string conversion functions: the hex format 16.1x4000p
+void posit16_str(char str[static posit16_str_SIZE], posit16_t a) {
+	static const char digits[] = "0123456789abcdef";
+	const char* prefix = "16.1x";
+	while (*prefix) *str++ = *prefix++;
+	for (int shift = 12; shift >= 0; shift -= 4) *str++ = digits[(a.v >> shift) & 0xF];
+	*str++ = 'p';
+	*str = '\0';
+}
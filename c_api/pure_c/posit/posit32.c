@@ -0,0 +1,34 @@
+// posit32.c: the posit32_t type of the C API of the posit library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// pull in the posit C API definitions
+#include <universal/number/posit/posit_c_api.h>
+
+// pull in the source code to be compiled as a C library
+#include <universal/number/posit/specialized/posit_32_2.h>
+
+// posit->posit conversions are exact through the bit patterns of double
+posit32_t posit32_fromp16(posit16_t p) {
+	return posit32_fromd(posit16_tod(p));
+}
+
+// logic functions
+// cmp returns -1 if a < b, 0 if a == b, and 1 if a > b
+int posit32_cmpp32(posit32_t a, posit32_t b) {
+	// posits are ordered as signed integers
+	int32_t x = (int32_t)a.v, y = (int32_t)b.v;
+	return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+// string conversion functions: the hex format 32.2x40000000p
+void posit32_str(char str[static posit32_str_SIZE], posit32_t a) {
+	static const char digits[] = "0123456789abcdef";
+	const char* prefix = "32.2x";
+	while (*prefix) *str++ = *prefix++;
+	for (int shift = 28; shift >= 0; shift -= 4) *str++ = digits[(a.v >> shift) & 0xF];
+	*str++ = 'p';
+	*str = '\0';
+}
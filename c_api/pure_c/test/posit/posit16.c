@@ -0,0 +1,137 @@
+// posit16.c: test of the integer-only posit16_t arithmetic of the pure C posit library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <math.h>	// required to provide explicit nextafter/fma/sqrt declarations
+#include <string.h>
+
+#define POSIT_NO_GENERICS // MSVC doesn't support _Generic so we'll leave it out from these tests
+#include <universal/number/posit/posit_c_api.h>
+
+// the posit nearest to the exact value s + e, where s is the double nearest to it and e the error:
+// only when s is the midpoint of two posits does the sign of e decide the rounding
+posit16_t reference(double s, double e) {
+	posit16_t p = posit16_fromd(s);
+	if (e == 0.0 || isnan(s)) return p;
+	posit16_t below = posit16_fromd(nextafter(s, -INFINITY));
+	posit16_t above = posit16_fromd(nextafter(s, INFINITY));
+	if (below.v == above.v || (posit16_tod(below) + posit16_tod(above)) / 2.0 != s) return p;
+	return (e > 0.0) ? above : below;
+}
+
+bool report(const char* operation, int fails) {
+	printf("%-16s%s\n", operation, fails ? "FAIL" : "PASS");
+	return fails != 0;
+}
+
+bool check(const char* op, posit16_t pa, posit16_t pb, posit16_t pc, posit16_t pref, bool bReportIndividualTestFailure) {
+	if (pc.v == pref.v) return true;
+	if (bReportIndividualTestFailure)
+		printf("FAIL: 16.1x%04xp %s 16.1x%04xp produced 16.1x%04xp instead of 16.1x%04xp\n",
+			posit16_bits(pa), op, posit16_bits(pb), posit16_bits(pc), posit16_bits(pref));
+	return false;
+}
+
+int main(int argc, char* argv[])
+{
+	const int NR_POSITS = 65536;
+	bool failures = false;
+	bool bReportIndividualTestFailure = true;
+	char str[posit16_str_SIZE];
+	posit16_t pa, pb, pc, pref;
+
+	// special cases
+	posit16_str(str, posit16_addp16(NAR16, ZERO16));
+	printf("NAR16 + 0 = %s\n", str);
+	posit16_str(str, posit16_divp16(posit16_fromsi(1), ZERO16));
+	printf("1.0 / 0   = %s\n", str);
+	posit16_str(str, posit16_sqrt(posit16_fromsi(-1)));
+	printf("sqrt(-1)  = %s\n", str);
+
+	// conversions: every posit16 is exact in float and double
+	int fails = 0;
+	for (int a = 0; a < NR_POSITS; ++a) {
+		pa = posit16_reinterpret((uint16_t)a);
+		if (posit16_fromd(posit16_tod(pa)).v != pa.v) ++fails;
+		if (posit16_fromf(posit16_tof(pa)).v != pa.v) ++fails;
+		if (a != 0x8000 && posit16_tod(pa) != (double)posit16_tof(pa)) ++fails;
+		if (a != 0x8000 && posit16_tosll(pa) != (long long)trunc(posit16_tod(pa))) ++fails;
+	}
+	for (int i = -100000; i <= 100000; i += 7) {
+		if (posit16_fromsi(i).v != posit16_fromd((double)i).v) ++fails;
+	}
+	if (posit16_fromd(1.0e30).v != 0x7FFF || posit16_fromd(-1.0e-30).v != 0xFFFF) ++fails;
+	failures |= report("conversion", fails);
+
+	// a grid through the state space, the double reference carries its rounding error
+	int adds = 0, subs = 0, muls = 0, divs = 0, fmas = 0;
+	for (int a = 0; a < NR_POSITS; a += 37) {
+		pa = posit16_reinterpret((uint16_t)a);
+		double da = posit16_tod(pa);
+		for (int b = 0; b < NR_POSITS; b += 41) {
+			pb = posit16_reinterpret((uint16_t)b);
+			double db = posit16_tod(pb);
+			double s, t, e;
+
+			s = da + db; t = s - db; e = (da - t) + (db - (s - t));  // two-sum
+			pc = posit16_addp16(pa, pb);
+			pref = reference(s, isnan(s) ? 0.0 : e);
+			if (!check("+", pa, pb, pc, pref, bReportIndividualTestFailure)) ++adds;
+
+			s = da - db; t = s + db; e = (da - t) - (db + (s - t));
+			pc = posit16_subp16(pa, pb);
+			pref = reference(s, isnan(s) ? 0.0 : e);
+			if (!check("-", pa, pb, pc, pref, bReportIndividualTestFailure)) ++subs;
+
+			pc = posit16_mulp16(pa, pb);  // the product of two posit16 is exact in double
+			if (!check("*", pa, pb, pc, posit16_fromd(da * db), bReportIndividualTestFailure)) ++muls;
+
+			if (db != 0.0) {
+				s = da / db;
+				e = fma(-s, db, da) * db;  // the sign of the quotient error
+				pc = posit16_divp16(pa, pb);
+				pref = reference(s, isnan(s) ? 0.0 : e);
+				if (!check("/", pa, pb, pc, pref, bReportIndividualTestFailure)) ++divs;
+			}
+
+			// fma with the third operand taken from the grid
+			posit16_t pcc = posit16_reinterpret((uint16_t)(a ^ b));
+			double dc = posit16_tod(pcc);
+			double p = da * db;
+			s = p + dc; t = s - dc; e = (p - t) + (dc - (s - t));
+			pc = posit16_fma(pa, pb, pcc);
+			pref = (isnan(da) || isnan(db)) ? NAR16 : reference(s, isnan(s) ? 0.0 : e);
+			if (!check("fma", pa, pb, pc, pref, bReportIndividualTestFailure)) ++fmas;
+		}
+	}
+	failures |= report("addition", adds);
+	failures |= report("subtraction", subs);
+	failures |= report("multiplication", muls);
+	failures |= report("division", divs);
+	failures |= report("fma", fmas);
+
+	// full state space
+	fails = 0;
+	for (int a = 0; a < NR_POSITS; ++a) {   // includes negative numbers
+		pa = posit16_reinterpret((uint16_t)a);
+		pc = posit16_sqrt(pa);
+		double da = posit16_tod(pa);
+		double s = sqrt(da);
+		pref = (da < 0.0) ? NAR16 : reference(s, isnan(s) ? 0.0 : -fma(s, s, -da));
+		if (!check("sqrt", pa, pa, pc, pref, bReportIndividualTestFailure)) ++fails;
+	}
+	failures |= report("sqrt", fails);
+
+	// posits are ordered as signed integers
+	fails = 0;
+	if (posit16_cmpp16(posit16_fromd(-2.0), posit16_fromd(1.0)) >= 0) ++fails;
+	if (posit16_cmpp16(posit16_fromd(2.0), posit16_fromd(2.0)) != 0) ++fails;
+	if (posit16_cmpp16(NAR16, posit16_fromd(-1.0e10)) >= 0) ++fails;
+	posit16_str(str, posit16_fromd(1.0));
+	if (strcmp(str, "16.1x4000p") != 0) ++fails;
+	failures |= report("logic", fails);
+
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+// posit32.c: test of the integer-only posit32_t arithmetic of the pure C posit library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <math.h>	// required to provide explicit nextafter/fma/sqrt declarations
+#include <string.h>
+
+#define POSIT_NO_GENERICS // MSVC doesn't support _Generic so we'll leave it out from these tests
+#include <universal/number/posit/posit_c_api.h>
+
+// the posit nearest to the exact value s + e, where s is the double nearest to it and e the error:
+// only when s is the midpoint of two posits does the sign of e decide the rounding
+posit32_t reference(double s, double e) {
+	posit32_t p = posit32_fromd(s);
+	if (e == 0.0 || isnan(s)) return p;
+	posit32_t below = posit32_fromd(nextafter(s, -INFINITY));
+	posit32_t above = posit32_fromd(nextafter(s, INFINITY));
+	if (below.v == above.v || (posit32_tod(below) + posit32_tod(above)) / 2.0 != s) return p;
+	return (e > 0.0) ? above : below;
+}
+
+bool report(const char* operation, int fails) {
+	printf("%-16s%s\n", operation, fails ? "FAIL" : "PASS");
+	return fails != 0;
+}
+
+bool check(const char* op, posit32_t pa, posit32_t pb, posit32_t pc, posit32_t pref, bool bReportIndividualTestFailure) {
+	if (pc.v == pref.v) return true;
+	if (bReportIndividualTestFailure)
+		printf("FAIL: 32.2x%08xp %s 32.2x%08xp produced 32.2x%08xp instead of 32.2x%08xp\n",
+			posit32_bits(pa), op, posit32_bits(pb), posit32_bits(pc), posit32_bits(pref));
+	return false;
+}
+
+// random encodings with scales in [-32, 32], where the double reference resolves every tie
+uint32_t random_posit(uint64_t* state) {
+	*state = *state * 6364136223846793005ull + 1442695040888963407ull;
+	uint32_t r = (uint32_t)(*state >> 32);
+	uint32_t bits = 0x20000000u + (r & 0x3FFFFFFFu) % 0x40000000u;
+	if (bits >= 0x60000000u) bits -= 0x20000000u;
+	return (r >> 31) ? 0u - bits : bits;
+}
+
+int main(int argc, char* argv[])
+{
+	const int NR_RANDOMS = 1000000;
+	bool failures = false;
+	bool bReportIndividualTestFailure = true;
+	char str[posit32_str_SIZE];
+	posit32_t pa, pb, pc;
+	uint64_t state = 1;
+
+	// special cases
+	posit32_str(str, posit32_addp32(NAR32, ZERO32));
+	printf("NAR32 + 0 = %s\n", str);
+	posit32_str(str, posit32_divp32(posit32_fromsi(1), ZERO32));
+	printf("1.0 / 0   = %s\n", str);
+	posit32_str(str, posit32_sqrt(posit32_fromsi(-1)));
+	printf("sqrt(-1)  = %s\n", str);
+
+	// conversions: every posit32 is exact in double
+	int fails = 0;
+	for (uint64_t a = 0; a < 0x100000000ull; a += 65537) {
+		pa = posit32_reinterpret((uint32_t)a);
+		if (posit32_fromd(posit32_tod(pa)).v != pa.v) ++fails;
+		if (a != 0x80000000ull && posit32_tof(pa) != (float)posit32_tod(pa)) ++fails;
+		if (a != 0x80000000ull && fabs(posit32_tod(pa)) < 1.0e18 && posit32_tosll(pa) != (long long)trunc(posit32_tod(pa))) ++fails;
+	}
+	for (long long i = -1000000000000LL; i <= 1000000000000LL; i += 999999937LL) {
+		if (posit32_fromsll(i).v != posit32_fromd((double)i).v) ++fails;
+	}
+	if (posit32_fromd(1.0e300).v != 0x7FFFFFFF || posit32_fromd(-1.0e-300).v != 0xFFFFFFFF) ++fails;
+	failures |= report("conversion", fails);
+
+	int adds = 0, subs = 0, muls = 0, divs = 0, fmas = 0, roots = 0;
+	for (int i = 0; i < NR_RANDOMS; ++i) {
+		pa = posit32_reinterpret(random_posit(&state));
+		pb = posit32_reinterpret(random_posit(&state));
+		double da = posit32_tod(pa), db = posit32_tod(pb);
+		double s, t, e;
+
+		s = da + db; t = s - db; e = (da - t) + (db - (s - t));  // two-sum
+		pc = posit32_addp32(pa, pb);
+		if (!check("+", pa, pb, pc, reference(s, e), bReportIndividualTestFailure)) ++adds;
+
+		s = da - db; t = s + db; e = (da - t) - (db + (s - t));
+		pc = posit32_subp32(pa, pb);
+		if (!check("-", pa, pb, pc, reference(s, e), bReportIndividualTestFailure)) ++subs;
+
+		s = da * db;
+		e = fma(da, db, -s);
+		pc = posit32_mulp32(pa, pb);
+		if (!check("*", pa, pb, pc, reference(s, e), bReportIndividualTestFailure)) ++muls;
+
+		s = da / db;
+		e = fma(-s, db, da) * db;  // the sign of the quotient error
+		pc = posit32_divp32(pa, pb);
+		if (!check("/", pa, pb, pc, reference(s, e), bReportIndividualTestFailure)) ++divs;
+
+		// fma: operands with float precision make the product exact in double
+		posit32_t fa = posit32_fromf((float)da), fb = posit32_fromf((float)db);
+		double p = posit32_tod(fa) * posit32_tod(fb);
+		posit32_t pcc = posit32_reinterpret(random_posit(&state));
+		double dc = posit32_tod(pcc);
+		s = p + dc; t = s - dc; e = (p - t) + (dc - (s - t));
+		pc = posit32_fma(fa, fb, pcc);
+		if (!check("fma", fa, fb, pc, reference(s, e), bReportIndividualTestFailure)) ++fmas;
+
+		double dr = fabs(da);
+		s = sqrt(dr);
+		pc = posit32_sqrt(posit32_fromd(dr));
+		if (!check("sqrt", pa, pa, pc, reference(s, -fma(s, s, -dr)), bReportIndividualTestFailure)) ++roots;
+	}
+	failures |= report("addition", adds);
+	failures |= report("subtraction", subs);
+	failures |= report("multiplication", muls);
+	failures |= report("division", divs);
+	failures |= report("fma", fmas);
+	failures |= report("sqrt", roots);
+
+	// posits are ordered as signed integers
+	fails = 0;
+	if (posit32_cmpp32(posit32_fromd(-2.0), posit32_fromd(1.0)) >= 0) ++fails;
+	if (posit32_cmpp32(posit32_fromd(2.0), posit32_fromd(2.0)) != 0) ++fails;
+	if (posit32_cmpp32(NAR32, posit32_fromd(-1.0e30)) >= 0) ++fails;
+	if (posit32_bits(posit32_fromp16(posit16_fromd(1.5))) != posit32_bits(posit32_fromd(1.5))) ++fails;
+	posit32_str(str, posit32_fromd(1.0));
+	if (strcmp(str, "32.2x40000000p") != 0) ++fails;
+	failures |= report("logic", fails);
+
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -3,6 +3,7 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <new>
 #include <tuple>
 #include <universal/number/posit/posit_c_api.h>
 
@@ -13,11 +14,12 @@
 // POSIT_ENABLE_LITERALS
 // Disable exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 0
-// Disable standard posit specializations for the shim
+// Use the fast posit<16,1> and posit<32,2> specializations for the shim.
+// The fast posit<8,0> collides with the native posit8 C library and stays disabled.
 #define POSIT_FAST_POSIT_4_0   0
 #define POSIT_FAST_POSIT_8_0   0
-#define POSIT_FAST_POSIT_16_1  0
-#define POSIT_FAST_POSIT_32_2  0
+#define POSIT_FAST_POSIT_16_1  1
+#define POSIT_FAST_POSIT_32_2  1
 #define POSIT_FAST_POSIT_64_3  0
 #define POSIT_FAST_POSIT_128_4 0
 #define POSIT_FAST_POSIT_256_5 0
@@ -130,6 +132,21 @@ template<size_t nbits, size_t es, class positN_t> class convert_bytes : convert<
 	}
 };
 
+// convert_word reinterprets the positN_t that fit in a machine word, which avoids the bit by bit marshalling
+template<size_t nbits, size_t es, class positN_t> class convert_word : convert<nbits,es,positN_t> {
+	public:
+	static sw::universal::posit<nbits, es> decode(positN_t bits) {
+		sw::universal::posit<nbits, es> pa;
+		pa.setbits(uint64_t(bits.v));
+		return pa;
+	}
+	static positN_t encode(sw::universal::posit<nbits, es> p) {
+		positN_t out;
+		out.v = static_cast<decltype(out.v)>(p.encoding());
+		return out;
+	}
+};
+
 // operation<2,1> = 2 args, 1 result
 template<size_t nbits, size_t es> class operation21 {
 	public:
@@ -190,6 +207,7 @@ template<size_t _nbits, size_t _es, class positN_t, class positNx2_t, class conv
 	static constexpr size_t es = _es;
 	static constexpr positN_t positN = positN_t();
 	static constexpr convert conv = convert();
+	using quire_type = sw::universal::quire<nbits, es, 30>;  // capacity for 2^30 accumulations
 
 	static void format(positN_t p, char* str) {
 		using namespace sw::universal;
@@ -243,6 +261,20 @@ template<size_t _nbits, size_t _es, class positN_t, class positNx2_t, class conv
 		return convert::encode(res);
 	}
 
+	static positN_t fma(positN_t a, positN_t b, positN_t c) {
+		using namespace sw::universal;
+		posit<nbits, es> pa = convert::decode(a), pb = convert::decode(b), pc = convert::decode(c);
+		if (pa.isnar() || pb.isnar() || pc.isnar()) {
+			posit<nbits, es> nar;
+			nar.setnar();
+			return convert::encode(nar);
+		}
+		quire_type q;
+		q += quire_mul(pa, pb);
+		q += pc;
+		return quire_round(q);
+	}
+
 	template<class ocapi>
 	static positN_t fromp(decltype(ocapi::positN) p) {
 		using namespace sw::universal;
@@ -253,6 +285,89 @@ template<size_t _nbits, size_t _es, class positN_t, class positNx2_t, class conv
 		return convert::encode(outp);
 	}
 
+	// array kernels: the C boundary is crossed once per array
+
+	template<class operation21>
+	static void array21(positN_t* z, const positN_t* x, const positN_t* y, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			z[i] = convert::encode(operation21::op(convert::decode(x[i]), convert::decode(y[i])));
+		}
+	}
+
+	static void axpy(size_t n, positN_t a, const positN_t* x, positN_t* y) {
+		using namespace sw::universal;
+		posit<nbits, es> pa = convert::decode(a);
+		for (size_t i = 0; i < n; ++i) {
+			y[i] = convert::encode(sw::universal::fma(pa, convert::decode(x[i]), convert::decode(y[i])));
+		}
+	}
+
+	static positN_t dot(size_t n, const positN_t* x, const positN_t* y) {
+		using namespace sw::universal;
+		posit<nbits, es> sum(0);
+		for (size_t i = 0; i < n; ++i) sum += convert::decode(x[i]) * convert::decode(y[i]);
+		return convert::encode(sum);
+	}
+
+	static positN_t fdp(size_t n, const positN_t* x, const positN_t* y) {
+		quire_type q;
+		quire_fma_array(q, n, x, y);
+		return quire_round(q);
+	}
+
+	static void gemv(size_t m, size_t n, positN_t alpha, const positN_t* A, size_t lda, const positN_t* x, positN_t beta, positN_t* y) {
+		using namespace sw::universal;
+		posit<nbits, es> palpha = convert::decode(alpha), pbeta = convert::decode(beta);
+		quire_type q;
+		for (size_t i = 0; i < m; ++i) {
+			q.clear();
+			quire_fma_array(q, n, A + i * lda, x);
+			posit<nbits, es> row = convert::decode(quire_round(q));
+			y[i] = (pbeta.iszero() ? convert::encode(palpha * row) : convert::encode(palpha * row + pbeta * convert::decode(y[i])));
+		}
+	}
+
+	template<class in>
+	static void from_array(positN_t* out, const in* a, size_t n) {
+		using namespace sw::universal;
+		for (size_t i = 0; i < n; ++i) out[i] = convert::encode(posit<nbits, es>(a[i]));
+	}
+
+	template<class out>
+	static void to_array(out* r, const positN_t* bits, size_t n) {
+		for (size_t i = 0; i < n; ++i) r[i] = static_cast<out>(convert::decode(bits[i]));
+	}
+
+	// quire kernels behind the opaque quire handles
+
+	template<class handle>
+	static handle* quire_create() {
+		return new (std::nothrow) handle();
+	}
+
+	static void quire_fma(quire_type& q, positN_t a, positN_t b) {
+		q += sw::universal::quire_mul(convert::decode(a), convert::decode(b));
+	}
+
+	static void quire_fma_array(quire_type& q, size_t n, const positN_t* x, const positN_t* y) {
+		for (size_t i = 0; i < n; ++i) q += sw::universal::quire_mul(convert::decode(x[i]), convert::decode(y[i]));
+	}
+
+	static void quire_add(quire_type& q, positN_t a) {
+		q += convert::decode(a);
+	}
+
+	static void quire_sub(quire_type& q, positN_t a) {
+		q -= convert::decode(a);
+	}
+
+	static positN_t quire_round(const quire_type& q) {
+		using namespace sw::universal;
+		posit<nbits, es> p;
+		sw::universal::convert(q.to_value(), p);
+		return convert::encode(p);
+	}
+
 	static int cmp(positN_t a, positN_t b) {
 		using namespace sw::universal;
 		posit<nbits, es> pa = convert::decode(a);
@@ -261,14 +376,20 @@ template<size_t _nbits, size_t _es, class positN_t, class positNx2_t, class conv
 	}
 };
 
-typedef capi<4,0,posit4_t,posit4x2_t,convert_bytes<4,0,posit4_t>> capi4;
-typedef capi<8,0,posit8_t,posit8x2_t,convert_bytes<8,0,posit8_t>> capi8;
-typedef capi<16,1,posit16_t,posit16x2_t,convert_bytes<16,1,posit16_t>> capi16;
-typedef capi<32,2,posit32_t,posit32x2_t,convert_bytes<32,2,posit32_t>> capi32;
-typedef capi<64,3,posit64_t,posit64x2_t,convert_bytes<64,3,posit64_t>> capi64;
+typedef capi<4,0,posit4_t,posit4x2_t,convert_word<4,0,posit4_t>> capi4;
+typedef capi<8,0,posit8_t,posit8x2_t,convert_word<8,0,posit8_t>> capi8;
+typedef capi<16,1,posit16_t,posit16x2_t,convert_word<16,1,posit16_t>> capi16;
+typedef capi<32,2,posit32_t,posit32x2_t,convert_word<32,2,posit32_t>> capi32;
+typedef capi<64,3,posit64_t,posit64x2_t,convert_word<64,3,posit64_t>> capi64;
 typedef capi<128,4,posit128_t,posit128x2_t,convert_bytes<128,4,posit128_t>> capi128;
 typedef capi<256,5,posit256_t,posit256x2_t,convert_bytes<256,5,posit256_t>> capi256;
 
+// the opaque quire handles of the C API
+struct quire8_handle_s  { capi8::quire_type q; };
+struct quire16_handle_s { capi16::quire_type q; };
+struct quire32_handle_s { capi32::quire_type q; };
+struct quire64_handle_s { capi64::quire_type q; };
+
 // prevent any symbol mangling
 extern "C" {
 
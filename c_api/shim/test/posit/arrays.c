@@ -0,0 +1,143 @@
+// arrays.c: test of the array and quire entry points of the posit API for C programs
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#if defined(_MSC_VER)
+#define POSIT_NO_GENERICS // MSVC doesn't support _Generic so we'll leave it out from these tests
+#endif
+#include <universal/number/posit/posit_c_api.h>
+
+#define N 64
+
+// deterministic operands in [-4, 4)
+static double operand(unsigned* state) {
+	*state = *state * 1664525u + 1013904223u;
+	return ((double)(*state >> 8) / (double)(1u << 24)) * 8.0 - 4.0;
+}
+
+static bool report(const char* name, int fails) {
+	printf("%-24s %s\n", name, fails ? "FAIL" : "PASS");
+	return fails != 0;
+}
+
+int main(int argc, char* argv[])
+{
+	bool failures = false;
+	unsigned state = 12345;
+	double dx[N], dy[N], dz[N];
+	float fx[N];
+	posit16_t x16[N], y16[N], z16[N];
+	posit32_t x32[N], y32[N], z32[N], w32[N];
+	int fails;
+
+	for (int i = 0; i < N; ++i) {
+		dx[i] = operand(&state);
+		dy[i] = operand(&state);
+		fx[i] = (float)operand(&state);
+	}
+
+	// conversions
+	fails = 0;
+	posit32_from_double_array(x32, dx, N);
+	posit32_from_double_array(y32, dy, N);
+	posit32_from_float_array(w32, fx, N);
+	posit32_to_double_array(dz, x32, N);
+	for (int i = 0; i < N; ++i) {
+		if (posit32_bits(x32[i]) != posit32_bits(posit32_fromd(dx[i]))) ++fails;
+		if (posit32_bits(w32[i]) != posit32_bits(posit32_fromf(fx[i]))) ++fails;
+		if (dz[i] != posit32_tod(x32[i])) ++fails;
+	}
+	posit16_from_double_array(x16, dx, N);
+	posit16_from_double_array(y16, dy, N);
+	for (int i = 0; i < N; ++i) {
+		if (posit16_bits(x16[i]) != posit16_bits(posit16_fromd(dx[i]))) ++fails;
+	}
+	failures |= report("array conversion", fails);
+
+	// element-wise arithmetic matches the scalar operators
+	fails = 0;
+	posit32_add_array(z32, x32, y32, N);
+	for (int i = 0; i < N; ++i) if (posit32_bits(z32[i]) != posit32_bits(posit32_add(x32[i], y32[i]))) ++fails;
+	posit32_sub_array(z32, x32, y32, N);
+	for (int i = 0; i < N; ++i) if (posit32_bits(z32[i]) != posit32_bits(posit32_sub(x32[i], y32[i]))) ++fails;
+	posit32_mul_array(z32, x32, y32, N);
+	for (int i = 0; i < N; ++i) if (posit32_bits(z32[i]) != posit32_bits(posit32_mul(x32[i], y32[i]))) ++fails;
+	posit32_div_array(z32, x32, y32, N);
+	for (int i = 0; i < N; ++i) if (posit32_bits(z32[i]) != posit32_bits(posit32_div(x32[i], y32[i]))) ++fails;
+	posit16_mul_array(z16, x16, y16, N);
+	for (int i = 0; i < N; ++i) if (posit16_bits(z16[i]) != posit16_bits(posit16_mul(x16[i], y16[i]))) ++fails;
+	failures |= report("array arithmetic", fails);
+
+	// axpy fuses every multiply-add, and the rounded dot product follows the scalar loop
+	fails = 0;
+	posit32_t a = posit32_fromd(0.75);
+	for (int i = 0; i < N; ++i) z32[i] = y32[i];
+	posit32_axpy(N, a, x32, z32);
+	for (int i = 0; i < N; ++i) {
+		if (posit32_bits(z32[i]) != posit32_bits(posit32_fma(a, x32[i], y32[i]))) ++fails;
+	}
+	posit32_t sum = ZERO32;
+	for (int i = 0; i < N; ++i) sum = posit32_add(sum, posit32_mul(x32[i], y32[i]));
+	if (posit32_bits(posit32_dot(N, x32, y32)) != posit32_bits(sum)) ++fails;
+	failures |= report("axpy/dot", fails);
+
+	// the fused dot product rounds once: the products of posit16 operands in [-4, 4) sum exactly in double
+	fails = 0;
+	double exact = 0.0;
+	for (int i = 0; i < N; ++i) exact += posit16_tod(x16[i]) * posit16_tod(y16[i]);
+	if (posit16_bits(posit16_fdp(N, x16, y16)) != posit16_bits(posit16_fromd(exact))) ++fails;
+	// cancellation that a rounded dot product loses
+	posit32_t cx[3], cy[3];
+	cx[0] = posit32_fromd(1073741824.0); cx[1] = posit32_fromd(1.0); cx[2] = posit32_fromd(-1073741824.0);
+	cy[0] = posit32_fromd(1.0); cy[1] = posit32_fromd(1.0); cy[2] = posit32_fromd(1.0);
+	if (posit32_tod(posit32_fdp(3, cx, cy)) != 1.0) ++fails;
+	if (posit32_tod(posit32_dot(3, cx, cy)) != 0.0) ++fails;
+	failures |= report("fused dot product", fails);
+
+	// gemv: every row is a fused dot product
+	fails = 0;
+	enum { M = 8, LDA = 10 };
+	posit32_t A[M * LDA], yv[M], yref[M];
+	posit32_t alpha = posit32_fromd(2.0), beta = posit32_fromd(-0.5);
+	for (int i = 0; i < M * LDA; ++i) A[i] = posit32_fromd(operand(&state));
+	for (int i = 0; i < M; ++i) yv[i] = yref[i] = posit32_fromd(operand(&state));
+	posit32_gemv(M, LDA - 2, alpha, A, LDA, x32, beta, yv);
+	for (int i = 0; i < M; ++i) {
+		posit32_t row = posit32_fdp(LDA - 2, A + i * LDA, x32);
+		yref[i] = posit32_add(posit32_mul(alpha, row), posit32_mul(beta, yref[i]));
+		if (posit32_bits(yv[i]) != posit32_bits(yref[i])) ++fails;
+	}
+	failures |= report("gemv", fails);
+
+	// quire handles
+	fails = 0;
+	quire32_handle_t q = quire32_create();
+	if (q == NULL) {
+		++fails;
+	}
+	else {
+		for (int i = 0; i < N; ++i) quire32_fma(q, x32[i], y32[i]);
+		if (posit32_bits(quire32_round(q)) != posit32_bits(posit32_fdp(N, x32, y32))) ++fails;
+		quire32_clear(q);
+		quire32_fma_array(q, 3, cx, cy);
+		quire32_add(q, cx[0]);
+		quire32_sub(q, cx[0]);
+		if (posit32_tod(quire32_round(q)) != 1.0) ++fails;
+		quire32_clear(q);
+		if (posit32_bits(quire32_round(q)) != 0) ++fails;
+		quire32_destroy(q);
+	}
+	quire16_handle_t q16 = quire16_create();
+	if (q16 == NULL) {
+		++fails;
+	}
+	else {
+		quire16_fma_array(q16, N, x16, y16);
+		if (posit16_bits(quire16_round(q16)) != posit16_bits(posit16_fromd(exact))) ++fails;
+		quire16_destroy(q16);
+	}
+	failures |= report("quire", fails);
+
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
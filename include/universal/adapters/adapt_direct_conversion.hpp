@@ -0,0 +1,476 @@
+#pragma once
+// adapt_direct_conversion.hpp: correctly rounded conversions between posit, cfloat, fixpnt, and integer types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the UNIVERSAL project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <vector>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/posit/specialized/constexpr_conversion.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/number/integer/integer.hpp>
+#include <universal/number/qd/qd.hpp>
+
+/*
+  convert_to<Target>(src) relies on an overloaded convert() that usually takes a trip
+  through double or an internal::value<fbits>. The kernels in this adapter decode the
+  source encoding into a (sign, scale, significand) triple and round that triple directly
+  into the target encoding, round-to-nearest, ties-to-even. The significand carries 64 bits
+  plus a sticky bit, so the conversion is correctly rounded for every source that is 64
+  bits or less, independent of the precision of double.
+
+  Out of range values follow the rules of the target type:
+    posit   saturates to minpos/maxpos, NaN and inf map to NaR
+    cfloat  rounds to inf, or to maxpos when saturating; values below minpos round to zero
+    fixpnt  saturates or wraps depending on the arithmetic mode, NaN maps to zero
+    integer wraps modulo 2^nbits, inf saturates, NaN maps to zero
+
+  posit, cfloat, and fixpnt encodings are limited to 64 bits; integers can be of any size.
+  The double-double and quad-double types decode their exact component sum, and encode a
+  triple exactly, as its 64 bits fit in two components.
+  The lns type has no defined encoding yet and is not supported.
+ */
+
+namespace sw::universal {
+
+// the common intermediate of the direct conversions: value = (-1)^sign * 1.significand * 2^scale
+// where the hidden bit is bit 63 of the significand and sticky summarizes the bits beyond it
+struct conversion_triple {
+	bool     sign{ false };
+	bool     zero{ true };
+	bool     inf{ false };
+	bool     nan{ false };
+	int      scale{ 0 };
+	uint64_t significand{ 0 };
+	bool     sticky{ false };
+};
+
+namespace internal {
+
+	inline int msb64(uint64_t v) {
+		int msb = 63;
+		while (!((v >> msb) & 1)) --msb;
+		return msb;
+	}
+
+	template<size_t nbits>
+	constexpr uint64_t encoding_mask() { return (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1); }
+
+	// round the integer part of the triple scaled by 2^shift, round-to-nearest, ties-to-even.
+	// returns the low 64 bits of the magnitude and flags when the magnitude does not fit 64 bits
+	inline uint64_t round_to_integer(const conversion_triple& t, int shift, bool& overflow) {
+		int exponent = t.scale + shift - 63;  // magnitude = significand * 2^exponent
+		overflow = false;
+		if (exponent >= 0) {
+			overflow = (exponent >= 64) || (exponent > 0 && (t.significand >> (64 - exponent)) != 0);
+			return (exponent >= 64 ? 0 : t.significand << exponent);
+		}
+		int rs = -exponent;
+		uint64_t magnitude{ 0 };
+		bool guard{ false }, sticky{ t.sticky };
+		if (rs < 64) {
+			magnitude = t.significand >> rs;
+			guard = (t.significand >> (rs - 1)) & 1;
+			sticky = sticky || (rs > 1 && (t.significand & ((uint64_t(1) << (rs - 1)) - 1)) != 0);
+		}
+		else if (rs == 64) {
+			guard = (t.significand >> 63) & 1;
+			sticky = sticky || (t.significand & ~(uint64_t(1) << 63)) != 0;
+		}
+		else {
+			sticky = true;
+		}
+		if (guard && (sticky || (magnitude & 1))) ++magnitude;
+		return magnitude;
+	}
+
+}  // namespace internal
+
+///////////////////////////////////////////////////////////////////////////////////////
+// posit
+
+template<size_t nbits, size_t es>
+inline conversion_triple decode_triple(const posit<nbits, es>& p) {
+	static_assert(nbits <= 64, "direct conversion supports posits up to 64 bits");
+	conversion_triple t;
+	uint64_t bits = uint64_t(p.encoding()) & internal::encoding_mask<nbits>();
+	if (bits == 0) return t;
+	t.zero = false;
+	if (bits == (uint64_t(1) << (nbits - 1))) { t.nan = true; return t; }
+	uint64_t fraction{ 0 };
+	posit_decode<nbits, es>(bits, t.sign, t.scale, fraction);
+	t.significand = (uint64_t(1) << 63) | fraction;
+	return t;
+}
+
+template<size_t nbits, size_t es>
+inline posit<nbits, es>& encode_triple(const conversion_triple& t, posit<nbits, es>& p) {
+	static_assert(nbits <= 64, "direct conversion supports posits up to 64 bits");
+	if (t.nan || t.inf) return p.setbits(uint64_t(1) << (nbits - 1));
+	if (t.zero) return p.setbits(0);
+	return p.setbits(posit_encode<nbits, es>(t.sign, t.scale, t.significand & ~(uint64_t(1) << 63), t.sticky));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// cfloat
+
+template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+inline conversion_triple decode_triple(const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& c) {
+	using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+	static_assert(nbits <= 64, "direct conversion supports cfloats up to 64 bits");
+	constexpr size_t fbits = Cfloat::fbits;
+	constexpr uint64_t fractionMask = (uint64_t(1) << fbits) - 1;
+	constexpr uint64_t exponentMask = (uint64_t(1) << es) - 1;
+	uint64_t raw{ 0 };
+	for (size_t i = 0; i < Cfloat::nrBlocks; ++i) raw |= uint64_t(c.block(i)) << (i * Cfloat::bitsInBlock);
+	conversion_triple t;
+	t.sign = (raw >> (nbits - 1)) & 1;
+	uint64_t e = (raw >> fbits) & exponentMask;
+	uint64_t f = raw & fractionMask;
+	if (e == exponentMask && f == fractionMask) { t.zero = false; t.nan = true; return t; }
+	if (e == exponentMask && f == fractionMask - 1) { t.zero = false; t.inf = true; return t; }
+	if (e == 0) {
+		if (f == 0) return t;
+		int msb = internal::msb64(f);  // subnormal: 0.f * 2^MIN_EXP_NORMAL
+		t.zero = false;
+		t.scale = Cfloat::MIN_EXP_SUBNORMAL + msb;
+		t.significand = f << (63 - msb);
+		return t;
+	}
+	t.zero = false;
+	t.scale = int(e) - Cfloat::EXP_BIAS;
+	t.significand = (uint64_t(1) << 63) | (fbits > 0 ? f << (63 - fbits) : 0);
+	return t;
+}
+
+template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+inline cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& encode_triple(const conversion_triple& t, cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& c) {
+	using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+	static_assert(nbits <= 64, "direct conversion supports cfloats up to 64 bits");
+	constexpr int fbits = int(Cfloat::fbits);
+	constexpr uint64_t fractionMask = (uint64_t(1) << fbits) - 1;
+	constexpr uint64_t exponentMask = (uint64_t(1) << es) - 1;
+	constexpr uint64_t signBit = uint64_t(1) << (nbits - 1);
+	constexpr uint64_t infEncoding = (exponentMask << fbits) | (fractionMask - 1);
+	// the largest finite magnitude: supernormals use the all-ones exponent up to the encoding below inf
+	constexpr uint64_t maxposEncoding = (hasSupernormals ? infEncoding - 1 : ((exponentMask - 1) << fbits) | fractionMask);
+	constexpr uint64_t minNormalEncoding = uint64_t(1) << fbits;
+	uint64_t sign = (t.sign ? signBit : 0);
+	if (t.nan) { c.setbits((exponentMask << fbits) | fractionMask | sign); return c; }
+	if (t.zero) { c.setbits(sign); return c; }
+	uint64_t raw{ 0 };
+	bool overflow = t.inf;
+	int biased = t.scale + Cfloat::EXP_BIAS;
+	if (!overflow && biased > int(exponentMask)) overflow = true;
+	if (!overflow) {
+		// the fraction field including the hidden bit for normals, the exponent field at least 1:
+		// a carry out of the fraction during rounding propagates into the exponent field
+		int rs = (biased >= 1 ? 63 - fbits : 63 - fbits + 1 - biased);
+		uint64_t magnitude{ 0 };
+		bool guard{ false }, sticky{ t.sticky };
+		if (rs < 64) {
+			magnitude = t.significand >> rs;
+			guard = (t.significand >> (rs - 1)) & 1;
+			sticky = sticky || (rs > 1 && (t.significand & ((uint64_t(1) << (rs - 1)) - 1)) != 0);
+		}
+		else if (rs == 64) {
+			guard = true;  // the hidden bit
+			sticky = sticky || (t.significand & ~(uint64_t(1) << 63)) != 0;
+		}
+		else {
+			sticky = true;
+		}
+		raw = (biased >= 1 ? (uint64_t(biased - 1) << fbits) + magnitude : magnitude);
+		if (guard && (sticky || (raw & 1))) ++raw;
+		if constexpr (!hasSubnormals) {
+			// without subnormals the values between zero and the smallest normal round to either
+			if (raw != 0 && raw < minNormalEncoding) {
+				bool aboveHalf = (biased == 0) && ((t.significand << 1) != 0 || t.sticky);
+				raw = (aboveHalf ? minNormalEncoding : 0);
+			}
+		}
+		overflow = raw > maxposEncoding;
+	}
+	if (overflow) raw = (isSaturating ? maxposEncoding : infEncoding);
+	c.setbits(raw | sign);
+	return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// fixpnt
+
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+inline conversion_triple decode_triple(const fixpnt<nbits, rbits, arithmetic, bt>& f) {
+	static_assert(nbits <= 64, "direct conversion supports fixpnts up to 64 bits");
+	constexpr size_t bitsInBlock = fixpnt<nbits, rbits, arithmetic, bt>::bitsInBlock;
+	constexpr size_t nrBlocks = fixpnt<nbits, rbits, arithmetic, bt>::nrBlocks;
+	blockbinary<nbits, bt> bb = f.getbb();
+	uint64_t raw{ 0 };
+	for (size_t i = 0; i < nrBlocks; ++i) raw |= uint64_t(bb.block(i)) << (i * bitsInBlock);
+	raw &= internal::encoding_mask<nbits>();
+	conversion_triple t;
+	if (raw == 0) return t;
+	t.zero = false;
+	t.sign = (raw >> (nbits - 1)) & 1;
+	uint64_t magnitude = (t.sign ? (~raw + 1) & internal::encoding_mask<nbits>() : raw);
+	int msb = internal::msb64(magnitude);
+	t.scale = msb - int(rbits);
+	t.significand = magnitude << (63 - msb);
+	return t;
+}
+
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+inline fixpnt<nbits, rbits, arithmetic, bt>& encode_triple(const conversion_triple& t, fixpnt<nbits, rbits, arithmetic, bt>& f) {
+	static_assert(nbits <= 64, "direct conversion supports fixpnts up to 64 bits");
+	constexpr uint64_t maxpos = internal::encoding_mask<nbits - 1>();
+	constexpr uint64_t maxneg = maxpos + 1;
+	if (t.zero || t.nan) { f.setzero(); return f; }
+	bool overflow{ t.inf };
+	uint64_t magnitude = (t.inf ? 0 : internal::round_to_integer(t, int(rbits), overflow));
+	if (overflow || magnitude > (t.sign ? maxneg : maxpos)) {
+		if (arithmetic == Saturating || t.inf) magnitude = (t.sign ? maxneg : maxpos);
+	}
+	uint64_t raw = (t.sign ? ~magnitude + 1 : magnitude) & internal::encoding_mask<nbits>();
+	f.setbits(raw);
+	return f;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// integer
+
+template<size_t nbits, typename BlockType>
+inline conversion_triple decode_triple(const integer<nbits, BlockType>& v) {
+	conversion_triple t;
+	if (v.iszero()) return t;
+	t.zero = false;
+	t.sign = v.sign();
+	if constexpr (nbits <= 64) {
+		uint64_t raw{ 0 };
+		for (unsigned i = 0; i < integer<nbits, BlockType>::nrBytes; ++i) raw |= uint64_t(v.byte(i)) << (8 * i);
+		raw &= internal::encoding_mask<nbits>();
+		uint64_t magnitude = (t.sign ? (~raw + 1) & internal::encoding_mask<nbits>() : raw);
+		int msb = internal::msb64(magnitude);
+		t.scale = msb;
+		t.significand = magnitude << (63 - msb);
+	}
+	else {
+		// the magnitude of the most negative value is its own two's complement read as unsigned
+		integer<nbits, BlockType> magnitude = (t.sign ? -v : v);
+		int byteIndex = int(integer<nbits, BlockType>::nrBytes) - 1;
+		while (magnitude.byte(unsigned(byteIndex)) == 0) --byteIndex;
+		int msb = 8 * byteIndex + internal::msb64(magnitude.byte(unsigned(byteIndex)));
+		t.scale = msb;
+		// gather the 64 bits at and below the most significant bit, one byte at a time
+		uint64_t significand{ 0 };
+		int bitsGathered{ 0 };
+		for (int i = byteIndex; i >= 0; --i) {
+			uint64_t b = magnitude.byte(unsigned(i));
+			int valid = (i == byteIndex ? msb - 8 * byteIndex + 1 : 8);
+			if (bitsGathered + valid <= 64) {
+				significand = (significand << valid) | b;
+				bitsGathered += valid;
+			}
+			else {
+				int take = 64 - bitsGathered;
+				if (take > 0) {
+					significand = (significand << take) | (b >> (valid - take));
+					bitsGathered = 64;
+				}
+				if ((b & ((uint64_t(1) << (valid - take)) - 1)) != 0) t.sticky = true;
+			}
+		}
+		t.significand = (bitsGathered < 64 ? significand << (64 - bitsGathered) : significand);
+	}
+	return t;
+}
+
+template<size_t nbits, typename BlockType>
+inline integer<nbits, BlockType>& encode_triple(const conversion_triple& t, integer<nbits, BlockType>& v) {
+	v.clear();
+	if (t.zero || t.nan) return v;
+	if (t.inf) {
+		// saturate to the extreme values
+		v.setbit(nbits - 1);
+		if (!t.sign) v.flip();
+		return v;
+	}
+	if (t.scale < 63) {
+		bool overflow{ false };
+		v.setbits(internal::round_to_integer(t, 0, overflow));
+	}
+	else {
+		int shift = t.scale - 63;
+		if (shift >= int(nbits)) return v;  // all significant bits are shifted out: 0 modulo 2^nbits
+		v.setbits(t.significand);
+		v <<= shift;
+	}
+	if (t.sign) v = -v;
+	return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// dd_real and qd_real
+
+namespace internal {
+
+	// decode the exact sum of n nonoverlapping doubles ordered by decreasing magnitude.
+	// The bits at and below the leading component are gathered in a 128-bit window, two's
+	// complement, that ends 126 bits below the leading bit. The part of the sum below the
+	// window is less than one unit of the window and has the sign of its leading nonzero
+	// component, so the window holds the floor of the sum and the sticky bit marks the rest.
+	inline conversion_triple decode_components(const double* c, size_t n) {
+		conversion_triple t;
+		if (n == 0 || c[0] == 0.0) return t;
+		t.zero = false;
+		if (std::isnan(c[0])) { t.nan = true; return t; }
+		t.sign = std::signbit(c[0]);
+		if (std::isinf(c[0])) { t.inf = true; return t; }
+
+		int leading{ 0 };
+		(void)std::frexp(c[0], &leading);  // |c[0]| in [2^(leading-1), 2^leading)
+		const int lsb = leading - 126;
+		uint64_t upper{ 0 }, lower{ 0 };
+		auto accumulate = [&](uint64_t hi, uint64_t lo, bool subtract) {
+			if (subtract) {
+				uint64_t borrow = (lower < lo ? 1 : 0);
+				lower -= lo;
+				upper -= hi + borrow;
+			}
+			else {
+				lower += lo;
+				upper += hi + (lower < lo ? 1 : 0);
+			}
+		};
+		int tail{ 0 };  // the sign of the part of the sum below the window
+		for (size_t i = 0; i < n && tail == 0; ++i) {
+			if (c[i] == 0.0) continue;
+			bool subtract = (std::signbit(c[i]) != t.sign);
+			int e{ 0 };
+			double f = std::frexp(std::fabs(c[i]), &e);
+			uint64_t m = uint64_t(std::ldexp(f, 53));  // |c[i]| = m * 2^(e - 53)
+			int shift = e - 53 - lsb;
+			if (shift >= 0) {
+				accumulate((shift == 0 ? 0 : (shift >= 64 ? m << (shift - 64) : m >> (64 - shift))), (shift >= 64 ? 0 : m << shift), subtract);
+			}
+			else {
+				int rs = -shift;
+				uint64_t integral = (rs >= 64 ? 0 : m >> rs);
+				uint64_t fraction = (rs >= 64 ? m : m & ((uint64_t(1) << rs) - 1));
+				accumulate(0, integral, subtract);
+				if (fraction != 0) tail = (subtract ? -1 : 1);
+				// the components that follow are entirely below the window
+				for (size_t j = i + 1; j < n && tail == 0; ++j) {
+					if (c[j] != 0.0) tail = (std::signbit(c[j]) != t.sign ? -1 : 1);
+				}
+				break;
+			}
+		}
+		if (tail < 0) accumulate(0, 1, true);
+		t.sticky = (tail != 0);
+
+		// normalize the window: the leading bit is at position 125, or 124 after a negative tail
+		int msb = (upper != 0 ? 64 + msb64(upper) : msb64(lower));
+		t.scale = lsb + msb;
+		if (msb >= 64) {
+			int s = msb - 63;  // the bits of the window below the significand
+			t.significand = (s == 64 ? upper : (upper << (64 - s)) | (lower >> s));
+			if (s < 64 ? (lower << (64 - s)) != 0 : lower != 0) t.sticky = true;
+		}
+		else {
+			t.significand = lower << (63 - msb);
+		}
+		return t;
+	}
+
+	// the exact value of a triple as the sum of two doubles
+	inline void encode_components(const conversion_triple& t, double& c0, double& c1) {
+		c1 = 0.0;
+		if (t.nan) { c0 = std::numeric_limits<double>::quiet_NaN(); return; }
+		if (t.inf) { c0 = (t.sign ? -INFINITY : INFINITY); return; }
+		if (t.zero) { c0 = (t.sign ? -0.0 : 0.0); return; }
+		double upper = std::ldexp(double(t.significand & ~uint64_t(0x7FF)), t.scale - 63);
+		double lower = std::ldexp(double(t.significand & uint64_t(0x7FF)), t.scale - 63);
+		c0 = quick_two_sum(upper, lower, c1);
+		if (t.sign) { c0 = -c0; c1 = -c1; }
+	}
+
+}  // namespace internal
+
+inline conversion_triple decode_triple(const dd_real& v) {
+	double c[2] = { v.high(), v.low() };
+	return internal::decode_components(c, 2);
+}
+
+inline dd_real& encode_triple(const conversion_triple& t, dd_real& v) {
+	double c0, c1;
+	internal::encode_components(t, c0, c1);
+	v.set(c0, c1);
+	return v;
+}
+
+inline conversion_triple decode_triple(const qd_real& v) {
+	double c[4] = { v[0], v[1], v[2], v[3] };
+	return internal::decode_components(c, 4);
+}
+
+inline qd_real& encode_triple(const conversion_triple& t, qd_real& v) {
+	double c0, c1;
+	internal::encode_components(t, c0, c1);
+	v.set(c0, c1, 0.0, 0.0);
+	return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// conversion entry points
+
+namespace internal {
+
+	// the general case goes through the conversion triple
+	template<typename Source, typename Target>
+	inline void convert_direct(const Source& src, Target& tgt) {
+		encode_triple(decode_triple(src), tgt);
+	}
+
+	// integers of any size convert exactly modulo 2^nbits: sign extend the bytes
+	template<size_t snbits, typename SourceBlockType, size_t tnbits, typename TargetBlockType>
+	inline void convert_direct(const integer<snbits, SourceBlockType>& src, integer<tnbits, TargetBlockType>& tgt) {
+		constexpr unsigned srcBytes = integer<snbits, SourceBlockType>::nrBytes;
+		constexpr unsigned tgtBytes = integer<tnbits, TargetBlockType>::nrBytes;
+		constexpr uint8_t srcMask = uint8_t(0xFFu >> (8 * srcBytes - snbits));
+		constexpr uint8_t tgtMask = uint8_t(0xFFu >> (8 * tgtBytes - tnbits));
+		uint8_t extension = (src.sign() ? 0xFF : 0x00);
+		for (unsigned i = 0; i < tgtBytes; ++i) {
+			uint8_t byte = extension;
+			if (i + 1 < srcBytes) byte = src.byte(i);
+			if (i + 1 == srcBytes) byte = uint8_t((src.byte(i) & srcMask) | (extension & ~srcMask));
+			if (i + 1 == tgtBytes) byte &= tgtMask;
+			tgt.setbyte(i, byte);
+		}
+	}
+
+}  // namespace internal
+
+// convert a value of a Universal number system to another, correctly rounded
+template<typename Target, typename Source>
+inline Target convert_direct(const Source& src) {
+	Target tgt;
+	internal::convert_direct(src, tgt);
+	return tgt;
+}
+
+// convert an array of n values
+template<typename Target, typename Source>
+inline void convert_direct(const Source* src, Target* tgt, size_t n) {
+	for (size_t i = 0; i < n; ++i) internal::convert_direct(src[i], tgt[i]);
+}
+
+// convert a vector, resizing the target to match the source
+template<typename Target, typename Source>
+inline void convert_direct(const std::vector<Source>& src, std::vector<Target>& tgt) {
+	tgt.resize(src.size());
+	convert_direct(src.data(), tgt.data(), src.size());
+}
+
+}  // namespace sw::universal
@@ -0,0 +1,236 @@
+#pragma once
+// batched.hpp: interleaved batches of small matrices and batched LU/solve/inverse
+//
+// A batch stores element (i,j) of all instances contiguously, that is,
+// element (i,j) of instance b lives at data[(i*N + j)*batchSize + b].
+// This structure-of-arrays layout turns the instance index into the
+// unit-stride, innermost loop of every kernel, so that the same operation
+// on many independent systems streams through memory and vectorizes
+// for native types. The kernels process the batch in tiles whose
+// scratch state lives on the stack, and distribute tiles across threads:
+// no allocation takes place per solve.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
+#include <array>
+#include <utility>  // std::swap
+#include <universal/blas/small_matrix.hpp>
+#include <universal/utility/parallel_for.hpp>
+
+namespace sw::universal::blas {
+
+// number of instances processed together by one thread
+#ifndef BLAS_BATCH_TILE
+#define BLAS_BATCH_TILE 64
+#endif
+
+template<typename Scalar, size_t M, size_t N>
+class batched_matrix {
+public:
+	static constexpr size_t nrows = M;
+	static constexpr size_t ncols = N;
+	typedef Scalar                           value_type;
+	typedef small_matrix<Scalar, M, N>       instance_type;
+
+	batched_matrix() : _batch{ 0 }, data(0) {}
+	batched_matrix(size_t batchSize) : _batch{ batchSize }, data(M * N * batchSize, Scalar(0)) {}
+
+	// element (i,j) of instance b
+	Scalar  operator()(size_t b, size_t i, size_t j) const { return data[(i * N + j) * _batch + b]; }
+	Scalar& operator()(size_t b, size_t i, size_t j) { return data[(i * N + j) * _batch + b]; }
+
+	// gather an instance into a small_matrix
+	instance_type load(size_t b) const {
+		instance_type A;
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) A(i, j) = data[(i * N + j) * _batch + b];
+		}
+		return A;
+	}
+	// scatter a small_matrix into an instance
+	void store(size_t b, const instance_type& A) {
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) data[(i * N + j) * _batch + b] = A(i, j);
+		}
+	}
+
+	// modifiers
+	inline void setzero() { for (auto& e : data) e = Scalar(0); }
+	inline void resize(size_t batchSize) { _batch = batchSize; data.resize(M * N * batchSize); }
+	// selectors
+	inline size_t batch_size() const { return _batch; }
+	static constexpr size_t rows() { return M; }
+	static constexpr size_t cols() { return N; }
+
+	// unit-stride view of element (i,j) across the batch
+	Scalar* lane(size_t i, size_t j) { return &data[(i * N + j) * _batch]; }
+	const Scalar* lane(size_t i, size_t j) const { return &data[(i * N + j) * _batch]; }
+
+private:
+	size_t _batch;
+	std::vector<Scalar> data;
+};
+
+// a batch of vectors is a batch of single-column matrices
+template<typename Scalar, size_t N>
+using batched_vector = batched_matrix<Scalar, N, 1>;
+
+// batched LU decomposition with partial pivoting, in-place.
+// Each instance is factored exactly as small_matrix ludcmp() would do, with the row
+// interchanges recorded in piv, which holds one pivot row per column per instance.
+// A zero pivot skips the elimination of that column for that instance, as in ludcmp().
+// info(b, 0, 0) is 0 on success or k+1 when U(k,k) of instance b is exactly zero.
+// Returns the number of singular instances.
+template<typename Scalar, size_t N>
+size_t batched_ludcmp(batched_matrix<Scalar, N, N>& A, batched_matrix<size_t, N, 1>& piv, batched_matrix<int, 1, 1>& info, size_t nrThreads = 0) {
+	constexpr size_t TILE = BLAS_BATCH_TILE;
+	const size_t batchSize = A.batch_size();
+	piv.resize(batchSize);
+	info.resize(batchSize);
+	info.setzero();
+	parallel_for(0, batchSize, [&](size_t first, size_t last) {
+		for (size_t b0 = first; b0 < last; b0 += TILE) {
+			size_t nb = (last - b0 < TILE ? last - b0 : TILE);
+			std::array<Scalar, TILE> pivot;
+			std::array<size_t, TILE> p;
+			std::array<Scalar, TILE> rcp;
+			std::array<bool, TILE> singular;
+			for (size_t j = 0; j < N; ++j) {
+				// search for the pivot in column j for each instance
+				const Scalar* ajj = A.lane(j, j) + b0;
+				for (size_t b = 0; b < nb; ++b) {
+					pivot[b] = (ajj[b] < Scalar(0) ? -ajj[b] : ajj[b]);
+					p[b] = j;
+				}
+				for (size_t i = j + 1; i < N; ++i) {
+					const Scalar* aij = A.lane(i, j) + b0;
+					for (size_t b = 0; b < nb; ++b) {
+						Scalar e = (aij[b] < Scalar(0) ? -aij[b] : aij[b]);
+						if (e > pivot[b]) {
+							pivot[b] = e;
+							p[b] = i;
+						}
+					}
+				}
+				// row interchanges are instance specific
+				size_t* pj = piv.lane(j, 0) + b0;
+				for (size_t b = 0; b < nb; ++b) {
+					pj[b] = p[b];
+					if (p[b] != j) {
+						for (size_t k = 0; k < N; ++k) std::swap(A(b0 + b, p[b], k), A(b0 + b, j, k));
+					}
+				}
+				// a zero pivot skips the elimination of column j for that instance
+				int* status = info.lane(0, 0) + b0;
+				for (size_t b = 0; b < nb; ++b) {
+					singular[b] = (ajj[b] == Scalar(0));
+					if (singular[b]) {
+						if (status[b] == 0) status[b] = static_cast<int>(j + 1);
+					}
+					else {
+						rcp[b] = Scalar(1) / ajj[b];
+					}
+				}
+				for (size_t i = j + 1; i < N; ++i) {
+					Scalar* aij = A.lane(i, j) + b0;
+					for (size_t b = 0; b < nb; ++b) if (!singular[b]) aij[b] *= rcp[b];
+				}
+				// rank-1 update of the trailing submatrix
+				for (size_t i = j + 1; i < N; ++i) {
+					const Scalar* lij = A.lane(i, j) + b0;
+					for (size_t k = j + 1; k < N; ++k) {
+						const Scalar* ujk = A.lane(j, k) + b0;
+						Scalar* aik = A.lane(i, k) + b0;
+						for (size_t b = 0; b < nb; ++b) if (!singular[b]) aik[b] -= lij[b] * ujk[b];
+					}
+				}
+			}
+		}
+	}, nrThreads, TILE);
+	size_t nrOfSingularInstances = 0;
+	for (size_t b = 0; b < batchSize; ++b) if (info(b, 0, 0) != 0) ++nrOfSingularInstances;
+	return nrOfSingularInstances;
+}
+
+// batched backsubstitution: solves LU X = PB in-place for NRHS right hand sides per instance
+template<typename Scalar, size_t N, size_t NRHS>
+void batched_lubksb(const batched_matrix<Scalar, N, N>& LU, const batched_matrix<size_t, N, 1>& piv, batched_matrix<Scalar, N, NRHS>& B, size_t nrThreads = 0) {
+	constexpr size_t TILE = BLAS_BATCH_TILE;
+	const size_t batchSize = LU.batch_size();
+	parallel_for(0, batchSize, [&](size_t first, size_t last) {
+		for (size_t b0 = first; b0 < last; b0 += TILE) {
+			size_t nb = (last - b0 < TILE ? last - b0 : TILE);
+			// apply the row interchanges
+			for (size_t i = 0; i < N; ++i) {
+				const size_t* pi = piv.lane(i, 0) + b0;
+				for (size_t b = 0; b < nb; ++b) {
+					if (pi[b] != i) {
+						for (size_t r = 0; r < NRHS; ++r) std::swap(B(b0 + b, i, r), B(b0 + b, pi[b], r));
+					}
+				}
+			}
+			for (size_t r = 0; r < NRHS; ++r) {
+				// forward substitution with the unit lower triangle
+				for (size_t i = 1; i < N; ++i) {
+					Scalar* bi = B.lane(i, r) + b0;
+					for (size_t j = 0; j < i; ++j) {
+						const Scalar* lij = LU.lane(i, j) + b0;
+						const Scalar* bj = B.lane(j, r) + b0;
+						for (size_t b = 0; b < nb; ++b) bi[b] -= lij[b] * bj[b];
+					}
+				}
+				// backsubstitution with the upper triangle
+				for (size_t i = N; i >= 1; --i) {
+					Scalar* bi = B.lane(i - 1, r) + b0;
+					for (size_t j = i; j < N; ++j) {
+						const Scalar* uij = LU.lane(i - 1, j) + b0;
+						const Scalar* bj = B.lane(j, r) + b0;
+						for (size_t b = 0; b < nb; ++b) bi[b] -= uij[b] * bj[b];
+					}
+					const Scalar* uii = LU.lane(i - 1, i - 1) + b0;
+					for (size_t b = 0; b < nb; ++b) if (uii[b] != Scalar(0)) bi[b] /= uii[b];
+				}
+			}
+		}
+	}, nrThreads, TILE);
+}
+
+// solve A X = B for every instance in the batch: A is overwritten with its LU factors, B with the solution
+// info(b, 0, 0) holds the batched_ludcmp() status of instance b: the solution of a singular instance
+// is set to zero, as small_matrix solve() does. Returns the number of singular instances.
+template<typename Scalar, size_t N, size_t NRHS>
+size_t batched_solve(batched_matrix<Scalar, N, N>& A, batched_matrix<Scalar, N, NRHS>& B, batched_matrix<int, 1, 1>& info, size_t nrThreads = 0) {
+	const size_t batchSize = A.batch_size();
+	batched_matrix<size_t, N, 1> piv(batchSize);
+	size_t nrOfSingularInstances = batched_ludcmp(A, piv, info, nrThreads);
+	batched_lubksb(A, piv, B, nrThreads);
+	if (nrOfSingularInstances > 0) {
+		const int* status = info.lane(0, 0);
+		for (size_t i = 0; i < N; ++i) {
+			for (size_t r = 0; r < NRHS; ++r) {
+				Scalar* bi = B.lane(i, r);
+				for (size_t b = 0; b < batchSize; ++b) if (status[b] != 0) bi[b] = Scalar(0);
+			}
+		}
+	}
+	return nrOfSingularInstances;
+}
+
+// invert every instance in the batch: A is overwritten with its LU factors
+// info(b, 0, 0) holds the batched_ludcmp() status of instance b: the inverse of a singular instance
+// is set to zero, as small_matrix inv() does. Returns the number of singular instances.
+template<typename Scalar, size_t N>
+size_t batched_inv(batched_matrix<Scalar, N, N>& A, batched_matrix<Scalar, N, N>& Ainv, batched_matrix<int, 1, 1>& info, size_t nrThreads = 0) {
+	const size_t batchSize = A.batch_size();
+	Ainv.resize(batchSize);
+	Ainv.setzero();
+	for (size_t i = 0; i < N; ++i) {
+		Scalar* aii = Ainv.lane(i, i);
+		for (size_t b = 0; b < batchSize; ++b) aii[b] = Scalar(1);
+	}
+	return batched_solve(A, Ainv, info, nrThreads);
+}
+
+}  // namespace sw::universal::blas
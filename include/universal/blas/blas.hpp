@@ -53,12 +53,32 @@ constexpr uint64_t SIZE_512G = 512 * SIZE_1G;
 #include <universal/blas/blas_l3.hpp>
 #include <universal/blas/inverse.hpp>
 
+// fixed-size matrices and batched solvers for many small systems
+#include <universal/blas/small_matrix.hpp>
+#include <universal/blas/batched.hpp>
+
+// matrix-free stencil operators and relaxation solvers on structured grids
+#include <universal/blas/stencil.hpp>
+
+// compressed sparse row matrices
+#include <universal/blas/compressed_matrix.hpp>
+
+// N-dimensional tensors, packed sub-byte storage, and inference kernels
+#include <universal/blas/tensor.hpp>
+#include <universal/blas/packed_tensor.hpp>
+#include <universal/blas/tensor_kernels.hpp>
+
 // solvers
 #include <universal/blas/solvers/lu.hpp>
 #include <universal/blas/solvers/lsq.hpp>
 #include <universal/blas/solvers/qr.hpp>
 #include <universal/blas/solvers/svd.hpp>
 
+// mixed-precision Krylov subspace solvers and their preconditioners
+#include <universal/blas/solvers/pcg.hpp>
+#include <universal/blas/solvers/bicgstab.hpp>
+#include <universal/blas/solvers/gmres.hpp>
+
 // Matrix operators
 #include <universal/blas/operators.hpp>
 
@@ -38,10 +38,58 @@ template<typename Scalar, typename Vector>
 void axpy(size_t n, Scalar a, const Vector& x, size_t incx, Vector& y, size_t incy) {
 	size_t cnt, ix, iy;
 	for (cnt = 0, ix = 0, iy = 0; cnt < n && ix < size(x) && iy < size(y); ++cnt, ix += incx, iy += incy) {
-		y[iy] += a * x[ix];
+		y[iy] = multiply_add<typename Vector::value_type>(a, x[ix], y[iy]);
 	}
 }
 
+// fused vector update kernels
+// Compound expressions such as x = x + alpha * p evaluate through the vector operators,
+// which return by value: each statement allocates and fills one or two temporaries.
+// The kernels below evaluate the expression in a single pass in-place. The multiply
+// and the add of each term are fused through multiply_add(). For the number systems
+// that provide an fma this rounds once, so the results can differ in the last bit from
+// the operator form, which rounds the product and the sum separately; the CG solvers
+// that use these kernels change accordingly. Without an fma the kernels perform the same
+// arithmetic operations in the same order as the operator form, and thus yield
+// bit-identical results.
+
+// y = a * x + y
+template<typename Scalar>
+void axpy(const Scalar& a, const sw::universal::blas::vector<Scalar>& x, sw::universal::blas::vector<Scalar>& y) {
+	size_t n = (size(x) < size(y) ? size(x) : size(y));
+	for (size_t i = 0; i < n; ++i) y[i] = multiply_add(a, x[i], y[i]);
+}
+
+// y = x + b * y
+template<typename Scalar>
+void xpby(const sw::universal::blas::vector<Scalar>& x, const Scalar& b, sw::universal::blas::vector<Scalar>& y) {
+	size_t n = (size(x) < size(y) ? size(x) : size(y));
+	for (size_t i = 0; i < n; ++i) y[i] = multiply_add(b, y[i], x[i]);
+}
+
+// y = a * x + b * y
+template<typename Scalar>
+void axpby(const Scalar& a, const sw::universal::blas::vector<Scalar>& x, const Scalar& b, sw::universal::blas::vector<Scalar>& y) {
+	size_t n = (size(x) < size(y) ? size(x) : size(y));
+	for (size_t i = 0; i < n; ++i) y[i] = multiply_add(a, x[i], b * y[i]);
+}
+
+// y = y + a * x, returning the 1-norm of the change in y, that is, normL1(y_old - y_new)
+// Iterative solvers use the size of the update as convergence criterion: fusing it
+// into the update avoids keeping a copy of the previous iterate.
+template<typename Scalar>
+Scalar axpy_normL1(const Scalar& a, const sw::universal::blas::vector<Scalar>& x, sw::universal::blas::vector<Scalar>& y) {
+	using namespace sw::universal; // to specialize abs()
+	Scalar L1Norm{ 0 };
+	size_t n = (size(x) < size(y) ? size(x) : size(y));
+	for (size_t i = 0; i < n; ++i) {
+		Scalar y_old = y[i];
+		y[i] = multiply_add(a, x[i], y_old);
+		L1Norm += abs(y_old - y[i]);
+	}
+	return L1Norm;
+}
+
 // vector copy
 template<typename Vector>
 void copy(size_t n, const Vector& x, size_t incx, Vector& y, size_t incy) {
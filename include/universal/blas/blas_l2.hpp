@@ -15,14 +15,14 @@
 #define BLAS_TRACE_ROUNDING_EVENTS 0
 #endif
 
-// Matrix-vector product: b = A * x, no quire for posit values
+// Matrix-vector product: b = A * x, no quire for posit values, but fused multiply-adds where available
 template<typename Matrix, typename Vector>
 void matvec(Vector& b, const Matrix& A, const Vector& x) {
 	using Scalar = typename Vector::value_type;
 	for (size_t i = 0; i < A.rows(); ++i) {
 		b[i] = Scalar(0);
 		for (size_t j = 0; j < A.cols(); ++j) {
-			b[i] += A(i, j) * x[j];
+			b[i] = sw::universal::multiply_add(Scalar(A(i, j)), x[j], b[i]);
 		}
 	}
 }
@@ -0,0 +1,131 @@
+#pragma once
+// compressed_matrix.hpp: sparse matrix in compressed sparse row format
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <universal/blas/vector.hpp>
+#include <universal/blas/matrix.hpp>
+
+namespace sw::universal::blas {
+
+// the nonzeros of row i are values[rowPtr[i] .. rowPtr[i+1]) in columns colIdx[rowPtr[i] .. rowPtr[i+1]),
+// with the columns of a row in increasing order
+template<typename Scalar>
+class compressed_matrix {
+public:
+	typedef Scalar value_type;
+
+	compressed_matrix() : _m{ 0 }, _n{ 0 }, rowPtr(1, 0) {}
+	// from the nonzeros of a dense matrix
+	template<typename SourceScalar>
+	explicit compressed_matrix(const matrix<SourceScalar>& A) : _m{ A.rows() }, _n{ A.cols() }, rowPtr(1, 0) {
+		for (size_t i = 0; i < _m; ++i) {
+			for (size_t j = 0; j < _n; ++j) {
+				if (A(i, j) != SourceScalar(0)) {
+					colIdx.push_back(j);
+					values.push_back(convert_element(A(i, j)));
+				}
+			}
+			rowPtr.push_back(colIdx.size());
+		}
+	}
+	// the same sparsity pattern in another number system
+	template<typename SourceScalar>
+	explicit compressed_matrix(const compressed_matrix<SourceScalar>& A) : _m{ A.rows() }, _n{ A.cols() }, rowPtr(A.row_pointers()), colIdx(A.column_indices()) {
+		values.reserve(A.nonzeros());
+		for (const auto& v : A.nonzero_values()) values.push_back(convert_element(v));
+	}
+	// from (row, column, value) triplets in any order; duplicates are summed
+	compressed_matrix(size_t m, size_t n, std::vector< std::tuple<size_t, size_t, Scalar> > triplets) : _m{ m }, _n{ n }, rowPtr(1, 0) {
+		std::sort(triplets.begin(), triplets.end(), [](const auto& a, const auto& b) {
+			return std::get<0>(a) < std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+		});
+		size_t t = 0;
+		for (size_t i = 0; i < m; ++i) {
+			while (t < triplets.size() && std::get<0>(triplets[t]) == i) {
+				size_t j = std::get<1>(triplets[t]);
+				if (colIdx.size() > rowPtr.back() && colIdx.back() == j) {
+					values.back() += std::get<2>(triplets[t]);
+				}
+				else {
+					colIdx.push_back(j);
+					values.push_back(std::get<2>(triplets[t]));
+				}
+				++t;
+			}
+			rowPtr.push_back(colIdx.size());
+		}
+	}
+
+	// element (i, j), zero when it is not stored
+	Scalar operator()(size_t i, size_t j) const {
+		auto first = colIdx.begin() + rowPtr[i], last = colIdx.begin() + rowPtr[i + 1];
+		auto it = std::lower_bound(first, last, j);
+		return (it != last && *it == j ? values[size_t(it - colIdx.begin())] : Scalar(0));
+	}
+
+	inline size_t rows() const { return _m; }
+	inline size_t cols() const { return _n; }
+	inline size_t nonzeros() const { return values.size(); }
+
+	const std::vector<size_t>& row_pointers() const { return rowPtr; }
+	const std::vector<size_t>& column_indices() const { return colIdx; }
+	const std::vector<Scalar>& nonzero_values() const { return values; }
+	std::vector<Scalar>& nonzero_values() { return values; }
+
+private:
+	size_t _m, _n;
+	std::vector<size_t> rowPtr;
+	std::vector<size_t> colIdx;
+	std::vector<Scalar> values;
+
+	template<typename SourceScalar>
+	static Scalar convert_element(const SourceScalar& v) {
+		if constexpr (std::is_same_v<Scalar, SourceScalar>) return v; else return Scalar(double(v));
+	}
+};
+
+template<typename Scalar>
+inline size_t num_rows(const compressed_matrix<Scalar>& A) { return A.rows(); }
+template<typename Scalar>
+inline size_t num_cols(const compressed_matrix<Scalar>& A) { return A.cols(); }
+
+// b = A * x
+template<typename Scalar>
+vector<Scalar> operator*(const compressed_matrix<Scalar>& A, const vector<Scalar>& x) {
+	vector<Scalar> b(A.rows());
+	const auto& rowPtr = A.row_pointers();
+	const auto& colIdx = A.column_indices();
+	const auto& values = A.nonzero_values();
+	for (size_t i = 0; i < A.rows(); ++i) {
+		Scalar sum(0);
+		for (size_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k) sum += values[k] * x[colIdx[k]];
+		b[i] = sum;
+	}
+	return b;
+}
+
+// the 2D Laplacian difference matrix of laplace2D() in compressed format, for grids beyond the reach of a dense matrix
+template<typename Scalar>
+void laplace2D(compressed_matrix<Scalar>& A, size_t m, size_t n) {
+	std::vector< std::tuple<size_t, size_t, Scalar> > triplets;
+	triplets.reserve(5 * m * n);
+	for (size_t i = 0; i < m; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			size_t row = i * n + j;
+			triplets.emplace_back(row, row, Scalar(4.0));
+			if (j < n - 1) triplets.emplace_back(row, row + 1, Scalar(-1.0));
+			if (i < m - 1) triplets.emplace_back(row, row + n, Scalar(-1.0));
+			if (j > 0) triplets.emplace_back(row, row - 1, Scalar(-1.0));
+			if (i > 0) triplets.emplace_back(row, row - n, Scalar(-1.0));
+		}
+	}
+	A = compressed_matrix<Scalar>(m * n, m * n, std::move(triplets));
+}
+
+} // namespace sw::universal::blas
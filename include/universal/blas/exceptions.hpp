@@ -41,4 +41,20 @@ struct matmul_incompatible_matrices
 	};
 };
 
+// a factorization without pivoting encountered a zero on the diagonal
+struct zero_pivot
+	: public blas_exception
+{
+	zero_pivot(const std::string& error = "zero pivot in factorization")
+		: blas_exception(error) {};
+};
+
+// the shapes of the tensor operands do not match the operation
+struct incompatible_tensors
+	: public blas_exception
+{
+	incompatible_tensors(const std::string& error = "tensor shapes are incompatible")
+		: blas_exception(error) {};
+};
+
 }}} // namespace sw::universal::blas
@@ -0,0 +1,139 @@
+#pragma once
+// packed_tensor.hpp: bit-packed storage of tensors of number systems narrower than a byte
+//
+// A packed_tensor<Scalar, Rank> stores the nbits-wide encodings of its elements back to back:
+// element i occupies bits [i*nbits, (i+1)*nbits) of the byte array, least significant bit first,
+// so that a tensor of posit<4,0> takes half, and a tensor of fixpnt<3,1> three eighths, of the
+// memory of a tensor of bytes. Elements are decoded on access, and the kernels of tensor_kernels.hpp
+// decode the tiles of packed weights they work on into aligned scratch buffers.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <universal/blas/tensor.hpp>
+
+namespace sw::universal::blas {
+
+/*
+packing_traits<Scalar> defines the width and the encoding of the packed elements:
+
+	nbits                 number of bits of an encoding, at most 8
+	encode(v)             the encoding of v in the lower nbits of the result
+	decode(bits)          the value of an encoding
+
+The primary template serves the number systems of the library that expose their width as Scalar::nbits,
+accept an encoding through setbits(), and expose it through encoding() (posit), block(0) (cfloat), or
+getbb() (fixpnt). Other types specialize packing_traits.
+*/
+template<typename Scalar>
+struct packing_traits {
+	static constexpr size_t nbits = Scalar::nbits;
+	static_assert(nbits <= 8, "packed storage holds encodings of at most 8 bits");
+
+	static uint8_t encode(const Scalar& v) {
+		constexpr unsigned mask = (1u << nbits) - 1u;
+		if constexpr (has_encoding<Scalar>::value) return uint8_t(unsigned(v.encoding()) & mask);
+		else if constexpr (has_block<Scalar>::value) return uint8_t(unsigned(v.block(0)) & mask);
+		else return uint8_t(unsigned(v.getbb().block(0)) & mask);
+	}
+	static Scalar decode(uint8_t bits) {
+		Scalar v;
+		v.setbits(uint64_t(bits));
+		return v;
+	}
+
+private:
+	template<typename T, typename = void> struct has_encoding : std::false_type {};
+	template<typename T> struct has_encoding<T, std::void_t<decltype(std::declval<const T&>().encoding())>> : std::true_type {};
+	template<typename T, typename = void> struct has_block : std::false_type {};
+	template<typename T> struct has_block<T, std::void_t<decltype(std::declval<const T&>().block(size_t(0)))>> : std::true_type {};
+};
+
+template<typename Scalar, size_t Rank>
+class packed_tensor {
+public:
+	static constexpr size_t rank = Rank;
+	static constexpr size_t nbits = packing_traits<Scalar>::nbits;
+	using value_type = Scalar;
+	using shape_type = tensor_shape<Rank>;
+
+	// the elements of a new packed tensor have the all-zeros encoding, which is zero in the number systems of the library
+	packed_tensor() : _extents{}, _size{ 0 }, _bytes(1, 0) {}
+	explicit packed_tensor(const shape_type& extents) : _extents(extents), _size{ count(extents) }, _bytes(nrBytes(_size), 0) {}
+	// pack the elements of a view, converted to Scalar through double when the types differ
+	template<typename Source>
+	explicit packed_tensor(const tensor_view<Source, Rank>& source) : _extents(source.extents()), _size{ source.size() }, _bytes(nrBytes(_size), 0) {
+		size_t i = 0;
+		source.for_each_index([&](const shape_type& index) {
+			if constexpr (std::is_same_v<std::remove_const_t<Source>, Scalar>) set(i++, source[index]);
+			else set(i++, Scalar(double(source[index])));
+		});
+	}
+	template<typename Source>
+	explicit packed_tensor(const tensor<Source, Rank>& source) : packed_tensor(source.view()) {}
+
+	// element access by row-major linear index
+	Scalar get(size_t i) const {
+		size_t bit = i * nbits;
+		unsigned window = unsigned(_bytes[bit >> 3]) | (unsigned(_bytes[(bit >> 3) + 1]) << 8);
+		return packing_traits<Scalar>::decode(uint8_t((window >> (bit & 7)) & mask));
+	}
+	// writes modify the bytes shared with neighboring elements: concurrent writes need disjoint byte ranges
+	void set(size_t i, const Scalar& v) {
+		size_t bit = i * nbits;
+		unsigned shift = unsigned(bit & 7);
+		unsigned window = unsigned(_bytes[bit >> 3]) | (unsigned(_bytes[(bit >> 3) + 1]) << 8);
+		window = (window & ~(mask << shift)) | (unsigned(packing_traits<Scalar>::encode(v)) << shift);
+		_bytes[bit >> 3] = uint8_t(window);
+		_bytes[(bit >> 3) + 1] = uint8_t(window >> 8);
+	}
+	template<typename... Indices>
+	Scalar operator()(Indices... indices) const {
+		static_assert(sizeof...(Indices) == Rank, "the number of indices must equal the rank of the tensor");
+		size_t index[] = { static_cast<size_t>(indices)... };
+		size_t i = 0;
+		for (size_t d = 0; d < Rank; ++d) i = i * _extents[d] + index[d];
+		return get(i);
+	}
+
+	// decode count elements starting at linear index first into out
+	void unpack(size_t first, size_t count, Scalar* out) const {
+		for (size_t k = 0; k < count; ++k) out[k] = get(first + k);
+	}
+	// decode all elements into a tensor
+	tensor<Scalar, Rank> unpack() const {
+		tensor<Scalar, Rank> t(_extents);
+		unpack(0, _size, t.data());
+		return t;
+	}
+
+	// selectors
+	size_t extent(size_t d) const { return _extents[d]; }
+	const shape_type& extents() const { return _extents; }
+	size_t size() const { return _size; }
+	// storage in bytes, including the padding byte that lets every access read two bytes
+	size_t bytes() const { return _bytes.size(); }
+	const uint8_t* data() const { return _bytes.data(); }
+
+	// modifiers
+	void fill(const Scalar& v) { for (size_t i = 0; i < _size; ++i) set(i, v); }
+
+private:
+	static constexpr unsigned mask = (1u << nbits) - 1u;
+	shape_type _extents;
+	size_t _size;
+	std::vector<uint8_t, aligned_allocator<uint8_t>> _bytes;
+
+	static size_t count(const shape_type& extents) {
+		size_t n = 1;
+		for (auto e : extents) n *= e;
+		return n;
+	}
+	static size_t nrBytes(size_t n) { return (n * nbits + 7) / 8 + 1; }
+};
+
+} // namespace sw::universal::blas
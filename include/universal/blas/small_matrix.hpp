@@ -0,0 +1,281 @@
+#pragma once
+// small_matrix.hpp: fixed-size, stack-allocated dense matrix and its direct solvers
+//
+// The dynamic blas::matrix allocates a std::vector per instance, which dominates
+// the cost of solving many tiny systems. small_matrix carries its M x N elements
+// inline so that it can live on the stack or inside a container without any
+// heap traffic.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <array>
+#include <initializer_list>
+#include <utility>  // std::swap
+
+namespace sw::universal::blas {
+
+// fixed-size vector companion of small_matrix
+template<typename Scalar, size_t N>
+using small_vector = std::array<Scalar, N>;
+
+template<typename Scalar, size_t M, size_t N>
+class small_matrix {
+public:
+	static constexpr size_t nrows = M;
+	static constexpr size_t ncols = N;
+	typedef Scalar                 value_type;
+	typedef const value_type&      const_reference;
+	typedef value_type&            reference;
+	typedef const value_type*      const_pointer_type;
+	typedef size_t                 size_type;
+
+	small_matrix() : data{} {}
+	small_matrix(std::initializer_list< std::initializer_list<Scalar> > values) : data{} {
+		size_t r = 0;
+		for (auto l : values) {
+			if (r == M) break;
+			size_t c = 0;
+			for (auto v : l) {
+				if (c == N) break;
+				data[r * N + c] = v;
+				++c;
+			}
+			++r;
+		}
+	}
+	small_matrix(const small_matrix&) = default;
+	small_matrix(small_matrix&&) = default;
+
+	small_matrix& operator=(const small_matrix&) = default;
+	small_matrix& operator=(small_matrix&&) = default;
+
+	// Identity matrix operator
+	small_matrix& operator=(const Scalar& one) {
+		setzero();
+		constexpr size_t smallestDimension = (M < N ? M : N);
+		for (size_t i = 0; i < smallestDimension; ++i) data[i * N + i] = one;
+		return *this;
+	}
+
+	Scalar  operator()(size_t i, size_t j) const { return data[i * N + j]; }
+	Scalar& operator()(size_t i, size_t j) { return data[i * N + j]; }
+	// row access: A[i][j]
+	const Scalar* operator[](size_t i) const { return &data[i * N]; }
+	Scalar* operator[](size_t i) { return &data[i * N]; }
+
+	// matrix element-wise sum
+	small_matrix& operator+=(const small_matrix& rhs) {
+		for (size_t e = 0; e < M * N; ++e) data[e] += rhs.data[e];
+		return *this;
+	}
+	// matrix element-wise difference
+	small_matrix& operator-=(const small_matrix& rhs) {
+		for (size_t e = 0; e < M * N; ++e) data[e] -= rhs.data[e];
+		return *this;
+	}
+	// multiply all matrix elements
+	small_matrix& operator*=(const Scalar& a) {
+		for (auto& e : data) e *= a;
+		return *this;
+	}
+	// divide all matrix elements
+	small_matrix& operator/=(const Scalar& a) {
+		for (auto& e : data) e /= a;
+		return *this;
+	}
+
+	// modifiers
+	inline void setzero() { for (auto& e : data) e = Scalar(0); }
+	// selectors
+	static constexpr size_t rows() { return M; }
+	static constexpr size_t cols() { return N; }
+	static constexpr std::pair<size_t, size_t> size() { return std::make_pair(M, N); }
+
+	// raw access to the row-major element storage
+	Scalar* begin() { return data.data(); }
+	Scalar* end() { return data.data() + M * N; }
+	const Scalar* begin() const { return data.data(); }
+	const Scalar* end() const { return data.data() + M * N; }
+
+private:
+	std::array<Scalar, M * N> data;
+};
+
+template<typename Scalar, size_t M, size_t N>
+constexpr size_t num_rows(const small_matrix<Scalar, M, N>&) { return M; }
+template<typename Scalar, size_t M, size_t N>
+constexpr size_t num_cols(const small_matrix<Scalar, M, N>&) { return N; }
+
+template<typename Scalar, size_t M, size_t N>
+std::ostream& operator<<(std::ostream& ostr, const small_matrix<Scalar, M, N>& A) {
+	auto width = ostr.width();
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			ostr << std::setw(width) << A(i, j) << " ";
+		}
+		ostr << '\n';
+	}
+	return ostr;
+}
+
+template<typename Scalar, size_t N>
+std::ostream& operator<<(std::ostream& ostr, const small_vector<Scalar, N>& v) {
+	auto width = ostr.width();
+	for (size_t i = 0; i < N; ++i) ostr << std::setw(width) << v[i] << " ";
+	return ostr;
+}
+
+// matrix element-wise sum
+template<typename Scalar, size_t M, size_t N>
+small_matrix<Scalar, M, N> operator+(const small_matrix<Scalar, M, N>& A, const small_matrix<Scalar, M, N>& B) {
+	small_matrix<Scalar, M, N> Sum(A);
+	return Sum += B;
+}
+
+// matrix element-wise difference
+template<typename Scalar, size_t M, size_t N>
+small_matrix<Scalar, M, N> operator-(const small_matrix<Scalar, M, N>& A, const small_matrix<Scalar, M, N>& B) {
+	small_matrix<Scalar, M, N> Diff(A);
+	return Diff -= B;
+}
+
+// matrix-vector multiply
+template<typename Scalar, size_t M, size_t N>
+small_vector<Scalar, M> operator*(const small_matrix<Scalar, M, N>& A, const small_vector<Scalar, N>& x) {
+	small_vector<Scalar, M> b;
+	for (size_t i = 0; i < M; ++i) {
+		Scalar e = Scalar(0);
+		for (size_t j = 0; j < N; ++j) e += A(i, j) * x[j];
+		b[i] = e;
+	}
+	return b;
+}
+
+// matrix-matrix multiply: the dimensions are checked at compile time
+template<typename Scalar, size_t M, size_t K, size_t N>
+small_matrix<Scalar, M, N> operator*(const small_matrix<Scalar, M, K>& A, const small_matrix<Scalar, K, N>& B) {
+	small_matrix<Scalar, M, N> C;
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			Scalar e = Scalar(0);
+			for (size_t k = 0; k < K; ++k) e += A(i, k) * B(k, j);
+			C(i, j) = e;
+		}
+	}
+	return C;
+}
+
+// matrix equivalence tests
+template<typename Scalar, size_t M, size_t N>
+bool operator==(const small_matrix<Scalar, M, N>& A, const small_matrix<Scalar, M, N>& B) {
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			if (A(i, j) != B(i, j)) return false;
+		}
+	}
+	return true;
+}
+template<typename Scalar, size_t M, size_t N>
+bool operator!=(const small_matrix<Scalar, M, N>& A, const small_matrix<Scalar, M, N>& B) {
+	return !(A == B);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// direct solvers for small systems
+
+// in-place LU decomposition with partial pivoting, PA = LU with unit lower triangular L.
+// The pivot array records the row interchanges in LAPACK getrf order: row j was swapped with row piv[j].
+// Returns 0 on success, or k+1 if U(k,k) is exactly zero, in which case the factorization
+// is complete but U is singular and cannot be used to solve a system.
+template<typename Scalar, size_t N>
+int ludcmp(small_matrix<Scalar, N, N>& A, small_vector<size_t, N>& piv) {
+	int info = 0;
+	for (size_t j = 0; j < N; ++j) {
+		// search for the pivot in column j
+		size_t p = j;
+		Scalar pivot = (A(j, j) < Scalar(0) ? -A(j, j) : A(j, j));
+		for (size_t i = j + 1; i < N; ++i) {
+			Scalar e = (A(i, j) < Scalar(0) ? -A(i, j) : A(i, j));
+			if (e > pivot) {
+				pivot = e;
+				p = i;
+			}
+		}
+		piv[j] = p;
+		if (p != j) {
+			for (size_t k = 0; k < N; ++k) std::swap(A(p, k), A(j, k));
+		}
+		if (A(j, j) == Scalar(0)) {
+			if (info == 0) info = static_cast<int>(j + 1);
+			continue;
+		}
+		Scalar rcp = Scalar(1) / A(j, j);
+		for (size_t i = j + 1; i < N; ++i) A(i, j) *= rcp;
+		// rank-1 update of the trailing submatrix
+		for (size_t i = j + 1; i < N; ++i) {
+			Scalar l = A(i, j);
+			for (size_t k = j + 1; k < N; ++k) A(i, k) -= l * A(j, k);
+		}
+	}
+	return info;
+}
+
+// solve LU x = Pb in-place: b is overwritten with the solution x
+template<typename Scalar, size_t N>
+void lubksb(const small_matrix<Scalar, N, N>& LU, const small_vector<size_t, N>& piv, small_vector<Scalar, N>& b) {
+	// apply the row interchanges
+	for (size_t i = 0; i < N; ++i) {
+		if (piv[i] != i) std::swap(b[i], b[piv[i]]);
+	}
+	// forward substitution with the unit lower triangle
+	for (size_t i = 1; i < N; ++i) {
+		Scalar sum = b[i];
+		for (size_t j = 0; j < i; ++j) sum -= LU(i, j) * b[j];
+		b[i] = sum;
+	}
+	// backsubstitution with the upper triangle
+	for (size_t i = N; i >= 1; --i) {
+		Scalar sum = b[i - 1];
+		for (size_t j = i; j < N; ++j) sum -= LU(i - 1, j) * b[j];
+		b[i - 1] = sum / LU(i - 1, i - 1);
+	}
+}
+
+// solve the system of equations A x = b using partial pivoting LU
+// Returns the ludcmp() status: 0 on success, or k+1 when A is singular, in which case x is set to zero.
+template<typename Scalar, size_t N>
+int solve(const small_matrix<Scalar, N, N>& A, const small_vector<Scalar, N>& b, small_vector<Scalar, N>& x) {
+	small_matrix<Scalar, N, N> LU(A);
+	small_vector<size_t, N> piv;
+	int info = ludcmp(LU, piv);
+	if (info != 0) {
+		x.fill(Scalar(0));
+		return info;
+	}
+	x = b;
+	lubksb(LU, piv, x);
+	return info;
+}
+
+// matrix inverse through LU decomposition and N backsubstitutions
+// Returns the ludcmp() status: 0 on success, or k+1 when A is singular, in which case Ainv is set to zero.
+template<typename Scalar, size_t N>
+int inv(const small_matrix<Scalar, N, N>& A, small_matrix<Scalar, N, N>& Ainv) {
+	small_matrix<Scalar, N, N> LU(A);
+	small_vector<size_t, N> piv;
+	Ainv = small_matrix<Scalar, N, N>{};
+	int info = ludcmp(LU, piv);
+	if (info != 0) return info;
+	for (size_t j = 0; j < N; ++j) {
+		small_vector<Scalar, N> e{};
+		e[j] = Scalar(1);
+		lubksb(LU, piv, e);
+		for (size_t i = 0; i < N; ++i) Ainv(i, j) = e[i];
+	}
+	return info;
+}
+
+}  // namespace sw::universal::blas
@@ -19,3 +19,7 @@
 #include <universal/blas/solvers/cg_dot_fdp.hpp>
 #include <universal/blas/solvers/cg_fdp_dot.hpp>
 #include <universal/blas/solvers/cg_fdp_fdp.hpp>
+
+#include <universal/blas/solvers/pcg.hpp>
+#include <universal/blas/solvers/bicgstab.hpp>
+#include <universal/blas/solvers/gmres.hpp>
@@ -0,0 +1,113 @@
+#pragma once
+// bicgstab.hpp: right-preconditioned BiCGSTAB method with independent precisions per stage
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/blas/solvers/krylov.hpp>
+#include <universal/blas/solvers/preconditioners.hpp>
+
+namespace sw::universal::blas {
+
+// bicgstab: solve A x = b for general nonsingular A, with the right preconditioner M
+// the Precision policy selects the arithmetic of the matvec, dot, and update stages, see krylov.hpp
+// x holds the initial guess on entry and the solution on exit
+template<typename Precision = void, typename Operator, typename Preconditioner, typename Vector>
+krylov_report bicgstab(const Operator& A, const Preconditioner& M, const Vector& b, Vector& x, const krylov_options& options = krylov_options{}) {
+	using P = krylov_detail::resolve_precision<Precision, Vector>;
+	using Update = typename P::update_scalar;
+	using Dot = typename P::dot_scalar;
+	using DotAcc = typename P::dot_accumulator;
+	using Scalar = typename Vector::value_type;
+	using namespace krylov_detail;
+
+	krylov_report report;
+	reserve(report, options.maxIterations);
+	size_t n = b.size();
+	vector<Update> bb(n), xx(n), r(n), rhat(n), p(n), phat(n), v(n), s(n), shat(n), t(n);
+	for (size_t i = 0; i < n; ++i) {
+		bb[i] = convert_element<Update>(b[i]);
+		xx[i] = convert_element<Update>(x[i]);
+		p[i] = Update(0.0);
+		v[i] = Update(0.0);
+	}
+
+	double bnorm = norm<P>(bb, report);
+	if (bnorm == 0.0) bnorm = 1.0;
+	residual<P>(A, bb, xx, r, report);
+	rhat = r;
+	Dot rho(1.0), alpha(1.0), omega(1.0);
+	auto start = std::chrono::steady_clock::now();
+	while (report.iterations < options.maxIterations) {
+		Dot rhoNext;
+		{
+			stage_timer timer(report.dotTime);
+			rhoNext = mixed_dot<DotAcc>(rhat, r);
+		}
+		if (rhoNext == Dot(0.0) || omega == Dot(0.0)) { report.breakdown = true; break; }
+		Dot beta = (rhoNext / rho) * (alpha / omega);
+		rho = rhoNext;
+		{
+			stage_timer timer(report.updateTime);
+			update(p, Dot(-omega), v);   // p = r + beta * (p - omega * v)
+			scale_add(p, r, beta);
+		}
+		{
+			stage_timer timer(report.preconditionerTime);
+			M.apply(p, phat);
+		}
+		{
+			stage_timer timer(report.matvecTime);
+			mixed_matvec<typename P::matvec_accumulator>(A, phat, v);
+		}
+		Dot rv;
+		{
+			stage_timer timer(report.dotTime);
+			rv = mixed_dot<DotAcc>(rhat, v);
+		}
+		if (rv == Dot(0.0)) { report.breakdown = true; break; }
+		alpha = rho / rv;
+		{
+			stage_timer timer(report.updateTime);
+			s = r;
+			update(s, Dot(-alpha), v);   // s = r - alpha * v
+		}
+		double snorm = norm<P>(s, report) / bnorm;
+		if (snorm <= options.tolerance) {
+			{
+				stage_timer timer(report.updateTime);
+				update(xx, alpha, phat);
+			}
+			record(report, snorm, start, options.tolerance);
+			break;
+		}
+		{
+			stage_timer timer(report.preconditionerTime);
+			M.apply(s, shat);
+		}
+		{
+			stage_timer timer(report.matvecTime);
+			mixed_matvec<typename P::matvec_accumulator>(A, shat, t);
+		}
+		Dot ts, tt;
+		{
+			stage_timer timer(report.dotTime);
+			ts = mixed_dot<DotAcc>(t, s);
+			tt = mixed_dot<DotAcc>(t, t);
+		}
+		if (tt == Dot(0.0)) { report.breakdown = true; break; }
+		omega = ts / tt;
+		{
+			stage_timer timer(report.updateTime);
+			update(xx, alpha, phat);     // x = x + alpha * phat + omega * shat
+			update(xx, omega, shat);
+			r = s;
+			update(r, Dot(-omega), t);   // r = s - omega * t
+		}
+		if (record(report, norm<P>(r, report) / bnorm, start, options.tolerance)) break;
+	}
+	for (size_t i = 0; i < n; ++i) x[i] = convert_element<Scalar>(xx[i]);
+	return report;
+}
+
+} // namespace sw::universal::blas
@@ -45,15 +45,13 @@ size_t cg(const Matrix& M, const Matrix& A, const Vector& b, Vector& x, Vector&
 		}
 		else {
 			beta = sigma_1 / sigma_2;
-			p = zeta + beta * p;
+			xpby(zeta, beta, p);  // p = zeta + beta * p
 		}
 		q = A * p;
 		alpha = sigma_1 / (p * q); // adaptive dot product
-		Vector x_1(x);
-		x = x + alpha * p;
-		rho = rho - alpha * q;
-		// check for convergence of the system
-		residual = norm(x_1 - x, 1);
+		// update the solution and check for convergence of the system: residual = normL1(x_old - x)
+		residual = axpy_normL1(alpha, p, x);
+		axpy(Scalar(-alpha), q, rho);  // rho = rho - alpha * q
 		residuals.push_back(residual);
 		++itr;
 	}
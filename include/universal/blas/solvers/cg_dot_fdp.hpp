@@ -45,15 +45,13 @@ size_t cg_dot_fdp(const Matrix& M, const Matrix& A, const Vector& b, Vector& x,
 		}
 		else {
 			beta = sigma_1 / sigma_2;
-			p = zeta + beta * p;
+			xpby(zeta, beta, p);  // p = zeta + beta * p
 		}
 		matvec(q, A, p);  // regular matrix-vector without quire
 		alpha = sigma_1 / sw::universal::fdp(p, q);
-		Vector x_1(x);
-		x = x + alpha * p;
-		rho = rho - alpha * q;
-		// check for convergence of the system
-		residual = norm1(x_1 - x);
+		// update the solution and check for convergence of the system: residual = normL1(x_old - x)
+		residual = axpy_normL1(alpha, p, x);
+		axpy(Scalar(-alpha), q, rho);  // rho = rho - alpha * q
 		//		std::cout << '[' << itr << "] " << std::setw(12) << x << " residual " << residual << std::endl;
 		residuals.push_back(residual);
 		++itr;
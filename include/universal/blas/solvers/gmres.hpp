@@ -0,0 +1,124 @@
+#pragma once
+// gmres.hpp: restarted, right-preconditioned GMRES method with independent precisions per stage
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <vector>
+#include <universal/blas/solvers/krylov.hpp>
+#include <universal/blas/solvers/preconditioners.hpp>
+
+namespace sw::universal::blas {
+
+// gmres: solve A x = b for general nonsingular A, with the right preconditioner M, restarted every options.restart iterations
+// the Arnoldi process uses modified Gram-Schmidt, and the Hessenberg matrix and its Givens rotations are kept in
+// the dot_scalar of the Precision policy, see krylov.hpp
+// the residual recorded per iteration is the estimate of the least-squares problem, which is exact in exact arithmetic
+// x holds the initial guess on entry and the solution on exit
+template<typename Precision = void, typename Operator, typename Preconditioner, typename Vector>
+krylov_report gmres(const Operator& A, const Preconditioner& M, const Vector& b, Vector& x, const krylov_options& options = krylov_options{}) {
+	using P = krylov_detail::resolve_precision<Precision, Vector>;
+	using Update = typename P::update_scalar;
+	using Dot = typename P::dot_scalar;
+	using DotAcc = typename P::dot_accumulator;
+	using Scalar = typename Vector::value_type;
+	using namespace krylov_detail;
+	using std::sqrt;
+
+	krylov_report report;
+	reserve(report, options.maxIterations);
+	size_t n = b.size();
+	size_t m = options.restart > 0 ? options.restart : 1;
+	vector<Update> bb(n), xx(n), r(n), w(n);
+	std::vector< vector<Update> > V(m + 1, vector<Update>(n)), Z(m, vector<Update>(n));
+	std::vector<Dot> H((m + 1) * m), cs(m), sn(m), g(m + 1), y(m);
+	for (size_t i = 0; i < n; ++i) {
+		bb[i] = convert_element<Update>(b[i]);
+		xx[i] = convert_element<Update>(x[i]);
+	}
+
+	double bnorm = norm<P>(bb, report);
+	if (bnorm == 0.0) bnorm = 1.0;
+	auto start = std::chrono::steady_clock::now();
+	while (report.iterations < options.maxIterations && !report.converged) {
+		residual<P>(A, bb, xx, r, report);
+		double beta = norm<P>(r, report);
+		if (beta / bnorm <= options.tolerance) {
+			report.converged = true;
+			report.residual = beta / bnorm;
+			break;
+		}
+		{
+			stage_timer timer(report.updateTime);
+			Update scale = Update(1.0 / beta);
+			for (size_t i = 0; i < n; ++i) V[0][i] = r[i] * scale;
+		}
+		for (auto& e : g) e = Dot(0.0);
+		g[0] = Dot(beta);
+
+		size_t k = 0;  // dimension of the Krylov subspace of this cycle
+		while (k < m && report.iterations < options.maxIterations) {
+			size_t j = k;
+			{
+				stage_timer timer(report.preconditionerTime);
+				M.apply(V[j], Z[j]);
+			}
+			{
+				stage_timer timer(report.matvecTime);
+				mixed_matvec<typename P::matvec_accumulator>(A, Z[j], w);
+			}
+			for (size_t i = 0; i <= j; ++i) {
+				Dot h;
+				{
+					stage_timer timer(report.dotTime);
+					h = mixed_dot<DotAcc>(w, V[i]);
+				}
+				H[i * m + j] = h;
+				stage_timer timer(report.updateTime);
+				update(w, Dot(-h), V[i]);
+			}
+			Dot hnext = Dot(norm<P>(w, report));
+			H[(j + 1) * m + j] = hnext;
+			if (hnext != Dot(0.0)) {
+				stage_timer timer(report.updateTime);
+				Update scale = convert_element<Update>(Dot(Dot(1.0) / hnext));
+				for (size_t i = 0; i < n; ++i) V[j + 1][i] = w[i] * scale;
+			}
+			// apply the previous rotations to the new column, and annihilate its subdiagonal
+			for (size_t i = 0; i < j; ++i) {
+				Dot a = H[i * m + j], c = H[(i + 1) * m + j];
+				H[i * m + j] = cs[i] * a + sn[i] * c;
+				H[(i + 1) * m + j] = cs[i] * c - sn[i] * a;
+			}
+			Dot a = H[j * m + j], c = H[(j + 1) * m + j];
+			Dot rad = sqrt(a * a + c * c);
+			if (rad == Dot(0.0)) { report.breakdown = true; break; }
+			cs[j] = a / rad;
+			sn[j] = c / rad;
+			H[j * m + j] = rad;
+			H[(j + 1) * m + j] = Dot(0.0);
+			g[j + 1] = -sn[j] * g[j];
+			g[j] = cs[j] * g[j];
+			++k;
+			bool done = record(report, std::fabs(double(g[j + 1])) / bnorm, start, options.tolerance);
+			if (done || hnext == Dot(0.0)) break;
+		}
+		if (k == 0) break;
+		// solve the upper triangular system H y = g, and update x = x + Z y
+		for (size_t i = k; i-- > 0; ) {
+			Dot sum = g[i];
+			for (size_t l = i + 1; l < k; ++l) sum -= H[i * m + l] * y[l];
+			y[i] = sum / H[i * m + i];
+		}
+		{
+			stage_timer timer(report.updateTime);
+			for (size_t i = 0; i < k; ++i) update(xx, y[i], Z[i]);
+		}
+		if (report.breakdown) break;
+	}
+	for (size_t i = 0; i < n; ++i) x[i] = convert_element<Scalar>(xx[i]);
+	return report;
+}
+
+} // namespace sw::universal::blas
@@ -0,0 +1,193 @@
+#pragma once
+// krylov.hpp: precision policies, kernels, and reports shared by the Krylov subspace solvers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <chrono>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include <universal/blas/vector.hpp>
+#include <universal/blas/matrix.hpp>
+#include <universal/blas/compressed_matrix.hpp>
+#include <universal/dsp/accumulation.hpp>
+
+namespace sw::universal::blas {
+
+/*
+The Krylov solvers pcg(), bicgstab(), and gmres() are parameterized in a krylov_precision policy that
+selects the arithmetic of each stage of an iteration independently:
+
+	Matvec    the accumulator of the products A(i,j) * x(j) of a matrix-vector product
+	Dot       the accumulator of the inner products, and the type of the recurrence scalars
+	          alpha, beta, omega and of the Hessenberg matrix of GMRES
+	Update    the element type of the iteration vectors x, r, p, ..., which the vector updates use
+
+An accumulator is either a number system, which accumulates with multiply_add(), or a quire, which
+accumulates the products exactly and rounds once: krylov_precision< posit<32,2>, quire<32,2> > is CG
+with fused dot products and rounded matrix-vector products, the cg_dot_fdp() configuration.
+The stages exchange values by rounding through double when their types differ.
+
+The solvers allocate their work vectors before the first iteration, and record the relative residual
+and the duration of every iteration, and the cumulative time of each stage, in a krylov_report.
+*/
+
+// the number system of the operands of an accumulator
+template<typename Accumulator>
+struct accumulator_traits {
+	using operand_type = Accumulator;
+};
+template<size_t nbits, size_t es, size_t capacity>
+struct accumulator_traits< quire<nbits, es, capacity> > {
+	using operand_type = posit<nbits, es>;
+};
+
+template<typename MatvecAccumulator, typename DotAccumulator = MatvecAccumulator, typename UpdateScalar = typename accumulator_traits<MatvecAccumulator>::operand_type>
+struct krylov_precision {
+	using matvec_accumulator = MatvecAccumulator;
+	using matvec_scalar      = typename accumulator_traits<MatvecAccumulator>::operand_type;
+	using dot_accumulator    = DotAccumulator;
+	using dot_scalar         = typename accumulator_traits<DotAccumulator>::operand_type;
+	using update_scalar      = UpdateScalar;
+};
+
+struct krylov_options {
+	size_t maxIterations = 1000;
+	double tolerance = 1.0e-8;    // on the relative residual ||b - A x|| / ||b||
+	size_t restart = 30;          // Krylov subspace dimension of GMRES
+};
+
+struct krylov_report {
+	size_t iterations = 0;
+	bool   converged = false;
+	bool   breakdown = false;     // a recurrence divided by zero
+	double residual = 0.0;        // final relative residual
+	std::vector<double> residuals;      // relative residual after every iteration
+	std::vector<double> iterationTimes; // seconds per iteration
+	double matvecTime = 0.0;            // cumulative seconds per stage
+	double preconditionerTime = 0.0;
+	double dotTime = 0.0;
+	double updateTime = 0.0;
+};
+
+namespace krylov_detail {
+
+	template<typename Target, typename Source>
+	inline Target convert_element(const Source& v) {
+		if constexpr (std::is_same_v<Target, Source>) return v; else return Target(double(v));
+	}
+
+	// accumulates the elapsed time of a stage
+	class stage_timer {
+	public:
+		explicit stage_timer(double& bucket) : _bucket{ bucket }, _start{ std::chrono::steady_clock::now() } {}
+		~stage_timer() { _bucket += std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count(); }
+	private:
+		double& _bucket;
+		std::chrono::steady_clock::time_point _start;
+	};
+
+	// record the state at the end of an iteration, returns true when the tolerance is met
+	inline bool record(krylov_report& report, double relativeResidual, std::chrono::steady_clock::time_point& start, double tolerance) {
+		auto now = std::chrono::steady_clock::now();
+		report.iterationTimes.push_back(std::chrono::duration<double>(now - start).count());
+		start = now;
+		report.residuals.push_back(relativeResidual);
+		report.residual = relativeResidual;
+		++report.iterations;
+		report.converged = (relativeResidual <= tolerance);
+		return report.converged;
+	}
+
+	inline void reserve(krylov_report& report, size_t maxIterations) {
+		report.residuals.reserve(maxIterations);
+		report.iterationTimes.reserve(maxIterations);
+	}
+}
+
+// y = A x with the products accumulated in Accumulator and rounded once to the elements of y
+template<typename Accumulator, typename MatrixScalar, typename Scalar>
+void mixed_matvec(const compressed_matrix<MatrixScalar>& A, const vector<Scalar>& x, vector<Scalar>& y) {
+	using Operand = typename accumulator_traits<Accumulator>::operand_type;
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	const auto& rowPtr = A.row_pointers();
+	const auto& colIdx = A.column_indices();
+	const auto& values = A.nonzero_values();
+	Accumulator acc;
+	for (size_t i = 0; i < A.rows(); ++i) {
+		policy::clear(acc);
+		for (size_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k) {
+			policy::mac(acc, krylov_detail::convert_element<Operand>(values[k]), krylov_detail::convert_element<Operand>(x[colIdx[k]]));
+		}
+		Operand sum;
+		policy::round(acc, sum);
+		y[i] = krylov_detail::convert_element<Scalar>(sum);
+	}
+}
+template<typename Accumulator, typename MatrixScalar, typename Scalar>
+void mixed_matvec(const matrix<MatrixScalar>& A, const vector<Scalar>& x, vector<Scalar>& y) {
+	using Operand = typename accumulator_traits<Accumulator>::operand_type;
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	Accumulator acc;
+	for (size_t i = 0; i < A.rows(); ++i) {
+		policy::clear(acc);
+		for (size_t j = 0; j < A.cols(); ++j) {
+			policy::mac(acc, krylov_detail::convert_element<Operand>(A(i, j)), krylov_detail::convert_element<Operand>(x[j]));
+		}
+		Operand sum;
+		policy::round(acc, sum);
+		y[i] = krylov_detail::convert_element<Scalar>(sum);
+	}
+}
+
+// x . y accumulated in Accumulator, rounded once to its operand type
+template<typename Accumulator, typename Scalar>
+typename accumulator_traits<Accumulator>::operand_type mixed_dot(const vector<Scalar>& x, const vector<Scalar>& y) {
+	using Operand = typename accumulator_traits<Accumulator>::operand_type;
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	Accumulator acc;
+	policy::clear(acc);
+	for (size_t i = 0; i < x.size(); ++i) {
+		policy::mac(acc, krylov_detail::convert_element<Operand>(x[i]), krylov_detail::convert_element<Operand>(y[i]));
+	}
+	Operand sum;
+	policy::round(acc, sum);
+	return sum;
+}
+
+namespace krylov_detail {
+	// y = y + a * x in the arithmetic of the vectors
+	template<typename Scalar, typename Coefficient>
+	inline void update(vector<Scalar>& y, const Coefficient& a, const vector<Scalar>& x) {
+		Scalar alpha = convert_element<Scalar>(a);
+		for (size_t i = 0; i < y.size(); ++i) y[i] = multiply_add(alpha, x[i], y[i]);
+	}
+	// y = x + b * y
+	template<typename Scalar, typename Coefficient>
+	inline void scale_add(vector<Scalar>& y, const vector<Scalar>& x, const Coefficient& b) {
+		Scalar beta = convert_element<Scalar>(b);
+		for (size_t i = 0; i < y.size(); ++i) y[i] = multiply_add(beta, y[i], x[i]);
+	}
+	// r = b - A x
+	template<typename Precision, typename Operator, typename Scalar>
+	void residual(const Operator& A, const vector<Scalar>& b, const vector<Scalar>& x, vector<Scalar>& r, krylov_report& report) {
+		{
+			stage_timer timer(report.matvecTime);
+			mixed_matvec<typename Precision::matvec_accumulator>(A, x, r);
+		}
+		stage_timer timer(report.updateTime);
+		for (size_t i = 0; i < r.size(); ++i) r[i] = b[i] - r[i];
+	}
+	// ||x|| with the inner product of the Dot stage, in double
+	template<typename Precision, typename Scalar>
+	double norm(const vector<Scalar>& x, krylov_report& report) {
+		stage_timer timer(report.dotTime);
+		return std::sqrt(std::fabs(double(mixed_dot<typename Precision::dot_accumulator>(x, x))));
+	}
+	template<typename Precision, typename Vector>
+	using resolve_precision = std::conditional_t<std::is_void_v<Precision>,
+		krylov_precision<typename Vector::value_type>, Precision>;
+}
+
+} // namespace sw::universal::blas
@@ -0,0 +1,86 @@
+#pragma once
+// pcg.hpp: preconditioned Conjugate Gradient method with independent precisions per stage
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/blas/solvers/krylov.hpp>
+#include <universal/blas/solvers/preconditioners.hpp>
+
+namespace sw::universal::blas {
+
+// pcg: solve A x = b for symmetric positive definite A, with the preconditioner M
+// the Precision policy selects the arithmetic of the matvec, dot, and update stages, see krylov.hpp,
+// void selects the arithmetic of the Vector for all stages
+// x holds the initial guess on entry and the solution on exit
+template<typename Precision = void, typename Operator, typename Preconditioner, typename Vector>
+krylov_report pcg(const Operator& A, const Preconditioner& M, const Vector& b, Vector& x, const krylov_options& options = krylov_options{}) {
+	using P = krylov_detail::resolve_precision<Precision, Vector>;
+	using Update = typename P::update_scalar;
+	using Dot = typename P::dot_scalar;
+	using Scalar = typename Vector::value_type;
+	using namespace krylov_detail;
+
+	krylov_report report;
+	reserve(report, options.maxIterations);
+	size_t n = b.size();
+	vector<Update> bb(n), xx(n), r(n), z(n), p(n), q(n);
+	for (size_t i = 0; i < n; ++i) {
+		bb[i] = convert_element<Update>(b[i]);
+		xx[i] = convert_element<Update>(x[i]);
+	}
+
+	double bnorm = norm<P>(bb, report);
+	if (bnorm == 0.0) bnorm = 1.0;
+	residual<P>(A, bb, xx, r, report);
+	{
+		stage_timer timer(report.preconditionerTime);
+		M.apply(r, z);
+	}
+	p = z;
+	Dot rho;
+	{
+		stage_timer timer(report.dotTime);
+		rho = mixed_dot<typename P::dot_accumulator>(r, z);
+	}
+	auto start = std::chrono::steady_clock::now();
+	while (report.iterations < options.maxIterations) {
+		{
+			stage_timer timer(report.matvecTime);
+			mixed_matvec<typename P::matvec_accumulator>(A, p, q);
+		}
+		Dot pq;
+		{
+			stage_timer timer(report.dotTime);
+			pq = mixed_dot<typename P::dot_accumulator>(p, q);
+		}
+		if (pq == Dot(0.0)) { report.breakdown = true; break; }
+		Dot alpha = rho / pq;
+		{
+			stage_timer timer(report.updateTime);
+			update(xx, alpha, p);      // x = x + alpha * p
+			update(r, Dot(-alpha), q); // r = r - alpha * q
+		}
+		if (record(report, norm<P>(r, report) / bnorm, start, options.tolerance)) break;
+		{
+			stage_timer timer(report.preconditionerTime);
+			M.apply(r, z);
+		}
+		Dot rhoNext;
+		{
+			stage_timer timer(report.dotTime);
+			rhoNext = mixed_dot<typename P::dot_accumulator>(r, z);
+		}
+		if (rho == Dot(0.0)) { report.breakdown = true; break; }
+		Dot beta = rhoNext / rho;
+		rho = rhoNext;
+		{
+			stage_timer timer(report.updateTime);
+			scale_add(p, z, beta);     // p = z + beta * p
+		}
+	}
+	for (size_t i = 0; i < n; ++i) x[i] = convert_element<Scalar>(xx[i]);
+	return report;
+}
+
+} // namespace sw::universal::blas
@@ -0,0 +1,118 @@
+#pragma once
+// preconditioners.hpp: identity, Jacobi, and ILU(0) preconditioners for the Krylov solvers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
+#include <universal/blas/exceptions.hpp>
+#include <universal/blas/solvers/krylov.hpp>
+
+namespace sw::universal::blas {
+
+/*
+A preconditioner applies z = M^-1 r through apply(r, z), which does not allocate. The preconditioners
+store and apply their factors in their own Scalar type, independent of the precision of the solver.
+*/
+
+struct identity_preconditioner {
+	template<typename Vector>
+	void apply(const Vector& r, Vector& z) const { z = r; }
+};
+
+// M = diag(A)
+template<typename Scalar>
+class jacobi_preconditioner {
+public:
+	template<typename MatrixScalar>
+	explicit jacobi_preconditioner(const compressed_matrix<MatrixScalar>& A) : _rcp(A.rows()) {
+		for (size_t i = 0; i < A.rows(); ++i) set(i, A(i, i));
+	}
+	template<typename MatrixScalar>
+	explicit jacobi_preconditioner(const matrix<MatrixScalar>& A) : _rcp(A.rows()) {
+		for (size_t i = 0; i < A.rows(); ++i) set(i, A(i, i));
+	}
+
+	template<typename VectorScalar>
+	void apply(const vector<VectorScalar>& r, vector<VectorScalar>& z) const {
+		for (size_t i = 0; i < _rcp.size(); ++i) {
+			z[i] = krylov_detail::convert_element<VectorScalar>(Scalar(_rcp[i] * krylov_detail::convert_element<Scalar>(r[i])));
+		}
+	}
+
+private:
+	std::vector<Scalar> _rcp;
+
+	template<typename MatrixScalar>
+	void set(size_t i, const MatrixScalar& d) {
+		Scalar diagonal = krylov_detail::convert_element<Scalar>(d);
+		if (diagonal == Scalar(0)) throw zero_pivot("zero on the diagonal of the Jacobi preconditioner");
+		_rcp[i] = Scalar(1.0) / diagonal;
+	}
+};
+
+// M = L U, the incomplete LU factorization with the sparsity pattern of A
+template<typename Scalar>
+class ilu0_preconditioner {
+public:
+	template<typename MatrixScalar>
+	explicit ilu0_preconditioner(const matrix<MatrixScalar>& A) : ilu0_preconditioner(compressed_matrix<MatrixScalar>(A)) {}
+	template<typename MatrixScalar>
+	explicit ilu0_preconditioner(const compressed_matrix<MatrixScalar>& A) : _LU(A), _diagonal(A.rows()), _work(A.rows()) {
+		const auto& rowPtr = _LU.row_pointers();
+		const auto& colIdx = _LU.column_indices();
+		auto& values = _LU.nonzero_values();
+		size_t n = _LU.rows();
+		const size_t none = size_t(-1);
+		std::vector<size_t> position(n, none);
+		for (size_t i = 0; i < n; ++i) {
+			_diagonal[i] = none;
+			for (size_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k) {
+				position[colIdx[k]] = k;
+				if (colIdx[k] == i) _diagonal[i] = k;
+			}
+			if (_diagonal[i] == none) throw zero_pivot("ILU(0) requires the diagonal in the sparsity pattern");
+			// eliminate the entries left of the diagonal, restricted to the pattern of row i
+			for (size_t k = rowPtr[i]; k < _diagonal[i]; ++k) {
+				size_t col = colIdx[k];
+				values[k] /= values[_diagonal[col]];
+				for (size_t kk = _diagonal[col] + 1; kk < rowPtr[col + 1]; ++kk) {
+					size_t p = position[colIdx[kk]];
+					if (p != none) values[p] -= values[k] * values[kk];
+				}
+			}
+			if (values[_diagonal[i]] == Scalar(0)) throw zero_pivot("zero pivot in the ILU(0) factorization");
+			for (size_t k = rowPtr[i]; k < rowPtr[i + 1]; ++k) position[colIdx[k]] = none;
+		}
+	}
+
+	// z = U^-1 L^-1 r
+	template<typename VectorScalar>
+	void apply(const vector<VectorScalar>& r, vector<VectorScalar>& z) const {
+		const auto& rowPtr = _LU.row_pointers();
+		const auto& colIdx = _LU.column_indices();
+		const auto& values = _LU.nonzero_values();
+		size_t n = _LU.rows();
+		std::vector<Scalar>& y = _work;
+		for (size_t i = 0; i < n; ++i) {
+			Scalar sum = krylov_detail::convert_element<Scalar>(r[i]);
+			for (size_t k = rowPtr[i]; k < _diagonal[i]; ++k) sum -= values[k] * y[colIdx[k]];
+			y[i] = sum;
+		}
+		for (size_t i = n; i-- > 0; ) {
+			Scalar sum = y[i];
+			for (size_t k = _diagonal[i] + 1; k < rowPtr[i + 1]; ++k) sum -= values[k] * y[colIdx[k]];
+			y[i] = sum / values[_diagonal[i]];
+			z[i] = krylov_detail::convert_element<VectorScalar>(y[i]);
+		}
+	}
+
+	const compressed_matrix<Scalar>& factors() const { return _LU; }
+
+private:
+	compressed_matrix<Scalar> _LU;
+	std::vector<size_t> _diagonal;
+	mutable std::vector<Scalar> _work;   // the solution of the lower triangular system
+};
+
+} // namespace sw::universal::blas
@@ -0,0 +1,362 @@
+#pragma once
+// stencil.hpp: matrix-free star stencil operators and relaxation solvers on 2D and 3D structured grids
+//
+// A structured_grid stores the unknowns of an nx x ny (x nz) grid together with a layer of
+// boundary values, in row-major order with x as the unit-stride index. A star_stencil is the
+// operator (A u)(p) = center * u(p) + sum_d (lower_d * u(p - e_d) + upper_d * u(p + e_d)),
+// applied without assembling the matrix: the dense laplace2D() generator needs (nx*ny)^2 elements,
+// a grid only nx*ny, so that precision studies can run on 4096 x 4096 grids.
+//
+// The kernels walk the grid in tiles of BLAS_STENCIL_TILE_X x BLAS_STENCIL_TILE_Y x BLAS_STENCIL_TILE_Z
+// points that fit in cache, and distribute the tiles across threads:
+//   jacobi()        damped Jacobi sweeps; with temporalBlock > 1 every tile performs that many
+//                   sweeps out of cache on a copy that is extended by a ghost zone of the same depth
+//   sor()           red-black successive over-relaxation: the points of one colour only depend on
+//                   points of the other colour, so that each half sweep is parallel
+//   gauss_seidel()  red-black Gauss-Seidel, which is sor() with omega = 1
+// The tiles of a sweep are independent, so the results do not depend on the number of threads.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>  // std::swap
+#include <vector>
+#include <universal/math/stub/fma.hpp>
+#include <universal/utility/parallel_for.hpp>
+
+namespace sw::universal::blas {
+
+// tile of grid points processed together by one thread
+#ifndef BLAS_STENCIL_TILE_X
+#define BLAS_STENCIL_TILE_X 256
+#endif
+#ifndef BLAS_STENCIL_TILE_Y
+#define BLAS_STENCIL_TILE_Y 32
+#endif
+#ifndef BLAS_STENCIL_TILE_Z
+#define BLAS_STENCIL_TILE_Z 8
+#endif
+
+template<typename Scalar, size_t Dim>
+class structured_grid {
+	static_assert(Dim == 2 || Dim == 3, "structured grids are two or three dimensional");
+public:
+	static constexpr size_t dimension = Dim;
+	typedef Scalar value_type;
+
+	structured_grid() : _n{ 0, 0, 1 }, _stride{ 1, 0, 0 }, data(0) {}
+	// a grid of nx x ny (x nz) unknowns with a boundary layer, all set to zero
+	structured_grid(size_t nx, size_t ny, size_t nz = 1) : _n{ nx, ny, (Dim == 3 ? nz : 1) } {
+		_stride[0] = 1;
+		_stride[1] = nx + 2;
+		_stride[2] = (nx + 2) * (ny + 2);
+		data.assign(_stride[2] * (Dim == 3 ? nz + 2 : 1), Scalar(0));
+	}
+
+	// number of unknowns in direction d
+	size_t extent(size_t d) const { return _n[d]; }
+	// distance between neighbours in direction d
+	size_t stride(size_t d) const { return _stride[d]; }
+	size_t size() const { return data.size(); }
+
+	// point (i, j, k) with i in [0, nx+1], j in [0, ny+1], k in [0, nz+1]: the unknowns are at [1, n]
+	size_t index(size_t i, size_t j, size_t k = (Dim == 3 ? 1 : 0)) const { return i + j * _stride[1] + k * _stride[2]; }
+	Scalar  operator()(size_t i, size_t j, size_t k = (Dim == 3 ? 1 : 0)) const { return data[index(i, j, k)]; }
+	Scalar& operator()(size_t i, size_t j, size_t k = (Dim == 3 ? 1 : 0)) { return data[index(i, j, k)]; }
+
+	inline void setzero() { for (auto& e : data) e = Scalar(0); }
+	void swap(structured_grid& rhs) {
+		std::swap(_n, rhs._n);
+		std::swap(_stride, rhs._stride);
+		data.swap(rhs.data);
+	}
+
+	Scalar* begin() { return data.data(); }
+	const Scalar* begin() const { return data.data(); }
+
+private:
+	std::array<size_t, 3> _n;
+	std::array<size_t, 3> _stride;
+	std::vector<Scalar> data;
+};
+
+template<typename Scalar>
+using grid2D = structured_grid<Scalar, 2>;
+template<typename Scalar>
+using grid3D = structured_grid<Scalar, 3>;
+
+// constant coefficient star stencil: lower[d] weighs u(p - e_d), upper[d] weighs u(p + e_d)
+template<typename Scalar, size_t Dim>
+struct star_stencil {
+	Scalar center;
+	std::array<Scalar, Dim> lower;
+	std::array<Scalar, Dim> upper;
+};
+
+// the negative Laplacian scaled by h^2, the operator of the laplace2D() generator:
+// 2*Dim on the diagonal and -1 for the neighbours
+template<typename Scalar, size_t Dim>
+star_stencil<Scalar, Dim> laplacian() {
+	star_stencil<Scalar, Dim> A;
+	A.center = Scalar(2.0 * Dim);
+	for (size_t d = 0; d < Dim; ++d) {
+		A.lower[d] = Scalar(-1.0);
+		A.upper[d] = Scalar(-1.0);
+	}
+	return A;
+}
+
+namespace stencil_detail {
+
+	// a box of grid points [lo, hi) in every direction
+	struct box {
+		std::array<size_t, 3> lo, hi;
+	};
+
+	template<typename Scalar, size_t Dim>
+	std::array<size_t, 3> tile_counts(const structured_grid<Scalar, Dim>& u) {
+		constexpr size_t TILE[3] = { BLAS_STENCIL_TILE_X, BLAS_STENCIL_TILE_Y, (Dim == 3 ? BLAS_STENCIL_TILE_Z : 1) };
+		std::array<size_t, 3> count;
+		for (size_t d = 0; d < 3; ++d) count[d] = (u.extent(d) + TILE[d] - 1) / TILE[d];
+		return count;
+	}
+
+	// the unknowns of tile t, in grid coordinates
+	template<typename Scalar, size_t Dim>
+	box tile(const structured_grid<Scalar, Dim>& u, const std::array<size_t, 3>& count, size_t t) {
+		constexpr size_t TILE[3] = { BLAS_STENCIL_TILE_X, BLAS_STENCIL_TILE_Y, (Dim == 3 ? BLAS_STENCIL_TILE_Z : 1) };
+		size_t c[3] = { t % count[0], (t / count[0]) % count[1], t / (count[0] * count[1]) };
+		box b;
+		for (size_t d = 0; d < 3; ++d) {
+			size_t offset = (d < Dim ? 1 : 0);
+			b.lo[d] = offset + c[d] * TILE[d];
+			b.hi[d] = offset + std::min(u.extent(d), (c[d] + 1) * TILE[d]);
+		}
+		return b;
+	}
+
+	// sum of the neighbour terms of the stencil at point p of an array with the given strides
+	template<typename Scalar, size_t Dim>
+	inline Scalar neighbours(const star_stencil<Scalar, Dim>& A, const Scalar* u, size_t p, const std::array<size_t, 3>& stride) {
+		Scalar sigma = A.lower[0] * u[p - 1];
+		sigma = multiply_add(A.upper[0], u[p + 1], sigma);
+		for (size_t d = 1; d < Dim; ++d) {
+			sigma = multiply_add(A.lower[d], u[p - stride[d]], sigma);
+			sigma = multiply_add(A.upper[d], u[p + stride[d]], sigma);
+		}
+		return sigma;
+	}
+
+	// one damped Jacobi update of the points of box b: out = u + omega * ((f - sigma) / center - u)
+	template<typename Scalar, size_t Dim>
+	void jacobi_box(const star_stencil<Scalar, Dim>& A, const Scalar& rcp, const Scalar& omega, bool damped,
+		const Scalar* f, const std::array<size_t, 3>& fstride, const std::array<size_t, 3>& forigin,
+		const Scalar* u, Scalar* out, const std::array<size_t, 3>& stride, const std::array<size_t, 3>& origin, const box& b) {
+		for (size_t k = b.lo[2]; k < b.hi[2]; ++k) {
+			for (size_t j = b.lo[1]; j < b.hi[1]; ++j) {
+				size_t row = (j - origin[1]) * stride[1] + (k - origin[2]) * stride[2] - origin[0];
+				size_t frow = (j - forigin[1]) * fstride[1] + (k - forigin[2]) * fstride[2] - forigin[0];
+				for (size_t i = b.lo[0]; i < b.hi[0]; ++i) {
+					size_t p = row + i;
+					Scalar gs = (f[frow + i] - neighbours(A, u, p, stride)) * rcp;
+					out[p] = (damped ? multiply_add(omega, Scalar(gs - u[p]), u[p]) : gs);
+				}
+			}
+		}
+	}
+
+	inline std::array<size_t, 3> grid_strides(size_t s1, size_t s2) { return { 1, s1, s2 }; }
+}
+
+// y = A u on the unknowns of the grid; the boundary layer of y is not modified
+template<typename Scalar, size_t Dim>
+void apply(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& u, structured_grid<Scalar, Dim>& y, size_t nrThreads = 0) {
+	using namespace stencil_detail;
+	std::array<size_t, 3> count = tile_counts(u);
+	std::array<size_t, 3> stride = grid_strides(u.stride(1), u.stride(2));
+	const Scalar* src = u.begin();
+	Scalar* dst = y.begin();
+	parallel_for(0, count[0] * count[1] * count[2], [&](size_t first, size_t last) {
+		for (size_t t = first; t < last; ++t) {
+			box b = tile(u, count, t);
+			for (size_t k = b.lo[2]; k < b.hi[2]; ++k) {
+				for (size_t j = b.lo[1]; j < b.hi[1]; ++j) {
+					for (size_t i = b.lo[0]; i < b.hi[0]; ++i) {
+						size_t p = u.index(i, j, k);
+						dst[p] = multiply_add(A.center, src[p], neighbours(A, src, p, stride));
+					}
+				}
+			}
+		}
+	}, nrThreads);
+}
+
+// r = f - A u on the unknowns of the grid, returns the 2-norm of r
+// The partial sums of the tiles are combined in tile order, so the norm does not depend on nrThreads.
+template<typename Scalar, size_t Dim>
+double residual(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& u, const structured_grid<Scalar, Dim>& f, structured_grid<Scalar, Dim>& r, size_t nrThreads = 0) {
+	using namespace stencil_detail;
+	std::array<size_t, 3> count = tile_counts(u);
+	std::array<size_t, 3> stride = grid_strides(u.stride(1), u.stride(2));
+	size_t nrTiles = count[0] * count[1] * count[2];
+	std::vector<double> partial(nrTiles);
+	const Scalar* src = u.begin();
+	const Scalar* rhs = f.begin();
+	Scalar* dst = r.begin();
+	parallel_for(0, nrTiles, [&](size_t first, size_t last) {
+		for (size_t t = first; t < last; ++t) {
+			box b = tile(u, count, t);
+			double sum = 0.0;
+			for (size_t k = b.lo[2]; k < b.hi[2]; ++k) {
+				for (size_t j = b.lo[1]; j < b.hi[1]; ++j) {
+					for (size_t i = b.lo[0]; i < b.hi[0]; ++i) {
+						size_t p = u.index(i, j, k);
+						dst[p] = rhs[p] - multiply_add(A.center, src[p], neighbours(A, src, p, stride));
+						double e = double(dst[p]);
+						sum += e * e;
+					}
+				}
+			}
+			partial[t] = sum;
+		}
+	}, nrThreads);
+	double sum = 0.0;
+	for (double s : partial) sum += s;
+	return std::sqrt(sum);
+}
+
+template<typename Scalar, size_t Dim>
+double residual(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& u, const structured_grid<Scalar, Dim>& f, size_t nrThreads = 0) {
+	structured_grid<Scalar, Dim> r(u.extent(0), u.extent(1), u.extent(2));
+	return residual(A, u, f, r, nrThreads);
+}
+
+// nrSweeps damped Jacobi sweeps u <- u + omega * (D^-1 (f - (A - D) u) - u) for A u = f
+// The boundary layer of u holds the Dirichlet values. With temporalBlock = T > 1 every tile is copied
+// with a ghost zone of depth T into a thread-local buffer, relaxed T times in cache, and written back:
+// the ghost zone recomputes the values that the neighbouring tiles would provide, so the result is
+// identical to T separate sweeps, at the cost of the redundant updates of the ghost zones.
+template<typename Scalar, size_t Dim>
+void jacobi(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& f, structured_grid<Scalar, Dim>& u,
+	size_t nrSweeps, const Scalar& omega = Scalar(1.0), size_t nrThreads = 0, size_t temporalBlock = 1) {
+	using namespace stencil_detail;
+	if (temporalBlock == 0) temporalBlock = 1;
+	const Scalar rcp = Scalar(1.0) / A.center;
+	const bool damped = (omega != Scalar(1.0));
+	std::array<size_t, 3> count = tile_counts(u);
+	std::array<size_t, 3> stride = grid_strides(u.stride(1), u.stride(2));
+	const std::array<size_t, 3> origin = { 0, 0, 0 };
+	size_t nrTiles = count[0] * count[1] * count[2];
+	structured_grid<Scalar, Dim> next(u);   // carries the boundary layer
+
+	for (size_t sweep = 0; sweep < nrSweeps; ) {
+		size_t T = std::min(temporalBlock, nrSweeps - sweep);
+		const Scalar* src = u.begin();
+		Scalar* dst = next.begin();
+		parallel_for(0, nrTiles, [&](size_t first, size_t last) {
+			if (T == 1) {
+				for (size_t t = first; t < last; ++t) {
+					jacobi_box(A, rcp, omega, damped, f.begin(), stride, origin, src, dst, stride, origin, tile(u, count, t));
+				}
+				return;
+			}
+			// thread-local buffers for the tile and its ghost zone
+			std::vector<Scalar> front, back;
+			for (size_t t = first; t < last; ++t) {
+				box b = tile(u, count, t);
+				// the extended box, clipped to the grid including its boundary layer
+				box e;
+				for (size_t d = 0; d < 3; ++d) {
+					if (d < Dim) {
+						e.lo[d] = (b.lo[d] > T ? b.lo[d] - T : 0);
+						e.hi[d] = std::min(b.hi[d] + T, u.extent(d) + 2);
+					}
+					else {
+						e.lo[d] = b.lo[d];
+						e.hi[d] = b.hi[d];
+					}
+				}
+				std::array<size_t, 3> local = { 1, e.hi[0] - e.lo[0], (e.hi[0] - e.lo[0]) * (e.hi[1] - e.lo[1]) };
+				size_t n = local[2] * (e.hi[2] - e.lo[2]);
+				front.resize(n);
+				back.resize(n);
+				for (size_t k = e.lo[2]; k < e.hi[2]; ++k) {
+					for (size_t j = e.lo[1]; j < e.hi[1]; ++j) {
+						const Scalar* in = src + u.index(e.lo[0], j, k);
+						size_t row = (j - e.lo[1]) * local[1] + (k - e.lo[2]) * local[2];
+						for (size_t i = 0; i < local[1]; ++i) front[row + i] = back[row + i] = in[i];
+					}
+				}
+				// every sweep updates a box that shrinks by one point per direction towards the tile
+				for (size_t s = 1; s <= T; ++s) {
+					box a;
+					for (size_t d = 0; d < 3; ++d) {
+						if (d < Dim) {
+							a.lo[d] = std::max(b.lo[d] > T - s ? b.lo[d] - (T - s) : size_t(0), size_t(1));
+							a.hi[d] = std::min(b.hi[d] + (T - s), u.extent(d) + 1);
+						}
+						else {
+							a.lo[d] = b.lo[d];
+							a.hi[d] = b.hi[d];
+						}
+					}
+					jacobi_box(A, rcp, omega, damped, f.begin(), stride, origin, front.data(), back.data(), local, e.lo, a);
+					front.swap(back);
+				}
+				for (size_t k = b.lo[2]; k < b.hi[2]; ++k) {
+					for (size_t j = b.lo[1]; j < b.hi[1]; ++j) {
+						Scalar* out = dst + u.index(b.lo[0], j, k);
+						size_t row = (j - e.lo[1]) * local[1] + (k - e.lo[2]) * local[2] + (b.lo[0] - e.lo[0]);
+						for (size_t i = 0; i < b.hi[0] - b.lo[0]; ++i) out[i] = front[row + i];
+					}
+				}
+			}
+		}, nrThreads);
+		u.swap(next);
+		sweep += T;
+	}
+}
+
+// nrSweeps red-black SOR sweeps for A u = f: first the points with i + j + k even, then the odd points
+template<typename Scalar, size_t Dim>
+void sor(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& f, structured_grid<Scalar, Dim>& u,
+	const Scalar& omega, size_t nrSweeps, size_t nrThreads = 0) {
+	using namespace stencil_detail;
+	const Scalar rcp = Scalar(1.0) / A.center;
+	const bool damped = (omega != Scalar(1.0));
+	std::array<size_t, 3> count = tile_counts(u);
+	std::array<size_t, 3> stride = grid_strides(u.stride(1), u.stride(2));
+	size_t nrTiles = count[0] * count[1] * count[2];
+	Scalar* x = u.begin();
+	const Scalar* rhs = f.begin();
+	for (size_t sweep = 0; sweep < nrSweeps; ++sweep) {
+		for (size_t colour = 0; colour < 2; ++colour) {
+			parallel_for(0, nrTiles, [&](size_t first, size_t last) {
+				for (size_t t = first; t < last; ++t) {
+					box b = tile(u, count, t);
+					for (size_t k = b.lo[2]; k < b.hi[2]; ++k) {
+						for (size_t j = b.lo[1]; j < b.hi[1]; ++j) {
+							size_t i = b.lo[0] + ((b.lo[0] + j + k + colour) & 1);
+							for (; i < b.hi[0]; i += 2) {
+								size_t p = u.index(i, j, k);
+								Scalar gs = (rhs[p] - neighbours(A, x, p, stride)) * rcp;
+								x[p] = (damped ? multiply_add(omega, Scalar(gs - x[p]), x[p]) : gs);
+							}
+						}
+					}
+				}
+			}, nrThreads);
+		}
+	}
+}
+
+// nrSweeps red-black Gauss-Seidel sweeps for A u = f
+template<typename Scalar, size_t Dim>
+void gauss_seidel(const star_stencil<Scalar, Dim>& A, const structured_grid<Scalar, Dim>& f, structured_grid<Scalar, Dim>& u, size_t nrSweeps, size_t nrThreads = 0) {
+	sor(A, f, u, Scalar(1.0), nrSweeps, nrThreads);
+}
+
+} // namespace sw::universal::blas
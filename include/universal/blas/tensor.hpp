@@ -0,0 +1,289 @@
+#pragma once
+// tensor.hpp: aligned N-dimensional arrays with zero-copy strided views
+//
+// A tensor<Scalar, Rank> owns a row-major array of elements whose storage is aligned to
+// BLAS_TENSOR_ALIGNMENT bytes. A tensor_view<Scalar, Rank> refers to elements of a tensor
+// through a base pointer and a stride per dimension, so that slicing, sub-ranges, transposition,
+// and permutation of the dimensions only compute new strides and never copy elements.
+// A view of const elements is a read-only view. Views do not own their elements: they are
+// invalidated when the tensor they refer to is resized or destroyed.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <universal/blas/exceptions.hpp>
+
+namespace sw::universal::blas {
+
+// alignment in bytes of the storage of a tensor
+#ifndef BLAS_TENSOR_ALIGNMENT
+#define BLAS_TENSOR_ALIGNMENT 64
+#endif
+
+template<typename T, size_t Alignment = BLAS_TENSOR_ALIGNMENT>
+struct aligned_allocator {
+	static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+	using value_type = T;
+	template<typename U> struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+	aligned_allocator() noexcept = default;
+	template<typename U> aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+	T* allocate(size_t n) {
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+	}
+	void deallocate(T* p, size_t) noexcept {
+		::operator delete(p, std::align_val_t(Alignment));
+	}
+	template<typename U> bool operator==(const aligned_allocator<U, Alignment>&) const noexcept { return true; }
+	template<typename U> bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept { return false; }
+};
+
+template<size_t Rank>
+using tensor_shape = std::array<size_t, Rank>;
+
+// strides of the row-major layout of a tensor with the given extents
+template<size_t Rank>
+tensor_shape<Rank> row_major_strides(const tensor_shape<Rank>& extents) {
+	tensor_shape<Rank> strides{};
+	size_t stride = 1;
+	for (size_t d = Rank; d-- > 0; ) {
+		strides[d] = stride;
+		stride *= extents[d];
+	}
+	return strides;
+}
+
+template<typename Scalar, size_t Rank>
+class tensor_view {
+public:
+	static_assert(Rank > 0, "a tensor has at least one dimension");
+	static constexpr size_t rank = Rank;
+	using value_type = std::remove_const_t<Scalar>;
+	using element_type = Scalar;
+	using shape_type = tensor_shape<Rank>;
+
+	tensor_view() : _data{ nullptr }, _extents{}, _strides{} {}
+	tensor_view(Scalar* data, const shape_type& extents, const shape_type& strides) : _data{ data }, _extents(extents), _strides(strides) {}
+	tensor_view(Scalar* data, const shape_type& extents) : _data{ data }, _extents(extents), _strides(row_major_strides(extents)) {}
+
+	// a view of mutable elements converts to a view of const elements
+	operator tensor_view<const Scalar, Rank>() const { return tensor_view<const Scalar, Rank>(_data, _extents, _strides); }
+
+	template<typename... Indices>
+	Scalar& operator()(Indices... indices) const {
+		static_assert(sizeof...(Indices) == Rank, "the number of indices must equal the rank of the tensor");
+		size_t index[] = { static_cast<size_t>(indices)... };
+		size_t offset = 0;
+		for (size_t d = 0; d < Rank; ++d) offset += index[d] * _strides[d];
+		return _data[offset];
+	}
+	Scalar& operator[](const shape_type& index) const { return _data[offset(index)]; }
+
+	size_t offset(const shape_type& index) const {
+		size_t offset = 0;
+		for (size_t d = 0; d < Rank; ++d) offset += index[d] * _strides[d];
+		return offset;
+	}
+
+	// selectors
+	Scalar* data() const { return _data; }
+	size_t extent(size_t d) const { return _extents[d]; }
+	size_t stride(size_t d) const { return _strides[d]; }
+	const shape_type& extents() const { return _extents; }
+	const shape_type& strides() const { return _strides; }
+	size_t size() const {
+		size_t n = 1;
+		for (auto e : _extents) n *= e;
+		return n;
+	}
+	// true when the view covers a row-major array without gaps
+	bool is_contiguous() const { return _strides == row_major_strides(_extents); }
+
+	// the view of rank Rank-1 at position index of dimension d
+	tensor_view<Scalar, Rank - 1> slice(size_t d, size_t index) const {
+		static_assert(Rank > 1, "slicing a rank-1 view yields a scalar: use operator()");
+		if (d >= Rank || index >= _extents[d]) throw incompatible_tensors("slice index out of range");
+		tensor_shape<Rank - 1> extents, strides;
+		for (size_t s = 0, t = 0; s < Rank; ++s) {
+			if (s == d) continue;
+			extents[t] = _extents[s];
+			strides[t] = _strides[s];
+			++t;
+		}
+		return tensor_view<Scalar, Rank - 1>(_data + index * _strides[d], extents, strides);
+	}
+	// the view of the index range [first, last) of dimension d
+	tensor_view subview(size_t d, size_t first, size_t last) const {
+		if (d >= Rank || first > last || last > _extents[d]) throw incompatible_tensors("subview range out of range");
+		shape_type extents = _extents;
+		extents[d] = last - first;
+		return tensor_view(_data + first * _strides[d], extents, _strides);
+	}
+	// the view with dimensions d0 and d1 exchanged
+	tensor_view transpose(size_t d0 = Rank - 2, size_t d1 = Rank - 1) const {
+		static_assert(Rank > 1, "transposition requires at least two dimensions");
+		if (d0 >= Rank || d1 >= Rank) throw incompatible_tensors("transpose dimension out of range");
+		shape_type extents = _extents, strides = _strides;
+		std::swap(extents[d0], extents[d1]);
+		std::swap(strides[d0], strides[d1]);
+		return tensor_view(_data, extents, strides);
+	}
+	// the view whose dimension d is dimension order[d] of this view
+	tensor_view permute(const shape_type& order) const {
+		shape_type extents, strides;
+		std::array<bool, Rank> used{};
+		for (size_t d = 0; d < Rank; ++d) {
+			if (order[d] >= Rank || used[order[d]]) throw incompatible_tensors("permute requires a permutation of the dimensions");
+			used[order[d]] = true;
+			extents[d] = _extents[order[d]];
+			strides[d] = _strides[order[d]];
+		}
+		return tensor_view(_data, extents, strides);
+	}
+	// the view of the same elements with a new shape, which requires a contiguous view
+	template<size_t NewRank>
+	tensor_view<Scalar, NewRank> reshape(const tensor_shape<NewRank>& extents) const {
+		size_t n = 1;
+		for (auto e : extents) n *= e;
+		if (!is_contiguous() || n != size()) throw incompatible_tensors("reshape requires a contiguous view of the same size");
+		return tensor_view<Scalar, NewRank>(_data, extents);
+	}
+
+	// assign value to all elements of the view
+	template<typename S = Scalar, typename = std::enable_if_t<!std::is_const_v<S>>>
+	void fill(const value_type& value) const {
+		for_each_index([&](const shape_type& index) { _data[offset(index)] = value; });
+	}
+
+	// call f(index) for each index of the view in row-major order
+	template<typename Function>
+	void for_each_index(Function&& f) const {
+		if (size() == 0) return;
+		shape_type index{};
+		for (;;) {
+			f(static_cast<const shape_type&>(index));
+			size_t d = Rank;
+			while (d-- > 0) {
+				if (++index[d] < _extents[d]) break;
+				index[d] = 0;
+			}
+			if (d == size_t(-1)) return;
+		}
+	}
+
+private:
+	Scalar*    _data;
+	shape_type _extents;
+	shape_type _strides;
+};
+
+template<typename Scalar, size_t Rank>
+class tensor {
+public:
+	static_assert(Rank > 0, "a tensor has at least one dimension");
+	static constexpr size_t rank = Rank;
+	using value_type = Scalar;
+	using shape_type = tensor_shape<Rank>;
+	using view_type = tensor_view<Scalar, Rank>;
+	using const_view_type = tensor_view<const Scalar, Rank>;
+
+	tensor() : _extents{}, _data() {}
+	explicit tensor(const shape_type& extents) : _extents(extents), _data(count(extents), Scalar(0.0)) {}
+	tensor(const shape_type& extents, const Scalar& value) : _extents(extents), _data(count(extents), value) {}
+	// copy of the elements of a view, converted to Scalar through double when the types differ
+	template<typename Source>
+	explicit tensor(const tensor_view<Source, Rank>& source) : _extents(source.extents()), _data() {
+		_data.reserve(count(_extents));
+		source.for_each_index([&](const shape_type& index) { _data.push_back(convert_element(source[index])); });
+	}
+	template<typename Source>
+	explicit tensor(const tensor<Source, Rank>& source) : tensor(source.view()) {}
+
+	// views of all elements
+	view_type view() { return view_type(_data.data(), _extents); }
+	const_view_type view() const { return const_view_type(_data.data(), _extents); }
+	operator view_type() { return view(); }
+	operator const_view_type() const { return view(); }
+
+	template<typename... Indices>
+	Scalar& operator()(Indices... indices) { return view()(indices...); }
+	template<typename... Indices>
+	const Scalar& operator()(Indices... indices) const { return view()(indices...); }
+	Scalar& operator[](const shape_type& index) { return view()[index]; }
+	const Scalar& operator[](const shape_type& index) const { return view()[index]; }
+
+	// views, see tensor_view
+	tensor_view<Scalar, Rank - 1> slice(size_t d, size_t index) { return view().slice(d, index); }
+	tensor_view<const Scalar, Rank - 1> slice(size_t d, size_t index) const { return view().slice(d, index); }
+	view_type subview(size_t d, size_t first, size_t last) { return view().subview(d, first, last); }
+	const_view_type subview(size_t d, size_t first, size_t last) const { return view().subview(d, first, last); }
+	view_type transpose(size_t d0 = Rank - 2, size_t d1 = Rank - 1) { return view().transpose(d0, d1); }
+	const_view_type transpose(size_t d0 = Rank - 2, size_t d1 = Rank - 1) const { return view().transpose(d0, d1); }
+	view_type permute(const shape_type& order) { return view().permute(order); }
+	const_view_type permute(const shape_type& order) const { return view().permute(order); }
+	template<size_t NewRank>
+	tensor_view<Scalar, NewRank> reshape(const tensor_shape<NewRank>& extents) { return view().reshape(extents); }
+	template<size_t NewRank>
+	tensor_view<const Scalar, NewRank> reshape(const tensor_shape<NewRank>& extents) const { return view().reshape(extents); }
+
+	// selectors
+	Scalar* data() { return _data.data(); }
+	const Scalar* data() const { return _data.data(); }
+	size_t extent(size_t d) const { return _extents[d]; }
+	const shape_type& extents() const { return _extents; }
+	size_t size() const { return _data.size(); }
+
+	// modifiers
+	void fill(const Scalar& value) { for (auto& e : _data) e = value; }
+	void setzero() { fill(Scalar(0.0)); }
+	void resize(const shape_type& extents) {
+		_extents = extents;
+		_data.assign(count(extents), Scalar(0.0));
+	}
+
+private:
+	shape_type _extents;
+	std::vector<Scalar, aligned_allocator<Scalar>> _data;
+
+	static size_t count(const shape_type& extents) {
+		size_t n = 1;
+		for (auto e : extents) n *= e;
+		return n;
+	}
+	template<typename Source>
+	static Scalar convert_element(const Source& v) {
+		if constexpr (std::is_same_v<std::remove_const_t<Source>, Scalar>) return v; else return Scalar(double(v));
+	}
+};
+
+// views of tensors and views, used by the kernels to accept either
+template<typename Scalar, size_t Rank>
+tensor_view<Scalar, Rank> as_view(tensor<Scalar, Rank>& t) { return t.view(); }
+template<typename Scalar, size_t Rank>
+tensor_view<const Scalar, Rank> as_view(const tensor<Scalar, Rank>& t) { return t.view(); }
+template<typename Scalar, size_t Rank>
+tensor_view<Scalar, Rank> as_view(const tensor_view<Scalar, Rank>& v) { return v; }
+template<typename Tensor>
+auto as_const_view(const Tensor& t) {
+	auto v = as_view(t);
+	using view_type = decltype(v);
+	return tensor_view<const typename view_type::value_type, view_type::rank>(v.data(), v.extents(), v.strides());
+}
+
+// copy the elements of a view into a view of the same shape, converting through double when the types differ
+template<typename Source, typename Target, size_t Rank>
+void copy(const tensor_view<Source, Rank>& source, const tensor_view<Target, Rank>& target) {
+	if (source.extents() != target.extents()) throw incompatible_tensors("copy requires views of the same shape");
+	source.for_each_index([&](const tensor_shape<Rank>& index) {
+		if constexpr (std::is_same_v<std::remove_const_t<Source>, Target>) target[index] = source[index];
+		else target[index] = Target(double(source[index]));
+	});
+}
+
+} // namespace sw::universal::blas
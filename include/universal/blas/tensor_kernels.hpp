@@ -0,0 +1,257 @@
+#pragma once
+// tensor_kernels.hpp: tiled, multithreaded matmul, conv2d, and softmax kernels for low-precision inference
+//
+// The sums of products of matmul and conv2d are formed in an Accumulator through the accumulation
+// policies of the DSP library: a quire sums posit products exactly, a wide fixpnt sums fixpnt products
+// exactly, and any other number system, such as float for cfloat<8,4> operands, sums in its own arithmetic.
+// Each output element is rounded once. The weights are either a tensor view or a packed_tensor, and the
+// kernels decode a tile of weights at a time into a scratch buffer that the tile of outputs reuses.
+// Work is partitioned over output rows, so the results do not depend on the number of threads.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include <universal/blas/tensor.hpp>
+#include <universal/blas/packed_tensor.hpp>
+#include <universal/dsp/accumulation.hpp>
+#include <universal/utility/parallel_for.hpp>
+
+namespace sw::universal::blas {
+
+// number of output rows processed together by one thread
+#ifndef BLAS_TENSOR_TILE_M
+#define BLAS_TENSOR_TILE_M 16
+#endif
+// number of output columns that share a tile of accumulators
+#ifndef BLAS_TENSOR_TILE_N
+#define BLAS_TENSOR_TILE_N 64
+#endif
+
+namespace tensor_detail {
+
+	template<typename Weights> struct weight_traits;
+	template<typename Scalar>
+	struct weight_traits< tensor_view<Scalar, 2> > { using value_type = std::remove_const_t<Scalar>; };
+	template<typename Scalar>
+	struct weight_traits< tensor_view<Scalar, 4> > { using value_type = std::remove_const_t<Scalar>; };
+	template<typename Scalar, size_t Rank>
+	struct weight_traits< packed_tensor<Scalar, Rank> > { using value_type = Scalar; };
+
+	// weights are used through views, packed weights as they are
+	template<typename Scalar, size_t Rank>
+	const packed_tensor<Scalar, Rank>& weights(const packed_tensor<Scalar, Rank>& w) { return w; }
+	template<typename Weights>
+	auto weights(const Weights& w) { return as_const_view(w); }
+
+	// decode the columns [j0, j1) of the rows of a K x N weight matrix into tile, row-major with j1-j0 columns
+	template<typename Scalar>
+	void load_tile(const tensor_view<const Scalar, 2>& B, size_t j0, size_t j1, Scalar* tile) {
+		size_t nb = j1 - j0;
+		for (size_t k = 0; k < B.extent(0); ++k) {
+			for (size_t j = j0; j < j1; ++j) tile[k * nb + j - j0] = B(k, j);
+		}
+	}
+	template<typename Scalar>
+	void load_tile(const packed_tensor<Scalar, 2>& B, size_t j0, size_t j1, Scalar* tile) {
+		size_t nb = j1 - j0;
+		for (size_t k = 0; k < B.extent(0); ++k) B.unpack(k * B.extent(1) + j0, nb, tile + k * nb);
+	}
+
+	// decode filter o of an O x C x KH x KW weight tensor into filter, row-major
+	template<typename Scalar>
+	void load_filter(const tensor_view<const Scalar, 4>& W, size_t o, Scalar* filter) {
+		size_t i = 0;
+		for (size_t c = 0; c < W.extent(1); ++c) {
+			for (size_t kh = 0; kh < W.extent(2); ++kh) {
+				for (size_t kw = 0; kw < W.extent(3); ++kw) filter[i++] = W(o, c, kh, kw);
+			}
+		}
+	}
+	template<typename Scalar>
+	void load_filter(const packed_tensor<Scalar, 4>& W, size_t o, Scalar* filter) {
+		size_t n = W.extent(1) * W.extent(2) * W.extent(3);
+		W.unpack(o * n, n, filter);
+	}
+
+	template<typename Target, typename Source>
+	inline Target convert_element(const Source& v) {
+		if constexpr (std::is_same_v<Target, Source>) return v; else return Target(double(v));
+	}
+}
+
+// C = A B, with A an M x K view, B a K x N view or packed tensor, and C an M x N view
+template<typename Accumulator, typename ATensor, typename BTensor, typename CTensor>
+void matmul(const ATensor& a, const BTensor& b, CTensor&& c, size_t nrThreads = 0) {
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	auto A = as_const_view(a);
+	const auto& B = tensor_detail::weights(b);
+	auto C = as_view(c);
+	using BScalar = typename tensor_detail::weight_traits<std::remove_const_t<std::remove_reference_t<decltype(B)>>>::value_type;
+	using CScalar = typename decltype(C)::value_type;
+	size_t M = A.extent(0), K = A.extent(1), N = B.extent(1);
+	if (B.extent(0) != K || C.extent(0) != M || C.extent(1) != N) throw incompatible_tensors("matmul requires A[M x K], B[K x N], and C[M x N]");
+	constexpr size_t TILE_N = BLAS_TENSOR_TILE_N;
+
+	parallel_for(0, M, [&](size_t first, size_t last) {
+		std::vector<BScalar, aligned_allocator<BScalar>> tile(K * TILE_N);
+		std::vector<Accumulator> acc(TILE_N);
+		for (size_t j0 = 0; j0 < N; j0 += TILE_N) {
+			size_t j1 = (j0 + TILE_N < N ? j0 + TILE_N : N);
+			size_t nb = j1 - j0;
+			tensor_detail::load_tile(B, j0, j1, tile.data());
+			for (size_t i = first; i < last; ++i) {
+				for (size_t j = 0; j < nb; ++j) policy::clear(acc[j]);
+				for (size_t k = 0; k < K; ++k) {
+					const auto& aik = A(i, k);
+					const BScalar* row = tile.data() + k * nb;
+					for (size_t j = 0; j < nb; ++j) policy::mac(acc[j], aik, row[j]);
+				}
+				for (size_t j = 0; j < nb; ++j) {
+					CScalar y;
+					policy::round(acc[j], y);
+					C(i, j0 + j) = y;
+				}
+			}
+		}
+	}, nrThreads, BLAS_TENSOR_TILE_M);
+}
+
+struct conv2d_params {
+	size_t stride = 1;
+	size_t padding = 0;    // zeros added on each side of the height and width
+	size_t dilation = 1;
+};
+
+// extents of the output of a conv2d of an N x C x H x W input with O x C x KH x KW weights
+inline tensor_shape<4> conv2d_extents(const tensor_shape<4>& input, const tensor_shape<4>& weights, const conv2d_params& params = conv2d_params{}) {
+	size_t spanH = params.dilation * (weights[2] - 1) + 1;
+	size_t spanW = params.dilation * (weights[3] - 1) + 1;
+	size_t H = input[2] + 2 * params.padding, W = input[3] + 2 * params.padding;
+	if (input[1] != weights[1] || params.stride == 0 || spanH > H || spanW > W) throw incompatible_tensors("conv2d weights do not fit the input");
+	return { input[0], weights[0], (H - spanH) / params.stride + 1, (W - spanW) / params.stride + 1 };
+}
+
+namespace tensor_detail {
+	template<typename Accumulator, typename Input, typename Weights, typename Output, typename Bias>
+	void conv2d(const Input& in, const Weights& W, const Output& out, const conv2d_params& params, Bias&& bias, size_t nrThreads) {
+		using policy = sw::universal::dsp::accumulation<Accumulator>;
+		using WScalar = typename weight_traits<Weights>::value_type;
+		using OScalar = typename Output::value_type;
+		tensor_shape<4> inExtents = in.extents(), wExtents = W.extents();
+		if (conv2d_extents(inExtents, wExtents, params) != out.extents()) throw incompatible_tensors("conv2d output extents do not match the input and weights");
+		size_t N = inExtents[0], C = inExtents[1], H = inExtents[2], Wd = inExtents[3];
+		size_t O = wExtents[0], KH = wExtents[2], KW = wExtents[3];
+		size_t Ho = out.extent(2), Wo = out.extent(3);
+		size_t s = params.stride, p = params.padding, d = params.dilation;
+		constexpr size_t TILE_N = BLAS_TENSOR_TILE_N;
+
+		// one task per image and output channel
+		parallel_for(0, N * O, [&](size_t first, size_t last) {
+			std::vector<WScalar, aligned_allocator<WScalar>> filter(C * KH * KW);
+			std::vector<Accumulator> acc(TILE_N);
+			for (size_t t = first; t < last; ++t) {
+				size_t n = t / O, o = t % O;
+				load_filter(W, o, filter.data());
+				for (size_t oh = 0; oh < Ho; ++oh) {
+					for (size_t ow0 = 0; ow0 < Wo; ow0 += TILE_N) {
+						size_t nb = (ow0 + TILE_N < Wo ? TILE_N : Wo - ow0);
+						for (size_t j = 0; j < nb; ++j) {
+							policy::clear(acc[j]);
+							bias(acc[j], o);
+						}
+						const WScalar* w = filter.data();
+						for (size_t c = 0; c < C; ++c) {
+							for (size_t kh = 0; kh < KH; ++kh, w += KW) {
+								size_t ih = oh * s + kh * d;
+								if (ih < p || ih - p >= H) continue;
+								ih -= p;
+								for (size_t kw = 0; kw < KW; ++kw) {
+									size_t offset = kw * d;
+									for (size_t j = 0; j < nb; ++j) {
+										size_t iw = (ow0 + j) * s + offset;
+										if (iw < p || iw - p >= Wd) continue;
+										policy::mac(acc[j], w[kw], in(n, c, ih, iw - p));
+									}
+								}
+							}
+						}
+						for (size_t j = 0; j < nb; ++j) {
+							OScalar y;
+							policy::round(acc[j], y);
+							out(n, o, oh, ow0 + j) = y;
+						}
+					}
+				}
+			}
+		}, nrThreads);
+	}
+}
+
+// output = conv2d(input, weights), with input N x C x H x W, weights O x C x KH x KW (a view or a packed tensor),
+// and output N x O x Ho x Wo, see conv2d_extents()
+template<typename Accumulator, typename ITensor, typename WTensor, typename OTensor>
+void conv2d(const ITensor& input, const WTensor& weights, OTensor&& output, const conv2d_params& params = conv2d_params{}, size_t nrThreads = 0) {
+	auto in = as_const_view(input);
+	tensor_detail::conv2d<Accumulator>(in, tensor_detail::weights(weights), as_view(output), params, [](Accumulator&, size_t) {}, nrThreads);
+}
+
+// output = conv2d(input, weights) + bias, with a bias of O elements that is accumulated with the products as bias * 1
+template<typename Accumulator, typename ITensor, typename WTensor, typename BTensor, typename OTensor,
+	typename = std::enable_if_t<!std::is_same_v<std::decay_t<OTensor>, conv2d_params>>>
+void conv2d(const ITensor& input, const WTensor& weights, const BTensor& bias, OTensor&& output, const conv2d_params& params = conv2d_params{}, size_t nrThreads = 0) {
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	auto in = as_const_view(input);
+	auto b = as_const_view(bias);
+	using IScalar = typename decltype(in)::value_type;
+	if (b.extent(0) != weights.extent(0)) throw incompatible_tensors("conv2d requires a bias per output channel");
+	IScalar one = IScalar(1.0);
+	tensor_detail::conv2d<Accumulator>(in, tensor_detail::weights(weights), as_view(output), params,
+		[&](Accumulator& acc, size_t o) { policy::mac(acc, b(o), one); }, nrThreads);
+}
+
+// output = softmax(input) along the last dimension, evaluated in the arithmetic of Wide
+template<typename Wide = double, typename ITensor, typename OTensor>
+void softmax(const ITensor& input, OTensor&& output, size_t nrThreads = 0) {
+	using std::exp;
+	auto in = as_const_view(input);
+	auto out = as_view(output);
+	using IScalar = typename decltype(in)::value_type;
+	using OScalar = typename decltype(out)::value_type;
+	constexpr size_t Rank = decltype(in)::rank;
+	if (in.extents() != out.extents()) throw incompatible_tensors("softmax requires an output of the shape of the input");
+	size_t L = in.extent(Rank - 1);
+	size_t nrRows = (L == 0 ? 0 : in.size() / L);
+
+	parallel_for(0, nrRows, [&](size_t first, size_t last) {
+		std::vector<Wide> e(L);
+		tensor_shape<Rank> index{};
+		for (size_t r = first; r < last; ++r) {
+			// the index of the first element of row r
+			size_t rest = r;
+			for (size_t d = Rank - 1; d-- > 0; ) {
+				index[d] = rest % in.extent(d);
+				rest /= in.extent(d);
+			}
+			index[Rank - 1] = 0;
+			const IScalar* x = &in[index];
+			OScalar* y = &out[index];
+			size_t xs = in.stride(Rank - 1), ys = out.stride(Rank - 1);
+			Wide maximum = tensor_detail::convert_element<Wide>(x[0]);
+			for (size_t k = 1; k < L; ++k) {
+				Wide v = tensor_detail::convert_element<Wide>(x[k * xs]);
+				if (v > maximum) maximum = v;
+			}
+			Wide sum = Wide(0.0);
+			for (size_t k = 0; k < L; ++k) {
+				e[k] = exp(Wide(tensor_detail::convert_element<Wide>(x[k * xs]) - maximum));
+				sum += e[k];
+			}
+			for (size_t k = 0; k < L; ++k) y[k * ys] = tensor_detail::convert_element<OScalar>(Wide(e[k] / sum));
+		}
+	}, nrThreads);
+}
+
+} // namespace sw::universal::blas
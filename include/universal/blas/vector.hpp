@@ -288,6 +288,21 @@ vector<Scalar> operator/(const vector<Scalar>& v, const int normalizer) {
 
 template<typename Scalar> auto size(const vector<Scalar>& v) { return v.size(); }
 
+// vector equivalence tests
+template<typename Scalar>
+bool operator==(const vector<Scalar>& a, const vector<Scalar>& b) {
+	if (size(a) != size(b)) return false;
+	for (size_t i = 0; i < size(a); ++i) {
+		if (a[i] != b[i]) return false;
+	}
+	return true;
+}
+
+template<typename Scalar>
+bool operator!=(const vector<Scalar>& a, const vector<Scalar>& b) {
+	return !(a == b);
+}
+
 // this design does not work well for universal as we would need to create
 // enable_if() configurations for all possible type combinations
 
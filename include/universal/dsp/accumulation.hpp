@@ -0,0 +1,132 @@
+#pragma once
+// accumulation.hpp: accumulation policies for the sum-of-products kernels of the DSP library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <type_traits>
+#include <universal/math/stub/fma.hpp>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+
+namespace sw::universal::dsp {
+
+/*
+A filter output is a sum of products of coefficients and samples. The Accumulator type of a filter
+selects how that sum is formed, through the accumulation<Accumulator> policy:
+
+  clear(acc)            reset the accumulator to zero
+  mac(acc, c, x)        acc += c * x
+  round(acc, y)         round the accumulated sum to the sample type
+
+The generic policy forms the sum in the Accumulator arithmetic with multiply_add(), which is a fused
+multiply-add when the number system provides one. The quire policy accumulates the unrounded posit
+products exactly, and the wide fixpnt policy accumulates the exact fixed-point products in a register
+that has the guard bits of a DSP accumulator. In the last two cases round() is the one and only
+rounding step of the output sample.
+*/
+
+// generic policy: accumulate in the Accumulator arithmetic
+template<typename Accumulator>
+struct accumulation {
+	static void clear(Accumulator& acc) { acc = Accumulator(0); }
+
+	template<typename Coeff, typename Sample>
+	static void mac(Accumulator& acc, const Coeff& c, const Sample& x) {
+		acc = multiply_add(Accumulator(c), Accumulator(x), acc);
+	}
+
+	template<typename Sample>
+	static void round(const Accumulator& acc, Sample& y) {
+		y = Sample(acc);
+	}
+};
+
+// quire policy: exact accumulation of posit products, rounded once
+template<size_t nbits, size_t es, size_t capacity>
+struct accumulation< quire<nbits, es, capacity> > {
+	using Accumulator = quire<nbits, es, capacity>;
+
+	static void clear(Accumulator& acc) { acc.clear(); }
+
+	static void mac(Accumulator& acc, const posit<nbits, es>& c, const posit<nbits, es>& x) {
+		acc += quire_mul(c, x);
+	}
+
+	static void round(const Accumulator& acc, posit<nbits, es>& y) {
+		convert(acc.to_value(), y);
+	}
+};
+
+// wide fixpnt policy: the product of a fixpnt<cbits,crbits> coefficient and a fixpnt<sbits,srbits> sample
+// is exact in cbits+sbits bits with crbits+srbits fraction bits. When the accumulator has that radix point
+// and at least that many bits, the products are summed without rounding, and the accumulator bits beyond
+// cbits+sbits are guard bits that absorb the growth of the sum. Like the accumulator of a DSP, the sum
+// wraps when the guard bits are exhausted; the final rounding saturates when the sample type does.
+template<size_t accbits, size_t accrbits, bool accarith, typename bt>
+struct accumulation< fixpnt<accbits, accrbits, accarith, bt> > {
+	using Accumulator = fixpnt<accbits, accrbits, accarith, bt>;
+
+	static void clear(Accumulator& acc) { acc.setzero(); }
+
+	template<size_t cbits, size_t crbits, bool carith, size_t sbits, size_t srbits, bool sarith>
+	static void mac(Accumulator& acc, const fixpnt<cbits, crbits, carith, bt>& c, const fixpnt<sbits, srbits, sarith, bt>& x) {
+		if constexpr (crbits + srbits == accrbits && cbits + sbits <= accbits) {
+			constexpr size_t opbits = (cbits > sbits ? cbits : sbits);
+			blockbinary<opbits, bt> a(c.getbb()), b(x.getbb());
+			blockbinary<accbits, bt> sum(acc.getbb());
+			sum += blockbinary<accbits, bt>(urmul2(a, b));
+			acc = sum;
+		}
+		else {
+			acc = multiply_add(Accumulator(c), Accumulator(x), acc);
+		}
+	}
+
+	template<size_t sbits, size_t srbits, bool sarith>
+	static void round(const Accumulator& acc, fixpnt<sbits, srbits, sarith, bt>& y) {
+		if constexpr (std::is_same_v<Accumulator, fixpnt<sbits, srbits, sarith, bt>>) {
+			y = acc;
+		}
+		else {
+			static_assert(accrbits >= srbits, "accumulator needs at least as many fraction bits as the sample");
+			static_assert(accbits - accrbits >= sbits - srbits, "accumulator needs at least as many integer bits as the sample");
+			constexpr int shift = static_cast<int>(accrbits - srbits);
+			blockbinary<accbits, bt> raw = acc.getbb();
+			bool roundUp = raw.roundingMode(shift);
+			raw >>= shift;
+			if constexpr (sarith != Modulo) {
+				fixpnt<sbits, srbits, sarith, bt> fp;
+				blockbinary<accbits, bt> saturation = maxpos<sbits, srbits, sarith, bt>(fp).getbb();
+				if (raw >= saturation) {
+					y = saturation;
+					return;
+				}
+				saturation = maxneg<sbits, srbits, sarith, bt>(fp).getbb();
+				if (raw < saturation) {
+					y = saturation;
+					return;
+				}
+			}
+			if (roundUp) ++raw;
+			y = raw; // select the lower sbits of the result
+		}
+	}
+};
+
+// sum of products of n coefficients and n samples, rounded once to the sample type
+template<typename Accumulator, typename Coeff, typename Sample>
+Sample dot(const Coeff* h, const Sample* x, size_t n) {
+	using policy = accumulation<Accumulator>;
+	Accumulator acc;
+	policy::clear(acc);
+	for (size_t k = 0; k < n; ++k) {
+		policy::mac(acc, h[k], x[k]);
+	}
+	Sample y;
+	policy::round(acc, y);
+	return y;
+}
+
+}  // namespace sw::universal::dsp
@@ -0,0 +1,48 @@
+#pragma once
+// delay_line.hpp: circular delay line that presents the sample history as a contiguous array
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <vector>
+
+namespace sw::universal::dsp {
+
+/*
+A delay line of length N keeps the last N samples x[n], x[n-1], ..., x[n-N+1].
+The samples are stored twice, at position i and i + N of a buffer of 2N samples, so that
+the history is always available as N consecutive samples starting at the newest one:
+a push is two stores and an index decrement, and the convolution kernels can
+run over the history without wrapping the index.
+*/
+template<typename Sample>
+class delay_line {
+public:
+	delay_line() : _length{ 0 }, _head{ 0 }, _buffer{} {}
+	explicit delay_line(size_t length) : _length{ length }, _head{ 0 }, _buffer(2 * length, Sample(0)) {}
+
+	// insert a new sample, the oldest sample drops out of the history
+	void push(const Sample& x) {
+		if (_length == 0) return;
+		_head = (_head == 0 ? _length - 1 : _head - 1);
+		_buffer[_head] = x;
+		_buffer[_head + _length] = x;
+	}
+	// the history: data()[k] = x[n-k]
+	const Sample* data() const noexcept { return _buffer.data() + _head; }
+	const Sample& operator[](size_t k) const noexcept { return _buffer[_head + k]; }
+
+	void reset() {
+		for (auto& x : _buffer) x = Sample(0);
+		_head = 0;
+	}
+	size_t size() const noexcept { return _length; }
+
+private:
+	size_t              _length;
+	size_t              _head;     // position of the newest sample
+	std::vector<Sample> _buffer;
+};
+
+}  // namespace sw::universal::dsp
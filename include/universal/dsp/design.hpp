@@ -0,0 +1,32 @@
+#pragma once
+// design.hpp: filter design helpers that generate coefficients in double precision
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace sw::universal::dsp {
+
+// taps of a Hamming windowed-sinc lowpass filter with unity DC gain,
+// the cutoff frequency is a fraction of the sample rate in (0, 0.5)
+inline std::vector<double> lowpass(size_t nrTaps, double cutoff) {
+	constexpr double pi = 3.14159265358979323846;
+	std::vector<double> h(nrTaps);
+	if (nrTaps == 0) return h;
+	double center = double(nrTaps - 1) / 2.0;
+	double sum = 0.0;
+	for (size_t k = 0; k < nrTaps; ++k) {
+		double t = double(k) - center;
+		double sinc = (t == 0.0 ? 2.0 * cutoff : std::sin(2.0 * pi * cutoff * t) / (pi * t));
+		double window = (nrTaps == 1 ? 1.0 : 0.54 - 0.46 * std::cos(2.0 * pi * double(k) / double(nrTaps - 1)));
+		h[k] = sinc * window;
+		sum += h[k];
+	}
+	for (auto& v : h) v /= sum;
+	return h;
+}
+
+}  // namespace sw::universal::dsp
@@ -0,0 +1,22 @@
+// dsp.hpp: top-level include for the Universal digital signal processing library
+//
+// Streaming filter components that are parameterized in the sample, coefficient, and
+// accumulator number systems, so that each output sample can be rounded only once,
+// and fast Fourier transforms over complex Universal number types.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#ifndef _UNIVERSAL_DSP_LIBRARY
+#define _UNIVERSAL_DSP_LIBRARY
+
+#include <universal/dsp/exceptions.hpp>
+#include <universal/dsp/accumulation.hpp>
+#include <universal/dsp/delay_line.hpp>
+#include <universal/dsp/fir.hpp>
+#include <universal/dsp/iir.hpp>
+#include <universal/dsp/multirate.hpp>
+#include <universal/dsp/fft.hpp>
+#include <universal/dsp/design.hpp>
+
+#endif // _UNIVERSAL_DSP_LIBRARY
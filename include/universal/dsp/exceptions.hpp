@@ -0,0 +1,27 @@
+#pragma once
+// exceptions.hpp: exceptions for problems in DSP calculations
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <stdexcept>
+#include <string>
+
+namespace sw::universal::dsp {
+
+// base class for DSP exceptions
+struct dsp_exception
+	: public std::runtime_error
+{
+	dsp_exception(const std::string& error)
+		: std::runtime_error(std::string("DSP exception: ") + error) {};
+};
+
+struct transform_size_not_power_of_two
+	: public dsp_exception
+{
+	transform_size_not_power_of_two(const std::string& error = "transform size must be a power of two")
+		: dsp_exception(error) {};
+};
+
+}  // namespace sw::universal::dsp
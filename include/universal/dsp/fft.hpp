@@ -0,0 +1,281 @@
+#pragma once
+// fft.hpp: iterative radix-2/4 fast Fourier transforms over complex Universal number types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <universal/utility/parallel_for.hpp>
+#include <universal/dsp/exceptions.hpp>
+
+namespace sw::universal::dsp {
+
+/*
+fft_plan<Scalar> computes the discrete Fourier transform X[k] = sum_n x[n] W^(nk), W = exp(-2 pi i / N),
+of std::complex<Scalar> sequences whose size N is a power of two.
+
+The plan precomputes, in the target number system, the bit reversal permutation and the twiddle
+factors of every stage. The twiddles are evaluated in double precision and rounded once into Scalar,
+instead of being generated by repeated multiplication in Scalar, and they are stored stage by stage so
+that each pass reads its twiddles contiguously. After the permutation, pairs of radix-2 stages are fused
+into radix-4 passes, which halves the number of sweeps over the data and replaces the product with
+the quarter-period twiddle by a swap of the real and imaginary parts. A transform with an odd number of
+stages starts with a radix-2 pass.
+
+A scaled plan multiplies the inputs of the additions of every radix-2 stage by 1/2, so that the forward
+transform returns X[k]/N. The magnitudes then never grow, which is what fixed-point formats such as fixpnt<16,14> need.
+The inverse transform of a scaled plan omits the final 1/N, so that inverse(forward(x)) == x holds in both modes.
+
+Large transforms distribute the butterflies of each pass over nrThreads threads, and the batched
+interfaces distribute whole transforms.
+*/
+template<typename Scalar>
+class fft_plan {
+public:
+	using complex = std::complex<Scalar>;
+
+	explicit fft_plan(size_t n, bool scaled = false, size_t nrThreads = 1) : _n{ n }, _log2n{ 0 }, _scaled{ scaled }, _nrThreads{ nrThreads } {
+		if (n == 0 || (n & (n - 1)) != 0) throw transform_size_not_power_of_two{};
+		while ((size_t(1) << _log2n) < n) ++_log2n;
+		_bitrev.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			size_t r = 0;
+			for (size_t b = 0; b < _log2n; ++b) r |= ((i >> b) & 1) << (_log2n - 1 - b);
+			_bitrev[i] = r;
+		}
+		// the twiddles W_2m^j, j < m, of the radix-2 stage with span m start at offset m - 1
+		constexpr double pi = 3.14159265358979323846;
+		_twiddles.resize(n > 1 ? n - 1 : 0);
+		for (size_t m = 1; m < n; m <<= 1) {
+			for (size_t j = 0; j < m; ++j) {
+				double angle = -pi * double(j) / double(m);
+				_twiddles[m - 1 + j] = complex(Scalar(std::cos(angle)), Scalar(std::sin(angle)));
+			}
+		}
+	}
+
+	size_t size() const noexcept { return _n; }
+	bool scaled() const noexcept { return _scaled; }
+
+	// in-place transforms of a single sequence of size() samples
+	void forward(complex* data) const { transform(data, false, _nrThreads); }
+	void inverse(complex* data) const { transform(data, true, _nrThreads); }
+	void forward(std::vector<complex>& data) const { check(data.size()); forward(data.data()); }
+	void inverse(std::vector<complex>& data) const { check(data.size()); inverse(data.data()); }
+
+	// in-place transforms of count sequences of size() samples stored back to back
+	void forward(complex* data, size_t count) const { batch(data, count, false); }
+	void inverse(complex* data, size_t count) const { batch(data, count, true); }
+
+private:
+	// below this size the threads cost more than the butterflies of a pass
+	static constexpr size_t parallelThreshold = 4096;
+
+	size_t               _n;
+	size_t               _log2n;
+	bool                 _scaled;
+	size_t               _nrThreads;
+	std::vector<size_t>  _bitrev;
+	std::vector<complex> _twiddles;
+
+	void check(size_t n) const {
+		if (n != _n) throw dsp_exception("sequence size does not match the size of the transform plan");
+	}
+
+	static complex mul(const complex& a, const complex& w) {
+		return complex(a.real() * w.real() - a.imag() * w.imag(), a.real() * w.imag() + a.imag() * w.real());
+	}
+	// the twiddle of the inverse transform is the conjugate
+	static complex mul(const complex& a, const complex& w, bool inv) {
+		return inv ? complex(a.real() * w.real() + a.imag() * w.imag(), a.imag() * w.real() - a.real() * w.imag()) : mul(a, w);
+	}
+	// multiplication by -i for the forward, and by +i for the inverse transform
+	static complex rotate(const complex& a, bool inv) {
+		return inv ? complex(-a.imag(), a.real()) : complex(a.imag(), -a.real());
+	}
+	static complex half(const complex& a) {
+		const Scalar h(0.5);
+		return complex(a.real() * h, a.imag() * h);
+	}
+
+	void batch(complex* data, size_t count, bool inv) const {
+		if (count > 1 && _nrThreads > 1) {
+			parallel_for(0, count, [&](size_t first, size_t last) {
+				for (size_t b = first; b < last; ++b) transform(data + b * _n, inv, 1);
+			}, _nrThreads);
+		}
+		else {
+			for (size_t b = 0; b < count; ++b) transform(data + b * _n, inv, _nrThreads);
+		}
+	}
+
+	// apply kernel(first, last) to the index range [0, n) of a pass, in parallel for large transforms
+	template<typename Kernel>
+	void sweep(size_t n, size_t nrThreads, Kernel&& kernel) const {
+		if (nrThreads > 1 && _n >= parallelThreshold) {
+			parallel_for(0, n, kernel, nrThreads);
+		}
+		else {
+			kernel(0, n);
+		}
+	}
+
+	void transform(complex* x, bool inv, size_t nrThreads) const {
+		if (_n == 1) return;
+		for (size_t i = 0; i < _n; ++i) {
+			size_t r = _bitrev[i];
+			if (i < r) std::swap(x[i], x[r]);
+		}
+		const bool scale = _scaled && !inv;
+		size_t m = 1;
+		if (_log2n & 1) {
+			// radix-2 pass with span 1: all twiddles are 1
+			sweep(_n / 2, nrThreads, [&](size_t first, size_t last) {
+				for (size_t t = first; t < last; ++t) {
+					complex a = x[2 * t], b = x[2 * t + 1];
+					if (scale) { a = half(a); b = half(b); }
+					x[2 * t] = a + b;
+					x[2 * t + 1] = a - b;
+				}
+			});
+			m = 2;
+		}
+		// radix-4 passes fuse the radix-2 stages with span m and 2m over blocks of 4m samples
+		for (; m < _n; m <<= 2) {
+			const complex* w1 = _twiddles.data() + (m - 1);       // W_2m^j
+			const complex* w2 = _twiddles.data() + (2 * m - 1);   // W_4m^j, and W_4m^(j+m) = -i W_4m^j
+			sweep(_n / 4, nrThreads, [&, m, w1, w2](size_t first, size_t last) {
+				for (size_t t = first; t < last; ++t) {
+					size_t j = t % m;
+					size_t i = (t / m) * 4 * m + j;
+					complex a0 = x[i], a1 = x[i + m], a2 = x[i + 2 * m], a3 = x[i + 3 * m];
+					// first radix-2 stage, span m
+					a1 = mul(a1, w1[j], inv);
+					a3 = mul(a3, w1[j], inv);
+					if (scale) { a0 = half(a0); a1 = half(a1); a2 = half(a2); a3 = half(a3); }
+					complex b0 = a0 + a1, b1 = a0 - a1, b2 = a2 + a3, b3 = a2 - a3;
+					// second radix-2 stage, span 2m
+					b2 = mul(b2, w2[j], inv);
+					b3 = rotate(mul(b3, w2[j], inv), inv);
+					if (scale) { b0 = half(b0); b1 = half(b1); b2 = half(b2); b3 = half(b3); }
+					x[i] = b0 + b2;
+					x[i + m] = b1 + b3;
+					x[i + 2 * m] = b0 - b2;
+					x[i + 3 * m] = b1 - b3;
+				}
+			});
+		}
+		if (inv && !_scaled) {
+			const Scalar scale = Scalar(1.0 / double(_n));
+			for (size_t i = 0; i < _n; ++i) x[i] = complex(x[i].real() * scale, x[i].imag() * scale);
+		}
+	}
+};
+
+/*
+real_fft_plan<Scalar> transforms N real samples into the N/2 + 1 non-redundant bins of their spectrum.
+The even and odd samples are packed into the real and imaginary parts of an N/2-point complex sequence,
+and the spectrum is recovered from its transform with the split twiddles W_N^k, k < N/2, which
+halves the work of a complex transform of the zero-extended samples.
+*/
+template<typename Scalar>
+class real_fft_plan {
+public:
+	using complex = std::complex<Scalar>;
+
+	explicit real_fft_plan(size_t n, bool scaled = false, size_t nrThreads = 1) : _n{ n }, _half(n < 2 ? 1 : n / 2, scaled, nrThreads), _split(n / 2), _work(n / 2) {
+		if (n < 2 || (n & (n - 1)) != 0) throw transform_size_not_power_of_two{};
+		constexpr double pi = 3.14159265358979323846;
+		for (size_t k = 0; k < n / 2; ++k) {
+			double angle = -2.0 * pi * double(k) / double(n);
+			_split[k] = complex(Scalar(std::cos(angle)), Scalar(std::sin(angle)));
+		}
+	}
+
+	size_t size() const noexcept { return _n; }
+	size_t bins() const noexcept { return _n / 2 + 1; }
+
+	// spectrum[0 .. n/2] of the n real samples
+	void forward(const Scalar* samples, complex* spectrum) {
+		const size_t N = _n / 2;
+		for (size_t k = 0; k < N; ++k) _work[k] = complex(samples[2 * k], samples[2 * k + 1]);
+		_half.forward(_work.data());
+		// E[k] and O[k] are half sums, and the scaled spectrum X/2N needs another 1/2 of the Z/N of the scaled complex transform:
+		// the halving is applied before the additions to keep the intermediates in range for fixed-point formats
+		const Scalar h(0.5);
+		const Scalar s = (_half.scaled() ? Scalar(0.25) : h);
+		Scalar z0r = _work[0].real(), z0i = _work[0].imag();
+		if (_half.scaled()) { z0r = z0r * h; z0i = z0i * h; }
+		spectrum[0] = complex(z0r + z0i, Scalar(0));
+		spectrum[N] = complex(z0r - z0i, Scalar(0));
+		for (size_t k = 1; k < N; ++k) {
+			complex z(_work[k].real() * s, _work[k].imag() * s);
+			complex zc(_work[N - k].real() * s, -(_work[N - k].imag() * s));
+			complex e = z + zc;                                          // E[k]
+			complex d = z - zc;
+			complex o(d.imag(), -d.real());                              // O[k] = -i (Z[k] - conj(Z[N-k])) / 2
+			complex w = _split[k];
+			spectrum[k] = complex(e.real() + (w.real() * o.real() - w.imag() * o.imag()), e.imag() + (w.real() * o.imag() + w.imag() * o.real()));
+		}
+	}
+	std::vector<complex> forward(const std::vector<Scalar>& samples) {
+		if (samples.size() != _n) throw dsp_exception("sequence size does not match the size of the transform plan");
+		std::vector<complex> spectrum(bins());
+		forward(samples.data(), spectrum.data());
+		return spectrum;
+	}
+
+	// n real samples from the spectrum[0 .. n/2] of a real sequence
+	void inverse(const complex* spectrum, Scalar* samples) {
+		const size_t N = _n / 2;
+		const Scalar h(0.5);
+		for (size_t k = 0; k < N; ++k) {
+			complex x = spectrum[k], xc = std::conj(spectrum[N - k]);
+			complex e = x + xc;                                          // 2 E[k]
+			complex d = x - xc;
+			complex o(d.real() * _split[k].real() + d.imag() * _split[k].imag(), d.imag() * _split[k].real() - d.real() * _split[k].imag());   // 2 O[k] = (X[k] - conj(X[N-k])) conj(W^k)
+			complex z(e.real() - o.imag(), e.imag() + o.real());       // 2 (E[k] + i O[k])
+			// the scaled inverse omits the 1/N of the complex transform, which compensates the 1/2 of the split
+			if (!_half.scaled()) z = complex(z.real() * h, z.imag() * h);
+			_work[k] = z;
+		}
+		_half.inverse(_work.data());
+		for (size_t k = 0; k < N; ++k) {
+			samples[2 * k] = _work[k].real();
+			samples[2 * k + 1] = _work[k].imag();
+		}
+	}
+	std::vector<Scalar> inverse(const std::vector<complex>& spectrum) {
+		if (spectrum.size() != bins()) throw dsp_exception("spectrum size does not match the size of the transform plan");
+		std::vector<Scalar> samples(_n);
+		inverse(spectrum.data(), samples.data());
+		return samples;
+	}
+
+private:
+	size_t               _n;
+	fft_plan<Scalar>     _half;
+	std::vector<complex> _split;   // W_N^k, k < N/2
+	std::vector<complex> _work;
+};
+
+// convenience functions that build the plan on every call: loops should construct a plan once
+template<typename Scalar>
+std::vector< std::complex<Scalar> > fft(const std::vector< std::complex<Scalar> >& x) {
+	std::vector< std::complex<Scalar> > X(x);
+	fft_plan<Scalar>(x.size()).forward(X);
+	return X;
+}
+template<typename Scalar>
+std::vector< std::complex<Scalar> > ifft(const std::vector< std::complex<Scalar> >& X) {
+	std::vector< std::complex<Scalar> > x(X);
+	fft_plan<Scalar>(X.size()).inverse(x);
+	return x;
+}
+
+}  // namespace sw::universal::dsp
@@ -0,0 +1,69 @@
+#pragma once
+// fir.hpp: streaming finite impulse response filter
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <vector>
+#include <universal/dsp/accumulation.hpp>
+#include <universal/dsp/delay_line.hpp>
+
+namespace sw::universal::dsp {
+
+/*
+fir_filter<Sample, Coeff, Accumulator> computes y[n] = sum_k h[k] * x[n-k] for a stream of samples.
+The taps are stored in the Coeff type, the history of the stream in a delay_line of Samples, and
+each output is accumulated in the Accumulator type and rounded once to a Sample.
+For example:
+	fir_filter< posit<16,1>, posit<16,1>, quire<16,1> >                   exact posit dot products
+	fir_filter< fixpnt<16,15>, fixpnt<16,15>, fixpnt<40,30> >             Q15 taps with 8 guard bits
+*/
+template<typename Sample, typename Coeff = Sample, typename Accumulator = Sample>
+class fir_filter {
+public:
+	using sample_type      = Sample;
+	using coefficient_type = Coeff;
+	using accumulator_type = Accumulator;
+
+	fir_filter() = default;
+	template<typename Real>
+	explicit fir_filter(const std::vector<Real>& taps) : _taps(taps.size()), _delay(taps.size()) {
+		for (size_t k = 0; k < taps.size(); ++k) _taps[k] = Coeff(taps[k]);
+	}
+
+	// filter a single sample
+	Sample operator()(const Sample& x) {
+		push(x);
+		return output();
+	}
+	// filter a block of n samples
+	void process(const Sample* in, Sample* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) {
+			_delay.push(in[i]);
+			out[i] = output();
+		}
+	}
+	std::vector<Sample> process(const std::vector<Sample>& in) {
+		std::vector<Sample> out(in.size());
+		process(in.data(), out.data(), in.size());
+		return out;
+	}
+
+	// insert a sample without computing an output
+	void push(const Sample& x) { _delay.push(x); }
+	// the output for the current history of the filter
+	Sample output() const { return dot<Accumulator>(_taps.data(), _delay.data(), _taps.size()); }
+
+	// clear the history of the filter
+	void reset() { _delay.reset(); }
+
+	size_t size() const noexcept { return _taps.size(); }
+	const std::vector<Coeff>& taps() const noexcept { return _taps; }
+
+private:
+	std::vector<Coeff>   _taps;
+	delay_line<Sample>   _delay;
+};
+
+}  // namespace sw::universal::dsp
@@ -0,0 +1,110 @@
+#pragma once
+// iir.hpp: biquad sections and cascades of biquads
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <vector>
+#include <universal/dsp/accumulation.hpp>
+
+namespace sw::universal::dsp {
+
+/*
+biquad<Sample, Coeff, Accumulator> is the second order section
+
+	         b0 + b1 z^-1 + b2 z^-2
+	H(z) = --------------------------
+	          1 + a1 z^-1 + a2 z^-2
+
+in Direct Form I: y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2].
+The five products are summed in a single Accumulator, so that each output is rounded once.
+Direct Form I keeps the state in the Sample type, which cannot overflow internally
+the way the state of Direct Form II can in fixed-point.
+*/
+template<typename Sample, typename Coeff = Sample, typename Accumulator = Sample>
+class biquad {
+public:
+	using sample_type      = Sample;
+	using coefficient_type = Coeff;
+	using accumulator_type = Accumulator;
+
+	biquad() : biquad(1.0, 0.0, 0.0, 0.0, 0.0) {}
+	biquad(double b0, double b1, double b2, double a1, double a2) {
+		// the feedback coefficients are stored negated so that the section is a single sum of products
+		_h[0] = Coeff(b0); _h[1] = Coeff(b1); _h[2] = Coeff(b2); _h[3] = Coeff(-a1); _h[4] = Coeff(-a2);
+		reset();
+	}
+
+	// filter a single sample
+	Sample operator()(const Sample& x) {
+		_state[0] = x;
+		Sample y = dot<Accumulator>(_h, _state, 5);
+		// shift the history: x[n-2] <- x[n-1] <- x[n], y[n-2] <- y[n-1] <- y[n]
+		_state[2] = _state[1];
+		_state[1] = _state[0];
+		_state[4] = _state[3];
+		_state[3] = y;
+		return y;
+	}
+	// filter a block of n samples, in and out may be the same array
+	void process(const Sample* in, Sample* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) out[i] = operator()(in[i]);
+	}
+
+	void reset() {
+		for (auto& s : _state) s = Sample(0);
+	}
+
+	const Coeff* coefficients() const noexcept { return _h; }
+
+private:
+	Coeff  _h[5];      // b0, b1, b2, -a1, -a2
+	Sample _state[5];  // x[n], x[n-1], x[n-2], y[n-1], y[n-2]
+};
+
+// a cascade of biquad sections: higher order IIR filters are factored into second order sections
+template<typename Sample, typename Coeff = Sample, typename Accumulator = Sample>
+class iir_cascade {
+public:
+	using section = biquad<Sample, Coeff, Accumulator>;
+
+	iir_cascade() = default;
+	explicit iir_cascade(const std::vector<section>& sections) : _sections(sections) {}
+
+	void add(const section& s) { _sections.push_back(s); }
+
+	// filter a single sample
+	Sample operator()(const Sample& x) {
+		Sample y = x;
+		for (auto& s : _sections) y = s(y);
+		return y;
+	}
+	// filter a block of n samples section by section, in and out may be the same array
+	void process(const Sample* in, Sample* out, size_t n) {
+		if (_sections.empty()) {
+			for (size_t i = 0; i < n; ++i) out[i] = in[i];
+			return;
+		}
+		_sections[0].process(in, out, n);
+		for (size_t s = 1; s < _sections.size(); ++s) _sections[s].process(out, out, n);
+	}
+	std::vector<Sample> process(const std::vector<Sample>& in) {
+		std::vector<Sample> out(in.size());
+		process(in.data(), out.data(), in.size());
+		return out;
+	}
+
+	void reset() {
+		for (auto& s : _sections) s.reset();
+	}
+
+	size_t size() const noexcept { return _sections.size(); }
+	section& operator[](size_t i) { return _sections[i]; }
+	const section& operator[](size_t i) const { return _sections[i]; }
+
+private:
+	std::vector<section> _sections;
+};
+
+}  // namespace sw::universal::dsp
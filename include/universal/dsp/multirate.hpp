@@ -0,0 +1,108 @@
+#pragma once
+// multirate.hpp: polyphase decimation and interpolation filters
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <vector>
+#include <universal/dsp/accumulation.hpp>
+#include <universal/dsp/delay_line.hpp>
+
+namespace sw::universal::dsp {
+
+/*
+polyphase_decimator<Sample, Coeff, Accumulator> filters with the N taps h and keeps every M-th output:
+y[m] = sum_k h[k] * x[mM - k]. The polyphase form splits h into the M branches h[kM + p] that each
+run at the output rate. With a single delay line that is the same as evaluating the convolution
+only at the retained instants, which costs N multiply-accumulates per output instead of per input.
+The phase of the decimator carries over between calls, so a stream can be processed in blocks of any size.
+*/
+template<typename Sample, typename Coeff = Sample, typename Accumulator = Sample>
+class polyphase_decimator {
+public:
+	polyphase_decimator() : _factor{ 1 }, _phase{ 0 } {}
+	template<typename Real>
+	polyphase_decimator(const std::vector<Real>& taps, size_t factor) : _taps(taps.size()), _delay(taps.size()), _factor{ factor }, _phase{ 0 } {
+		if (_factor == 0) _factor = 1;
+		for (size_t k = 0; k < taps.size(); ++k) _taps[k] = Coeff(taps[k]);
+	}
+
+	// consume n input samples and write the retained outputs, returns the number of outputs written
+	size_t process(const Sample* in, size_t n, Sample* out) {
+		size_t nrOutputs = 0;
+		for (size_t i = 0; i < n; ++i) {
+			_delay.push(in[i]);
+			if (_phase == 0) out[nrOutputs++] = dot<Accumulator>(_taps.data(), _delay.data(), _taps.size());
+			if (++_phase == _factor) _phase = 0;
+		}
+		return nrOutputs;
+	}
+	std::vector<Sample> process(const std::vector<Sample>& in) {
+		std::vector<Sample> out((in.size() + _factor - 1) / _factor + 1);
+		out.resize(process(in.data(), in.size(), out.data()));
+		return out;
+	}
+
+	void reset() {
+		_delay.reset();
+		_phase = 0;
+	}
+
+	size_t size() const noexcept { return _taps.size(); }
+	size_t factor() const noexcept { return _factor; }
+
+private:
+	std::vector<Coeff>   _taps;
+	delay_line<Sample>   _delay;
+	size_t               _factor;
+	size_t               _phase;   // number of inputs consumed since the last output
+};
+
+/*
+polyphase_interpolator<Sample, Coeff, Accumulator> inserts L-1 zeros between the input samples and
+filters with the N taps h. The products with the inserted zeros are skipped by the polyphase form:
+output p of the L outputs of an input sample is the convolution of the input with the branch h[kL + p],
+y[nL + p] = sum_k h[kL + p] * x[n - k]. All branches share one delay line of ceil(N/L) samples.
+Zero stuffing scales the passband by 1/L, so the taps of an interpolator typically have a DC gain of L.
+*/
+template<typename Sample, typename Coeff = Sample, typename Accumulator = Sample>
+class polyphase_interpolator {
+public:
+	polyphase_interpolator() : _factor{ 1 } {}
+	template<typename Real>
+	polyphase_interpolator(const std::vector<Real>& taps, size_t factor) : _factor{ factor } {
+		if (_factor == 0) _factor = 1;
+		_branches.resize(_factor);
+		for (size_t p = 0; p < _factor; ++p) {
+			for (size_t k = p; k < taps.size(); k += _factor) _branches[p].push_back(Coeff(taps[k]));
+		}
+		_delay = delay_line<Sample>(_branches[0].size());
+	}
+
+	// consume n input samples and write the n * factor() outputs
+	void process(const Sample* in, size_t n, Sample* out) {
+		for (size_t i = 0; i < n; ++i) {
+			_delay.push(in[i]);
+			for (size_t p = 0; p < _factor; ++p) {
+				*out++ = dot<Accumulator>(_branches[p].data(), _delay.data(), _branches[p].size());
+			}
+		}
+	}
+	std::vector<Sample> process(const std::vector<Sample>& in) {
+		std::vector<Sample> out(in.size() * _factor);
+		process(in.data(), in.size(), out.data());
+		return out;
+	}
+
+	void reset() { _delay.reset(); }
+
+	size_t factor() const noexcept { return _factor; }
+
+private:
+	std::vector< std::vector<Coeff> > _branches;   // branch p holds h[p], h[p + L], h[p + 2L], ...
+	delay_line<Sample>                _delay;
+	size_t                            _factor;
+};
+
+}  // namespace sw::universal::dsp
@@ -4,6 +4,8 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/math/stub/fma.hpp>
+
 namespace sw {
 namespace function {
 
@@ -64,10 +66,10 @@ void ddpoly(const Scalar& x, const Vector& c, Vector& pd) {
 	for (int i = N-1; i >= 0; --i) {
 		int nnd = (ND < (N - i) ? ND : N - i);
 		for (int j = nnd; j >= 1; --j) {
-			pd[j] = pd[j] * x + pd[j - 1];
+			pd[j] = sw::universal::multiply_add(pd[j], x, pd[j - 1]);
 			//std::cout << "pd[" << j << "] = " << pd[j] << std::endl;
 		}
-		pd[0] = pd[0] * x + c[i];
+		pd[0] = sw::universal::multiply_add(pd[0], x, c[i]);
 	}
 	// after the first derivative, factorial constants come in
 	Scalar cnst(1);
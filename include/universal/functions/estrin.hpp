@@ -0,0 +1,77 @@
+#pragma once
+// estrin.hpp: Horner and Estrin evaluation of polynomials
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <universal/math/stub/fma.hpp>
+
+namespace sw::function {
+
+/*
+	p(x) = c0 + c1*x + c2*x^2 + ... + cn*x^n
+
+	Horner:  p = c0 + x*(c1 + x*(c2 + ... + x*cn))
+	         n dependent multiply-adds: the latency of the evaluation is n times the latency of a multiply-add
+
+	Estrin:  p = (c0 + c1*x) + x^2*(c2 + c3*x) + x^4*((c4 + c5*x) + x^2*(c6 + c7*x)) + ...
+	         the pairs at every level are independent: ceil(log2(n+1)) levels of multiply-adds
+	         that the processor can overlap, at the cost of the squarings of x
+
+Both evaluate with multiply_add(), which rounds once for the number systems that provide an fma.
+*/
+
+// evaluate the polynomial with coefficients c[0..n] at x with Horner's rule
+template<typename Vector, typename Scalar>
+Scalar horner(const Vector& c, const Scalar& x) {
+	size_t n = c.size();
+	if (n == 0) return Scalar(0);
+	Scalar p = c[n - 1];
+	for (size_t j = n - 1; j > 0; --j) p = sw::universal::multiply_add(p, x, Scalar(c[j - 1]));
+	return p;
+}
+
+namespace support {
+	// reduce the n partial sums in t with the powers x^2, x^4, x^8, ...
+	template<typename Buffer, typename Scalar>
+	Scalar estrin_reduce(Buffer& t, size_t n, const Scalar& x) {
+		Scalar xx = x * x;
+		while (n > 1) {
+			size_t half = n / 2;
+			for (size_t i = 0; i < half; ++i) t[i] = sw::universal::multiply_add(t[2 * i + 1], xx, t[2 * i]);
+			if (n & 1) t[half] = t[n - 1];
+			n = (n + 1) / 2;
+			if (n > 1) xx = xx * xx;
+		}
+		return t[0];
+	}
+}
+
+// evaluate the polynomial with coefficients c[0..N-1] at x with Estrin's scheme
+template<typename Scalar, size_t N>
+Scalar estrin(const std::array<Scalar, N>& c, const Scalar& x) {
+	if constexpr (N == 0) {
+		return Scalar(0);
+	}
+	else {
+		std::array<Scalar, (N + 1) / 2> t;
+		for (size_t i = 0; i < N / 2; ++i) t[i] = sw::universal::multiply_add(c[2 * i + 1], x, c[2 * i]);
+		if constexpr ((N & 1) != 0) t[N / 2] = c[N - 1];
+		return support::estrin_reduce(t, (N + 1) / 2, x);
+	}
+}
+
+template<typename Scalar>
+Scalar estrin(const std::vector<Scalar>& c, const Scalar& x) {
+	size_t n = c.size();
+	if (n == 0) return Scalar(0);
+	std::vector<Scalar> t((n + 1) / 2);
+	for (size_t i = 0; i < n / 2; ++i) t[i] = sw::universal::multiply_add(c[2 * i + 1], x, c[2 * i]);
+	if (n & 1) t[n / 2] = c[n - 1];
+	return support::estrin_reduce(t, (n + 1) / 2, x);
+}
+
+}  // namespace sw::function
@@ -13,3 +13,7 @@
 #include "factorial.hpp"
 #include "binomial.hpp"
 #include "loss.hpp"
+
+// polynomial evaluation and approximation
+#include "estrin.hpp"
+#include "minimax.hpp"
@@ -0,0 +1,436 @@
+#pragma once
+// minimax.hpp: generator of polynomial approximation kernels with coefficient tables rounded to a target number system
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ios>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <universal/functions/estrin.hpp>
+
+namespace sw::function {
+
+/*
+The elementary functions of a number system are evaluated as an argument reduction to a small interval
+[a, b], a polynomial on that interval, and a reconstruction. This file generates the polynomials.
+
+The generator works in a Real type with more precision than the target, long double by default
+or dd_real for the wide formats, on a function object that evaluates f in Real:
+  - chebyshev_approximation<Degree>(f, a, b) interpolates f at the Chebyshev nodes, which is within
+    a small factor of the best approximation and needs no iteration
+  - minimax_approximation<Degree>(f, a, b) runs the Remez exchange algorithm to the polynomial
+    with the smallest largest absolute or relative error, which equioscillates at Degree + 2 points
+The polynomials are returned in powers of (x - center), center = (a + b) / 2, so that the evaluation
+needs no scaling of the argument, and the fit is solved in the variable t = (x - center) / ((b - a) / 2)
+on [-1, 1], which keeps the linear systems of the Remez algorithm well conditioned.
+
+minimax_kernel<Scalar, Degree>(f, a, b) produces the coefficient table of a target format. Rounding the
+coefficients of the best polynomial one by one is not the best polynomial with coefficients in the format,
+so the kernel fixes the coefficients from the constant term up, each time rounding the next coefficient
+and refitting the remaining ones to absorb its rounding error. The kernel evaluates with Estrin's scheme.
+
+emit() prints the table as C++ source with hexadecimal floating-point literals of the rounded coefficients,
+so that a math library can be built from tables generated offline: the values convert exactly back into
+any target format whose values are representable in double.
+*/
+
+enum class approximation_error { absolute, relative };
+
+// a polynomial p(x) = sum_j c[j] (x - center)^j in the generator precision
+template<size_t Degree, typename Real = long double>
+struct polynomial_approximation {
+	Real a, b;                                   // interval of the approximation
+	Real center;
+	std::array<Real, Degree + 1> coefficients;
+	Real error;                                  // largest absolute or relative error on [a, b]
+	approximation_error kind;
+
+	Real operator()(const Real& x) const { return horner(coefficients, Real(x - center)); }
+};
+
+// a polynomial p(x) = sum_j c[j] (x - center)^j with coefficients in the target format
+template<typename Scalar, size_t Degree>
+struct polynomial_kernel {
+	static constexpr size_t degree = Degree;
+	Scalar center;
+	bool   centered;                             // false when the center is 0, which skips the subtraction
+	std::array<Scalar, Degree + 1> coefficients;
+
+	Scalar operator()(const Scalar& x) const { return estrin(coefficients, centered ? Scalar(x - center) : x); }
+	Scalar horner(const Scalar& x) const { return sw::function::horner(coefficients, centered ? Scalar(x - center) : x); }
+
+	// load a table produced by emit()
+	static polynomial_kernel from_table(double center, const double (&table)[Degree + 1]) {
+		polynomial_kernel k;
+		k.center = Scalar(center);
+		k.centered = (center != 0.0);
+		for (size_t j = 0; j <= Degree; ++j) k.coefficients[j] = Scalar(table[j]);
+		return k;
+	}
+};
+
+namespace support {
+
+	template<typename Real>
+	Real pi() { return Real(3.141592653589793238462643383279502884L); }
+
+	template<typename Real>
+	Real magnitude(const Real& v) { return (v < Real(0) ? Real(-v) : v); }
+
+	// a value of the target format in the generator precision
+	template<typename Real, typename Scalar>
+	Real widen(const Scalar& v) {
+		if constexpr (std::is_constructible_v<Real, Scalar>) return Real(v); else return Real((long double)(v));
+	}
+
+	// v rounded to the nearest value of the target format. The number systems do not all convert from
+	// a Real wider than double, and the conversion through double rounds twice: that result is at most
+	// one step away from the nearest value, so the nearest is found among it and its two neighbours
+	template<typename Scalar, typename Real>
+	Scalar round_to(const Real& v) {
+		if constexpr (std::is_floating_point_v<Scalar>) {
+			return Scalar(v);
+		}
+		else {
+			Scalar nearest = Scalar(double(v));
+			Scalar below(nearest), above(nearest);
+			--below;
+			++above;
+			Real distance = magnitude(Real(widen<Real>(nearest) - v));
+			for (const Scalar& candidate : { below, above }) {
+				Real d = magnitude(Real(widen<Real>(candidate) - v));
+				if (d < distance) {
+					distance = d;
+					nearest = candidate;
+				}
+			}
+			return nearest;
+		}
+	}
+
+	template<typename Real>
+	Real power(const Real& t, size_t p) {
+		Real r(1);
+		for (size_t i = 0; i < p; ++i) r *= t;
+		return r;
+	}
+
+	// solve A x = b in place with partial pivoting, returns false for a singular system
+	template<typename Real>
+	bool solve(std::vector< std::vector<Real> >& A, std::vector<Real>& b) {
+		size_t n = b.size();
+		for (size_t k = 0; k < n; ++k) {
+			size_t pivot = k;
+			for (size_t i = k + 1; i < n; ++i) if (magnitude(A[i][k]) > magnitude(A[pivot][k])) pivot = i;
+			if (A[pivot][k] == Real(0)) return false;
+			std::swap(A[k], A[pivot]);
+			std::swap(b[k], b[pivot]);
+			for (size_t i = k + 1; i < n; ++i) {
+				Real factor = A[i][k] / A[k][k];
+				for (size_t j = k; j < n; ++j) A[i][j] -= factor * A[k][j];
+				b[i] -= factor * b[k];
+			}
+		}
+		for (size_t k = n; k-- > 0; ) {
+			Real sum = b[k];
+			for (size_t j = k + 1; j < n; ++j) sum -= A[k][j] * b[j];
+			b[k] = sum / A[k][k];
+		}
+		return true;
+	}
+
+	// K + 1 points on [-1, 1] clustered towards the end points like the Chebyshev extrema
+	template<typename Real>
+	std::vector<Real> chebyshev_grid(size_t K) {
+		using std::cos;
+		std::vector<Real> grid(K + 1);
+		for (size_t k = 0; k <= K; ++k) grid[k] = Real(-cos(pi<Real>() * Real(double(k)) / Real(double(K))));
+		grid[0] = Real(-1);
+		grid[K] = Real(1);
+		return grid;
+	}
+
+	// the weighted error (sum_j c[j] t^powers[j] - g(t)) * w(t) of the free part of a fit
+	template<typename Real, typename Target, typename Weight>
+	Real weighted_error(const Target& g, const Weight& w, const std::vector<size_t>& powers, const std::vector<Real>& c, const Real& t) {
+		Real p(0);
+		for (size_t j = 0; j < powers.size(); ++j) p += c[j] * power(t, powers[j]);
+		return (p - g(t)) * w(t);
+	}
+
+	/*
+	Remez exchange: fit g(t) on [-1, 1] with the monomials t^powers[j] such that the weighted error
+	equioscillates at powers.size() + 1 points. Every iteration solves for the coefficients and the
+	levelled error E on the reference, then replaces the reference by the alternating extrema of the
+	error, located on a dense grid and refined by golden section search.
+	Returns the largest weighted error of the best iterate, or a negative value when no system could be solved.
+	*/
+	template<typename Real, typename Target, typename Weight>
+	Real remez(const Target& g, const Weight& w, const std::vector<size_t>& powers, std::vector<Real>& c, size_t maxIterations) {
+		using std::cos;
+		const size_t nf = powers.size();
+		const size_t m = nf + 1;
+		c.assign(nf, Real(0));
+		const std::vector<Real> grid = chebyshev_grid<Real>(64 * m < 1024 ? 1024 : 64 * m);
+		auto error = [&](const Real& t) { return weighted_error(g, w, powers, c, t); };
+		if (nf == 0) {
+			Real maxError(0);
+			for (const Real& t : grid) { Real e = magnitude(error(t)); if (e > maxError) maxError = e; }
+			return maxError;
+		}
+
+		std::vector<Real> reference(m);
+		for (size_t i = 0; i < m; ++i) reference[i] = Real(-cos(pi<Real>() * Real(double(i)) / Real(double(m - 1))));
+		Real maxError(-1);
+		std::vector<Real> best;
+		for (size_t iteration = 0; iteration < maxIterations; ++iteration) {
+			std::vector< std::vector<Real> > A(m, std::vector<Real>(m));
+			std::vector<Real> rhs(m);
+			for (size_t i = 0; i < m; ++i) {
+				for (size_t j = 0; j < nf; ++j) A[i][j] = power(reference[i], powers[j]);
+				A[i][nf] = Real((i & 1) ? -1 : 1) / w(reference[i]);
+				rhs[i] = g(reference[i]);
+			}
+			if (!solve(A, rhs)) break;
+			for (size_t j = 0; j < nf; ++j) c[j] = rhs[j];
+
+			// one extremum per run of equal sign of the error on the grid
+			std::vector<size_t> extrema;
+			std::vector<Real> values(grid.size());
+			Real gridError(0);
+			for (size_t k = 0; k < grid.size(); ++k) {
+				values[k] = error(grid[k]);
+				if (magnitude(values[k]) > gridError) gridError = magnitude(values[k]);
+			}
+			// close to the precision of Real the exchange stops improving: keep the best iterate
+			if (maxError < Real(0) || gridError < maxError) {
+				maxError = gridError;
+				best = c;
+			}
+			for (size_t k = 0; k < grid.size(); ++k) {
+				bool positive = !(values[k] < Real(0));
+				if (extrema.empty() || (!(values[extrema.back()] < Real(0))) != positive) {
+					extrema.push_back(k);
+				}
+				else if (magnitude(values[k]) > magnitude(values[extrema.back()])) {
+					extrema.back() = k;
+				}
+			}
+			if (extrema.size() < m) break;
+			// drop the smaller end extremum until the reference has m points: the signs keep alternating
+			size_t first = 0, last = extrema.size();
+			while (last - first > m) {
+				if (magnitude(values[extrema[first]]) < magnitude(values[extrema[last - 1]])) ++first; else --last;
+			}
+			// refine the extrema between their grid neighbours
+			Real largest(0), smallest(-1);
+			for (size_t i = 0; i < m; ++i) {
+				size_t k = extrema[first + i];
+				Real t = grid[k];
+				if (k > 0 && k + 1 < grid.size()) {
+					const Real ratio = Real(0.6180339887498948482);
+					Real lo = grid[k - 1], hi = grid[k + 1];
+					for (int step = 0; step < 40; ++step) {
+						Real t1 = hi - ratio * (hi - lo), t2 = lo + ratio * (hi - lo);
+						if (magnitude(error(t1)) > magnitude(error(t2))) hi = t2; else lo = t1;
+					}
+					Real candidate = (lo + hi) / Real(2);
+					if (magnitude(error(candidate)) > magnitude(values[k])) t = candidate;
+				}
+				reference[i] = t;
+				Real e = magnitude(error(t));
+				if (e > largest) largest = e;
+				if (smallest < Real(0) || e < smallest) smallest = e;
+			}
+			// converged when the extrema are levelled
+			if (largest - smallest <= largest * Real(1.0e-6)) break;
+		}
+		if (best.empty()) return Real(-1);
+		c = best;
+		return maxError;
+	}
+
+	// coefficients in t = (x - center) / halfWidth to coefficients in (x - center)
+	template<size_t Degree, typename Real>
+	void rescale(std::array<Real, Degree + 1>& c, const Real& halfWidth) {
+		Real scale(1);
+		for (size_t j = 0; j <= Degree; ++j) {
+			c[j] /= scale;
+			scale *= halfWidth;
+		}
+	}
+
+	template<size_t Degree, typename Real, typename Function>
+	Real measure(const Function& f, const polynomial_approximation<Degree, Real>& p) {
+		Real halfWidth = (p.b - p.a) / Real(2);
+		Real maxError(0);
+		for (const Real& t : chebyshev_grid<Real>(4096)) {
+			Real x = p.center + halfWidth * t;
+			Real fx = f(x);
+			Real e = magnitude(Real(p(x) - fx));
+			if (p.kind == approximation_error::relative && fx != Real(0)) e /= magnitude(fx);
+			if (e > maxError) maxError = e;
+		}
+		return maxError;
+	}
+}
+
+// interpolant of f at the Degree + 1 Chebyshev nodes of the first kind on [a, b]
+template<size_t Degree, typename Real = long double, typename Function>
+polynomial_approximation<Degree, Real> chebyshev_approximation(const Function& f, Real a, Real b, approximation_error kind = approximation_error::relative) {
+	using std::cos;
+	constexpr size_t n = Degree + 1;
+	polynomial_approximation<Degree, Real> p;
+	p.a = a; p.b = b; p.kind = kind;
+	p.center = (a + b) / Real(2);
+	Real halfWidth = (b - a) / Real(2);
+	// Chebyshev series coefficients from the function values at the nodes
+	std::array<Real, n> fx, series;
+	for (size_t k = 0; k < n; ++k) {
+		Real t = cos(support::pi<Real>() * (Real(double(k)) + Real(0.5)) / Real(double(n)));
+		fx[k] = f(Real(p.center + halfWidth * t));
+	}
+	for (size_t j = 0; j < n; ++j) {
+		Real sum(0);
+		for (size_t k = 0; k < n; ++k) sum += fx[k] * cos(support::pi<Real>() * Real(double(j)) * (Real(double(k)) + Real(0.5)) / Real(double(n)));
+		series[j] = Real(2) * sum / Real(double(n));
+	}
+	series[0] /= Real(2);
+	// sum_j series[j] T_j(t) in monomials of t, with T_j+1 = 2t T_j - T_j-1
+	std::array<Real, n> Tprev{}, T{}, Tnext{};
+	p.coefficients.fill(Real(0));
+	Tprev[0] = Real(1);                         // T_0
+	p.coefficients[0] = series[0];
+	if constexpr (n > 1) {
+		T[1] = Real(1);                         // T_1
+		p.coefficients[1] += series[1];
+		for (size_t j = 2; j < n; ++j) {
+			for (size_t i = 0; i < n; ++i) Tnext[i] = (i > 0 ? Real(2) * T[i - 1] : Real(0)) - Tprev[i];
+			for (size_t i = 0; i < n; ++i) p.coefficients[i] += series[j] * Tnext[i];
+			Tprev = T;
+			T = Tnext;
+		}
+	}
+	support::rescale<Degree>(p.coefficients, halfWidth);
+	p.error = support::measure(f, p);
+	return p;
+}
+
+// best polynomial approximation of degree Degree of f on [a, b] in the absolute or relative error
+template<size_t Degree, typename Real = long double, typename Function>
+polynomial_approximation<Degree, Real> minimax_approximation(const Function& f, Real a, Real b, approximation_error kind = approximation_error::relative, size_t maxIterations = 40) {
+	polynomial_approximation<Degree, Real> p;
+	p.a = a; p.b = b; p.kind = kind;
+	p.center = (a + b) / Real(2);
+	Real halfWidth = (b - a) / Real(2);
+	auto g = [&](const Real& t) { return f(Real(p.center + halfWidth * t)); };
+	auto w = [&](const Real& t) {
+		if (kind == approximation_error::absolute) return Real(1);
+		Real fx = support::magnitude(g(t));
+		return (fx == Real(0) ? Real(1) : Real(Real(1) / fx));
+	};
+	std::vector<size_t> powers(Degree + 1);
+	for (size_t j = 0; j <= Degree; ++j) powers[j] = j;
+	std::vector<Real> c;
+	polynomial_approximation<Degree, Real> cheby = chebyshev_approximation<Degree, Real>(f, a, b, kind);
+	if (support::remez<Real>(g, w, powers, c, maxIterations) < Real(0)) return cheby;
+	for (size_t j = 0; j <= Degree; ++j) p.coefficients[j] = c[j];
+	support::rescale<Degree>(p.coefficients, halfWidth);
+	p.error = support::measure(f, p);
+	// when the error approaches the precision of Real, rounding noise can defeat the exchange
+	return (p.error <= cheby.error ? p : cheby);
+}
+
+// the coefficients of p rounded to the target format
+template<typename Scalar, size_t Degree, typename Real>
+polynomial_kernel<Scalar, Degree> round_coefficients(const polynomial_approximation<Degree, Real>& p) {
+	polynomial_kernel<Scalar, Degree> k;
+	k.center = support::round_to<Scalar>(p.center);
+	k.centered = (p.center != Real(0));
+	for (size_t j = 0; j <= Degree; ++j) k.coefficients[j] = support::round_to<Scalar>(p.coefficients[j]);
+	return k;
+}
+
+// the polynomial of the kernel in the generator precision
+template<typename Real, typename Scalar, size_t Degree>
+polynomial_approximation<Degree, Real> to_approximation(const polynomial_kernel<Scalar, Degree>& k, Real a, Real b, approximation_error kind) {
+	polynomial_approximation<Degree, Real> p;
+	p.a = a; p.b = b; p.kind = kind;
+	p.center = support::widen<Real>(k.center);
+	for (size_t j = 0; j <= Degree; ++j) p.coefficients[j] = support::widen<Real>(k.coefficients[j]);
+	p.error = Real(0);
+	return p;
+}
+
+// a minimax kernel of f on [a, b] with coefficients in the target format
+template<typename Scalar, size_t Degree, typename Real = long double, typename Function>
+polynomial_kernel<Scalar, Degree> minimax_kernel(const Function& f, Real a, Real b, approximation_error kind = approximation_error::relative, size_t maxIterations = 40) {
+	polynomial_approximation<Degree, Real> best = minimax_approximation<Degree, Real>(f, a, b, kind, maxIterations);
+	polynomial_kernel<Scalar, Degree> rounded = round_coefficients<Scalar>(best);
+	Real roundedError = support::measure(f, to_approximation<Real>(rounded, a, b, kind));
+
+	// fix the coefficients from the constant term up, refitting the higher ones after every rounding
+	polynomial_kernel<Scalar, Degree> refit = rounded;
+	Real center = support::widen<Real>(rounded.center);     // the kernel subtracts the rounded center
+	Real halfWidth = (b - a) / Real(2);
+	std::array<Real, Degree + 1> c = best.coefficients;
+	for (size_t fixed = 1; fixed <= Degree; ++fixed) {
+		// the rounded coefficients c[0 .. fixed-1] in powers of t: the free part fits the residual of f
+		std::array<Real, Degree + 1> fixedT{};
+		Real scale(1);
+		for (size_t j = 0; j < fixed; ++j) {
+			fixedT[j] = support::widen<Real>(refit.coefficients[j]) * scale;
+			scale *= halfWidth;
+		}
+		auto g = [&](const Real& t) {
+			Real x = center + halfWidth * t;
+			Real r = f(x);
+			Real tt(1);
+			for (size_t j = 0; j < fixed; ++j) { r -= fixedT[j] * tt; tt *= t; }
+			return r;
+		};
+		auto w = [&](const Real& t) {
+			if (kind == approximation_error::absolute) return Real(1);
+			Real fx = support::magnitude(f(Real(center + halfWidth * t)));
+			return (fx == Real(0) ? Real(1) : Real(Real(1) / fx));
+		};
+		std::vector<size_t> powers;
+		for (size_t j = fixed; j <= Degree; ++j) powers.push_back(j);
+		std::vector<Real> free;
+		if (support::remez<Real>(g, w, powers, free, maxIterations) < Real(0)) break;
+		Real s(1);
+		for (size_t j = 0; j < fixed; ++j) s *= halfWidth;
+		for (size_t j = fixed; j <= Degree; ++j) {
+			c[j] = free[j - fixed] / s;
+			s *= halfWidth;
+		}
+		for (size_t j = fixed; j <= Degree; ++j) refit.coefficients[j] = support::round_to<Scalar>(c[j]);
+	}
+	Real refitError = support::measure(f, to_approximation<Real>(refit, a, b, kind));
+	return (refitError < roundedError ? refit : rounded);
+}
+
+// print the kernel as C++ source that from_table() loads
+template<typename Scalar, size_t Degree>
+void emit(std::ostream& ostr, const std::string& name, const polynomial_kernel<Scalar, Degree>& k, const std::string& description = "") {
+	std::ios_base::fmtflags flags = ostr.flags();
+	if (!description.empty()) ostr << "// " << description << '\n';
+	ostr << "// p(x) = sum_j " << name << "_coefficients[j] * (x - " << name << "_center)^j\n";
+	ostr << "constexpr double " << name << "_center = " << std::hexfloat << double(k.center) << ";\n";
+	ostr << "constexpr double " << name << "_coefficients[" << Degree + 1 << "] = {\n";
+	for (size_t j = 0; j <= Degree; ++j) {
+		ostr << '\t' << std::hexfloat << double(k.coefficients[j]) << (j < Degree ? "," : " ");
+		ostr << std::defaultfloat << std::setprecision(17) << "   // c" << j << " = " << double(k.coefficients[j]) << '\n';
+	}
+	ostr << "};\n";
+	ostr.flags(flags);
+}
+
+}  // namespace sw::function
@@ -274,18 +274,14 @@ public:
 				for (size_t i = 0; i <= MSU - blockShift; ++i) {
 					_block[i] = _block[i + blockShift];
 				}
-			}
-			// adjust the shift
-			bitsToShift -= static_cast<int>(blockShift * bitsInBlock);
-			if (bitsToShift == 0) {
 				// clean up the blocks we have shifted clean
-				bitsToShift += static_cast<int>(blockShift * bitsInBlock);
-				for (size_t i = nbits - bitsToShift; i < nbits; ++i) {
-					this->setbit(i, false); // reset
+				for (size_t i = MSU - blockShift + 1; i <= MSU; ++i) {
+					_block[i] = bt(0);
 				}
-
-				return *this;
 			}
+			// adjust the shift
+			bitsToShift -= static_cast<int>(blockShift * bitsInBlock);
+			if (bitsToShift == 0) return *this;
 		}
 		if constexpr (MSU > 0) {
 			bt mask = ALL_ONES;
@@ -297,13 +293,7 @@ public:
 				_block[i] |= (bits << (bitsInBlock - bitsToShift));
 			}
 		}
-		_block[MSU] >>= bitsToShift;
-
-		// clean up the blocks we have shifted clean
-		bitsToShift += static_cast<int>(blockShift * bitsInBlock);
-		for (size_t i = nbits - bitsToShift; i < nbits; ++i) {
-			this->setbit(i, false); // reset
-		}
+		_block[MSU] >>= bitsToShift; // the logical shift fills the vacated upper bits with zeros
 
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
 		_block[MSU] &= MSU_MASK;
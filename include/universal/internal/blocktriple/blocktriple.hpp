@@ -263,6 +263,79 @@ public:
 		}
 	}
 
+	/// <summary>
+	/// multiply two real numbers yielding an exact, unrounded product
+	/// As with add, the storage requirements are pushed to the calling environment: the
+	/// significants of the arguments are right-aligned, 0...01.ffff with radix fraction bits,
+	/// and nbits must be at least 2 * radix + 1 so that the product of the significants,
+	/// which has its radix point at 2 * radix, is exact. The product is normalized to the
+	/// form 01.ffff with the radix point at nbits.
+	/// </summary>
+	/// <param name="lhs">blocktriple with a right-aligned significant</param>
+	/// <param name="rhs">blocktriple with a right-aligned significant</param>
+	/// <param name="radix">number of fraction bits of the arguments</param>
+	void mul(const blocktriple<nbits, bt>& lhs, const blocktriple<nbits, bt>& rhs, int radix) {
+		_nan = false;
+		_inf = false;
+		_zero = false;
+		_sign = (lhs._sign != rhs._sign);
+		_significant.mul(lhs._significant, rhs._significant);
+		// the product of two significants in [1, 2) lies in [1, 4): its msb is at 2 * radix or 2 * radix + 1
+		int msb = _significant.msb();
+		_scale = lhs._scale + rhs._scale + (msb - 2 * radix);
+		_significant <<= static_cast<int>(nbits) - msb;
+
+		if constexpr (_trace_btriple_mul) {
+			std::cout << "blocktriple normalized mul\n";
+			std::cout << "lhs : " << to_binary(lhs) << " : " << lhs << '\n';
+			std::cout << "rhs : " << to_binary(rhs) << " : " << rhs << '\n';
+			std::cout << "mul : " << to_binary(*this) << " : " << *this << '\n';
+		}
+	}
+
+	/// <summary>
+	/// divide two real numbers yielding an unrounded quotient
+	/// The arguments are normalized to the form 01.ffff with the radix point at nbits.
+	/// The quotient is developed to nbits fraction bits with a restoring division, and a
+	/// non-zero remainder is jammed into the least significant bit, so that the quotient
+	/// rounds, or truncates, correctly to any precision with fewer than nbits - 1 fraction bits.
+	/// </summary>
+	/// <param name="lhs">dividend in the form 01.ffff</param>
+	/// <param name="rhs">divisor in the form 01.ffff</param>
+	void div(const blocktriple<nbits, bt>& lhs, const blocktriple<nbits, bt>& rhs) {
+		_nan = false;
+		_inf = false;
+		_zero = false;
+		_sign = (lhs._sign != rhs._sign);
+		_scale = lhs._scale - rhs._scale;
+		Frac remainder(lhs._significant), divisor(rhs._significant), difference;
+		divisor.twosComplement(); // trial subtractions become additions
+		// with a significant of the dividend smaller than the divisor, the quotient starts one position lower
+		difference.add(remainder, divisor);
+		if (difference.test(bfbits - 1)) {
+			remainder <<= 1;
+			--_scale;
+		}
+		_significant.clear();
+		for (int i = static_cast<int>(nbits); i >= 0; --i) {
+			// the remainder stays below twice the divisor, and thus below 2^(nbits + 2), which keeps the sign bit free
+			difference.add(remainder, divisor);
+			if (!difference.test(bfbits - 1)) {
+				remainder = difference;
+				_significant.setbit(static_cast<size_t>(i));
+			}
+			remainder <<= 1;
+		}
+		if (!remainder.iszero()) _significant.setbit(0);
+
+		if constexpr (_trace_btriple_div) {
+			std::cout << "blocktriple normalized div\n";
+			std::cout << "lhs : " << to_binary(lhs) << " : " << lhs << '\n';
+			std::cout << "rhs : " << to_binary(rhs) << " : " << rhs << '\n';
+			std::cout << "div : " << to_binary(*this) << " : " << *this << '\n';
+		}
+	}
+
 private:
 	// special cases to keep track of
 	bool _nan; // most dominant state
@@ -11,6 +11,7 @@
 #include <universal/math/stub/complex.hpp>
 #include <universal/math/stub/error_and_gamma.hpp>
 #include <universal/math/stub/exponent.hpp>
+#include <universal/math/stub/fma.hpp>
 #include <universal/math/stub/fractional.hpp>
 #include <universal/math/stub/hyperbolic.hpp>
 #include <universal/math/stub/hypot.hpp>
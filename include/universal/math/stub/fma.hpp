@@ -0,0 +1,55 @@
+#pragma once
+// fma.hpp: templated fused multiply-add function stub for native floating-point
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+/*
+Computes (x * y) + z as if to infinite precision and rounded only once to fit the result type.
+
+The number systems of the library provide their own fma overloads in the sw::universal namespace,
+which are found through argument dependent lookup.
+*/
+
+namespace sw::universal {
+
+	template<typename Scalar,
+		typename = typename std::enable_if<std::is_floating_point<Scalar>::value>::type>
+		Scalar fma(Scalar x, Scalar y, Scalar z) {
+		return std::fma(x, y, z);
+	}
+
+	// has_fused_multiply_add<Scalar>::value is true when multiply_add() evaluates with a single rounding:
+	// the number systems that provide an fma, and the native types with a hardware fma instruction,
+	// as a software std::fma is much slower than a multiply followed by an add
+	template<typename Scalar, typename = void>
+	struct has_fused_multiply_add : std::false_type {};
+	template<typename Scalar>
+	struct has_fused_multiply_add<Scalar, std::void_t<decltype(fma(std::declval<Scalar>(), std::declval<Scalar>(), std::declval<Scalar>()))>>
+		: std::bool_constant<!std::is_floating_point<Scalar>::value> {};
+#ifdef FP_FAST_FMAF
+	template<> struct has_fused_multiply_add<float> : std::true_type {};
+#endif
+#ifdef FP_FAST_FMA
+	template<> struct has_fused_multiply_add<double> : std::true_type {};
+#endif
+#ifdef FP_FAST_FMAL
+	template<> struct has_fused_multiply_add<long double> : std::true_type {};
+#endif
+
+	// multiply_add(a, b, c) = a * b + c, fused when the number system supports it
+	template<typename Scalar>
+	inline Scalar multiply_add(const Scalar& a, const Scalar& b, const Scalar& c) {
+		if constexpr (has_fused_multiply_add<Scalar>::value) {
+			return fma(a, b, c);
+		}
+		else {
+			return a * b + c;
+		}
+	}
+
+}  // namespace sw::universal
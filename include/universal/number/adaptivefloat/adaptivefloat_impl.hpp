@@ -4,15 +4,22 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cctype>
+#include <cmath>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
-#include <regex>
 #include <vector>
-#include <map>
+#include <limits>
+#include <algorithm>
 
 #include <universal/number/adaptivefloat/exceptions.hpp>
+#include <universal/number/adaptivefloat/arena.hpp>
+#include <universal/number/adaptivefloat/expansion.hpp>
+// the exact decimal conversion works on adaptive precision integers
+#include <universal/number/adaptiveint/adaptiveint.hpp>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -50,13 +57,32 @@ namespace sw::universal {
 class adaptivefloat;
 inline adaptivefloat& convert(int64_t v, adaptivefloat& result);
 inline adaptivefloat& convert_unsigned(uint64_t v, adaptivefloat& result);
-bool parse(const std::string& number, adaptivefloat& v);
+inline bool parse(const std::string& number, adaptivefloat& v);
 
-// adaptivefloat is an adaptive precision linear floating-point type
+// the number of components above which an accumulation compresses its expansion
+#if !defined(ADAPTIVEFLOAT_COMPRESSION_THRESHOLD)
+#define ADAPTIVEFLOAT_COMPRESSION_THRESHOLD 16
+#endif
+// the number of double components to which a quotient is developed, each adds 53 bits
+#if !defined(ADAPTIVEFLOAT_DIVISION_COMPONENTS)
+#define ADAPTIVEFLOAT_DIVISION_COMPONENTS 4
+#endif
+
+// adaptivefloat is an adaptive precision linear floating-point type: a floating-point expansion,
+// that is, an unevaluated sum of nonoverlapping doubles ordered by increasing magnitude.
+// Sums, differences, and products are exact as long as no component overflows or underflows,
+// which makes the type an exact accumulator for long reductions. Quotients are developed
+// to divisionComponents doubles.
 class adaptivefloat {
-	using BlockType = uint32_t;
 public:
-	adaptivefloat() : sign(false), exp(0) { }
+	using Component = double;
+	using Storage = std::vector<Component, arena_allocator<Component>>;
+
+	// tunable for the application: exactness does not depend on either setting
+	static inline size_t compressionThreshold = ADAPTIVEFLOAT_COMPRESSION_THRESHOLD;
+	static inline size_t divisionComponents = ADAPTIVEFLOAT_DIVISION_COMPONENTS;
+
+	adaptivefloat() : coef{} { }
 
 	adaptivefloat(const adaptivefloat&) = default;
 	adaptivefloat(adaptivefloat&&) = default;
@@ -78,6 +104,7 @@ public:
 	explicit adaptivefloat(const float initial_value)              { *this = initial_value; }
 	explicit adaptivefloat(const double initial_value)             { *this = initial_value; }
 	explicit adaptivefloat(const long double initial_value)        { *this = initial_value; }
+	explicit adaptivefloat(const std::string& txt)                 { assign(txt); }
 
 	// assignment operators for native types
 	adaptivefloat& operator=(const signed char rhs)        { return convert(rhs, *this); }
@@ -107,170 +134,245 @@ public:
 	// prefix operators
 	adaptivefloat operator-() const {
 		adaptivefloat negated(*this);
+		for (Component& c : negated.coef) c = -c;
 		return negated;
 	}
 
 	// conversion operators
 	explicit operator float() const { return float(toNativeFloatingPoint()); }
-	explicit operator double() const { return float(toNativeFloatingPoint()); }
+	explicit operator double() const { return double(toNativeFloatingPoint()); }
 	explicit operator long double() const { return toNativeFloatingPoint(); }
 
 	// arithmetic operators
 	adaptivefloat& operator+=(const adaptivefloat& rhs) {
+		if (rhs.coef.size() == 1) return *this += rhs.coef[0];
+		Storage sum(coef.size() + rhs.coef.size());
+		sum.resize(internal::expansion_sum(sum.data(), coef.data(), coef.size(), rhs.coef.data(), rhs.coef.size()));
+		coef.swap(sum);
+		if (coef.size() > compressionThreshold) compress();
 		return *this;
 	}
-	adaptivefloat& operator-=(const adaptivefloat& rhs) {
+	// accumulate a finite double in place: the workhorse of exact reductions
+	adaptivefloat& operator+=(double rhs) {
+		size_t n = coef.size();
+		coef.push_back(0.0);
+		coef.resize(internal::grow_expansion(coef.data(), coef.data(), n, rhs));
+		if (coef.size() > compressionThreshold) compress();
 		return *this;
 	}
+	adaptivefloat& operator-=(const adaptivefloat& rhs) {
+		return *this += -rhs;
+	}
+	adaptivefloat& operator-=(double rhs) {
+		return *this += -rhs;
+	}
 	adaptivefloat& operator*=(const adaptivefloat& rhs) {
+		if (iszero() || rhs.iszero()) {
+			clear();
+			return *this;
+		}
+		if (rhs.coef.size() == 1) return *this *= rhs.coef[0];
+		// sum of the partial products of the expansion with each component of rhs
+		Storage product, term(2 * coef.size()), sum;
+		for (Component b : rhs.coef) {
+			size_t n = internal::scale_expansion(term.data(), coef.data(), coef.size(), b);
+			sum.resize(product.size() + n);
+			sum.resize(internal::expansion_sum(sum.data(), product.data(), product.size(), term.data(), n));
+			product.swap(sum);
+		}
+		coef.swap(product);
+		compress();
+		return *this;
+	}
+	adaptivefloat& operator*=(double rhs) {
+		Storage product(2 * coef.size());
+		product.resize(internal::scale_expansion(product.data(), coef.data(), coef.size(), rhs));
+		coef.swap(product);
+		if (coef.size() > compressionThreshold) compress();
 		return *this;
 	}
 	adaptivefloat& operator/=(const adaptivefloat& rhs) {
+		if (rhs.iszero()) {
+#if ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION
+			throw adaptivefloat_divide_by_zero{};
+#else
+			std::cerr << "adaptivefloat_divide_by_zero\n";
+			clear();
+			return *this;
+#endif // ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION
+		}
+		// each step divides the exact remainder by the leading component of the divisor
+		adaptivefloat divisor(rhs), quotient;
+		divisor.compress();
+		double d = divisor.coef.back();
+		for (size_t i = 0; i < divisionComponents && !iszero(); ++i) {
+			double q = estimate() / d;
+			quotient += q;
+			adaptivefloat product(divisor);
+			product *= q;
+			*this -= product;
+		}
+		coef.swap(quotient.coef);
+		compress();
 		return *this;
 	}
 
 	// modifiers
-	inline void clear() { sign = false; exp = 0; coef.clear(); }
+	inline void clear() { coef.clear(); }
 	inline void setzero() { clear(); }
-	// use un-interpreted raw bits to set the bits of the adaptivefloat
-	inline void setBits(unsigned long long value) {
-		clear();
-	}
+	// compress the expansion into the fewest nonadjacent components that represent the value
+	inline void compress() { coef.resize(internal::compress_expansion(coef.data(), coef.size())); }
 	inline adaptivefloat& assign(const std::string& txt) {
+		if (!parse(txt, *this)) {
+			std::cerr << "unable to parse -" << txt << "- into an adaptivefloat value\n";
+			clear();
+		}
 		return *this;
 	}
 
 	// selectors
-	inline bool iszero() const { return !sign && coef.size() == 0; }
-	inline bool isone() const  { return true; }
-	inline bool isodd() const  { return false; }
-	inline bool iseven() const { return !isodd(); }
-	inline bool ispos() const  { return !sign; }
-	inline bool ineg() const   { return sign; }
-	inline int64_t scale() const { return exp + int64_t(coef.size()); }
-
-	// convert to string containing digits number of digits
-	std::string str(size_t nrDigits = 0) const {
-		if (iszero()) return std::string("0.0");
+	inline bool iszero() const { return coef.empty(); }
+	inline bool isone() const;
+	inline bool ispos() const  { return !isneg(); }
+	// the largest component of a nonoverlapping expansion carries the sign
+	inline bool isneg() const  { return !coef.empty() && coef.back() < 0.0; }
+	inline bool sign() const   { return isneg(); }
+	inline size_t components() const { return coef.size(); }
+	inline Component component(size_t i) const { return (i < coef.size() ? coef[i] : Component(0)); }
+	// binary exponent of the value, that is, floor(log2(|value|))
+	inline int64_t scale() const {
+		if (iszero()) return 0;
+		adaptivefloat v(*this);
+		v.compress();
+		double top = v.coef.back();
+		int64_t e = std::ilogb(top);
+		// a power of two followed by a component of the opposite sign lies in the binade below
+		if (std::ldexp(1.0, int(e)) == std::fabs(top) && v.coef.size() > 1 && ((v.coef[v.coef.size() - 2] < 0.0) != (top < 0.0))) --e;
+		return e;
+	}
 
-		int64_t magnitude = scale();
-		if (magnitude > 1 || magnitude < 0) {
-			// use scientific notation for non-trivial exponent values
-			return sci_notation(nrDigits);
+	// convert to string containing nrDigits significant digits, all the digits of the exact value when 0
+	std::string str(size_t nrDigits = 0) const {
+		if (iszero()) return std::string("0");
+
+		std::string digits;
+		int64_t k;
+		decimal(digits, k);  // |value| = digits * 10^-k
+		if (nrDigits > 0 && digits.size() > nrDigits) {
+			// round half away from zero
+			bool roundUp = digits[nrDigits] >= '5';
+			k -= int64_t(digits.size() - nrDigits);
+			digits.resize(nrDigits);
+			if (roundUp) {
+				size_t i = nrDigits;
+				while (i > 0 && digits[i - 1] == '9') digits[--i] = '0';
+				if (i == 0) {
+					digits.insert(digits.begin(), '1');
+					digits.pop_back();
+					--k;
+				}
+				else {
+					++digits[i - 1];
+				}
+			}
 		}
-
-		std::string str;
-		int64_t exponent = trimmed(nrDigits, str);
-
-		if (magnitude == 0) {
-			if (sign)
-				return std::string("-0.0") + str;
-			else
-				return std::string("0.0") + str;
+		while (digits.size() > 1 && digits.back() == '0') {
+			digits.pop_back();
+			--k;
 		}
-
-		std::string before_decimal = std::to_string(coef.back());
-
-		if (exponent >= 0) {
-			if (sign)
-				return std::string("-") + before_decimal + ".0";
-			else
-				return before_decimal + ".0";
+		int64_t exponent = int64_t(digits.size()) - 1 - k;  // decimal exponent of the leading digit
+		// the exact representation keeps integers in fixed notation
+		int64_t fixedLimit = (nrDigits > 0 ? int64_t(nrDigits) : (k <= 0 ? exponent + 1 : 17));
+
+		std::string s = (sign() ? "-" : "");
+		if (exponent < -4 || exponent >= fixedLimit) {
+			s += digits[0];
+			if (digits.size() > 1) s += '.' + digits.substr(1);
+			std::string e = std::to_string(exponent < 0 ? -exponent : exponent);
+			if (e.size() < 2) e.insert(e.begin(), '0');
+			s += (exponent < 0 ? "e-" : "e+") + e;
 		}
-
-		// now the digits after the radix point
-		std::string after_decimal = str.substr((size_t)(str.size() + exponent), (size_t)-exponent);
-		if (sign)
-			return std::string("-") + before_decimal + "." + after_decimal;
-		else
-			return before_decimal + "." + after_decimal;
-
-		return std::string("bad");
+		else if (exponent >= 0) {
+			size_t integerDigits = size_t(exponent) + 1;
+			if (digits.size() <= integerDigits) {
+				s += digits + std::string(integerDigits - digits.size(), '0');
+			}
+			else {
+				s += digits.substr(0, integerDigits) + '.' + digits.substr(integerDigits);
+			}
+		}
+		else {
+			s += "0." + std::string(size_t(-exponent - 1), '0') + digits;
+		}
+		return s;
 	}
 
-	void test(bool _sign, int _exp, std::vector<BlockType>& _coef) {
-		sign = _sign;
-		coef = _coef;
-		exp = _exp;
-	}
 protected:
-	bool                   sign;  // sign of the number: -1 if true, +1 if false, zero is positive
-	int64_t                exp;   // exponent of the number
-	std::vector<BlockType> coef;  // coefficients of the polynomial
+	Storage coef;  // components of the expansion, nonoverlapping and in increasing magnitude
 
 	// HELPER methods
 
+	// double approximation of the value
+	double estimate() const { return internal::estimate_expansion(coef.data(), coef.size()); }
+
 	// convert to native floating-point, use conversion rules to cast down to float and double
 	long double toNativeFloatingPoint() const {
 		long double ld = 0;
+		for (Component c : coef) ld += c;
 		return ld;
 	}
 
 	template<typename Ty>
-	adaptivefloat& float_assign(Ty& rhs) {
+	adaptivefloat& float_assign(Ty rhs) {
 		clear();
-		long long base = (long long)rhs;
-		*this = base;
+		if (!std::isfinite(rhs)) {
+#if ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION
+			throw adaptivefloat_nonfinite_value{};
+#else
+			std::cerr << "adaptivefloat_nonfinite_value\n";
+			return *this;
+#endif // ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION
+		}
+		// a long double carries at most two doubles worth of significand
+		double high = double(rhs);
+		double low = double(rhs - Ty(high));
+		*this += low;
+		*this += high;
 		return *this;
 	}
 
-	// convert to string with nrDigits of significant digits and return the scale
-	// value = str + "10^" + scale
-	int64_t trimmed(size_t nrDigits, std::string& number) const {
-		if (coef.size() == 0) return 0;
-		int64_t exponent = exp;
-		size_t length = coef.size();
-		size_t index = 0; 
-		if (nrDigits == 0) {
-			nrDigits = length * 9;
+	// exact decimal digits of the magnitude: |value| = digits * 10^-k
+	void decimal(std::string& digits, int64_t& k) const {
+		// value = N * 2^e with an integer N built from the 53-bit significands of the components
+		int e = std::numeric_limits<int>::max();
+		for (Component c : coef) {
+			int x;
+			std::frexp(c, &x);
+			e = std::min(e, x - std::numeric_limits<double>::digits);
 		}
-		else {
-			size_t nrSegments = (nrDigits + 17) / 9;
-			if (nrSegments < length) {
-				index = length - nrSegments;
-				exponent += index;
-				length = nrSegments;
-			}
+		adaptiveint N;
+		for (Component c : coef) {
+			int x;
+			double f = std::frexp(c, &x);
+			adaptiveint significand(static_cast<long long>(std::ldexp(f, std::numeric_limits<double>::digits)));
+			N += significand << (x - std::numeric_limits<double>::digits - e);
 		}
-		exponent *= 9;
-		char segment[] = "012345678";
-		number.clear();
-		size_t i = length;
-		while (i-- > 0) {
-			BlockType w = coef[i];
-			for (int i = 8; i >= 0; --i) {
-				segment[i] = w % 10 + '0';
-				w /= 10;
-			}
-			number += segment;
-		}
-
-		// process leading zeros
-		size_t lz = 0;
-		while (number[lz] == '0') ++lz;
-		nrDigits += lz;
-		if (nrDigits < number.size()) {
-			exponent += number.size() - nrDigits;
-			number.resize(nrDigits);
+		N = abs(N);
+		if (e >= 0) {
+			N <<= e;
+			k = 0;
 		}
-
-		return exponent;
-	}
-
-	std::string sci_notation(size_t nrDigits) const {
-		if (coef.size() == 0) return std::string("0.0");
-		std::string str;
-		int64_t exponent = trimmed(nrDigits, str);
-		// remove leading zeros
-		str.erase(str.begin(), std::find_if(str.begin(), str.end(), [](int ch) { return (ch != '0'); }));
-		exponent += str.size() - 1;
-		str = str.substr(0, 1) + "." + &str[1];
-		if (exponent != 0) {
-			str += "*10^";
-			str += std::to_string(exponent);
+		else {
+			// N * 2^-k = N * 5^k * 10^-k
+			k = -e;
+			adaptiveint five(5), power(1);
+			for (int64_t n = k; n > 0; n >>= 1) {
+				if (n & 1) power *= five;
+				five *= five;
+			}
+			N *= power;
 		}
-		if (sign) str = std::string("-") + str;
-		return str;
+		digits = N.str();
 	}
 
 private:
@@ -283,60 +385,98 @@ private:
 
 	// literal - adaptivefloat logic comparisons
 	friend bool operator==(const long long lhs, const adaptivefloat& rhs);
-
-	// find the most significant bit set
-	friend signed findMsb(const adaptivefloat& v);
 };
 
 inline adaptivefloat& convert(int64_t v, adaptivefloat& result) {
-	if (0 == v) {
-		result.setzero();
-	}
-	else {
-		// convert 
-	}
+	// the two 32-bit halves are exact doubles
+	result.setzero();
+	result += double(uint32_t(v));
+	result += std::ldexp(double(int32_t(v >> 32)), 32);
 	return result;
 }
 
 inline adaptivefloat& convert_unsigned(uint64_t v, adaptivefloat& result) {
-	if (0 == v) {
-		result.setzero();
-	}
-	else {
-		// convert 
-	}
+	result.setzero();
+	result += double(uint32_t(v));
+	result += std::ldexp(double(uint32_t(v >> 32)), 32);
 	return result;
 }
 
 ////////////////////////    MPFLOAT functions   /////////////////////////////////
 
-
-inline adaptivefloat abs(const adaptivefloat& a) {
-	return a; // (a < 0 ? -a : a);
+inline bool adaptivefloat::isone() const {
+	return (coef.size() == 1 ? coef[0] == 1.0 : *this == adaptivefloat(1));
 }
 
-
-// findMsb takes an adaptivefloat reference and returns the position of the most significant bit, -1 if v == 0
-
-inline signed findMsb(const adaptivefloat& v) {
-	return -1; // no significant bit found, all bits are zero
+inline adaptivefloat abs(const adaptivefloat& a) {
+	return (a.isneg() ? -a : a);
 }
 
 ////////////////////////    INTEGER operators   /////////////////////////////////
 
 // divide adaptivefloat a and b and return result argument
-
-void divide(const adaptivefloat& a, const adaptivefloat& b, adaptivefloat& quotient) {
+inline void divide(const adaptivefloat& a, const adaptivefloat& b, adaptivefloat& quotient) {
+	quotient = a;
+	quotient /= b;
 }
 
 /// stream operators
 
-// read a adaptivefloat ASCII format and make a binary adaptivefloat out of it
-
-bool parse(const std::string& number, adaptivefloat& value) {
-	bool bSuccess = false;
+// read a decimal adaptivefloat ASCII format, [+-]digits[.digits][(e|E)[+-]digits], and make a binary adaptivefloat out of it.
+// Integers and decimal fractions that are dyadic are represented exactly, other fractions to divisionComponents doubles
+inline bool parse(const std::string& number, adaptivefloat& value) {
+	size_t pos = 0, n = number.size();
+	bool negative = false;
+	if (pos < n && (number[pos] == '-' || number[pos] == '+')) negative = (number[pos++] == '-');
+	std::string mantissa;
+	int64_t exponent = 0;
+	bool hasDigits = false;
+	while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) { mantissa += number[pos++]; hasDigits = true; }
+	if (pos < n && number[pos] == '.') {
+		++pos;
+		while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) { mantissa += number[pos++]; --exponent; hasDigits = true; }
+	}
+	if (!hasDigits) return false;
+	if (pos < n && (number[pos] == 'e' || number[pos] == 'E')) {
+		++pos;
+		bool negativeExponent = false;
+		if (pos < n && (number[pos] == '-' || number[pos] == '+')) negativeExponent = (number[pos++] == '-');
+		if (pos == n) return false;
+		int64_t e = 0;
+		while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) {
+			if (e < 100000) e = 10 * e + (number[pos] - '0');
+			++pos;
+		}
+		exponent += (negativeExponent ? -e : e);
+	}
+	if (pos != n) return false;
 
-	return bSuccess;
+	adaptiveint M, scale(1), ten(10);
+	if (!parse(mantissa, M)) return false;
+	for (int64_t e = (exponent < 0 ? -exponent : exponent); e > 0; e >>= 1) {
+		if (e & 1) scale *= ten;
+		ten *= ten;
+	}
+	if (exponent > 0) M *= scale;
+	// the limbs of the integer are exact doubles
+	auto toExpansion = [](const adaptiveint& v, adaptivefloat& result) {
+		result.setzero();
+		for (size_t i = 0; i < v.limbs(); ++i) {
+			double component = std::ldexp(double(v.limb(i)), int(32 * i));
+			if (!std::isfinite(component)) return false;
+			result += component;
+		}
+		return true;
+	};
+	adaptivefloat result;
+	if (!toExpansion(M, result)) return false;
+	if (exponent < 0) {
+		adaptivefloat divisor;
+		if (!toExpansion(scale, divisor)) return false;
+		result /= divisor;
+	}
+	value = (negative ? -result : result);
+	return true;
 }
 
 // generate an adaptivefloat format ASCII format
@@ -361,7 +501,7 @@ inline std::istream& operator>>(std::istream& istr, adaptivefloat& p) {
 	std::string txt;
 	istr >> txt;
 	if (!parse(txt, p)) {
-		std::cerr << "unable to parse -" << txt << "- into a posit value\n";
+		std::cerr << "unable to parse -" << txt << "- into an adaptivefloat value\n";
 	}
 	return istr;
 }
@@ -372,10 +512,11 @@ inline std::istream& operator>>(std::istream& istr, adaptivefloat& p) {
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // adaptivefloat - adaptivefloat binary logic operators
 
-// equal: precondition is that the storage is properly nulled in all arithmetic paths
-
+// equal: an expansion of nonoverlapping components is zero only when it is empty
 inline bool operator==(const adaptivefloat& lhs, const adaptivefloat& rhs) {
-	return true;
+	adaptivefloat diff(lhs);
+	diff -= rhs;
+	return diff.iszero();
 }
 
 inline bool operator!=(const adaptivefloat& lhs, const adaptivefloat& rhs) {
@@ -383,7 +524,9 @@ inline bool operator!=(const adaptivefloat& lhs, const adaptivefloat& rhs) {
 }
 
 inline bool operator< (const adaptivefloat& lhs, const adaptivefloat& rhs) {
-	return false; // lhs and rhs are the same
+	adaptivefloat diff(lhs);
+	diff -= rhs;
+	return diff.isneg();
 }
 
 inline bool operator> (const adaptivefloat& lhs, const adaptivefloat& rhs) {
@@ -400,7 +543,6 @@ inline bool operator>=(const adaptivefloat& lhs, const adaptivefloat& rhs) {
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // adaptivefloat - literal binary logic operators
-// equal: precondition is that the byte-storage is properly nulled in all arithmetic paths
 
 inline bool operator==(const adaptivefloat& lhs, const long long rhs) {
 	return operator==(lhs, adaptivefloat(rhs));
@@ -428,8 +570,6 @@ inline bool operator>=(const adaptivefloat& lhs, const long long rhs) {
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // literal - adaptivefloat binary logic operators
-// precondition is that the byte-storage is properly nulled in all arithmetic paths
-
 
 inline bool operator==(const long long lhs, const adaptivefloat& rhs) {
 	return operator==(adaptivefloat(lhs), rhs);
@@ -455,8 +595,6 @@ inline bool operator>=(const long long lhs, const adaptivefloat& rhs) {
 	return !operator< (lhs, rhs);
 }
 
-//////////////////////////////////////////////////////////////////////////////////////////////////////
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // adaptivefloat - adaptivefloat binary arithmetic operators
 // BINARY ADDITION
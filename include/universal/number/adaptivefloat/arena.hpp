@@ -0,0 +1,150 @@
+#pragma once
+// arena.hpp: recycling arena for the component storage of adaptive precision floats
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace sw::universal {
+
+/*
+   Expansions grow and shrink a few components at a time, and a reduction loop creates
+   and destroys temporaries at every step. The arena keeps the released blocks of each
+   thread on free lists per power-of-two size class, so that after a warm-up the hot
+   loop recycles blocks instead of calling the global allocator.
+
+   Blocks are obtained from ::operator new one at a time, so a value may be released on
+   a different thread than the one that allocated it: the block simply moves to the
+   free list of the releasing thread. Releases that arrive after the arena of a thread
+   has been destroyed go straight back to the global allocator.
+ */
+class expansion_arena {
+public:
+	static constexpr size_t minBlockSize    = 64;  // bytes in the smallest size class
+	static constexpr size_t nrSizeClasses   = 12;  // 64 bytes through 128KB
+	static constexpr size_t maxCachedBlocks = 64;  // free blocks kept per size class
+
+	struct statistics {
+		uint64_t allocations{ 0 };  // requests served by the arena of this thread
+		uint64_t recycled{ 0 };     // requests served from a free list
+		uint64_t releases{ 0 };     // blocks returned to the arena of this thread
+	};
+
+	expansion_arena(const expansion_arena&) = delete;
+	expansion_arena& operator=(const expansion_arena&) = delete;
+
+	static void* allocate(size_t bytes) {
+		size_t sizeClass = size_class(bytes);
+		if (sizeClass == nrSizeClasses) return ::operator new(bytes);
+		if (state() == destroyed) return ::operator new(block_size(sizeClass));
+		expansion_arena& arena = local();
+		++arena.counters.allocations;
+		node* block = arena.freelist[sizeClass];
+		if (block != nullptr) {
+			arena.freelist[sizeClass] = block->next;
+			--arena.cached[sizeClass];
+			++arena.counters.recycled;
+			return block;
+		}
+		return ::operator new(block_size(sizeClass));
+	}
+
+	static void deallocate(void* p, size_t bytes) noexcept {
+		if (p == nullptr) return;
+		size_t sizeClass = size_class(bytes);
+		if (sizeClass == nrSizeClasses || state() == destroyed) {
+			::operator delete(p);
+			return;
+		}
+		expansion_arena& arena = local();
+		++arena.counters.releases;
+		if (arena.cached[sizeClass] == maxCachedBlocks) {
+			::operator delete(p);
+			return;
+		}
+		node* block = static_cast<node*>(p);
+		block->next = arena.freelist[sizeClass];
+		arena.freelist[sizeClass] = block;
+		++arena.cached[sizeClass];
+	}
+
+	// allocation counters of the calling thread
+	static statistics stats() {
+		if (state() == destroyed) return statistics{};
+		return local().counters;
+	}
+
+	// return the free blocks of the calling thread to the global allocator
+	static void release() {
+		if (state() != destroyed) local().release_blocks();
+	}
+
+private:
+	struct node { node* next; };
+	enum lifetime { unborn = 0, alive = 1, destroyed = 2 };
+
+	node*      freelist[nrSizeClasses]{};
+	size_t     cached[nrSizeClasses]{};
+	statistics counters;
+
+	expansion_arena() { state() = alive; }
+	~expansion_arena() {
+		release_blocks();
+		state() = destroyed;
+	}
+
+	void release_blocks() noexcept {
+		for (size_t i = 0; i < nrSizeClasses; ++i) {
+			while (freelist[i] != nullptr) {
+				node* next = freelist[i]->next;
+				::operator delete(freelist[i]);
+				freelist[i] = next;
+			}
+			cached[i] = 0;
+		}
+	}
+
+	// the lifetime flag is trivially destructible, so it remains readable after the arena is gone
+	static int& state() noexcept {
+		thread_local int lifetimeState = unborn;
+		return lifetimeState;
+	}
+	static expansion_arena& local() {
+		thread_local expansion_arena arena;
+		return arena;
+	}
+
+	static constexpr size_t block_size(size_t sizeClass) { return minBlockSize << sizeClass; }
+	// the size class of a request, nrSizeClasses when the request is too large to recycle
+	static constexpr size_t size_class(size_t bytes) {
+		size_t sizeClass = 0;
+		while (sizeClass < nrSizeClasses && block_size(sizeClass) < bytes) ++sizeClass;
+		return sizeClass;
+	}
+};
+
+// standard allocator interface on top of the expansion arena
+template<typename T>
+class arena_allocator {
+public:
+	using value_type = T;
+	using is_always_equal = std::true_type;
+
+	arena_allocator() noexcept = default;
+	template<typename U>
+	arena_allocator(const arena_allocator<U>&) noexcept {}
+
+	T* allocate(size_t n) { return static_cast<T*>(expansion_arena::allocate(n * sizeof(T))); }
+	void deallocate(T* p, size_t n) noexcept { expansion_arena::deallocate(p, n * sizeof(T)); }
+
+	template<typename U>
+	bool operator==(const arena_allocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const arena_allocator<U>&) const noexcept { return false; }
+};
+
+} // namespace sw::universal
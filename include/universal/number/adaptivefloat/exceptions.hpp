@@ -5,6 +5,8 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <exception>
+#include <stdexcept>
+#include <string>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -52,6 +54,12 @@ struct adaptivefloat_divide_by_zero : public adaptivefloat_arithmetic_exception
 		: adaptivefloat_arithmetic_exception(error) {}
 };
 
+// non-finite values have no representation as an expansion
+struct adaptivefloat_nonfinite_value : public adaptivefloat_arithmetic_exception {
+	explicit adaptivefloat_nonfinite_value(const std::string& error = "adaptive-float cannot represent a non-finite value") 
+		: adaptivefloat_arithmetic_exception(error) {}
+};
+
 ///////////////////////////////////////////////////////////////
 // internal implementation exceptions
 
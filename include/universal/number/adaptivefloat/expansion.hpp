@@ -0,0 +1,111 @@
+#pragma once
+// expansion.hpp: error-free transformations and floating-point expansion kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <cmath>
+#include <utility>
+#include <universal/functions/twosum.hpp>
+#include <universal/number/shared/error_free_ops.hpp>
+
+/*
+   A floating-point expansion is an unevaluated sum of doubles e[0] + e[1] + ... + e[n-1]
+   whose components are nonoverlapping and ordered by increasing magnitude, following
+   J.R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+   Predicates", Discrete & Computational Geometry 18, 1997.
+
+   The kernels below eliminate zero components, so the expansion of zero is empty. They
+   use the branch-free twoSum throughout instead of the magnitude-ordered fastTwoSum:
+   the results remain exact even when an input is only nonoverlapping and not nonadjacent.
+   All kernels are exact as long as no component overflows or underflows.
+ */
+
+namespace sw::universal::internal {
+
+// h = e + b for an expansion e of n components; h has room for n + 1 components and may alias e
+inline size_t grow_expansion(double* h, const double* e, size_t n, double b) {
+	double q = b;
+	size_t hn = 0;
+	for (size_t i = 0; i < n; ++i) {
+		auto [s, r] = sw::function::twoSum(q, e[i]);
+		if (r != 0.0) h[hn++] = r;
+		q = s;
+	}
+	if (q != 0.0) h[hn++] = q;
+	return hn;
+}
+
+// h = e + f, merging the components by increasing magnitude; h has room for ne + nf components and must not alias e or f
+inline size_t expansion_sum(double* h, const double* e, size_t ne, const double* f, size_t nf) {
+	size_t i = 0, j = 0, hn = 0;
+	auto next = [&]() {
+		if (j == nf || (i < ne && std::fabs(e[i]) < std::fabs(f[j]))) return e[i++];
+		return f[j++];
+	};
+	if (ne + nf == 0) return 0;
+	double q = next();
+	while (i < ne || j < nf) {
+		auto [s, r] = sw::function::twoSum(q, next());
+		if (r != 0.0) h[hn++] = r;
+		q = s;
+	}
+	if (q != 0.0) h[hn++] = q;
+	return hn;
+}
+
+// h = e * b; h has room for 2n components and must not alias e
+inline size_t scale_expansion(double* h, const double* e, size_t n, double b) {
+	if (n == 0 || b == 0.0) return 0;
+	size_t hn = 0;
+	double low;
+	double q = two_prod(e[0], b, low);
+	if (low != 0.0) h[hn++] = low;
+	for (size_t i = 1; i < n; ++i) {
+		double p0;
+		double p1 = two_prod(e[i], b, p0);
+		auto [s, r] = sw::function::twoSum(q, p0);
+		if (r != 0.0) h[hn++] = r;
+		auto [t, u] = sw::function::twoSum(p1, s);
+		if (u != 0.0) h[hn++] = u;
+		q = t;
+	}
+	if (q != 0.0) h[hn++] = q;
+	return hn;
+}
+
+// compress the expansion in place into a nonadjacent expansion whose largest component
+// approximates the value to within one ulp; returns the new number of components
+inline size_t compress_expansion(double* e, size_t n) {
+	if (n == 0) return 0;
+	size_t bottom = n - 1;
+	double q = e[bottom];
+	for (size_t i = n - 1; i-- > 0;) {
+		auto [s, r] = sw::function::twoSum(q, e[i]);
+		if (r != 0.0) {
+			e[bottom--] = s;
+			q = r;
+		}
+		else {
+			q = s;
+		}
+	}
+	size_t top = 0;
+	for (size_t i = bottom + 1; i < n; ++i) {
+		auto [s, r] = sw::function::twoSum(e[i], q);
+		if (r != 0.0) e[top++] = r;
+		q = s;
+	}
+	if (q != 0.0) e[top++] = q;
+	return top;
+}
+
+// double approximation of the value of the expansion, accumulated from the smallest component
+inline double estimate_expansion(const double* e, size_t n) {
+	double sum{ 0.0 };
+	for (size_t i = 0; i < n; ++i) sum += e[i];
+	return sum;
+}
+
+} // namespace sw::universal::internal
@@ -4,15 +4,19 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
-#include <regex>
 #include <vector>
-#include <map>
+#include <limits>
+#include <algorithm>
 
 #include <universal/number/adaptiveint/exceptions.hpp>
+#include <universal/number/adaptiveint/limb_arithmetic.hpp>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -44,40 +48,85 @@
 
 #endif
 
+// the number of limbs above which multiplication switches from the schoolbook algorithm to Karatsuba
+#if !defined(ADAPTIVEINT_KARATSUBA_THRESHOLD)
+#define ADAPTIVEINT_KARATSUBA_THRESHOLD 24
+#endif
+// the number of limbs above which multiplication switches from Karatsuba to Toom-3
+#if !defined(ADAPTIVEINT_TOOM3_THRESHOLD)
+#define ADAPTIVEINT_TOOM3_THRESHOLD 160
+#endif
+
 namespace sw { namespace universal {
 
 // forward references
 class adaptiveint;
 inline adaptiveint& convert(int64_t v, adaptiveint& result);
 inline adaptiveint& convert_unsigned(uint64_t v, adaptiveint& result);
-bool parse(const std::string& number, adaptiveint& v);
-
-// adaptiveint is an adaptive precision linear floating-point type
+inline bool parse(const std::string& number, adaptiveint& v);
+inline void divide(const adaptiveint& a, const adaptiveint& b, adaptiveint& quotient, adaptiveint& remainder);
+
+/// <summary>
+/// adaptiveint is an adaptive precision binary integer in sign-magnitude form
+/// </summary>
+/// The magnitude is a vector of 32-bit limbs with the least significant limb at index 0.
+/// Values that fit in nrInlineBlocks limbs are stored inline and do not allocate.
+/// The magnitude is kept normalized, without leading zero limbs, so that zero has no limbs.
 class adaptiveint {
-	using BlockType = uint32_t;
 public:
-	adaptiveint() : sign(false), exp(0) { }
+	using BlockType = uint32_t;
+	static constexpr size_t bitsInBlock = 32;
+	static constexpr size_t nrInlineBlocks = 2;
+
+	// multiplication algorithm thresholds in limbs of the smaller operand, tunable for the target machine
+	static inline size_t karatsubaThreshold = ADAPTIVEINT_KARATSUBA_THRESHOLD;
+	static inline size_t toom3Threshold = ADAPTIVEINT_TOOM3_THRESHOLD;
 
-	adaptiveint(const adaptiveint&) = default;
-	adaptiveint(adaptiveint&&) = default;
+	adaptiveint() : _sign(false), _size(0), _inline{ 0, 0 } { }
 
-	adaptiveint& operator=(const adaptiveint&) = default;
-	adaptiveint& operator=(adaptiveint&&) = default;
+	adaptiveint(const adaptiveint& rhs) : _sign(rhs._sign), _size(0), _inline{ 0, 0 } {
+		assign_magnitude(rhs.data(), rhs._size);
+	}
+	adaptiveint(adaptiveint&& rhs) noexcept : _sign(rhs._sign), _size(rhs._size), _inline{ rhs._inline[0], rhs._inline[1] }, _heap(std::move(rhs._heap)) {
+		rhs._sign = false;
+		rhs._size = 0;
+	}
+
+	adaptiveint& operator=(const adaptiveint& rhs) {
+		if (this != &rhs) {
+			_sign = rhs._sign;
+			assign_magnitude(rhs.data(), rhs._size);
+		}
+		return *this;
+	}
+	adaptiveint& operator=(adaptiveint&& rhs) noexcept {
+		if (this != &rhs) {
+			_sign = rhs._sign;
+			_size = rhs._size;
+			_inline[0] = rhs._inline[0];
+			_inline[1] = rhs._inline[1];
+			_heap.swap(rhs._heap);  // keep our allocation with the moved-from object for reuse
+			rhs._sign = false;
+			rhs._size = 0;
+		}
+		return *this;
+	}
 
 	// initializers for native types
-	explicit adaptiveint(const signed char initial_value)        { *this = initial_value; }
-	explicit adaptiveint(const short initial_value)              { *this = initial_value; }
-	explicit adaptiveint(const int initial_value)                { *this = initial_value; }
-	explicit adaptiveint(const long initial_value)               { *this = initial_value; }
-	explicit adaptiveint(const long long initial_value)          { *this = initial_value; }
-	explicit adaptiveint(const char initial_value)               { *this = initial_value; }
-	explicit adaptiveint(const unsigned short initial_value)     { *this = initial_value; }
-	explicit adaptiveint(const unsigned int initial_value)       { *this = initial_value; }
-	explicit adaptiveint(const unsigned long initial_value)      { *this = initial_value; }
-	explicit adaptiveint(const unsigned long long initial_value) { *this = initial_value; }
-	explicit adaptiveint(const float initial_value)              { *this = initial_value; }
-	explicit adaptiveint(const double initial_value)             { *this = initial_value; }
-	explicit adaptiveint(const long double initial_value)        { *this = initial_value; }
+	explicit adaptiveint(const signed char initial_value)        : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const short initial_value)              : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const int initial_value)                : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const long initial_value)               : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const long long initial_value)          : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const char initial_value)               : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const unsigned short initial_value)     : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const unsigned int initial_value)       : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const unsigned long initial_value)      : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const unsigned long long initial_value) : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const float initial_value)              : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const double initial_value)             : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const long double initial_value)        : adaptiveint() { *this = initial_value; }
+	explicit adaptiveint(const std::string& digits)              : adaptiveint() { assign(digits); }
 
 	// assignment operators for native types
 	adaptiveint& operator=(const signed char rhs)        { return convert(rhs, *this); }
@@ -85,7 +134,7 @@ public:
 	adaptiveint& operator=(const int rhs)                { return convert(rhs, *this); }
 	adaptiveint& operator=(const long rhs)               { return convert(rhs, *this); }
 	adaptiveint& operator=(const long long rhs)          { return convert(rhs, *this); }
-	adaptiveint& operator=(const char rhs)               { return convert_unsigned(rhs, *this); }
+	adaptiveint& operator=(const char rhs)               { return convert_unsigned(static_cast<unsigned char>(rhs), *this); }
 	adaptiveint& operator=(const unsigned short rhs)     { return convert_unsigned(rhs, *this); }
 	adaptiveint& operator=(const unsigned int rhs)       { return convert_unsigned(rhs, *this); }
 	adaptiveint& operator=(const unsigned long rhs)      { return convert_unsigned(rhs, *this); }
@@ -107,236 +156,452 @@ public:
 	// prefix operators
 	adaptiveint operator-() const {
 		adaptiveint negated(*this);
+		if (!negated.iszero()) negated._sign = !_sign;
 		return negated;
 	}
 
 	// conversion operators
+	explicit operator int() const { return int(to_long_long()); }
+	explicit operator long() const { return long(to_long_long()); }
+	explicit operator long long() const { return to_long_long(); }
+	explicit operator unsigned long long() const { return to_ulong_long(); }
 	explicit operator float() const { return float(toNativeFloatingPoint()); }
-	explicit operator double() const { return float(toNativeFloatingPoint()); }
+	explicit operator double() const { return double(toNativeFloatingPoint()); }
 	explicit operator long double() const { return toNativeFloatingPoint(); }
 
 	// arithmetic operators
 	adaptiveint& operator+=(const adaptiveint& rhs) {
+		if (this == &rhs) return *this <<= 1;
+		if (_sign == rhs._sign) add_magnitude(rhs.data(), rhs._size);
+		else sub_magnitude(rhs.data(), rhs._size);
 		return *this;
 	}
 	adaptiveint& operator-=(const adaptiveint& rhs) {
+		if (this == &rhs) {
+			setzero();
+			return *this;
+		}
+		if (_sign != rhs._sign) add_magnitude(rhs.data(), rhs._size);
+		else sub_magnitude(rhs.data(), rhs._size);
 		return *this;
 	}
 	adaptiveint& operator*=(const adaptiveint& rhs) {
+		if (iszero() || rhs.iszero()) {
+			setzero();
+			return *this;
+		}
+		bool sign = (_sign != rhs._sign);
+		if (_size + rhs._size <= nrInlineBlocks) {
+			// single limb operands: the product fits the inline storage
+			uint64_t product = uint64_t(_inline[0]) * rhs._inline[0];
+			_inline[0] = BlockType(product);
+			_inline[1] = BlockType(product >> bitsInBlock);
+			_size = nrInlineBlocks;
+		}
+		else {
+			adaptiveint product;
+			BlockType* r = product.resize(_size + rhs._size);
+			internal::limb_mul(r, data(), _size, rhs.data(), rhs._size, karatsubaThreshold, toom3Threshold);
+			*this = std::move(product);
+		}
+		normalize();
+		_sign = sign;
 		return *this;
 	}
 	adaptiveint& operator/=(const adaptiveint& rhs) {
+		adaptiveint q, r;
+		divide(*this, rhs, q, r);
+		*this = std::move(q);
 		return *this;
 	}
+	adaptiveint& operator%=(const adaptiveint& rhs) {
+		adaptiveint q, r;
+		divide(*this, rhs, q, r);
+		*this = std::move(r);
+		return *this;
+	}
+	adaptiveint& operator<<=(int shift) {
+		if (shift < 0) return *this >>= -shift;
+		if (iszero() || shift == 0) return *this;
+		size_t limbShift = size_t(shift) / bitsInBlock;
+		unsigned bitShift = unsigned(shift) % bitsInBlock;
+		size_t n = _size;
+		BlockType* r = resize(n + limbShift + 1);
+		r[n + limbShift] = 0;
+		for (size_t i = n; i-- > 0;) {
+			BlockType w = r[i];
+			if (bitShift) r[i + limbShift + 1] |= BlockType(w >> (bitsInBlock - bitShift));
+			r[i + limbShift] = BlockType(w << bitShift);
+		}
+		std::fill(r, r + limbShift, BlockType(0));
+		normalize();
+		return *this;
+	}
+	// shift right the magnitude, which truncates toward zero
+	adaptiveint& operator>>=(int shift) {
+		if (shift < 0) return *this <<= -shift;
+		if (iszero() || shift == 0) return *this;
+		size_t limbShift = size_t(shift) / bitsInBlock;
+		unsigned bitShift = unsigned(shift) % bitsInBlock;
+		if (limbShift >= _size) {
+			setzero();
+			return *this;
+		}
+		BlockType* r = data();
+		size_t n = _size - limbShift;
+		for (size_t i = 0; i < n; ++i) {
+			BlockType w = BlockType(r[i + limbShift] >> bitShift);
+			if (bitShift && i + limbShift + 1 < _size) w |= BlockType(r[i + limbShift + 1] << (bitsInBlock - bitShift));
+			r[i] = w;
+		}
+		resize(n);
+		normalize();
+		return *this;
+	}
+	adaptiveint& operator++() {
+		return *this += adaptiveint(1);
+	}
+	adaptiveint operator++(int) {
+		adaptiveint tmp(*this);
+		operator++();
+		return tmp;
+	}
+	adaptiveint& operator--() {
+		return *this -= adaptiveint(1);
+	}
+	adaptiveint operator--(int) {
+		adaptiveint tmp(*this);
+		operator--();
+		return tmp;
+	}
 
 	// modifiers
-	inline void clear() { sign = false; exp = 0; coef.clear(); }
+	inline void clear() { _sign = false; _size = 0; }
 	inline void setzero() { clear(); }
+	inline void setsign(bool sign) { _sign = (sign && !iszero()); }
 	// use un-interpreted raw bits to set the bits of the adaptiveint
-	inline void setBits(unsigned long long value) {
-		clear();
+	inline void setbits(uint64_t value) {
+		convert_unsigned(value, *this);
 	}
 	inline adaptiveint& assign(const std::string& txt) {
+		if (!parse(txt, *this)) {
+			std::cerr << "unable to parse -" << txt << "- into an adaptiveint value\n";
+		}
 		return *this;
 	}
+	// set the magnitude from limbs, least significant limb first
+	inline void setlimbs(const std::vector<BlockType>& limbs, bool sign = false) {
+		assign_magnitude(limbs.data(), limbs.size());
+		normalize();
+		setsign(sign);
+	}
 
 	// selectors
-	inline bool iszero() const { return !sign && coef.size() == 0; }
-	inline bool isone() const  { return true; }
-	inline bool isodd() const  { return false; }
+	inline bool iszero() const { return _size == 0; }
+	inline bool isone() const  { return !_sign && _size == 1 && _inline[0] == 1; }
+	inline bool isodd() const  { return _size > 0 && (data()[0] & 0x1); }
 	inline bool iseven() const { return !isodd(); }
-	inline bool ispos() const  { return !sign; }
-	inline bool ineg() const   { return sign; }
-	inline int64_t scale() const { return exp + int64_t(coef.size()); }
-
-	// convert to string containing digits number of digits
-	std::string str(size_t nrDigits = 0) const {
-		if (iszero()) return std::string("0.0");
-
-		int64_t magnitude = scale();
-		if (magnitude > 1 || magnitude < 0) {
-			// use scientific notation for non-trivial exponent values
-			return sci_notation(nrDigits);
-		}
+	inline bool ispos() const  { return !_sign; }
+	inline bool isneg() const  { return _sign; }
+	inline bool sign() const   { return _sign; }
+	// true when the magnitude lives in the inline storage
+	inline bool isinline() const { return _size <= nrInlineBlocks; }
+	// number of limbs of the magnitude
+	inline size_t limbs() const { return _size; }
+	inline BlockType limb(size_t i) const { return (i < _size ? data()[i] : BlockType(0)); }
+	// position of the most significant bit of the magnitude, -1 for zero
+	inline int64_t scale() const {
+		if (_size == 0) return -1;
+		BlockType top = data()[_size - 1];
+		int64_t msb = int64_t(_size - 1) * int64_t(bitsInBlock);
+		while (top >>= 1) ++msb;
+		return msb;
+	}
 
-		std::string str;
-		int64_t exponent = trimmed(nrDigits, str);
+	long long to_long_long() const {
+		uint64_t m = to_ulong_long();
+		return (_sign ? static_cast<long long>(~m + 1) : static_cast<long long>(m));
+	}
+	// the least significant 64 bits of the magnitude
+	unsigned long long to_ulong_long() const {
+		uint64_t m{ 0 };
+		if (_size > 0) m = data()[0];
+		if (_size > 1) m |= uint64_t(data()[1]) << bitsInBlock;
+		return m;
+	}
 
-		if (magnitude == 0) {
-			if (sign)
-				return std::string("-0.0") + str;
-			else
-				return std::string("0.0") + str;
+	// convert to a decimal string
+	std::string str() const {
+		if (iszero()) return std::string("0");
+		// peel off nine decimal digits at a time
+		constexpr BlockType billion = 1'000'000'000u;
+		std::vector<BlockType> q(data(), data() + _size);
+		size_t n = _size;
+		std::vector<BlockType> segments;
+		while (n > 0) {
+			segments.push_back(internal::limb_divmod_1(q.data(), q.data(), n, billion));
+			n = internal::limb_trim(q.data(), n);
 		}
-
-		std::string before_decimal = std::to_string(coef.back());
-
-		if (exponent >= 0) {
-			if (sign)
-				return std::string("-") + before_decimal + ".0";
-			else
-				return before_decimal + ".0";
+		std::string digits = std::to_string(segments.back());
+		char segment[10];
+		for (size_t i = segments.size() - 1; i-- > 0;) {
+			std::snprintf(segment, sizeof(segment), "%09u", static_cast<unsigned>(segments[i]));
+			digits += segment;
 		}
-
-		// now the digits after the radix point
-		std::string after_decimal = str.substr((size_t)(str.size() + exponent), (size_t)-exponent);
-		if (sign)
-			return std::string("-") + before_decimal + "." + after_decimal;
-		else
-			return before_decimal + "." + after_decimal;
-
-		return std::string("bad");
+		return (_sign ? std::string("-") + digits : digits);
 	}
 
-	void test(bool _sign, int _exp, std::vector<BlockType>& _coef) {
-		sign = _sign;
-		coef = _coef;
-		exp = _exp;
-	}
 protected:
-	bool                   sign;  // sign of the number: -1 if true, +1 if false, zero is positive
-	int64_t                exp;   // exponent of the number
-	std::vector<BlockType> coef;  // coefficients of the polynomial
+	bool                   _sign;                     // sign of the number: -1 if true, +1 if false, zero is positive
+	size_t                 _size;                     // number of limbs of the magnitude
+	BlockType              _inline[nrInlineBlocks];   // storage of small magnitudes
+	std::vector<BlockType> _heap;                     // storage of magnitudes that exceed the inline storage
 
 	// HELPER methods
 
-	// convert to native floating-point, use conversion rules to cast down to float and double
-	long double toNativeFloatingPoint() const {
-		long double ld = 0;
-		return ld;
-	}
-
-	template<typename Ty>
-	adaptiveint& float_assign(Ty& rhs) {
-		clear();
-		long long base = (long long)rhs;
-		*this = base;
-		return *this;
-	}
+	inline BlockType* data() { return (_size <= nrInlineBlocks ? _inline : _heap.data()); }
+	inline const BlockType* data() const { return (_size <= nrInlineBlocks ? _inline : _heap.data()); }
 
-	// convert to string with nrDigits of significant digits and return the scale
-	// value = str + "10^" + scale
-	int64_t trimmed(size_t nrDigits, std::string& number) const {
-		if (coef.size() == 0) return 0;
-		int64_t exponent = exp;
-		size_t length = coef.size();
-		size_t index = 0; 
-		if (nrDigits == 0) {
-			nrDigits = length * 9;
+	// change the number of limbs, preserving the existing limbs and zeroing new ones
+	BlockType* resize(size_t n) {
+		if (n <= nrInlineBlocks) {
+			if (_size > nrInlineBlocks) std::copy(_heap.begin(), _heap.begin() + static_cast<std::ptrdiff_t>(n), _inline);
+			for (size_t i = std::min(_size, n); i < nrInlineBlocks; ++i) _inline[i] = 0;
+			_size = n;
+			return _inline;
+		}
+		if (_size <= nrInlineBlocks) {
+			_heap.assign(n, BlockType(0));
+			std::copy(_inline, _inline + _size, _heap.begin());
 		}
 		else {
-			size_t nrSegments = (nrDigits + 17) / 9;
-			if (nrSegments < length) {
-				index = length - nrSegments;
-				exponent += index;
-				length = nrSegments;
-			}
+			_heap.resize(n, BlockType(0));
+			std::fill(_heap.begin() + static_cast<std::ptrdiff_t>(_size < n ? _size : n), _heap.end(), BlockType(0));
 		}
-		exponent *= 9;
-		char segment[] = "012345678";
-		number.clear();
-		size_t i = length;
-		while (i-- > 0) {
-			BlockType w = coef[i];
-			for (int i = 8; i >= 0; --i) {
-				segment[i] = w % 10 + '0';
-				w /= 10;
-			}
-			number += segment;
+		_size = n;
+		return _heap.data();
+	}
+	// remove leading zero limbs, moving a magnitude that has become small to the inline storage
+	void normalize() {
+		size_t n = internal::limb_trim(data(), _size);
+		if (n != _size) resize(n);
+		if (_size == 0) _sign = false;
+	}
+	void assign_magnitude(const BlockType* a, size_t n) {
+		_size = 0;
+		BlockType* r = resize(n);
+		std::copy(a, a + n, r);
+	}
+	// |this| += |b|
+	void add_magnitude(const BlockType* b, size_t nb) {
+		if (_size + nb <= nrInlineBlocks) {
+			// at most one operand has two limbs: the sum fits the inline storage
+			uint64_t bvalue = (nb > 0 ? uint64_t(b[0]) : 0ull) | (nb > 1 ? uint64_t(b[1]) << bitsInBlock : 0ull);
+			uint64_t sum = uint64_t(to_ulong_long()) + bvalue;
+			_inline[0] = BlockType(sum);
+			_inline[1] = BlockType(sum >> bitsInBlock);
+			_size = nrInlineBlocks;
+			normalize();
+			return;
 		}
-
-		// process leading zeros
-		size_t lz = 0;
-		while (number[lz] == '0') ++lz;
-		nrDigits += lz;
-		if (nrDigits < number.size()) {
-			exponent += number.size() - nrDigits;
-			number.resize(nrDigits);
+		size_t n = std::max(_size, nb);
+		BlockType* r = resize(n + 1);
+		r[n] = internal::limb_add(r, r, n, b, nb);
+		normalize();
+	}
+	// |this| -= |b|, flipping the sign when |b| > |this|
+	void sub_magnitude(const BlockType* b, size_t nb) {
+		int cmp = internal::limb_compare(data(), _size, b, nb);
+		if (cmp == 0) {
+			setzero();
+			return;
 		}
-
-		return exponent;
+		if (cmp > 0) {
+			internal::limb_sub(data(), data(), _size, b, nb);
+		}
+		else {
+			std::vector<BlockType> difference(b, b + nb);
+			internal::limb_sub(difference.data(), difference.data(), nb, data(), _size);
+			assign_magnitude(difference.data(), nb);
+			_sign = !_sign;
+		}
+		normalize();
 	}
 
-	std::string sci_notation(size_t nrDigits) const {
-		if (coef.size() == 0) return std::string("0.0");
-		std::string str;
-		int64_t exponent = trimmed(nrDigits, str);
-		// remove leading zeros
-		str.erase(str.begin(), std::find_if(str.begin(), str.end(), [](int ch) { return (ch != '0'); }));
-		exponent += str.size() - 1;
-		str = str.substr(0, 1) + "." + &str[1];
-		if (exponent != 0) {
-			str += "*10^";
-			str += std::to_string(exponent);
+	// convert to native floating-point, use conversion rules to cast down to float and double
+	long double toNativeFloatingPoint() const {
+		long double ld = 0;
+		for (size_t i = _size; i-- > 0;) {
+			ld = ld * 4294967296.0l + static_cast<long double>(data()[i]);
 		}
-		if (sign) str = std::string("-") + str;
-		return str;
+		return (_sign ? -ld : ld);
+	}
+
+	// truncate a native floating-point value toward zero
+	template<typename Ty>
+	adaptiveint& float_assign(Ty rhs) {
+		clear();
+		if (rhs != rhs || std::fabs(rhs) == std::numeric_limits<Ty>::infinity()) return *this;
+		bool negative = (rhs < 0);
+		Ty magnitude = std::trunc(negative ? -rhs : rhs);
+		if (magnitude < Ty(1)) return *this;
+		int exponent{ 0 };
+		Ty fraction = std::frexp(magnitude, &exponent);  // magnitude = fraction * 2^exponent, fraction in [0.5, 1)
+		constexpr int digits = std::numeric_limits<Ty>::digits;
+		static_assert(digits <= 64, "float_assign supports native types with at most 64 digits");
+		uint64_t significand = static_cast<uint64_t>(std::ldexp(fraction, digits));
+		convert_unsigned(significand, *this);
+		*this <<= (exponent - digits);
+		setsign(negative);
+		return *this;
 	}
 
 private:
 
 	// adaptiveint - adaptiveint logic comparisons
 	friend bool operator==(const adaptiveint& lhs, const adaptiveint& rhs);
-
-	// adaptiveint - literal logic comparisons
-	friend bool operator==(const adaptiveint& lhs, const long long rhs);
-
-	// literal - adaptiveint logic comparisons
-	friend bool operator==(const long long lhs, const adaptiveint& rhs);
+	friend bool operator<(const adaptiveint& lhs, const adaptiveint& rhs);
 
 	// find the most significant bit set
 	friend signed findMsb(const adaptiveint& v);
+
+	friend inline adaptiveint& convert(int64_t v, adaptiveint& result);
+	friend inline adaptiveint& convert_unsigned(uint64_t v, adaptiveint& result);
+	friend inline bool parse(const std::string& number, adaptiveint& v);
+	friend inline void divide(const adaptiveint& a, const adaptiveint& b, adaptiveint& quotient, adaptiveint& remainder);
 };
 
 inline adaptiveint& convert(int64_t v, adaptiveint& result) {
-	if (0 == v) {
-		result.setzero();
-	}
-	else {
-		// convert 
-	}
+	// the magnitude of INT64_MIN is representable in uint64_t
+	uint64_t magnitude = (v < 0 ? ~static_cast<uint64_t>(v) + 1 : static_cast<uint64_t>(v));
+	convert_unsigned(magnitude, result);
+	result._sign = (v < 0);
 	return result;
 }
 
 inline adaptiveint& convert_unsigned(uint64_t v, adaptiveint& result) {
-	if (0 == v) {
-		result.setzero();
-	}
-	else {
-		// convert 
-	}
+	result._sign = false;
+	result._size = adaptiveint::nrInlineBlocks;
+	result._inline[0] = adaptiveint::BlockType(v);
+	result._inline[1] = adaptiveint::BlockType(v >> adaptiveint::bitsInBlock);
+	result.normalize();
 	return result;
 }
 
-////////////////////////    MPFLOAT functions   /////////////////////////////////
+////////////////////////    ADAPTIVEINT functions   /////////////////////////////////
 
 
 inline adaptiveint abs(const adaptiveint& a) {
-	return a; // (a < 0 ? -a : a);
+	return (a.isneg() ? -a : a);
 }
 
 
 // findMsb takes an adaptiveint reference and returns the position of the most significant bit, -1 if v == 0
 
 inline signed findMsb(const adaptiveint& v) {
-	return -1; // no significant bit found, all bits are zero
+	return signed(v.scale());
 }
 
 ////////////////////////    INTEGER operators   /////////////////////////////////
 
+// divide adaptiveint a and b and return the quotient and remainder of the truncating division:
+// the quotient rounds toward zero and the remainder has the sign of the dividend
+inline void divide(const adaptiveint& a, const adaptiveint& b, adaptiveint& quotient, adaptiveint& remainder) {
+	using BlockType = adaptiveint::BlockType;
+	if (b.iszero()) {
+#if ADAPTIVEINT_THROW_ARITHMETIC_EXCEPTION
+		throw adaptiveint_divide_by_zero{};
+#else
+		std::cerr << "adaptiveint_divide_by_zero\n";
+		quotient.setzero();
+		remainder.setzero();
+		return;
+#endif // ADAPTIVEINT_THROW_ARITHMETIC_EXCEPTION
+	}
+	bool quotientSign = (a._sign != b._sign);
+	bool remainderSign = a._sign;
+	if (internal::limb_compare(a.data(), a._size, b.data(), b._size) < 0) {
+		remainder = a;
+		quotient.setzero();
+		return;
+	}
+	adaptiveint q, r;
+	if (b._size == 1) {
+		// word-level short division
+		BlockType* qd = q.resize(a._size);
+		BlockType rem = internal::limb_divmod_1(qd, a.data(), a._size, b.data()[0]);
+		convert_unsigned(rem, r);
+	}
+	else {
+		BlockType* qd = q.resize(a._size - b._size + 1);
+		BlockType* rd = r.resize(b._size);
+		internal::limb_divmod(qd, rd, a.data(), a._size, b.data(), b._size);
+	}
+	q.normalize();
+	r.normalize();
+	q.setsign(quotientSign);
+	r.setsign(remainderSign);
+	quotient = std::move(q);
+	remainder = std::move(r);
+}
+
 // divide adaptiveint a and b and return result argument
+inline void divide(const adaptiveint& a, const adaptiveint& b, adaptiveint& quotient) {
+	adaptiveint remainder;
+	divide(a, b, quotient, remainder);
+}
 
-void divide(const adaptiveint& a, const adaptiveint& b, adaptiveint& quotient) {
+// calculate the remainder of adaptiveint a and b and return result argument
+inline void remainder(const adaptiveint& a, const adaptiveint& b, adaptiveint& remainder) {
+	adaptiveint quotient;
+	divide(a, b, quotient, remainder);
 }
 
 /// stream operators
 
-// read a adaptiveint ASCII format and make a binary adaptiveint out of it
+// read an adaptiveint in decimal, or in hexadecimal with a 0x prefix, with an optional sign
 
-bool parse(const std::string& number, adaptiveint& value) {
-	bool bSuccess = false;
+inline bool parse(const std::string& number, adaptiveint& value) {
+	using BlockType = adaptiveint::BlockType;
+	size_t pos = 0;
+	bool negative = false;
+	if (pos < number.size() && (number[pos] == '-' || number[pos] == '+')) {
+		negative = (number[pos] == '-');
+		++pos;
+	}
+	bool hex = (number.size() > pos + 1 && number[pos] == '0' && (number[pos + 1] == 'x' || number[pos + 1] == 'X'));
+	if (hex) pos += 2;
+	if (pos >= number.size()) return false;
+	adaptiveint result;
+	// accumulate chunks of digits that fit a limb: result = result * radix^n + chunk
+	const BlockType radix = (hex ? 16u : 10u);
+	const size_t chunk = (hex ? 7 : 9);
+	while (pos < number.size()) {
+		BlockType digits{ 0 }, scale{ 1 };
+		size_t count{ 0 };
+		while (count < chunk && pos < number.size()) {
+			char c = number[pos++];
+			BlockType d{ 0 };
+			if (c >= '0' && c <= '9') d = BlockType(c - '0');
+			else if (hex && c >= 'a' && c <= 'f') d = BlockType(c - 'a' + 10);
+			else if (hex && c >= 'A' && c <= 'F') d = BlockType(c - 'A' + 10);
+			else if (c == '\'') continue;  // digit separator
+			else return false;
+			digits = digits * radix + d;
+			scale *= radix;
+			++count;
+		}
+		result *= adaptiveint(scale);
+		result += adaptiveint(digits);
+	}
+	result.setsign(negative);
+	value = std::move(result);
+	return true;
+}
 
-	return bSuccess;
+// generate a decimal string
+inline std::string to_string(const adaptiveint& v) {
+	return v.str();
 }
 
 // generate an adaptiveint format ASCII format
@@ -345,12 +610,11 @@ inline std::ostream& operator<<(std::ostream& ostr, const adaptiveint& i) {
 	// we need to transform the adaptiveint into a string
 	std::stringstream ss;
 
-	std::streamsize prec = ostr.precision();
 	std::streamsize width = ostr.width();
 	std::ios_base::fmtflags ff;
 	ff = ostr.flags();
 	ss.flags(ff);
-	ss << std::setw(width) << std::setprecision(prec) << i.str(size_t(prec));
+	ss << std::setw(width) << i.str();
 
 	return ostr << ss.str();
 }
@@ -361,7 +625,7 @@ inline std::istream& operator>>(std::istream& istr, adaptiveint& p) {
 	std::string txt;
 	istr >> txt;
 	if (!parse(txt, p)) {
-		std::cerr << "unable to parse -" << txt << "- into a posit value\n";
+		std::cerr << "unable to parse -" << txt << "- into an adaptiveint value\n";
 	}
 	return istr;
 }
@@ -375,7 +639,7 @@ inline std::istream& operator>>(std::istream& istr, adaptiveint& p) {
 // equal: precondition is that the storage is properly nulled in all arithmetic paths
 
 inline bool operator==(const adaptiveint& lhs, const adaptiveint& rhs) {
-	return true;
+	return lhs._sign == rhs._sign && internal::limb_compare(lhs.data(), lhs._size, rhs.data(), rhs._size) == 0;
 }
 
 inline bool operator!=(const adaptiveint& lhs, const adaptiveint& rhs) {
@@ -383,7 +647,9 @@ inline bool operator!=(const adaptiveint& lhs, const adaptiveint& rhs) {
 }
 
 inline bool operator< (const adaptiveint& lhs, const adaptiveint& rhs) {
-	return false; // lhs and rhs are the same
+	if (lhs._sign != rhs._sign) return lhs._sign;
+	int cmp = internal::limb_compare(lhs.data(), lhs._size, rhs.data(), rhs._size);
+	return (lhs._sign ? cmp > 0 : cmp < 0);
 }
 
 inline bool operator> (const adaptiveint& lhs, const adaptiveint& rhs) {
@@ -487,6 +753,26 @@ inline adaptiveint operator/(const adaptiveint& lhs, const adaptiveint& rhs) {
 	ratio /= rhs;
 	return ratio;
 }
+// BINARY REMAINDER
+
+inline adaptiveint operator%(const adaptiveint& lhs, const adaptiveint& rhs) {
+	adaptiveint remainder = lhs;
+	remainder %= rhs;
+	return remainder;
+}
+// SHIFT OPERATORS
+
+inline adaptiveint operator<<(const adaptiveint& lhs, int shift) {
+	adaptiveint shifted = lhs;
+	shifted <<= shift;
+	return shifted;
+}
+
+inline adaptiveint operator>>(const adaptiveint& lhs, int shift) {
+	adaptiveint shifted = lhs;
+	shifted >>= shift;
+	return shifted;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // adaptiveint - literal binary arithmetic operators
@@ -510,6 +796,11 @@ inline adaptiveint operator*(const adaptiveint& lhs, const long long rhs) {
 inline adaptiveint operator/(const adaptiveint& lhs, const long long rhs) {
 	return operator/(lhs, adaptiveint(rhs));
 }
+// BINARY REMAINDER
+
+inline adaptiveint operator%(const adaptiveint& lhs, const long long rhs) {
+	return operator%(lhs, adaptiveint(rhs));
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // literal - adaptiveint binary arithmetic operators
@@ -533,5 +824,10 @@ inline adaptiveint operator*(const long long lhs, const adaptiveint& rhs) {
 inline adaptiveint operator/(const long long lhs, const adaptiveint& rhs) {
 	return operator/(adaptiveint(lhs), rhs);
 }
+// BINARY REMAINDER
+
+inline adaptiveint operator%(const long long lhs, const adaptiveint& rhs) {
+	return operator%(adaptiveint(lhs), rhs);
+}
 
 }} // namespace sw::universal
@@ -0,0 +1,289 @@
+#pragma once
+// limb_arithmetic.hpp: unsigned arithmetic kernels on little-endian vectors of 32-bit limbs
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <universal/number/shared/knuth_division.hpp>
+
+/*
+  The kernels operate on raw limb arrays with the least significant limb at index 0, so that
+  the adaptive precision types can run them on inline storage as well as on heap storage.
+  Products and quotients of limbs are developed in 64-bit words.
+
+  Multiplication dispatches on the size of the smaller operand: the schoolbook algorithm below
+  the Karatsuba threshold, Karatsuba up to the Toom-3 threshold, and Toom-3 above it. Unbalanced
+  operands are cut into pieces the size of the smaller operand. Division is Knuth's algorithm D,
+  with a single limb fast path.
+ */
+
+namespace sw { namespace universal { namespace internal {
+
+using limb = uint32_t;
+
+// number of significant limbs, that is, without leading zero limbs
+inline size_t limb_trim(const limb* a, size_t n) {
+	while (n > 0 && a[n - 1] == 0) --n;
+	return n;
+}
+
+// compare two magnitudes: -1 if a < b, 0 if equal, 1 if a > b
+inline int limb_compare(const limb* a, size_t na, const limb* b, size_t nb) {
+	na = limb_trim(a, na);
+	nb = limb_trim(b, nb);
+	if (na != nb) return (na < nb ? -1 : 1);
+	for (size_t i = na; i-- > 0;) {
+		if (a[i] != b[i]) return (a[i] < b[i] ? -1 : 1);
+	}
+	return 0;
+}
+
+// r = a + b with na >= nb, r has na limbs and may alias a; returns the carry out
+inline limb limb_add(limb* r, const limb* a, size_t na, const limb* b, size_t nb) {
+	uint64_t carry{ 0 };
+	size_t i = 0;
+	for (; i < nb; ++i) {
+		carry += uint64_t(a[i]) + b[i];
+		r[i] = limb(carry);
+		carry >>= 32;
+	}
+	for (; i < na; ++i) {
+		carry += a[i];
+		r[i] = limb(carry);
+		carry >>= 32;
+	}
+	return limb(carry);
+}
+
+// r = a - b with na >= nb, r has na limbs and may alias a; returns the borrow out
+inline limb limb_sub(limb* r, const limb* a, size_t na, const limb* b, size_t nb) {
+	uint64_t borrow{ 0 };
+	size_t i = 0;
+	for (; i < nb; ++i) {
+		uint64_t d = uint64_t(a[i]) - b[i] - borrow;
+		r[i] = limb(d);
+		borrow = (d >> 63);
+	}
+	for (; i < na; ++i) {
+		uint64_t d = uint64_t(a[i]) - borrow;
+		r[i] = limb(d);
+		borrow = (d >> 63);
+	}
+	return limb(borrow);
+}
+
+// r = a * b with the schoolbook algorithm, r has na + nb limbs and must not alias a or b
+inline void limb_mul_basecase(limb* r, const limb* a, size_t na, const limb* b, size_t nb) {
+	std::fill(r, r + na + nb, limb(0));
+	for (size_t j = 0; j < nb; ++j) {
+		uint64_t carry{ 0 };
+		uint64_t bj = b[j];
+		if (bj == 0) continue;
+		for (size_t i = 0; i < na; ++i) {
+			carry += uint64_t(a[i]) * bj + r[i + j];
+			r[i + j] = limb(carry);
+			carry >>= 32;
+		}
+		r[j + na] = limb(carry);
+	}
+}
+
+inline void limb_mul(limb* r, const limb* a, size_t na, const limb* b, size_t nb, size_t karatsubaThreshold, size_t toom3Threshold);
+
+// r = a * b for two operands of n limbs with Karatsuba's algorithm, r has 2n limbs
+inline void limb_mul_karatsuba(limb* r, const limb* a, const limb* b, size_t n, size_t karatsubaThreshold, size_t toom3Threshold) {
+	size_t h = n / 2;   // size of the low halves
+	size_t hh = n - h;  // size of the high halves, hh >= h
+	// z0 = a0 * b0 in r[0, 2h), z2 = a1 * b1 in r[2h, 2n)
+	limb_mul(r, a, h, b, h, karatsubaThreshold, toom3Threshold);
+	limb_mul(r + 2 * h, a + h, hh, b + h, hh, karatsubaThreshold, toom3Threshold);
+	// z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+	std::vector<limb> sa(hh + 1), sb(hh + 1), z1(2 * hh + 2);
+	sa[hh] = limb_add(sa.data(), a + h, hh, a, h);
+	sb[hh] = limb_add(sb.data(), b + h, hh, b, h);
+	limb_mul(z1.data(), sa.data(), hh + 1, sb.data(), hh + 1, karatsubaThreshold, toom3Threshold);
+	limb_sub(z1.data(), z1.data(), z1.size(), r, 2 * h);
+	limb_sub(z1.data(), z1.data(), z1.size(), r + 2 * h, 2 * hh);
+	// z1 < 2^(32 (n + 1)) fits in the 2n - h limbs above position h
+	limb_add(r + h, r + h, 2 * n - h, z1.data(), limb_trim(z1.data(), z1.size()));
+}
+
+// signed magnitude for the evaluation and interpolation of Toom-3
+struct toom_value {
+	std::vector<limb> mag;
+	bool negative{ false };
+
+	toom_value() = default;
+	toom_value(const limb* a, size_t n) : mag(a, a + limb_trim(a, n)) {}
+	void trim() {
+		mag.resize(limb_trim(mag.data(), mag.size()));
+		if (mag.empty()) negative = false;
+	}
+};
+
+inline toom_value toom_add(const toom_value& x, const toom_value& y, bool negateY = false) {
+	bool ysign = (y.negative != negateY);
+	const toom_value& big = (limb_compare(x.mag.data(), x.mag.size(), y.mag.data(), y.mag.size()) >= 0 ? x : y);
+	const toom_value& small = (&big == &x ? y : x);
+	bool bigSign = (&big == &x ? x.negative : ysign);
+	bool smallSign = (&big == &x ? ysign : x.negative);
+	toom_value r;
+	r.mag.resize(big.mag.size() + 1);
+	if (bigSign == smallSign) {
+		r.mag.back() = limb_add(r.mag.data(), big.mag.data(), big.mag.size(), small.mag.data(), small.mag.size());
+	}
+	else {
+		limb_sub(r.mag.data(), big.mag.data(), big.mag.size(), small.mag.data(), small.mag.size());
+	}
+	r.negative = bigSign;
+	r.trim();
+	return r;
+}
+
+inline toom_value toom_mul(const toom_value& x, const toom_value& y, size_t karatsubaThreshold, size_t toom3Threshold) {
+	toom_value r;
+	if (x.mag.empty() || y.mag.empty()) return r;
+	r.mag.resize(x.mag.size() + y.mag.size());
+	limb_mul(r.mag.data(), x.mag.data(), x.mag.size(), y.mag.data(), y.mag.size(), karatsubaThreshold, toom3Threshold);
+	r.negative = (x.negative != y.negative);
+	r.trim();
+	return r;
+}
+
+// multiply by 2^shift for shift < 32
+inline void toom_shl(toom_value& x, unsigned shift) {
+	limb carry{ 0 };
+	for (limb& w : x.mag) {
+		limb next = limb(w >> (32 - shift));
+		w = limb(w << shift) | carry;
+		carry = next;
+	}
+	if (carry) x.mag.push_back(carry);
+}
+
+// exact division by 2
+inline void toom_shr1(toom_value& x) {
+	for (size_t i = 0; i < x.mag.size(); ++i) {
+		x.mag[i] = (x.mag[i] >> 1) | (i + 1 < x.mag.size() ? limb(x.mag[i + 1] << 31) : limb(0));
+	}
+	x.trim();
+}
+
+// exact division by 3
+inline void toom_div3(toom_value& x) {
+	uint64_t rem{ 0 };
+	for (size_t i = x.mag.size(); i-- > 0;) {
+		uint64_t cur = (rem << 32) | x.mag[i];
+		x.mag[i] = limb(cur / 3);
+		rem = cur % 3;
+	}
+	x.trim();
+}
+
+// r = a * b for two operands of n >= 3 limbs with Toom-3, evaluated in 0, 1, -1, -2, and infinity, r has 2n limbs
+inline void limb_mul_toom3(limb* r, const limb* a, const limb* b, size_t n, size_t karatsubaThreshold, size_t toom3Threshold) {
+	size_t k = (n + 2) / 3;
+	toom_value a0(a, k), a1(a + k, k), a2(a + 2 * k, n - 2 * k);
+	toom_value b0(b, k), b1(b + k, k), b2(b + 2 * k, n - 2 * k);
+	auto evaluate = [](const toom_value& x0, const toom_value& x1, const toom_value& x2, toom_value& p1, toom_value& pm1, toom_value& pm2) {
+		toom_value t = toom_add(x0, x2);
+		p1 = toom_add(t, x1);
+		pm1 = toom_add(t, x1, true);
+		pm2 = toom_add(pm1, x2);
+		toom_shl(pm2, 1);
+		pm2 = toom_add(pm2, x0, true);
+	};
+	toom_value p1, pm1, pm2, q1, qm1, qm2;
+	evaluate(a0, a1, a2, p1, pm1, pm2);
+	evaluate(b0, b1, b2, q1, qm1, qm2);
+	toom_value r0 = toom_mul(a0, b0, karatsubaThreshold, toom3Threshold);
+	toom_value r1 = toom_mul(p1, q1, karatsubaThreshold, toom3Threshold);
+	toom_value rm1 = toom_mul(pm1, qm1, karatsubaThreshold, toom3Threshold);
+	toom_value rm2 = toom_mul(pm2, qm2, karatsubaThreshold, toom3Threshold);
+	toom_value rinf = toom_mul(a2, b2, karatsubaThreshold, toom3Threshold);
+	// interpolation sequence of Bodrato
+	toom_value c3 = toom_add(rm2, r1, true);
+	toom_div3(c3);
+	toom_value c1 = toom_add(r1, rm1, true);
+	toom_shr1(c1);
+	toom_value c2 = toom_add(rm1, r0, true);
+	c3 = toom_add(c2, c3, true);
+	toom_shr1(c3);
+	toom_value twiceInf = rinf;
+	toom_shl(twiceInf, 1);
+	c3 = toom_add(c3, twiceInf);
+	c2 = toom_add(c2, c1);
+	c2 = toom_add(c2, rinf, true);
+	c1 = toom_add(c1, c3, true);
+	// the coefficients of the product polynomial are non-negative
+	std::fill(r, r + 2 * n, limb(0));
+	const toom_value* coefficients[] = { &r0, &c1, &c2, &c3, &rinf };
+	for (size_t i = 0; i < 5; ++i) {
+		const std::vector<limb>& c = coefficients[i]->mag;
+		if (c.empty()) continue;
+		size_t offset = i * k;
+		limb_add(r + offset, r + offset, 2 * n - offset, c.data(), c.size());
+	}
+}
+
+// r = a * b, r has na + nb limbs and must not alias a or b
+inline void limb_mul(limb* r, const limb* a, size_t na, const limb* b, size_t nb, size_t karatsubaThreshold, size_t toom3Threshold) {
+	if (na < nb) {
+		std::swap(a, b);
+		std::swap(na, nb);
+	}
+	// Karatsuba recurses on ceil(n/2) + 1 limbs, which only shrinks the problem for n >= 4
+	if (nb < karatsubaThreshold || nb < 4) {
+		limb_mul_basecase(r, a, na, b, nb);
+		return;
+	}
+	if (na >= 2 * nb) {
+		// unbalanced: cut the larger operand into pieces the size of the smaller one
+		std::fill(r, r + na + nb, limb(0));
+		std::vector<limb> piece(2 * nb);
+		for (size_t i = 0; i < na; i += nb) {
+			size_t len = std::min(nb, na - i);
+			limb_mul(piece.data(), a + i, len, b, nb, karatsubaThreshold, toom3Threshold);
+			limb_add(r + i, r + i, na + nb - i, piece.data(), len + nb);
+		}
+		return;
+	}
+	if (na != nb) {
+		// pad the smaller operand: the product has at most na + nb significant limbs
+		std::vector<limb> padded(na, limb(0)), product(2 * na);
+		std::copy(b, b + nb, padded.begin());
+		limb_mul(product.data(), a, na, padded.data(), na, karatsubaThreshold, toom3Threshold);
+		std::copy(product.begin(), product.begin() + static_cast<std::ptrdiff_t>(na + nb), r);
+		return;
+	}
+	if (na >= toom3Threshold && na >= 3) {
+		limb_mul_toom3(r, a, b, na, karatsubaThreshold, toom3Threshold);
+	}
+	else {
+		limb_mul_karatsuba(r, a, b, na, karatsubaThreshold, toom3Threshold);
+	}
+}
+
+// q = a / d with na limbs, q may alias a; returns the remainder
+inline limb limb_divmod_1(limb* q, const limb* a, size_t na, limb d) {
+	uint64_t rem{ 0 };
+	for (size_t i = na; i-- > 0;) {
+		uint64_t cur = (rem << 32) | a[i];
+		q[i] = limb(cur / d);
+		rem = cur % d;
+	}
+	return limb(rem);
+}
+
+// Knuth's algorithm D: q = u / v and r = u % v for m >= n >= 2 and v[n - 1] != 0.
+// q has m - n + 1 limbs and r has n limbs
+inline void limb_divmod(limb* q, limb* r, const limb* u, size_t m, const limb* v, size_t n) {
+	std::vector<limb> un(m + 1), vn(n);
+	knuth_divmod(q, r, u, m, v, n, un.data(), vn.data());
+}
+
+}}} // namespace sw::universal::internal
@@ -6,6 +6,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <cassert>
 #include <limits>
+#include <type_traits>
 
 #include <universal/native/ieee754.hpp>
 #include <universal/native/subnormal.hpp>
@@ -60,6 +61,9 @@
 
 #endif
 
+// the arithmetic engine shared with cfloat
+#include <universal/internal/blocktriple/blocktriple.hpp>
+
 #ifndef THROW_ARITHMETIC_EXCEPTION
 #define THROW_ARITHMETIC_EXCEPTION 0
 #endif
@@ -104,6 +108,91 @@ int scale(const areal<nbits, es, bt>& v) {
 	return v.scale();
 }
 
+/// <summary>
+/// convert a blocktriple to an areal. The value is truncated toward zero, and the uncertainty
+/// bit is set when non-zero bits are truncated, so that the areal is the open interval between
+/// two adjacent areal values that contains the blocktriple value. Values beyond the dynamic range
+/// map to (maxpos, inf) or (0, minpos), and their negative counterparts.
+/// </summary>
+/// <param name="src">unrounded result of an arithmetic operation</param>
+/// <param name="tgt">areal that receives the truncated value and uncertainty bit</param>
+template<size_t srcbits, typename sbt, size_t nbits, size_t es, typename bt>
+inline void convert(const blocktriple<srcbits, sbt>& src, areal<nbits, es, bt>& tgt) {
+	using Areal = areal<nbits, es, bt>;
+	constexpr size_t fbits = Areal::fbits;
+	static_assert(srcbits >= fbits, "blocktriple must carry at least the fraction bits of the areal");
+	if (src.isnan()) {
+		tgt.setnan(src.sign() ? NAN_TYPE_SIGNALLING : NAN_TYPE_QUIET);
+		return;
+	}
+	if (src.isinf()) {
+		tgt.setinf(src.sign());
+		return;
+	}
+	if (src.iszero()) {
+		tgt.setzero();
+		tgt.set(nbits - 1ull, src.sign());
+		return;
+	}
+	constexpr uint64_t maxBiasedExponent = (1ull << es) - 1ull;
+	constexpr int maxScale = int(maxBiasedExponent) - Areal::EXP_BIAS;
+	bool s = src.sign();
+	int scale = src.scale();
+	if (scale > maxScale) {
+		if (s) tgt.maxneg(); else tgt.maxpos();
+		tgt.set(0);
+		return;
+	}
+	// the significant has its hidden bit at srcbits: the bits below the areal lsb are truncated
+	int shift = int(srcbits) - int(fbits);
+	uint64_t biasedExponent{ 0 };
+	if (scale < Areal::MIN_EXP_NORMAL) {
+		shift += Areal::MIN_EXP_NORMAL - scale;  // subnormal: the hidden bit moves into the fraction
+	}
+	else {
+		biasedExponent = uint64_t(scale + Areal::EXP_BIAS);
+	}
+	auto significant = src.significant();
+	bool ubit = (shift > 0 && significant.any(size_t(shift - 1)));
+	significant >>= shift;
+	if constexpr (nbits < 65) {
+		constexpr uint64_t fractionMask = (1ull << fbits) - 1ull;
+		uint64_t fraction{ 0 };
+		for (size_t i = 0; i < significant.nrBlocks && i * significant.bitsInBlock < 64; ++i) {
+			fraction |= uint64_t(significant.block(i)) << (i * significant.bitsInBlock);
+		}
+		fraction &= fractionMask;
+		if (biasedExponent == maxBiasedExponent && fraction == fractionMask) {
+			// the all ones encoding is reserved for inf and nan
+			if (s) tgt.maxneg(); else tgt.maxpos();
+			tgt.set(0);
+			return;
+		}
+		uint64_t raw = (s ? 1ull : 0ull);
+		raw <<= es;
+		raw |= biasedExponent;
+		raw <<= fbits;
+		raw |= fraction;
+		raw <<= 1;
+		raw |= (ubit ? 1ull : 0ull);
+		tgt.setbits(raw);
+	}
+	else {
+		bool allOnes = (biasedExponent == maxBiasedExponent);
+		for (size_t i = 0; i < fbits && allOnes; ++i) allOnes = significant.at(i);
+		if (allOnes) {
+			if (s) tgt.maxneg(); else tgt.maxpos();
+			tgt.set(0);
+			return;
+		}
+		tgt.clear();
+		tgt.set(nbits - 1ull, s);
+		for (size_t i = 0; i < es; ++i) tgt.set(1ull + fbits + i, (biasedExponent >> i) & 1ull);
+		for (size_t i = 0; i < fbits; ++i) tgt.set(1ull + i, significant.at(i));
+		tgt.set(0, ubit);
+	}
+}
+
 /// <summary>
 /// An arbitrary configuration real number with gradual under/overflow and uncertainty bit
 /// </summary>
@@ -147,6 +236,8 @@ public:
 	static constexpr bt BLOCK_MASK = bt(-1);
 
 	using BlockType = bt;
+	// the blockfraction carry propagation needs a block type smaller than uint64_t
+	using TripleBlockType = std::conditional_t<(bitsInBlock < 64), bt, uint32_t>;
 
 	// constructors
 	constexpr areal() noexcept : _block{ 0 } {};
@@ -591,28 +682,153 @@ public:
 		return tmp;
 	}
 
+	// The arithmetic operators compute the operation on the values of the encodings, that is,
+	// the lower bounds of the intervals, and truncate the result toward zero. The uncertainty
+	// bit of the result is set when the truncation is inexact or when an operand is uncertain.
 	areal& operator+=(const areal& rhs) {
+		if (isnan(NAN_TYPE_SIGNALLING) || rhs.isnan(NAN_TYPE_SIGNALLING)) {
+			setnan(NAN_TYPE_SIGNALLING);
+			return *this;
+		}
+		if (isnan(NAN_TYPE_QUIET) || rhs.isnan(NAN_TYPE_QUIET)) {
+			setnan(NAN_TYPE_QUIET);
+			return *this;
+		}
+		// inf + inf = inf, inf + -inf = nan
+		if (isinf()) {
+			if (rhs.isinf() && sign() != rhs.sign()) setnan(NAN_TYPE_QUIET);
+			return *this;
+		}
+		if (rhs.isinf()) {
+			*this = rhs;
+			return *this;
+		}
+		bool ubit = at(0) || rhs.at(0);
+		if (rhs.ismagnitudezero()) {
+			if (ismagnitudezero()) set(nbits - 1ull, sign() && rhs.sign());
+			set(0, ubit);
+			return *this;
+		}
+		if (ismagnitudezero()) {
+			*this = rhs;
+			set(0, ubit);
+			return *this;
+		}
+
+		// the significants have their hidden bit at abits with four zero bits below the fraction
+		blocktriple<abits, TripleBlockType> a, b, sum;
+		normalizeAddition(a);
+		rhs.normalizeAddition(b);
+		// align the smaller operand to the larger and replace the bits below bit 2 by a sticky bit:
+		// the sticky bit keeps the sum off the truncation grid when bits are lost, and bit 0 stays
+		// clear so that the normalization of a carry in add() is exact
+		blocktriple<abits, TripleBlockType>& smaller = (a.scale() < b.scale() ? a : b);
+		int shift = std::abs(a.scale() - b.scale());
+		if (shift > 0) {
+			bool sticky = smaller._significant.any(static_cast<size_t>(shift) + 1ull);
+			smaller.align(shift);
+			smaller.setbit(0, false);
+			smaller.setbit(1, sticky);
+		}
+		sum.add(a, b);
+		convert(sum, *this);
+		if (ubit && !isnan() && !isinf()) set(0);
 		return *this;
 	}
 	areal& operator+=(double rhs) {
 		return *this += areal(rhs);
 	}
 	areal& operator-=(const areal& rhs) {
-
-		return *this;
+		if (rhs.isnan()) return *this += rhs;
+		return *this += -rhs;
 	}
 	areal& operator-=(double rhs) {
 		return *this -= areal<nbits, es>(rhs);
 	}
 	areal& operator*=(const areal& rhs) {
+		if (isnan(NAN_TYPE_SIGNALLING) || rhs.isnan(NAN_TYPE_SIGNALLING)) {
+			setnan(NAN_TYPE_SIGNALLING);
+			return *this;
+		}
+		if (isnan(NAN_TYPE_QUIET) || rhs.isnan(NAN_TYPE_QUIET)) {
+			setnan(NAN_TYPE_QUIET);
+			return *this;
+		}
+		bool resultSign = sign() != rhs.sign();
+		// inf * 0 = nan, inf * x = inf
+		if (isinf() || rhs.isinf()) {
+			if (ismagnitudezero() || rhs.ismagnitudezero()) {
+				setnan(NAN_TYPE_QUIET);
+			}
+			else {
+				setinf(resultSign);
+			}
+			return *this;
+		}
+		if (ismagnitudezero() || rhs.ismagnitudezero()) {
+			// an exact zero factor makes the product exact
+			bool ubit = !((ismagnitudezero() && !at(0)) || (rhs.ismagnitudezero() && !rhs.at(0)));
+			setzero();
+			set(nbits - 1ull, resultSign);
+			set(0, ubit);
+			return *this;
+		}
+		bool ubit = at(0) || rhs.at(0);
 
+		// right-aligned significants with fbits fraction bits: the product is exact in mbits
+		blocktriple<mbits, TripleBlockType> a, b, product;
+		normalizeMultiplication(a);
+		rhs.normalizeMultiplication(b);
+		product.mul(a, b, static_cast<int>(fbits));
+		convert(product, *this);
+		if (ubit && !isnan() && !isinf()) set(0);
 		return *this;
 	}
 	areal& operator*=(double rhs) {
 		return *this *= areal<nbits, es>(rhs);
 	}
 	areal& operator/=(const areal& rhs) {
+		if (isnan(NAN_TYPE_SIGNALLING) || rhs.isnan(NAN_TYPE_SIGNALLING)) {
+			setnan(NAN_TYPE_SIGNALLING);
+			return *this;
+		}
+		if (isnan(NAN_TYPE_QUIET) || rhs.isnan(NAN_TYPE_QUIET)) {
+			setnan(NAN_TYPE_QUIET);
+			return *this;
+		}
+		bool resultSign = sign() != rhs.sign();
+		if (rhs.ismagnitudezero()) {
+#if AREAL_THROW_ARITHMETIC_EXCEPTION
+			throw areal_divide_by_zero();
+#else
+			if (ismagnitudezero()) setnan(NAN_TYPE_QUIET); else setinf(resultSign);
+			return *this;
+#endif
+		}
+		// inf / inf = nan, inf / x = inf, x / inf = 0
+		if (isinf()) {
+			if (rhs.isinf()) setnan(NAN_TYPE_QUIET); else setinf(resultSign);
+			return *this;
+		}
+		if (rhs.isinf()) {
+			setzero();
+			set(nbits - 1ull, resultSign);
+			return *this;
+		}
+		bool ubit = at(0) || rhs.at(0);
+		if (ismagnitudezero()) {
+			// only the uncertainty of the dividend matters
+			set(nbits - 1ull, resultSign);
+			return *this;
+		}
 
+		// the quotient is developed to abits fraction bits with the remainder jammed into the lsb
+		blocktriple<abits, TripleBlockType> a, b, quotient;
+		normalizeAddition(a);
+		rhs.normalizeAddition(b);
+		quotient.div(a, b);
+		convert(quotient, *this);
+		if (ubit && !isnan() && !isinf()) set(0);
 		return *this;
 	}
 	areal& operator/=(double rhs) {
@@ -1148,6 +1364,77 @@ public:
 protected:
 	// HELPER methods
 
+	// true for the encodings 0 and (0, minpos), that is, the exponent and fraction fields are zero
+	inline constexpr bool ismagnitudezero() const noexcept {
+		for (size_t i = 1; i < nbits - 1ull; ++i) {
+			if (at(i)) return false;
+		}
+		return true;
+	}
+
+	// normalize the value of the encoding, ignoring the uncertainty bit, to a blocktriple
+	// with the hidden bit of the significant at bit radix. The encoding must be finite and non-zero.
+	template<size_t tgtbits, typename tbt>
+	constexpr void normalize(blocktriple<tgtbits, tbt>& tgt, int radix) const noexcept {
+		tgt.setnormal();
+		tgt.setsign(sign());
+		if constexpr (nbits < 65) {
+			constexpr uint64_t fractionMask = (1ull << fbits) - 1ull;
+			constexpr uint64_t exponentMask = (1ull << es) - 1ull;
+			uint64_t raw{ 0 };
+			for (size_t i = 0; i < nrBlocks; ++i) raw |= uint64_t(_block[i]) << (i * bitsInBlock);
+			uint64_t fraction = (raw >> 1) & fractionMask;
+			uint64_t biasedExponent = (raw >> (1ull + fbits)) & exponentMask;
+			int scale{ 0 };
+			if (biasedExponent == 0) {
+				// subnormal: normalize the fraction so that its msb becomes the hidden bit
+				int msb = static_cast<int>(fbits) - 1;
+				while (!(fraction & (1ull << msb))) --msb;
+				fraction <<= (static_cast<int>(fbits) - msb);
+				scale = MIN_EXP_NORMAL - (static_cast<int>(fbits) - msb);
+			}
+			else {
+				fraction |= (1ull << fbits);
+				scale = static_cast<int>(biasedExponent) - EXP_BIAS;
+			}
+			tgt.setbits(fraction);
+			tgt.align(static_cast<int>(fbits) - radix);  // a left shift when radix > fbits
+			tgt.setscale(scale);
+		}
+		else {
+			uint64_t biasedExponent{ 0 };
+			for (size_t i = 0; i < es; ++i) biasedExponent |= uint64_t(at(1ull + fbits + i)) << i;
+			int scale{ 0 };
+			int shift{ 0 };
+			if (biasedExponent == 0) {
+				int msb = static_cast<int>(fbits) - 1;
+				while (!at(1ull + size_t(msb))) --msb;
+				shift = static_cast<int>(fbits) - msb;
+				scale = MIN_EXP_NORMAL - shift;
+			}
+			else {
+				scale = static_cast<int>(biasedExponent) - EXP_BIAS;
+			}
+			tgt.setbits(0);
+			int offset = radix - static_cast<int>(fbits) + shift;
+			for (size_t i = 0; i < fbits; ++i) {
+				if (at(1ull + i)) tgt.setbit(size_t(int(i) + offset));
+			}
+			tgt.setbit(size_t(radix));
+			tgt.setscale(scale);
+		}
+	}
+	// significant in the form 01.ffff0000 with the hidden bit at abits
+	template<typename tbt>
+	constexpr void normalizeAddition(blocktriple<abits, tbt>& tgt) const noexcept {
+		normalize(tgt, static_cast<int>(abits));
+	}
+	// right-aligned significant in the form 0...01.ffff with fbits fraction bits
+	template<typename tbt>
+	constexpr void normalizeMultiplication(blocktriple<mbits, tbt>& tgt) const noexcept {
+		normalize(tgt, static_cast<int>(fbits));
+	}
+
 	/// <summary>
 	/// round a set of source bits to the present representation.
 	/// srcbits is the number of bits of significant in the source representation
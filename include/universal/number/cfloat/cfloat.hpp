@@ -28,13 +28,6 @@
 #define CFLOAT_THROW_ARITHMETIC_EXCEPTION 0
 #endif
 
-////////////////////////////////////////////////////////////////////////////////////////
-// enable native sqrt implementation
-// 
-#if !defined(CFLOAT_NATIVE_SQRT)
-#define CFLOAT_NATIVE_SQRT 0
-#endif
-
 ////////////////////////////////////////////////////////////////////////////////////////
 /// INCLUDE FILES that make up the library
 #include <universal/number/cfloat/cfloat_impl.hpp>
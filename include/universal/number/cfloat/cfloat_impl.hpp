@@ -127,8 +127,10 @@ inline /*constexpr*/ void convert(const blocktriple<srcbits, bt>& src,
 	}
 	else {
 		int64_t scale   = src.scale();
-		if (scale < cfloatType::MIN_EXP_SUBNORMAL) {
+		if (scale < cfloatType::MIN_EXP_SUBNORMAL - 1) {
+			// below half the smallest subnormal: underflow to a signed zero
 			tgt.setzero();
+			tgt.setsign(src.sign());
 			return;
 		}
 		if (scale > cfloatType::MAX_EXP) {
@@ -151,13 +153,18 @@ inline /*constexpr*/ void convert(const blocktriple<srcbits, bt>& src,
 			// we can use a uint64_t to construct the cfloat
 			uint64_t raw = (src.sign() ? 1ull : 0ull);
 			raw <<= es; // shift left to make room for the exponent bits
-			if (scale >= cfloatType::MIN_EXP_SUBNORMAL && scale < cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>::MIN_EXP_NORMAL) {
+			if (scale < cfloatType::MIN_EXP_NORMAL) {
 				// resulting cfloat will be a subnormal number: all exponent bits are 0
 				raw <<= cfloatType::fbits;
 				int rightShift = cfloatType::MIN_EXP_NORMAL - static_cast<int>(scale);
 				uint64_t fracbits = (1ull << srcbits) | src.fraction_ull(); // add the hidden bit explicitely as it will shift into the msb of the denorm
-				//uint64_t fracbits = src.fraction_ull();
-				fracbits >>= rightShift + (srcbits - cfloatType::fbits);
+				// round to nearest even on the bits that are shifted away
+				int shift = rightShift + static_cast<int>(srcbits - cfloatType::fbits);
+				bool lsb    = (shift < 64) && (fracbits & (1ull << shift));
+				bool guard  = (shift < 65) && (fracbits & (1ull << (shift - 1)));
+				bool sticky = (shift > 64) || (fracbits & ((1ull << (shift - 1)) - 1ull));
+				fracbits = (shift < 64 ? (fracbits >> shift) : 0ull);
+				fracbits += (guard && (lsb || sticky)) ? 1ull : 0ull; // a carry out lands in the exponent field as the smallest normal
 				raw |= fracbits;
 				tgt.setbits(raw);
 			}
@@ -437,6 +444,46 @@ public:
 		return *this -= cfloat(rhs);
 	}
 	cfloat& operator*=(const cfloat& rhs) {
+		// special case handling of the inputs
+#if CFLOAT_THROW_ARITHMETIC_EXCEPTION
+		if (isnan(NAN_TYPE_SIGNALLING) || rhs.isnan(NAN_TYPE_SIGNALLING)) {
+			throw cfloat_operand_is_nan{};
+		}
+#else
+		if (isnan(NAN_TYPE_SIGNALLING) || rhs.isnan(NAN_TYPE_SIGNALLING)) {
+			setnan(NAN_TYPE_SIGNALLING);
+			return *this;
+		}
+		if (isnan(NAN_TYPE_QUIET) || rhs.isnan(NAN_TYPE_QUIET)) {
+			setnan(NAN_TYPE_QUIET);
+			return *this;
+		}
+#endif
+		bool resultSign = sign() != rhs.sign();
+		// inf * 0 = nan, inf * x = inf
+		if (isinf() || rhs.isinf()) {
+			if (iszero() || rhs.iszero()) {
+				setnan(NAN_TYPE_QUIET);
+			}
+			else {
+				setinf(resultSign);
+			}
+			return *this;
+		}
+		if (iszero() || rhs.iszero()) {
+			setzero();
+			setsign(resultSign);
+			return *this;
+		}
+
+		// right-aligned significants with fbits fraction bits: the product is exact in mbits
+		blocktriple<mbits, bt> a, b, product;
+		normalizeMultiplication(a);
+		rhs.normalizeMultiplication(b);
+		product.mul(a, b, static_cast<int>(fbits));
+
+		convert(product, *this);
+
 		return *this;
 	}
 	cfloat& operator*=(double rhs) {
@@ -1473,6 +1520,39 @@ public:
 		}
 	}
 
+	// normalize a non-special cfloat to a blocktriple with the hidden bit of the significant at bit radix
+	template<size_t tgtbits>
+	constexpr void normalize(blocktriple<tgtbits, bt>& tgt, int radix) const {
+		tgt.setnormal(); // a blocktriple is always normalized
+		tgt.setsign(sign());
+		int scale = this->scale();
+		if constexpr (fbits < 64) {
+			uint64_t raw = fraction_ull();
+			if (isnormal()) {
+				raw |= (1ull << fbits);
+			}
+			else {
+				raw <<= (MIN_EXP_NORMAL - scale); // the msb of the subnormal fraction becomes the hidden bit
+			}
+			tgt.setbits(raw);
+		}
+		else {
+			int shift = (isnormal() ? 0 : MIN_EXP_NORMAL - scale);
+			tgt.setbits(0);
+			for (size_t i = 0; i < fbits; ++i) {
+				if (at(i)) tgt.setbit(i + static_cast<size_t>(shift));
+			}
+			tgt.setbit(fbits);
+		}
+		tgt.align(static_cast<int>(fbits) - radix);  // a left shift when radix > fbits
+		tgt.setscale(scale);
+	}
+
+	// normalize a cfloat to a right-aligned significant 0...01.ffff with fbits fraction bits used in mul
+	constexpr void normalizeMultiplication(blocktriple<mbits, bt>& tgt) const {
+		normalize(tgt, static_cast<int>(fbits));
+	}
+
 	// normalize a cfloat to a blocktriple used in add/sub
 	constexpr void normalizeAddition(blocktriple<abits, bt>& tgt) const {
 		// test special cases
@@ -2283,6 +2363,72 @@ inline cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating> opera
 	return ratio;
 }
 
+// FMA: fused multiply-add: a * b + c with a single rounding
+// The product of the significants is exact, the addend is aligned to it with the bits that are
+// shifted away folded into a sticky bit, and the sum is rounded once to the target cfloat.
+template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+inline cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating> fma(const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& a, const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& b, const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& c) {
+	using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+	constexpr size_t fbits = Cfloat::fbits;
+	// the product has 2 * fbits + 1 fraction bits: the two extra bits keep its lsb clear of the sticky bit
+	constexpr size_t fmabits = Cfloat::mbits + 2;
+
+	Cfloat result;
+	// special case handling of the inputs
+	if (a.isnan() || b.isnan() || c.isnan()) {
+		bool signalling = a.isnan(NAN_TYPE_SIGNALLING) || b.isnan(NAN_TYPE_SIGNALLING) || c.isnan(NAN_TYPE_SIGNALLING);
+#if CFLOAT_THROW_ARITHMETIC_EXCEPTION
+		if (signalling) throw cfloat_operand_is_nan{};
+#endif
+		result.setnan(signalling ? NAN_TYPE_SIGNALLING : NAN_TYPE_QUIET);
+		return result;
+	}
+	bool productSign = a.sign() != b.sign();
+	// inf * 0 = nan, inf - inf = nan
+	if (a.isinf() || b.isinf()) {
+		if (a.iszero() || b.iszero() || (c.isinf() && c.sign() != productSign)) {
+			result.setnan(NAN_TYPE_QUIET);
+		}
+		else {
+			result.setinf(productSign);
+		}
+		return result;
+	}
+	if (c.isinf()) return c;
+	if (a.iszero() || b.iszero()) {
+		if (!c.iszero()) return c;
+		result.setzero();
+		result.setsign(productSign && c.sign()); // the sum of zeros is -0 only when both are -0
+		return result;
+	}
+
+	// the product of the right-aligned significants is exact
+	blocktriple<fmabits, bt> ta, tb, product;
+	a.normalize(ta, static_cast<int>(fbits));
+	b.normalize(tb, static_cast<int>(fbits));
+	product.mul(ta, tb, static_cast<int>(fbits));
+	if (c.iszero()) {
+		convert(product, result);
+		return result;
+	}
+
+	// align the smaller operand to the larger and replace the bits below bit 2 by a sticky bit
+	blocktriple<fmabits, bt> addend, sum;
+	c.normalize(addend, static_cast<int>(fmabits));
+	blocktriple<fmabits, bt>& smaller = (product.scale() < addend.scale() ? product : addend);
+	int shift = std::abs(product.scale() - addend.scale());
+	if (shift > 0) {
+		bool sticky = smaller._significant.any(static_cast<size_t>(shift) + 1ull);
+		smaller.align(shift);
+		smaller.setbit(0, false);
+		smaller.setbit(1, sticky);
+	}
+	sum.add(product, addend);
+
+	convert(sum, result);  // one and only rounding step
+	return result;
+}
+
 // encoding helpers
 
 // return the Unit in the Last Position
@@ -0,0 +1,31 @@
+#pragma once
+// minimax_tables.hpp: minimax polynomial kernels of the elementary functions for classic floats
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+/*
+ The coefficient tables are generated by applications/chebyshev/minimax.cpp and loaded with
+ sw::function::polynomial_kernel<Scalar, Degree>::from_table(center, coefficients).
+ The coefficients are values of the target format, written as exact double literals.
+ Regenerate the tables after a change to the generator.
+ */
+
+namespace sw { namespace universal {
+
+// exp(x) on [-ln2/2, ln2/2] for cfloat<32,8>
+// p(x) = sum_j exp_cfloat32_coefficients[j] * (x - exp_cfloat32_center)^j
+constexpr double exp_cfloat32_center = 0x0p+0;
+constexpr double exp_cfloat32_coefficients[7] = {
+	0x1p+0,   // c0 = 1
+	0x1p+0,   // c1 = 1
+	0x1.fffffcp-2,   // c2 = 0.49999994039535522
+	0x1.555494p-3,   // c3 = 0.16666522622108459
+	0x1.5558dap-5,   // c4 = 0.041668344289064407
+	0x1.123deap-7,   // c5 = 0.0083691971376538277
+	0x1.6a4adcp-10    // c6 = 0.0013820359017699957
+};
+// largest relative error of exp on [-4, 4] : 1.6151459246583689e-07
+
+}} // namespace sw::universal
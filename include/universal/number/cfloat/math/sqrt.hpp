@@ -4,44 +4,13 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <bit>
 #include <universal/native/ieee754.hpp>
 #include <universal/number/cfloat/math/sqrt_tables.hpp>
-
-#ifndef CFLOAT_NATIVE_SQRT
-#define CFLOAT_NATIVE_SQRT 0
-#endif
+#include <universal/number/shared/significand_sqrt.hpp>
 
 namespace sw::universal {
 
-/*
-	// straight Babylonian
-	inline double babylonian(double v) {
-		double x_n = 0.5 * v; // initial guess
-		const double eps = 1.0e-7;   // 
-		do {
-			x_n = (x_n + v / x_n) / 2.0;
-		} while (std::abs(x_n * x_n - v) > eps);
-
-		return x_n;
-	}
-*/
-
-	template<size_t nbits, size_t es, typename bt>
-	inline cfloat<nbits, es, bt> BabylonianMethod(const cfloat<nbits, es, bt>& v) {
-		const double eps = 1.0e-5;
-		cfloat<nbits, es, bt> half(0.5);
-		cfloat<nbits, es, bt> x_next;
-		cfloat<nbits, es, bt> x_n = half * v;
-		cfloat<nbits, es, bt> diff;
-		do {
-			x_next = (x_n + v / x_n) * half;
-			diff = x_next - x_n;
-			   std::cout << " x_n+1: " << x_next << " x_n: " << x_n << " diff " << diff << std::endl;
-			x_n = x_next;
-		} while (double(sw::universal::abs(diff)) > eps);
-		return x_n;
-	}
-
 	/*
 	- Consider the function argument, x, in floating-point form, with a base
 	(or radix) B, exponent e, and a fraction, f , such that 1/B <= f < 1.
@@ -74,25 +43,116 @@ namespace sw::universal {
 	*/
 
 
-#if CFLOAT_NATIVE_SQRT
-	// sqrt for arbitrary cfloat
-	template<size_t nbits, size_t es, typename bt>
-	inline cfloat<nbits, es, bt> sqrt(const cfloat<nbits, es, bt>& a) {
-
-		return a;
-	}
-#else
-	template<size_t nbits, size_t es, typename bt>
-	inline cfloat<nbits, es, bt> sqrt(const cfloat<nbits, es, bt>& a) {
-		return cfloat<nbits, es, bt>(std::sqrt((double)a));
+	namespace internal {
+
+		// the significand of a positive, finite, nonzero cfloat of at most 64 bits as X = x * 2^62 with x in [1, 4),
+		// and the even scale; subnormals are normalized first
+		template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+		inline uint64_t cfloat_significand(const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& a, int& scale) {
+			using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+			constexpr size_t fbits = Cfloat::fbits;
+			uint64_t raw{ 0 };
+			for (size_t b = 0; b < Cfloat::nrBlocks; ++b) raw |= uint64_t(a.block(b)) << (b * Cfloat::bitsInBlock);
+			uint64_t fraction = raw & (0xFFFF'FFFF'FFFF'FFFFull >> (64 - fbits));
+			int exponent = int((raw >> fbits) & ((uint64_t(1) << es) - 1));
+			if (exponent == 0) {
+				int lead = 63 - std::countl_zero(fraction);
+				scale = Cfloat::MIN_EXP_NORMAL - int(fbits) + lead;
+				fraction = (lead > 0 ? fraction << (64 - lead) : 0);
+			}
+			else {
+				scale = exponent - Cfloat::EXP_BIAS;
+				fraction <<= (64 - fbits);
+			}
+			if (scale & 1) {
+				--scale;
+				return (uint64_t(1) << 63) | (fraction >> 1);
+			}
+			return (uint64_t(1) << 62) | (fraction >> 2);
+		}
+
+		// round a positive value 2^scale * significand / 2^63, with the significand msb at bit 63, into a cfloat
+		template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+		inline void encode_positive_cfloat(int scale, uint64_t significand, bool sticky, cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& c) {
+			using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+			constexpr int fbits = int(Cfloat::fbits);
+			if (scale > Cfloat::MAX_EXP) {
+				if constexpr (isSaturating) c.maxpos(); else c.setinf(false);
+				return;
+			}
+			// a subnormal result keeps fewer fraction bits
+			int shift = 63 - fbits + (scale < Cfloat::MIN_EXP_NORMAL ? Cfloat::MIN_EXP_NORMAL - scale : 0);
+			uint64_t raw{ 0 };
+			if (shift < 64) {
+				raw = significand >> shift;
+				bool guard = (significand >> (shift - 1)) & 1;
+				sticky = sticky || (significand & ((uint64_t(1) << (shift - 1)) - 1)) != 0;
+				if (scale >= Cfloat::MIN_EXP_NORMAL) {
+					raw &= ~(uint64_t(1) << fbits);  // the hidden bit
+					raw |= uint64_t(scale + Cfloat::EXP_BIAS) << fbits;
+				}
+				if (guard && (sticky || (raw & 1))) ++raw;  // a carry moves into the exponent field
+			}
+			c.setbits(raw);
+			if (c.isinf() || c.isnan()) {
+				if constexpr (isSaturating) c.maxpos(); else c.setinf(false);
+			}
+		}
+
+	}  // namespace internal
+
+	// correctly rounded sqrt: an integer square root on the significand for cfloats up to 64 bits
+	template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+	inline cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating> sqrt(const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& a) {
+		using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+		if (a.isnan() || a.iszero() || (a.isinf() && !a.isneg())) return a;
+		Cfloat c;
+		if (a.isneg()) {
+			c.setnan(NAN_TYPE_QUIET);
+			return c;
+		}
+		if constexpr (nbits <= 64) {
+			int scale;
+			uint64_t X = internal::cfloat_significand(a, scale);
+			bool inexact;
+			uint64_t root = internal::significand_sqrt(X, inexact);
+			internal::encode_positive_cfloat(scale / 2, root, inexact, c);
+			return c;
+		}
+		else {
+			return Cfloat(std::sqrt((double)a));
+		}
 	}
-#endif
 
-	// reciprocal sqrt
-	template<size_t nbits, size_t es, typename bt>
-	inline cfloat<nbits, es, bt> rsqrt(const cfloat<nbits, es, bt>& a) {
-		cfloat<nbits, es, bt> v = sqrt(a);
-		return v.reciprocate();
+	// correctly rounded reciprocal sqrt, for normalization kernels that scale by 1/sqrt(x)
+	template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+	inline cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating> rsqrt(const cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>& a) {
+		using Cfloat = cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+		Cfloat c;
+		if (a.isnan() || (a.isneg() && !a.iszero())) {
+			c.setnan(NAN_TYPE_QUIET);
+			return c;
+		}
+		if (a.iszero()) {
+			c.setinf(a.isneg());
+			return c;
+		}
+		if (a.isinf()) return c;
+		if constexpr (nbits <= 64) {
+			int scale;
+			uint64_t X = internal::cfloat_significand(a, scale);
+			if (X == (uint64_t(1) << 62)) {  // an even power of two has an exact reciprocal root
+				internal::encode_positive_cfloat(-scale / 2, uint64_t(1) << 63, false, c);
+				return c;
+			}
+			bool inexact;
+			uint64_t q = internal::significand_rsqrt(X, inexact);  // 1/sqrt(x) in (1/2, 1)
+			internal::encode_positive_cfloat(-scale / 2 - 1, q, inexact, c);
+			return c;
+		}
+		else {
+			return Cfloat(1.0 / std::sqrt((double)a));
+		}
 	}
 
 	///////////////////////////////////////////////////////////////////
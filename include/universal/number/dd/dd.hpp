@@ -0,0 +1,25 @@
+// double-double arithmetic type standard header
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#ifndef _DD_STANDARD_HEADER_
+#define _DD_STANDARD_HEADER_
+
+////////////////////////////////////////////////////////////////////////////////////////
+///  BEHAVIORAL COMPILATION SWITCHES
+
+// dd_real follows the IEEE-754 semantics of its leading component:
+// there are no arithmetic exceptions to enable
+
+////////////////////////////////////////////////////////////////////////////////////////
+/// INCLUDE FILES that make up the library
+#include <universal/number/dd/dd_impl.hpp>
+#include <universal/number/dd/numeric_limits.hpp>
+#include <universal/number/dd/manipulators.hpp>
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// math functions
+#include <universal/number/dd/math_functions.hpp>
+
+#endif
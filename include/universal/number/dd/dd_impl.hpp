@@ -0,0 +1,461 @@
+#pragma once
+// dd_impl.hpp: definition of the double-double floating-point number system
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+
+#include <universal/native/ieee754.hpp>
+#include <universal/number/shared/specific_value_encoding.hpp>
+#include <universal/number/shared/error_free_ops.hpp>
+#include <universal/number/shared/multi_double_format.hpp>
+
+namespace sw::universal {
+
+// dd_real is a double-double: the unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi)/2,
+// following Hida, Li, and Bailey. It carries 106 bits of precision with the exponent range
+// of double, and inherits the IEEE-754 semantics of its leading component for
+// infinities and NaN. The arithmetic is built on the fma-based error-free transformations.
+class dd_real {
+public:
+	static constexpr int nrComponents = 2;
+
+	constexpr dd_real() : hi{ 0.0 }, lo{ 0.0 } {}
+	constexpr dd_real(double high, double low) : hi{ high }, lo{ low } {}
+
+	constexpr dd_real(const dd_real&) = default;
+	constexpr dd_real(dd_real&&) = default;
+
+	constexpr dd_real& operator=(const dd_real&) = default;
+	constexpr dd_real& operator=(dd_real&&) = default;
+
+	// specific value constructor
+	constexpr dd_real(const SpecificValue code) : hi{ 0.0 }, lo{ 0.0 } {
+		switch (code) {
+		case SpecificValue::maxpos:
+			maxpos();
+			break;
+		case SpecificValue::minpos:
+			minpos();
+			break;
+		case SpecificValue::zero:
+		default:
+			break;
+		case SpecificValue::minneg:
+			minneg();
+			break;
+		case SpecificValue::maxneg:
+			maxneg();
+			break;
+		}
+	}
+
+	// initializers for native types: integers are represented exactly
+	constexpr dd_real(signed char initial_value)        : hi{ double(initial_value) }, lo{ 0.0 } {}
+	constexpr dd_real(short initial_value)              : hi{ double(initial_value) }, lo{ 0.0 } {}
+	constexpr dd_real(int initial_value)                : hi{ double(initial_value) }, lo{ 0.0 } {}
+	dd_real(long initial_value)                         { *this = initial_value; }
+	dd_real(long long initial_value)                    { *this = initial_value; }
+	constexpr dd_real(char initial_value)               : hi{ double(initial_value) }, lo{ 0.0 } {}
+	constexpr dd_real(unsigned short initial_value)     : hi{ double(initial_value) }, lo{ 0.0 } {}
+	constexpr dd_real(unsigned int initial_value)       : hi{ double(initial_value) }, lo{ 0.0 } {}
+	dd_real(unsigned long initial_value)                { *this = initial_value; }
+	dd_real(unsigned long long initial_value)           { *this = initial_value; }
+	constexpr dd_real(float initial_value)              : hi{ double(initial_value) }, lo{ 0.0 } {}
+	constexpr dd_real(double initial_value)             : hi{ initial_value }, lo{ 0.0 } {}
+	dd_real(long double initial_value)                  { *this = initial_value; }
+
+	// assignment operators for native types
+	dd_real& operator=(signed char rhs)        { return assign(double(rhs), 0.0); }
+	dd_real& operator=(short rhs)              { return assign(double(rhs), 0.0); }
+	dd_real& operator=(int rhs)                { return assign(double(rhs), 0.0); }
+	dd_real& operator=(long rhs)               { return convert_signed(rhs); }
+	dd_real& operator=(long long rhs)          { return convert_signed(rhs); }
+	dd_real& operator=(char rhs)               { return assign(double(rhs), 0.0); }
+	dd_real& operator=(unsigned short rhs)     { return assign(double(rhs), 0.0); }
+	dd_real& operator=(unsigned int rhs)       { return assign(double(rhs), 0.0); }
+	dd_real& operator=(unsigned long rhs)      { return convert_unsigned(rhs); }
+	dd_real& operator=(unsigned long long rhs) { return convert_unsigned(rhs); }
+	dd_real& operator=(float rhs)              { return assign(double(rhs), 0.0); }
+	dd_real& operator=(double rhs)             { return assign(rhs, 0.0); }
+	dd_real& operator=(long double rhs) {
+		double high = double(rhs);
+		if (!std::isfinite(high)) return assign(high, 0.0);
+		return assign(high, double(rhs - (long double)(high)));
+	}
+
+	// conversion operators: the leading component, or the rounded sum of the components
+	explicit operator int() const { return int(to_long_long()); }
+	explicit operator long() const { return long(to_long_long()); }
+	explicit operator long long() const { return to_long_long(); }
+	explicit operator unsigned long long() const { return to_unsigned_long_long(); }
+	explicit operator float() const { return float(hi); }
+	explicit operator double() const { return hi; }
+	explicit operator long double() const { return (long double)(hi) + (long double)(lo); }
+
+	// prefix operator
+	constexpr dd_real operator-() const { return dd_real(-hi, -lo); }
+
+	// in-place arithmetic assignment operators: the double overloads are cheaper kernels,
+	// other native types convert exactly through the constructors
+	dd_real& operator+=(const dd_real& rhs) {
+		double s2, t2;
+		double s1 = two_sum(hi, rhs.hi, s2);
+		if (!std::isfinite(s1)) return assign(s1, 0.0);
+		double t1 = two_sum(lo, rhs.lo, t2);
+		s2 += t1;
+		s1 = quick_two_sum(s1, s2, s2);
+		s2 += t2;
+		s1 = quick_two_sum(s1, s2, s2);
+		return assign_checked(s1, s2);
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	dd_real& operator+=(Real rhs) {
+		double s2;
+		double s1 = two_sum(hi, rhs, s2);
+		if (!std::isfinite(s1)) return assign(s1, 0.0);
+		s2 += lo;
+		s1 = quick_two_sum(s1, s2, s2);
+		return assign_checked(s1, s2);
+	}
+	dd_real& operator-=(const dd_real& rhs) { return *this += -rhs; }
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	dd_real& operator-=(Real rhs) { return *this += -rhs; }
+	dd_real& operator*=(const dd_real& rhs) {
+		double p2;
+		double p1 = two_prod(hi, rhs.hi, p2);
+		if (!std::isfinite(p1)) return assign(p1, 0.0);
+		p2 += (hi * rhs.lo + lo * rhs.hi);
+		p1 = quick_two_sum(p1, p2, p2);
+		return assign_checked(p1, p2);
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	dd_real& operator*=(Real rhs) {
+		double p2;
+		double p1 = two_prod(hi, rhs, p2);
+		if (!std::isfinite(p1)) return assign(p1, 0.0);
+		p2 += lo * rhs;
+		p1 = quick_two_sum(p1, p2, p2);
+		return assign_checked(p1, p2);
+	}
+	// three quotient digits of 53 bits, each from the remainder of the previous ones
+	dd_real& operator/=(const dd_real& rhs) {
+		double q1 = hi / rhs.hi;
+		if (!std::isfinite(q1) || rhs.hi == 0.0) return assign(q1, 0.0);
+		dd_real r(*this), t(rhs);
+		r -= (t *= q1);
+		double q2 = r.hi / rhs.hi;
+		t = rhs;
+		r -= (t *= q2);
+		double q3 = r.hi / rhs.hi;
+		q1 = quick_two_sum(q1, q2, q2);
+		hi = q1;
+		lo = q2;
+		return *this += q3;
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	dd_real& operator/=(Real rhs) {
+		double q1 = hi / rhs;
+		if (!std::isfinite(q1) || rhs == 0.0) return assign(q1, 0.0);
+		// the remainder of the first digit is exact
+		double p2;
+		double p1 = two_prod(q1, rhs, p2);
+		double s2;
+		double s1 = two_diff(hi, p1, s2);
+		s2 -= p2;
+		s2 += lo;
+		double q2 = (s1 + s2) / rhs;
+		hi = quick_two_sum(q1, q2, lo);
+		return *this;
+	}
+
+	// modifiers
+	constexpr void clear() noexcept { hi = 0.0; lo = 0.0; }
+	constexpr void setzero() noexcept { clear(); }
+	constexpr void setinf(bool sign = true) noexcept { hi = (sign ? -INFINITY : INFINITY); lo = 0.0; }
+	constexpr void setnan() noexcept { hi = std::numeric_limits<double>::quiet_NaN(); lo = 0.0; }
+	constexpr void set(double high, double low) noexcept { hi = high; lo = low; }
+
+	// create specific number system values of interest
+	constexpr dd_real& maxpos() noexcept {
+		// 2^1024 - 2^918: the largest value whose low component does not round the sum to inf
+		hi = 1.79769313486231570815e+308;
+		lo = 9.97920154767359795037e+291;
+		return *this;
+	}
+	constexpr dd_real& minpos() noexcept {
+		hi = std::numeric_limits<double>::denorm_min();
+		lo = 0.0;
+		return *this;
+	}
+	constexpr dd_real& zero() noexcept {
+		clear();
+		return *this;
+	}
+	constexpr dd_real& minneg() noexcept {
+		hi = -std::numeric_limits<double>::denorm_min();
+		lo = 0.0;
+		return *this;
+	}
+	constexpr dd_real& maxneg() noexcept {
+		hi = -1.79769313486231570815e+308;
+		lo = -9.97920154767359795037e+291;
+		return *this;
+	}
+
+	// selectors
+	constexpr bool iszero() const noexcept { return hi == 0.0; }
+	constexpr bool isone() const noexcept { return hi == 1.0 && lo == 0.0; }
+	constexpr bool isneg() const noexcept { return hi < 0.0; }
+	constexpr bool ispos() const noexcept { return hi > 0.0; }
+	bool isinf() const noexcept { return std::isinf(hi); }
+	bool isnan() const noexcept { return std::isnan(hi); }
+	bool isfinite() const noexcept { return std::isfinite(hi); }
+	constexpr bool sign() const noexcept { return hi < 0.0; }
+	int scale() const noexcept { return (hi == 0.0 || !std::isfinite(hi) ? 0 : std::ilogb(hi)); }
+	constexpr double high() const noexcept { return hi; }
+	constexpr double low() const noexcept { return lo; }
+	constexpr double operator[](int index) const noexcept { return (index == 0 ? hi : (index == 1 ? lo : 0.0)); }
+
+	long long to_long_long() const;
+	unsigned long long to_unsigned_long_long() const;
+
+	// decimal string with the given significant digits, following the stream format flags
+	std::string str(std::streamsize precision = 32, std::ios_base::fmtflags flags = std::ios_base::scientific) const {
+		return internal::multi_double_to_string(*this, precision, flags);
+	}
+
+private:
+	double hi, lo;
+
+	dd_real& assign(double high, double low) noexcept {
+		hi = high;
+		lo = low;
+		return *this;
+	}
+	// a leading component that overflows during normalization leaves an undefined low component
+	dd_real& assign_checked(double high, double low) noexcept {
+		hi = high;
+		lo = (std::isfinite(high) ? low : 0.0);
+		return *this;
+	}
+	template<typename SignedInt>
+	dd_real& convert_signed(SignedInt v) {
+		unsigned long long magnitude = (v < 0 ? 0ull - (unsigned long long)(v) : (unsigned long long)(v));
+		convert_unsigned(magnitude);
+		if (v < 0) { hi = -hi; lo = -lo; }
+		return *this;
+	}
+	template<typename UnsignedInt>
+	dd_real& convert_unsigned(UnsignedInt v) {
+		// both halves are exact doubles
+		double upper = double(uint64_t(v) >> 32) * 4294967296.0;
+		double lower = double(uint64_t(v) & 0xFFFF'FFFFull);
+		hi = two_sum(upper, lower, lo);
+		return *this;
+	}
+};
+
+////////////////////////    constants    /////////////////////////////////
+
+inline constexpr dd_real dd_pi(3.141592653589793, 1.2246467991473532e-16);
+inline constexpr dd_real dd_2pi(6.283185307179586, 2.4492935982947064e-16);
+inline constexpr dd_real dd_pi_2(1.5707963267948966, 6.123233995736766e-17);
+inline constexpr dd_real dd_pi_4(0.7853981633974483, 3.061616997868383e-17);
+inline constexpr dd_real dd_3pi_4(2.356194490192345, 9.184850993605148e-17);
+inline constexpr dd_real dd_e(2.718281828459045, 1.4456468917292502e-16);
+inline constexpr dd_real dd_ln2(0.6931471805599453, 2.3190468138462996e-17);
+inline constexpr dd_real dd_ln10(2.302585092994046, -2.1707562233822494e-16);
+inline constexpr dd_real dd_log2e(1.4426950408889634, 2.0355273740931033e-17);
+inline constexpr dd_real dd_log10e(0.4342944819032518, 1.098319650216765e-17);
+
+////////////////////////    helper functions   /////////////////////////////////
+
+inline dd_real abs(const dd_real& a) { return (a.isneg() ? -a : a); }
+inline dd_real fabs(const dd_real& a) { return abs(a); }
+
+// a * 2^exp, exact barring underflow
+inline dd_real ldexp(const dd_real& a, int exp) {
+	return dd_real(std::ldexp(a.high(), exp), std::ldexp(a.low(), exp));
+}
+
+inline dd_real frexp(const dd_real& a, int* exp) {
+	double high = std::frexp(a.high(), exp);
+	return dd_real(high, std::ldexp(a.low(), -*exp));
+}
+
+inline dd_real floor(const dd_real& a) {
+	double high = std::floor(a.high());
+	double low = 0.0;
+	if (high == a.high()) {
+		// the leading component is an integer: the fraction lives in the low component
+		low = std::floor(a.low());
+		high = quick_two_sum(high, low, low);
+	}
+	return dd_real(high, low);
+}
+
+inline dd_real ceil(const dd_real& a) {
+	double high = std::ceil(a.high());
+	double low = 0.0;
+	if (high == a.high()) {
+		low = std::ceil(a.low());
+		high = quick_two_sum(high, low, low);
+	}
+	return dd_real(high, low);
+}
+
+namespace internal {
+	// an integral double modulo 2^64
+	inline unsigned long long modular_integer(double v) {
+		unsigned long long magnitude = (unsigned long long)(std::fmod(std::fabs(v), 18446744073709551616.0));
+		return (v < 0.0 ? 0ull - magnitude : magnitude);
+	}
+}
+
+// integer conversions truncate toward zero; the components of the truncated value are integers
+// that are summed modulo 2^64, so the result is exact whenever it is in range
+inline long long dd_real::to_long_long() const {
+	dd_real t = (isneg() ? ceil(*this) : floor(*this));
+	return (long long)(internal::modular_integer(t.high()) + internal::modular_integer(t.low()));
+}
+
+inline unsigned long long dd_real::to_unsigned_long_long() const {
+	if (isneg()) return 0;
+	dd_real t = floor(*this);
+	return internal::modular_integer(t.high()) + internal::modular_integer(t.low());
+}
+
+// the square of a double as an exact double-double
+inline dd_real sqr(double a) {
+	double e;
+	double p = two_sqr(a, e);
+	return dd_real(p, e);
+}
+
+inline dd_real sqr(const dd_real& a) {
+	double p2;
+	double p1 = two_sqr(a.high(), p2);
+	p2 += 2.0 * a.high() * a.low();
+	p2 += a.low() * a.low();
+	p1 = quick_two_sum(p1, p2, p2);
+	return dd_real(p1, p2);
+}
+
+// the product of two doubles as an exact double-double
+inline dd_real mul(double a, double b) {
+	double e;
+	double p = two_prod(a, b, e);
+	return dd_real(p, e);
+}
+
+// the sum of two doubles as an exact double-double
+inline dd_real add(double a, double b) {
+	double e;
+	double s = two_sum(a, b, e);
+	return dd_real(s, e);
+}
+
+////////////////////////    stream operators   /////////////////////////////////
+
+inline bool parse(const std::string& number, dd_real& value) {
+	return internal::multi_double_parse(number, value);
+}
+
+// generate a dd_real format ASCII format, honoring precision and the floatfield flags
+inline std::ostream& operator<<(std::ostream& ostr, const dd_real& v) {
+	// to make certain that setw and left/right operators work properly
+	// we need to transform the dd_real into a string
+	std::stringstream ss;
+	std::streamsize prec = ostr.precision();
+	std::streamsize width = ostr.width();
+	std::ios_base::fmtflags ff = ostr.flags();
+	ss.flags(ff);
+	ss << std::setw(width) << internal::multi_double_to_string(v, prec, ff);
+	return ostr << ss.str();
+}
+
+// read an ASCII dd_real format
+inline std::istream& operator>>(std::istream& istr, dd_real& v) {
+	std::string txt;
+	istr >> txt;
+	if (!parse(txt, v)) {
+		std::cerr << "unable to parse -" << txt << "- into a dd_real value\n";
+	}
+	return istr;
+}
+
+////////////////////////    logic operators   /////////////////////////////////
+
+inline bool operator==(const dd_real& lhs, const dd_real& rhs) { return lhs.high() == rhs.high() && lhs.low() == rhs.low(); }
+inline bool operator!=(const dd_real& lhs, const dd_real& rhs) { return !operator==(lhs, rhs); }
+inline bool operator< (const dd_real& lhs, const dd_real& rhs) {
+	return lhs.high() < rhs.high() || (lhs.high() == rhs.high() && lhs.low() < rhs.low());
+}
+inline bool operator> (const dd_real& lhs, const dd_real& rhs) { return  operator< (rhs, lhs); }
+inline bool operator<=(const dd_real& lhs, const dd_real& rhs) { return  operator< (lhs, rhs) || operator==(lhs, rhs); }
+inline bool operator>=(const dd_real& lhs, const dd_real& rhs) { return  operator< (rhs, lhs) || operator==(lhs, rhs); }
+
+////////////////////////  arithmetic operators   /////////////////////////////////
+
+inline dd_real operator+(const dd_real& lhs, const dd_real& rhs) {
+	dd_real sum(lhs);
+	sum += rhs;
+	return sum;
+}
+inline dd_real operator-(const dd_real& lhs, const dd_real& rhs) {
+	dd_real diff(lhs);
+	diff -= rhs;
+	return diff;
+}
+inline dd_real operator*(const dd_real& lhs, const dd_real& rhs) {
+	dd_real product(lhs);
+	product *= rhs;
+	return product;
+}
+inline dd_real operator/(const dd_real& lhs, const dd_real& rhs) {
+	dd_real ratio(lhs);
+	ratio /= rhs;
+	return ratio;
+}
+
+// mixed with double
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator+(const dd_real& lhs, Real rhs) { dd_real sum(lhs); sum += rhs; return sum; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator+(Real lhs, const dd_real& rhs) { dd_real sum(rhs); sum += lhs; return sum; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator-(const dd_real& lhs, Real rhs) { dd_real diff(lhs); diff -= rhs; return diff; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator-(Real lhs, const dd_real& rhs) { dd_real diff(-rhs); diff += lhs; return diff; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator*(const dd_real& lhs, Real rhs) { dd_real product(lhs); product *= rhs; return product; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator*(Real lhs, const dd_real& rhs) { dd_real product(rhs); product *= lhs; return product; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline dd_real operator/(const dd_real& lhs, Real rhs) { dd_real ratio(lhs); ratio /= rhs; return ratio; }
+
+////////////////////////  square root   /////////////////////////////////
+
+// Karp's trick: one Newton step on the double precision reciprocal square root
+inline dd_real sqrt(const dd_real& a) {
+	if (a.iszero()) return a;
+	if (a.isneg()) return dd_real(std::numeric_limits<double>::quiet_NaN(), 0.0);
+	if (a.isinf()) return a;
+	double x = 1.0 / std::sqrt(a.high());
+	double ax = a.high() * x;
+	dd_real correction = a - sqr(ax);
+	double e;
+	double s = two_sum(ax, correction.high() * x * 0.5, e);
+	return dd_real(s, e);
+}
+
+} // namespace sw::universal
@@ -0,0 +1,21 @@
+#pragma once
+// manipulators.hpp: definitions of helper functions for double-double type manipulation
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <string>
+
+namespace sw::universal {
+
+// Generate a type tag for this dd_real
+inline std::string type_tag(const dd_real&) {
+	return "dd_real";
+}
+
+// the binary representation of the components, leading component first
+inline std::string to_binary(const dd_real& v, bool bNibbleMarker = false) {
+	return to_binary(v.high(), bNibbleMarker) + " + " + to_binary(v.low(), bNibbleMarker);
+}
+
+} // namespace sw::universal
@@ -0,0 +1,25 @@
+#pragma once
+// math_functions.hpp: definition of mathematical functions for the double-double type
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/shared/multi_double_functions.hpp>
+
+namespace sw::universal {
+
+template<>
+struct multi_double_traits<dd_real> {
+	static constexpr int components = 2;
+	static constexpr int newtonIterations = 1;
+	static constexpr dd_real pi     = dd_pi;
+	static constexpr dd_real twopi  = dd_2pi;
+	static constexpr dd_real pi_2   = dd_pi_2;
+	static constexpr dd_real pi_4   = dd_pi_4;
+	static constexpr dd_real ln2    = dd_ln2;
+	static constexpr dd_real ln10   = dd_ln10;
+	static constexpr dd_real log2e  = dd_log2e;
+	static constexpr dd_real log10e = dd_log10e;
+};
+
+} // namespace sw::universal
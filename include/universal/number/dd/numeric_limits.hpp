@@ -0,0 +1,30 @@
+#pragma once
+// numeric_limits.hpp: definition of numeric_limits for double-double types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/shared/multi_double_limits.hpp>
+
+namespace std {
+
+template <> 
+class numeric_limits< sw::universal::dd_real > : public sw::universal::internal::multi_double_numeric_limits< sw::universal::dd_real > {
+public:
+	using DoubleDouble = sw::universal::dd_real;
+	static constexpr DoubleDouble min() { // return minimum value: the smallest value with full precision
+		return DoubleDouble(2.0041683600089728e-292, 0.0);  // 2^-969
+	} 
+	static constexpr DoubleDouble epsilon() { // return smallest effective increment from 1.0
+		return DoubleDouble(4.930380657631324e-32, 0.0);  // 2^-104
+	}
+
+	static constexpr int digits       = 106;
+	static constexpr int digits10     = 31;
+	static constexpr int max_digits10 = 33;
+
+	static constexpr int min_exponent   = std::numeric_limits<double>::min_exponent + 53;
+	static constexpr int min_exponent10 = std::numeric_limits<double>::min_exponent10 + 16;
+};
+
+}
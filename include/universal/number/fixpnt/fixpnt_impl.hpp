@@ -276,6 +276,8 @@ public:
 		int radixPoint = 23 - (static_cast<int>(decoder.parts.exponent) - 127); // move radix point to the right if scale > 0, left if scale < 0
 		// our fixed-point has its radixPoint at rbits
 		int shiftRight = radixPoint - int(rbits);
+		// values below half the smallest fixpnt round to zero: the shifts below are undefined for these exponents
+		if (shiftRight > 24) return *this;
 		// do we need to round?
 		if (shiftRight > 0) {
 			// yes, round the raw bits
@@ -344,6 +346,8 @@ public:
 
 		// our fixed-point has its radixPoint at rbits
 		int shiftRight = radixPoint - int(rbits);
+		// values below half the smallest fixpnt round to zero: the shifts below are undefined for these exponents
+		if (shiftRight > 53) return *this;
 		// do we need to round?
 		if (shiftRight > 0) {
 			// yes, round the raw bits
@@ -1278,6 +1282,36 @@ inline fixpnt<nbits, rbits, arithmetic, bt> operator%(const fixpnt<nbits, rbits,
 	ratio %= rhs;
 	return ratio;
 }
+// FUSED MULTIPLY-ADD
+// a * b + c with a single rounding: the 2*nbits product is exact, the addend is aligned to its 2*rbits
+// radix point, and the sum is rounded once to rbits before it is wrapped or saturated like a multiply
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+inline fixpnt<nbits, rbits, arithmetic, bt> fma(const fixpnt<nbits, rbits, arithmetic, bt>& a, const fixpnt<nbits, rbits, arithmetic, bt>& b, const fixpnt<nbits, rbits, arithmetic, bt>& c) {
+	using accumulator = blockbinary<2 * nbits + 1, bt>;  // one more bit than the product so that the sum cannot overflow
+	accumulator sum(urmul2(a.getbb(), b.getbb()));
+	accumulator addend(c.getbb());
+	addend <<= static_cast<int>(rbits);
+	sum += addend;
+	bool roundUp = sum.roundingMode(rbits);
+	sum >>= static_cast<int>(rbits);
+	fixpnt<nbits, rbits, arithmetic, bt> result;
+	if constexpr (arithmetic != Modulo) {
+		fixpnt<nbits, rbits, arithmetic, bt> fp;
+		accumulator saturation = maxpos<nbits, rbits, arithmetic, bt>(fp).getbb();
+		if (sum >= saturation) {
+			result = saturation;
+			return result;
+		}
+		saturation = maxneg<nbits, rbits, arithmetic, bt>(fp).getbb();
+		if (sum < saturation) {
+			result = saturation;
+			return result;
+		}
+	}
+	if (roundUp) ++sum;
+	result = sum; // select the lower nbits of the result
+	return result;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // fixpnt - literal binary arithmetic operators
@@ -48,6 +48,15 @@ struct integer_overflow : public std::runtime_error {
 	integer_overflow() : std::runtime_error("integer arithmetic overflow") {}
 };
 
+// transform size exceptions of the number theoretic transform
+struct ntt_size_not_power_of_two : public std::runtime_error {
+	ntt_size_not_power_of_two() : std::runtime_error("ntt_plan: transform size must be a power of two") {}
+};
+
+struct ntt_size_exceeds_roots_of_unity : public std::runtime_error {
+	ntt_size_exceeds_roots_of_unity() : std::runtime_error("ntt_plan: transform size exceeds the 2^32 roots of unity of the field") {}
+};
+
 ///////////////////////////////////////////////////////////////
 // internal implementation exceptions
 
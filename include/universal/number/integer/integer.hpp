@@ -29,8 +29,10 @@
 #include <universal/number/integer/integer_impl.hpp>
 #include <universal/number/integer/numeric_limits.hpp>
 
-#include <universal/number/integer/primes.hpp>
+#include <universal/number/integer/modular.hpp>
+#include <universal/number/integer/ntt.hpp>
 #include <universal/number/integer/sieves.hpp>
+#include <universal/number/integer/primes.hpp>
 #include <universal/number/integer/manipulators.hpp>
 #include <universal/number/integer/attributes.hpp>
 
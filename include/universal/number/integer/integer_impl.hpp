@@ -5,6 +5,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <string>
+#include <cstring>  // std::memset
 #include <sstream>
 #include <iostream>
 #include <iomanip>
@@ -691,7 +692,7 @@ protected:
 	unsigned long to_ulong() const {
 		unsigned long ul = 0;
 		char* p = (char*)&ul;
-		for (int i = 0; i < nrBytes; ++i) {
+		for (unsigned i = 0; i < nrBytes && i < sizeof(ul); ++i) {
 			*(p + i) = b[i];
 		}
 		return ul;
@@ -699,7 +700,7 @@ protected:
 	unsigned long long to_ulong_long() const {
 		unsigned long long ull = 0;
 		char* p = (char*)&ull;
-		for (int i = 0; i < nrBytes; ++i) {
+		for (unsigned i = 0; i < nrBytes && i < sizeof(ull); ++i) {
 			*(p + i) = b[i];
 		}
 		return ull;
@@ -0,0 +1,379 @@
+#pragma once
+// modular.hpp: modular arithmetic engine for arbitrary fixed-size integers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <universal/number/integer/exceptions.hpp>
+#include <universal/number/shared/knuth_division.hpp>
+
+namespace sw::universal {
+
+/*
+ The integer<nbits> operators are bit-serial: operator* is a shift-and-add loop
+ and operator% is a restoring long division, one bit at a time. Number theoretic
+ algorithms, such as modular exponentiation, execute thousands of these per call.
+
+ A modular_context fixes the modulus and precomputes the constants to reduce
+ at the word level. Values are converted once to little-endian arrays of 32-bit
+ limbs, and all arithmetic is done with 64-bit intermediates:
+   - odd moduli use Montgomery multiplication (CIOS: coarsely integrated operand scanning),
+     which replaces the division by the modulus with multiplications
+   - even moduli, for which Montgomery's R is not invertible, multiply into a
+     double-width product and reduce with Knuth's word-level long division (Algorithm D)
+
+ powmod uses sliding-window exponentiation over the bits of the exponent.
+ The residue type exposes the internal representation, so that loops such as
+ Pollard's rho iteration stay in the Montgomery domain between operations.
+ */
+template<size_t nbits, typename BlockType = uint8_t>
+class modular_context {
+public:
+	using Integer = integer<nbits, BlockType>;
+	static constexpr size_t nrLimbs = (nbits + 31) / 32;
+	using Limbs = std::array<uint32_t, nrLimbs>;
+
+	// a value in the internal representation of the context: Montgomery form for odd moduli
+	struct residue {
+		Limbs limbs;
+	};
+
+	// precondition: modulus > 0
+	explicit modular_context(const Integer& modulus) : _modulus(modulus), _N{}, _n{ 1 }, _montgomery{ false }, _mprime{ 0 }, _one{}, _R2{} {
+		if (modulus.sign() || modulus.iszero()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+			throw integer_divide_by_zero{};
+#else
+			std::cerr << "modular_context: modulus must be positive\n";
+			_modulus = 1;
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+		}
+		to_limbs(_modulus, _N);
+		_n = significant_limbs(_N.data(), nrLimbs);
+		_montgomery = (_N[0] & 1u) && !(_n == 1 && _N[0] == 1u);
+		if (_montgomery) {
+			// Newton iteration for N^-1 mod 2^32: each step doubles the number of correct bits
+			uint32_t inv = 1;
+			for (int i = 0; i < 5; ++i) inv *= 2u - _N[0] * inv;
+			_mprime = uint32_t(0u - inv);
+			// R^2 mod N with R = 2^(32n), used to enter the Montgomery domain
+			std::array<uint32_t, 2 * nrLimbs + 1> r2{};
+			r2[2 * _n] = 1;
+			divmod(r2.data(), 2 * _n + 1, _N.data(), _n, nullptr, _R2.data());
+			Limbs one{};
+			one[0] = 1;
+			montmul(one.data(), _R2.data(), _one.limbs.data());  // R mod N
+		}
+		else {
+			_one.limbs[0] = (_n == 1 && _N[0] == 1u) ? 0u : 1u;
+		}
+	}
+
+	const Integer& modulus() const noexcept { return _modulus; }
+	bool montgomery() const noexcept { return _montgomery; }
+
+	// a mod modulus in [0, modulus), also for negative a
+	Integer reduce(const Integer& a) const {
+		Limbs r;
+		reduce(a, r);
+		return from_limbs(r);
+	}
+	// addition and subtraction are the same in both representations
+	Integer addmod(const Integer& a, const Integer& b) const { return leave_plain(add(enter_plain(a), enter_plain(b))); }
+	Integer submod(const Integer& a, const Integer& b) const { return leave_plain(sub(enter_plain(a), enter_plain(b))); }
+	// a single product is cheaper to reduce directly than to convert in and out of the Montgomery domain
+	Integer mulmod(const Integer& a, const Integer& b) const {
+		Limbs x, y, r;
+		reduce(a, x);
+		reduce(b, y);
+		plainmul(x.data(), y.data(), r.data());
+		return from_limbs(r);
+	}
+	// base^exponent mod modulus, negative exponents raise the inverse of base
+	Integer powmod(const Integer& base, const Integer& exponent) const {
+		Integer b(base), e(exponent);
+		if (e.sign()) {
+			b = invmod(b);
+			e = -e;
+		}
+		Limbs exp{};
+		to_limbs(e, exp);
+		return leave(pow(enter(b), exp));
+	}
+	// multiplicative inverse of a mod modulus, returns 0 when gcd(a, modulus) != 1
+	Integer invmod(const Integer& a) const {
+		Limbs r0 = _N, r1, t0{}, t1{};
+		reduce(a, r1);
+		t1[0] = 1;
+		size_t n0 = _n, n1 = significant_limbs(r1.data(), _n);
+		// extended Euclid, tracking only the coefficient of a, kept in [0, modulus)
+		while (!(n1 == 1 && r1[0] == 0)) {
+			std::array<uint32_t, nrLimbs + 1> q{};
+			Limbs r{};
+			divmod(r0.data(), n0, r1.data(), n1, q.data(), r.data());
+			Limbs qt{}, t{};
+			plainmul(q.data(), t1.data(), qt.data());   // q < modulus since r1 > 0 and r0 <= modulus
+			t = t0;
+			if (sub_limbs(t.data(), qt.data(), _n)) add_limbs(t.data(), _N.data(), _n);
+			r0 = r1; n0 = n1;
+			r1 = r;  n1 = significant_limbs(r1.data(), n1);
+			t0 = t1;
+			t1 = t;
+		}
+		if (!(n0 == 1 && r0[0] == 1)) return Integer(0);
+		return from_limbs(t0);
+	}
+
+	// operations on residues
+	residue enter(const Integer& a) const {
+		residue r;
+		reduce(a, r.limbs);
+		if (_montgomery) montmul(r.limbs.data(), _R2.data(), r.limbs.data());
+		return r;
+	}
+	Integer leave(const residue& a) const {
+		if (!_montgomery) return from_limbs(a.limbs);
+		Limbs one{}, r;
+		one[0] = 1;
+		montmul(a.limbs.data(), one.data(), r.data());
+		return from_limbs(r);
+	}
+	const residue& one() const noexcept { return _one; }
+	residue add(const residue& a, const residue& b) const {
+		residue r = a;
+		bool carry = add_limbs(r.limbs.data(), b.limbs.data(), _n);
+		if (carry || compare_limbs(r.limbs.data(), _N.data(), _n) >= 0) sub_limbs(r.limbs.data(), _N.data(), _n);
+		return r;
+	}
+	residue sub(const residue& a, const residue& b) const {
+		residue r = a;
+		if (sub_limbs(r.limbs.data(), b.limbs.data(), _n)) add_limbs(r.limbs.data(), _N.data(), _n);
+		return r;
+	}
+	residue mul(const residue& a, const residue& b) const {
+		residue r;
+		if (_montgomery) montmul(a.limbs.data(), b.limbs.data(), r.limbs.data()); else plainmul(a.limbs.data(), b.limbs.data(), r.limbs.data());
+		return r;
+	}
+	residue sqr(const residue& a) const { return mul(a, a); }
+	bool iszero(const residue& a) const {
+		for (size_t i = 0; i < _n; ++i) if (a.limbs[i] != 0) return false;
+		return true;
+	}
+	bool equal(const residue& a, const residue& b) const { return compare_limbs(a.limbs.data(), b.limbs.data(), _n) == 0; }
+
+private:
+	Integer  _modulus;
+	Limbs    _N;           // modulus limbs
+	size_t   _n;           // number of significant limbs of the modulus
+	bool     _montgomery;  // odd modulus: residues are in Montgomery form a * R mod N
+	uint32_t _mprime;      // -N^-1 mod 2^32
+	residue  _one;         // 1 in the internal representation
+	Limbs    _R2;          // R^2 mod N
+
+	residue enter_plain(const Integer& a) const {
+		residue r;
+		reduce(a, r.limbs);
+		return r;
+	}
+	Integer leave_plain(const residue& a) const { return from_limbs(a.limbs); }
+
+	// sliding-window exponentiation: precompute the odd powers a^1, a^3, ..., a^(2^w - 1)
+	// and consume the exponent in windows that end in a set bit
+	residue pow(const residue& a, const Limbs& e) const {
+		int bits = 0;
+		for (int i = int(nrLimbs) - 1; i >= 0; --i) {
+			if (e[i]) { bits = 32 * i + 32 - std::countl_zero(e[i]); break; }
+		}
+		if (bits == 0) return _one;
+		int w = (bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1);
+		std::array<residue, 32> table;
+		table[0] = a;
+		if (w > 1) {
+			residue a2 = sqr(a);
+			for (int i = 1; i < (1 << (w - 1)); ++i) table[i] = mul(table[i - 1], a2);
+		}
+		auto bit = [&e](int i) { return (e[i / 32] >> (i % 32)) & 1u; };
+		residue r = _one;
+		bool started = false;
+		int i = bits - 1;
+		while (i >= 0) {
+			if (!bit(i)) {
+				if (started) r = sqr(r);
+				--i;
+				continue;
+			}
+			// longest window [i, j] of at most w bits ending in a set bit
+			int j = (i - w + 1 < 0 ? 0 : i - w + 1);
+			while (!bit(j)) ++j;
+			unsigned window = 0;
+			for (int k = i; k >= j; --k) {
+				window = (window << 1) | bit(k);
+				if (started) r = sqr(r);
+			}
+			r = started ? mul(r, table[window >> 1]) : table[window >> 1];
+			started = true;
+			i = j - 1;
+		}
+		return r;
+	}
+
+	// conversion between integer and limbs
+	static void to_limbs(const Integer& a, Limbs& l) {
+		l.fill(0);
+		for (unsigned i = 0; i < Integer::nrBytes; ++i) {
+			l[i / 4] |= uint32_t(a.byte(i)) << (8 * (i % 4));
+		}
+	}
+	static Integer from_limbs(const Limbs& l) {
+		Integer a;
+		for (unsigned i = 0; i < Integer::nrBytes; ++i) {
+			a.setbyte(i, uint8_t(l[i / 4] >> (8 * (i % 4))));
+		}
+		return a;
+	}
+	void reduce(const Integer& a, Limbs& r) const {
+		Limbs magnitude;
+		bool negative = a.sign();
+		// the magnitude of the most negative value is 2^(nbits-1), which is correct as an unsigned pattern
+		to_limbs(negative ? Integer(-a) : a, magnitude);
+		r.fill(0);
+		divmod(magnitude.data(), significant_limbs(magnitude.data(), nrLimbs), _N.data(), _n, nullptr, r.data());
+		if (negative && !(significant_limbs(r.data(), _n) == 1 && r[0] == 0)) {
+			Limbs t = _N;
+			sub_limbs(t.data(), r.data(), _n);
+			r = t;
+		}
+	}
+
+	// word-level primitives
+	static size_t significant_limbs(const uint32_t* a, size_t n) {
+		while (n > 1 && a[n - 1] == 0) --n;
+		return n;
+	}
+	static int compare_limbs(const uint32_t* a, const uint32_t* b, size_t n) {
+		for (size_t i = n; i-- > 0; ) {
+			if (a[i] != b[i]) return (a[i] < b[i] ? -1 : 1);
+		}
+		return 0;
+	}
+	// a += b, returns the carry out
+	static bool add_limbs(uint32_t* a, const uint32_t* b, size_t n) {
+		uint64_t carry = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t s = uint64_t(a[i]) + b[i] + carry;
+			a[i] = uint32_t(s);
+			carry = s >> 32;
+		}
+		return carry != 0;
+	}
+	// a -= b, returns the borrow out
+	static bool sub_limbs(uint32_t* a, const uint32_t* b, size_t n) {
+		uint64_t borrow = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t d = uint64_t(a[i]) - b[i] - borrow;
+			a[i] = uint32_t(d);
+			borrow = (d >> 32) & 1u;
+		}
+		return borrow != 0;
+	}
+
+	// Knuth's Algorithm D: u (m limbs) divided by v (n limbs, v[n-1] != 0)
+	// quotient q has m - n + 1 limbs and may be nullptr, remainder r has n limbs
+	static void divmod(const uint32_t* u, size_t m, const uint32_t* v, size_t n, uint32_t* q, uint32_t* r) {
+		if (m < n) {
+			for (size_t i = 0; i < n; ++i) r[i] = (i < m ? u[i] : 0u);
+			if (q) q[0] = 0;
+			return;
+		}
+		if (n == 1) {
+			uint64_t k = 0;
+			for (size_t j = m; j-- > 0; ) {
+				k = (k << 32) | u[j];
+				if (q) q[j] = uint32_t(k / v[0]);
+				k %= v[0];
+			}
+			r[0] = uint32_t(k);
+			return;
+		}
+		std::array<uint32_t, nrLimbs> vn;
+		std::array<uint32_t, 2 * nrLimbs + 2> un;
+		internal::knuth_divmod(q, r, u, m, v, n, un.data(), vn.data());
+	}
+
+	// r = a * b mod N by a double-width product and a word-level division
+	void plainmul(const uint32_t* a, const uint32_t* b, uint32_t* r) const {
+		std::array<uint32_t, 2 * nrLimbs> p{};
+		for (size_t i = 0; i < _n; ++i) {
+			uint64_t carry = 0;
+			for (size_t j = 0; j < _n; ++j) {
+				uint64_t t = uint64_t(a[j]) * b[i] + p[i + j] + carry;
+				p[i + j] = uint32_t(t);
+				carry = t >> 32;
+			}
+			p[i + _n] = uint32_t(carry);
+		}
+		Limbs rem{};
+		divmod(p.data(), significant_limbs(p.data(), 2 * _n), _N.data(), _n, nullptr, rem.data());
+		for (size_t i = 0; i < nrLimbs; ++i) r[i] = rem[i];
+	}
+
+	// r = a * b * R^-1 mod N, with a, b < N: interleaves the multiplication with the reduction,
+	// one limb of b at a time, so that the intermediate stays n + 2 limbs wide
+	void montmul(const uint32_t* a, const uint32_t* b, uint32_t* r) const {
+		std::array<uint32_t, nrLimbs + 2> t{};
+		const size_t n = _n;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t carry = 0;
+			for (size_t j = 0; j < n; ++j) {
+				uint64_t cs = uint64_t(t[j]) + uint64_t(a[j]) * b[i] + carry;
+				t[j] = uint32_t(cs);
+				carry = cs >> 32;
+			}
+			uint64_t cs = uint64_t(t[n]) + carry;
+			t[n] = uint32_t(cs);
+			t[n + 1] = uint32_t(cs >> 32);
+			// add m * N, which makes the least significant limb zero, and shift down one limb
+			uint32_t m = t[0] * _mprime;
+			cs = uint64_t(t[0]) + uint64_t(m) * _N[0];
+			carry = cs >> 32;
+			for (size_t j = 1; j < n; ++j) {
+				cs = uint64_t(t[j]) + uint64_t(m) * _N[j] + carry;
+				t[j - 1] = uint32_t(cs);
+				carry = cs >> 32;
+			}
+			cs = uint64_t(t[n]) + carry;
+			t[n - 1] = uint32_t(cs);
+			t[n] = t[n + 1] + uint32_t(cs >> 32);
+		}
+		// the result is smaller than 2N: a single conditional subtraction brings it into [0, N)
+		if (t[n] != 0 || compare_limbs(t.data(), _N.data(), n) >= 0) {
+			sub_limbs(t.data(), _N.data(), n);
+		}
+		for (size_t i = 0; i < nrLimbs; ++i) r[i] = (i < n ? t[i] : 0u);
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// convenience functions for a single operation: they build the context on every call,
+// so loops with a fixed modulus should construct a modular_context once
+
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> mulmod(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b, const integer<nbits, BlockType>& m) {
+	return modular_context<nbits, BlockType>(m).mulmod(a, b);
+}
+
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> powmod(const integer<nbits, BlockType>& base, const integer<nbits, BlockType>& exponent, const integer<nbits, BlockType>& m) {
+	return modular_context<nbits, BlockType>(m).powmod(base, exponent);
+}
+
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> invmod(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& m) {
+	return modular_context<nbits, BlockType>(m).invmod(a);
+}
+
+} // namespace sw::universal
@@ -0,0 +1,199 @@
+#pragma once
+// ntt.hpp: number theoretic transform and transform-based multiplication of large integers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <universal/utility/parallel_for.hpp>
+#include <universal/number/integer/exceptions.hpp>
+#include <universal/number/shared/wide_multiply.hpp>
+
+namespace sw::universal {
+
+/*
+ The number theoretic transform is the discrete Fourier transform over the integers modulo a prime p
+ for which p - 1 has a large power of two as a factor, so that the field has roots of unity of all the
+ power of two orders. The NTT of a sequence of residues is exact: there is no rounding, and the
+ convolution theorem turns a product of two digit sequences into an O(N log N) computation.
+
+ The transform works modulo p = 2^64 - 2^32 + 1. Its multiplicative group has order 2^32 * (2^32 - 1),
+ so transforms up to 2^32 points exist, and since 2^64 = 2^32 - 1 (mod p) and 2^96 = -1 (mod p),
+ a 128-bit product reduces to the residue with a few word-level additions instead of a division.
+
+ ntt_multiply() multiplies two integer<nbits> by splitting them into 16-bit digits: a convolution
+ coefficient is at most N * (2^16 - 1)^2, which stays below p for any transform size, so the
+ digits of the product are recovered exactly by propagating the carries of the inverse transform.
+ */
+struct ntt_field {
+	static constexpr uint64_t modulus = 0xFFFF'FFFF'0000'0001ull;
+	static constexpr uint64_t epsilon = 0xFFFF'FFFFull;   // 2^64 mod p
+	static constexpr uint64_t generator = 7;              // generates the multiplicative group of the field
+	static constexpr size_t   maxLog2 = 32;               // largest power of two that divides p - 1
+
+	static uint64_t add(uint64_t a, uint64_t b) {
+		uint64_t s = a + b;
+		// an overflow of 2^64 is 2^32 - 1 modulo p
+		if (s < a) s += epsilon;
+		return (s >= modulus ? s - modulus : s);
+	}
+	static uint64_t sub(uint64_t a, uint64_t b) {
+		uint64_t d = a - b;
+		if (a < b) d -= epsilon;
+		return d;
+	}
+	static uint64_t mul(uint64_t a, uint64_t b) {
+		uint64_t hi, lo;
+		internal::multiply_64x64(a, b, hi, lo);
+		// lo + 2^64 hi_lo + 2^96 hi_hi = lo + (2^32 - 1) hi_lo - hi_hi (mod p)
+		uint64_t hh = hi >> 32, hl = hi & 0xFFFF'FFFFull;
+		uint64_t t0 = lo - hh;
+		if (lo < hh) t0 -= epsilon;
+		uint64_t t1 = hl * epsilon;
+		uint64_t r = t0 + t1;
+		if (r < t1) r += epsilon;
+		return (r >= modulus ? r - modulus : r);
+	}
+	static uint64_t pow(uint64_t base, uint64_t exponent) {
+		uint64_t result = 1;
+		while (exponent) {
+			if (exponent & 1) result = mul(result, base);
+			base = mul(base, base);
+			exponent >>= 1;
+		}
+		return result;
+	}
+	// multiplicative inverse by Fermat's little theorem
+	static uint64_t inv(uint64_t a) { return pow(a, modulus - 2); }
+};
+
+// iterative radix-2 number theoretic transform of a power of two size
+class ntt_plan {
+public:
+	explicit ntt_plan(size_t n, size_t nrThreads = 1) : _n{ n }, _log2n{ 0 }, _nrThreads{ nrThreads } {
+		if (n == 0 || (n & (n - 1)) != 0) throw ntt_size_not_power_of_two{};
+		while ((size_t(1) << _log2n) < n) ++_log2n;
+		if (_log2n > ntt_field::maxLog2) throw ntt_size_exceeds_roots_of_unity{};
+		_bitrev.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			size_t r = 0;
+			for (size_t b = 0; b < _log2n; ++b) r |= ((i >> b) & 1) << (_log2n - 1 - b);
+			_bitrev[i] = r;
+		}
+		// the powers w_2m^j, j < m, of the primitive 2m-th root of unity of the stage with span m start at offset m - 1
+		_roots.resize(n > 1 ? n - 1 : 0);
+		_inverseRoots.resize(_roots.size());
+		for (size_t m = 1; m < n; m <<= 1) {
+			uint64_t w = ntt_field::pow(ntt_field::generator, (ntt_field::modulus - 1) / (2 * m));
+			uint64_t winv = ntt_field::inv(w);
+			uint64_t r = 1, rinv = 1;
+			for (size_t j = 0; j < m; ++j) {
+				_roots[m - 1 + j] = r;
+				_inverseRoots[m - 1 + j] = rinv;
+				r = ntt_field::mul(r, w);
+				rinv = ntt_field::mul(rinv, winv);
+			}
+		}
+		_ninv = ntt_field::inv(uint64_t(n));
+	}
+
+	size_t size() const noexcept { return _n; }
+
+	// in-place transforms of size() residues in [0, p)
+	void forward(uint64_t* a) const { transform(a, _roots); }
+	void inverse(uint64_t* a) const {
+		transform(a, _inverseRoots);
+		for (size_t i = 0; i < _n; ++i) a[i] = ntt_field::mul(a[i], _ninv);
+	}
+	void forward(std::vector<uint64_t>& a) const { forward(a.data()); }
+	void inverse(std::vector<uint64_t>& a) const { inverse(a.data()); }
+
+private:
+	// below this size the threads cost more than the butterflies of a stage
+	static constexpr size_t parallelThreshold = 1ull << 14;
+
+	size_t                _n;
+	size_t                _log2n;
+	size_t                _nrThreads;
+	std::vector<size_t>   _bitrev;
+	std::vector<uint64_t> _roots;
+	std::vector<uint64_t> _inverseRoots;
+	uint64_t              _ninv;
+
+	void transform(uint64_t* a, const std::vector<uint64_t>& roots) const {
+		for (size_t i = 0; i < _n; ++i) {
+			size_t r = _bitrev[i];
+			if (i < r) std::swap(a[i], a[r]);
+		}
+		size_t nrThreads = (_n >= parallelThreshold ? _nrThreads : 1);
+		for (size_t m = 1; m < _n; m <<= 1) {
+			const uint64_t* w = roots.data() + (m - 1);
+			parallel_for(0, _n / 2, [a, w, m](size_t first, size_t last) {
+				for (size_t t = first; t < last; ++t) {
+					size_t j = t % m;
+					size_t i = (t / m) * 2 * m + j;
+					uint64_t u = a[i];
+					uint64_t v = ntt_field::mul(a[i + m], w[j]);
+					a[i] = ntt_field::add(u, v);
+					a[i + m] = ntt_field::sub(u, v);
+				}
+			}, nrThreads);
+		}
+	}
+};
+
+// exact linear convolution of two sequences of residues: c[k] = sum_i a[i] * b[k - i] (mod p)
+inline std::vector<uint64_t> ntt_convolution(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, size_t nrThreads = 1) {
+	if (a.empty() || b.empty()) return std::vector<uint64_t>();
+	size_t size = a.size() + b.size() - 1;
+	size_t n = 1;
+	while (n < size) n <<= 1;
+	ntt_plan plan(n, nrThreads);
+	std::vector<uint64_t> fa(n, 0), fb(n, 0);
+	for (size_t i = 0; i < a.size(); ++i) fa[i] = a[i];
+	for (size_t i = 0; i < b.size(); ++i) fb[i] = b[i];
+	plan.forward(fa);
+	plan.forward(fb);
+	for (size_t i = 0; i < n; ++i) fa[i] = ntt_field::mul(fa[i], fb[i]);
+	plan.inverse(fa);
+	fa.resize(size);
+	return fa;
+}
+
+// a * b modulo 2^nbits, the same result as operator*, through an NTT convolution of 16-bit digits
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> ntt_multiply(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b, size_t nrThreads = 1) {
+	using Integer = integer<nbits, BlockType>;
+	constexpr size_t nrBytes = Integer::nrBytes;
+	constexpr size_t nrDigits = (nrBytes + 1) / 2;
+	// the two's complement encodings are multiplied as unsigned numbers: the product agrees modulo 2^nbits
+	auto digits = [](const Integer& v) {
+		std::vector<uint64_t> d(nrDigits);
+		for (size_t k = 0; k < nrDigits; ++k) {
+			uint64_t lo = v.byte(2 * k);
+			uint64_t hi = (2 * k + 1 < nrBytes ? v.byte(2 * k + 1) : 0);
+			d[k] = lo | (hi << 8);
+		}
+		while (!d.empty() && d.back() == 0) d.pop_back();
+		return d;
+	};
+	Integer result;
+	result.clear();
+	std::vector<uint64_t> c = ntt_convolution(digits(a), digits(b), nrThreads);
+	uint64_t carry = 0;
+	for (size_t k = 0; k < nrDigits; ++k) {
+		uint64_t v = carry + (k < c.size() ? c[k] : 0);
+		carry = v >> 16;
+		result.setbyte(2 * k, uint8_t(v));
+		if (2 * k + 1 < nrBytes) result.setbyte(2 * k + 1, uint8_t(v >> 8));
+	}
+	// null the bits beyond nbits of the most significant byte
+	constexpr uint8_t msbMask = uint8_t(0xFFu >> (nrBytes * 8 - nbits));
+	result.setbyte(nrBytes - 1, uint8_t(result.byte(nrBytes - 1) & msbMask));
+	return result;
+}
+
+} // namespace sw::universal
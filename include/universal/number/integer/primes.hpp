@@ -5,7 +5,11 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <vector>
+#include <random>
 #include <universal/number/integer/exceptions.hpp>
+#include <universal/number/integer/modular.hpp>
+#include <universal/number/integer/sieves.hpp>
+#include <universal/number/shared/wide_multiply.hpp>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -147,50 +151,196 @@ integer<nbits, BlockType> lcm(const std::vector< integer<nbits, BlockType> >& v)
 	return lcm;
 }
 
+// (a * b) mod m for native 64-bit values
+inline uint64_t mulmod64(uint64_t a, uint64_t b, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+	// the 128-bit division of the compiler; __extension__ keeps -Wpedantic quiet in every includer
+	__extension__ typedef unsigned __int128 uint128;
+	return uint64_t(uint128(a) * b % m);
+#else
+	uint64_t hi, lo;
+	internal::multiply_64x64(a, b, hi, lo);
+	return internal::remainder_128x64(hi, lo, m);
+#endif
+}
+
+// one Miller-Rabin round: returns false if base a witnesses that n = d * 2^s + 1 is composite
+inline bool millerRabinRound(uint64_t n, uint64_t a, uint64_t d, int s) {
+	a %= n;
+	if (a == 0) return true;
+	uint64_t x = 1;
+	for (uint64_t e = d, b = a; e; e >>= 1) {
+		if (e & 1) x = mulmod64(x, b, n);
+		b = mulmod64(b, b, n);
+	}
+	if (x == 1 || x == n - 1) return true;
+	for (int r = 1; r < s; ++r) {
+		x = mulmod64(x, x, n);
+		if (x == n - 1) return true;
+	}
+	return false;
+}
+
+// deterministic Miller-Rabin primality test for native 64-bit values:
+// the first twelve prime bases have no common strong pseudoprime below 3.3 * 10^24
+inline bool isPrime(uint64_t n) {
+	constexpr uint64_t bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+	if (n < 2) return false;
+	for (uint64_t p : bases) {
+		if (n % p == 0) return n == p;
+	}
+	uint64_t d = n - 1;
+	int s = 0;
+	while ((d & 1) == 0) { d >>= 1; ++s; }
+	for (uint64_t a : bases) {
+		if (!millerRabinRound(n, a, d, s)) return false;
+	}
+	return true;
+}
+
+// true if the value of a is non-negative and fits in 64 bits
+template<size_t nbits, typename BlockType>
+bool fitsUint64(const integer<nbits, BlockType>& a) {
+	if (a.sign()) return false;
+	for (unsigned i = 8; i < a.nrBytes; ++i) if (a.byte(i) != 0) return false;
+	return true;
+}
+
+// probabilistic Miller-Rabin primality test: a composite passes a round with probability at most 1/4
+// The first twelve prime bases are always used, the remaining rounds use pseudo-random bases
+// from a fixed seed, so that the outcome is reproducible.
+template<size_t nbits, typename BlockType>
+bool isProbablePrime(const integer<nbits, BlockType>& n, unsigned reps = 25) {
+	using Integer = integer<nbits, BlockType>;
+	if (fitsUint64(n)) return isPrime((unsigned long long)n);
+	if (n.sign() || n.iseven()) return false;
+	modular_context<nbits, BlockType> ctx(n);
+	Integer nMinusOne = n - 1;
+	Integer d = nMinusOne;
+	int s = 0;
+	while (d.iseven()) { d >>= 1; ++s; }
+	auto witness = [&](const Integer& a) {
+		Integer x = ctx.powmod(a, d);
+		if (x == 1 || x == nMinusOne) return false;
+		for (int r = 1; r < s; ++r) {
+			x = ctx.mulmod(x, x);
+			if (x == nMinusOne) return false;
+			if (x == 1) return true;
+		}
+		return true;
+	};
+	constexpr unsigned bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+	unsigned round = 0;
+	for (; round < reps && round < 12; ++round) {
+		if (witness(Integer(bases[round]))) return false;
+	}
+	std::mt19937_64 engine(nbits);
+	for (; round < reps; ++round) {
+		Integer a(0);
+		for (size_t i = 0; i < nbits; i += 32) {
+			a <<= 32;
+			a += Integer(engine() & 0xFFFF'FFFFu);
+		}
+		a = ctx.reduce(a);  // [0, n)
+		if (a < 2) a += 2;
+		if (witness(a)) return false;
+	}
+	return true;
+}
+
 // check if a number is prime
+// deterministic for values that fit in 64 bits, probabilistic with 25 Miller-Rabin rounds otherwise
 template<size_t nbits, typename BlockType>
 bool isPrime(const integer<nbits, BlockType>& a) {
-	if (a.iszero() || a == 1) return false; // smallest prime number is 2
-	for (integer<nbits, BlockType> i = 2; i < a / 2; ++i) if ((a % i) == 0) return false;
-	return true;
+	if (fitsUint64(a)) return isPrime((unsigned long long)a);
+	return isProbablePrime(a, 25);
 }
 
 // generate prime numbers in a range
+// ranges that fit in 64 bits use the segmented sieve, wider ranges test the odd candidates with Miller-Rabin
 template<size_t nbits, typename BlockType>
 bool primeNumbersInRange(const integer<nbits, BlockType>& low, const integer<nbits, BlockType>& high, std::vector< integer<nbits, BlockType> >& primes) {
-	bool bFound = false;
-	for (integer<nbits, BlockType> i = low; i < high; ++i) {
-		if (isPrime(i)) {
-			primes.push_back(i);
-			bFound = true;
+	using Integer = integer<nbits, BlockType>;
+	if (high <= low) return false;
+	size_t nrOfPrimes = primes.size();
+	if (fitsUint64(high)) {
+		uint64_t first = (low.sign() ? 0ull : (unsigned long long)low);
+		segmentedSieve(first, (unsigned long long)high, [&primes](uint64_t p) { primes.push_back(Integer(p)); });
+	}
+	else {
+		Integer i = low;
+		if (i < 2) i = 2;
+		if (i == 2) { primes.push_back(i); ++i; }
+		if (i.iseven()) ++i;
+		for (; i < high; i += 2) {
+			if (isPrime(i)) primes.push_back(i);
 		}
 	}
-	return bFound;
+	return primes.size() > nrOfPrimes;
 }
 
 // prime factors of an arbitrary integer
 template<size_t nbits, typename BlockType>
 class primefactors : public std::vector< std::pair< integer<nbits, BlockType>, integer<nbits, BlockType> > > { };
 
+// remainder of a non-negative integer by a native divisor, one byte at a time
+template<size_t nbits, typename BlockType>
+uint32_t nativeRemainder(const integer<nbits, BlockType>& a, uint32_t divisor) {
+	uint64_t r = 0;
+	for (unsigned i = a.nrBytes; i-- > 0; ) r = ((r << 8) | a.byte(i)) % divisor;
+	return uint32_t(r);
+}
+
 // generate prime factors of an arbitrary integer
+// Trial division by 2 and the odd numbers: a composite trial divisor never divides the
+// remaining cofactor, as its prime factors have already been divided out. The search
+// stops as soon as the cofactor is prime. Trial divisors are native integers, and the
+// cofactor moves to a native integer as well once it fits in 64 bits.
 template<size_t nbits, typename BlockType>
 void primeFactorization(const integer<nbits, BlockType>& a, primefactors<nbits, BlockType>& factors) {
 	using Integer = integer<nbits, BlockType>;
+	if (a.sign() || a < 2) return;
 	Integer i(a);
-	Integer factor = 2;
 	Integer power = 0;
 	// powers of 2
 	while (i.iseven()) { ++power; i >>= 1; }
-	if (power > 0) factors.push_back(std::pair<Integer, Integer>(factor, power));
+	if (power > 0) factors.push_back(std::pair<Integer, Integer>(Integer(2), power));
 	// powers of odd numbers > 2
-	for (factor = 3; factor <= sqrt(i); factor += 2) {
-		if (isPrime(factor)) {
+	uint64_t f = 3;
+	bool primeCofactor = isPrime(i);
+	// a cofactor wider than 64 bits is larger than the square of any 32-bit divisor
+	for (; !primeCofactor && !fitsUint64(i) && f < 0xFFFF'FFFFull; f += 2) {
+		if (nativeRemainder(i, uint32_t(f)) == 0) {
+			Integer factor(f);
 			power = 0;
-			while ((i % factor) == 0) { ++power; i /= factor; }
-			if (power > 0) factors.push_back(std::pair<Integer, Integer>(factor, power));
+			while (nativeRemainder(i, uint32_t(f)) == 0) { ++power; i /= factor; }
+			factors.push_back(std::pair<Integer, Integer>(factor, power));
+			primeCofactor = isPrime(i);
+		}
+	}
+	if (!primeCofactor && !fitsUint64(i)) {
+		for (Integer factor(f); !primeCofactor && factor * factor <= i; factor += 2) {
+			if ((i % factor) == 0) {
+				power = 0;
+				while ((i % factor) == 0) { ++power; i /= factor; }
+				factors.push_back(std::pair<Integer, Integer>(factor, power));
+				primeCofactor = isPrime(i);
+			}
+		}
+	}
+	if (!primeCofactor && fitsUint64(i)) {
+		uint64_t n = (unsigned long long)i;
+		for (; !primeCofactor && f <= n / f; f += 2) {
+			if (n % f == 0) {
+				uint64_t p = 0;
+				while (n % f == 0) { ++p; n /= f; }
+				factors.push_back(std::pair<Integer, Integer>(Integer(f), Integer(p)));
+				primeCofactor = isPrime(n);
+			}
 		}
+		i = n;
 	}
-	if (i > 2) factors.push_back(std::pair < Integer, Integer>(i, 1));
+	if (i > 1) factors.push_back(std::pair<Integer, Integer>(i, Integer(1)));
 }
 
 // Factorization using Fermat's method: precondition number must be odd
@@ -5,7 +5,13 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <bit>
+#include <atomic>
 #include <universal/number/integer/exceptions.hpp>
+#include <universal/utility/parallel_for.hpp>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -37,7 +43,154 @@
 
 #endif
 
+// size of the sieve bitmap of a segment: sized to stay resident in the L1 data cache
+#if !defined(SIEVE_SEGMENT_BYTES)
+#define SIEVE_SEGMENT_BYTES 32768
+#endif
+
 namespace sw::universal {
 
+// floor(sqrt(n)) for native 64-bit values
+inline uint64_t isqrt64(uint64_t n) {
+	uint64_t r = uint64_t(std::sqrt(double(n)));
+	while (r > 0 && (r > n / r)) --r;                // r * r > n without overflow
+	while ((r + 1) <= n / (r + 1)) ++r;
+	return r;
+}
+
+// sieve of Eratosthenes: all primes <= limit
+inline std::vector<uint64_t> sieveOfEratosthenes(uint64_t limit) {
+	std::vector<uint64_t> primes;
+	if (limit < 2) return primes;
+	std::vector<bool> composite(limit + 1, false);
+	for (uint64_t p = 2; p * p <= limit; ++p) {
+		if (!composite[p]) for (uint64_t m = p * p; m <= limit; m += p) composite[m] = true;
+	}
+	for (uint64_t p = 2; p <= limit; ++p) if (!composite[p]) primes.push_back(p);
+	return primes;
+}
+
+/*
+ Segmented sieve of Eratosthenes on the odd numbers of [low, high)
+
+ The range is cut into segments whose bitmap (one bit per odd number) fits in
+ the L1 cache, and each segment is sieved with the odd base primes <= sqrt(high).
+ A run of consecutive segments carries the next multiple of every base prime
+ from one segment to the next, so a segment costs one pass over the base primes
+ plus the crossing-off itself. Runs of segments are independent, which is what
+ the multithreaded drivers partition across threads.
+ */
+class segmented_sieve {
+public:
+	segmented_sieve(uint64_t low, uint64_t high, size_t segmentBytes = SIEVE_SEGMENT_BYTES) 
+		: _low{ low }, _high{ high }, _oddLow{ 0 }, _nrOdds{ 0 }, _segmentBits{ 8 * (segmentBytes < 8 ? 8 : segmentBytes) } {
+		_segmentBits -= _segmentBits % 64;
+		_oddLow = (low < 3 ? 3 : (low | 1));
+		_nrOdds = (high > _oddLow ? (high - _oddLow + 1) / 2 : 0);
+		if (high > 2) {
+			for (uint64_t p : sieveOfEratosthenes(isqrt64(high - 1))) if (p > 2) _basePrimes.push_back(p);
+		}
+	}
+
+	// 2 is not represented in the odd-only bitmap
+	bool containsTwo() const noexcept { return _low <= 2 && 2 < _high; }
+	size_t nrSegments() const noexcept { return size_t((_nrOdds + _segmentBits - 1) / _segmentBits); }
+	// segment that contains the odd number v
+	size_t segmentOf(uint64_t v) const noexcept { return size_t(((v - _oddLow) / 2) / _segmentBits); }
+
+	// visit the odd primes of segments [first, last) in increasing order
+	template<typename Visitor>
+	void sieve(size_t first, size_t last, Visitor&& visit) const {
+		if (first >= last) return;
+		std::vector<uint64_t> bitmap(_segmentBits / 64);
+		// odd index of the next multiple of each base prime, starting at p^2
+		uint64_t startIndex = uint64_t(first) * _segmentBits;
+		uint64_t startValue = _oddLow + 2 * startIndex;
+		std::vector<uint64_t> next(_basePrimes.size());
+		for (size_t j = 0; j < _basePrimes.size(); ++j) {
+			uint64_t p = _basePrimes[j];
+			uint64_t m = p * p;
+			if (m < startValue) {
+				m = ((startValue + p - 1) / p) * p;
+				if ((m & 1u) == 0) m += p;
+			}
+			next[j] = (m - _oddLow) / 2;
+		}
+		for (size_t s = first; s < last; ++s) {
+			uint64_t segBegin = uint64_t(s) * _segmentBits;
+			uint64_t segEnd = segBegin + _segmentBits;
+			if (segEnd > _nrOdds) segEnd = _nrOdds;
+			uint64_t segLastValue = _oddLow + 2 * (segEnd - 1);
+			std::fill(bitmap.begin(), bitmap.end(), 0);
+			for (size_t j = 0; j < _basePrimes.size(); ++j) {
+				uint64_t p = _basePrimes[j];
+				if (p * p > segLastValue) break;
+				uint64_t i = next[j];
+				for (; i < segEnd; i += p) {
+					uint64_t bit = i - segBegin;
+					bitmap[bit / 64] |= uint64_t(1) << (bit % 64);
+				}
+				next[j] = i;
+			}
+			// report the unmarked odd numbers
+			uint64_t nrBits = segEnd - segBegin;
+			for (uint64_t w = 0; w * 64 < nrBits; ++w) {
+				uint64_t candidates = ~bitmap[w];
+				if ((w + 1) * 64 > nrBits) candidates &= (uint64_t(1) << (nrBits % 64)) - 1;
+				while (candidates) {
+					int b = std::countr_zero(candidates);
+					candidates &= candidates - 1;
+					visit(_oddLow + 2 * (segBegin + w * 64 + uint64_t(b)));
+				}
+			}
+		}
+	}
+
+private:
+	uint64_t _low, _high;
+	uint64_t _oddLow;                  // first odd number >= max(low, 3)
+	uint64_t _nrOdds;                  // number of odd numbers in [_oddLow, high)
+	uint64_t _segmentBits;             // odd numbers per segment
+	std::vector<uint64_t> _basePrimes; // odd primes <= sqrt(high - 1)
+};
+
+// visit all primes in [low, high) in increasing order
+template<typename Visitor>
+void segmentedSieve(uint64_t low, uint64_t high, Visitor&& visit, size_t segmentBytes = SIEVE_SEGMENT_BYTES) {
+	segmented_sieve sieve(low, high, segmentBytes);
+	if (sieve.containsTwo()) visit(uint64_t(2));
+	sieve.sieve(0, sieve.nrSegments(), visit);
+}
+
+// count the primes in [low, high), nrThreads == 0 uses all hardware threads
+inline uint64_t countPrimes(uint64_t low, uint64_t high, size_t nrThreads = 1, size_t segmentBytes = SIEVE_SEGMENT_BYTES) {
+	segmented_sieve sieve(low, high, segmentBytes);
+	std::atomic<uint64_t> count{ sieve.containsTwo() ? 1u : 0u };
+	parallel_for(0, sieve.nrSegments(), [&](size_t first, size_t last) {
+		uint64_t partial{ 0 };
+		sieve.sieve(first, last, [&partial](uint64_t) { ++partial; });
+		count += partial;
+	}, nrThreads);
+	return count;
+}
+
+// all primes in [low, high) in increasing order, nrThreads == 0 uses all hardware threads
+inline std::vector<uint64_t> primesInRange(uint64_t low, uint64_t high, size_t nrThreads = 1, size_t segmentBytes = SIEVE_SEGMENT_BYTES) {
+	segmented_sieve sieve(low, high, segmentBytes);
+	std::vector<uint64_t> primes;
+	if (sieve.containsTwo()) primes.push_back(2);
+	size_t nrSegments = sieve.nrSegments();
+	if (nrThreads == 1) {
+		sieve.sieve(0, nrSegments, [&primes](uint64_t p) { primes.push_back(p); });
+		return primes;
+	}
+	// each segment collects into its own list, concatenated in order afterwards
+	std::vector< std::vector<uint64_t> > segments(nrSegments);
+	parallel_for(0, nrSegments, [&](size_t first, size_t last) {
+		sieve.sieve(first, last, [&](uint64_t p) { segments[sieve.segmentOf(p)].push_back(p); });
+	}, nrThreads);
+	for (const auto& segment : segments) primes.insert(primes.end(), segment.begin(), segment.end());
+	return primes;
+}
 
 } // namespace sw::universal
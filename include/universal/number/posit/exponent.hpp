@@ -38,7 +38,7 @@ public:
 		return int(_Bits.to_ulong());
 	}
 	long double value() const {
-		return (long double)(uint64_t(1) << scale());
+		return std::ldexp(1.0l, int(scale()));  // the exponent of es > 6 exceeds the range of a 64-bit shift
 	}
 	bitblock<es> get() const {
 		return _Bits;
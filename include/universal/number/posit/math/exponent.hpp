@@ -4,24 +4,20 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The functions are evaluated in the extended precision type of the posit and rounded once,
+// see extended_precision.hpp. The exponentials never round to zero: a result below minpos
+// projects to minpos, and a result above maxpos saturates to maxpos.
 
 // Base-e exponential function
 template<size_t nbits, size_t es>
 posit<nbits,es> exp(posit<nbits,es> x) {
 	if (isnar(x)) return x;
-	posit<nbits, es> p;
-	double d = std::exp(double(x));
-	if (d == 0.0) {
-		p.minpos();
-	}
-	else {
-		p = d;
-	}
+	posit<nbits, es> p = internal::posit_function(x, [](const auto& v) { using std::exp; return exp(v); });
+	if (p.iszero()) p.minpos();
 	return p;
 }
 
@@ -29,28 +25,27 @@ posit<nbits,es> exp(posit<nbits,es> x) {
 template<size_t nbits, size_t es>
 posit<nbits,es> exp2(posit<nbits,es> x) {
 	if (isnar(x)) return x;
-	posit<nbits, es> p;
-	double d = std::exp2(double(x));
-	if (d == 0.0) {
-		p.minpos();
-	}
-	else {
-		p = d;
-	}
+	posit<nbits, es> p = internal::posit_function(x, [](const auto& v) { using std::exp2; return exp2(v); });
+	if (p.iszero()) p.minpos();
 	return p;
 }
 
 // Base-10 exponential function
 template<size_t nbits, size_t es>
 posit<nbits, es> exp10(posit<nbits, es> x) {
-	return posit<nbits, es>(std::pow(10.0, double(x)));
+	if (isnar(x)) return x;
+	posit<nbits, es> p = internal::posit_function(x, [](const auto& v) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(v)>, double>) return std::pow(10.0, v); else return exp10(v);
+	});
+	if (p.iszero()) p.minpos();
+	return p;
 }
 		
 // Base-e exponential function exp(x)-1
 template<size_t nbits, size_t es>
 posit<nbits,es> expm1(posit<nbits,es> x) {
-	return posit<nbits,es>(std::expm1(double(x)));
+	if (isnar(x)) return x;
+	return internal::posit_function(x, [](const auto& v) { using std::expm1; return expm1(v); });
 }
 
-
 }  // namespace sw::universal
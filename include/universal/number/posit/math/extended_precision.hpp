@@ -0,0 +1,184 @@
+#pragma once
+// extended_precision.hpp: evaluation of posit elementary functions in an extended precision type
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <type_traits>
+#include <universal/number/qd/qd.hpp>
+
+/*
+   The elementary functions of a posit are evaluated in a floating-point type that carries
+   at least 24 bits more than the widest fraction of the posit: double for posits with up to
+   29 fraction bits, dd_real up to 82 bits, qd_real beyond. The argument enters that type
+   exactly, the function is evaluated with the argument reduction and series kernels of the
+   multi-double library, and the result is rounded once into the posit, using the complete
+   tail of the extended value as sticky bit. A result is misrounded only when it lies within
+   2^-24 of a rounding boundary of the posit, which is the regime where the tapered precision
+   near 1 matters most and where a trip through double loses the bits of posit<64,3> and wider.
+
+   Posits of 16 bits or less evaluate a one-argument function through a table indexed by the
+   encoding. The table is filled on first use with dd_real evaluations, which correctly rounds
+   every entry, and turns every later call into a single load.
+ */
+
+namespace sw::universal {
+
+namespace internal {
+
+	// the evaluation type of the elementary functions of posit<nbits, es>
+	template<size_t nbits, size_t es>
+	struct posit_extended_precision {
+		static constexpr int fbits = int(posit<nbits, es>::fbits);
+		static constexpr int guard = 24;
+		using type = std::conditional_t<(fbits + guard <= 53), double,
+		             std::conditional_t<(fbits + guard <= 106), dd_real, qd_real>>;
+	};
+
+	// posits up to this size evaluate one-argument functions through a table of all encodings
+	constexpr size_t posit_function_table_nbits = 16;
+
+	// the NaN of an extended type, which rounds to NaR
+	template<typename Real>
+	Real extended_nan() { return Real(std::numeric_limits<double>::quiet_NaN()); }
+
+	inline bool extended_isnan(double v) { return std::isnan(v); }
+	inline bool extended_isinf(double v) { return std::isinf(v); }
+	template<typename Real>
+	bool extended_isnan(const Real& v) { return v.isnan(); }
+	template<typename Real>
+	bool extended_isinf(const Real& v) { return v.isinf(); }
+
+	// the exact value of a posit in the extended type, NaR maps to NaN
+	template<typename Real, size_t nbits, size_t es>
+	Real posit_to_extended(const posit<nbits, es>& p) {
+		using std::ldexp;
+		if (p.iszero()) return Real(0.0);
+		if (p.isnar()) return Real(std::numeric_limits<double>::quiet_NaN());
+		// decode the encoding with the generic field accessors, which the fast specializations share
+		constexpr size_t fbits = posit<nbits, es>::fbits;
+		bool sign{ false };
+		sw::universal::regime<nbits, es> r;
+		sw::universal::exponent<nbits, es> e;
+		sw::universal::fraction<fbits> f;
+		sw::universal::decode(p.get(), sign, r, e, f);
+		bitblock<fbits> fraction = f.get();
+		// collect the fraction in chunks of 52 bits, each of which is a double
+		Real x(1.0);
+		int position = 0;  // the number of fraction bits collected
+		while (position < int(fbits)) {
+			int chunk = std::min(52, int(fbits) - position);
+			uint64_t bits{ 0 };
+			for (int i = 0; i < chunk; ++i) bits = (bits << 1) | (fraction.test(fbits - 1 - size_t(position + i)) ? 1 : 0);
+			position += chunk;
+			if (bits != 0) x += std::ldexp(double(bits), -position);
+		}
+		x = ldexp(x, r.scale() + e.scale());
+		return (sign ? -x : x);
+	}
+
+	// round an extended value into a posit: NaN maps to NaR, infinities saturate to maxpos
+	template<size_t nbits, size_t es, typename Real>
+	posit<nbits, es> posit_from_extended(const Real& x) {
+		using std::ldexp;
+		using std::floor;
+		posit<nbits, es> p;
+		if (extended_isnan(x)) {
+			p.setnar();
+			return p;
+		}
+		if (x == Real(0.0)) return p;
+		bool sign = (x < Real(0.0));
+		if (extended_isinf(x)) {
+			p.maxpos();
+			return (sign ? -p : p);
+		}
+		Real a = (sign ? -x : x);
+		// a = 2^scale * f with f in [1, 2), the leading component can be a power of two above a negative tail
+		int scale{ 0 };
+		(void)std::frexp(double(a), &scale);
+		--scale;
+		Real f = ldexp(a, -scale);
+		if (f < Real(1.0)) {
+			f = ldexp(f, 1);
+			--scale;
+		}
+		f -= 1.0;
+		// the fraction window holds all posit fraction bits plus guard and round, and ends in the sticky bit
+		constexpr size_t wbits = ((nbits + 31) / 32) * 32;
+		bitblock<wbits> fraction;
+		for (size_t chunk = 0; chunk < wbits / 32; ++chunk) {
+			f = ldexp(f, 32);
+			Real digits = floor(f);
+			f -= digits;
+			uint64_t bits = uint64_t(double(digits));
+			for (size_t i = 0; i < 32; ++i) fraction.set(wbits - 1 - (32 * chunk + i), (bits >> (31 - i)) & 1);
+		}
+		if (f != Real(0.0)) fraction.set(0, true);
+		return convert_<nbits, es, wbits>(sign, scale, fraction, p);
+	}
+
+	// evaluate a one-argument function in the extended type of the posit
+	template<size_t nbits, size_t es, typename Function>
+	posit<nbits, es> posit_evaluate_extended(const posit<nbits, es>& x, Function f) {
+		using Real = typename posit_extended_precision<nbits, es>::type;
+		return posit_from_extended<nbits, es>(f(posit_to_extended<Real>(x)));
+	}
+
+	// evaluate a two-argument function in the extended type of the posit
+	template<size_t nbits, size_t es, typename Function>
+	posit<nbits, es> posit_evaluate_extended(const posit<nbits, es>& x, const posit<nbits, es>& y, Function f) {
+		using Real = typename posit_extended_precision<nbits, es>::type;
+		return posit_from_extended<nbits, es>(f(posit_to_extended<Real>(x), posit_to_extended<Real>(y)));
+	}
+
+	// evaluate a periodic function in the extended type of the posit. The reduction modulo pi/2 cancels
+	// the integer bits of the argument, so large arguments move to a wider type that still carries
+	// the fraction and guard bits after the cancellation.
+	template<size_t nbits, size_t es, typename Function>
+	posit<nbits, es> posit_evaluate_periodic(const posit<nbits, es>& x, Function f) {
+		constexpr int bits = posit_extended_precision<nbits, es>::fbits + posit_extended_precision<nbits, es>::guard;
+		int scale = (x.iszero() || x.isnar()) ? 0 : std::ilogb(double(x));
+		int needed = bits + std::max(0, scale);
+		if (needed <= 53) return posit_from_extended<nbits, es>(f(posit_to_extended<double>(x)));
+		if (needed <= 106) return posit_from_extended<nbits, es>(f(posit_to_extended<dd_real>(x)));
+		return posit_from_extended<nbits, es>(f(posit_to_extended<qd_real>(x)));
+	}
+
+	// a one-argument function of a posit: a table lookup for small posits, an extended evaluation otherwise.
+	// The function object must be generic over double, dd_real, and qd_real; each function object type
+	// owns its table. Periodic functions select the evaluation type by the magnitude of the argument.
+	template<bool periodic = false, size_t nbits, size_t es, typename Function>
+	posit<nbits, es> posit_function(const posit<nbits, es>& x, Function f) {
+		if constexpr (nbits <= posit_function_table_nbits) {
+			static const std::vector<posit<nbits, es>> table = [&f]() {
+				constexpr size_t nrOfEncodings = size_t(1) << nbits;
+				std::vector<posit<nbits, es>> t(nrOfEncodings);
+				posit<nbits, es> a;
+				for (size_t i = 0; i < nrOfEncodings; ++i) {
+					a.setbits(i);
+					if constexpr (periodic) {
+						t[i] = posit_evaluate_periodic(a, f);
+					}
+					else {
+						t[i] = posit_from_extended<nbits, es>(f(posit_to_extended<dd_real>(a)));
+					}
+				}
+				return t;
+			}();
+			return table[size_t(x.encoding())];
+		}
+		else if constexpr (periodic) {
+			return posit_evaluate_periodic(x, f);
+		}
+		else {
+			return posit_evaluate_extended(x, f);
+		}
+	}
+
+}  // namespace internal
+
+}  // namespace sw::universal
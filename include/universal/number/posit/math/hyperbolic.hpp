@@ -4,50 +4,55 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The functions are evaluated in the extended precision type of the posit and rounded once,
+// see extended_precision.hpp. Arguments outside of the domain yield NaR.
 
-// value representing an angle expressed in radians
-// One radian is equivalent to 180/PI degrees
-
-// hyperbolic sine of an angle of x radians
+// hyperbolic sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> sinh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::sinh(double(x)));
+	return internal::posit_function(x, [](const auto& v) { using std::sinh; return sinh(v); });
 }
 
-// hyperbolic cosine of an angle of x radians
+// hyperbolic cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> cosh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::cosh(double(x)));
+	return internal::posit_function(x, [](const auto& v) { using std::cosh; return cosh(v); });
 }
 
-// hyperbolic tangent of an angle of x radians
+// hyperbolic tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> tanh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::tanh(double(x)));
+	return internal::posit_function(x, [](const auto& v) { using std::tanh; return tanh(v); });
 }
 
-// hyperbolic cotangent of an angle of x radians
+// inverse hyperbolic tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> atanh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::atanh(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::atanh;
+		return (v > Real(-1.0) && v < Real(1.0) ? atanh(v) : internal::extended_nan<Real>());
+	});
 }
 
-// hyperbolic cosecant of an angle of x radians
+// inverse hyperbolic cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> acosh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::acosh(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::acosh;
+		return (v >= Real(1.0) ? acosh(v) : internal::extended_nan<Real>());
+	});
 }
 
-// hyperbolic secant of an angle of x radians
+// inverse hyperbolic sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> asinh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::asinh(double(x)));
+	return internal::posit_function(x, [](const auto& v) { using std::asinh; return asinh(v); });
 }
 
-
 }  // namespace sw::universal
@@ -37,15 +37,16 @@ POSIX specifies that underflow may only occur when both arguments are subnormal
 
 hypot(INFINITY, NAN) returns +8, but sqrt(INFINITY*INFINITY+NAN*NAN) returns NaN.
 */
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// hypot is evaluated in the extended precision type of the posit and rounded once, see extended_precision.hpp.
+// hypotf and hypotl are shims through the native types.
 
 template<size_t nbits, size_t es>
 posit<nbits,es> hypot(posit<nbits,es> x, posit<nbits,es> y) {
-	return posit<nbits,es>(std::hypot(double(x),double(y)));
+	return internal::posit_evaluate_extended(x, y, [](const auto& a, const auto& b) { using std::hypot; return hypot(a, b); });
 }
 
 template<size_t nbits, size_t es>
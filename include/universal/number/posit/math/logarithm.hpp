@@ -4,34 +4,51 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The functions are evaluated in the extended precision type of the posit and rounded once,
+// see extended_precision.hpp. The logarithm of zero or of a negative value is NaR.
 
 // Natural logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::log;
+		return (v > Real(0.0) ? log(v) : internal::extended_nan<Real>());
+	});
 }
 
 // Binary logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log2(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log2(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::log2;
+		return (v > Real(0.0) ? log2(v) : internal::extended_nan<Real>());
+	});
 }
 
 // Decimal logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log10(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log10(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::log10;
+		return (v > Real(0.0) ? log10(v) : internal::extended_nan<Real>());
+	});
 }
 		
 // Natural logarithm of 1+x
 template<size_t nbits, size_t es>
 posit<nbits,es> log1p(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log1p(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::log1p;
+		return (v > Real(-1.0) ? log1p(v) : internal::extended_nan<Real>());
+	});
 }
 
 }  // namespace sw::universal
@@ -0,0 +1,74 @@
+#pragma once
+// minimax_tables.hpp: minimax polynomial kernels of the elementary functions for posits
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+/*
+ The coefficient tables are generated by applications/chebyshev/minimax.cpp and loaded with
+ sw::function::polynomial_kernel<Scalar, Degree>::from_table(center, coefficients).
+ The coefficients are values of the target format, written as exact double literals.
+ Regenerate the tables after a change to the generator.
+ */
+
+namespace sw { namespace universal {
+
+// exp(x) on [-ln2/2, ln2/2] for posit<16,1>
+// p(x) = sum_j exp_posit16_coefficients[j] * (x - exp_posit16_center)^j
+constexpr double exp_posit16_center = 0x0p+0;
+constexpr double exp_posit16_coefficients[4] = {
+	0x1.fffp-1,   // c0 = 0.9998779296875
+	0x1.ffdp-1,   // c1 = 0.9996337890625
+	0x1.032p-1,   // c2 = 0.506103515625
+	0x1.626p-3    // c3 = 0.17303466796875
+};
+// largest relative error of exp on [-4, 4] : 0.0012538289818141732
+
+// exp(x) on [-ln2/2, ln2/2] for posit<32,2>
+// p(x) = sum_j exp_posit32_coefficients[j] * (x - exp_posit32_center)^j
+constexpr double exp_posit32_center = 0x0p+0;
+constexpr double exp_posit32_coefficients[8] = {
+	0x1p+0,   // c0 = 1
+	0x1p+0,   // c1 = 1
+	0x1.0000006p-1,   // c2 = 0.5000000111758709
+	0x1.5555534p-3,   // c3 = 0.16666665114462376
+	0x1.5554688p-5,   // c4 = 0.041666225530207157
+	0x1.1112fa4p-7,   // c5 = 0.0083335611270740628
+	0x1.6da4ac8p-10,   // c6 = 0.0013948183332104236
+	0x1.9eb725p-13    // c7 = 0.00019775171676883474
+};
+// largest relative error of exp on [-4, 4] : 3.0138625003508893e-08
+
+// log1p(x) on [-1/4, 1/2] for posit<16,1>
+// p(x) = sum_j log1p_posit16_coefficients[j] * (x - log1p_posit16_center)^j
+constexpr double log1p_posit16_center = 0x1p-3;
+constexpr double log1p_posit16_coefficients[6] = {
+	0x1.e26p-4,   // c0 = 0.117767333984375
+	0x1.c72p-1,   // c1 = 0.888916015625
+	-0x1.938p-2,   // c2 = -0.39404296875
+	0x1.dbep-3,   // c3 = 0.23236083984375
+	-0x1.67p-3,   // c4 = -0.17529296875
+	0x1.0c6p-3    // c5 = 0.13104248046875
+};
+
+// log1p(x) on [-1/4, 1/2] for posit<32,2>
+// p(x) = sum_j log1p_posit32_coefficients[j] * (x - log1p_posit32_center)^j
+constexpr double log1p_posit32_center = 0x1p-3;
+constexpr double log1p_posit32_coefficients[13] = {
+	0x1.e27076ep-4,   // c0 = 0.11778303561732173
+	0x1.c71c71cp-1,   // c1 = 0.8888888880610466
+	-0x1.948b0fap-2,   // c2 = -0.39506172575056553
+	0x1.df75776p-3,   // c3 = 0.23411076795309782
+	-0x1.3fa3c6ap-3,   // c4 = -0.1560740964487195
+	0x1.c692526p-4,   // c5 = 0.11097938707098365
+	-0x1.50b040ap-4,   // c6 = -0.082199337426573038
+	0x1.0130aeap-4,   // c7 = 0.062790567521005869
+	-0x1.90ede08p-5,   // c8 = -0.048941553570330143
+	0x1.2cf3f94p-5,   // c9 = 0.036737429443746805
+	-0x1.d6b5474p-6,   // c10 = -0.028729743557050824
+	0x1.187dd1p-5,   // c11 = 0.03423968143761158
+	-0x1.e2bc9ecp-6    // c12 = -0.029463915852829814
+};
+
+}} // namespace sw::universal
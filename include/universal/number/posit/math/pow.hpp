@@ -4,25 +4,37 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The power functions are evaluated in the extended precision type of the posit and rounded once,
+// see extended_precision.hpp. A negative base with a non-integral exponent yields NaR.
+
+namespace internal {
+	template<typename Real>
+	Real extended_pow(const Real& x, const Real& y) {
+		using std::pow;
+		if (x == Real(0.0)) return (y > Real(0.0) ? Real(0.0) : (y == Real(0.0) ? Real(1.0) : extended_nan<Real>()));
+		return pow(x, y);
+	}
+}
 
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, posit<nbits, es> y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	return internal::posit_evaluate_extended(x, y, [](const auto& a, const auto& b) { return internal::extended_pow(a, b); });
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, int y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	using Real = typename internal::posit_extended_precision<nbits, es>::type;
+	return internal::posit_from_extended<nbits, es>(internal::extended_pow(internal::posit_to_extended<Real>(x), Real(double(y))));
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, double y) {
-	return posit<nbits,es>(std::pow(double(x), y));
+	using Real = typename internal::posit_extended_precision<nbits, es>::type;
+	return internal::posit_from_extended<nbits, es>(internal::extended_pow(internal::posit_to_extended<Real>(x), Real(y)));
 }
 
 // calculate an integer power function base^int
@@ -4,42 +4,14 @@
 // Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <bit>
 #include <universal/native/ieee754.hpp>
 #include <universal/number/posit/math/sqrt_tables.hpp>
-
-#ifndef POSIT_NATIVE_SQRT
-#define POSIT_NATIVE_SQRT 0
-#endif
+#include <universal/number/posit/math/extended_precision.hpp>
+#include <universal/number/shared/significand_sqrt.hpp>
 
 namespace sw::universal {
 
-	// straight Babylonian
-	inline double babylonian(double v) {
-		double x_n = 0.5 * v; // initial guess
-		const double eps = 1.0e-7;   // 
-		do {
-			x_n = (x_n + v / x_n) / 2.0;
-		} while (std::abs(x_n * x_n - v) > eps);
-
-		return x_n;
-	}
-
-	template<size_t nbits, size_t es>
-	inline posit<nbits, es> BabylonianMethod(const posit<nbits, es>& v) {
-		const double eps = 1.0e-5;
-		posit<nbits, es> half(0.5);
-		posit<nbits, es> x_next;
-		posit<nbits, es> x_n = half * v;
-		posit<nbits, es> diff;
-		do {
-			x_next = (x_n + v / x_n) * half;
-			diff = x_next - x_n;
-			if (_trace_sqrt) std::cout << " x_n+1: " << x_next << " x_n: " << x_n << " diff " << diff << std::endl;
-			x_n = x_next;
-		} while (double(sw::universal::abs(diff)) > eps);
-		return x_n;
-	}
-
 	/*
 	- Consider the function argument, x, in floating-point form, with a base
 	(or radix) B, exponent e, and a fraction, f , such that 1/B <= f < 1.
@@ -122,46 +94,71 @@ namespace sw::universal {
 		return v.to_float();
 	}
 
-	// fast sqrt at a given posit configuration.
-	template<size_t nbits, size_t es, size_t fbits>
-	inline internal::value<fbits> fast_sqrt(internal::value<fbits>& v) {
-		if (_trace_sqrt) std::cout << "---------------------------  SQRT -----------------------" << std::endl;
-		//			static_assert(nbits >= 16, "fast_sqrt requires posit configurations nbits >= 16");
-		posit<nbits, es> fr = v.fraction_value()*0.5;
-		int e = v.scale() + 1;
-		posit<nbits, es> y = posit<nbits, es>(0.41731f) + posit<nbits, es>(0.59016f) * fr;
-		posit<nbits, es> z = y + fr / y;
-		if (_trace_sqrt) {
-			std::cout << "f          " << v << std::endl;
-			std::cout << "e          " << e << std::endl;
-			std::cout << "fr         " << fr << std::endl;
-			std::cout << "y0         " << y << std::endl;
-			std::cout << "y1         " << z << std::endl;
-		}
-		y = posit<nbits, es>(0.25f) * z + fr / z;
-		if (_trace_sqrt) std::cout << "y2         " << y << std::endl;
+	namespace internal {
+
+		// decode a positive posit of at most 64 bits into its scale and its fraction bits, msb aligned in a 64-bit word
+		template<size_t nbits, size_t es>
+		inline int decode_positive_posit(uint64_t bits, uint64_t& fraction) {
+			uint64_t w = bits << (65 - nbits);  // the regime starts at the msb
+			bool positiveRegime = (w >> 63) != 0;
+			int run = (positiveRegime ? std::countl_one(w) : std::countl_zero(w));
+			int k = (positiveRegime ? run - 1 : -run);
+			w = (run < 63 ? w << (run + 1) : 0);
+			int e = 0;
+			if constexpr (es > 0) {
+				e = int(w >> (64 - es));
+				w <<= es;
+			}
+			fraction = w;
+			return k * (1 << es) + e;
+		}
 
-		if (e % 2) {
-			y *= posit<nbits, es>(0.707106781186547524400844362104);
-			if (_trace_sqrt) std::cout << "y*sqrt0.5  " << y << std::endl;
-			y = (y < posit<nbits, es>(0.5f) ? posit<nbits, es>(0.5f) : y);
-			e += 1;
+		// encode a positive posit of at most 64 bits from a scale, the fraction bits msb aligned in a 64-bit word,
+		// and a sticky bit that represents all the bits below the fraction word
+		template<size_t nbits, size_t es>
+		inline uint64_t encode_positive_posit(int scale, uint64_t fraction, bool sticky) {
+			constexpr int maxk = int(nbits) - 2;
+			int k = scale >> es;  // floor(scale / 2^es)
+			if (k >= maxk) return (uint64_t(1) << (nbits - 1)) - 1;  // maxpos
+			if (k < -maxk) return 1;                                 // minpos
+			// collect the nbits - 1 encoding bits followed by the guard bit; everything below goes to sticky
+			constexpr int window = int(nbits);
+			uint64_t bits{ 0 };
+			int used{ 0 };
+			auto append = [&](uint64_t field, int length) {
+				int take = std::min(window - used, length);
+				if (take > 0) {
+					bits = (take == 64 ? field : (bits << take) | (field >> (length - take)));
+					used += take;
+				}
+				int rest = length - take;
+				if (rest > 0) sticky = sticky || (rest >= 64 ? field != 0 : (field & ((uint64_t(1) << rest) - 1)) != 0);
+			};
+			if (k >= 0) append(((uint64_t(1) << (k + 1)) - 1) << 1, k + 2); else append(1, 1 - k);
+			if constexpr (es > 0) append(uint64_t(scale - k * (1 << es)), int(es));
+			append(fraction, 64);
+			uint64_t magnitude = bits >> 1;
+			bool guard = (bits & 1) != 0;
+			if (guard && (sticky || (magnitude & 1))) ++magnitude;
+			return magnitude;
 		}
-		else {
-			posit<nbits, es> one(1.0f), onemme;
-			onemme = --one;
-			y = (y < one ? y : onemme);
+
+		// the significand of a positive posit of at most 64 bits as X = x * 2^62 with x in [1, 4), and the even scale
+		template<size_t nbits, size_t es>
+		inline uint64_t posit_significand(const posit<nbits, es>& a, int& scale) {
+			uint64_t fraction;
+			scale = decode_positive_posit<nbits, es>(uint64_t(a.encoding()), fraction);
+			if (scale & 1) {
+				--scale;
+				return (uint64_t(1) << 63) | (fraction >> 1);
+			}
+			return (uint64_t(1) << 62) | (fraction >> 2);
 		}
-		if (_trace_sqrt) std::cout << "y adjusted " << y << std::endl;
 
-		internal::value<fbits> vsqrt = y.to_value();
-		vsqrt.setExponent((e >> 1) - 1);
-		if (_trace_sqrt) std::cout << "vsqrt      " << vsqrt << std::endl;
-		return vsqrt;
-	}
+	}  // namespace internal
 
-#if POSIT_NATIVE_SQRT
-	// sqrt for arbitrary posit
+	// correctly rounded sqrt: an integer square root on the significand for posits up to 64 bits,
+	// an evaluation in the extended precision type otherwise
 	template<size_t nbits, size_t es>
 	inline posit<nbits, es> sqrt(const posit<nbits, es>& a) {
 		posit<nbits, es> p;
@@ -169,29 +166,43 @@ namespace sw::universal {
 			p.setnar();
 			return p;
 		}
-
-		// for small posits use a more precise posit to do the calculation while keeping the es config the same
-		constexpr size_t anbits = nbits > 33 ? nbits : 33;
-		constexpr size_t fbits = posit<anbits, es>::fbits;
-		value<fbits> v;
-		a.normalize_to(v);
-		value<fbits> vsqrt = fast_sqrt<anbits, es, fbits>(v);
-		convert(vsqrt, p);
-
-		return p;
-	}
-#else
-	template<size_t nbits, size_t es>
-	inline posit<nbits, es> sqrt(const posit<nbits, es>& a) {
-		return posit<nbits, es>(std::sqrt((double)a));
+		if (a.iszero()) return a;
+		if constexpr (nbits <= 64) {
+			int scale;
+			uint64_t X = internal::posit_significand(a, scale);
+			bool inexact;
+			uint64_t root = internal::significand_sqrt(X, inexact);
+			p.setbits(internal::encode_positive_posit<nbits, es>(scale / 2, root << 1, inexact));
+			return p;
+		}
+		else {
+			return internal::posit_evaluate_extended(a, [](const auto& v) { using std::sqrt; return sqrt(v); });
+		}
 	}
-#endif
 
-	// reciprocal sqrt
+	// correctly rounded reciprocal sqrt, for normalization kernels that scale by 1/sqrt(x)
 	template<size_t nbits, size_t es>
 	inline posit<nbits, es> rsqrt(const posit<nbits, es>& a) {
-		posit<nbits, es> v = sqrt(a);
-		return v.reciprocate();
+		posit<nbits, es> p;
+		if (a.isneg() || a.isnar() || a.iszero()) {
+			p.setnar();
+			return p;
+		}
+		if constexpr (nbits <= 64) {
+			int scale;
+			uint64_t X = internal::posit_significand(a, scale);
+			if (X == (uint64_t(1) << 62)) {  // an even power of two has an exact reciprocal root
+				p.setbits(internal::encode_positive_posit<nbits, es>(-scale / 2, 0, false));
+				return p;
+			}
+			bool inexact;
+			uint64_t q = internal::significand_rsqrt(X, inexact);  // 1/sqrt(x) in (1/2, 1)
+			p.setbits(internal::encode_positive_posit<nbits, es>(-scale / 2 - 1, q << 1, inexact));
+			return p;
+		}
+		else {
+			return internal::posit_evaluate_extended(a, [](const auto& v) { using std::sqrt; return 1.0 / sqrt(v); });
+		}
 	}
 
 	///////////////////////////////////////////////////////////////////
@@ -477,37 +488,4 @@ namespace sw::universal {
 
 #endif // POSIT_FAST_POSIT_32_2
 
-#if POSIT_FAST_POSIT_64_3
-
-	// fast sqrt for posit<64,3>
-	template<>
-	inline posit<64, 3> sqrt(const posit<64, 3>& a) {
-		throw "fast sqrt(posit<64,3>) not yet implemented";
-		return 0;
-	}
-
-#endif // POSIT_FAST_POSIT_64_3
-
-#if POSIT_FAST_POSIT_128_4
-
-	// fast sqrt for posit<128,4>
-	template<>
-	inline posit<128, 4> sqrt(const posit<128, 4>& a) {
-		throw "fast sqrt(posit<128,4>) not yet implemented";
-		return 0;
-	}
-
-#endif // POSIT_FAST_POSIT_128_4
-
-#if POSIT_FAST_POSIT_256_5
-
-	// fast sqrt for posit<256,5>
-	template<>
-	inline posit<256, 5> sqrt(const posit<256, 5>& a) {
-		throw "fast sqrt(posit<256,5>) not yet implemented";
-		return 0;
-	}
-
-#endif // POSIT_FAST_POSIT_256_5
-
 } // namespace sw::universal
@@ -5,11 +5,13 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/math/math_constants.hpp>  // for m_pi_2
+#include <universal/number/posit/math/extended_precision.hpp>
 
 namespace sw::universal {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The functions are evaluated in the extended precision type of the posit and rounded once,
+// see extended_precision.hpp. The argument reduction modulo pi/2 is carried out in that type,
+// widened by the integer bits of the argument, so large arguments keep their accuracy. Arguments outside of the domain yield NaR.
 
 // value representing an angle expressed in radians
 // One radian is equivalent to 180/PI degrees
@@ -17,65 +19,83 @@ namespace sw::universal {
 // sine of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> sin(posit<nbits,es> x) {
-	//std::cerr << "sw::universal::sin(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::sin(double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) { using std::sin; return sin(v); });
 }
 
 // cosine of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> cos(posit<nbits,es> x) {
-	//std::cerr << "sw::universal::cos(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::cos(double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) { using std::cos; return cos(v); });
 }
 
 // tangent of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> tan(posit<nbits,es> x) {
-	//std::cerr << "sw::universal::tan(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::tan(double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) { using std::tan; return tan(v); });
 }
 
-// cotangent of an angle of x radians
+// arc tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> atan(posit<nbits,es> x) {
-	//std::cerr << "sw::universal::atan(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::atan(double(x)));
+	return internal::posit_function(x, [](const auto& v) { using std::atan; return atan(v); });
 }
 		
 // Arc tangent with two parameters
 template<size_t nbits, size_t es>
 posit<nbits,es> atan2(posit<nbits,es> y, posit<nbits,es> x) {
-	return posit<nbits,es>(std::atan2(double(y),double(x)));
+	return internal::posit_evaluate_extended(y, x, [](const auto& a, const auto& b) { using std::atan2; return atan2(a, b); });
 }
 
-// cosecant of an angle of x radians
+// arc cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> acos(posit<nbits,es> x) {
-	return posit<nbits,es>(std::acos(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::acos;
+		return (v >= Real(-1.0) && v <= Real(1.0) ? acos(v) : internal::extended_nan<Real>());
+	});
 }
 
-// secant of an angle of x radians
+// arc sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> asin(posit<nbits,es> x) {
-	return posit<nbits,es>(std::asin(double(x)));
+	return internal::posit_function(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::asin;
+		return (v >= Real(-1.0) && v <= Real(1.0) ? asin(v) : internal::extended_nan<Real>());
+	});
 }
 
 // cotangent an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> cot(posit<nbits,es> x) {
-	return posit<nbits,es>(std::tan(sw::universal::m_pi_2-double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::tan;
+		Real t = tan(v);
+		return (t == Real(0.0) ? internal::extended_nan<Real>() : Real(1.0) / t);
+	});
 }
 
 // secant of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> sec(posit<nbits,es> x) {
-	return posit<nbits,es>(1.0/std::cos(double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::cos;
+		return Real(1.0) / cos(v);
+	});
 }
 
 // cosecant of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> csc(posit<nbits,es> x) {
-	return posit<nbits,es>(1.0/std::sin(double(x)));
+	return internal::posit_function<true>(x, [](const auto& v) {
+		using Real = std::decay_t<decltype(v)>;
+		using std::sin;
+		Real s = sin(v);
+		return (s == Real(0.0) ? internal::extended_nan<Real>() : Real(1.0) / s);
+	});
 }
 
 }  // namespace sw::universal
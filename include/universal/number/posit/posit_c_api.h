@@ -6,10 +6,13 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 // set up the correct C11 infrastructure
-#include <stdlib.h>
-#include <stdio.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
+#if !defined(__STDC_HOSTED__) || __STDC_HOSTED__
+#include <stdlib.h>
+#include <stdio.h>
+#endif
 
 // posit C types
 #include <universal/number/posit/positctypes.h>
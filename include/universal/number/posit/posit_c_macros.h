@@ -101,6 +101,55 @@ POSIT_BASE_OP1(POSIT_T, op11, sqrt)
 POSIT_BASE_OP1(POSIT_T, op11, log)
 POSIT_BASE_OP1(POSIT_T, op11, exp)
 
+// fused multiply-add: a * b + c with a single rounding
+POSIT_T POSIT_MKNAME(fma)(POSIT_T a, POSIT_T b, POSIT_T c) POSIT_IMPL({ return POSIT_API::fma(a, b, c); })
+
+// array functions cross the C boundary once per array, e.g. void posit32_add_array(posit32_t* z, const posit32_t* x, const posit32_t* y, size_t n)
+#define POSIT_ARRAY_OP(__op__) \
+    void POSIT_MKNAME(POSIT_GLUE(__op__, _array))(POSIT_T* z, const POSIT_T* x, const POSIT_T* y, size_t n) POSIT_IMPL({ \
+        POSIT_API::array21<POSIT_GLUE(op_, __op__)<POSIT_API::nbits, POSIT_API::es>>(z, x, y, n); \
+    })
+POSIT_ARRAY_OP(add)
+POSIT_ARRAY_OP(sub)
+POSIT_ARRAY_OP(mul)
+POSIT_ARRAY_OP(div)
+
+// y = a * x + y, a fused multiply-add that rounds every element once
+void POSIT_MKNAME(axpy)(size_t n, POSIT_T a, const POSIT_T* x, POSIT_T* y) POSIT_IMPL({ POSIT_API::axpy(n, a, x, y); })
+// dot product that rounds every product and every sum
+POSIT_T POSIT_MKNAME(dot)(size_t n, const POSIT_T* x, const POSIT_T* y) POSIT_IMPL({ return POSIT_API::dot(n, x, y); })
+// fused dot product: the products accumulate exactly in a quire and the result rounds once
+POSIT_T POSIT_MKNAME(fdp)(size_t n, const POSIT_T* x, const POSIT_T* y) POSIT_IMPL({ return POSIT_API::fdp(n, x, y); })
+// y = alpha * A * x + beta * y for a row-major m x n matrix A with leading dimension lda, each row is a fused dot product
+void POSIT_MKNAME(gemv)(size_t m, size_t n, POSIT_T alpha, const POSIT_T* A, size_t lda, const POSIT_T* x, POSIT_T beta, POSIT_T* y) POSIT_IMPL({
+    POSIT_API::gemv(m, n, alpha, A, lda, x, beta, y);
+})
+
+// conversions of arrays of native floating-point values
+void POSIT_MKNAME(from_float_array)(POSIT_T* out, const float* in, size_t n) POSIT_IMPL({ POSIT_API::from_array(out, in, n); })
+void POSIT_MKNAME(from_double_array)(POSIT_T* out, const double* in, size_t n) POSIT_IMPL({ POSIT_API::from_array(out, in, n); })
+void POSIT_MKNAME(to_float_array)(float* out, const POSIT_T* in, size_t n) POSIT_IMPL({ POSIT_API::to_array(out, in, n); })
+void POSIT_MKNAME(to_double_array)(double* out, const POSIT_T* in, size_t n) POSIT_IMPL({ POSIT_API::to_array(out, in, n); })
+
+// opaque quire handles for the standard posits up to 64 bits, e.g. quire32_handle_t quire32_create(void)
+#if POSIT_NBITS == 8 || POSIT_NBITS == 16 || POSIT_NBITS == 32 || POSIT_NBITS == 64
+#define QUIRE_MKNAME(name) POSIT_GLUE4(quire, POSIT_NBITS, _, name)
+#define QUIRE_HANDLE_T QUIRE_MKNAME(handle_t)
+QUIRE_HANDLE_T QUIRE_MKNAME(create)(void) POSIT_IMPL({ return POSIT_API::quire_create<QUIRE_MKNAME(handle_s)>(); })
+void QUIRE_MKNAME(destroy)(QUIRE_HANDLE_T q) POSIT_IMPL({ delete q; })
+void QUIRE_MKNAME(clear)(QUIRE_HANDLE_T q) POSIT_IMPL({ q->q.clear(); })
+// q += a * b without rounding
+void QUIRE_MKNAME(fma)(QUIRE_HANDLE_T q, POSIT_T a, POSIT_T b) POSIT_IMPL({ POSIT_API::quire_fma(q->q, a, b); })
+// q += x[0] * y[0] + ... + x[n-1] * y[n-1] without rounding
+void QUIRE_MKNAME(fma_array)(QUIRE_HANDLE_T q, size_t n, const POSIT_T* x, const POSIT_T* y) POSIT_IMPL({ POSIT_API::quire_fma_array(q->q, n, x, y); })
+void QUIRE_MKNAME(add)(QUIRE_HANDLE_T q, POSIT_T a) POSIT_IMPL({ POSIT_API::quire_add(q->q, a); })
+void QUIRE_MKNAME(sub)(QUIRE_HANDLE_T q, POSIT_T a) POSIT_IMPL({ POSIT_API::quire_sub(q->q, a); })
+// round the quire to the nearest posit, the quire keeps its value
+POSIT_T QUIRE_MKNAME(round)(QUIRE_HANDLE_T q) POSIT_IMPL({ return POSIT_API::quire_round(q->q); })
+#undef QUIRE_MKNAME
+#undef QUIRE_HANDLE_T
+#endif
+
 
 // cmp is special because the return type is int and we need to call a different
 // function in the POSIT_API class
@@ -168,6 +217,8 @@ POSIT_FUNCS(ui, unsigned int)
 #undef POSIT_OPS
 #undef POSIT_FUNCS
 #undef POSIT_BASE_OP
+#undef POSIT_BASE_OP1
+#undef POSIT_ARRAY_OP
 #undef POSIT_GLUE3
 #undef POSIT_GLUE4
 #undef POSIT_GLUE
@@ -15,7 +15,7 @@ namespace sw::universal {
 
 // posit types
 template<size_t nbits, size_t es> class posit;
-template<size_t nbits, size_t es> posit<nbits, es> abs(const posit<nbits, es>& p);
+template<size_t nbits, size_t es> constexpr posit<nbits, es> abs(const posit<nbits, es>& p);
 template<size_t nbits, size_t es> posit<nbits, es> sqrt(const posit<nbits, es>& p);
 template<size_t nbits, size_t es> constexpr posit<nbits, es>& minpos(posit<nbits, es>& p);
 template<size_t nbits, size_t es> constexpr posit<nbits, es>& maxpos(posit<nbits, es>& p);
@@ -1238,386 +1238,386 @@ private:
 
 	// posit - posit logic functions
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, const posit<nnbits, ees>& rhs);
 
 #if POSIT_ENABLE_LITERALS
 	// posit - literal logic functions
 
 	// posit - signed char
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, signed char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, signed char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, signed char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, signed char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, signed char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, signed char rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, signed char rhs);
 
 	// posit - char
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, char rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, char rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, char rhs);
 
 	// posit - short
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, short rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, short rhs);
 
 	// posit - unsigned short
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, unsigned short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, unsigned short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, unsigned short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, unsigned short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, unsigned short rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, unsigned short rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, unsigned short rhs);
 
 	// posit - int
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, int rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, int rhs);
 
 	// posit - unsigned int
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, unsigned int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, unsigned int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, unsigned int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, unsigned int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, unsigned int rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, unsigned int rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, unsigned int rhs);
 
 	// posit - long
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, long rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, long rhs);
 
 	// posit - unsigned long long
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, unsigned long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, unsigned long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, unsigned long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, unsigned long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, unsigned long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, unsigned long rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, unsigned long rhs);
 
 	// posit - long long
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, long long rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, long long rhs);
 
 	// posit - unsigned long long
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, unsigned long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, unsigned long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, unsigned long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, unsigned long long rhs);
 
 	// posit - float
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, float rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, float rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, float rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, float rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, float rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, float rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, float rhs);
 
 	// posit - double
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, double rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, double rhs);
 
 	// posit - long double
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator==(const posit<nnbits, ees>& lhs, long double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator!=(const posit<nnbits, ees>& lhs, long double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator< (const posit<nnbits, ees>& lhs, long double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator> (const posit<nnbits, ees>& lhs, long double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator<=(const posit<nnbits, ees>& lhs, long double rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(const posit<nnbits, ees>& lhs, long double rhs);
+	friend constexpr bool operator>=(const posit<nnbits, ees>& lhs, long double rhs);
 
 	// literal - posit logic functions
 
 	// signed char - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(signed char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(signed char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (signed char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (signed char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(signed char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(signed char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(signed char lhs, const posit<nnbits, ees>& rhs);
 
 	// char - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(char lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(char lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(char lhs, const posit<nnbits, ees>& rhs);
 
 	// short - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(short lhs, const posit<nnbits, ees>& rhs);
 
 	// unsigned short - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(unsigned short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(unsigned short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (unsigned short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (unsigned short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(unsigned short lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(unsigned short lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(unsigned short lhs, const posit<nnbits, ees>& rhs);
 
 	// int - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(int lhs, const posit<nnbits, ees>& rhs);
 
 	// unsigned int - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(unsigned int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(unsigned int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (unsigned int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (unsigned int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(unsigned int lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(unsigned int lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(unsigned int lhs, const posit<nnbits, ees>& rhs);
 
 	// long - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(long lhs, const posit<nnbits, ees>& rhs);
 
 	// unsigned long - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(unsigned long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(unsigned long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (unsigned long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (unsigned long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(unsigned long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(unsigned long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(unsigned long lhs, const posit<nnbits, ees>& rhs);
 
 	// long long - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(long long lhs, const posit<nnbits, ees>& rhs);
 
 	// unsigned long long - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(unsigned long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (unsigned long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (unsigned long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(unsigned long long lhs, const posit<nnbits, ees>& rhs);
 
 	// float - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(float lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(float lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (float lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (float lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(float lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(float lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(float lhs, const posit<nnbits, ees>& rhs);
 
 	// double - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(double lhs, const posit<nnbits, ees>& rhs);
 
 	// long double - posit
 	template<size_t nnbits, size_t ees>
-	friend bool operator==(long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator==(long double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator!=(long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator!=(long double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator< (long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator< (long double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator> (long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator> (long double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator<=(long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator<=(long double lhs, const posit<nnbits, ees>& rhs);
 	template<size_t nnbits, size_t ees>
-	friend bool operator>=(long double lhs, const posit<nnbits, ees>& rhs);
+	friend constexpr bool operator>=(long double lhs, const posit<nnbits, ees>& rhs);
 
 #endif // POSIT_ENABLE_LITERALS
 
@@ -1626,31 +1626,31 @@ private:
 ////////////////// convenience/shim functions
 
 template<size_t nbits, size_t es>
-inline bool isnar(const posit<nbits, es>& p) {
+constexpr bool isnar(const posit<nbits, es>& p) {
 	return p.isnar();
 }
 template<size_t nbits, size_t es>
-inline bool iszero(const posit<nbits, es>& p) {
+constexpr bool iszero(const posit<nbits, es>& p) {
 	return p.iszero();
 }
 template<size_t nbits, size_t es>
-inline bool ispos(const posit<nbits, es>& p) {
+constexpr bool ispos(const posit<nbits, es>& p) {
 	return p.ispos();
 }
 template<size_t nbits, size_t es>
-inline bool isneg(const posit<nbits, es>& p) {
+constexpr bool isneg(const posit<nbits, es>& p) {
 	return p.isneg();
 }
 template<size_t nbits, size_t es>
-inline bool isone(const posit<nbits, es>& p) {
+constexpr bool isone(const posit<nbits, es>& p) {
 	return p.isone();
 }		
 template<size_t nbits, size_t es>
-inline bool isminusone(const posit<nbits, es>& p) {
+constexpr bool isminusone(const posit<nbits, es>& p) {
 	return p.isminusone();
 }
 template<size_t nbits, size_t es>
-inline bool ispowerof2(const posit<nbits, es>& p) {
+constexpr bool ispowerof2(const posit<nbits, es>& p) {
 	return p.ispowerof2();
 }
 
@@ -1767,52 +1767,52 @@ inline std::string to_base2_scientific(const posit<nbits, es>& number) {
 // posit - posit binary logic operators
 
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return lhs._raw_bits == rhs._raw_bits;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return !operator==(lhs, rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(lhs._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return operator< (rhs, lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return operator< (lhs, rhs) || operator==(lhs, rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	return !operator< (lhs, rhs);
 }
 
 // posit - posit binary arithmetic operators
 // BINARY ADDITION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator+(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator+(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> sum = lhs;
 	return sum += rhs;
 }
 // BINARY SUBTRACTION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator-(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator-(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> diff = lhs;
 	return diff -= rhs;
 }
 // BINARY MULTIPLICATION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator*(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator*(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> mul = lhs;
 	return mul *= rhs;
 }
 // BINARY DIVISION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator/(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator/(const posit<nbits, es>& lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> ratio(lhs);
 	return ratio /= rhs;
 }
@@ -1821,683 +1821,683 @@ inline posit<nbits, es> operator/(const posit<nbits, es>& lhs, const posit<nbits
 
 // posit - signed char logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, signed char rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, signed char rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, signed char rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, signed char rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, signed char rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, signed char rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, signed char rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // signed char - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(signed char lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(signed char lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (signed char lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (signed char lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(signed char lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(signed char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(signed char lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - char logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, char rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, char rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, char rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, char rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, char rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, char rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, char rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // char - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(char lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(char lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (char lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (char lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(char lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(char lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(char lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - short logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, short rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, short rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, short rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, short rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, short rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, short rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, short rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // short - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(short lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(short lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (short lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (short lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(short lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(short lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - unsigned short logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, unsigned short rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, unsigned short rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, unsigned short rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, unsigned short rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, unsigned short rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, unsigned short rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, unsigned short rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // unsigned short - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(unsigned short lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(unsigned short lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (unsigned short lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (unsigned short lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(unsigned short lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(unsigned short lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(unsigned short lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - int logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, int rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, int rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, int rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, int rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, int rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, int rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, int rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // int - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(int lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(int lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (int lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (int lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(int lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(int lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - unsigned int logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, unsigned int rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, unsigned int rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, unsigned int rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, unsigned int rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, unsigned int rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, unsigned int rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, unsigned int rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // unsigned int - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(unsigned int lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(unsigned int lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (unsigned int lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (unsigned int lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(unsigned int lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(unsigned int lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(unsigned int lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - long logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, long rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, long rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, long rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, long rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, long rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, long rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, long rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // long - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(long lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(long lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (long lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (long lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(long lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(long lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - unsigned long logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, unsigned long rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, unsigned long rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, unsigned long rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, unsigned long rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, unsigned long rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, unsigned long rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, unsigned long rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // unsigned long - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(unsigned long lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(unsigned long lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (unsigned long lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (unsigned long lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(unsigned long lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(unsigned long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(unsigned long lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - unsigned long long logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, unsigned long long rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, unsigned long long rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // unsigned long long - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(unsigned long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(unsigned long long lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - long long logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, long long rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, long long rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, long long rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, long long rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, long long rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, long long rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, long long rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // long long - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(long long lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(long long lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (long long lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (long long lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(long long lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(long long lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(long long lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - float logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, float rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, float rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, float rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, float rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, float rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, float rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, float rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // float  - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(float lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(float lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (float lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (float lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(float lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(float lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(float lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - double logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, double rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, double rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, double rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, double rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, double rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, double rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, double rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // double  - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(double lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(double lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (double lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (double lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(double lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(double lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // posit - long double logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator==(const posit<nbits, es>& lhs, long double rhs) {
 	return lhs == posit<nbits, es>(rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator!=(const posit<nbits, es>& lhs, long double rhs) {
 	return !operator==(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator< (const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator< (const posit<nbits, es>& lhs, long double rhs) {
 	return twosComplementLessThan(lhs._raw_bits, posit<nbits, es>(rhs)._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator> (const posit<nbits, es>& lhs, long double rhs) {
 	return operator< (posit<nbits, es>(rhs), lhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator<=(const posit<nbits, es>& lhs, long double rhs) {
 	return !operator>(lhs, posit<nbits, es>(rhs));
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(const posit<nbits, es>& lhs, long double rhs) {
+constexpr bool operator>=(const posit<nbits, es>& lhs, long double rhs) {
 	return !operator<(lhs, posit<nbits, es>(rhs));
 }
 
 // long double  - posit logic operators
 template<size_t nbits, size_t es>
-inline bool operator==(long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator==(long double lhs, const posit<nbits, es>& rhs) {
 	return posit<nbits, es>(lhs) == rhs;
 }
 template<size_t nbits, size_t es>
-inline bool operator!=(long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator!=(long double lhs, const posit<nbits, es>& rhs) {
 	return !operator==(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator< (long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator< (long double lhs, const posit<nbits, es>& rhs) {
 	return twosComplementLessThan(posit<nbits, es>(lhs)._raw_bits, rhs._raw_bits);
 }
 template<size_t nbits, size_t es>
-inline bool operator> (long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator> (long double lhs, const posit<nbits, es>& rhs) {
 	return operator< (posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator<=(long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator<=(long double lhs, const posit<nbits, es>& rhs) {
 	return !operator>(posit<nbits, es>(lhs), rhs);
 }
 template<size_t nbits, size_t es>
-inline bool operator>=(long double lhs, const posit<nbits, es>& rhs) {
+constexpr bool operator>=(long double lhs, const posit<nbits, es>& rhs) {
 	return !operator<(posit<nbits, es>(lhs), rhs);
 }
 
 // BINARY ADDITION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator+(const posit<nbits, es>& lhs, double rhs) {
+constexpr posit<nbits, es> operator+(const posit<nbits, es>& lhs, double rhs) {
 	posit<nbits, es> sum = lhs;
 	sum += posit<nbits, es>(rhs);
 	return sum;
@@ -2513,14 +2513,14 @@ using enable_intrinsic_numerical = std::enable_if_t<is_intrinsic_numerical<T>, U
 
 // More generic alternative to avoid ambiguities with intrinsic +
 template<size_t nbits, size_t es, typename Value, typename = enable_intrinsic_numerical<Value> >
-inline posit<nbits, es> operator+(const posit<nbits, es>& lhs, Value rhs) {
+constexpr posit<nbits, es> operator+(const posit<nbits, es>& lhs, Value rhs) {
 	posit<nbits, es> sum = lhs;
 	sum += posit<nbits, es>(rhs);
 	return sum;
 }
 
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator+(double lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator+(double lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> sum(lhs);
 	sum += rhs;
 	return sum;
@@ -2528,7 +2528,7 @@ inline posit<nbits, es> operator+(double lhs, const posit<nbits, es>& rhs) {
 
 // BINARY SUBTRACTION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator-(double lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator-(double lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> diff(lhs);
 	diff -= rhs;
 	return diff;
@@ -2536,35 +2536,35 @@ inline posit<nbits, es> operator-(double lhs, const posit<nbits, es>& rhs) {
 
 // More generic alternative to avoid ambiguities with intrinsic +
 template<size_t nbits, size_t es, typename Value, typename = enable_intrinsic_numerical<Value> >
-inline posit<nbits, es> operator-(const posit<nbits, es>& lhs, Value rhs) {
+constexpr posit<nbits, es> operator-(const posit<nbits, es>& lhs, Value rhs) {
 	posit<nbits, es> diff = lhs;
 	diff -= posit<nbits, es>(rhs);
 	return diff;
 }
 
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator-(const posit<nbits, es>& lhs, double rhs) {
+constexpr posit<nbits, es> operator-(const posit<nbits, es>& lhs, double rhs) {
 	posit<nbits, es> diff(lhs);
 	diff -= posit<nbits, es>(rhs);
 	return diff;
 }
 // BINARY MULTIPLICATION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator*(double lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator*(double lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> mul(lhs);
 	mul *= rhs;
 	return mul;
 }
 
 template<size_t nbits, size_t es, typename Value, typename = enable_intrinsic_numerical<Value> >
-inline posit<nbits, es> operator*(Value lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator*(Value lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> mul(lhs);
 	mul *= rhs;
 	return mul;
 }
     
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator*(const posit<nbits, es>& lhs, double rhs) {
+constexpr posit<nbits, es> operator*(const posit<nbits, es>& lhs, double rhs) {
 	posit<nbits, es> mul(lhs);
 	mul *= posit<nbits, es>(rhs);
 	return mul;
@@ -2572,28 +2572,28 @@ inline posit<nbits, es> operator*(const posit<nbits, es>& lhs, double rhs) {
 
 // BINARY DIVISION
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator/(double lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator/(double lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> ratio(lhs);
 	ratio /= rhs;
 	return ratio;
 }
 
 template<size_t nbits, size_t es, typename Value, typename = enable_intrinsic_numerical<Value> >
-inline posit<nbits, es> operator/(Value lhs, const posit<nbits, es>& rhs) {
+constexpr posit<nbits, es> operator/(Value lhs, const posit<nbits, es>& rhs) {
 	posit<nbits, es> ratio(lhs);
 	ratio /= rhs;
 	return ratio;
 }
 
 template<size_t nbits, size_t es>
-inline posit<nbits, es> operator/(const posit<nbits, es>& lhs, double rhs) {
+constexpr posit<nbits, es> operator/(const posit<nbits, es>& lhs, double rhs) {
 	posit<nbits, es> ratio(lhs);
 	ratio /= posit<nbits, es>(rhs);
 	return ratio;
 }
 
 template<size_t nbits, size_t es, typename Value, typename = enable_intrinsic_numerical<Value> >
-inline posit<nbits, es> operator/(const posit<nbits, es>& lhs, Value rhs) {
+constexpr posit<nbits, es> operator/(const posit<nbits, es>& lhs, Value rhs) {
 	posit<nbits, es> ratio(lhs);
 	ratio /= posit<nbits, es>(rhs);
 	return ratio;
@@ -2603,11 +2603,11 @@ inline posit<nbits, es> operator/(const posit<nbits, es>& lhs, Value rhs) {
 
 // Magnitude of a posit (equivalent to turning the sign bit off).
 template<size_t nbits, size_t es> 
-posit<nbits, es> abs(const posit<nbits, es>& p) {
+constexpr posit<nbits, es> abs(const posit<nbits, es>& p) {
 	return p.abs();
 }
 template<size_t nbits, size_t es>
-posit<nbits, es> fabs(const posit<nbits, es>& p) {
+constexpr posit<nbits, es> fabs(const posit<nbits, es>& p) {
 	return p.abs();
 }
 template<typename Scalar>
@@ -2617,18 +2617,34 @@ Scalar fabs(Scalar s) {
 
 // Atomic fused operators
 
-// FMA: fused multiply-add:  a*b + c
+// the value of a non-zero, non-NaR posit with its fraction right-extended to tgtbits
+template<size_t tgtbits, size_t nbits, size_t es>
+internal::value<tgtbits> right_extended(const posit<nbits, es>& p) {
+	constexpr size_t fbits = nbits - 3 - es;
+	internal::value<tgtbits> v;
+	if constexpr (fbits == 0) {
+		v.set(sign(p), scale(p), bitblock<tgtbits>(), false, false);  // no fraction bits to extend
+	}
+	else {
+		internal::value<fbits> ptmp;
+		ptmp.set(sign(p), scale(p), extract_fraction<nbits, es, fbits>(p), false, false);
+		v.template right_extend<fbits, tgtbits>(ptmp);
+	}
+	return v;
+}
+
+// FMA: fused multiply-add:  a*b + c without rounding
+// The product is exact in mbits, and the adder keeps the bits that are aligned away from the
+// smaller operand as a sticky bit, so that rounding the sum yields the posit closest to a*b + c.
+// This is the value<> that fma() returned before it rounded into a posit.
 template<size_t nbits, size_t es>
-internal::value<1 + 2 * (nbits - es)> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+internal::value<1 + 2 * (nbits - es)> fma_value(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
 	constexpr size_t fbits = nbits - 3 - es;
 	constexpr size_t fhbits = fbits + 1;      // size of fraction + hidden bit
 	constexpr size_t mbits = 2 * fhbits;      // size of the multiplier output
 	constexpr size_t abits = mbits + 4;       // size of the addend
 
-	internal::value<mbits> product;
 	internal::value<abits + 1> sum;
-	internal::value<fbits> va, vb, ctmp;
-
 	// special case handling of input arguments
 	if (a.isnar() || b.isnar() || c.isnar()) {
 		sum.setnan();
@@ -2636,36 +2652,51 @@ internal::value<1 + 2 * (nbits - es)> fma(const posit<nbits, es>& a, const posit
 	}
 
 	if (a.iszero() || b.iszero()) {  // product will only become non-zero if neither a and b are zero
-		if (c.iszero()) {
-			sum.setzero();
-		}
-		else {
-			ctmp.set(sign(c), scale(c), extract_fraction<nbits, es, fbits>(c), c.iszero(), c.isnar());
-			sum.template right_extend<fbits, abits + 1>(ctmp); // right-extend the c input argument and assign to sum
-		}
+		if (!c.iszero()) sum = right_extended<abits + 1>(c);
+		return sum;
 	}
-	else { // else clause guarantees that the product is non-zero	
-		// first, the multiply: transform the inputs into (sign,scale,fraction) triples
-		va.set(sign(a), scale(a), extract_fraction<nbits, es, fbits>(a), a.iszero(), a.isnar());;
-		vb.set(sign(b), scale(b), extract_fraction<nbits, es, fbits>(b), b.iszero(), b.isnar());;
 
-		module_multiply(va, vb, product);    // multiply the two inputs
+	// first, the multiply: transform the inputs into (sign,scale,fraction) triples
+	internal::value<fbits> va, vb;
+	internal::value<mbits> product;
+	va.set(sign(a), scale(a), extract_fraction<nbits, es, fbits>(a), a.iszero(), a.isnar());
+	vb.set(sign(b), scale(b), extract_fraction<nbits, es, fbits>(b), b.iszero(), b.isnar());
+	module_multiply(va, vb, product);    // multiply the two inputs
 
-		// second, the add : at this point we are guaranteed that product is non-zero and non-nar
-		if (c.iszero()) {				
-			sum.template right_extend<mbits, abits + 1>(product);   // right-extend the product and assign to sum
-		}
-		else {
-			ctmp.set(sign(c), scale(c), extract_fraction<nbits, es, fbits>(c), c.iszero(), c.isnar());
-			internal::value<mbits> vc;
-			vc.template right_extend<fbits, mbits>(ctmp); // right-extend the c argument and assign to adder input
-			module_add<mbits, abits>(product, vc, sum);
-		}
+	// second, the add: at this point we are guaranteed that product is non-zero and non-nar
+	if (c.iszero()) {
+		sum.template right_extend<mbits, abits + 1>(product);   // right-extend the product and assign to sum
+		return sum;
 	}
-
+	internal::value<mbits> vc = right_extended<mbits>(c);  // the adder input
+	module_add<mbits, abits>(product, vc, sum);
 	return sum;
 }
 
+// FMA: fused multiply-add:  a*b + c with a single rounding
+// Returns the posit closest to a*b + c. Before the single rounding was introduced, fma() returned
+// the unrounded value<> and left the rounding to the assignment; fma_value() keeps that interface.
+template<size_t nbits, size_t es>
+posit<nbits, es> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+	posit<nbits, es> result;
+	// special case handling of input arguments
+#if POSIT_THROW_ARITHMETIC_EXCEPTION
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		throw operand_is_nar{};
+	}
+#else
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		result.setnar();
+		return result;
+	}
+#endif // POSIT_THROW_ARITHMETIC_EXCEPTION
+
+	if (a.iszero() || b.iszero()) return c;  // product will only become non-zero if neither a and b are zero
+
+	convert(fma_value(a, b, c), result);    // one and only rounding step
+	return result;
+}
+
 // FAM: fused add-multiply: (a + b) * c
 template<size_t nbits, size_t es>
 internal::value<2 * (nbits - 2 - es)> fam(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
@@ -1,10 +1,13 @@
 #pragma once
 // positctypes.h: generic C header defining the posit types
 
-#include <stdlib.h>
-#include <stdio.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
+#if !defined(__STDC_HOSTED__) || __STDC_HOSTED__
+#include <stdlib.h>
+#include <stdio.h>
+#endif
 
 #ifdef __cplusplus
 // export a C interface if used by C++ source code
@@ -91,6 +94,12 @@ extern "C" {
 	///	quire<256, 5, 7>   32520 bits		<--- 4065 bytes: smallest size aligned to 4byte boundary
 	///	quire<256, 5, 255> 32768 bits       <--- 4096 bytes
 
+	// opaque handles to the quires of the C API library, which owns their storage
+	typedef struct quire8_handle_s*  quire8_handle_t;	// quire<8,0,30>
+	typedef struct quire16_handle_s* quire16_handle_t;	// quire<16,1,30>
+	typedef struct quire32_handle_s* quire32_handle_t;	// quire<32,2,30>
+	typedef struct quire64_handle_s* quire64_handle_t;	// quire<64,3,30>
+
 	//////////////////////////////////////////////////////////////////////
 	/// special posits
 
@@ -0,0 +1,213 @@
+#pragma once
+// constexpr_conversion.hpp: constexpr conversions between native floating-point types and posit encodings
+//
+// The fast posit specializations use these functions to convert to and from native
+// floating-point types in constant expressions. The decomposition of the native value
+// uses exact scaling by powers of two instead of reinterpreting the IEEE-754 bits,
+// so that no compiler support for std::bit_cast is required.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <limits>
+
+namespace sw::universal {
+
+// decompose a finite, non-zero native floating-point value into sign, binary scale, and
+// the 63 leading fraction bits below the hidden bit. Any fraction bits beyond those are
+// summarized in the sticky bit.
+template<typename Real>
+constexpr void native_decompose(Real v, bool& sign, int& scale, uint64_t& fraction, bool& sticky) {
+	constexpr Real two64 = Real(18446744073709551616.0);  // 2^64
+	constexpr Real two63 = Real(9223372036854775808.0);   // 2^63
+	constexpr Real two8 = Real(256.0);
+	sign = v < Real(0);
+	if (sign) v = -v;
+	scale = 0;
+	// normalize to [1, 2): multiplications by powers of two are exact, including for subnormals
+	while (v >= two64) { v /= two64; scale += 64; }
+	while (v >= two8)  { v /= two8;  scale += 8; }
+	while (v >= Real(2)) { v /= Real(2); ++scale; }
+	while (v < Real(1) / two64) { v *= two64; scale -= 64; }
+	while (v < Real(1) / two8)  { v *= two8;  scale -= 8; }
+	while (v < Real(1)) { v *= Real(2); --scale; }
+	Real f = (v - Real(1)) * two63;  // exact: v - 1 has at most digits-1 significant bits
+	fraction = uint64_t(f);
+	sticky = (f - Real(fraction)) != Real(0);
+}
+
+// truncate a value given as scale, 63 fraction bits, and sticky to the magnitude bits of a
+// posit<nbits, es> encoding. The regime k = floor(scale / 2^es) must be in [-(nbits-2), nbits-3]
+// so that the regime fits. The guard bit and the sticky bit of the discarded bits are returned.
+template<size_t nbits, size_t es>
+constexpr uint64_t posit_truncate(int scale, uint64_t fraction, bool& guard, bool& sticky) {
+	constexpr int N = int(nbits) - 1;  // number of magnitude bits
+	int k = (scale >= 0 ? scale >> es : -((-scale + (1 << es) - 1) >> es)); // floor(scale / 2^es)
+	uint64_t e = uint64_t(scale - k * (1 << es));
+	int rlen = (k >= 0 ? k + 2 : -k + 1);
+	uint64_t regime = (k >= 0 ? ((uint64_t(1) << (k + 1)) - 1) << 1 : uint64_t(1));
+	int avail = N - rlen;     // bits available for exponent and fraction
+	uint64_t bits = regime << avail;
+	if (avail >= int(es)) {
+		int fk = avail - int(es);  // number of fraction bits that fit
+		bits |= e << fk;
+		if (fk > 0) bits |= fraction >> (63 - fk);
+		guard = (fraction >> (62 - fk)) & 1;
+		sticky = sticky || (fraction & ((uint64_t(1) << (62 - fk)) - 1)) != 0;
+	}
+	else {
+		int drop = int(es) - avail;  // exponent bits that do not fit
+		bits |= e >> drop;
+		guard = (e >> (drop - 1)) & 1;
+		sticky = sticky || (e & ((uint64_t(1) << (drop - 1)) - 1)) != 0 || fraction != 0;
+	}
+	return bits;
+}
+
+// round a value given as sign, scale, and 63 fraction bits plus sticky to the nearest
+// posit<nbits, es> encoding: round to nearest, ties to even on the encoding, with
+// saturation to minpos/maxpos since posits do not underflow to zero or overflow to NaR
+template<size_t nbits, size_t es>
+constexpr uint64_t posit_encode(bool sign, int scale, uint64_t fraction, bool sticky) {
+	static_assert(nbits >= 3 && nbits <= 64, "posit_encode supports posits from 3 to 64 bits");
+	constexpr int N = int(nbits) - 1;  // number of magnitude bits
+	constexpr uint64_t magnitudeMask = (uint64_t(1) << N) - 1;
+	constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+	int k = (scale >= 0 ? scale >> es : -((-scale + (1 << es) - 1) >> es)); // floor(scale / 2^es)
+	uint64_t bits{ 0 };
+	if (k >= N - 1) {
+		bits = magnitudeMask;     // maxpos
+	}
+	else if (k < -(N - 1)) {
+		bits = 1;                 // minpos
+	}
+	else {
+		bool guard{ false };
+		bits = posit_truncate<nbits, es>(scale, fraction, guard, sticky);
+		if (guard && (sticky || (bits & 1))) ++bits;
+		if (bits > magnitudeMask) bits = magnitudeMask;
+	}
+	return sign ? ((~bits + 1) & encodingMask) : bits;
+}
+
+// round a value given as sign, scale, and 63 fraction bits plus sticky to the posit<nbits, es>
+// encoding in the direction of +inf when up is set, and of -inf otherwise. Unlike posit_encode,
+// the directed rounding does not saturate: values beyond maxpos round away from zero to NaR,
+// which stands for infinity, and values below minpos round toward zero to 0. exact is set when
+// the encoding represents the value without rounding.
+template<size_t nbits, size_t es>
+constexpr uint64_t posit_encode_directed(bool sign, int scale, uint64_t fraction, bool sticky, bool up, bool& exact) {
+	static_assert(nbits >= 3 && nbits <= 64, "posit_encode_directed supports posits from 3 to 64 bits");
+	constexpr int N = int(nbits) - 1;
+	constexpr uint64_t magnitudeMask = (uint64_t(1) << N) - 1;
+	constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+	constexpr uint64_t nar = uint64_t(1) << (nbits - 1);
+	constexpr int maxScale = (N - 1) * (1 << es);  // scale of maxpos
+	bool away = (up != sign);  // round the magnitude away from zero
+	uint64_t bits{ 0 };
+	exact = false;
+	if (scale > maxScale || (scale == maxScale && (fraction != 0 || sticky))) {
+		if (away) return nar;
+		bits = magnitudeMask;
+	}
+	else if (scale == maxScale) {
+		exact = true;
+		bits = magnitudeMask;
+	}
+	else if (scale < -maxScale) {
+		if (!away) return 0;
+		bits = 1;
+	}
+	else {
+		bool guard{ false };
+		bits = posit_truncate<nbits, es>(scale, fraction, guard, sticky);
+		exact = !guard && !sticky;
+		if (!exact && away) ++bits;
+	}
+	return sign ? ((~bits + 1) & encodingMask) : bits;
+}
+
+// decompose a posit<nbits, es> encoding that is neither zero nor NaR into sign, binary scale,
+// and the fraction bits below the hidden bit, left-aligned in the 63-bit fraction field
+template<size_t nbits, size_t es>
+constexpr void posit_decode(uint64_t bits, bool& sign, int& scale, uint64_t& fraction) {
+	static_assert(nbits >= 3 && nbits <= 64, "posit_decode supports posits from 3 to 64 bits");
+	constexpr int N = int(nbits) - 1;
+	constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+	constexpr uint64_t signMask = uint64_t(1) << (nbits - 1);
+	bits &= encodingMask;
+	sign = (bits & signMask) != 0;
+	if (sign) bits = (~bits + 1) & encodingMask;
+	int pos = N - 1;
+	bool r = (bits >> pos) & 1;
+	int run = 0;
+	while (pos >= 0 && bool((bits >> pos) & 1) == r) { ++run; --pos; }
+	int k = (r ? run - 1 : -run);
+	--pos;  // skip the regime terminating bit
+	int e = 0;
+	for (size_t i = 0; i < es; ++i) {
+		e <<= 1;
+		if (pos >= 0) {
+			e |= int((bits >> pos) & 1);
+			--pos;
+		}
+	}
+	int fbits = pos + 1;
+	fraction = (fbits > 0 ? (bits & ((uint64_t(1) << fbits) - 1)) << (63 - fbits) : 0);
+	scale = k * (1 << es) + e;
+}
+
+// convert a native floating-point value to a posit<nbits, es> encoding; NaN and infinities map to NaR
+template<size_t nbits, size_t es, typename Real>
+constexpr uint64_t native_to_posit(Real v) {
+	constexpr uint64_t nar = uint64_t(1) << (nbits - 1);
+	if (v != v) return nar;
+	if (v == Real(0)) return 0;
+	if (v > std::numeric_limits<Real>::max() || v < -std::numeric_limits<Real>::max()) return nar;
+	bool sign{ false }, sticky{ false };
+	int scale{ 0 };
+	uint64_t fraction{ 0 };
+	native_decompose(v, sign, scale, fraction, sticky);
+	return posit_encode<nbits, es>(sign, scale, fraction, sticky);
+}
+
+// convert a posit<nbits, es> encoding to a native floating-point value; NaR maps to a quiet NaN
+template<size_t nbits, size_t es, typename Real>
+constexpr Real posit_to_native(uint64_t bits) {
+	constexpr int N = int(nbits) - 1;
+	constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+	constexpr uint64_t nar = uint64_t(1) << (nbits - 1);
+	bits &= encodingMask;
+	if (bits == 0) return Real(0);
+	if (bits == nar) return std::numeric_limits<Real>::quiet_NaN();
+	bool sign = (bits & nar) != 0;
+	if (sign) bits = (~bits + 1) & encodingMask;
+	// regime run length
+	int pos = N - 1;
+	bool r = (bits >> pos) & 1;
+	int run = 0;
+	while (pos >= 0 && bool((bits >> pos) & 1) == r) { ++run; --pos; }
+	int k = (r ? run - 1 : -run);
+	--pos;  // skip the regime terminating bit
+	// exponent bits that are cut off by the regime are zero
+	int e = 0;
+	for (size_t i = 0; i < es; ++i) {
+		e <<= 1;
+		if (pos >= 0) {
+			e |= int((bits >> pos) & 1);
+			--pos;
+		}
+	}
+	int fbits = pos + 1;
+	Real v = Real(1);
+	if (fbits > 0) v += Real(bits & ((uint64_t(1) << fbits) - 1)) / Real(uint64_t(1) << fbits);
+	int scale = k * (1 << es) + e;
+	while (scale >= 32) { v *= Real(4294967296.0); scale -= 32; }
+	while (scale > 0) { v *= Real(2); --scale; }
+	while (scale <= -32) { v /= Real(4294967296.0); scale += 32; }
+	while (scale < 0) { v /= Real(2); ++scale; }
+	return sign ? -v : v;
+}
+
+}  // namespace sw::universal
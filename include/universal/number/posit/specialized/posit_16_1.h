@@ -0,0 +1,332 @@
+#pragma once
+// posit_16_1.h: standard 16-bit posit C implementation with integer-only kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include <universal/number/posit/positctypes.h>
+
+/*
+   The kernels decode a positive encoding into a scale and a significand in 1.15 format, compute
+   the exact result, or its truncation plus a sticky bit, in 32-bit integer arithmetic, and round
+   once in posit16_encode. They only use integer operations and a count of leading zeros, so the
+   file compiles freestanding. Every result is the correctly rounded posit<16,1> of the exact
+   value, which is the result of the fast C++ specialization.
+ */
+
+static const uint16_t posit16_sign_mask = 0x8000u;
+static const uint16_t posit16_nar_bits  = 0x8000u;
+static const uint16_t posit16_maxpos_bits = 0x7FFFu;
+static const int32_t  posit16_max_scale = 28;   // maxpos = 2^28
+
+// count leading zeros of a nonzero word
+#if defined(__GNUC__) || defined(__clang__)
+static inline int posit16_clz32(uint32_t x) { return __builtin_clz(x); }
+static inline int posit16_clz64(uint64_t x) { return __builtin_clzll(x); }
+#else
+static inline int posit16_clz32(uint32_t x) {
+	int n = 0;
+	if (!(x >> 16)) { n += 16; x <<= 16; }
+	if (!(x >> 24)) { n += 8;  x <<= 8; }
+	if (!(x >> 28)) { n += 4;  x <<= 4; }
+	if (!(x >> 30)) { n += 2;  x <<= 2; }
+	if (!(x >> 31)) { n += 1; }
+	return n;
+}
+static inline int posit16_clz64(uint64_t x) {
+	return (x >> 32) ? posit16_clz32((uint32_t)(x >> 32)) : 32 + posit16_clz32((uint32_t)x);
+}
+#endif
+
+static inline posit16_t posit16_make(uint16_t bits) { posit16_t p; p.v = bits; return p; }
+
+// decode a positive encoding into its scale and its significand in 1.15 format
+static inline int32_t posit16_decode(uint16_t bits, uint32_t* significand) {
+	uint32_t body = (uint32_t)bits << 17;  // drop the sign bit and align at the top of the word
+	int run;
+	int32_t k;
+	if (body & 0x80000000u) {  // positive regimes: a run of ones
+		run = posit16_clz32(~body);
+		k = run - 1;
+	}
+	else {                     // negative regimes: a run of zeros
+		run = posit16_clz32(body);
+		k = -run;
+	}
+	uint32_t rest = body << (run + 1);  // exponent and fraction bits
+	*significand = 0x8000u | ((rest & 0x7FFFFFFFu) >> 16);
+	return 2 * k + (int32_t)(rest >> 31);
+}
+
+// round 2^scale * significand, with the significand in 1.31 format, to a positive encoding.
+// sticky marks nonzero bits below the significand. Posits saturate at maxpos and minpos.
+static inline uint16_t posit16_encode(int32_t scale, uint32_t significand, bool sticky) {
+	if (scale >= posit16_max_scale) return posit16_maxpos_bits;
+	if (scale < -posit16_max_scale) return 0x1u;
+	int32_t k = (scale >= 0) ? scale / 2 : -((1 - scale) / 2);
+	uint32_t exponent = (uint32_t)(scale - 2 * k);
+	uint32_t regime;
+	int len;  // the number of regime bits including the terminating bit
+	if (k >= 0) {
+		len = k + 2;
+		regime = ((1u << (k + 1)) - 1) << 1;
+	}
+	else {
+		len = 1 - k;
+		regime = 1;
+	}
+	// the 15 bits below the sign bit of the posit occupy bits 30..16 of the window
+	uint32_t fraction = significand << 1;  // drop the hidden bit
+	uint32_t window = (regime << (31 - len)) | (exponent << (30 - len)) | (fraction >> (len + 2));
+	sticky = sticky || (fraction & ((1u << (len + 2)) - 1)) != 0 || (window & 0x7FFFu) != 0;
+	uint16_t bits = (uint16_t)(window >> 16);
+	bool guard = (window >> 15) & 1;
+	if (guard && (sticky || (bits & 1))) ++bits;
+	return bits;
+}
+
+static inline posit16_t posit16_encode_signed(bool sign, int32_t scale, uint32_t significand, bool sticky) {
+	uint16_t bits = posit16_encode(scale, significand, sticky);
+	return posit16_make(sign ? (uint16_t)(0u - bits) : bits);
+}
+
+// round a 64-bit significand in 1.63 format, the low word folds into the sticky bit
+static inline posit16_t posit16_encode_wide(bool sign, int32_t scale, uint64_t significand) {
+	return posit16_encode_signed(sign, scale, (uint32_t)(significand >> 32), (uint32_t)significand != 0);
+}
+
+// round the sum of two magnitudes in 2.30 format with values in [1, 2), the first of which is the larger
+static inline posit16_t posit16_round_sum(bool signA, int32_t scaleA, uint32_t a, bool signB, int32_t scaleB, uint32_t b) {
+	int32_t shift = scaleA - scaleB;
+	bool sticky = false;
+	if (shift >= 32) {
+		sticky = true;
+		b = 0;
+	}
+	else if (shift > 0) {
+		sticky = (b << (32 - shift)) != 0;
+		b >>= shift;
+	}
+	uint32_t sum;
+	if (signA == signB) {
+		sum = a + b;
+	}
+	else {
+		// the truncated bits of b make the exact difference a fraction of a unit smaller
+		sum = a - b - (sticky ? 1 : 0);
+		if (sum == 0) return posit16_make(0);
+	}
+	int lz = posit16_clz32(sum);
+	return posit16_encode_signed(signA, scaleA + 1 - lz, sum << lz, sticky);
+}
+
+// conversion functions
+posit16_t posit16_fromd(double d) {
+	union { double d; uint64_t u; } v;
+	v.d = d;
+	bool sign = (bool)(v.u >> 63);
+	int32_t biased = (int32_t)((v.u >> 52) & 0x7FF);
+	uint64_t mantissa = v.u & ((UINT64_C(1) << 52) - 1);
+	if (biased == 0x7FF) return posit16_make(posit16_nar_bits);  // NaN and infinities
+	if (biased == 0) {
+		if (mantissa == 0) return posit16_make(0);
+		return posit16_make(sign ? (uint16_t)(0u - 0x1u) : 0x1u);  // subnormals are below minpos
+	}
+	return posit16_encode_wide(sign, biased - 1023, (UINT64_C(1) << 63) | (mantissa << 11));
+}
+posit16_t posit16_fromf(float f) {
+	union { float f; uint32_t u; } v;
+	v.f = f;
+	bool sign = (bool)(v.u >> 31);
+	int32_t biased = (int32_t)((v.u >> 23) & 0xFF);
+	uint32_t mantissa = v.u & 0x7FFFFFu;
+	if (biased == 0xFF) return posit16_make(posit16_nar_bits);
+	if (biased == 0) {
+		if (mantissa == 0) return posit16_make(0);
+		return posit16_make(sign ? (uint16_t)(0u - 0x1u) : 0x1u);
+	}
+	return posit16_encode_signed(sign, biased - 127, 0x80000000u | (mantissa << 8), false);
+}
+posit16_t posit16_fromld(long double ld) {
+	return posit16_fromd((double)ld);
+}
+static inline posit16_t posit16_from_magnitude(bool sign, uint64_t magnitude) {
+	if (magnitude == 0) return posit16_make(0);
+	int lz = posit16_clz64(magnitude);
+	return posit16_encode_wide(sign, 63 - lz, magnitude << lz);
+}
+posit16_t posit16_fromsll(long long i) {
+	return posit16_from_magnitude(i < 0, i < 0 ? 0ull - (unsigned long long)i : (unsigned long long)i);
+}
+posit16_t posit16_fromsl(long i)                { return posit16_fromsll(i); }
+posit16_t posit16_fromsi(int i)                 { return posit16_fromsll(i); }
+posit16_t posit16_fromull(unsigned long long i) { return posit16_from_magnitude(false, i); }
+posit16_t posit16_fromul(unsigned long i)       { return posit16_from_magnitude(false, i); }
+posit16_t posit16_fromui(unsigned int i)        { return posit16_from_magnitude(false, i); }
+
+double posit16_tod(posit16_t p) {
+	union { double d; uint64_t u; } v;
+	if (p.v == 0) { v.u = 0; return v.d; }
+	if (p.v == posit16_nar_bits) { v.u = UINT64_C(0x7FF8000000000000); return v.d; }
+	bool sign = (bool)(p.v & posit16_sign_mask);
+	uint32_t significand;
+	int32_t scale = posit16_decode(sign ? (uint16_t)(0u - p.v) : p.v, &significand);
+	v.u = ((uint64_t)sign << 63) | ((uint64_t)(scale + 1023) << 52) | ((uint64_t)(significand & 0x7FFFu) << 37);
+	return v.d;
+}
+float posit16_tof(posit16_t p) {
+	union { float f; uint32_t u; } v;
+	if (p.v == 0) { v.u = 0; return v.f; }
+	if (p.v == posit16_nar_bits) { v.u = 0x7FC00000u; return v.f; }
+	bool sign = (bool)(p.v & posit16_sign_mask);
+	uint32_t significand;
+	int32_t scale = posit16_decode(sign ? (uint16_t)(0u - p.v) : p.v, &significand);
+	v.u = ((uint32_t)sign << 31) | ((uint32_t)(scale + 127) << 23) | ((significand & 0x7FFFu) << 8);
+	return v.f;
+}
+long double posit16_told(posit16_t p) {
+	return (long double)posit16_tod(p);
+}
+// the magnitude truncated toward zero, which always fits 32 bits
+static inline uint32_t posit16_to_magnitude(uint16_t bits) {
+	uint32_t significand;
+	int32_t scale = posit16_decode(bits, &significand);
+	if (scale < 0) return 0;
+	return (scale >= 15) ? (significand << (scale - 15)) : (significand >> (15 - scale));
+}
+// integer conversions truncate toward zero and saturate, NaR converts to the smallest value of the type
+long long posit16_tosll(posit16_t p) {
+	if (p.v == 0) return 0;
+	if (p.v == posit16_nar_bits) return LLONG_MIN;
+	bool sign = (bool)(p.v & posit16_sign_mask);
+	long long magnitude = (long long)posit16_to_magnitude(sign ? (uint16_t)(0u - p.v) : p.v);
+	return sign ? -magnitude : magnitude;
+}
+long posit16_tosl(posit16_t p) {
+	if (p.v == posit16_nar_bits) return LONG_MIN;
+	return (long)posit16_tosll(p);
+}
+int posit16_tosi(posit16_t p) {
+	if (p.v == posit16_nar_bits) return INT_MIN;
+	long long i = posit16_tosll(p);
+	return (i < INT_MIN) ? INT_MIN : (i > INT_MAX) ? INT_MAX : (int)i;
+}
+unsigned long long posit16_toull(posit16_t p) {
+	if (p.v == 0 || (p.v & posit16_sign_mask)) return 0;  // zero, negative values, and NaR
+	return posit16_to_magnitude(p.v);
+}
+unsigned long posit16_toul(posit16_t p) {
+	return (unsigned long)posit16_toull(p);
+}
+unsigned int posit16_toui(posit16_t p) {
+	unsigned long long i = posit16_toull(p);
+	return (i > UINT_MAX) ? UINT_MAX : (unsigned int)i;
+}
+
+// arithmetic operators
+posit16_t posit16_addp16(posit16_t lhs, posit16_t rhs) {
+	if (lhs.v == posit16_nar_bits || rhs.v == posit16_nar_bits) return posit16_make(posit16_nar_bits);
+	if (lhs.v == 0) return rhs;
+	if (rhs.v == 0) return lhs;
+	bool signA = (bool)(lhs.v & posit16_sign_mask), signB = (bool)(rhs.v & posit16_sign_mask);
+	uint16_t a = signA ? (uint16_t)(0u - lhs.v) : lhs.v, b = signB ? (uint16_t)(0u - rhs.v) : rhs.v;
+	if (a < b) {  // posit magnitudes are ordered like their encodings
+		uint16_t tmp = a; a = b; b = tmp;
+		bool s = signA; signA = signB; signB = s;
+	}
+	uint32_t significandA, significandB;
+	int32_t scaleA = posit16_decode(a, &significandA);
+	int32_t scaleB = posit16_decode(b, &significandB);
+	return posit16_round_sum(signA, scaleA, significandA << 15, signB, scaleB, significandB << 15);
+}
+posit16_t posit16_subp16(posit16_t lhs, posit16_t rhs) {
+	rhs.v = (uint16_t)(0u - rhs.v);  // 0 and NaR are invariant under negation
+	return posit16_addp16(lhs, rhs);
+}
+posit16_t posit16_mulp16(posit16_t lhs, posit16_t rhs) {
+	if (lhs.v == posit16_nar_bits || rhs.v == posit16_nar_bits) return posit16_make(posit16_nar_bits);
+	if (lhs.v == 0 || rhs.v == 0) return posit16_make(0);
+	bool signA = (bool)(lhs.v & posit16_sign_mask), signB = (bool)(rhs.v & posit16_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scale = posit16_decode(signA ? (uint16_t)(0u - lhs.v) : lhs.v, &significandA);
+	scale += posit16_decode(signB ? (uint16_t)(0u - rhs.v) : rhs.v, &significandB);
+	uint32_t product = significandA * significandB;  // 2.30, exact
+	if (product >> 31) ++scale; else product <<= 1;
+	return posit16_encode_signed(signA != signB, scale, product, false);
+}
+posit16_t posit16_divp16(posit16_t lhs, posit16_t rhs) {
+	if (lhs.v == posit16_nar_bits || rhs.v == posit16_nar_bits || rhs.v == 0) return posit16_make(posit16_nar_bits);
+	if (lhs.v == 0) return posit16_make(0);
+	bool signA = (bool)(lhs.v & posit16_sign_mask), signB = (bool)(rhs.v & posit16_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scale = posit16_decode(signA ? (uint16_t)(0u - lhs.v) : lhs.v, &significandA);
+	scale -= posit16_decode(signB ? (uint16_t)(0u - rhs.v) : rhs.v, &significandB);
+	uint32_t dividend = significandA << 16;
+	uint32_t quotient = dividend / significandB;  // in (2^15, 2^17)
+	bool sticky = (dividend % significandB) != 0;
+	if (quotient >> 16) {
+		quotient <<= 15;
+	}
+	else {
+		--scale;
+		quotient <<= 16;
+	}
+	return posit16_encode_signed(signA != signB, scale, quotient, sticky);
+}
+// fused multiply-add: a * b + c with a single rounding
+posit16_t posit16_fma(posit16_t a, posit16_t b, posit16_t c) {
+	if (a.v == posit16_nar_bits || b.v == posit16_nar_bits || c.v == posit16_nar_bits) return posit16_make(posit16_nar_bits);
+	if (a.v == 0 || b.v == 0) return c;
+	bool signA = (bool)(a.v & posit16_sign_mask), signB = (bool)(b.v & posit16_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scaleP = posit16_decode(signA ? (uint16_t)(0u - a.v) : a.v, &significandA);
+	scaleP += posit16_decode(signB ? (uint16_t)(0u - b.v) : b.v, &significandB);
+	uint32_t product = significandA * significandB;  // 2.30 with at most 26 significant bits
+	bool signP = (signA != signB);
+	if (product >> 31) {
+		product >>= 1;  // the low bits of the product are zero
+		++scaleP;
+	}
+	if (c.v == 0) return posit16_encode_signed(signP, scaleP, product << 1, false);
+	bool signC = (bool)(c.v & posit16_sign_mask);
+	uint32_t significandC;
+	int32_t scaleC = posit16_decode(signC ? (uint16_t)(0u - c.v) : c.v, &significandC);
+	uint32_t addend = significandC << 15;
+	if (scaleP > scaleC || (scaleP == scaleC && product >= addend)) {
+		return posit16_round_sum(signP, scaleP, product, signC, scaleC, addend);
+	}
+	return posit16_round_sum(signC, scaleC, addend, signP, scaleP, product);
+}
+// floor of the square root of a 32-bit radicand, digit by digit
+static inline uint32_t posit16_isqrt(uint32_t radicand, bool* inexact) {
+	uint32_t root = 0, bit = 1u << 30;
+	while (bit != 0) {
+		if (radicand >= root + bit) {
+			radicand -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	*inexact = (radicand != 0);
+	return root;
+}
+posit16_t posit16_sqrt(posit16_t a) {
+	if (a.v == 0) return a;
+	if (a.v & posit16_sign_mask) return posit16_make(posit16_nar_bits);  // NaR and negative values
+	uint32_t significand;
+	int32_t scale = posit16_decode(a.v, &significand);
+	// the radicand x * 2^30 with x in [1, 4) after making the scale even
+	bool odd = (scale & 1) != 0;
+	uint32_t radicand = significand << (odd ? 16 : 15);
+	if (odd) --scale;
+	bool inexact;
+	uint32_t root = posit16_isqrt(radicand, &inexact);  // in [2^15, 2^16)
+	return posit16_encode_signed(false, scale / 2, root << 16, inexact);
+}
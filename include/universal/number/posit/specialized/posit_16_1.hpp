@@ -13,6 +13,9 @@
 #define POSIT_FAST_POSIT_16_1 0
 #endif
 
+#include <bit>
+#include <universal/number/posit/specialized/constexpr_conversion.hpp>
+
 namespace sw::universal {
 
 // set the fast specialization variable to indicate that we are running a special template specialization
@@ -74,9 +77,9 @@ public:
 	explicit constexpr posit(unsigned int initial_value) : _bits(0)       { *this = initial_value; }
 	explicit constexpr posit(unsigned long initial_value) : _bits(0)      { *this = initial_value; }
 	explicit constexpr posit(unsigned long long initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(float initial_value) : _bits(0)              { *this = initial_value; }
-		               posit(double initial_value) : _bits(0)             { *this = initial_value; }
-	explicit           posit(long double initial_value) : _bits(0)        { *this = initial_value; }
+	explicit constexpr posit(float initial_value) : _bits(0)              { *this = initial_value; }
+	         constexpr posit(double initial_value) : _bits(0)             { *this = initial_value; }
+	explicit constexpr posit(long double initial_value) : _bits(0)        { *this = initial_value; }
 
 	// assignment operators for native types
 	constexpr posit& operator=(signed char rhs)       { return integer_assign((long)rhs); }
@@ -89,19 +92,19 @@ public:
 	constexpr posit& operator=(unsigned int rhs)      { return integer_assign((long)rhs); }
 	constexpr posit& operator=(unsigned long rhs)     { return integer_assign((long)rhs); }
 	constexpr posit& operator=(unsigned long long rhs){ return integer_assign((long)rhs); }
-		      posit& operator=(float rhs)             { return float_assign(double(rhs)); }
-		      posit& operator=(double rhs)            { return float_assign(rhs); }
-		      posit& operator=(long double rhs)       { return float_assign(double(rhs)); }
-
-	explicit operator long double() const { return to_long_double(); }
-	explicit operator double() const { return to_double(); }
-	explicit operator float() const { return to_float(); }
-	explicit operator long long() const { return to_long_long(); }
-	explicit operator long() const { return to_long(); }
-	explicit operator int() const { return to_int(); }
-	explicit operator unsigned long long() const { return to_long_long(); }
-	explicit operator unsigned long() const { return to_long(); }
-	explicit operator unsigned int() const { return to_int(); }
+	constexpr posit& operator=(float rhs)             { return float_assign(double(rhs)); }
+	constexpr posit& operator=(double rhs)            { return float_assign(rhs); }
+	constexpr posit& operator=(long double rhs)       { return float_assign(double(rhs)); }
+
+	explicit constexpr operator long double() const { return to_long_double(); }
+	explicit constexpr operator double() const { return to_double(); }
+	explicit constexpr operator float() const { return to_float(); }
+	explicit constexpr operator long long() const { return to_long_long(); }
+	explicit constexpr operator long() const { return to_long(); }
+	explicit constexpr operator int() const { return to_int(); }
+	explicit constexpr operator unsigned long long() const { return to_long_long(); }
+	explicit constexpr operator unsigned long() const { return to_long(); }
+	explicit constexpr operator unsigned int() const { return to_int(); }
 
 	posit& setBitblock(const bitblock<NBITS_IS_16>& raw) {
 		_bits = uint16_t(raw.to_ulong());
@@ -117,7 +120,7 @@ public:
 		posit p;
 		return p.setbits((~_bits) + 1);
 	}
-	posit& operator+=(const posit& b) {
+	constexpr posit& operator+=(const posit& b) {
 		// process special cases
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -183,7 +186,7 @@ public:
 		if (sign) _bits = -_bits & 0xFFFF;
 		return *this;
 	}
-	posit& operator-=(const posit& b) {
+	constexpr posit& operator-=(const posit& b) {
 		// process special cases
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -262,7 +265,7 @@ public:
 		if (sign) _bits = -_bits & 0xFFFF;
 		return *this;
 	}
-	posit& operator*=(const posit& b) {
+	constexpr posit& operator*=(const posit& b) {
 		// process special cases
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -318,7 +321,7 @@ public:
 		if (sign) _bits = -_bits & 0xFFFF;
 		return *this;
 	}
-	posit& operator/=(const posit& b) {
+	constexpr posit& operator/=(const posit& b) {
 		// process special cases
 	// since we are encoding error conditions as NaR (Not a Real), we need to process that condition first
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
@@ -367,9 +370,8 @@ public:
 		exp -= remaining >> 14;
 		uint16_t rhs_fraction = (0x4000 | remaining);
 
-		div_t result = div(fraction, rhs_fraction);
-		uint32_t result_fraction = result.quot;
-		uint32_t remainder = result.rem;
+		uint32_t result_fraction = fraction / rhs_fraction;
+		uint32_t remainder = fraction % rhs_fraction;
 
 		// adjust the exponent if needed
 		if (exp < 0) {
@@ -392,30 +394,30 @@ public:
 		return *this;
 	}
 	// prefix/postfix operators
-	posit& operator++() {
+	constexpr posit& operator++() {
 		++_bits;
 		return *this;
 	}
-	posit operator++(int) {
+	constexpr posit operator++(int) {
 		posit tmp(*this);
 		operator++();
 		return tmp;
 	}
-	posit& operator--() {
+	constexpr posit& operator--() {
 		--_bits;
 		return *this;
 	}
-	posit operator--(int) {
+	constexpr posit operator--(int) {
 		posit tmp(*this);
 		operator--();
 		return tmp;
 	}
 	
-	posit reciprocate() const {
+	constexpr posit reciprocate() const {
 		posit p = 1.0 / *this;
 		return p;
 	}
-	posit abs() const {
+	constexpr posit abs() const {
 		if (isneg()) {
 			return posit(-*this);
 		}
@@ -423,45 +425,45 @@ public:
 	}
 
 	// Selectors
-	inline bool sign() const       { return (_bits & sign_mask); }
-	inline bool isnar() const      { return (_bits == sign_mask); }
-	inline bool iszero() const     { return (_bits == 0x0); }
-	inline bool isone() const      { return (_bits == 0x4000); } // pattern 010000...
-	inline bool isminusone() const { return (_bits == 0xC000); } // pattern 110000...
-	inline bool isneg() const      { return (_bits & sign_mask); }
-	inline bool ispos() const      { return !isneg(); }
-	inline bool ispowerof2() const { return !(_bits & 0x1); }
+	constexpr bool sign() const       { return (_bits & sign_mask); }
+	constexpr bool isnar() const      { return (_bits == sign_mask); }
+	constexpr bool iszero() const     { return (_bits == 0x0); }
+	constexpr bool isone() const      { return (_bits == 0x4000); } // pattern 010000...
+	constexpr bool isminusone() const { return (_bits == 0xC000); } // pattern 110000...
+	constexpr bool isneg() const      { return (_bits & sign_mask); }
+	constexpr bool ispos() const      { return !isneg(); }
+	constexpr bool ispowerof2() const { return !(_bits & 0x1); }
 
-	inline int sign_value() const  { return (_bits & 0x8 ? -1 : 1); }
+	constexpr int sign_value() const  { return (_bits & 0x8 ? -1 : 1); }
 
 	bitblock<NBITS_IS_16> get() const { bitblock<NBITS_IS_16> bb; bb = int(_bits); return bb; }
-	unsigned long long encoding() const { return (unsigned long long)(_bits); }
+	constexpr unsigned long long encoding() const { return (unsigned long long)(_bits); }
 
 	// Modifiers
-	inline void clear() { _bits = 0; }
-	inline void setzero() { clear(); }
-	inline void setnar() { _bits = sign_mask; }
-	inline posit& minpos() {
+	constexpr void clear() { _bits = 0; }
+	constexpr void setzero() { clear(); }
+	constexpr void setnar() { _bits = sign_mask; }
+	constexpr posit& minpos() {
 		clear();
 		return ++(*this);
 	}
-	inline posit& maxpos() {
+	constexpr posit& maxpos() {
 		setnar();
 		return --(*this);
 	}
-	inline posit& zero() {
+	constexpr posit& zero() {
 		clear();
 		return *this;
 	}
-	inline posit& minneg() {
+	constexpr posit& minneg() {
 		clear();
 		return --(*this);
 	}
-	inline posit& maxneg() {
+	constexpr posit& maxneg() {
 		setnar();
 		return ++(*this);
 	}
-	inline posit twosComplement() const {
+	constexpr posit twosComplement() const {
 		posit p;
 		return p.setbits(~_bits + 1);
 	}
@@ -487,84 +489,47 @@ private:
 
 	// Conversion functions
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
-	int         to_int() const {
+	constexpr int         to_int() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return int(to_float());
 	}
-	long        to_long() const {
+	constexpr long        to_long() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return long(to_double());
 	}
-	long long   to_long_long() const {
+	constexpr long long   to_long_long() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return long(to_long_double());
 	}
 #else
-	int         to_int() const {
+	constexpr int         to_int() const {
 		if (iszero()) return 0;
 		if (isnar())  return int(INFINITY);
 		return int(to_float());
 	}
-	long        to_long() const {
+	constexpr long        to_long() const {
 		if (iszero()) return 0;
 		if (isnar())  return long(INFINITY);
 		return long(to_double());
 	}
-	long long   to_long_long() const {
+	constexpr long long   to_long_long() const {
 		if (iszero()) return 0;
 		if (isnar())  return (long long)(INFINITY);
 		return long(to_long_double());
 	}
 #endif
-	float       to_float() const {
+	constexpr float       to_float() const {
 		return (float)to_double();
 	}
-	double      to_double() const {
-		if (iszero())	return 0.0;
-		if (isnar())	return NAN;
-		bool		     	 _sign;
-		regime<nbits, es>    _regime;
-		exponent<nbits, es>  _exponent;
-		fraction<fbits>      _fraction;
-		bitblock<nbits>		 _raw_bits;
-		_raw_bits.reset();
-		uint64_t mask = 1;
-		for (size_t i = 0; i < nbits; i++) {
-			_raw_bits.set(i, (_bits & mask));
-			mask <<= 1;
-		}
-		decode(_raw_bits, _sign, _regime, _exponent, _fraction);
-		double s = (_sign ? -1.0 : 1.0);
-		double r = _regime.value();
-		double e = _exponent.value();
-		double f = (1.0 + _fraction.value());
-		return s * r * e * f;
-	}
-	long double to_long_double() const {
-		if (iszero())  return 0.0;
-		if (isnar())   return NAN;
-		bool		     	 _sign;
-		regime<nbits, es>    _regime;
-		exponent<nbits, es>  _exponent;
-		fraction<fbits>      _fraction;
-		bitblock<nbits>		 _raw_bits;
-		_raw_bits.reset();
-		uint64_t mask = 1;
-		for (size_t i = 0; i < nbits; i++) {
-			_raw_bits.set(i, (_bits & mask));
-			mask <<= 1;
-		}
-		decode(_raw_bits, _sign, _regime, _exponent, _fraction);
-		long double s = (_sign ? -1.0 : 1.0);
-		long double r = _regime.value();
-		long double e = _exponent.value();
-		long double f = (1.0 + _fraction.value());
-		return s * r * e * f;
+	constexpr double      to_double() const {
+		return posit_to_native<NBITS_IS_16, ES_IS_1, double>(_bits);
+	}
+	constexpr long double to_long_double() const {
+		return posit_to_native<NBITS_IS_16, ES_IS_1, long double>(_bits);
 	}
-
 
 	// helper methods
 	constexpr posit& integer_assign(long rhs) {
@@ -611,27 +576,13 @@ private:
 	// convert a double precision IEEE floating point to a posit<16,1>. You need to use at least doubles to capture
 	// enough bits to correctly round mul/div and elementary function results. That is, if you use a single precision
 	// float, you will inject errors in the validation suites.
-	posit& float_assign(double rhs) {
-		constexpr int dfbits = std::numeric_limits<double>::digits - 1;
-		internal::value<dfbits> v(rhs);
-		// special case processing
-		if (v.iszero()) {
-			setzero();
-			return *this;
-		}
-		if (v.isinf() || v.isnan()) {  // posit encode for FP_INFINITE and NaN as NaR (Not a Real)
-			setnar();
-			return *this;
-		}
-
-		bitblock<NBITS_IS_16> ptt;
-		convert_to_bb<NBITS_IS_16, ES_IS_1, dfbits>(v.sign(), v.scale(), v.fraction(), ptt); // TODO: needs to be faster
-		_bits = uint16_t(ptt.to_ulong());
+	constexpr posit& float_assign(double rhs) {
+		_bits = uint16_t(native_to_posit<NBITS_IS_16, ES_IS_1>(rhs));
 		return *this;
 	}
 
 	// decode_regime takes the raw bits of the posit, and returns the regime run-length, m, and the remaining fraction bits in remainder
-	inline void decode_regime(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
+	constexpr void decode_regime(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFF;
 		if (bits & 0x4000) {  // positive regimes
 			while (remaining >> 15) {
@@ -648,7 +599,7 @@ private:
 			remaining &= 0x7FFF;
 		}
 	}
-	inline void extractAddand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
+	constexpr void extractAddand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFF;
 		if (bits & 0x4000) {  // positive regimes
 			while (remaining >> 15) {
@@ -665,7 +616,7 @@ private:
 			remaining &= 0x7FFF;
 		}
 	}
-	inline void extractMultiplicand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
+	constexpr void extractMultiplicand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFF;
 		if (bits & 0x4000) {  // positive regimes
 			while (remaining >> 15) {
@@ -682,7 +633,7 @@ private:
 			remaining &= 0x7FFF;
 		}
 	}
-	inline void extractDividand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
+	constexpr void extractDividand(const uint16_t bits, int8_t& m, uint16_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFF;
 		if (bits & 0x4000) {  // positive regimes
 			while (remaining >> 15) {
@@ -699,7 +650,7 @@ private:
 			remaining &= 0x7FFF;
 		}
 	}
-	inline uint16_t round(const int8_t m, uint16_t exp, uint32_t fraction) const {
+	constexpr uint16_t round(const int8_t m, uint16_t exp, uint32_t fraction) const {
 		uint16_t scale, regime, bits;
 		if (m < 0) {
 			scale = (-m & 0xFFFF);
@@ -739,7 +690,7 @@ private:
 		}
 		return bits;
 	}
-	inline uint16_t divRound(const int8_t m, uint16_t exp, uint32_t fraction, bool nonZeroRemainder) const {
+	constexpr uint16_t divRound(const int8_t m, uint16_t exp, uint32_t fraction, bool nonZeroRemainder) const {
 		uint16_t scale, regime, bits;
 		if (m < 0) {
 			scale = (-m & 0xFFFF);
@@ -781,7 +732,7 @@ private:
 		}
 		return bits;
 	}
-	inline uint16_t adjustAndRound(const int8_t m, uint16_t exp, uint32_t fraction) const {
+	constexpr uint16_t adjustAndRound(const int8_t m, uint16_t exp, uint32_t fraction) const {
 		uint16_t scale, regime, bits;
 		if (m < 0) {
 			scale = (-m & 0xFFFF);
@@ -827,12 +778,12 @@ private:
 	friend std::istream& operator>> (std::istream& istr, posit<NBITS_IS_16, ES_IS_1>& p);
 
 	// posit - posit logic functions
-	friend bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
-	friend bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
-	friend bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
-	friend bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
-	friend bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
-	friend bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
+	friend constexpr bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs);
 
 };
 
@@ -876,22 +827,22 @@ inline std::string to_string(const posit<NBITS_IS_16, ES_IS_1>& p, std::streamsi
 }
 
 // posit - posit binary logic operators
-inline bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return lhs._bits == rhs._bits;
 }
-inline bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return !operator==(lhs, rhs);
 }
-inline bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return int16_t(lhs._bits) < int16_t(rhs._bits);
 }
-inline bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return operator< (rhs, lhs);
 }
-inline bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return operator< (lhs, rhs) || operator==(lhs, rhs);
 }
-inline bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return !operator< (lhs, rhs);
 }
 
@@ -904,47 +855,144 @@ inline bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, const posit<NBITS
 // posit - literal logic functions
 
 // posit - int logic operators
-inline bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator==(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return operator==(lhs, posit<NBITS_IS_16, ES_IS_1>(rhs));
 }
-inline bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator!=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return !operator==(lhs, posit<NBITS_IS_16, ES_IS_1>(rhs));
 }
-inline bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator< (const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return operator<(lhs, posit<NBITS_IS_16, ES_IS_1>(rhs));
 }
-inline bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator> (const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return operator< (posit<NBITS_IS_16, ES_IS_1>(rhs), lhs);
 }
-inline bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator<=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return operator< (lhs, posit<NBITS_IS_16, ES_IS_1>(rhs)) || operator==(lhs, posit<NBITS_IS_16, ES_IS_1>(rhs));
 }
-inline bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
+constexpr bool operator>=(const posit<NBITS_IS_16, ES_IS_1>& lhs, int rhs) {
 	return !operator<(lhs, posit<NBITS_IS_16, ES_IS_1>(rhs));
 }
 
 // int - posit logic operators
-inline bool operator==(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator==(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return posit<NBITS_IS_16, ES_IS_1>(lhs) == rhs;
 }
-inline bool operator!=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator!=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return !operator==(posit<NBITS_IS_16, ES_IS_1>(lhs), rhs);
 }
-inline bool operator< (int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator< (int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return operator<(posit<NBITS_IS_16, ES_IS_1>(lhs), rhs);
 }
-inline bool operator> (int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator> (int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return operator< (posit<NBITS_IS_16, ES_IS_1>(rhs), lhs);
 }
-inline bool operator<=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator<=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return operator< (posit<NBITS_IS_16, ES_IS_1>(lhs), rhs) || operator==(posit<NBITS_IS_16, ES_IS_1>(lhs), rhs);
 }
-inline bool operator>=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
+constexpr bool operator>=(int lhs, const posit<NBITS_IS_16, ES_IS_1>& rhs) {
 	return !operator<(posit<NBITS_IS_16, ES_IS_1>(lhs), rhs);
 }
 
 #endif // POSIT_ENABLE_LITERALS
 
+// fused multiply-add: a * b + c with a single rounding
+// The operands are decoded into a scale and a significand in 1.15 format. The product of the
+// significands is exact in 32 bits, the addend is aligned to the larger of the two with the bits
+// shifted away folded into a sticky bit, and the sum is rounded once to the nearest posit.
+namespace internal {
+	// decode a positive posit<16,1> encoding into its scale and its significand in 1.15 format
+	inline constexpr int32_t decode_posit16(uint16_t bits, uint32_t& significand) {
+		uint32_t body = uint32_t(bits) << 17;  // drop the sign bit and align at the top of the word
+		bool positiveRegime = (body & 0x8000'0000u);
+		int run = positiveRegime ? std::countl_one(body) : std::countl_zero(body);
+		int32_t k = positiveRegime ? run - 1 : -run;
+		uint32_t rest = (run < 31) ? (body << (run + 1)) : 0u;  // exponent and fraction bits
+		significand = 0x8000u | ((rest & 0x7FFF'FFFFu) >> 16);
+		return 2 * k + int32_t(rest >> 31);
+	}
+	// round 2^scale * significand, with the significand in 1.31 format, to a positive posit<16,1> encoding
+	inline constexpr uint16_t encode_posit16(int32_t scale, uint32_t significand, bool sticky) {
+		if (scale >= 28) return 0x7FFFu;  // maxpos
+		if (scale < -28) return 0x1u;     // minpos
+		int32_t k = (scale >= 0) ? scale / 2 : -((1 - scale) / 2);
+		uint32_t exponent = uint32_t(scale - 2 * k);
+		int len = (k >= 0) ? k + 2 : 1 - k;  // the number of regime bits including the terminating bit
+		uint32_t regime = (k >= 0) ? (((1u << (k + 1)) - 1u) << 1) : 1u;
+		// the 15 bits below the sign bit of the posit occupy bits 30..16 of the window
+		uint32_t fraction = significand << 1;  // drop the hidden bit
+		uint32_t window = (regime << (31 - len)) | (exponent << (30 - len)) | (fraction >> (len + 2));
+		sticky = sticky || (fraction & ((1u << (len + 2)) - 1u)) != 0 || (window & 0x7FFFu) != 0;
+		uint16_t bits = uint16_t(window >> 16);
+		bool guard = (window >> 15) & 1;
+		if (guard && (sticky || (bits & 1))) ++bits;
+		return bits;
+	}
+	// round the sum of two magnitudes in 2.30 format with values in [1, 2), the first of which is the larger
+	inline constexpr uint16_t round_sum_posit16(bool signA, int32_t scaleA, uint32_t a, bool signB, int32_t scaleB, uint32_t b) {
+		int32_t shift = scaleA - scaleB;
+		bool sticky = false;
+		if (shift >= 32) {
+			sticky = true;
+			b = 0;
+		}
+		else if (shift > 0) {
+			sticky = (b << (32 - shift)) != 0;
+			b >>= shift;
+		}
+		uint32_t sum{ 0 };
+		if (signA == signB) {
+			sum = a + b;
+		}
+		else {
+			// the truncated bits of b make the exact difference a fraction of a unit smaller
+			sum = a - b - (sticky ? 1u : 0u);
+			if (sum == 0) return 0u;
+		}
+		int lz = std::countl_zero(sum);
+		uint16_t bits = encode_posit16(scaleA + 1 - lz, sum << lz, sticky);
+		return signA ? uint16_t(0u - bits) : bits;
+	}
+}
+
+inline posit<NBITS_IS_16, ES_IS_1> fma(const posit<NBITS_IS_16, ES_IS_1>& a, const posit<NBITS_IS_16, ES_IS_1>& b, const posit<NBITS_IS_16, ES_IS_1>& c) {
+	posit<NBITS_IS_16, ES_IS_1> result;
+#if POSIT_THROW_ARITHMETIC_EXCEPTION
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		throw operand_is_nar{};
+	}
+#else
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		result.setnar();
+		return result;
+	}
+#endif // POSIT_THROW_ARITHMETIC_EXCEPTION
+	if (a.iszero() || b.iszero()) return c;
+	uint16_t aBits = uint16_t(a.encoding()), bBits = uint16_t(b.encoding()), cBits = uint16_t(c.encoding());
+	bool signA = a.sign(), signB = b.sign();
+	uint32_t significandA{ 0 }, significandB{ 0 };
+	int32_t scaleP = internal::decode_posit16(signA ? uint16_t(0u - aBits) : aBits, significandA);
+	scaleP += internal::decode_posit16(signB ? uint16_t(0u - bBits) : bBits, significandB);
+	uint32_t product = significandA * significandB;  // 2.30 with at most 26 significant bits
+	bool signP = (signA != signB);
+	if (product >> 31) {
+		product >>= 1;  // the low bits of the product are zero
+		++scaleP;
+	}
+	if (c.iszero()) {
+		uint16_t bits = internal::encode_posit16(scaleP, product << 1, false);
+		return result.setbits(signP ? uint16_t(0u - bits) : bits);
+	}
+	bool signC = c.sign();
+	uint32_t significandC{ 0 };
+	int32_t scaleC = internal::decode_posit16(signC ? uint16_t(0u - cBits) : cBits, significandC);
+	uint32_t addend = significandC << 15;
+	if (scaleP > scaleC || (scaleP == scaleC && product >= addend)) {
+		return result.setbits(internal::round_sum_posit16(signP, scaleP, product, signC, scaleC, addend));
+	}
+	return result.setbits(internal::round_sum_posit16(signC, scaleC, addend, signP, scaleP, product));
+}
+
 #endif // POSIT_FAST_POSIT_16_1
 
 } // namespace sw::universal
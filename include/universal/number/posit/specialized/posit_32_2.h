@@ -0,0 +1,343 @@
+#pragma once
+// posit_32_2.h: standard 32-bit posit C implementation with integer-only kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include <universal/number/posit/positctypes.h>
+
+/*
+   The kernels decode a positive encoding into a scale and a significand in 1.31 format, compute
+   the exact result, or its truncation plus a sticky bit, in 64-bit integer arithmetic, and round
+   once in posit32_encode. They only use integer operations and a count of leading zeros, so the
+   file compiles freestanding: float and double appear as bit containers of the conversions, never
+   as operands of floating-point arithmetic. Every result is the correctly rounded posit<32,2> of
+   the exact value, which is the result of the fast C++ specialization.
+ */
+
+static const uint32_t posit32_sign_mask = 0x80000000u;
+static const uint32_t posit32_nar_bits  = 0x80000000u;
+static const uint32_t posit32_maxpos_bits = 0x7FFFFFFFu;
+static const int32_t  posit32_max_scale = 120;   // maxpos = 2^120
+
+// count leading zeros of a nonzero word
+#if defined(__GNUC__) || defined(__clang__)
+static inline int posit32_clz32(uint32_t x) { return __builtin_clz(x); }
+static inline int posit32_clz64(uint64_t x) { return __builtin_clzll(x); }
+#else
+static inline int posit32_clz32(uint32_t x) {
+	int n = 0;
+	if (!(x >> 16)) { n += 16; x <<= 16; }
+	if (!(x >> 24)) { n += 8;  x <<= 8; }
+	if (!(x >> 28)) { n += 4;  x <<= 4; }
+	if (!(x >> 30)) { n += 2;  x <<= 2; }
+	if (!(x >> 31)) { n += 1; }
+	return n;
+}
+static inline int posit32_clz64(uint64_t x) {
+	return (x >> 32) ? posit32_clz32((uint32_t)(x >> 32)) : 32 + posit32_clz32((uint32_t)x);
+}
+#endif
+
+static inline posit32_t posit32_make(uint32_t bits) { posit32_t p; p.v = bits; return p; }
+
+// decode a positive encoding into its scale and its significand in 1.31 format
+static inline int32_t posit32_decode(uint32_t bits, uint32_t* significand) {
+	uint32_t body = bits << 1;  // drop the sign bit
+	int run;
+	int32_t k;
+	if (body & posit32_sign_mask) {  // positive regimes: a run of ones
+		run = posit32_clz32(~body);
+		k = run - 1;
+	}
+	else {                           // negative regimes: a run of zeros
+		run = posit32_clz32(body);
+		k = -run;
+	}
+	uint32_t rest = (run < 31) ? (body << (run + 1)) : 0;  // exponent and fraction bits
+	*significand = posit32_sign_mask | ((rest << 2) >> 1);
+	return 4 * k + (int32_t)(rest >> 30);
+}
+
+// round 2^scale * significand, with the significand in 1.63 format, to a positive encoding.
+// sticky marks nonzero bits below the significand. Posits saturate at maxpos and minpos.
+static inline uint32_t posit32_encode(int32_t scale, uint64_t significand, bool sticky) {
+	if (scale >= posit32_max_scale) return posit32_maxpos_bits;
+	if (scale < -posit32_max_scale) return 0x1u;
+	int32_t k = (scale >= 0) ? scale / 4 : -((3 - scale) / 4);
+	uint64_t exponent = (uint64_t)(scale - 4 * k);
+	uint64_t regime;
+	int len;  // the number of regime bits including the terminating bit
+	if (k >= 0) {
+		len = k + 2;
+		regime = ((UINT64_C(1) << (k + 1)) - 1) << 1;
+	}
+	else {
+		len = 1 - k;
+		regime = 1;
+	}
+	// the 31 bits below the sign bit of the posit occupy bits 62..32 of the window
+	uint64_t fraction = significand << 1;  // drop the hidden bit
+	uint64_t window = (regime << (63 - len)) | (exponent << (61 - len)) | (fraction >> (len + 3));
+	sticky = sticky || (fraction & ((UINT64_C(1) << (len + 3)) - 1)) != 0 || (window & 0x7FFFFFFFu) != 0;
+	uint32_t bits = (uint32_t)(window >> 32);
+	bool guard = (window >> 31) & 1;
+	if (guard && (sticky || (bits & 1))) ++bits;
+	return bits;
+}
+
+static inline posit32_t posit32_encode_signed(bool sign, int32_t scale, uint64_t significand, bool sticky) {
+	uint32_t bits = posit32_encode(scale, significand, sticky);
+	return posit32_make(sign ? 0u - bits : bits);
+}
+
+// round the sum of two magnitudes in 2.62 format with values in [1, 2), the first of which is the larger
+static inline posit32_t posit32_round_sum(bool signA, int32_t scaleA, uint64_t a, bool signB, int32_t scaleB, uint64_t b) {
+	int32_t shift = scaleA - scaleB;
+	bool sticky = false;
+	if (shift >= 64) {
+		sticky = true;
+		b = 0;
+	}
+	else if (shift > 0) {
+		sticky = (b << (64 - shift)) != 0;
+		b >>= shift;
+	}
+	uint64_t sum;
+	if (signA == signB) {
+		sum = a + b;
+	}
+	else {
+		// the truncated bits of b make the exact difference a fraction of a unit smaller
+		sum = a - b - (sticky ? 1 : 0);
+		if (sum == 0) return posit32_make(0);
+	}
+	int lz = posit32_clz64(sum);
+	return posit32_encode_signed(signA, scaleA + 1 - lz, sum << lz, sticky);
+}
+
+// conversion functions
+posit32_t posit32_fromd(double d) {
+	union { double d; uint64_t u; } v;
+	v.d = d;
+	bool sign = (bool)(v.u >> 63);
+	int32_t biased = (int32_t)((v.u >> 52) & 0x7FF);
+	uint64_t mantissa = v.u & ((UINT64_C(1) << 52) - 1);
+	if (biased == 0x7FF) return posit32_make(posit32_nar_bits);  // NaN and infinities
+	if (biased == 0) {
+		if (mantissa == 0) return posit32_make(0);
+		int lz = posit32_clz64(mantissa);  // subnormal
+		return posit32_encode_signed(sign, -1011 - lz, mantissa << lz, false);
+	}
+	return posit32_encode_signed(sign, biased - 1023, (UINT64_C(1) << 63) | (mantissa << 11), false);
+}
+posit32_t posit32_fromf(float f) {
+	union { float f; uint32_t u; } v;
+	v.f = f;
+	bool sign = (bool)(v.u >> 31);
+	int32_t biased = (int32_t)((v.u >> 23) & 0xFF);
+	uint64_t mantissa = v.u & 0x7FFFFFu;
+	if (biased == 0xFF) return posit32_make(posit32_nar_bits);
+	if (biased == 0) {
+		if (mantissa == 0) return posit32_make(0);
+		int lz = posit32_clz64(mantissa);
+		return posit32_encode_signed(sign, -86 - lz, mantissa << lz, false);
+	}
+	return posit32_encode_signed(sign, biased - 127, (UINT64_C(1) << 63) | (mantissa << 40), false);
+}
+posit32_t posit32_fromld(long double ld) {
+	return posit32_fromd((double)ld);
+}
+static inline posit32_t posit32_from_magnitude(bool sign, uint64_t magnitude) {
+	if (magnitude == 0) return posit32_make(0);
+	int lz = posit32_clz64(magnitude);
+	return posit32_encode_signed(sign, 63 - lz, magnitude << lz, false);
+}
+posit32_t posit32_fromsll(long long i) {
+	return posit32_from_magnitude(i < 0, i < 0 ? 0ull - (unsigned long long)i : (unsigned long long)i);
+}
+posit32_t posit32_fromsl(long i)                { return posit32_fromsll(i); }
+posit32_t posit32_fromsi(int i)                 { return posit32_fromsll(i); }
+posit32_t posit32_fromull(unsigned long long i) { return posit32_from_magnitude(false, i); }
+posit32_t posit32_fromul(unsigned long i)       { return posit32_from_magnitude(false, i); }
+posit32_t posit32_fromui(unsigned int i)        { return posit32_from_magnitude(false, i); }
+
+double posit32_tod(posit32_t p) {
+	union { double d; uint64_t u; } v;
+	if (p.v == 0) { v.u = 0; return v.d; }
+	if (p.v == posit32_nar_bits) { v.u = UINT64_C(0x7FF8000000000000); return v.d; }
+	bool sign = (bool)(p.v & posit32_sign_mask);
+	uint32_t significand;
+	int32_t scale = posit32_decode(sign ? 0u - p.v : p.v, &significand);
+	v.u = ((uint64_t)sign << 63) | ((uint64_t)(scale + 1023) << 52) | ((uint64_t)(significand & 0x7FFFFFFFu) << 21);
+	return v.d;
+}
+float posit32_tof(posit32_t p) {
+	union { float f; uint32_t u; } v;
+	if (p.v == 0) { v.u = 0; return v.f; }
+	if (p.v == posit32_nar_bits) { v.u = 0x7FC00000u; return v.f; }
+	bool sign = (bool)(p.v & posit32_sign_mask);
+	uint32_t significand;
+	int32_t scale = posit32_decode(sign ? 0u - p.v : p.v, &significand);
+	// round the 31 fraction bits to the 23 bits of a float, the scale of a posit32 stays in the normal range
+	uint32_t fraction = significand & 0x7FFFFFFFu;
+	uint32_t mantissa = fraction >> 8;
+	uint32_t remainder = fraction & 0xFFu;
+	if (remainder > 0x80u || (remainder == 0x80u && (mantissa & 1))) ++mantissa;
+	if (mantissa >> 23) {
+		mantissa = 0;
+		++scale;
+	}
+	v.u = ((uint32_t)sign << 31) | ((uint32_t)(scale + 127) << 23) | mantissa;
+	return v.f;
+}
+long double posit32_told(posit32_t p) {
+	return (long double)posit32_tod(p);
+}
+// the magnitude truncated toward zero, overflow is set when it does not fit 64 bits
+static inline uint64_t posit32_to_magnitude(uint32_t bits, bool* overflow) {
+	uint32_t significand;
+	int32_t scale = posit32_decode(bits, &significand);
+	*overflow = (scale >= 64);
+	if (scale < 0 || scale >= 64) return 0;
+	return (scale >= 31) ? ((uint64_t)significand << (scale - 31)) : (uint64_t)(significand >> (31 - scale));
+}
+// integer conversions truncate toward zero and saturate, NaR converts to the smallest value of the type
+long long posit32_tosll(posit32_t p) {
+	if (p.v == 0) return 0;
+	if (p.v == posit32_nar_bits) return LLONG_MIN;
+	bool sign = (bool)(p.v & posit32_sign_mask), overflow;
+	uint64_t magnitude = posit32_to_magnitude(sign ? 0u - p.v : p.v, &overflow);
+	if (sign) return (overflow || magnitude > (uint64_t)LLONG_MAX) ? LLONG_MIN : -(long long)magnitude;
+	return (overflow || magnitude > (uint64_t)LLONG_MAX) ? LLONG_MAX : (long long)magnitude;
+}
+long posit32_tosl(posit32_t p) {
+	long long i = posit32_tosll(p);
+	return (i < LONG_MIN) ? LONG_MIN : (i > LONG_MAX) ? LONG_MAX : (long)i;
+}
+int posit32_tosi(posit32_t p) {
+	long long i = posit32_tosll(p);
+	return (i < INT_MIN) ? INT_MIN : (i > INT_MAX) ? INT_MAX : (int)i;
+}
+unsigned long long posit32_toull(posit32_t p) {
+	if (p.v == 0 || (p.v & posit32_sign_mask)) return 0;  // zero, negative values, and NaR
+	bool overflow;
+	uint64_t magnitude = posit32_to_magnitude(p.v, &overflow);
+	return overflow ? ULLONG_MAX : magnitude;
+}
+unsigned long posit32_toul(posit32_t p) {
+	unsigned long long i = posit32_toull(p);
+	return (i > ULONG_MAX) ? ULONG_MAX : (unsigned long)i;
+}
+unsigned int posit32_toui(posit32_t p) {
+	unsigned long long i = posit32_toull(p);
+	return (i > UINT_MAX) ? UINT_MAX : (unsigned int)i;
+}
+
+// arithmetic operators
+posit32_t posit32_addp32(posit32_t lhs, posit32_t rhs) {
+	if (lhs.v == posit32_nar_bits || rhs.v == posit32_nar_bits) return posit32_make(posit32_nar_bits);
+	if (lhs.v == 0) return rhs;
+	if (rhs.v == 0) return lhs;
+	bool signA = (bool)(lhs.v & posit32_sign_mask), signB = (bool)(rhs.v & posit32_sign_mask);
+	uint32_t a = signA ? 0u - lhs.v : lhs.v, b = signB ? 0u - rhs.v : rhs.v;
+	if (a < b) {  // posit magnitudes are ordered like their encodings
+		uint32_t tmp = a; a = b; b = tmp;
+		bool s = signA; signA = signB; signB = s;
+	}
+	uint32_t significandA, significandB;
+	int32_t scaleA = posit32_decode(a, &significandA);
+	int32_t scaleB = posit32_decode(b, &significandB);
+	return posit32_round_sum(signA, scaleA, (uint64_t)significandA << 31, signB, scaleB, (uint64_t)significandB << 31);
+}
+posit32_t posit32_subp32(posit32_t lhs, posit32_t rhs) {
+	rhs.v = 0u - rhs.v;  // 0 and NaR are invariant under negation
+	return posit32_addp32(lhs, rhs);
+}
+posit32_t posit32_mulp32(posit32_t lhs, posit32_t rhs) {
+	if (lhs.v == posit32_nar_bits || rhs.v == posit32_nar_bits) return posit32_make(posit32_nar_bits);
+	if (lhs.v == 0 || rhs.v == 0) return posit32_make(0);
+	bool signA = (bool)(lhs.v & posit32_sign_mask), signB = (bool)(rhs.v & posit32_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scale = posit32_decode(signA ? 0u - lhs.v : lhs.v, &significandA);
+	scale += posit32_decode(signB ? 0u - rhs.v : rhs.v, &significandB);
+	uint64_t product = (uint64_t)significandA * significandB;  // 2.62, exact
+	if (product >> 63) ++scale; else product <<= 1;
+	return posit32_encode_signed(signA != signB, scale, product, false);
+}
+posit32_t posit32_divp32(posit32_t lhs, posit32_t rhs) {
+	if (lhs.v == posit32_nar_bits || rhs.v == posit32_nar_bits || rhs.v == 0) return posit32_make(posit32_nar_bits);
+	if (lhs.v == 0) return posit32_make(0);
+	bool signA = (bool)(lhs.v & posit32_sign_mask), signB = (bool)(rhs.v & posit32_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scale = posit32_decode(signA ? 0u - lhs.v : lhs.v, &significandA);
+	scale -= posit32_decode(signB ? 0u - rhs.v : rhs.v, &significandB);
+	uint64_t dividend = (uint64_t)significandA << 32;
+	uint64_t quotient = dividend / significandB;  // in (2^31, 2^33)
+	bool sticky = (dividend % significandB) != 0;
+	if (quotient >> 32) {
+		quotient <<= 31;
+	}
+	else {
+		--scale;
+		quotient <<= 32;
+	}
+	return posit32_encode_signed(signA != signB, scale, quotient, sticky);
+}
+// fused multiply-add: a * b + c with a single rounding
+posit32_t posit32_fma(posit32_t a, posit32_t b, posit32_t c) {
+	if (a.v == posit32_nar_bits || b.v == posit32_nar_bits || c.v == posit32_nar_bits) return posit32_make(posit32_nar_bits);
+	if (a.v == 0 || b.v == 0) return c;
+	bool signA = (bool)(a.v & posit32_sign_mask), signB = (bool)(b.v & posit32_sign_mask);
+	uint32_t significandA, significandB;
+	int32_t scaleP = posit32_decode(signA ? 0u - a.v : a.v, &significandA);
+	scaleP += posit32_decode(signB ? 0u - b.v : b.v, &significandB);
+	uint64_t product = (uint64_t)significandA * significandB;  // 2.62 with at most 56 significant bits
+	bool signP = (signA != signB);
+	if (product >> 63) {
+		product >>= 1;  // the low bits of the product are zero
+		++scaleP;
+	}
+	if (c.v == 0) return posit32_encode_signed(signP, scaleP, product << 1, false);
+	bool signC = (bool)(c.v & posit32_sign_mask);
+	uint32_t significandC;
+	int32_t scaleC = posit32_decode(signC ? 0u - c.v : c.v, &significandC);
+	uint64_t addend = (uint64_t)significandC << 31;
+	if (scaleP > scaleC || (scaleP == scaleC && product >= addend)) {
+		return posit32_round_sum(signP, scaleP, product, signC, scaleC, addend);
+	}
+	return posit32_round_sum(signC, scaleC, addend, signP, scaleP, product);
+}
+// floor of the square root of a 64-bit radicand, digit by digit
+static inline uint64_t posit32_isqrt(uint64_t radicand, bool* inexact) {
+	uint64_t root = 0, bit = UINT64_C(1) << 62;
+	while (bit != 0) {
+		if (radicand >= root + bit) {
+			radicand -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	*inexact = (radicand != 0);
+	return root;
+}
+posit32_t posit32_sqrt(posit32_t a) {
+	if (a.v == 0) return a;
+	if (a.v & posit32_sign_mask) return posit32_make(posit32_nar_bits);  // NaR and negative values
+	uint32_t significand;
+	int32_t scale = posit32_decode(a.v, &significand);
+	// the radicand x * 2^62 with x in [1, 4) after making the scale even
+	bool odd = (scale & 1) != 0;
+	uint64_t radicand = (uint64_t)significand << (odd ? 32 : 31);
+	if (odd) --scale;
+	bool inexact;
+	uint64_t root = posit32_isqrt(radicand, &inexact);  // in [2^31, 2^32)
+	return posit32_encode_signed(false, scale / 2, root << 32, inexact);
+}
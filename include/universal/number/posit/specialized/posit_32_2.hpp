@@ -13,6 +13,9 @@
 #define POSIT_FAST_POSIT_32_2 0
 #endif
 
+#include <bit>
+#include <universal/number/posit/specialized/constexpr_conversion.hpp>
+
 namespace sw::universal {
 
 // set the fast specialization variable to indicate that we are running a special template specialization
@@ -68,40 +71,40 @@ public:
 	explicit constexpr posit(short initial_value) : _bits(0) { *this = initial_value; }
 	explicit constexpr posit(int initial_value) : _bits(0) { *this = initial_value; }
 	explicit constexpr posit(long initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(long long initial_value) : _bits(0) { *this = initial_value; }
+	explicit constexpr posit(long long initial_value) : _bits(0) { *this = initial_value; }
 	explicit constexpr posit(char initial_value) : _bits(0) { *this = initial_value; }
 	explicit constexpr posit(unsigned short initial_value) : _bits(0) { *this = initial_value; }
 	explicit constexpr posit(unsigned int initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(unsigned long initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(unsigned long long initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(float initial_value) : _bits(0) { *this = initial_value; }
-	                   posit(double initial_value) : _bits(0) { *this = initial_value; }
-	explicit           posit(long double initial_value) : _bits(0) { *this = initial_value; }
+	explicit constexpr posit(unsigned long initial_value) : _bits(0) { *this = initial_value; }
+	explicit constexpr posit(unsigned long long initial_value) : _bits(0) { *this = initial_value; }
+	explicit constexpr posit(float initial_value) : _bits(0) { *this = initial_value; }
+	         constexpr posit(double initial_value) : _bits(0) { *this = initial_value; }
+	explicit constexpr posit(long double initial_value) : _bits(0) { *this = initial_value; }
 
 	// assignment operators for native types
 	constexpr posit& operator=(signed char rhs) { return integer_assign((long)(rhs)); }
 	constexpr posit& operator=(short rhs) { return integer_assign((long)(rhs)); }
 	constexpr posit& operator=(int rhs) { return integer_assign((long)(rhs)); }
 	constexpr posit& operator=(long rhs) { return integer_assign(rhs); }
-	posit& operator=(long long rhs) { return float_assign((long double)(rhs)); }
+	constexpr posit& operator=(long long rhs) { return float_assign((long double)(rhs)); }
 	constexpr posit& operator=(char rhs) { return integer_assign((long)(rhs)); }
 	constexpr posit& operator=(unsigned short rhs) { return integer_assign((long)(rhs)); }
 	constexpr posit& operator=(unsigned int rhs) { return integer_assign((long)(rhs)); }
-	          posit& operator=(unsigned long rhs) { return float_assign((long double)(rhs)); }
-	          posit& operator=(unsigned long long rhs) { return float_assign((long double)(rhs)); }
-	          posit& operator=(float rhs) { return float_assign((long double)rhs); }
-	          posit& operator=(double rhs) { return float_assign((long double)rhs); }
-	          posit& operator=(long double rhs) { return float_assign(rhs); }
-
-	explicit operator long double() const { return to_long_double(); }
-	explicit operator double() const { return to_double(); }
-	explicit operator float() const { return to_float(); }
-	explicit operator long long() const { return to_long_long(); }
-	explicit operator long() const { return to_long(); }
-	explicit operator int() const { return to_int(); }
-	explicit operator unsigned long long() const { return to_long_long(); }
-	explicit operator unsigned long() const { return to_long(); }
-	explicit operator unsigned int() const { return to_int(); }
+	constexpr posit& operator=(unsigned long rhs) { return float_assign((long double)(rhs)); }
+	constexpr posit& operator=(unsigned long long rhs) { return float_assign((long double)(rhs)); }
+	constexpr posit& operator=(float rhs) { return float_assign((long double)rhs); }
+	constexpr posit& operator=(double rhs) { return float_assign((long double)rhs); }
+	constexpr posit& operator=(long double rhs) { return float_assign(rhs); }
+
+	explicit constexpr operator long double() const { return to_long_double(); }
+	explicit constexpr operator double() const { return to_double(); }
+	explicit constexpr operator float() const { return to_float(); }
+	explicit constexpr operator long long() const { return to_long_long(); }
+	explicit constexpr operator long() const { return to_long(); }
+	explicit constexpr operator int() const { return to_int(); }
+	explicit constexpr operator unsigned long long() const { return to_long_long(); }
+	explicit constexpr operator unsigned long() const { return to_long(); }
+	explicit constexpr operator unsigned int() const { return to_int(); }
 
 	posit& setBitblock(const sw::universal::bitblock<NBITS_IS_32>& raw) {
 		_bits = uint32_t(raw.to_ulong());
@@ -111,12 +114,12 @@ public:
 		_bits = uint32_t(value & 0xFFFFFFFF);
 		return *this;
 	}
-	posit operator-() const {
+	constexpr posit operator-() const {
 		posit p;
 		return p.setbits((~_bits) + 1);
 	}
 	// arithmetic assignment operators
-	posit& operator+=(const posit& b) {
+	constexpr posit& operator+=(const posit& b) {
 		// special case handling of the inputs
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -178,10 +181,10 @@ public:
 		if (sign) _bits = -int32_t(_bits) & 0xFFFFFFFF;
 		return *this;
 	}
-	posit& operator+=(double rhs) {
+	constexpr posit& operator+=(double rhs) {
 		return *this += posit<nbits, es>(rhs);
 	}
-	posit& operator-=(const posit& b) {
+	constexpr posit& operator-=(const posit& b) {
 		// special case handling of the inputs
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -265,10 +268,10 @@ public:
 		if (sign) _bits = -int32_t(_bits) & 0xFFFFFFFF;
 		return *this;
 	}
-	posit& operator-=(double rhs) {
+	constexpr posit& operator-=(double rhs) {
 		return *this -= posit<nbits, es>(rhs);
 	}
-	posit& operator*=(const posit& b) {
+	constexpr posit& operator*=(const posit& b) {
 		// special case handling of the inputs
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (isnar() || b.isnar()) {
@@ -326,10 +329,10 @@ public:
 		if (sign) _bits = -int32_t(_bits) & 0xFFFFFFFF;
 		return *this;
 	}
-	posit& operator*=(double rhs) {
+	constexpr posit& operator*=(double rhs) {
 		return *this *= posit<nbits, es>(rhs);
 	}
-	posit& operator/=(const posit& b) {
+	constexpr posit& operator/=(const posit& b) {
 		// since we are encoding error conditions as NaR (Not a Real), we need to process that condition first
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
 		if (b.iszero()) {
@@ -378,9 +381,8 @@ public:
 		uint32_t rhs_fraction = ((remaining << 1) | 0x40000000) & 0x7FFFFFFF;
 
 		// execute the integer division of fractions
-		lldiv_t result = lldiv(lhs64, uint64_t(rhs_fraction));
-		uint64_t result_fraction = result.quot;
-		uint64_t remainder = result.rem;
+		uint64_t result_fraction = lhs64 / rhs_fraction;
+		uint64_t remainder = lhs64 % rhs_fraction;
 
 		// adjust exponent if underflowed
 		if (exp < 0) {
@@ -407,34 +409,34 @@ public:
 		if (sign) _bits = -int32_t(_bits) & 0xFFFFFFFF;
 		return *this;
 	}
-	posit& operator/=(double rhs) {
+	constexpr posit& operator/=(double rhs) {
 		return *this /= posit<nbits, es>(rhs);
 	}
 
 	// prefix/postfix operators
-	posit& operator++() {
+	constexpr posit& operator++() {
 		++_bits;
 		return *this;
 	}
-	posit operator++(int) {
+	constexpr posit operator++(int) {
 		posit tmp(*this);
 		operator++();
 		return tmp;
 	}
-	posit& operator--() {
+	constexpr posit& operator--() {
 		--_bits;
 		return *this;
 	}
-	posit operator--(int) {
+	constexpr posit operator--(int) {
 		posit tmp(*this);
 		operator--();
 		return tmp;
 	}
-	posit reciprocate() const {
+	constexpr posit reciprocate() const {
 		posit p = 1.0 / *this;
 		return p;
 	}
-	posit abs() const {
+	constexpr posit abs() const {
 		if (isneg()) {
 			return posit(-*this);
 		}
@@ -442,45 +444,45 @@ public:
 	}
 
 	// Modifiers
-	inline constexpr void clear() { _bits = 0x0; }
-	inline constexpr void setzero() { clear(); }
-	inline constexpr void setnar() { _bits = 0x80000000; }
-	inline posit& minpos() {
+	constexpr void clear() { _bits = 0x0; }
+	constexpr void setzero() { clear(); }
+	constexpr void setnar() { _bits = 0x80000000; }
+	constexpr posit& minpos() {
 		clear();
 		return ++(*this);
 	}
-	inline posit& maxpos() {
+	constexpr posit& maxpos() {
 		setnar();
 		return --(*this);
 	}
-	inline posit& zero() {
+	constexpr posit& zero() {
 		clear();
 		return *this;
 	}
-	inline posit& minneg() {
+	constexpr posit& minneg() {
 		clear();
 		return --(*this);
 	}
-	inline posit& maxneg() {
+	constexpr posit& maxneg() {
 		setnar();
 		return ++(*this);
 	}
 
 	// Selectors
-	inline constexpr bool sign() const       { return (_bits & 0x80000000u); }
-	inline constexpr bool isnar() const      { return (_bits == 0x80000000u); }
-	inline constexpr bool iszero() const     { return (_bits == 0x0); }
-	inline constexpr bool isone() const      { return (_bits == 0x40000000u); } // pattern 010000...
-	inline constexpr bool isminusone() const { return (_bits == 0xC0000000u); } // pattern 110000...
-	inline constexpr bool isneg() const      { return (_bits & 0x80000000u); }
-	inline constexpr bool ispos() const      { return !isneg(); }
-	inline constexpr bool ispowerof2() const { return !(_bits & 0x1); }
+	constexpr bool sign() const       { return (_bits & 0x80000000u); }
+	constexpr bool isnar() const      { return (_bits == 0x80000000u); }
+	constexpr bool iszero() const     { return (_bits == 0x0); }
+	constexpr bool isone() const      { return (_bits == 0x40000000u); } // pattern 010000...
+	constexpr bool isminusone() const { return (_bits == 0xC0000000u); } // pattern 110000...
+	constexpr bool isneg() const      { return (_bits & 0x80000000u); }
+	constexpr bool ispos() const      { return !isneg(); }
+	constexpr bool ispowerof2() const { return !(_bits & 0x1); }
 
-	inline int sign_value() const { return (_bits & 0x8) ? -1 : 1; }
+	constexpr int sign_value() const { return (_bits & 0x8) ? -1 : 1; }
 
 	bitblock<NBITS_IS_32> get() const { bitblock<NBITS_IS_32> bb; bb = long(_bits); return bb; }
-	unsigned long long encoding() const { return (unsigned long long)(_bits); }
-	inline posit twosComplement() const {
+	constexpr unsigned long long encoding() const { return (unsigned long long)(_bits); }
+	constexpr posit twosComplement() const {
 		posit p;
 		return p.setbits((~_bits) + 1);
 	}
@@ -523,82 +525,46 @@ private:
 
 	// Conversion functions
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
-	int         to_int() const {
+	constexpr int         to_int() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return int(to_float());
 	}
-	long        to_long() const {
+	constexpr long        to_long() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return long(to_double());
 	}
-	long long   to_long_long() const {
+	constexpr long long   to_long_long() const {
 		if (iszero()) return 0;
 		if (isnar()) throw not_a_real{};
 		return long(to_long_double());
 	}
 #else
-	int         to_int() const {
+	constexpr int         to_int() const {
 		if (iszero()) return 0;
 		if (isnar())  return int(INFINITY);
 		return int(to_float());
 	}
-	long        to_long() const {
+	constexpr long        to_long() const {
 		if (iszero()) return 0;
 		if (isnar())  return long(INFINITY);
 		return long(to_double());
 	}
-	long long   to_long_long() const {
+	constexpr long long   to_long_long() const {
 		if (iszero()) return 0;
 		if (isnar())  return (long long)(INFINITY);
 		return long(to_long_double());
 	}
 #endif
-	float       to_float() const {
+	constexpr float       to_float() const {
 		return (float)to_double();
 	}
-	double      to_double() const {
-		if (iszero())	return 0.0;
-		if (isnar())	return NAN;
-		bool		     	 _sign;
-		regime<nbits, es>    _regime;
-		exponent<nbits, es>  _exponent;
-		fraction<fbits>      _fraction;
-		bitblock<nbits>		 _raw_bits;
-		_raw_bits.reset();
-		uint64_t mask = 1;
-		for (size_t i = 0; i < nbits; i++) {
-			_raw_bits.set(i, (_bits & mask));
-			mask <<= 1;
-		}
-		decode(_raw_bits, _sign, _regime, _exponent, _fraction);
-		double s = (_sign ? -1.0 : 1.0);
-		double r = _regime.value();
-		double e = _exponent.value();
-		double f = (1.0 + _fraction.value());
-		return s * r * e * f;
-	}
-	long double to_long_double() const {
-		if (iszero())  return 0.0;
-		if (isnar())   return NAN;
-		bool		     	 _sign;
-		regime<nbits, es>    _regime;
-		exponent<nbits, es>  _exponent;
-		fraction<fbits>      _fraction;
-		bitblock<nbits>		 _raw_bits;
-		_raw_bits.reset();
-		uint64_t mask = 1;
-		for (size_t i = 0; i < nbits; i++) {
-			_raw_bits.set(i, (_bits & mask));
-			mask <<= 1;
-		}
-		decode(_raw_bits, _sign, _regime, _exponent, _fraction);
-		long double s = (_sign ? -1.0 : 1.0);
-		long double r = _regime.value();
-		long double e = _exponent.value();
-		long double f = (1.0 + _fraction.value());
-		return s * r * e * f;
+	constexpr double      to_double() const {
+		return posit_to_native<NBITS_IS_32, ES_IS_2, double>(_bits);
+	}
+	constexpr long double to_long_double() const {
+		return posit_to_native<NBITS_IS_32, ES_IS_2, long double>(_bits);
 	}
 
 	// helper methods
@@ -641,27 +607,13 @@ private:
 		_bits = sign ? -raw : raw;
 		return *this;
 	}
-	posit& float_assign(long double rhs) {
-		constexpr int dfbits = std::numeric_limits<long double>::digits - 1;
-		internal::value<dfbits> v(rhs);
-		// special case processing
-		if (v.iszero()) {
-			setzero();
-			return *this;
-		}
-		if (v.isinf() || v.isnan()) {  // posit encode for FP_INFINITE and NaN as NaR (Not a Real)
-			setnar();
-			return *this;
-		}
-
-		internal::bitblock<NBITS_IS_32> ptt;
-		convert_to_bb<NBITS_IS_32, ES_IS_2, dfbits>(v.sign(), v.scale(), v.fraction(), ptt); // TODO: needs to be faster
-		_bits = uint32_t(ptt.to_ulong());
+	constexpr posit& float_assign(long double rhs) {
+		_bits = uint32_t(native_to_posit<NBITS_IS_32, ES_IS_2>(rhs));
 		return *this;
 	}
 
 	// decode_regime takes the raw bits of the posit, and returns the regime run-length, m, and the remaining fraction bits in remainder
-	inline void decode_regime(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
+	constexpr void decode_regime(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFFFFFF;
 		if (bits & 0x40000000) {  // positive regimes
 			while (remaining >> 31) {
@@ -678,7 +630,7 @@ private:
 			remaining &= 0x7FFFFFFF;
 		}
 	}
-	inline void extractAddand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
+	constexpr void extractAddand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFFFFFF;
 		if (bits & 0x40000000) {  // positive regimes
 			while (remaining >> 31) {
@@ -695,7 +647,7 @@ private:
 			remaining &= 0x7FFFFFFF;
 		}
 	}
-	inline void extractMultiplicand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
+	constexpr void extractMultiplicand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFFFFFF;
 		if (bits & 0x40000000) {  // positive regimes
 			while (remaining >> 31) {
@@ -712,7 +664,7 @@ private:
 			remaining &= 0x7FFFFFFF;
 		}
 	}
-	inline void extractDividand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
+	constexpr void extractDividand(const uint32_t bits, int32_t& m, uint32_t& remaining) const {
 		remaining = (bits << 2) & 0xFFFFFFFF;
 		if (bits & 0x40000000) {  // positive regimes
 			while (remaining >> 31) {
@@ -730,7 +682,7 @@ private:
 		}
 	}
 
-	inline uint32_t round(const int8_t m, uint32_t exp, uint64_t fraction) const {
+	constexpr uint32_t round(const int8_t m, uint32_t exp, uint64_t fraction) const {
 		uint32_t scale, regime, bits;
 		if (m < 0) {
 			scale = -m;
@@ -775,7 +727,7 @@ private:
 		}
 		return bits;
 	}
-	inline uint32_t round_mul(const int8_t m, uint32_t exp, uint64_t fraction) const {
+	constexpr uint32_t round_mul(const int8_t m, uint32_t exp, uint64_t fraction) const {
 		uint32_t scale, regime, bits;
 		if (m < 0) {
 			scale = -m;
@@ -834,7 +786,7 @@ private:
 		}
 		return bits;
 	}
-	inline uint32_t adjustAndRound(const int8_t k, uint32_t exp, uint64_t frac64, bool nonZeroRemainder) const {
+	constexpr uint32_t adjustAndRound(const int8_t k, uint32_t exp, uint64_t frac64, bool nonZeroRemainder) const {
 		uint32_t scale, regime, bits;
 		if (k < 0) {
 			scale = -k;
@@ -898,12 +850,12 @@ private:
 	friend std::istream& operator>> (std::istream& istr, posit<NBITS_IS_32, ES_IS_2>& p);
 
 	// posit - posit logic functions
-	friend bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
-	friend bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
-	friend bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
-	friend bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
-	friend bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
-	friend bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
+	friend constexpr bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs);
 
 };
 
@@ -947,22 +899,22 @@ inline std::string to_string(const posit<NBITS_IS_32, ES_IS_2>& p, std::streamsi
 }
 
 // posit - posit binary logic operators
-inline bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return lhs._bits == rhs._bits;
 }
-inline bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return !operator==(lhs, rhs);
 }
-inline bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return int32_t(lhs._bits) < int32_t(rhs._bits);
 }
-inline bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return operator< (rhs, lhs);
 }
-inline bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return operator< (lhs, rhs) || operator==(lhs, rhs);
 }
-inline bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return !operator< (lhs, rhs);
 }
 
@@ -975,47 +927,144 @@ inline bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS
 // posit - literal logic functions
 
 // posit - int logic operators
-inline bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator==(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return operator==(lhs, posit<NBITS_IS_32, ES_IS_2>(rhs));
 }
-inline bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator!=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return !operator==(lhs, posit<NBITS_IS_32, ES_IS_2>(rhs));
 }
-inline bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return operator<(lhs, posit<NBITS_IS_32, ES_IS_2>(rhs));
 }
-inline bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return operator< (posit<NBITS_IS_32, ES_IS_2>(rhs), lhs);
 }
-inline bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator<=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return operator< (lhs, posit<NBITS_IS_32, ES_IS_2>(rhs)) || operator==(lhs, posit<NBITS_IS_32, ES_IS_2>(rhs));
 }
-inline bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
+constexpr bool operator>=(const posit<NBITS_IS_32, ES_IS_2>& lhs, int rhs) {
 	return !operator<(lhs, posit<NBITS_IS_32, ES_IS_2>(rhs));
 }
 
 // int - posit logic operators
-inline bool operator==(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator==(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return posit<NBITS_IS_32, ES_IS_2>(lhs) == rhs;
 }
-inline bool operator!=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator!=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return !operator==(posit<NBITS_IS_32, ES_IS_2>(lhs), rhs);
 }
-inline bool operator< (int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator< (int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return operator<(posit<NBITS_IS_32, ES_IS_2>(lhs), rhs);
 }
-inline bool operator> (int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator> (int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return operator< (posit<NBITS_IS_32, ES_IS_2>(rhs), lhs);
 }
-inline bool operator<=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator<=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return operator< (posit<NBITS_IS_32, ES_IS_2>(lhs), rhs) || operator==(posit<NBITS_IS_32, ES_IS_2>(lhs), rhs);
 }
-inline bool operator>=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
+constexpr bool operator>=(int lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 	return !operator<(posit<NBITS_IS_32, ES_IS_2>(lhs), rhs);
 }
 
 #endif // POSIT_ENABLE_LITERALS
 
+// fused multiply-add: a * b + c with a single rounding
+// The operands are decoded into a scale and a significand in 1.31 format. The product of the
+// significands is exact in 64 bits, the addend is aligned to the larger of the two with the bits
+// shifted away folded into a sticky bit, and the sum is rounded once to the nearest posit.
+namespace internal {
+	// decode a positive posit<32,2> encoding into its scale and its significand in 1.31 format
+	inline constexpr int32_t decode_posit32(uint32_t bits, uint32_t& significand) {
+		uint32_t body = bits << 1;  // drop the sign bit
+		bool positiveRegime = (body & 0x8000'0000u);
+		int run = positiveRegime ? std::countl_one(body) : std::countl_zero(body);
+		int32_t k = positiveRegime ? run - 1 : -run;
+		uint32_t rest = (run < 31) ? (body << (run + 1)) : 0u;  // exponent and fraction bits
+		significand = 0x8000'0000u | ((rest << 2) >> 1);
+		return 4 * k + int32_t(rest >> 30);
+	}
+	// round 2^scale * significand, with the significand in 1.63 format, to a positive posit<32,2> encoding
+	inline constexpr uint32_t encode_posit32(int32_t scale, uint64_t significand, bool sticky) {
+		if (scale >= 120) return 0x7FFF'FFFFu;  // maxpos
+		if (scale < -120) return 0x1u;          // minpos
+		int32_t k = (scale >= 0) ? scale / 4 : -((3 - scale) / 4);
+		uint64_t exponent = uint64_t(scale - 4 * k);
+		int len = (k >= 0) ? k + 2 : 1 - k;  // the number of regime bits including the terminating bit
+		uint64_t regime = (k >= 0) ? (((1ull << (k + 1)) - 1ull) << 1) : 1ull;
+		// the 31 bits below the sign bit of the posit occupy bits 62..32 of the window
+		uint64_t fraction = significand << 1;  // drop the hidden bit
+		uint64_t window = (regime << (63 - len)) | (exponent << (61 - len)) | (fraction >> (len + 3));
+		sticky = sticky || (fraction & ((1ull << (len + 3)) - 1ull)) != 0 || (window & 0x7FFF'FFFFull) != 0;
+		uint32_t bits = uint32_t(window >> 32);
+		bool guard = (window >> 31) & 1;
+		if (guard && (sticky || (bits & 1))) ++bits;
+		return bits;
+	}
+	// round the sum of two magnitudes in 2.62 format with values in [1, 2), the first of which is the larger
+	inline constexpr uint32_t round_sum_posit32(bool signA, int32_t scaleA, uint64_t a, bool signB, int32_t scaleB, uint64_t b) {
+		int32_t shift = scaleA - scaleB;
+		bool sticky = false;
+		if (shift >= 64) {
+			sticky = true;
+			b = 0;
+		}
+		else if (shift > 0) {
+			sticky = (b << (64 - shift)) != 0;
+			b >>= shift;
+		}
+		uint64_t sum{ 0 };
+		if (signA == signB) {
+			sum = a + b;
+		}
+		else {
+			// the truncated bits of b make the exact difference a fraction of a unit smaller
+			sum = a - b - (sticky ? 1ull : 0ull);
+			if (sum == 0) return 0u;
+		}
+		int lz = std::countl_zero(sum);
+		uint32_t bits = encode_posit32(scaleA + 1 - lz, sum << lz, sticky);
+		return signA ? (0u - bits) : bits;
+	}
+}
+
+inline posit<NBITS_IS_32, ES_IS_2> fma(const posit<NBITS_IS_32, ES_IS_2>& a, const posit<NBITS_IS_32, ES_IS_2>& b, const posit<NBITS_IS_32, ES_IS_2>& c) {
+	posit<NBITS_IS_32, ES_IS_2> result;
+#if POSIT_THROW_ARITHMETIC_EXCEPTION
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		throw operand_is_nar{};
+	}
+#else
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		result.setnar();
+		return result;
+	}
+#endif // POSIT_THROW_ARITHMETIC_EXCEPTION
+	if (a.iszero() || b.iszero()) return c;
+	uint32_t aBits = uint32_t(a.encoding()), bBits = uint32_t(b.encoding()), cBits = uint32_t(c.encoding());
+	bool signA = a.sign(), signB = b.sign();
+	uint32_t significandA{ 0 }, significandB{ 0 };
+	int32_t scaleP = internal::decode_posit32(signA ? (0u - aBits) : aBits, significandA);
+	scaleP += internal::decode_posit32(signB ? (0u - bBits) : bBits, significandB);
+	uint64_t product = uint64_t(significandA) * significandB;  // 2.62 with at most 56 significant bits
+	bool signP = (signA != signB);
+	if (product >> 63) {
+		product >>= 1;  // the low bits of the product are zero
+		++scaleP;
+	}
+	if (c.iszero()) {
+		uint32_t bits = internal::encode_posit32(scaleP, product << 1, false);
+		return result.setbits(signP ? (0u - bits) : bits);
+	}
+	bool signC = c.sign();
+	uint32_t significandC{ 0 };
+	int32_t scaleC = internal::decode_posit32(signC ? (0u - cBits) : cBits, significandC);
+	uint64_t addend = uint64_t(significandC) << 31;
+	if (scaleP > scaleC || (scaleP == scaleC && product >= addend)) {
+		return result.setbits(internal::round_sum_posit32(signP, scaleP, product, signC, scaleC, addend));
+	}
+	return result.setbits(internal::round_sum_posit32(signC, scaleC, addend, signP, scaleP, product));
+}
+
 #endif // POSIT_FAST_POSIT_32_2
 
 } // namespace sw::universal
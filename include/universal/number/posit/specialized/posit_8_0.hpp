@@ -13,6 +13,8 @@
 #define POSIT_FAST_POSIT_8_0 0
 #endif
 
+#include <universal/number/posit/specialized/constexpr_conversion.hpp>
+
 namespace sw::universal {
 
 // set the fast specialization variable to indicate that we are running a special template specialization
@@ -76,9 +78,9 @@ namespace sw::universal {
 		constexpr explicit posit(unsigned int initial_value) : _bits(0)       { *this = initial_value; }
 		constexpr explicit posit(unsigned long initial_value) : _bits(0)      { *this = initial_value; }
 		constexpr explicit posit(unsigned long long initial_value) : _bits(0) { *this = initial_value; }
-		          explicit posit(float initial_value) : _bits(0)              { *this = initial_value; }
-		                   posit(double initial_value) : _bits(0)             { *this = initial_value; }
-		          explicit posit(long double initial_value) : _bits(0)        { *this = initial_value; }
+		constexpr explicit posit(float initial_value) : _bits(0)              { *this = initial_value; }
+		constexpr          posit(double initial_value) : _bits(0)             { *this = initial_value; }
+		constexpr explicit posit(long double initial_value) : _bits(0)        { *this = initial_value; }
 
 		// assignment operators for native types
 		constexpr posit& operator=(signed char rhs)             { return operator=((int)(rhs)); }
@@ -91,19 +93,19 @@ namespace sw::universal {
 		constexpr posit& operator=(unsigned int rhs)            { return operator=((int)(rhs)); }
 		constexpr posit& operator=(unsigned long rhs)           { return operator=((int)(rhs)); }
 		constexpr posit& operator=(unsigned long long rhs)      { return operator=((int)(rhs)); }
-		          posit& operator=(float rhs)                   { return float_assign(rhs); }
-				  posit& operator=(double rhs)                  { return float_assign(float(rhs)); }
-				  posit& operator=(long double rhs)             { return float_assign(float(rhs)); }
-
-		explicit operator long double() const { return to_long_double(); }
-		explicit operator double() const { return to_double(); }
-		explicit operator float() const { return to_float(); }
-		explicit operator long long() const { return to_long_long(); }
-		explicit operator long() const { return to_long(); }
-		explicit operator int() const { return to_int(); }
-		explicit operator unsigned long long() const { return to_long_long(); }
-		explicit operator unsigned long() const { return to_long(); }
-		explicit operator unsigned int() const { return to_int(); }
+		constexpr posit& operator=(float rhs)                   { return float_assign(double(rhs)); }
+		constexpr posit& operator=(double rhs)                  { return float_assign(rhs); }
+		constexpr posit& operator=(long double rhs)             { return float_assign(double(rhs)); }
+
+		explicit constexpr operator long double() const { return to_long_double(); }
+		explicit constexpr operator double() const { return to_double(); }
+		explicit constexpr operator float() const { return to_float(); }
+		explicit constexpr operator long long() const { return to_long_long(); }
+		explicit constexpr operator long() const { return to_long(); }
+		explicit constexpr operator int() const { return to_int(); }
+		explicit constexpr operator unsigned long long() const { return to_long_long(); }
+		explicit constexpr operator unsigned long() const { return to_long(); }
+		explicit constexpr operator unsigned int() const { return to_int(); }
 
 		posit& setBitblock(const sw::universal::bitblock<NBITS_IS_8>& raw) {
 			_bits = uint8_t(raw.to_ulong());
@@ -118,60 +120,115 @@ namespace sw::universal {
 			return p.setbits((~_bits) + 1);
 		}
 		// arithmetic assignment operators
-		posit& operator+=(const posit& b) {
-			posit8_t lhs = { { _bits } };
-			posit8_t rhs = { { b._bits} };
-			posit8_t add = posit8_addp8(lhs, rhs);
-			_bits = add.v;
+		constexpr posit& operator+=(const posit& b) {
+			_bits = ((_bits ^ b._bits) & sign_mask) ? subMagnitude(_bits, b._bits) : addMagnitude(_bits, b._bits);
 			return *this;
 		}
-		posit& operator-=(const posit& b) {
-			posit8_t lhs = { { _bits } };
-			posit8_t rhs = { { b._bits } };
-			posit8_t sub = posit8_subp8(lhs, rhs);
-			_bits = sub.v;
+		constexpr posit& operator-=(const posit& b) {
+			uint8_t rhs = uint8_t(-b._bits);
+			_bits = ((_bits ^ b._bits) & sign_mask) ? addMagnitude(_bits, rhs) : subMagnitude(_bits, rhs);
 			return *this;
 		}
-		posit& operator*=(const posit& b) {
-			posit8_t lhs = { { _bits } };
-			posit8_t rhs = { { b._bits } };
-			posit8_t mul = posit8_mulp8(lhs, rhs);
-			_bits = mul.v;
+		constexpr posit& operator*=(const posit& b) {
+			// process special cases
+			if (isnar() || b.isnar()) {
+				setnar();
+				return *this;
+			}
+			if (iszero() || b.iszero()) {
+				_bits = 0;
+				return *this;
+			}
+
+			// calculate the sign of the result
+			bool sign = bool(_bits & sign_mask) ^ bool(b._bits & sign_mask);
+			uint8_t lhs = (_bits & sign_mask) ? uint8_t(-_bits) : _bits;
+			uint8_t rhs = (b._bits & sign_mask) ? uint8_t(-b._bits) : b._bits;
+
+			// decode the regimes and extract the fractions of the operands
+			uint8_t remaining = 0;
+			int8_t mA = decode_regime(lhs, remaining);
+			uint16_t lhs_fraction = (0x80 | remaining);
+			int8_t mB = decode_regime(rhs, remaining);
+			uint16_t rhs_fraction = (0x80 | remaining);
+			uint16_t result_fraction = uint16_t(lhs_fraction * rhs_fraction);
+			int8_t scale = int8_t(mA + mB);
+
+			bool rcarry = bool(result_fraction & 0x8000);
+			if (rcarry) {
+				scale++;
+				result_fraction >>= 1;
+			}
+
+			// round
+			uint8_t raw = round(scale, result_fraction);
+			_bits = (sign ? uint8_t(-raw) : raw);
 			return *this;
 		}
-		posit& operator/=(const posit& b) {
-			posit8_t lhs = { { _bits } };
-			posit8_t rhs = { { b._bits } };
-			posit8_t div = posit8_divp8(lhs, rhs);
-			_bits = div.v;
+		constexpr posit& operator/=(const posit& b) {
+			// process special cases
+			if (isnar() || b.isnar() || b.iszero()) {
+				setnar();
+				return *this;
+			}
+			if (iszero()) {
+				return *this;
+			}
+
+			// calculate the sign of the result
+			bool sign = bool(_bits & sign_mask) ^ bool(b._bits & sign_mask);
+			uint8_t lhs = (_bits & sign_mask) ? uint8_t(-_bits) : _bits;
+			uint8_t rhs = (b._bits & sign_mask) ? uint8_t(-b._bits) : b._bits;
+
+			// decode the regimes and extract the fractions of the operands
+			uint8_t remaining = 0;
+			int8_t mA = decode_regime(lhs, remaining);
+			uint16_t lhs_fraction = uint16_t((0x80 | remaining) << 7);
+			int8_t mB = decode_regime(rhs, remaining);
+			uint16_t rhs_fraction = (0x80 | remaining);
+			uint16_t result_fraction = uint16_t(lhs_fraction / rhs_fraction);
+			uint16_t remainder = uint16_t(lhs_fraction % rhs_fraction);
+			int8_t scale = int8_t(mA - mB);
+
+			if (result_fraction != 0) {
+				bool rcarry = result_fraction >> 7; // this is the hidden bit (7th bit), extreme right bit is bit 0
+				if (!rcarry) {
+					--scale;
+					result_fraction <<= 1;
+				}
+			}
+
+			// round
+			uint8_t raw = roundDiv(scale, result_fraction, remainder != 0);
+			_bits = (sign ? uint8_t(-raw) : raw);
 			return *this;
 		}
 				
 		// prefix/postfix operators
-		posit& operator++() {
+		constexpr posit& operator++() {
 			++_bits;
 			return *this;
 		}
-		posit operator++(int) {
+		constexpr posit operator++(int) {
 			posit tmp(*this);
 			operator++();
 			return tmp;
 		}
-		posit& operator--() {
+		constexpr posit& operator--() {
 			--_bits;
 			return *this;
 		}
-		posit operator--(int) {
+		constexpr posit operator--(int) {
 			posit tmp(*this);
 			operator--();
 			return tmp;
 		}
 		
-		posit reciprocate() const {
+		constexpr posit reciprocate() const {
 			posit p = 1.0 / *this;
 			return p;
 		}
-		posit abs() const {
+		constexpr posit abs() const {
 			if (isneg()) {
 				return posit(-*this);
 			}
@@ -179,48 +236,47 @@ namespace sw::universal {
 		}
 		
 		// Selelctors
-		inline bool sign() const       { return (_bits & sign_mask); }
-		inline bool isnar() const      { return (_bits == sign_mask); }
-		inline bool iszero() const     { return (_bits == 0x00); }
-		inline bool isone() const      { return (_bits == 0x40); } // pattern 010000...
-		inline bool isminusone() const { return (_bits == 0xC0); } // pattern 110000...
-		inline bool isneg() const      { return (_bits & sign_mask); }
-		inline bool ispos() const      { return !isneg(); }
-		inline bool ispowerof2() const { return !(_bits & 0x1); }
+		constexpr bool sign() const       { return (_bits & sign_mask); }
+		constexpr bool isnar() const      { return (_bits == sign_mask); }
+		constexpr bool iszero() const     { return (_bits == 0x00); }
+		constexpr bool isone() const      { return (_bits == 0x40); } // pattern 010000...
+		constexpr bool isminusone() const { return (_bits == 0xC0); } // pattern 110000...
+		constexpr bool isneg() const      { return (_bits & sign_mask); }
+		constexpr bool ispos() const      { return !isneg(); }
+		constexpr bool ispowerof2() const { return !(_bits & 0x1); }
 
-		inline int sign_value() const  { return (_bits & 0x80 ? -1 : 1); }
+		constexpr int sign_value() const  { return (_bits & 0x80 ? -1 : 1); }
 
 		bitblock<NBITS_IS_8> get() const { bitblock<NBITS_IS_8> bb; bb = int(_bits); return bb; }
-		unsigned long long encoding() const { return (unsigned long long)(_bits); }
+		constexpr unsigned long long encoding() const { return (unsigned long long)(_bits); }
 
 		// Modifiers
-		inline void clear() { _bits = 0; }
-		inline void setzero() { clear(); }
-		inline void setnar() { _bits = 0x80; }
-		inline posit& minpos() {
+		constexpr void clear() { _bits = 0; }
+		constexpr void setzero() { clear(); }
+		constexpr void setnar() { _bits = 0x80; }
+		constexpr posit& minpos() {
 			clear();
 			return ++(*this);
 		}
-		inline posit& maxpos() {
+		constexpr posit& maxpos() {
 			setnar();
 			return --(*this);
 		}
-		inline posit& zero() {
+		constexpr posit& zero() {
 			clear();
 			return *this;
 		}
-		inline posit& minneg() {
+		constexpr posit& minneg() {
 			clear();
 			return --(*this);
 		}
-		inline posit& maxneg() {
+		constexpr posit& maxneg() {
 			setnar();
 			return ++(*this);
 		}
-		inline posit twosComplement() const {
+		constexpr posit twosComplement() const {
 			posit<NBITS_IS_8, ES_IS_0> p;
-			int8_t v = -*(int8_t*)&_bits;
-			p.setbits(v);
+			p.setbits(uint8_t(-_bits));
 			return p;
 		}
 	private:
@@ -228,50 +284,48 @@ namespace sw::universal {
 
 		// Conversion functions
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
-		int         to_int() const {
+		constexpr int         to_int() const {
 			if (iszero()) return 0;
 			if (isnar()) throw not_a_real{};
 			return int(to_float());
 		}
-		long        to_long() const {
+		constexpr long        to_long() const {
 			if (iszero()) return 0;
 			if (isnar()) throw not_a_real{};
 			return long(to_double());
 		}
-		long long   to_long_long() const {
+		constexpr long long   to_long_long() const {
 			if (iszero()) return 0;
 			if (isnar()) throw not_a_real{};
 			return long(to_long_double());
 		}
 #else
-		int         to_int() const {
+		constexpr int         to_int() const {
 			if (iszero()) return 0;
 			if (isnar())  return int(INFINITY);
 			return int(to_float());
 		}
-		long        to_long() const {
+		constexpr long        to_long() const {
 			if (iszero()) return 0;
 			if (isnar())  return long(INFINITY);
 			return long(to_double());
 		}
-		long long   to_long_long() const {
+		constexpr long long   to_long_long() const {
 			if (iszero()) return 0;
 			if (isnar())  return (long long)(INFINITY);
 			return long(to_long_double());
 		}
 #endif
-		float       to_float() const {
-			posit8_t p = { { _bits } };
-			return posit8_tof(p);
+		constexpr float       to_float() const {
+			return posit_to_native<NBITS_IS_8, ES_IS_0, float>(_bits);
 		}
-		double      to_double() const {
-			return (double)to_float();
+		constexpr double      to_double() const {
+			return posit_to_native<NBITS_IS_8, ES_IS_0, double>(_bits);
 		}
-		long double to_long_double() const {
-			return (long double)to_float();
+		constexpr long double to_long_double() const {
+			return posit_to_native<NBITS_IS_8, ES_IS_0, long double>(_bits);
 		}
 
-
 		// helper methods			
 		constexpr posit& integer_assign(int rhs) {
 			// special case for speed as this is a common initialization
@@ -308,95 +362,169 @@ namespace sw::universal {
 			_bits = sign ? -raw : raw;
 			return *this;
 		}
-		posit& float_assign(float rhs) {
-			bool sign = false;
-			bool bitNPlusOne = 0, bitsMore = 0;
-			constexpr float _minpos = 0.015625f;
-			constexpr float _maxpos = 64.0f;
-
-			sign = (rhs < 0.0) ? true : false;
+		constexpr posit& float_assign(double rhs) {
+			_bits = uint8_t(native_to_posit<NBITS_IS_8, ES_IS_0>(rhs));
+			return *this;
+		}
 
-			constexpr int spfbits = std::numeric_limits<float>::digits - 1;
-			internal::value<spfbits> v(rhs);
-			if (v.isinf() || v.isnan()) {
-				_bits = 0x80;
+		// decode_regime takes the raw bits of a positive posit, and returns the regime, m, and the fraction bits in remaining
+		constexpr int8_t decode_regime(const uint8_t bits, uint8_t& remaining) const {
+			int8_t m = 0;
+			remaining = (bits << 2) & 0xFF;
+			if (bits & 0x40) {  // positive regimes
+				while (remaining >> 7) {
+					++m;
+					remaining = (remaining << 1) & 0xFF;
+				}
 			}
-			else if (rhs == 0) {
-				_bits = 0;
+			else {              // negative regimes
+				m = -1;
+				while (!(remaining >> 7)) {
+					--m;
+					remaining = (remaining << 1) & 0xFF;
+				}
+				remaining &= 0x7F;
 			}
-			else if (rhs == 1.0f) {
-				_bits = 0x40;
+			return m;
+		}
+		constexpr uint8_t round(const int8_t m, uint16_t fraction) const {
+			uint8_t scale{ 0 }, regime{ 0 }, bits{ 0 };
+			if (m < 0) {
+				scale = uint8_t(-m & 0xFF);
+				regime = 0x40 >> scale;
 			}
-			else if (rhs == -1.0f) {
-				_bits = 0xC0;
+			else {
+				scale = uint8_t(m + 1);
+				regime = uint8_t(0x7F - (0x7F >> scale));
 			}
-			else if (rhs >= _maxpos) {
-				_bits = 0x7F;
+
+			if (scale > 6) {
+				bits = m < 0 ? 0x1 : 0x7F;  // minpos and maxpos
 			}
-			else if (rhs <= -_maxpos) {
-				_bits = 0x81;
+			else {
+				fraction = (fraction & 0x3FFF) >> scale;
+				uint8_t final_fbits = uint8_t(fraction >> 8);
+				bool bitNPlusOne = bool(0x80 & fraction);
+				bits = uint8_t(regime + final_fbits);
+				// n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
+				if (bitNPlusOne) {
+					uint8_t moreBits = (0x7F & fraction) ? 0x01 : 0x00;
+					bits += (bits & 0x01) | moreBits;
+				}
 			}
-			else if (rhs <= _minpos && !sign) {
-				_bits = 0x01;
+			return bits;
+		}
+		constexpr uint8_t roundDiv(const int8_t m, uint16_t fraction, bool nonZeroRemainder) const {
+			uint8_t scale{ 0 }, regime{ 0 }, bits{ 0 };
+			if (m < 0) {
+				scale = uint8_t(-m & 0xFF);
+				regime = 0x40 >> scale;
 			}
-			else if (rhs >= -_minpos && sign) {
-				_bits = 0xFF;
+			else {
+				scale = uint8_t(m + 1);
+				regime = uint8_t(0x7F - (0x7F >> scale));
 			}
-			else if (rhs < -1 || rhs > 1) {
-				if (sign) {
-					rhs = -rhs; // project to positive reals to simplify computation
-				}
 
-				if (rhs <= _minpos) {
-					_bits = 0x01;
-				}
-				else { // determine the regime	
-					unsigned k = 1; //because k = m-1, we need to add back 1
-					while (rhs >= 2) {
-						rhs *= 0.5;
-						k++;
-					}
-
-					// rounding off regime bits
-					if (k > 6) {
-						_bits = 0x7F;
-					}
-					else {
-						int8_t fracLength = 6 - k;
-						uint8_t frac = (uint8_t)posit8_convertFraction(rhs, fracLength, &bitNPlusOne, &bitsMore);
-						uint_fast8_t regime = 0x7F - (0x7F >> k);
-						_bits = (regime + frac);
-						if (bitNPlusOne) _bits += ((_bits & 0x01) | bitsMore);
-					}
-					_bits = sign ? -_bits : _bits;
-				}
+			if (scale > 6) {
+				bits = m < 0 ? 0x1 : 0x7F;  // minpos and maxpos
 			}
-			else if (rhs > -1 && rhs < 1) {
-				if (sign) {
-					rhs = -rhs;
-				}
-				unsigned k = 0;
-				while (rhs < 1) {
-					rhs *= 2;
-					k++;
-				}
-				// rounding off regime bits
-				if (k > 6)
-					_bits = 0x1;
-				else {
-					int8_t fracLength = 6 - k;
-					uint8_t frac = (uint8_t)posit8_convertFraction(rhs, fracLength, &bitNPlusOne, &bitsMore);
-					uint8_t regime = 0x40 >> k;
-					_bits = (regime + frac);
-					if (bitNPlusOne) _bits += ((_bits & 0x01) | bitsMore);
+			else {
+				// remove carry and rcarry bits and shift to correct position
+				fraction &= 0x7F;
+				uint8_t final_fbits = uint8_t(fraction >> (scale + 1));
+				bool bitNPlusOne = bool(0x1 & (fraction >> scale));
+				bits = uint8_t(regime + final_fbits);
+				if (bitNPlusOne) {
+					uint8_t moreBits = (((1 << scale) - 1) & fraction) ? 0x01 : 0x00;
+					if (nonZeroRemainder) moreBits = 0x01;
+					// n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
+					bits += (bits & 0x01) | moreBits;
 				}
-				_bits = sign ? -_bits : _bits;
+			}
+			return bits;
+		}
+		constexpr uint8_t addMagnitude(uint8_t lhs, uint8_t rhs) const {
+			// process special cases
+			if (lhs == sign_mask || rhs == sign_mask) return sign_mask;   // NaR
+			if (lhs == 0 || rhs == 0) return uint8_t(lhs | rhs);          // zero
+			bool sign = bool(lhs & sign_mask);
+			if (sign) {
+				lhs = uint8_t(-lhs);
+				rhs = uint8_t(-rhs);
+			}
+			if (lhs < rhs) std::swap(lhs, rhs);
+
+			// decode the regimes and extract the fractions of the operands
+			uint8_t remaining = 0;
+			int8_t mA = decode_regime(lhs, remaining);
+			uint16_t lhs_fraction = uint16_t((0x80 | remaining) << 7);
+			int8_t mB = decode_regime(rhs, remaining);
+			uint16_t rhs_fraction = uint16_t((0x80 | remaining) << 7);
+			int8_t shiftRight = int8_t(mA - mB); // calculate the shift to normalize the fractions
+
+			if (shiftRight > 7) {  // catastrophic cancellation case
+				rhs_fraction = 0;
 			}
 			else {
-				//NaR - for NaN, INF and all other combinations
-				_bits = 0x80;
+				rhs_fraction >>= shiftRight; // align the rhs fraction
 			}
-			return *this;
+			uint16_t result_fraction = uint16_t(lhs_fraction + rhs_fraction); // add
+
+			bool rcarry = bool(0x8000 & result_fraction); // is MSB set
+			if (rcarry) {
+				mA++;
+				result_fraction >>= 1;
+			}
+
+			uint8_t raw = round(mA, result_fraction);
+			return (sign ? uint8_t(-raw) : raw);
+		}
+		constexpr uint8_t subMagnitude(uint8_t lhs, uint8_t rhs) const {
+			// process special cases
+			if (lhs == sign_mask || rhs == sign_mask) return sign_mask;   // NaR
+			if (lhs == 0 || rhs == 0) return uint8_t(lhs | rhs);          // zero
+
+			// Both operands are actually the same sign if rhs inherits sign of sub: Make both positive
+			bool sign = bool(lhs & sign_mask);
+			if (sign) {
+				lhs = uint8_t(-lhs);
+			}
+			else {
+				rhs = uint8_t(-rhs);
+			}
+
+			if (lhs == rhs) return 0;
+			if (lhs < rhs) {
+				std::swap(lhs, rhs);
+				sign = !sign;
+			}
+
+			// decode the regimes and extract the fractions of the operands
+			uint8_t remaining = 0;
+			int8_t mA = decode_regime(lhs, remaining);
+			uint16_t lhs_fraction = uint16_t((0x80 | remaining) << 7);
+			int8_t mB = decode_regime(rhs, remaining);
+			uint16_t rhs_fraction = uint16_t((0x80 | remaining) << 7);
+			int8_t shiftRight = int8_t(mA - mB);  // calculate the shift to normalize the fractions
+
+			if (shiftRight >= 14) { // catastrophic cancellation case
+				return (sign ? uint8_t(-lhs) : lhs);
+			}
+			rhs_fraction >>= shiftRight;	// align the rhs fraction
+			uint16_t result_fraction = uint16_t(lhs_fraction - rhs_fraction);
+
+			while ((result_fraction >> 14) == 0) {
+				mA--;
+				result_fraction <<= 1;
+			}
+			bool ecarry = bool(0x4000 & result_fraction);
+			if (!ecarry) {
+				mA--;
+				result_fraction <<= 1;
+			}
+
+			uint8_t raw = round(mA, result_fraction);
+			return (sign ? uint8_t(-raw) : raw);
 		}
 
 		// I/O operators
@@ -404,12 +532,12 @@ namespace sw::universal {
 		friend std::istream& operator>> (std::istream& istr, posit<NBITS_IS_8, ES_IS_0>& p);
 
 		// posit - posit logic functions
-		friend bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
-		friend bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
-		friend bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
-		friend bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
-		friend bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
-		friend bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
+		friend constexpr bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs);
 
 	};
 
@@ -453,31 +581,31 @@ namespace sw::universal {
 	}
 
 	// posit - posit binary logic operators
-	inline bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return lhs._bits == rhs._bits;
 	}
-	inline bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return !operator==(lhs, rhs);
 	}
-	inline bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return int8_t(lhs._bits) < int8_t(rhs._bits);
 	}
-	inline bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return operator< (rhs, lhs);
 	}
-	inline bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return operator< (lhs, rhs) || operator==(lhs, rhs);
 	}
-	inline bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return !operator< (lhs, rhs);
 	}
 
 	/* base class has these operators: no need to specialize */
-	inline posit<NBITS_IS_8, ES_IS_0> operator+(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {				
+	constexpr posit<NBITS_IS_8, ES_IS_0> operator+(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {				
 		posit<NBITS_IS_8, ES_IS_0> result = lhs;
 		return result += rhs;
 	}
-	inline posit<NBITS_IS_8, ES_IS_0> operator-(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr posit<NBITS_IS_8, ES_IS_0> operator-(const posit<NBITS_IS_8, ES_IS_0>& lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		posit<NBITS_IS_8, ES_IS_0> result = lhs;
 		return result -= rhs;
 	}
@@ -488,42 +616,42 @@ namespace sw::universal {
 	// posit - literal logic functions
 
 	// posit - int logic operators
-	inline bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator==(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return operator==(lhs, posit<NBITS_IS_8, ES_IS_0>(rhs));
 	}
-	inline bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator!=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return !operator==(lhs, posit<NBITS_IS_8, ES_IS_0>(rhs));
 	}
-	inline bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator< (const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return operator<(lhs, posit<NBITS_IS_8, ES_IS_0>(rhs));
 	}
-	inline bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator> (const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return operator< (posit<NBITS_IS_8, ES_IS_0>(rhs), lhs);
 	}
-	inline bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator<=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return operator< (lhs, posit<NBITS_IS_8, ES_IS_0>(rhs)) || operator==(lhs, posit<NBITS_IS_8, ES_IS_0>(rhs));
 	}
-	inline bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
+	constexpr bool operator>=(const posit<NBITS_IS_8, ES_IS_0>& lhs, int rhs) {
 		return !operator<(lhs, posit<NBITS_IS_8, ES_IS_0>(rhs));
 	}
 
 	// int - posit logic operators
-	inline bool operator==(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator==(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return posit<NBITS_IS_8, ES_IS_0>(lhs) == rhs;
 	}
-	inline bool operator!=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator!=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return !operator==(posit<NBITS_IS_8, ES_IS_0>(lhs), rhs);
 	}
-	inline bool operator< (int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator< (int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return operator<(posit<NBITS_IS_8, ES_IS_0>(lhs), rhs);
 	}
-	inline bool operator> (int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator> (int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return operator< (posit<NBITS_IS_8, ES_IS_0>(rhs), lhs);
 	}
-	inline bool operator<=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator<=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return operator< (posit<NBITS_IS_8, ES_IS_0>(lhs), rhs) || operator==(posit<NBITS_IS_8, ES_IS_0>(lhs), rhs);
 	}
-	inline bool operator>=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
+	constexpr bool operator>=(int lhs, const posit<NBITS_IS_8, ES_IS_0>& rhs) {
 		return !operator<(posit<NBITS_IS_8, ES_IS_0>(lhs), rhs);
 	}
 
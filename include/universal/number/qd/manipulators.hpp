@@ -0,0 +1,23 @@
+#pragma once
+// manipulators.hpp: definitions of helper functions for quad-double type manipulation
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <string>
+
+namespace sw::universal {
+
+// Generate a type tag for this qd_real
+inline std::string type_tag(const qd_real&) {
+	return "qd_real";
+}
+
+// the binary representation of the components, leading component first
+inline std::string to_binary(const qd_real& v, bool bNibbleMarker = false) {
+	std::string s = to_binary(v[0], bNibbleMarker);
+	for (int i = 1; i < 4; ++i) s += " + " + to_binary(v[i], bNibbleMarker);
+	return s;
+}
+
+} // namespace sw::universal
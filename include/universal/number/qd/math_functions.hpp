@@ -0,0 +1,25 @@
+#pragma once
+// math_functions.hpp: definition of mathematical functions for the quad-double type
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/shared/multi_double_functions.hpp>
+
+namespace sw::universal {
+
+template<>
+struct multi_double_traits<qd_real> {
+	static constexpr int components = 4;
+	static constexpr int newtonIterations = 2;
+	static constexpr qd_real pi     = qd_pi;
+	static constexpr qd_real twopi  = qd_2pi;
+	static constexpr qd_real pi_2   = qd_pi_2;
+	static constexpr qd_real pi_4   = qd_pi_4;
+	static constexpr qd_real ln2    = qd_ln2;
+	static constexpr qd_real ln10   = qd_ln10;
+	static constexpr qd_real log2e  = qd_log2e;
+	static constexpr qd_real log10e = qd_log10e;
+};
+
+} // namespace sw::universal
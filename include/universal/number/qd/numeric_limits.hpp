@@ -0,0 +1,30 @@
+#pragma once
+// numeric_limits.hpp: definition of numeric_limits for quad-double types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/number/shared/multi_double_limits.hpp>
+
+namespace std {
+
+template <> 
+class numeric_limits< sw::universal::qd_real > : public sw::universal::internal::multi_double_numeric_limits< sw::universal::qd_real > {
+public:
+	using QuadDouble = sw::universal::qd_real;
+	static constexpr QuadDouble min() { // return minimum value: the smallest value with full precision
+		return QuadDouble(1.6259745436952323e-260, 0.0, 0.0, 0.0);  // 2^-863
+	} 
+	static constexpr QuadDouble epsilon() { // return smallest effective increment from 1.0
+		return QuadDouble(1.2154326714572542e-63, 0.0, 0.0, 0.0);  // 2^-209
+	}
+
+	static constexpr int digits       = 212;
+	static constexpr int digits10     = 62;
+	static constexpr int max_digits10 = 65;
+
+	static constexpr int min_exponent   = std::numeric_limits<double>::min_exponent + 159;
+	static constexpr int min_exponent10 = std::numeric_limits<double>::min_exponent10 + 48;
+};
+
+}
@@ -0,0 +1,488 @@
+#pragma once
+// qd_impl.hpp: definition of the quad-double floating-point number system
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+
+#include <universal/native/ieee754.hpp>
+#include <universal/number/shared/specific_value_encoding.hpp>
+#include <universal/number/shared/error_free_ops.hpp>
+#include <universal/number/shared/multi_double_format.hpp>
+#include <universal/number/dd/dd.hpp>
+
+namespace sw::universal {
+
+// qd_real is a quad-double: the unevaluated sum of four nonoverlapping doubles ordered by
+// decreasing magnitude, following Hida, Li, and Bailey. It carries 212 bits of precision
+// with the exponent range of double, and inherits the IEEE-754 semantics of its leading
+// component for infinities and NaN.
+class qd_real {
+public:
+	static constexpr int nrComponents = 4;
+
+	constexpr qd_real() : x{ 0.0, 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(double x0, double x1, double x2, double x3) : x{ x0, x1, x2, x3 } {}
+
+	constexpr qd_real(const qd_real&) = default;
+	constexpr qd_real(qd_real&&) = default;
+
+	constexpr qd_real& operator=(const qd_real&) = default;
+	constexpr qd_real& operator=(qd_real&&) = default;
+
+	// specific value constructor
+	constexpr qd_real(const SpecificValue code) : x{ 0.0, 0.0, 0.0, 0.0 } {
+		switch (code) {
+		case SpecificValue::maxpos:
+			maxpos();
+			break;
+		case SpecificValue::minpos:
+			minpos();
+			break;
+		case SpecificValue::zero:
+		default:
+			break;
+		case SpecificValue::minneg:
+			minneg();
+			break;
+		case SpecificValue::maxneg:
+			maxneg();
+			break;
+		}
+	}
+
+	// a double-double is a quad-double with two zero components
+	constexpr qd_real(const dd_real& dd) : x{ dd.high(), dd.low(), 0.0, 0.0 } {}
+
+	// initializers for native types: integers are represented exactly
+	constexpr qd_real(signed char initial_value)        : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(short initial_value)              : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(int initial_value)                : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	qd_real(long initial_value)                         { *this = dd_real(initial_value); }
+	qd_real(long long initial_value)                    { *this = dd_real(initial_value); }
+	constexpr qd_real(char initial_value)               : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(unsigned short initial_value)     : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(unsigned int initial_value)       : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	qd_real(unsigned long initial_value)                { *this = dd_real(initial_value); }
+	qd_real(unsigned long long initial_value)           { *this = dd_real(initial_value); }
+	constexpr qd_real(float initial_value)              : x{ double(initial_value), 0.0, 0.0, 0.0 } {}
+	constexpr qd_real(double initial_value)             : x{ initial_value, 0.0, 0.0, 0.0 } {}
+	qd_real(long double initial_value)                  { *this = dd_real(initial_value); }
+
+	// assignment operators for native types
+	qd_real& operator=(signed char rhs)        { return *this = qd_real(rhs); }
+	qd_real& operator=(short rhs)              { return *this = qd_real(rhs); }
+	qd_real& operator=(int rhs)                { return *this = qd_real(rhs); }
+	qd_real& operator=(long rhs)               { return *this = dd_real(rhs); }
+	qd_real& operator=(long long rhs)          { return *this = dd_real(rhs); }
+	qd_real& operator=(char rhs)               { return *this = qd_real(rhs); }
+	qd_real& operator=(unsigned short rhs)     { return *this = qd_real(rhs); }
+	qd_real& operator=(unsigned int rhs)       { return *this = qd_real(rhs); }
+	qd_real& operator=(unsigned long rhs)      { return *this = dd_real(rhs); }
+	qd_real& operator=(unsigned long long rhs) { return *this = dd_real(rhs); }
+	qd_real& operator=(float rhs)              { return *this = qd_real(rhs); }
+	qd_real& operator=(double rhs)             { return *this = qd_real(rhs); }
+	qd_real& operator=(long double rhs)        { return *this = dd_real(rhs); }
+
+	// conversion operators: the leading component, or the rounded sum of the components
+	explicit operator int() const { return int(to_long_long()); }
+	explicit operator long() const { return long(to_long_long()); }
+	explicit operator long long() const { return to_long_long(); }
+	explicit operator unsigned long long() const { return to_unsigned_long_long(); }
+	explicit operator float() const { return float(x[0]); }
+	explicit operator double() const { return x[0]; }
+	explicit operator long double() const { return (long double)(x[0]) + (long double)(x[1]); }
+	explicit operator dd_real() const {
+		double e;
+		double s = two_sum(x[0], x[1] + (x[2] + x[3]), e);
+		return dd_real(s, e);
+	}
+
+	// prefix operator
+	constexpr qd_real operator-() const { return qd_real(-x[0], -x[1], -x[2], -x[3]); }
+
+	// in-place arithmetic assignment operators: the double overloads are cheaper kernels,
+	// other native types convert exactly through the constructors
+	//
+	// merge the components of both operands by decreasing magnitude into an accumulator
+	// of two doubles that emits a component each time it fills up
+	qd_real& operator+=(const qd_real& rhs) {
+		double lead = x[0] + rhs.x[0];
+		if (!std::isfinite(lead)) return assign(lead, 0.0, 0.0, 0.0);
+		const double* a = x;
+		const double* b = rhs.x;
+		double s[4] = { 0.0, 0.0, 0.0, 0.0 };
+		int i = 0, j = 0, k = 0;
+		double u, v, t;
+		if (std::fabs(a[i]) > std::fabs(b[j])) u = a[i++]; else u = b[j++];
+		if (std::fabs(a[i]) > std::fabs(b[j])) v = a[i++]; else v = b[j++];
+		u = quick_two_sum(u, v, v);
+		while (k < 4) {
+			if (i >= 4 && j >= 4) {
+				s[k] = u;
+				if (k < 3) s[++k] = v;
+				break;
+			}
+			if (i >= 4) t = b[j++];
+			else if (j >= 4) t = a[i++];
+			else if (std::fabs(a[i]) > std::fabs(b[j])) t = a[i++];
+			else t = b[j++];
+			double component = quick_three_accum(u, v, t);
+			if (component != 0.0) s[k++] = component;
+		}
+		// the components that did not fit only contribute to the last one
+		for (int m = i; m < 4; ++m) s[3] += a[m];
+		for (int m = j; m < 4; ++m) s[3] += b[m];
+		renorm(s[0], s[1], s[2], s[3]);
+		return assign_checked(s[0], s[1], s[2], s[3]);
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	qd_real& operator+=(Real rhs) {
+		double e;
+		double c0 = two_sum(x[0], rhs, e);
+		if (!std::isfinite(c0)) return assign(c0, 0.0, 0.0, 0.0);
+		double c1 = two_sum(x[1], e, e);
+		double c2 = two_sum(x[2], e, e);
+		double c3 = two_sum(x[3], e, e);
+		renorm(c0, c1, c2, c3, e);
+		return assign_checked(c0, c1, c2, c3);
+	}
+	qd_real& operator-=(const qd_real& rhs) { return *this += -rhs; }
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	qd_real& operator-=(Real rhs) { return *this += -rhs; }
+	// the terms of order eps^4 and smaller are accumulated in plain double precision
+	qd_real& operator*=(const qd_real& rhs) {
+		const double* a = x;
+		const double* b = rhs.x;
+		double q0, q1, q2, q3, q4, q5;
+		double p0 = two_prod(a[0], b[0], q0);
+		if (!std::isfinite(p0)) return assign(p0, 0.0, 0.0, 0.0);
+		double p1 = two_prod(a[0], b[1], q1);
+		double p2 = two_prod(a[1], b[0], q2);
+		double p3 = two_prod(a[0], b[2], q3);
+		double p4 = two_prod(a[1], b[1], q4);
+		double p5 = two_prod(a[2], b[0], q5);
+
+		// order eps
+		three_sum(p1, p2, q0);
+		// order eps^2: the six-three sum of p2, q1, q2, p3, p4, p5
+		three_sum(p2, q1, q2);
+		three_sum(p3, p4, p5);
+		double t0, t1;
+		double s0 = two_sum(p2, p3, t0);
+		double s1 = two_sum(q1, p4, t1);
+		double s2 = q2 + p5;
+		s1 = two_sum(s1, t0, t0);
+		s2 += (t0 + t1);
+		// order eps^3
+		s1 += a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0] + q0 + q3 + q4 + q5;
+		renorm(p0, p1, s0, s1, s2);
+		return assign_checked(p0, p1, s0, s1);
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	qd_real& operator*=(Real rhs) {
+		double q0, q1, q2;
+		double p0 = two_prod(x[0], rhs, q0);
+		if (!std::isfinite(p0)) return assign(p0, 0.0, 0.0, 0.0);
+		double p1 = two_prod(x[1], rhs, q1);
+		double p2 = two_prod(x[2], rhs, q2);
+		double p3 = x[3] * rhs;
+		double s0 = p0, s2;
+		double s1 = two_sum(q0, p1, s2);
+		three_sum(s2, q1, p2);
+		three_sum2(q1, q2, p3);
+		double s3 = q1;
+		double s4 = q2 + p2;
+		renorm(s0, s1, s2, s3, s4);
+		return assign_checked(s0, s1, s2, s3);
+	}
+	// five quotient digits of 53 bits, each from the remainder of the previous ones
+	qd_real& operator/=(const qd_real& rhs) {
+		double q0 = x[0] / rhs.x[0];
+		if (!std::isfinite(q0) || rhs.x[0] == 0.0) return assign(q0, 0.0, 0.0, 0.0);
+		qd_real r(*this), t(rhs);
+		r -= (t *= q0);
+		double q1 = r.x[0] / rhs.x[0];
+		t = rhs;
+		r -= (t *= q1);
+		double q2 = r.x[0] / rhs.x[0];
+		t = rhs;
+		r -= (t *= q2);
+		double q3 = r.x[0] / rhs.x[0];
+		t = rhs;
+		r -= (t *= q3);
+		double q4 = r.x[0] / rhs.x[0];
+		renorm(q0, q1, q2, q3, q4);
+		return assign(q0, q1, q2, q3);
+	}
+	template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+	qd_real& operator/=(Real rhs) {
+		double q0 = x[0] / rhs;
+		if (!std::isfinite(q0) || rhs == 0.0) return assign(q0, 0.0, 0.0, 0.0);
+		qd_real r(*this), t(rhs);
+		r -= (t *= q0);
+		double q1 = r.x[0] / rhs;
+		t = qd_real(rhs);
+		r -= (t *= q1);
+		double q2 = r.x[0] / rhs;
+		t = qd_real(rhs);
+		r -= (t *= q2);
+		double q3 = r.x[0] / rhs;
+		renorm(q0, q1, q2, q3);
+		return assign(q0, q1, q2, q3);
+	}
+
+	// modifiers
+	constexpr void clear() noexcept { x[0] = x[1] = x[2] = x[3] = 0.0; }
+	constexpr void setzero() noexcept { clear(); }
+	constexpr void setinf(bool sign = true) noexcept { clear(); x[0] = (sign ? -INFINITY : INFINITY); }
+	constexpr void setnan() noexcept { clear(); x[0] = std::numeric_limits<double>::quiet_NaN(); }
+	constexpr void set(double x0, double x1, double x2, double x3) noexcept { x[0] = x0; x[1] = x1; x[2] = x2; x[3] = x3; }
+
+	// create specific number system values of interest
+	constexpr qd_real& maxpos() noexcept {
+		x[0] = 1.79769313486231570815e+308;
+		x[1] = 9.97920154767359795037e+291;
+		x[2] = 5.53956966280111259858e+275;
+		x[3] = 3.07507889307840487279e+259;
+		return *this;
+	}
+	constexpr qd_real& minpos() noexcept {
+		clear();
+		x[0] = std::numeric_limits<double>::denorm_min();
+		return *this;
+	}
+	constexpr qd_real& zero() noexcept {
+		clear();
+		return *this;
+	}
+	constexpr qd_real& minneg() noexcept {
+		clear();
+		x[0] = -std::numeric_limits<double>::denorm_min();
+		return *this;
+	}
+	constexpr qd_real& maxneg() noexcept {
+		maxpos();
+		x[0] = -x[0]; x[1] = -x[1]; x[2] = -x[2]; x[3] = -x[3];
+		return *this;
+	}
+
+	// selectors
+	constexpr bool iszero() const noexcept { return x[0] == 0.0; }
+	constexpr bool isone() const noexcept { return x[0] == 1.0 && x[1] == 0.0 && x[2] == 0.0 && x[3] == 0.0; }
+	constexpr bool isneg() const noexcept { return x[0] < 0.0; }
+	constexpr bool ispos() const noexcept { return x[0] > 0.0; }
+	bool isinf() const noexcept { return std::isinf(x[0]); }
+	bool isnan() const noexcept { return std::isnan(x[0]); }
+	bool isfinite() const noexcept { return std::isfinite(x[0]); }
+	constexpr bool sign() const noexcept { return x[0] < 0.0; }
+	int scale() const noexcept { return (x[0] == 0.0 || !std::isfinite(x[0]) ? 0 : std::ilogb(x[0])); }
+	constexpr double operator[](int index) const noexcept { return (index >= 0 && index < 4 ? x[index] : 0.0); }
+
+	long long to_long_long() const;
+	unsigned long long to_unsigned_long_long() const;
+
+	// decimal string with the given significant digits, following the stream format flags
+	std::string str(std::streamsize precision = 64, std::ios_base::fmtflags flags = std::ios_base::scientific) const {
+		return internal::multi_double_to_string(*this, precision, flags);
+	}
+
+private:
+	double x[4];
+
+	qd_real& assign(double x0, double x1, double x2, double x3) noexcept {
+		x[0] = x0; x[1] = x1; x[2] = x2; x[3] = x3;
+		return *this;
+	}
+	// a leading component that overflows during normalization leaves undefined trailing components
+	qd_real& assign_checked(double x0, double x1, double x2, double x3) noexcept {
+		if (!std::isfinite(x0)) return assign(x0, 0.0, 0.0, 0.0);
+		return assign(x0, x1, x2, x3);
+	}
+};
+
+////////////////////////    constants    /////////////////////////////////
+
+inline constexpr qd_real qd_pi(3.141592653589793, 1.2246467991473532e-16, -2.9947698097183397e-33, 1.1124542208633653e-49);
+inline constexpr qd_real qd_2pi(6.283185307179586, 2.4492935982947064e-16, -5.989539619436679e-33, 2.2249084417267306e-49);
+inline constexpr qd_real qd_pi_2(1.5707963267948966, 6.123233995736766e-17, -1.4973849048591698e-33, 5.562271104316826e-50);
+inline constexpr qd_real qd_pi_4(0.7853981633974483, 3.061616997868383e-17, -7.486924524295849e-34, 2.781135552158413e-50);
+inline constexpr qd_real qd_3pi_4(2.356194490192345, 9.184850993605148e-17, 3.9168984647504e-33, -2.5867981632704864e-49);
+inline constexpr qd_real qd_e(2.718281828459045, 1.4456468917292502e-16, -2.1277171080381768e-33, 1.5156301598412191e-49);
+inline constexpr qd_real qd_ln2(0.6931471805599453, 2.3190468138462996e-17, 5.707708438416212e-34, -3.5824322106018114e-50);
+inline constexpr qd_real qd_ln10(2.302585092994046, -2.1707562233822494e-16, -9.984262454465777e-33, -4.023357454450206e-49);
+inline constexpr qd_real qd_log2e(1.4426950408889634, 2.0355273740931033e-17, -1.0614659956117258e-33, -1.3836716780181402e-50);
+inline constexpr qd_real qd_log10e(0.4342944819032518, 1.098319650216765e-17, 3.717181233110959e-34, 7.734484346504299e-51);
+
+////////////////////////    helper functions   /////////////////////////////////
+
+inline qd_real abs(const qd_real& a) { return (a.isneg() ? -a : a); }
+inline qd_real fabs(const qd_real& a) { return abs(a); }
+
+// a * 2^exp, exact barring underflow
+inline qd_real ldexp(const qd_real& a, int exp) {
+	return qd_real(std::ldexp(a[0], exp), std::ldexp(a[1], exp), std::ldexp(a[2], exp), std::ldexp(a[3], exp));
+}
+
+inline qd_real frexp(const qd_real& a, int* exp) {
+	double x0 = std::frexp(a[0], exp);
+	return qd_real(x0, std::ldexp(a[1], -*exp), std::ldexp(a[2], -*exp), std::ldexp(a[3], -*exp));
+}
+
+inline qd_real floor(const qd_real& a) {
+	double x0 = std::floor(a[0]), x1{ 0.0 }, x2{ 0.0 }, x3{ 0.0 };
+	if (x0 == a[0]) {
+		// the fraction lives in the first component that is not an integer
+		x1 = std::floor(a[1]);
+		if (x1 == a[1]) {
+			x2 = std::floor(a[2]);
+			if (x2 == a[2]) x3 = std::floor(a[3]);
+		}
+		renorm(x0, x1, x2, x3);
+	}
+	return qd_real(x0, x1, x2, x3);
+}
+
+inline qd_real ceil(const qd_real& a) {
+	double x0 = std::ceil(a[0]), x1{ 0.0 }, x2{ 0.0 }, x3{ 0.0 };
+	if (x0 == a[0]) {
+		x1 = std::ceil(a[1]);
+		if (x1 == a[1]) {
+			x2 = std::ceil(a[2]);
+			if (x2 == a[2]) x3 = std::ceil(a[3]);
+		}
+		renorm(x0, x1, x2, x3);
+	}
+	return qd_real(x0, x1, x2, x3);
+}
+
+// integer conversions truncate toward zero; the components of the truncated value are integers
+// that are summed modulo 2^64, so the result is exact whenever it is in range
+inline long long qd_real::to_long_long() const {
+	qd_real t = (isneg() ? ceil(*this) : floor(*this));
+	return (long long)(internal::modular_integer(t[0]) + internal::modular_integer(t[1]) + internal::modular_integer(t[2]) + internal::modular_integer(t[3]));
+}
+
+inline unsigned long long qd_real::to_unsigned_long_long() const {
+	if (isneg()) return 0;
+	qd_real t = floor(*this);
+	return internal::modular_integer(t[0]) + internal::modular_integer(t[1]) + internal::modular_integer(t[2]) + internal::modular_integer(t[3]);
+}
+
+inline qd_real sqr(const qd_real& a) {
+	qd_real square(a);
+	square *= a;
+	return square;
+}
+
+////////////////////////    stream operators   /////////////////////////////////
+
+inline bool parse(const std::string& number, qd_real& value) {
+	return internal::multi_double_parse(number, value);
+}
+
+// generate a qd_real format ASCII format, honoring precision and the floatfield flags
+inline std::ostream& operator<<(std::ostream& ostr, const qd_real& v) {
+	// to make certain that setw and left/right operators work properly
+	// we need to transform the qd_real into a string
+	std::stringstream ss;
+	std::streamsize prec = ostr.precision();
+	std::streamsize width = ostr.width();
+	std::ios_base::fmtflags ff = ostr.flags();
+	ss.flags(ff);
+	ss << std::setw(width) << internal::multi_double_to_string(v, prec, ff);
+	return ostr << ss.str();
+}
+
+// read an ASCII qd_real format
+inline std::istream& operator>>(std::istream& istr, qd_real& v) {
+	std::string txt;
+	istr >> txt;
+	if (!parse(txt, v)) {
+		std::cerr << "unable to parse -" << txt << "- into a qd_real value\n";
+	}
+	return istr;
+}
+
+////////////////////////    logic operators   /////////////////////////////////
+
+inline bool operator==(const qd_real& lhs, const qd_real& rhs) {
+	return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
+}
+inline bool operator!=(const qd_real& lhs, const qd_real& rhs) { return !operator==(lhs, rhs); }
+inline bool operator< (const qd_real& lhs, const qd_real& rhs) {
+	for (int i = 0; i < 4; ++i) {
+		if (lhs[i] < rhs[i]) return true;
+		if (lhs[i] != rhs[i]) return false;
+	}
+	return false;
+}
+inline bool operator> (const qd_real& lhs, const qd_real& rhs) { return  operator< (rhs, lhs); }
+inline bool operator<=(const qd_real& lhs, const qd_real& rhs) { return  operator< (lhs, rhs) || operator==(lhs, rhs); }
+inline bool operator>=(const qd_real& lhs, const qd_real& rhs) { return  operator< (rhs, lhs) || operator==(lhs, rhs); }
+
+////////////////////////  arithmetic operators   /////////////////////////////////
+
+inline qd_real operator+(const qd_real& lhs, const qd_real& rhs) {
+	qd_real sum(lhs);
+	sum += rhs;
+	return sum;
+}
+inline qd_real operator-(const qd_real& lhs, const qd_real& rhs) {
+	qd_real diff(lhs);
+	diff -= rhs;
+	return diff;
+}
+inline qd_real operator*(const qd_real& lhs, const qd_real& rhs) {
+	qd_real product(lhs);
+	product *= rhs;
+	return product;
+}
+inline qd_real operator/(const qd_real& lhs, const qd_real& rhs) {
+	qd_real ratio(lhs);
+	ratio /= rhs;
+	return ratio;
+}
+
+// mixed with double
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator+(const qd_real& lhs, Real rhs) { qd_real sum(lhs); sum += rhs; return sum; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator+(Real lhs, const qd_real& rhs) { qd_real sum(rhs); sum += lhs; return sum; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator-(const qd_real& lhs, Real rhs) { qd_real diff(lhs); diff -= rhs; return diff; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator-(Real lhs, const qd_real& rhs) { qd_real diff(-rhs); diff += lhs; return diff; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator*(const qd_real& lhs, Real rhs) { qd_real product(lhs); product *= rhs; return product; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator*(Real lhs, const qd_real& rhs) { qd_real product(rhs); product *= lhs; return product; }
+template<typename Real, typename = std::enable_if_t<std::is_same_v<Real, double>>>
+inline qd_real operator/(const qd_real& lhs, Real rhs) { qd_real ratio(lhs); ratio /= rhs; return ratio; }
+
+////////////////////////  square root   /////////////////////////////////
+
+// Newton iterations x <- x + x(1/2 - (a/2) x^2) on the reciprocal square root, then sqrt(a) = a x
+inline qd_real sqrt(const qd_real& a) {
+	if (a.iszero()) return a;
+	if (a.isneg()) return qd_real(std::numeric_limits<double>::quiet_NaN());
+	if (a.isinf()) return a;
+	qd_real r(1.0 / std::sqrt(a[0]));
+	qd_real h = ldexp(a, -1);
+	for (int i = 0; i < 3; ++i) {
+		qd_real correction = h * sqr(r);
+		correction = qd_real(0.5) - correction;
+		r += r * correction;
+	}
+	return a * r;
+}
+
+} // namespace sw::universal
@@ -0,0 +1,153 @@
+#pragma once
+// error_free_ops.hpp: error-free transformations of double precision arithmetic for multi-component number systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+
+/*
+   An error-free transformation returns the rounded result of a floating-point operation
+   together with its exact rounding error, so that for example a + b = s + e holds exactly.
+   They are the building blocks of the double-double and quad-double number systems,
+   following Y. Hida, X.S. Li, and D.H. Bailey, "Library for Double-Double and Quad-Double
+   Arithmetic", 2007. The products use the fused multiply-add, which makes two_prod a
+   two-instruction sequence on every platform with a hardware FMA.
+ */
+
+namespace sw::universal {
+
+// s + e = a + b exactly, for |a| >= |b|
+inline double quick_two_sum(double a, double b, double& e) {
+	double s = a + b;
+	e = b - (s - a);
+	return s;
+}
+
+// s + e = a - b exactly, for |a| >= |b|
+inline double quick_two_diff(double a, double b, double& e) {
+	double s = a - b;
+	e = (a - s) - b;
+	return s;
+}
+
+// s + e = a + b exactly
+inline double two_sum(double a, double b, double& e) {
+	double s = a + b;
+	double bb = s - a;
+	e = (a - (s - bb)) + (b - bb);
+	return s;
+}
+
+// s + e = a - b exactly
+inline double two_diff(double a, double b, double& e) {
+	double s = a - b;
+	double bb = s - a;
+	e = (a - (s - bb)) - (b + bb);
+	return s;
+}
+
+// p + e = a * b exactly
+inline double two_prod(double a, double b, double& e) {
+	double p = a * b;
+	e = std::fma(a, b, -p);
+	return p;
+}
+
+// p + e = a * a exactly
+inline double two_sqr(double a, double& e) {
+	double p = a * a;
+	e = std::fma(a, a, -p);
+	return p;
+}
+
+// (a, b, c) <- a + b + c as a nonoverlapping triple, largest first
+inline void three_sum(double& a, double& b, double& c) {
+	double t1, t2, t3;
+	t1 = two_sum(a, b, t2);
+	a = two_sum(c, t1, t3);
+	b = two_sum(t2, t3, c);
+}
+
+// (a, b) <- a + b + c, dropping the third order term
+inline void three_sum2(double& a, double& b, double c) {
+	double t1, t2, t3;
+	t1 = two_sum(a, b, t2);
+	a = two_sum(c, t1, t3);
+	b = t2 + t3;
+}
+
+// accumulate c into the pair (a, b): returns a completed component, or zero
+// while the pair can still absorb the bits of c
+inline double quick_three_accum(double& a, double& b, double c) {
+	double s = two_sum(b, c, b);
+	s = two_sum(a, s, a);
+	bool za = (a != 0.0);
+	bool zb = (b != 0.0);
+	if (za && zb) return s;
+	if (!zb) {
+		b = a;
+		a = s;
+	}
+	else {
+		a = s;
+	}
+	return 0.0;
+}
+
+// renormalize four overlapping components into a nonoverlapping quad-double
+inline void renorm(double& c0, double& c1, double& c2, double& c3) {
+	if (std::isinf(c0)) return;
+	double s0, s1, s2{ 0.0 }, s3{ 0.0 };
+	s0 = quick_two_sum(c2, c3, c3);
+	s0 = quick_two_sum(c1, s0, c2);
+	c0 = quick_two_sum(c0, s0, c1);
+	s0 = c0;
+	s1 = c1;
+	if (s1 != 0.0) {
+		s1 = quick_two_sum(s1, c2, s2);
+		if (s2 != 0.0) s2 = quick_two_sum(s2, c3, s3); else s1 = quick_two_sum(s1, c3, s2);
+	}
+	else {
+		s0 = quick_two_sum(s0, c2, s1);
+		if (s1 != 0.0) s1 = quick_two_sum(s1, c3, s2); else s0 = quick_two_sum(s0, c3, s1);
+	}
+	c0 = s0; c1 = s1; c2 = s2; c3 = s3;
+}
+
+// renormalize five overlapping components into a nonoverlapping quad-double in c0..c3
+inline void renorm(double& c0, double& c1, double& c2, double& c3, double& c4) {
+	if (std::isinf(c0)) return;
+	double s0, s1, s2{ 0.0 }, s3{ 0.0 };
+	s0 = quick_two_sum(c3, c4, c4);
+	s0 = quick_two_sum(c2, s0, c3);
+	s0 = quick_two_sum(c1, s0, c2);
+	c0 = quick_two_sum(c0, s0, c1);
+	s0 = c0;
+	s1 = c1;
+	if (s1 != 0.0) {
+		s1 = quick_two_sum(s1, c2, s2);
+		if (s2 != 0.0) {
+			s2 = quick_two_sum(s2, c3, s3);
+			if (s3 != 0.0) s3 += c4; else s2 = quick_two_sum(s2, c4, s3);
+		}
+		else {
+			s1 = quick_two_sum(s1, c3, s2);
+			if (s2 != 0.0) s2 = quick_two_sum(s2, c4, s3); else s1 = quick_two_sum(s1, c4, s2);
+		}
+	}
+	else {
+		s0 = quick_two_sum(s0, c2, s1);
+		if (s1 != 0.0) {
+			s1 = quick_two_sum(s1, c3, s2);
+			if (s2 != 0.0) s2 = quick_two_sum(s2, c4, s3); else s1 = quick_two_sum(s1, c4, s2);
+		}
+		else {
+			s0 = quick_two_sum(s0, c3, s1);
+			if (s1 != 0.0) s1 = quick_two_sum(s1, c4, s2); else s0 = quick_two_sum(s0, c4, s1);
+		}
+	}
+	c0 = s0; c1 = s1; c2 = s2; c3 = s3;
+}
+
+} // namespace sw::universal
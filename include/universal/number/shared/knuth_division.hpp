@@ -0,0 +1,71 @@
+#pragma once
+// knuth_division.hpp: Knuth's long division on little-endian arrays of 32-bit limbs
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+/*
+   Algorithm D of D.E. Knuth, The Art of Computer Programming, Vol. 2, section 4.3.1.
+   The adaptive precision integers and the modular arithmetic of the fixed-size integers
+   both divide multi-limb magnitudes. They hold their limbs in different containers, so the
+   kernel takes the scratch space for the normalized operands from the caller.
+ */
+
+namespace sw::universal::internal {
+
+// q = u / v and r = u % v for m >= n >= 2 and v[n - 1] != 0.
+// q has m - n + 1 limbs and may be nullptr, r has n limbs.
+// un and vn are scratch space of m + 1 and n limbs for the normalized dividend and divisor
+inline void knuth_divmod(uint32_t* q, uint32_t* r, const uint32_t* u, size_t m, const uint32_t* v, size_t n, uint32_t* un, uint32_t* vn) {
+	constexpr uint64_t base = uint64_t(1) << 32;
+	// normalize the divisor so that its most significant bit is set
+	unsigned s = unsigned(std::countl_zero(v[n - 1]));
+	for (size_t i = n - 1; i > 0; --i) vn[i] = uint32_t(v[i] << s) | (s ? uint32_t(v[i - 1] >> (32 - s)) : 0u);
+	vn[0] = uint32_t(v[0] << s);
+	un[m] = (s ? uint32_t(u[m - 1] >> (32 - s)) : 0u);
+	for (size_t i = m - 1; i > 0; --i) un[i] = uint32_t(u[i] << s) | (s ? uint32_t(u[i - 1] >> (32 - s)) : 0u);
+	un[0] = uint32_t(u[0] << s);
+
+	for (size_t j = m - n + 1; j-- > 0;) {
+		// estimate the quotient limb from the two leading limbs, and correct it at most twice
+		uint64_t numerator = (uint64_t(un[j + n]) << 32) | un[j + n - 1];
+		uint64_t qhat = numerator / vn[n - 1];
+		uint64_t rhat = numerator - qhat * vn[n - 1];
+		while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+			--qhat;
+			rhat += vn[n - 1];
+			if (rhat >= base) break;
+		}
+		// multiply and subtract
+		int64_t borrow{ 0 }, t{ 0 };
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t p = qhat * vn[i];
+			t = int64_t(un[i + j]) - borrow - int64_t(p & 0xFFFF'FFFFull);
+			un[i + j] = uint32_t(t);
+			borrow = int64_t(p >> 32) - (t >> 32);
+		}
+		t = int64_t(un[j + n]) - borrow;
+		un[j + n] = uint32_t(t);
+		if (t < 0) {
+			// the estimate was one too large: add the divisor back
+			--qhat;
+			uint64_t carry{ 0 };
+			for (size_t i = 0; i < n; ++i) {
+				carry += uint64_t(un[i + j]) + vn[i];
+				un[i + j] = uint32_t(carry);
+				carry >>= 32;
+			}
+			un[j + n] = uint32_t(un[j + n] + carry);
+		}
+		if (q) q[j] = uint32_t(qhat);
+	}
+	// denormalize the remainder
+	for (size_t i = 0; i < n - 1; ++i) r[i] = uint32_t(un[i] >> s) | (s ? uint32_t(un[i + 1] << (32 - s)) : 0u);
+	r[n - 1] = uint32_t(un[n - 1] >> s);
+}
+
+} // namespace sw::universal::internal
@@ -0,0 +1,242 @@
+#pragma once
+// multi_double_format.hpp: decimal conversion of multi-component floating-point types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cctype>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <ios>
+
+/*
+   The double-double and quad-double types share the decimal conversions below. A type
+   Real qualifies when it provides the arithmetic operators, construction from double,
+   an explicit conversion to double that returns the leading component, and the
+   selectors isnan(), isinf(), iszero(), and isneg().
+ */
+
+namespace sw::universal::internal {
+
+// 10^n by repeated squaring
+template<typename Real>
+Real multi_double_power_of_ten(int n) {
+	Real result(1.0), ten(10.0);
+	bool reciprocal = (n < 0);
+	for (unsigned e = unsigned(reciprocal ? -n : n); e > 0; e >>= 1) {
+		if (e & 1) result *= ten;
+		ten *= ten;
+	}
+	return (reciprocal ? Real(1.0) / result : result);
+}
+
+// generate nrDigits decimal digits of a positive finite value, rounded to nearest;
+// returns the decimal exponent of the first digit
+template<typename Real>
+int multi_double_to_digits(const Real& v, int nrDigits, std::vector<int>& digits) {
+	Real r(v);
+	int exponent = int(std::floor(std::log10(double(r))));
+	// scale into [1, 10), in two steps when 10^-exponent is beyond the double range
+	if (exponent < -300) {
+		r *= multi_double_power_of_ten<Real>(300);
+		r *= multi_double_power_of_ten<Real>(-exponent - 300);
+	}
+	else if (exponent > 0) {
+		r /= multi_double_power_of_ten<Real>(exponent);
+	}
+	else {
+		r *= multi_double_power_of_ten<Real>(-exponent);
+	}
+	if (double(r) >= 10.0) { r /= 10.0; ++exponent; }
+	if (double(r) < 1.0) { r *= 10.0; --exponent; }
+
+	// one extra digit to round with; leading components may leave digits out of range
+	digits.assign(size_t(nrDigits) + 1, 0);
+	for (int i = 0; i <= nrDigits; ++i) {
+		int d = int(double(r));
+		r -= double(d);
+		r *= 10.0;
+		digits[size_t(i)] = d;
+	}
+	for (int i = nrDigits; i > 0; --i) {
+		if (digits[size_t(i)] < 0) { digits[size_t(i - 1)] -= 1; digits[size_t(i)] += 10; }
+		else if (digits[size_t(i)] > 9) { digits[size_t(i - 1)] += 1; digits[size_t(i)] -= 10; }
+	}
+	if (digits[0] <= 0) {
+		// the scaling undershot: shift the digits up
+		digits.erase(digits.begin());
+		digits.push_back(0);
+		--exponent;
+	}
+	// round to nrDigits
+	bool roundUp = digits[size_t(nrDigits)] >= 5;
+	digits.pop_back();
+	if (roundUp) {
+		int i = nrDigits - 1;
+		++digits[size_t(i)];
+		while (i > 0 && digits[size_t(i)] > 9) {
+			digits[size_t(i)] -= 10;
+			++digits[size_t(--i)];
+		}
+		if (digits[0] > 9) {
+			digits[0] = 1;
+			for (int j = 1; j < nrDigits; ++j) digits[size_t(j)] = 0;
+			++exponent;
+		}
+	}
+	return exponent;
+}
+
+// decimal string of a value following the conventions of the ostream format flags:
+// fixed and scientific as for the native types, and %g-like otherwise
+template<typename Real>
+std::string multi_double_to_string(const Real& v, std::streamsize precision, std::ios_base::fmtflags flags) {
+	bool fixed = (flags & std::ios_base::floatfield) == std::ios_base::fixed;
+	bool scientific = (flags & std::ios_base::floatfield) == std::ios_base::scientific;
+	bool showpos = (flags & std::ios_base::showpos) != 0;
+	bool uppercase = (flags & std::ios_base::uppercase) != 0;
+	bool showpoint = (flags & std::ios_base::showpoint) != 0;
+	std::string s;
+	if (v.isnan()) return (uppercase ? "NAN" : "nan");
+	if (v.isneg()) s += '-'; else if (showpos) s += '+';
+	if (v.isinf()) return s + (uppercase ? "INF" : "inf");
+	if (precision < 0) precision = 6;
+	int prec = int(precision);
+
+	std::vector<int> digits;
+	int exponent{ 0 };
+	Real magnitude = (v.isneg() ? -v : v);
+	bool zero = v.iszero();
+	if (!fixed && !scientific) {
+		// %g: precision counts significant digits, the exponent selects the notation
+		if (prec == 0) prec = 1;
+		if (!zero) exponent = multi_double_to_digits(magnitude, prec, digits);
+		else digits.assign(size_t(prec), 0);
+		if (exponent < -4 || exponent >= prec) {
+			scientific = true;
+			prec -= 1;
+		}
+		else {
+			fixed = true;
+			prec -= exponent + 1;
+		}
+		if (!showpoint) {
+			// drop the trailing zeros of the fraction
+			int nrSignificant = int(digits.size());
+			while (nrSignificant > 1 && digits[size_t(nrSignificant - 1)] == 0 && prec > 0) { --nrSignificant; --prec; }
+			digits.resize(size_t(nrSignificant));
+		}
+	}
+	else if (scientific) {
+		if (!zero) exponent = multi_double_to_digits(magnitude, prec + 1, digits);
+		else digits.assign(size_t(prec) + 1, 0);
+	}
+	else {
+		// fixed: the number of digits depends on the exponent of the value
+		if (!zero) {
+			exponent = int(std::floor(std::log10(double(magnitude))));
+			int nrDigits = exponent + 1 + prec;
+			if (nrDigits > 0) {
+				int estimate = exponent;
+				exponent = multi_double_to_digits(magnitude, nrDigits, digits);
+				// the estimate of the exponent by the leading component may be one too large
+				if (exponent < estimate && nrDigits > 1) exponent = multi_double_to_digits(magnitude, nrDigits - 1, digits);
+				// rounding may carry into a new leading digit
+				if (int(digits.size()) < exponent + 1 + prec) digits.push_back(0);
+			}
+			else {
+				digits.clear();
+				zero = true;
+				exponent = 0;
+			}
+		}
+		if (zero) exponent = 0;
+	}
+
+	if (scientific) {
+		s += char('0' + digits[0]);
+		if (prec > 0 || showpoint) s += '.';
+		for (int i = 1; i <= prec; ++i) s += char('0' + (size_t(i) < digits.size() ? digits[size_t(i)] : 0));
+		s += (uppercase ? 'E' : 'e');
+		s += (exponent < 0 ? '-' : '+');
+		int absExponent = (exponent < 0 ? -exponent : exponent);
+		if (absExponent < 10) s += '0';
+		s += std::to_string(absExponent);
+		return s;
+	}
+	// fixed notation: digit i carries weight 10^(exponent - i)
+	auto digitAt = [&](int weight) {
+		int i = exponent - weight;
+		if (zero || i < 0 || size_t(i) >= digits.size()) return '0';
+		return char('0' + digits[size_t(i)]);
+	};
+	for (int w = (exponent > 0 ? exponent : 0); w >= 0; --w) s += digitAt(w);
+	if (prec > 0 || showpoint) s += '.';
+	for (int w = -1; w >= -prec; --w) s += digitAt(w);
+	return s;
+}
+
+// read a decimal ASCII format, [+-]digits[.digits][(e|E)[+-]digits], inf, or nan
+template<typename Real>
+bool multi_double_parse(const std::string& number, Real& value) {
+	size_t pos = 0, n = number.size();
+	while (pos < n && std::isspace(static_cast<unsigned char>(number[pos]))) ++pos;
+	bool negative = false;
+	if (pos < n && (number[pos] == '-' || number[pos] == '+')) negative = (number[pos++] == '-');
+	std::string rest;
+	for (size_t i = pos; i < n; ++i) rest += char(std::tolower(static_cast<unsigned char>(number[i])));
+	if (rest == "inf" || rest == "infinity") {
+		value = Real(negative ? -INFINITY : INFINITY);
+		return true;
+	}
+	if (rest == "nan") {
+		value = Real(std::nan(""));
+		return true;
+	}
+	Real r(0.0);
+	int exponent = 0;
+	bool hasDigits = false;
+	while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) {
+		r = r * 10.0 + double(number[pos++] - '0');
+		hasDigits = true;
+	}
+	if (pos < n && number[pos] == '.') {
+		++pos;
+		while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) {
+			r = r * 10.0 + double(number[pos++] - '0');
+			--exponent;
+			hasDigits = true;
+		}
+	}
+	if (!hasDigits) return false;
+	if (pos < n && (number[pos] == 'e' || number[pos] == 'E')) {
+		++pos;
+		bool negativeExponent = false;
+		if (pos < n && (number[pos] == '-' || number[pos] == '+')) negativeExponent = (number[pos++] == '-');
+		if (pos == n) return false;
+		int e = 0;
+		while (pos < n && std::isdigit(static_cast<unsigned char>(number[pos]))) {
+			if (e < 100000) e = 10 * e + (number[pos] - '0');
+			++pos;
+		}
+		exponent += (negativeExponent ? -e : e);
+	}
+	if (pos != n) return false;
+	if (!r.iszero()) {
+		if (exponent > 308) {
+			r *= multi_double_power_of_ten<Real>(308);
+			exponent -= 308;
+		}
+		if (exponent < -300) {
+			r /= multi_double_power_of_ten<Real>(300);
+			exponent += 300;
+		}
+		if (exponent > 0) r *= multi_double_power_of_ten<Real>(exponent);
+		if (exponent < 0) r /= multi_double_power_of_ten<Real>(-exponent);
+	}
+	value = (negative ? -r : r);
+	return true;
+}
+
+} // namespace sw::universal::internal
@@ -0,0 +1,84 @@
+#pragma once
+// multi_double_functions.hpp: mathematical library of the multi-component floating-point types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <type_traits>
+#include <universal/number/shared/multi_double_math.hpp>
+
+/*
+   The public math functions of dd_real and qd_real, written once over the kernels in
+   multi_double_math.hpp. They only participate in overload resolution for the types
+   that specialize multi_double_traits.
+ */
+
+namespace sw::universal {
+
+template<typename Real, typename = void>
+struct is_multi_double_trait : std::false_type {};
+template<typename Real>
+struct is_multi_double_trait<Real, std::void_t<decltype(multi_double_traits<Real>::components)>> : std::true_type {};
+
+template<typename Real>
+constexpr bool is_multi_double = is_multi_double_trait<Real>::value;
+
+template<typename Real, typename Type = Real>
+using enable_if_multi_double = std::enable_if_t<is_multi_double<Real>, Type>;
+
+////////////////////////    classification   /////////////////////////////////
+
+template<typename Real> enable_if_multi_double<Real, bool> isnan(const Real& a) { return a.isnan(); }
+template<typename Real> enable_if_multi_double<Real, bool> isinf(const Real& a) { return a.isinf(); }
+template<typename Real> enable_if_multi_double<Real, bool> isfinite(const Real& a) { return a.isfinite(); }
+template<typename Real> enable_if_multi_double<Real, bool> signbit(const Real& a) { return std::signbit(double(a)); }
+template<typename Real> enable_if_multi_double<Real> copysign(const Real& a, const Real& b) { return (signbit(a) != signbit(b) ? -a : a); }
+
+////////////////////////    truncation   /////////////////////////////////
+
+template<typename Real> enable_if_multi_double<Real> trunc(const Real& a) { return (a.isneg() ? ceil(a) : floor(a)); }
+template<typename Real> enable_if_multi_double<Real> round(const Real& a) { return internal::md_nint(a); }
+template<typename Real> enable_if_multi_double<Real> fmod(const Real& a, const Real& b) { return a - trunc(a / b) * b; }
+
+template<typename Real> enable_if_multi_double<Real> fmin(const Real& a, const Real& b) { return (b < a ? b : a); }
+template<typename Real> enable_if_multi_double<Real> fmax(const Real& a, const Real& b) { return (a < b ? b : a); }
+template<typename Real> enable_if_multi_double<Real> fma(const Real& a, const Real& b, const Real& c) { return a * b + c; }
+
+////////////////////////    exponent and logarithm   /////////////////////////////////
+
+template<typename Real> enable_if_multi_double<Real> exp(const Real& a) { return internal::md_exp(a); }
+template<typename Real> enable_if_multi_double<Real> exp2(const Real& a) { return internal::md_exp2(a); }
+template<typename Real> enable_if_multi_double<Real> exp10(const Real& a) { return internal::md_exp(a * multi_double_traits<Real>::ln10); }
+template<typename Real> enable_if_multi_double<Real> expm1(const Real& a) { return internal::md_expm1(a); }
+template<typename Real> enable_if_multi_double<Real> log(const Real& a) { return internal::md_log(a); }
+template<typename Real> enable_if_multi_double<Real> log2(const Real& a) { return internal::md_log2(a); }
+template<typename Real> enable_if_multi_double<Real> log10(const Real& a) { return internal::md_log10(a); }
+template<typename Real> enable_if_multi_double<Real> log1p(const Real& a) { return internal::md_log1p(a); }
+
+template<typename Real> enable_if_multi_double<Real> pow(const Real& a, const Real& b) { return internal::md_pow(a, b); }
+template<typename Real> enable_if_multi_double<Real> pow(const Real& a, int n) { return internal::md_npwr(a, n); }
+template<typename Real> enable_if_multi_double<Real> cbrt(const Real& a) { return internal::md_cbrt(a); }
+template<typename Real> enable_if_multi_double<Real> hypot(const Real& a, const Real& b) { return internal::md_hypot(a, b); }
+
+////////////////////////    trigonometry   /////////////////////////////////
+
+template<typename Real> enable_if_multi_double<Real> sin(const Real& a) { return internal::md_sin(a); }
+template<typename Real> enable_if_multi_double<Real> cos(const Real& a) { return internal::md_cos(a); }
+template<typename Real> enable_if_multi_double<Real> tan(const Real& a) { return internal::md_tan(a); }
+template<typename Real> enable_if_multi_double<Real, void> sincos(const Real& a, Real& s, Real& c) { internal::md_sincos(a, s, c); }
+template<typename Real> enable_if_multi_double<Real> asin(const Real& a) { return internal::md_asin(a); }
+template<typename Real> enable_if_multi_double<Real> acos(const Real& a) { return internal::md_acos(a); }
+template<typename Real> enable_if_multi_double<Real> atan(const Real& a) { return internal::md_atan(a); }
+template<typename Real> enable_if_multi_double<Real> atan2(const Real& y, const Real& x) { return internal::md_atan2(y, x); }
+
+////////////////////////    hyperbolic   /////////////////////////////////
+
+template<typename Real> enable_if_multi_double<Real> sinh(const Real& a) { return internal::md_sinh(a); }
+template<typename Real> enable_if_multi_double<Real> cosh(const Real& a) { return internal::md_cosh(a); }
+template<typename Real> enable_if_multi_double<Real> tanh(const Real& a) { return internal::md_tanh(a); }
+template<typename Real> enable_if_multi_double<Real> asinh(const Real& a) { return internal::md_asinh(a); }
+template<typename Real> enable_if_multi_double<Real> acosh(const Real& a) { return internal::md_acosh(a); }
+template<typename Real> enable_if_multi_double<Real> atanh(const Real& a) { return internal::md_atanh(a); }
+
+} // namespace sw::universal
@@ -0,0 +1,64 @@
+#pragma once
+// multi_double_limits.hpp: numeric_limits members common to the multi-component floating-point types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <limits>
+
+/*
+   dd_real and qd_real share the dynamic range of their leading double: only the precision
+   dependent members, min, epsilon, the digits, and the minimum exponents, differ by type.
+   The std::numeric_limits specialization of each type derives from this base and adds those.
+ */
+
+namespace sw::universal::internal {
+
+template<typename Real>
+class multi_double_numeric_limits {
+public:
+	static constexpr bool is_specialized = true;
+	static constexpr Real max() { // return maximum value
+		return Real(sw::universal::SpecificValue::maxpos);
+	} 
+	static constexpr Real lowest() { // return most negative value
+		return Real(sw::universal::SpecificValue::maxneg);
+	} 
+	static constexpr Real round_error() { // return largest rounding error
+		return Real(0.5);
+	}
+	static constexpr Real denorm_min() {  // return minimum denormalized value
+		return Real(std::numeric_limits<double>::denorm_min());
+	}
+	static constexpr Real infinity() { // return positive infinity
+		return Real(std::numeric_limits<double>::infinity());
+	}
+	static constexpr Real quiet_NaN() { // return non-signaling NaN
+		return Real(std::numeric_limits<double>::quiet_NaN());
+	}
+	static constexpr Real signaling_NaN() { // return signaling NaN
+		return Real(std::numeric_limits<double>::signaling_NaN());
+	}
+
+	static constexpr bool is_signed   = true;
+	static constexpr bool is_integer  = false;
+	static constexpr bool is_exact    = false;
+	static constexpr int radix        = 2;
+
+	static constexpr int max_exponent   = std::numeric_limits<double>::max_exponent;
+	static constexpr int max_exponent10 = std::numeric_limits<double>::max_exponent10;
+	static constexpr bool has_infinity  = true;
+	static constexpr bool has_quiet_NaN = true;
+	static constexpr bool has_signaling_NaN = true;
+	static constexpr std::float_denorm_style has_denorm = std::denorm_present;
+	static constexpr bool has_denorm_loss = false;
+
+	static constexpr bool is_iec559 = false;
+	static constexpr bool is_bounded = true;
+	static constexpr bool is_modulo = false;
+	static constexpr bool traps = false;
+	static constexpr bool tinyness_before = false;
+	static constexpr std::float_round_style round_style = std::round_to_nearest;
+};
+
+} // namespace sw::universal::internal
@@ -0,0 +1,395 @@
+#pragma once
+// multi_double_math.hpp: elementary functions for multi-component floating-point types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <limits>
+
+/*
+   The double-double and quad-double types share the elementary function kernels below,
+   following the algorithms of the QD library of Hida, Li, and Bailey: argument reduction
+   followed by a Taylor series, or Newton iterations on the inverse function that start
+   from the double precision result. Each Newton step doubles the number of correct bits,
+   so a type with n components needs log2(n) of them.
+
+   A type opts in by specializing multi_double_traits with its number of components, the
+   number of Newton steps, and its constants. The kernels call sqrt, ldexp, and floor
+   on the type through argument dependent lookup.
+ */
+
+namespace sw::universal {
+
+template<typename Real> struct multi_double_traits;
+
+namespace internal {
+
+// nearest integer of a value whose magnitude is below 2^52, ties away from zero
+template<typename Real>
+Real md_nint(const Real& a) {
+	Real half = (a.isneg() ? Real(-0.5) : Real(0.5));
+	Real t = a + half;
+	return (a.isneg() ? -floor(-t) : floor(t));
+}
+
+// a^n by repeated squaring
+template<typename Real>
+Real md_npwr(const Real& a, long long n) {
+	if (n == 0) return Real(1.0);
+	bool reciprocal = (n < 0);
+	unsigned long long e = (reciprocal ? 0ull - (unsigned long long)(n) : (unsigned long long)(n));
+	Real result(1.0), base(a);
+	for (; e > 0; e >>= 1) {
+		if (e & 1) result *= base;
+		if (e > 1) base *= base;
+	}
+	return (reciprocal ? Real(1.0) / result : result);
+}
+
+// e^x - 1 for |x| <= ln2/2: a Taylor series on x/2^k followed by k doublings e^2x - 1 = 2(e^x - 1) + (e^x - 1)^2
+template<typename Real>
+Real md_expm1_reduced(const Real& x) {
+	constexpr int k = (multi_double_traits<Real>::components > 2 ? 16 : 9);
+	const double threshold = double(std::numeric_limits<Real>::epsilon()) * std::ldexp(1.0, -k);
+	Real r = ldexp(x, -k);
+	Real s(r), term(r);
+	for (int i = 2; i < 100; ++i) {
+		term *= r;
+		term /= double(i);
+		s += term;
+		if (std::fabs(double(term)) <= threshold * std::fabs(double(s))) break;
+	}
+	for (int i = 0; i < k; ++i) s = ldexp(s, 1) + s * s;
+	return s;
+}
+
+template<typename Real>
+Real md_exp(const Real& x) {
+	using Traits = multi_double_traits<Real>;
+	if (x.isnan()) return x;
+	double hi = double(x);
+	if (hi > 709.79) return Real(INFINITY);
+	if (hi < -745.2) return Real(0.0);
+	if (x.iszero()) return Real(1.0);
+	double m = std::floor(hi / double(Traits::ln2) + 0.5);
+	Real r = x - Traits::ln2 * m;
+	return ldexp(md_expm1_reduced(r) + 1.0, int(m));
+}
+
+// 2^x = 2^n 2^(x - n) for the nearest integer n, which is exact for integral x
+template<typename Real>
+Real md_exp2(const Real& x) {
+	using Traits = multi_double_traits<Real>;
+	if (x.isnan()) return x;
+	double hi = double(x);
+	if (hi > 1024.0) return Real(INFINITY);
+	if (hi < -1075.0) return Real(0.0);
+	Real n = md_nint(x);
+	Real r = x - n;
+	return ldexp(r.iszero() ? Real(1.0) : md_exp(r * Traits::ln2), int(double(n)));
+}
+
+template<typename Real>
+Real md_expm1(const Real& x) {
+	using Traits = multi_double_traits<Real>;
+	if (std::fabs(double(x)) <= 0.5 * double(Traits::ln2)) return md_expm1_reduced(x);
+	return md_exp(x) - 1.0;
+}
+
+// Newton iterations x <- x + a e^-x - 1 on the root of e^x = a; near a = 1 the correction
+// is evaluated as a expm1(-x) + (a - 1) to keep the relative precision of the small result
+template<typename Real>
+Real md_log(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.isnan()) return a;
+	if (a.iszero()) return Real(-INFINITY);
+	if (a.isneg()) return Real(std::numeric_limits<double>::quiet_NaN());
+	if (a.isinf()) return a;
+	if (a.isone()) return Real(0.0);
+	// log(a) = log(m) + e ln2 with m in [sqrt(1/2), sqrt(2)): the Newton iterations square the
+	// absolute error of the initial guess, which is small only for small results
+	int exponent{ 0 };
+	Real m = frexp(a, &exponent);
+	if (double(m) < 0.7071067811865476) {
+		m = ldexp(m, 1);
+		--exponent;
+	}
+	bool nearOne = std::fabs(double(m) - 1.0) < 0.5;
+	Real x(nearOne ? std::log1p(double(m - 1.0)) : std::log(double(m)));
+	for (int i = 0; i < Traits::newtonIterations; ++i) {
+		if (nearOne) x += m * md_expm1(-x) + (m - 1.0); else x = x + m * md_exp(-x) - 1.0;
+	}
+	if (exponent != 0) x += Traits::ln2 * double(exponent);
+	return x;
+}
+
+// exact for powers of two
+template<typename Real>
+Real md_log2(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.ispos() && a.isfinite()) {
+		int exponent{ 0 };
+		Real m = frexp(a, &exponent);
+		if (m == Real(0.5)) return Real(double(exponent - 1));
+	}
+	return md_log(a) * Traits::log2e;
+}
+
+// exact for the powers of ten that are representable
+template<typename Real>
+Real md_log10(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.ispos() && a.isfinite() && double(a) >= 1.0) {
+		int k = int(std::lround(std::log10(double(a))));
+		if (k <= 22 * Traits::components && md_npwr(Real(10.0), k) == a) return Real(double(k));
+	}
+	return md_log(a) * Traits::log10e;
+}
+
+template<typename Real>
+Real md_log1p(const Real& x) {
+	Real u = x + 1.0;
+	if (u == Real(1.0)) return x;
+	return md_log(u) * (x / (u - 1.0));
+}
+
+template<typename Real>
+Real md_pow(const Real& a, const Real& b) {
+	if (a.isnan() || b.isnan()) return Real(std::numeric_limits<double>::quiet_NaN());
+	if (b.iszero()) return Real(1.0);
+	Real n = floor(b);
+	bool integral = (n == b) && std::fabs(double(b)) < 9.0e15;
+	if (integral) return md_npwr(a, (long long)(double(n)));
+	if (a.iszero()) return (b.isneg() ? Real(INFINITY) : Real(0.0));
+	if (a.isneg()) return Real(std::numeric_limits<double>::quiet_NaN());
+	return md_exp(b * md_log(a));
+}
+
+// sin(t) for |t| <= pi/4 by its Taylor series, cos(t) = sqrt(1 - sin^2(t)) is well conditioned in that range
+template<typename Real>
+void md_sincos_reduced(const Real& t, Real& sin_t, Real& cos_t) {
+	if (t.iszero()) {
+		sin_t = Real(0.0);
+		cos_t = Real(1.0);
+		return;
+	}
+	const double threshold = 0.5 * double(std::numeric_limits<Real>::epsilon());
+	Real x2 = -(t * t);
+	Real s(t), term(t);
+	for (int i = 1; i < 100; ++i) {
+		term *= x2;
+		term /= double((2 * i) * (2 * i + 1));
+		s += term;
+		if (std::fabs(double(term)) <= threshold * std::fabs(double(s))) break;
+	}
+	sin_t = s;
+	cos_t = sqrt(Real(1.0) - s * s);
+}
+
+// reduce modulo 2pi, then to the nearest multiple j of pi/2
+template<typename Real>
+void md_sincos(const Real& a, Real& sin_a, Real& cos_a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.isnan() || a.isinf()) {
+		sin_a = cos_a = Real(std::numeric_limits<double>::quiet_NaN());
+		return;
+	}
+	Real z = md_nint(a / Traits::twopi);
+	Real r = a - Traits::twopi * z;
+	double j = std::floor(double(r) / double(Traits::pi_2) + 0.5);
+	Real t = r - Traits::pi_2 * j;
+	Real sin_t, cos_t;
+	md_sincos_reduced(t, sin_t, cos_t);
+	switch (int(j)) {
+	case 0:
+		sin_a = sin_t; cos_a = cos_t;
+		break;
+	case 1:
+		sin_a = cos_t; cos_a = -sin_t;
+		break;
+	case -1:
+		sin_a = -cos_t; cos_a = sin_t;
+		break;
+	default:
+		sin_a = -sin_t; cos_a = -cos_t;
+		break;
+	}
+}
+
+template<typename Real>
+Real md_sin(const Real& a) {
+	if (a.iszero()) return a;
+	Real s, c;
+	md_sincos(a, s, c);
+	return s;
+}
+
+template<typename Real>
+Real md_cos(const Real& a) {
+	if (a.iszero()) return Real(1.0);
+	Real s, c;
+	md_sincos(a, s, c);
+	return c;
+}
+
+template<typename Real>
+Real md_tan(const Real& a) {
+	if (a.iszero()) return a;
+	Real s, c;
+	md_sincos(a, s, c);
+	return s / c;
+}
+
+// Newton iterations on sin(z) = y/r or cos(z) = x/r, whichever is better conditioned
+template<typename Real>
+Real md_atan2(const Real& y, const Real& x) {
+	using Traits = multi_double_traits<Real>;
+	if (x.isnan() || y.isnan()) return Real(std::numeric_limits<double>::quiet_NaN());
+	if (x.iszero()) {
+		if (y.iszero()) return Real(0.0);
+		return (y.ispos() ? Traits::pi_2 : -Traits::pi_2);
+	}
+	if (y.iszero()) return (x.ispos() ? Real(0.0) : Traits::pi);
+	if (x.isinf() || y.isinf()) return Real(std::atan2(double(y), double(x)));
+	if (x == y) return (y.ispos() ? Traits::pi_4 : -Traits::pi_4 * 3.0);
+	if (x == -y) return (y.ispos() ? Traits::pi_4 * 3.0 : -Traits::pi_4);
+
+	// scale away from the extremes of the exponent range before normalizing
+	int ex{ 0 }, ey{ 0 };
+	(void)frexp(x, &ex);
+	(void)frexp(y, &ey);
+	int e = (ex > ey ? ex : ey);
+	Real xs = ldexp(x, -e), ys = ldexp(y, -e);
+	Real r = sqrt(xs * xs + ys * ys);
+	Real xx = xs / r, yy = ys / r;
+
+	Real z(std::atan2(double(y), double(x)));
+	Real sin_z, cos_z;
+	for (int i = 0; i < Traits::newtonIterations; ++i) {
+		md_sincos(z, sin_z, cos_z);
+		if (std::fabs(double(xx)) > std::fabs(double(yy))) z += (yy - sin_z) / cos_z;
+		else z -= (xx - cos_z) / sin_z;
+	}
+	return z;
+}
+
+template<typename Real>
+Real md_atan(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.isinf()) return (a.ispos() ? Traits::pi_2 : -Traits::pi_2);
+	return md_atan2(a, Real(1.0));
+}
+
+template<typename Real>
+Real md_asin(const Real& a) {
+	Real abs_a = (a.isneg() ? -a : a);
+	if (abs_a > Real(1.0)) return Real(std::numeric_limits<double>::quiet_NaN());
+	return md_atan2(a, sqrt((Real(1.0) - a) * (Real(1.0) + a)));
+}
+
+template<typename Real>
+Real md_acos(const Real& a) {
+	Real abs_a = (a.isneg() ? -a : a);
+	if (abs_a > Real(1.0)) return Real(std::numeric_limits<double>::quiet_NaN());
+	return md_atan2(sqrt((Real(1.0) - a) * (Real(1.0) + a)), a);
+}
+
+// beyond this argument e^-|x| is below the precision of e^|x|, and sinh and cosh are e^(|x| - ln2),
+// which stays finite up to the overflow threshold of the result instead of the one of e^|x|
+constexpr double md_hyperbolic_cutoff = 700.0;
+
+// sinh(x) = (E + E/(E + 1))/2 with E = e^|x| - 1 does not cancel for small arguments,
+// and the odd symmetry keeps E + 1 away from the cancellation of e^x - 1 near -1
+template<typename Real>
+Real md_sinh(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.iszero() || a.isnan() || a.isinf()) return a;
+	Real x = (a.isneg() ? -a : a);
+	Real result;
+	if (double(x) > md_hyperbolic_cutoff) {
+		result = md_exp(x - Traits::ln2);
+	}
+	else {
+		Real E = md_expm1(x);
+		result = ldexp(E + E / (E + 1.0), -1);
+	}
+	return (a.isneg() ? -result : result);
+}
+
+template<typename Real>
+Real md_cosh(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.isnan()) return a;
+	if (a.isinf()) return Real(INFINITY);
+	if (a.iszero()) return Real(1.0);
+	if (std::fabs(double(a)) > md_hyperbolic_cutoff) return md_exp((a.isneg() ? -a : a) - Traits::ln2);
+	Real ea = md_exp(a);
+	return ldexp(ea + Real(1.0) / ea, -1);
+}
+
+// tanh(x) = E/(E + 2) with E = e^2x - 1
+template<typename Real>
+Real md_tanh(const Real& a) {
+	if (a.iszero() || a.isnan()) return a;
+	// beyond 80 tanh rounds to one at 212 bits of precision
+	if (std::fabs(double(a)) > 80.0) return (a.isneg() ? Real(-1.0) : Real(1.0));
+	Real E = md_expm1(ldexp(a, 1));
+	return E / (E + 2.0);
+}
+
+template<typename Real>
+Real md_asinh(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.iszero() || a.isnan() || a.isinf()) return a;
+	Real x = (a.isneg() ? -a : a);
+	Real result;
+	if (double(x) > 1.0e150) result = md_log(x) + Traits::ln2;  // the square would overflow
+	else result = md_log(x + sqrt(x * x + 1.0));
+	return (a.isneg() ? -result : result);
+}
+
+template<typename Real>
+Real md_acosh(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.isnan()) return a;
+	if (a < Real(1.0)) return Real(std::numeric_limits<double>::quiet_NaN());
+	if (a.isinf()) return a;
+	if (double(a) > 1.0e150) return md_log(a) + Traits::ln2;
+	return md_log(a + sqrt((a - 1.0) * (a + 1.0)));
+}
+
+template<typename Real>
+Real md_atanh(const Real& a) {
+	if (a.iszero() || a.isnan()) return a;
+	Real x = (a.isneg() ? -a : a);
+	if (x > Real(1.0)) return Real(std::numeric_limits<double>::quiet_NaN());
+	if (x == Real(1.0)) return (a.isneg() ? Real(-INFINITY) : Real(INFINITY));
+	// atanh(x) = log1p(2x/(1 - x))/2 keeps the bits of small arguments that 1 + x would round away
+	Real result = ldexp(md_log1p(ldexp(x, 1) / (Real(1.0) - x)), -1);
+	return (a.isneg() ? -result : result);
+}
+
+// Newton iterations y <- (2y + a/y^2)/3
+template<typename Real>
+Real md_cbrt(const Real& a) {
+	using Traits = multi_double_traits<Real>;
+	if (a.iszero() || a.isnan() || a.isinf()) return a;
+	Real y(std::cbrt(double(a)));
+	for (int i = 0; i < Traits::newtonIterations; ++i) y = (ldexp(y, 1) + a / (y * y)) / 3.0;
+	return y;
+}
+
+template<typename Real>
+Real md_hypot(const Real& x, const Real& y) {
+	if (x.isinf() || y.isinf()) return Real(INFINITY);
+	if (x.isnan() || y.isnan()) return Real(std::numeric_limits<double>::quiet_NaN());
+	Real ax = (x.isneg() ? -x : x), ay = (y.isneg() ? -y : y);
+	Real big = (ax > ay ? ax : ay), small = (ax > ay ? ay : ax);
+	if (big.iszero()) return big;
+	Real ratio = small / big;
+	return big * sqrt(ratio * ratio + 1.0);
+}
+
+} // namespace internal
+} // namespace sw::universal
@@ -0,0 +1,123 @@
+#pragma once
+// significand_sqrt.hpp: table-seeded integer square root and reciprocal square root of a significand
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <universal/number/shared/wide_multiply.hpp>
+
+/*
+   The square root of a floating-point or posit value reduces to the square root of a significand
+   x in [1, 4) once the scale has been made even. The significand is passed as the 64-bit integer
+   X = x * 2^62, which holds every significand of up to 62 fraction bits exactly.
+
+   The kernels seed 1/sqrt(x) from a 96-entry table indexed by the leading 7 bits of X, refine it
+   with a fixed number of Newton steps y' = y(3 - xy^2)/2 in 1.63 fixed-point, take one correction
+   step against the exact integer residual, and finish with two exact comparisons. The results are
+   the truncated root and reciprocal root with 64 significant bits, plus an inexact flag that serves
+   as sticky bit, so a single round-to-nearest of the result is a correctly rounded sqrt/rsqrt for
+   every target with at most 62 fraction bits. The instruction count does not depend on the value.
+ */
+
+namespace sw::universal::internal {
+
+	// 1/sqrt(x) at the midpoints of the 96 intervals [i/32, (i+1)/32) of [1, 4), in 1.15 format
+	constexpr uint16_t rsqrt_seed[96] = {
+		0x7f03, 0x7d1a, 0x7b46, 0x7987, 0x77da, 0x763e, 0x74b2, 0x7336, 0x71c7, 0x7066, 0x6f12, 0x6dc9,
+		0x6c8b, 0x6b58, 0x6a2f, 0x690f, 0x67f9, 0x66ea, 0x65e4, 0x64e6, 0x63ef, 0x62fe, 0x6215, 0x6132,
+		0x6054, 0x5f7d, 0x5eab, 0x5ddf, 0x5d17, 0x5c55, 0x5b97, 0x5ade, 0x5a28, 0x5978, 0x58cb, 0x5822,
+		0x577c, 0x56db, 0x563d, 0x55a2, 0x550a, 0x5475, 0x53e4, 0x5355, 0x52c9, 0x5240, 0x51b9, 0x5135,
+		0x50b4, 0x5035, 0x4fb8, 0x4f3d, 0x4ec5, 0x4e4f, 0x4dda, 0x4d68, 0x4cf8, 0x4c8a, 0x4c1d, 0x4bb2,
+		0x4b49, 0x4ae2, 0x4a7c, 0x4a18, 0x49b6, 0x4955, 0x48f5, 0x4897, 0x483a, 0x47df, 0x4785, 0x472c,
+		0x46d5, 0x467f, 0x462a, 0x45d6, 0x4583, 0x4532, 0x44e2, 0x4492, 0x4444, 0x43f7, 0x43ab, 0x4360,
+		0x4316, 0x42cc, 0x4284, 0x423d, 0x41f6, 0x41b1, 0x416c, 0x4128, 0x40e5, 0x40a2, 0x4061, 0x4020,
+	};
+
+	// 1/sqrt(X / 2^62) in 1.63 format to about 60 bits; the Newton steps approach the root from below
+	inline uint64_t rsqrt_estimate(uint64_t X) {
+		uint64_t y = uint64_t(rsqrt_seed[(X >> 57) - 32]) << 48;
+		for (int i = 0; i < 4; ++i) {
+			uint64_t yy = multiply_high(y, y);               // y^2 in 2.62
+			uint64_t xyy = multiply_high(X, yy);             // x*y^2 in 4.60
+			uint64_t d = (uint64_t(3) << 60) - xyy;          // 3 - x*y^2 in 4.60
+			y = multiply_high(y, d) << 3;                    // y*(3 - x*y^2)/2 in 1.63
+		}
+		return y;
+	}
+
+	// floor(sqrt(X * 2^64)) for X in [2^62, 2^64), which is sqrt(X / 2^62) in 1.63 format
+	inline uint64_t significand_sqrt(uint64_t X, bool& inexact) {
+		uint64_t y = rsqrt_estimate(X);
+		uint64_t r = multiply_high(X, y) << 2;
+		// one Newton step on the exact residual X*2^64 - r^2, which is small enough for 80 bits
+		uint64_t hi, lo;
+		multiply_64x64(r, r, hi, lo);
+		uint64_t residualLo = 0 - lo;
+		uint64_t residualHi = X - hi - (lo != 0 ? 1 : 0);
+		bool negative = (int64_t(residualHi) < 0);
+		if (negative) {
+			residualHi = ~residualHi + (residualLo == 0 ? 1 : 0);
+			residualLo = 0 - residualLo;
+		}
+		uint64_t residual = (residualHi << 48) | (residualLo >> 16);
+		uint64_t delta = multiply_high(residual, y) >> 47;  // residual / 2r
+		r = (negative ? r - delta : r + delta);
+		// the corrected root is within one unit: settle it with exact comparisons
+		auto exceeds = [X](uint64_t root) {  // root^2 > X * 2^64
+			uint64_t h, l;
+			multiply_64x64(root, root, h, l);
+			return (h > X) || (h == X && l != 0);
+		};
+		if (exceeds(r)) --r;
+		if (r != ~uint64_t(0) && !exceeds(r + 1)) ++r;
+		multiply_64x64(r, r, hi, lo);
+		inexact = (hi != X || lo != 0);
+		return r;
+	}
+
+	// floor(2^64 / sqrt(X / 2^62)) for X in (2^62, 2^64), which is 1/sqrt(X / 2^62) in 0.64 format.
+	// X = 2^62 has the exact reciprocal root 1 that the caller handles.
+	inline uint64_t significand_rsqrt(uint64_t X, bool& inexact) {
+		// q^2 * X compared to 2^190 decides q <= 2^64 / sqrt(x); the product has 192 bits
+		auto product = [X](uint64_t q, uint64_t& w2, uint64_t& w1, uint64_t& w0) {
+			uint64_t qh, ql, a1, a0, b1, b0;
+			multiply_64x64(q, q, qh, ql);
+			multiply_64x64(ql, X, a1, a0);
+			multiply_64x64(qh, X, b1, b0);
+			w0 = a0;
+			w1 = a1 + b0;
+			w2 = b1 + (w1 < a1 ? 1 : 0);
+		};
+		constexpr uint64_t two62 = uint64_t(1) << 62;
+		uint64_t q = rsqrt_estimate(X) << 1;
+		// one Newton step on the exact residual 2^190 - q^2 * X
+		uint64_t w2, w1, w0;
+		product(q, w2, w1, w0);
+		uint64_t r0 = 0 - w0;
+		uint64_t borrow = (w0 != 0 ? 1 : 0);
+		uint64_t r1 = 0 - w1 - borrow;
+		borrow = (w1 != 0 || borrow != 0) ? 1 : 0;
+		uint64_t r2 = two62 - w2 - borrow;
+		bool negative = (int64_t(r2) < 0);
+		if (negative) {
+			r0 = ~r0; r1 = ~r1; r2 = ~r2;
+			if (++r0 == 0 && ++r1 == 0) ++r2;
+		}
+		uint64_t residual = (r2 << 56) | (r1 >> 8);        // |2^190 - q^2 X| / 2^72
+		uint64_t delta = multiply_high(residual, q) >> 55;  // q * residual / 2^191
+		q = (negative ? q - delta : q + delta);
+		// settle the last unit with exact comparisons
+		auto exceeds = [&product](uint64_t root) {  // root^2 * X > 2^190
+			uint64_t p2, p1, p0;
+			product(root, p2, p1, p0);
+			return (p2 > two62) || (p2 == two62 && (p1 | p0) != 0);
+		};
+		if (exceeds(q)) --q;
+		if (q != ~uint64_t(0) && !exceeds(q + 1)) ++q;
+		product(q, w2, w1, w0);
+		inexact = (w2 != two62 || (w1 | w0) != 0);
+		return q;
+	}
+
+}  // namespace sw::universal::internal
@@ -0,0 +1,47 @@
+#pragma once
+// wide_multiply.hpp: portable 64x64 -> 128-bit products and 128-bit remainders on (hi, lo) word pairs
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+
+/*
+   The significand kernels of the square root and of the directed rounding arithmetic, and the
+   modular arithmetic of the integer library, need the full product of two 64-bit words. ISO C++
+   has no 128-bit integer type, so the product is assembled from four 32x32 -> 64-bit partial
+   products. Compilers recognize the pattern and emit a single widening multiply where the target
+   has one.
+ */
+
+namespace sw::universal::internal {
+
+	// full 128-bit product of two 64-bit words
+	inline void multiply_64x64(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+		uint64_t a0 = a & 0xFFFF'FFFFull, a1 = a >> 32, b0 = b & 0xFFFF'FFFFull, b1 = b >> 32;
+		uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+		uint64_t middle = (p00 >> 32) + (p01 & 0xFFFF'FFFFull) + (p10 & 0xFFFF'FFFFull);
+		lo = (middle << 32) | (p00 & 0xFFFF'FFFFull);
+		hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	}
+
+	// upper 64 bits of the product of two 64-bit words
+	inline uint64_t multiply_high(uint64_t a, uint64_t b) {
+		uint64_t hi, lo;
+		multiply_64x64(a, b, hi, lo);
+		return hi;
+	}
+
+	// (hi * 2^64 + lo) mod m for m > 0, by binary long division over the bits of lo
+	inline uint64_t remainder_128x64(uint64_t hi, uint64_t lo, uint64_t m) {
+		uint64_t r = hi % m;
+		for (int i = 63; i >= 0; --i) {
+			// r = 2r + bit mod m, without overflowing the word when r >= 2^63
+			bool carry = (r >> 63) != 0;
+			r = (r << 1) | ((lo >> i) & 1);
+			if (carry || r >= m) r -= m;
+		}
+		return r;
+	}
+
+}  // namespace sw::universal::internal
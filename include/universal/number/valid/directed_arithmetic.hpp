@@ -0,0 +1,256 @@
+#pragma once
+// directed_arithmetic.hpp: exact operations on posit encodings with directed rounding for valid endpoints
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <universal/number/posit/specialized/constexpr_conversion.hpp>
+#include <universal/number/shared/wide_multiply.hpp>
+
+/*
+  A valid endpoint is computed as the exact result of an operation on two posit endpoints,
+  which is then rounded in the direction that keeps the interval rigorous: the lower bound
+  toward -inf, the upper bound toward +inf. The exact result is carried as a sign, a scale,
+  a 64-bit significand with the hidden bit at bit 63, and a sticky bit, which is enough to
+  round any posit of 64 bits or less correctly. The kernels only touch the posit encodings,
+  so they run on the raw bits of the fast posit specializations when those are enabled.
+
+  A NaR endpoint stands for infinity: -inf as lower bound, +inf as upper bound.
+ */
+
+namespace sw::universal::internal {
+
+// an endpoint value, or the exact result of an operation on two endpoints
+struct endpoint_value {
+	bool     zero{ true };
+	bool     inf{ false };
+	bool     nan{ false };    // undefined operations, such as inf / inf
+	bool     sign{ false };
+	bool     sticky{ false }; // the exact value is slightly larger in magnitude than the significand
+	bool     closed{ true };  // the value is attained within the interval
+	int      scale{ 0 };
+	uint64_t significand{ 0 };
+};
+
+// decode a posit encoding as lower (upper == false) or upper endpoint
+template<size_t nbits, size_t es>
+inline endpoint_value decode_endpoint(uint64_t bits, bool closed, bool upper) {
+	constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+	constexpr uint64_t nar = uint64_t(1) << (nbits - 1);
+	endpoint_value v;
+	bits &= encodingMask;
+	v.closed = closed;
+	if (bits == 0) return v;
+	v.zero = false;
+	if (bits == nar) {
+		v.inf = true;
+		v.sign = !upper;
+		v.closed = false;
+		return v;
+	}
+	uint64_t fraction{ 0 };
+	posit_decode<nbits, es>(bits, v.sign, v.scale, fraction);
+	v.significand = (uint64_t(1) << 63) | fraction;
+	return v;
+}
+
+// round an endpoint value to a posit encoding toward +inf (up) or -inf, and report whether
+// the endpoint is attained: the value must be closed and the rounding exact
+template<size_t nbits, size_t es>
+inline uint64_t round_endpoint(const endpoint_value& v, bool up, bool& closed) {
+	closed = false;
+	if (v.zero) { closed = v.closed; return 0; }
+	if (v.inf || v.nan) return uint64_t(1) << (nbits - 1);
+	bool exact{ false };
+	uint64_t bits = posit_encode_directed<nbits, es>(v.sign, v.scale, v.significand & ~(uint64_t(1) << 63), v.sticky, up, exact);
+	closed = v.closed && exact;
+	return bits;
+}
+
+// compare two endpoint values on the extended real line: -1 if a < b, 0 if equal, 1 if a > b
+inline int compare_endpoints(const endpoint_value& a, const endpoint_value& b) {
+	auto magnitude = [](const endpoint_value& v, const endpoint_value& w) {
+		// compare magnitudes of two non-zero values of the same sign
+		if (v.inf != w.inf) return (v.inf ? 1 : -1);
+		if (v.inf) return 0;
+		if (v.scale != w.scale) return (v.scale > w.scale ? 1 : -1);
+		if (v.significand != w.significand) return (v.significand > w.significand ? 1 : -1);
+		if (v.sticky != w.sticky) return (v.sticky ? 1 : -1);
+		return 0;
+	};
+	if (a.zero && b.zero) return 0;
+	if (a.zero) return (b.sign ? 1 : -1);
+	if (b.zero) return (a.sign ? -1 : 1);
+	if (a.sign != b.sign) return (a.sign ? -1 : 1);
+	int m = magnitude(a, b);
+	return (a.sign ? -m : m);
+}
+
+// 128-bit shift and normalization helpers on (hi, lo) pairs of 64-bit words
+// shift right by n, collecting the bits shifted out into sticky
+inline void shr128(uint64_t& hi, uint64_t& lo, int n, bool& sticky) {
+	if (n == 0) return;
+	if (n >= 128) {
+		sticky = sticky || hi != 0 || lo != 0;
+		hi = lo = 0;
+	}
+	else if (n >= 64) {
+		sticky = sticky || lo != 0 || (n > 64 && (hi << (128 - n)) != 0);
+		lo = (n == 64 ? hi : hi >> (n - 64));
+		hi = 0;
+	}
+	else {
+		sticky = sticky || (lo << (64 - n)) != 0;
+		lo = (lo >> n) | (hi << (64 - n));
+		hi >>= n;
+	}
+}
+
+// normalize a non-zero 128-bit magnitude whose binary point sits below bit 'point' into an endpoint value
+inline void normalize128(uint64_t hi, uint64_t lo, int scaleOfPoint, endpoint_value& v) {
+	int msb = 127;
+	if (hi == 0) { hi = lo; lo = 0; msb -= 64; }
+	while (!(hi >> 63)) {
+		hi = (hi << 1) | (lo >> 63);
+		lo <<= 1;
+		--msb;
+	}
+	v.zero = false;
+	v.scale = scaleOfPoint + msb;
+	v.significand = hi;
+	v.sticky = v.sticky || lo != 0;
+}
+
+// exact sum of two finite or infinite endpoint values
+inline endpoint_value exact_add(const endpoint_value& a, const endpoint_value& b) {
+	endpoint_value r;
+	r.closed = a.closed && b.closed;
+	if (a.inf || b.inf) {
+		r.zero = false;
+		r.inf = true;
+		r.sign = (a.inf ? a.sign : b.sign);
+		r.nan = a.inf && b.inf && a.sign != b.sign;
+		r.closed = false;
+		return r;
+	}
+	if (a.zero) { r = b; r.closed = a.closed && b.closed; return r; }
+	if (b.zero) { r = a; r.closed = a.closed && b.closed; return r; }
+	// order the operands by magnitude
+	bool swap = (a.scale < b.scale) || (a.scale == b.scale && a.significand < b.significand);
+	const endpoint_value& big = (swap ? b : a);
+	const endpoint_value& small = (swap ? a : b);
+	// the larger operand with its hidden bit at bit 126 leaves room for the carry
+	uint64_t hi = big.significand >> 1, lo = big.significand << 63;
+	uint64_t shi = small.significand >> 1, slo = small.significand << 63;
+	bool sticky{ false };
+	shr128(shi, slo, big.scale - small.scale, sticky);
+	if (big.sign == small.sign) {
+		lo += slo;
+		hi += shi + (lo < slo ? 1 : 0);
+	}
+	else {
+		// the sticky part of the smaller operand borrows one unit from the difference
+		uint64_t borrow = (sticky ? 1 : 0);
+		uint64_t nlo = lo - slo - borrow;
+		hi = hi - shi - ((lo < slo || (lo - slo) < borrow) ? 1 : 0);
+		lo = nlo;
+	}
+	if (hi == 0 && lo == 0 && !sticky) {
+		r.zero = true;
+		return r;
+	}
+	r.sign = big.sign;
+	r.sticky = sticky;
+	normalize128(hi, lo, big.scale - 126, r);
+	r.closed = a.closed && b.closed;
+	return r;
+}
+
+// exact product of two endpoint values; zero times infinity is zero as infinite endpoints are not attained
+inline endpoint_value exact_mul(const endpoint_value& a, const endpoint_value& b) {
+	endpoint_value r;
+	if (a.zero || b.zero) {
+		// a closed zero is attained whatever the other factor
+		r.closed = (a.zero && a.closed) || (b.zero && b.closed) || (a.closed && b.closed);
+		return r;
+	}
+	r.sign = a.sign != b.sign;
+	r.zero = false;
+	if (a.inf || b.inf) {
+		r.inf = true;
+		r.closed = false;
+		return r;
+	}
+	uint64_t hi, lo;
+	multiply_64x64(a.significand, b.significand, hi, lo);
+	normalize128(hi, lo, a.scale + b.scale - 126, r);
+	r.closed = a.closed && b.closed;
+	return r;
+}
+
+// exact quotient of two endpoint values; the divisor is not zero
+inline endpoint_value exact_div(const endpoint_value& a, const endpoint_value& b) {
+	endpoint_value r;
+	if (a.zero) {
+		r.closed = a.closed;
+		return r;
+	}
+	r.sign = a.sign != b.sign;
+	r.zero = false;
+	if (a.inf || b.inf) {
+		r.inf = a.inf;
+		r.nan = a.inf && b.inf;
+		r.zero = !a.inf;  // finite / inf is an unattained zero
+		r.closed = false;
+		return r;
+	}
+	// posit significands have at most 62 significant bits: the two least significant bits are zero
+	uint64_t A = a.significand >> 1, B = b.significand >> 1;
+	uint64_t q0 = (A >= B ? 1 : 0);
+	uint64_t rem = A - (q0 ? B : 0);
+	uint64_t q{ 0 };
+	for (int i = 0; i < 64; ++i) {
+		rem <<= 1;
+		q <<= 1;
+		if (rem >= B) {
+			rem -= B;
+			q |= 1;
+		}
+	}
+	r.sticky = rem != 0;
+	if (q0) {
+		r.scale = a.scale - b.scale;
+		r.sticky = r.sticky || (q & 1);
+		r.significand = (uint64_t(1) << 63) | (q >> 1);
+	}
+	else {
+		r.scale = a.scale - b.scale - 1;
+		r.significand = q;
+	}
+	r.closed = a.closed && b.closed;
+	return r;
+}
+
+// exact quotient for posits of 32 bits or less: the significands fit 32 bits and a native division suffices
+inline endpoint_value exact_div32(const endpoint_value& a, const endpoint_value& b) {
+	if (a.zero || a.inf || b.inf) return exact_div(a, b);
+	endpoint_value r;
+	r.zero = false;
+	r.sign = a.sign != b.sign;
+	uint64_t A = a.significand >> 32, B = b.significand >> 32;
+	uint64_t q = (A << 32) / B;
+	r.sticky = (A << 32) % B != 0;
+	if (q >> 32) {
+		r.scale = a.scale - b.scale;
+		r.significand = q << 31;
+	}
+	else {
+		r.scale = a.scale - b.scale - 1;
+		r.significand = q << 32;
+	}
+	r.closed = a.closed && b.closed;
+	return r;
+}
+
+}  // namespace sw::universal::internal
@@ -6,7 +6,9 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 #include <limits>
+#include <type_traits>
 #include <universal/number/posit/posit_impl.hpp>
+#include <universal/number/valid/directed_arithmetic.hpp>
 
 namespace sw::universal {
 
@@ -18,16 +20,154 @@ class valid {
 
 	template <typename T>
 	valid<nbits, es>& _assign(const T& rhs) {
-		constexpr int fbits = std::numeric_limits<T>::digits - 1;
-		internal::value<fbits> v((T)rhs);
+		// integers are converted exactly through the 64-bit significand of long double
+		using Real = std::conditional_t<std::is_floating_point_v<T>, T, long double>;
+		Real v = Real(rhs);
+		if (v != v || v == std::numeric_limits<Real>::infinity() || v == -std::numeric_limits<Real>::infinity()) {
+			setinclusive();
+			return *this;
+		}
+		if (v == Real(0)) {
+			clear();
+			return *this;
+		}
+		if constexpr (nbits <= 64) {
+			bool sign{ false }, sticky{ false };
+			int scale{ 0 };
+			uint64_t fraction{ 0 };
+			native_decompose(v, sign, scale, fraction, sticky);
+			lb.setbits(posit_encode_directed<nbits, es>(sign, scale, fraction, sticky, false, lubit));
+			ub.setbits(posit_encode_directed<nbits, es>(sign, scale, fraction, sticky, true, uubit));
+		}
+		else {
+			// round to nearest and widen by one encoding when the value is not represented exactly
+			lb = v;
+			ub = lb;
+			lubit = uubit = (Real(lb) == v);
+			if (!lubit) {
+				if (Real(lb) > v) --lb; else ++ub;
+			}
+		}
+		return *this;
+	}
 
+	// +1 when the interval [l, u] lies above zero, -1 when it lies below zero, 0 when it touches zero
+	static int side(const sw::universal::posit<nbits, es>& l, const sw::universal::posit<nbits, es>& u) {
+		constexpr uint64_t encodingMask = (nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1);
+		constexpr uint64_t signMask = uint64_t(1) << (nbits - 1);
+		uint64_t lbits = uint64_t(l.encoding()) & encodingMask, ubits = uint64_t(u.encoding()) & encodingMask;
+		if (lbits != 0 && !(lbits & signMask)) return 1;
+		if ((ubits & signMask) && ubits != signMask) return -1;
+		return 0;
+	}
+
+	// valid arithmetic for posits of 64 bits or less: exact endpoint operations rounded outward
+	enum class opcode { add, sub, mul, div };
+	template<opcode op>
+	valid& _apply(const valid& rhs) {
+		using namespace sw::universal::internal;
+		endpoint_value alb = decode_endpoint<nbits, es>(lb.encoding(), lubit, false);
+		endpoint_value aub = decode_endpoint<nbits, es>(ub.encoding(), uubit, true);
+		endpoint_value blb = decode_endpoint<nbits, es>(rhs.lb.encoding(), rhs.lubit, false);
+		endpoint_value bub = decode_endpoint<nbits, es>(rhs.ub.encoding(), rhs.uubit, true);
+		endpoint_value lower, upper;
+		if constexpr (op == opcode::add) {
+			lower = exact_add(alb, blb);
+			upper = exact_add(aub, bub);
+		}
+		else if constexpr (op == opcode::sub) {
+			bub.sign = !bub.sign;
+			blb.sign = !blb.sign;
+			lower = exact_add(alb, bub);
+			upper = exact_add(aub, blb);
+		}
+		else {
+			if constexpr (op == opcode::div) {
+				// a divisor that reaches zero maps the quotient onto the whole projective line
+				if (compare_endpoints(blb, endpoint_value{}) <= 0 && compare_endpoints(bub, endpoint_value{}) >= 0) {
+					setinclusive();
+					return *this;
+				}
+			}
+			auto apply = [](const endpoint_value& x, const endpoint_value& y) {
+				if constexpr (op == opcode::mul) return exact_mul(x, y);
+				else if constexpr (nbits <= 32) return exact_div32(x, y);
+				else return exact_div(x, y);
+			};
+			// when neither interval touches zero, the signs select the two endpoint pairs that bound the result
+			int aside = side(lb, ub), bside = side(rhs.lb, rhs.ub);
+			if (aside != 0 && bside != 0) {
+				bool blower = (op == opcode::mul) == (aside > 0);  // b's lower endpoint enters the lower bound
+				lower = apply(bside > 0 ? alb : aub, blower ? blb : bub);
+				upper = apply(bside > 0 ? aub : alb, blower ? bub : blb);
+				lb.setbits(round_endpoint<nbits, es>(lower, false, lubit));
+				ub.setbits(round_endpoint<nbits, es>(upper, true, uubit));
+				return *this;
+			}
+			endpoint_value candidates[4];
+			const endpoint_value* a[2] = { &alb, &aub };
+			const endpoint_value* b[2] = { &blb, &bub };
+			for (int i = 0; i < 4; ++i) candidates[i] = apply(*a[i >> 1], *b[i & 1]);
+			int first = 0;
+			while (first < 3 && candidates[first].nan) ++first;
+			lower = upper = candidates[first];
+			for (int i = first + 1; i < 4; ++i) {
+				if (candidates[i].nan) continue;
+				int lc = compare_endpoints(candidates[i], lower);
+				if (lc < 0 || (lc == 0 && candidates[i].closed)) lower = candidates[i];
+				int uc = compare_endpoints(candidates[i], upper);
+				if (uc > 0 || (uc == 0 && candidates[i].closed)) upper = candidates[i];
+			}
+		}
+		lb.setbits(round_endpoint<nbits, es>(lower, false, lubit));
+		ub.setbits(round_endpoint<nbits, es>(upper, true, uubit));
+		return *this;
+	}
+
+	// valid arithmetic for wider posits: round to nearest on the posit operators and widen by one encoding
+	template<opcode op>
+	valid& _apply_widened(const valid& rhs) {
+		using Posit = sw::universal::posit<nbits, es>;
+		auto compute = [](const Posit& a, const Posit& b) {
+			if constexpr (op == opcode::add) return a + b;
+			else if constexpr (op == opcode::sub) return a - b;
+			else if constexpr (op == opcode::mul) return a * b;
+			else return a / b;
+		};
+		Posit lower, upper;
+		if constexpr (op == opcode::add || op == opcode::sub) {
+			lower = compute(lb, (op == opcode::add ? rhs.lb : rhs.ub));
+			upper = compute(ub, (op == opcode::add ? rhs.ub : rhs.lb));
+		}
+		else {
+			if constexpr (op == opcode::div) {
+				if (rhs.lb <= Posit(0) && rhs.ub >= Posit(0)) {
+					setinclusive();
+					return *this;
+				}
+			}
+			Posit candidates[4] = { compute(lb, rhs.lb), compute(lb, rhs.ub), compute(ub, rhs.lb), compute(ub, rhs.ub) };
+			lower = upper = candidates[0];
+			for (int i = 1; i < 4; ++i) {
+				if (candidates[i] < lower) lower = candidates[i];
+				if (candidates[i] > upper) upper = candidates[i];
+			}
+		}
+		if (lb.isnar() || rhs.lb.isnar() || rhs.ub.isnar() || ub.isnar()) {
+			setinclusive();
+			return *this;
+		}
+		lb = lower;
+		ub = upper;
+		if (!lb.iszero() || !lubit || !rhs.lubit) { --lb; lubit = false; }
+		if (!ub.iszero() || !uubit || !rhs.uubit) { ++ub; uubit = false; }
 		return *this;
 	}
 
 public:
 	static constexpr size_t somebits = 10;
 
-	valid() : lb{ 0 }, ub{ 0 }, lubit{ false }, uubit{ false } { }
+	valid() : lb{ 0 }, ub{ 0 }, lubit{ true }, uubit{ true } { }
 
 	valid(const valid&) = default;
 	valid(valid&&) = default;
@@ -46,17 +186,27 @@ public:
 	valid& operator=(double rhs) { return _assign(rhs); }
 	valid& operator=(long double rhs) { return _assign(rhs); }
 
+	// the ubits lubit and uubit are set when the bound is exact, that is, the interval is closed at that end
+	valid operator-() const {
+		valid negated;
+		negated.lb = -ub;
+		negated.ub = -lb;
+		negated.lubit = uubit;
+		negated.uubit = lubit;
+		if (lb.isnar() || ub.isnar()) negated.setinclusive();
+		return negated;
+	}
 	valid& operator+=(const valid& rhs) {
-		return *this;
+		if constexpr (nbits <= 64) return _apply<opcode::add>(rhs); else return _apply_widened<opcode::add>(rhs);
 	}
 	valid& operator-=(const valid& rhs) {
-		return *this;
+		if constexpr (nbits <= 64) return _apply<opcode::sub>(rhs); else return _apply_widened<opcode::sub>(rhs);
 	}
 	valid& operator*=(const valid& rhs) {
-		return *this;
+		if constexpr (nbits <= 64) return _apply<opcode::mul>(rhs); else return _apply_widened<opcode::mul>(rhs);
 	}
 	valid& operator/=(const valid& rhs) {
-		return *this;
+		if constexpr (nbits <= 64) return _apply<opcode::div>(rhs); else return _apply_widened<opcode::div>(rhs);
 	}
 
 	// conversion operators
@@ -69,10 +219,10 @@ public:
 		return lubit && uubit;
 	}
 	inline bool isopenlower() const {
-		return lubit;
+		return !lubit;
 	}
 	inline bool isopenupper() const {
-		return uubit;
+		return !uubit;
 	}
 	inline bool getlb(sw::universal::posit<nbits, es>& _lb) const {
 		_lb = lb;
@@ -0,0 +1,112 @@
+#pragma once
+// butcher.hpp: Butcher tableaus of explicit Runge-Kutta methods
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+
+namespace sw::universal::ode {
+
+/*
+An explicit Runge-Kutta method with s stages advances y' = f(t, y) by a step h as
+
+	k_i    = f(t + c_i h, y + h sum_{j<i} a_ij k_j)      i = 0 .. s-1
+	y_next = y + h sum_i b_i k_i
+
+A tableau is a type with compile-time coefficients:
+
+	stages         s
+	order          order of y_next
+	embedded       true when the tableau has a second set of weights bhat of order embedded_order,
+	               whose difference with b estimates the local error for step size control
+	fsal           first same as last: the last stage is evaluated at y_next, so that it is the
+	               first stage of the next step
+	c[s], a[s][s], b[s], bhat[s]
+
+The coefficients are stored as double and rounded once to the number system of the integrator.
+*/
+
+// forward Euler
+struct euler {
+	static constexpr size_t stages = 1;
+	static constexpr size_t order = 1;
+	static constexpr bool embedded = false;
+	static constexpr bool fsal = false;
+	static constexpr double c[1] = { 0.0 };
+	static constexpr double a[1][1] = { { 0.0 } };
+	static constexpr double b[1] = { 1.0 };
+};
+
+// Heun's method with the embedded Euler method
+struct heun_euler {
+	static constexpr size_t stages = 2;
+	static constexpr size_t order = 2;
+	static constexpr bool embedded = true;
+	static constexpr size_t embedded_order = 1;
+	static constexpr bool fsal = false;
+	static constexpr double c[2] = { 0.0, 1.0 };
+	static constexpr double a[2][2] = {
+		{ 0.0, 0.0 },
+		{ 1.0, 0.0 }
+	};
+	static constexpr double b[2] = { 0.5, 0.5 };
+	static constexpr double bhat[2] = { 1.0, 0.0 };
+};
+
+// the classic fourth-order Runge-Kutta method
+struct rk4 {
+	static constexpr size_t stages = 4;
+	static constexpr size_t order = 4;
+	static constexpr bool embedded = false;
+	static constexpr bool fsal = false;
+	static constexpr double c[4] = { 0.0, 0.5, 0.5, 1.0 };
+	static constexpr double a[4][4] = {
+		{ 0.0, 0.0, 0.0, 0.0 },
+		{ 0.5, 0.0, 0.0, 0.0 },
+		{ 0.0, 0.5, 0.0, 0.0 },
+		{ 0.0, 0.0, 1.0, 0.0 }
+	};
+	static constexpr double b[4] = { 1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0 };
+};
+
+// Bogacki-Shampine 3(2)
+struct bogacki_shampine {
+	static constexpr size_t stages = 4;
+	static constexpr size_t order = 3;
+	static constexpr bool embedded = true;
+	static constexpr size_t embedded_order = 2;
+	static constexpr bool fsal = true;
+	static constexpr double c[4] = { 0.0, 0.5, 0.75, 1.0 };
+	static constexpr double a[4][4] = {
+		{ 0.0,       0.0,       0.0,       0.0 },
+		{ 0.5,       0.0,       0.0,       0.0 },
+		{ 0.0,       0.75,      0.0,       0.0 },
+		{ 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0 }
+	};
+	static constexpr double b[4] = { 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0 };
+	static constexpr double bhat[4] = { 7.0 / 24.0, 0.25, 1.0 / 3.0, 0.125 };
+};
+
+// Dormand-Prince 5(4), the method of MATLAB's ode45
+struct dormand_prince {
+	static constexpr size_t stages = 7;
+	static constexpr size_t order = 5;
+	static constexpr bool embedded = true;
+	static constexpr size_t embedded_order = 4;
+	static constexpr bool fsal = true;
+	static constexpr double c[7] = { 0.0, 0.2, 0.3, 0.8, 8.0 / 9.0, 1.0, 1.0 };
+	static constexpr double a[7][7] = {
+		{ 0.0,              0.0,             0.0,              0.0,            0.0,              0.0,         0.0 },
+		{ 0.2,              0.0,             0.0,              0.0,            0.0,              0.0,         0.0 },
+		{ 3.0 / 40.0,       9.0 / 40.0,      0.0,              0.0,            0.0,              0.0,         0.0 },
+		{ 44.0 / 45.0,      -56.0 / 15.0,    32.0 / 9.0,       0.0,            0.0,              0.0,         0.0 },
+		{ 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0,              0.0,         0.0 },
+		{ 9017.0 / 3168.0,  -355.0 / 33.0,   46732.0 / 5247.0, 49.0 / 176.0,   -5103.0 / 18656.0, 0.0,         0.0 },
+		{ 35.0 / 384.0,     0.0,             500.0 / 1113.0,   125.0 / 192.0,  -2187.0 / 6784.0, 11.0 / 84.0, 0.0 }
+	};
+	static constexpr double b[7] = { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0 };
+	static constexpr double bhat[7] = { 5179.0 / 57600.0, 0.0, 7571.0 / 16695.0, 393.0 / 640.0, -92097.0 / 339200.0, 187.0 / 2100.0, 1.0 / 40.0 };
+};
+
+}  // namespace sw::universal::ode
@@ -0,0 +1,61 @@
+#pragma once
+// ensemble.hpp: structure-of-arrays storage for a batch of ODE systems of the same dimension
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <vector>
+
+namespace sw::universal::ode {
+
+/*
+An ensemble holds the states of size() systems of dimension() components each. Component i of system s
+is stored at data()[i * size() + s], so that the same component of all the systems is contiguous and the
+stage combinations of the integrators are unit-stride loops over the batch.
+A single system is accessed through a system_view, which strides over the components.
+*/
+template<typename Scalar>
+class system_view {
+public:
+	system_view(Scalar* data, size_t stride, size_t dimension) : _data{ data }, _stride{ stride }, _dimension{ dimension } {}
+
+	Scalar& operator[](size_t i) const { return _data[i * _stride]; }
+	size_t size() const { return _dimension; }
+
+private:
+	Scalar* _data;
+	size_t  _stride;
+	size_t  _dimension;
+};
+
+template<typename Scalar>
+class ensemble {
+public:
+	using value_type = Scalar;
+
+	ensemble(size_t nrSystems, size_t dimension) : _size{ nrSystems }, _dimension{ dimension }, _state(nrSystems * dimension, Scalar(0.0)) {}
+
+	size_t size() const { return _size; }
+	size_t dimension() const { return _dimension; }
+
+	Scalar& operator()(size_t system, size_t component) { return _state[component * _size + system]; }
+	const Scalar& operator()(size_t system, size_t component) const { return _state[component * _size + system]; }
+
+	system_view<Scalar> operator[](size_t system) { return system_view<Scalar>(_state.data() + system, _size, _dimension); }
+	system_view<const Scalar> operator[](size_t system) const { return system_view<const Scalar>(_state.data() + system, _size, _dimension); }
+
+	// the contiguous row of a component across the batch
+	Scalar* component(size_t i) { return _state.data() + i * _size; }
+	const Scalar* component(size_t i) const { return _state.data() + i * _size; }
+
+	Scalar* data() { return _state.data(); }
+	const Scalar* data() const { return _state.data(); }
+
+private:
+	size_t _size;
+	size_t _dimension;
+	std::vector<Scalar> _state;
+};
+
+}  // namespace sw::universal::ode
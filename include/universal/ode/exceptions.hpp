@@ -0,0 +1,34 @@
+#pragma once
+// exceptions.hpp: exceptions for problems in the integration of ordinary differential equations
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <stdexcept>
+#include <string>
+
+namespace sw::universal::ode {
+
+// base class for ODE exceptions
+struct ode_exception
+	: public std::runtime_error
+{
+	ode_exception(const std::string& error)
+		: std::runtime_error(std::string("ODE exception: ") + error) {};
+};
+
+struct ensemble_shape_mismatch
+	: public ode_exception
+{
+	ensemble_shape_mismatch(const std::string& error = "ensemble does not match the shape of the integrator")
+		: ode_exception(error) {};
+};
+
+struct step_size_underflow
+	: public ode_exception
+{
+	step_size_underflow(const std::string& error = "step size became too small to meet the tolerance")
+		: ode_exception(error) {};
+};
+
+}  // namespace sw::universal::ode
@@ -0,0 +1,18 @@
+// ode.hpp: top-level include for the Universal ordinary differential equation library
+//
+// Batched explicit Runge-Kutta integrators with compile-time Butcher tableaus that advance
+// ensembles of small ODE systems in structure-of-arrays layout, parameterized in the number
+// system of the state and the accumulator of the stage combinations.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#ifndef _UNIVERSAL_ODE_LIBRARY
+#define _UNIVERSAL_ODE_LIBRARY
+
+#include <universal/ode/exceptions.hpp>
+#include <universal/ode/butcher.hpp>
+#include <universal/ode/ensemble.hpp>
+#include <universal/ode/runge_kutta.hpp>
+
+#endif // _UNIVERSAL_ODE_LIBRARY
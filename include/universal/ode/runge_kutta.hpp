@@ -0,0 +1,286 @@
+#pragma once
+// runge_kutta.hpp: batched explicit Runge-Kutta integrators for ensembles of ODE systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <universal/dsp/accumulation.hpp>
+#include <universal/utility/parallel_for.hpp>
+#include <universal/ode/exceptions.hpp>
+#include <universal/ode/butcher.hpp>
+#include <universal/ode/ensemble.hpp>
+
+namespace sw::universal::ode {
+
+/*
+runge_kutta<Tableau, Scalar, Accumulator> and adaptive_runge_kutta<Tableau, Scalar, Accumulator> integrate
+all the systems of an ensemble<Scalar> with the method of a Butcher tableau. The right-hand side is a
+function object that evaluates one system:
+
+	void operator()(const Scalar& t, const system_view<const Scalar>& y, const system_view<Scalar>& dydt) const
+
+The stage vectors k_i are ensembles of the same shape that the integrator allocates at construction, so
+that a step does not allocate. Every stage argument y + h sum_j a_ij k_j and the update y + h sum_i b_i k_i
+is a sum of products that is formed by the accumulation<Accumulator> policy of the DSP library and rounded
+once to Scalar: with a quire<nbits, es> accumulator the stage combinations of posit systems are exact dot
+products, otherwise they are chains of multiply_add(). The products h * a_ij are rounded once per step.
+
+The batch is partitioned over nrThreads threads. Every thread integrates its own range of systems to the
+end of the interval, so the right-hand side must be safe to call concurrently for different systems.
+*/
+template<typename Tableau, typename Scalar, typename Accumulator = Scalar>
+class runge_kutta {
+public:
+	static constexpr size_t stages = Tableau::stages;
+	using tableau_type = Tableau;
+	using value_type = Scalar;
+
+	runge_kutta(size_t nrSystems, size_t dimension, size_t nrThreads = 1)
+		: _size{ nrSystems }, _dimension{ dimension }, _nrThreads{ nrThreads }, _stage(nrSystems * dimension),
+		_k(stages, std::vector<Scalar>(nrSystems * dimension)) {}
+
+	// advance all the systems of the ensemble from t to t + h
+	template<typename System>
+	void step(const System& f, const Scalar& t, const Scalar& h, ensemble<Scalar>& y) {
+		integrate(f, t, h, 1, y);
+	}
+
+	// advance all the systems of the ensemble by nrSteps steps of size h from t0
+	template<typename System>
+	void integrate(const System& f, const Scalar& t0, const Scalar& h, size_t nrSteps, ensemble<Scalar>& y) {
+		if (y.size() != _size || y.dimension() != _dimension) throw ensemble_shape_mismatch();
+		Scalar ha[stages][stages], hb[stages], hc[stages];
+		for (size_t i = 0; i < stages; ++i) {
+			for (size_t j = 0; j < stages; ++j) ha[i][j] = Scalar(double(h) * Tableau::a[i][j]);
+			hb[i] = Scalar(double(h) * Tableau::b[i]);
+			hc[i] = Scalar(double(h) * Tableau::c[i]);
+		}
+		Scalar* state = y.data();
+		parallel_for(0, _size, [&](size_t first, size_t last) {
+			Scalar t = t0;
+			for (size_t n = 0; n < nrSteps; ++n) {
+				for (size_t i = 0; i < stages; ++i) {
+					const Scalar* yi = state;
+					if (i > 0) {
+						combine(_stage.data(), state, Tableau::a[i], ha[i], i, first, last);
+						yi = _stage.data();
+					}
+					Scalar ti = t + hc[i];
+					Scalar* ki = _k[i].data();
+					for (size_t s = first; s < last; ++s) {
+						f(ti, system_view<const Scalar>(yi + s, _size, _dimension), system_view<Scalar>(ki + s, _size, _dimension));
+					}
+				}
+				combine(state, state, Tableau::b, hb, stages, first, last);
+				t += h;
+			}
+		}, _nrThreads);
+	}
+
+	size_t size() const { return _size; }
+	size_t dimension() const { return _dimension; }
+
+private:
+	size_t _size;
+	size_t _dimension;
+	size_t _nrThreads;
+	std::vector<Scalar> _stage;
+	std::vector< std::vector<Scalar> > _k;
+
+	// out = y + sum_{j < count} w[j] * k_j for the systems [first, last), skipping the zeros of the tableau
+	void combine(Scalar* out, const Scalar* y, const double* coefficients, const Scalar* w, size_t count, size_t first, size_t last) {
+		using policy = sw::universal::dsp::accumulation<Accumulator>;
+		const Scalar one(1.0);
+		for (size_t d = 0; d < _dimension; ++d) {
+			size_t row = d * _size;
+			for (size_t s = first; s < last; ++s) {
+				size_t idx = row + s;
+				Accumulator acc;
+				policy::clear(acc);
+				policy::mac(acc, one, y[idx]);
+				for (size_t j = 0; j < count; ++j) {
+					if (coefficients[j] != 0.0) policy::mac(acc, w[j], _k[j][idx]);
+				}
+				policy::round(acc, out[idx]);
+			}
+		}
+	}
+};
+
+/*
+adaptive_runge_kutta integrates every system of the ensemble over [t0, t1] with its own step size, which is
+controlled with the embedded error estimate of the tableau, such as the Dormand-Prince 5(4) pair. A step is
+accepted when the largest component of the estimate satisfies |err| <= atol + rtol * max(|y|, |y_next|).
+The systems of a thread advance in lockstep with a step each per iteration, so that the stage combinations
+remain unit-stride loops over the batch; a system that has reached t1 is masked out.
+Time and step size are kept in double, as they only control the integration: the right-hand side receives
+the stage time rounded to Scalar, and the products h * a_ij are rounded once to Scalar per step.
+*/
+template<typename Tableau, typename Scalar, typename Accumulator = Scalar>
+class adaptive_runge_kutta {
+	static_assert(Tableau::embedded, "adaptive integration requires a tableau with an embedded error estimate");
+public:
+	static constexpr size_t stages = Tableau::stages;
+	using tableau_type = Tableau;
+	using value_type = Scalar;
+
+	adaptive_runge_kutta(size_t nrSystems, size_t dimension, double absoluteTolerance = 1.0e-6, double relativeTolerance = 1.0e-6, size_t nrThreads = 1)
+		: _size{ nrSystems }, _dimension{ dimension }, _nrThreads{ nrThreads }, _atol{ absoluteTolerance }, _rtol{ relativeTolerance },
+		_maxSteps{ 100000 }, _t(nrSystems), _h(nrSystems), _weights(stages * (stages + 1) * nrSystems), _active(nrSystems), _k0(nrSystems),
+		_failed(nrSystems), _accepted(nrSystems), _rejected(nrSystems), _stage(nrSystems * dimension), _next(nrSystems * dimension),
+		_k(stages, std::vector<Scalar>(nrSystems * dimension)) {}
+
+	// integrate all the systems of the ensemble from t0 to t1, starting with step size initialStep,
+	// or (t1 - t0) / 100 when initialStep is 0
+	template<typename System>
+	void integrate(const System& f, double t0, double t1, ensemble<Scalar>& y, double initialStep = 0.0) {
+		if (y.size() != _size || y.dimension() != _dimension) throw ensemble_shape_mismatch();
+		double h0 = (initialStep > 0.0 ? initialStep : (t1 - t0) / 100.0);
+		Scalar* state = y.data();
+		parallel_for(0, _size, [&](size_t first, size_t last) {
+			for (size_t s = first; s < last; ++s) {
+				_t[s] = t0;
+				_h[s] = h0;
+				_active[s] = (t1 > t0);
+				_k0[s] = false;
+				_failed[s] = false;
+				_accepted[s] = 0;
+				_rejected[s] = 0;
+			}
+			while (attempt(f, t0, t1, state, first, last)) {}
+		}, _nrThreads);
+		for (size_t s = 0; s < _size; ++s) {
+			if (_failed[s]) throw step_size_underflow();
+		}
+	}
+
+	// largest number of attempted steps per system before the integration is abandoned
+	void max_steps(size_t maxSteps) { _maxSteps = maxSteps; }
+
+	size_t accepted(size_t system) const { return _accepted[system]; }
+	size_t rejected(size_t system) const { return _rejected[system]; }
+	// the last step size of a system, which continues an integration
+	double step_size(size_t system) const { return _h[system]; }
+
+	size_t size() const { return _size; }
+	size_t dimension() const { return _dimension; }
+
+private:
+	size_t _size;
+	size_t _dimension;
+	size_t _nrThreads;
+	double _atol, _rtol;
+	size_t _maxSteps;
+	std::vector<double> _t, _h;
+	std::vector<Scalar> _weights;   // h * a_ij, and h * b_j in row stages, of every system: [(i * stages + j) * size + s]
+	std::vector<char>   _active;    // char instead of bool, as the threads write neighbouring elements
+	std::vector<char>   _k0;        // k_0 holds f(t, y) of the current state
+	std::vector<char>   _failed;
+	std::vector<size_t> _accepted, _rejected;
+	std::vector<Scalar> _stage, _next;
+	std::vector< std::vector<Scalar> > _k;
+
+	Scalar& weight(size_t i, size_t j, size_t s) { return _weights[(i * stages + j) * _size + s]; }
+
+	// one step attempt of every active system in [first, last), returns false when all have finished
+	template<typename System>
+	bool attempt(const System& f, double t0, double t1, Scalar* state, size_t first, size_t last) {
+		bool any = false;
+		for (size_t s = first; s < last; ++s) {
+			if (!_active[s]) continue;
+			any = true;
+			if (_t[s] + _h[s] > t1) _h[s] = t1 - _t[s];
+			for (size_t i = 0; i < stages; ++i) {
+				for (size_t j = 0; j < i; ++j) weight(i, j, s) = Scalar(_h[s] * Tableau::a[i][j]);
+				weight(stages, i, s) = Scalar(_h[s] * Tableau::b[i]);
+			}
+		}
+		if (!any) return false;
+
+		for (size_t i = 0; i < stages; ++i) {
+			const Scalar* yi = state;
+			if (i > 0) {
+				combine(_stage.data(), state, Tableau::a[i], i, i, first, last);
+				yi = _stage.data();
+			}
+			Scalar* ki = _k[i].data();
+			for (size_t s = first; s < last; ++s) {
+				if (!_active[s] || (i == 0 && _k0[s])) continue;
+				Scalar ti(_t[s] + Tableau::c[i] * _h[s]);
+				f(ti, system_view<const Scalar>(yi + s, _size, _dimension), system_view<Scalar>(ki + s, _size, _dimension));
+			}
+		}
+		combine(_next.data(), state, Tableau::b, stages, stages, first, last);
+
+		const double exponent = -1.0 / double(Tableau::embedded_order + 1);
+		for (size_t s = first; s < last; ++s) {
+			if (!_active[s]) continue;
+			_k0[s] = true;
+			// the largest scaled component of the error estimate h sum_i (b_i - bhat_i) k_i
+			double norm = 0.0;
+			for (size_t d = 0; d < _dimension; ++d) {
+				size_t idx = d * _size + s;
+				double e = 0.0;
+				for (size_t i = 0; i < stages; ++i) {
+					double db = Tableau::b[i] - Tableau::bhat[i];
+					if (db != 0.0) e += db * double(_k[i][idx]);
+				}
+				e = std::fabs(_h[s] * e);
+				double scale = _atol + _rtol * std::max(std::fabs(double(state[idx])), std::fabs(double(_next[idx])));
+				norm = std::max(norm, e / scale);
+			}
+			double factor = (norm == 0.0 ? 5.0 : std::min(5.0, std::max(0.2, 0.9 * std::pow(norm, exponent))));
+			if (norm <= 1.0) {
+				for (size_t d = 0; d < _dimension; ++d) state[d * _size + s] = _next[d * _size + s];
+				_t[s] += _h[s];
+				++_accepted[s];
+				if constexpr (Tableau::fsal) {
+					for (size_t d = 0; d < _dimension; ++d) _k[0][d * _size + s] = _k[stages - 1][d * _size + s];
+				}
+				else {
+					_k0[s] = false;
+				}
+				if (t1 - _t[s] <= 1.0e-12 * std::fabs(t1 - t0)) {
+					_active[s] = false;
+					continue;
+				}
+			}
+			else {
+				++_rejected[s];
+				factor = std::min(1.0, factor);
+			}
+			_h[s] *= factor;
+			if (_h[s] <= 1.0e-14 * std::max(std::fabs(_t[s]), std::fabs(t1 - t0)) || _accepted[s] + _rejected[s] >= _maxSteps) {
+				_failed[s] = true;
+				_active[s] = false;
+			}
+		}
+		return true;
+	}
+
+	// out = y + sum_{j < count} weight(row, j) * k_j for the active systems in [first, last)
+	void combine(Scalar* out, const Scalar* y, const double* coefficients, size_t row, size_t count, size_t first, size_t last) {
+		using policy = sw::universal::dsp::accumulation<Accumulator>;
+		const Scalar one(1.0);
+		for (size_t d = 0; d < _dimension; ++d) {
+			size_t base = d * _size;
+			for (size_t s = first; s < last; ++s) {
+				if (!_active[s]) continue;
+				size_t idx = base + s;
+				Accumulator acc;
+				policy::clear(acc);
+				policy::mac(acc, one, y[idx]);
+				for (size_t j = 0; j < count; ++j) {
+					if (coefficients[j] != 0.0) policy::mac(acc, weight(row, j, s), _k[j][idx]);
+				}
+				policy::round(acc, out[idx]);
+			}
+		}
+	}
+};
+
+}  // namespace sw::universal::ode
@@ -0,0 +1,398 @@
+#pragma once
+// latency.hpp: operator latency histograms over randomized or captured operand streams
+//
+// The workloads in number_system.hpp and performance_runner.hpp reuse the same operands
+// in a fixed loop and report a single average. That defeats the data-dependent branches
+// in the decode/round paths of the number systems, and hides the cost of the slow paths.
+// The harness in this file runs an operator over a stream of operands, buckets every
+// operation by the class of its operands (normal, subnormal, special), and times them
+// in small batches, as a single operation is too short for the clock. Each class
+// collects a histogram of the average latency per operation of its batches, from
+// which percentiles are derived: these are percentiles of batch averages, which are
+// narrower than the distribution of the individual operations. The results can be
+// written as JSON so that they can be tracked across revisions.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace sw::universal {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// operand classification
+
+enum class OperandClass : int { normal = 0, subnormal = 1, special = 2 };
+constexpr size_t NR_OPERAND_CLASSES = 3;
+
+inline const char* to_string(OperandClass oc) {
+	switch (oc) {
+	case OperandClass::normal:    return "normal";
+	case OperandClass::subnormal: return "subnormal";
+	case OperandClass::special:   return "special";
+	}
+	return "unknown";
+}
+
+// classify a value: zero, infinity, NaN/NaR are special, values below the smallest normal are subnormal
+template<typename Scalar>
+OperandClass classify(const Scalar& v) {
+	double d = double(v);
+	if (std::isnan(d) || std::isinf(d) || d == 0.0) return OperandClass::special;
+	double smallestNormal = double(std::numeric_limits<Scalar>::min());
+	if (smallestNormal > 0.0 && std::fabs(d) < smallestNormal) return OperandClass::subnormal;
+	return OperandClass::normal;
+}
+
+// a binary operation takes the class of its least regular operand
+template<typename Scalar>
+OperandClass classify(const Scalar& a, const Scalar& b) {
+	OperandClass ca = classify(a), cb = classify(b);
+	return (static_cast<int>(ca) > static_cast<int>(cb) ? ca : cb);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// operand streams
+
+// Generate a stream of operands: magnitudes are log-uniform over the normal range of the
+// type with a random sign, mixed with a fraction of subnormal and special values.
+// Types without subnormals, or without special encodings, simply yield fewer of those.
+template<typename Scalar>
+std::vector<Scalar> GenerateOperandStream(size_t n, uint64_t seed = 0, double subnormalRatio = 0.05, double specialRatio = 0.05) {
+	std::mt19937_64 eng(seed);
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	double maxpos = double(std::numeric_limits<Scalar>::max());
+	double minnormal = double(std::numeric_limits<Scalar>::min());
+	double minpos = double(std::numeric_limits<Scalar>::denorm_min());
+	if (!(maxpos > 0.0) || std::isinf(maxpos)) maxpos = std::numeric_limits<double>::max();
+	if (!(minnormal > 0.0)) minnormal = 1.0;  // integer types report min() as 0 or negative
+	if (!(minpos > 0.0) || minpos > minnormal) minpos = minnormal;
+	double logMin = std::log2(minnormal), logMax = std::log2(maxpos);
+	double logMinSub = std::log2(minpos);
+	std::array<Scalar, 4> specials;
+	specials[0] = Scalar(0);
+	specials[1] = std::numeric_limits<Scalar>::has_infinity ? Scalar(std::numeric_limits<Scalar>::infinity()) : Scalar(maxpos);
+	specials[2] = std::numeric_limits<Scalar>::has_quiet_NaN ? Scalar(std::numeric_limits<Scalar>::quiet_NaN()) : Scalar(0);
+	specials[3] = -specials[1];
+
+	std::vector<Scalar> stream(n);
+	for (size_t i = 0; i < n; ++i) {
+		double selector = unit(eng);
+		double sign = (unit(eng) < 0.5 ? -1.0 : 1.0);
+		if (selector < specialRatio) {
+			stream[i] = specials[static_cast<size_t>(unit(eng) * 4.0) & 0x3];
+		}
+		else if (selector < specialRatio + subnormalRatio && minpos < minnormal) {
+			stream[i] = Scalar(sign * std::exp2(logMinSub + unit(eng) * (logMin - logMinSub)));
+		}
+		else {
+			stream[i] = Scalar(sign * std::exp2(logMin + unit(eng) * (logMax - logMin)));
+		}
+	}
+	return stream;
+}
+
+// Generate a stream of operands from values captured in an application
+template<typename Scalar>
+std::vector<Scalar> CaptureOperandStream(const std::vector<double>& samples) {
+	std::vector<Scalar> stream(samples.size());
+	for (size_t i = 0; i < samples.size(); ++i) stream[i] = Scalar(samples[i]);
+	return stream;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// latency histogram
+
+// The histogram keeps every sample, which makes percentiles exact, and bins them on a
+// logarithmic scale with BINS_PER_OCTAVE bins per doubling of the latency for reporting.
+class LatencyHistogram {
+public:
+	static constexpr int BINS_PER_OCTAVE = 4;
+	static constexpr double LOWEST_BIN = 0.125; // ns
+
+	void record(double ns) { samples.push_back(ns); sorted = false; }
+	void clear() { samples.clear(); sorted = true; }
+
+	size_t count() const { return samples.size(); }
+	double min() const { sort(); return samples.empty() ? 0.0 : samples.front(); }
+	double max() const { sort(); return samples.empty() ? 0.0 : samples.back(); }
+	double mean() const {
+		if (samples.empty()) return 0.0;
+		double sum = 0.0;
+		for (auto s : samples) sum += s;
+		return sum / double(samples.size());
+	}
+	// nearest-rank percentile, p in [0, 100]
+	double percentile(double p) const {
+		if (samples.empty()) return 0.0;
+		sort();
+		size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * double(samples.size())));
+		if (rank == 0) rank = 1;
+		if (rank > samples.size()) rank = samples.size();
+		return samples[rank - 1];
+	}
+	// (lower bound of the bin in ns, nr of samples) for every non-empty bin
+	std::vector< std::pair<double, size_t> > bins() const {
+		std::vector< std::pair<double, size_t> > result;
+		sort();
+		int currentBin = -1;
+		for (auto s : samples) {
+			int bin = binIndex(s);
+			if (bin != currentBin) {
+				result.push_back(std::make_pair(binLowerBound(bin), size_t(0)));
+				currentBin = bin;
+			}
+			++result.back().second;
+		}
+		return result;
+	}
+
+	static int binIndex(double ns) {
+		if (!std::isfinite(ns)) return std::numeric_limits<int>::max(); // open-ended top bin
+		if (ns <= LOWEST_BIN) return 0;
+		return static_cast<int>(std::floor(std::log2(ns / LOWEST_BIN) * BINS_PER_OCTAVE));
+	}
+	static double binLowerBound(int bin) {
+		return LOWEST_BIN * std::exp2(double(bin) / BINS_PER_OCTAVE);
+	}
+
+private:
+	void sort() const {
+		if (!sorted) {
+			std::sort(samples.begin(), samples.end());
+			sorted = true;
+		}
+	}
+	mutable std::vector<double> samples;
+	mutable bool sorted = true;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// measurement
+
+inline volatile size_t latencySink;  // keeps the results of the timed loops alive
+
+enum class LatencyOperator : int { add = 0, sub = 1, mul = 2, div = 3 };
+
+inline const char* to_string(LatencyOperator op) {
+	switch (op) {
+	case LatencyOperator::add: return "add";
+	case LatencyOperator::sub: return "sub";
+	case LatencyOperator::mul: return "mul";
+	case LatencyOperator::div: return "div";
+	}
+	return "unknown";
+}
+
+struct LatencyMeasurement {
+	std::string      number_system;
+	LatencyOperator  op;
+	OperandClass     operand_class;
+	size_t           operations;   // nr of operations measured
+	double           elapsed;      // total time spent in the operator in seconds
+	size_t           batch_size;   // nr of operations per histogram sample
+	LatencyHistogram histogram;    // average ns per operation of each batch
+	double throughput() const { return (elapsed > 0.0 ? double(operations) / elapsed : 0.0); }
+};
+
+template<typename Scalar>
+inline Scalar apply(LatencyOperator op, const Scalar& a, const Scalar& b) {
+	switch (op) {
+	case LatencyOperator::add: return a + b;
+	case LatencyOperator::sub: return a - b;
+	case LatencyOperator::mul: return a * b;
+	case LatencyOperator::div: return a / b;
+	}
+	return a;
+}
+
+// Measure the latency of an operator over the operand pairs (a[i], b[i]).
+// Operations are grouped by operand class and timed in batches of batchSize: a single
+// operation is too short for the clock, so each histogram sample is the average latency
+// of one batch, corrected for the measured overhead of reading the clock.
+// Division by zero is excluded as it traps in several number systems.
+template<typename Scalar>
+void MeasureOperatorLatency(const std::string& tag, LatencyOperator op, const std::vector<Scalar>& a, const std::vector<Scalar>& b, std::vector<LatencyMeasurement>& results, size_t batchSize = 16) {
+	using namespace std::chrono;
+	size_t n = std::min(a.size(), b.size());
+	std::array<std::vector<size_t>, NR_OPERAND_CLASSES> classIndex;
+	for (size_t i = 0; i < n; ++i) {
+		if (op == LatencyOperator::div && b[i] == Scalar(0)) continue;
+		classIndex[static_cast<size_t>(classify(a[i], b[i]))].push_back(i);
+	}
+
+	// calibrate the overhead of the timing itself
+	double overhead = std::numeric_limits<double>::max();
+	for (int i = 0; i < 1000; ++i) {
+		steady_clock::time_point begin = steady_clock::now();
+		steady_clock::time_point end = steady_clock::now();
+		overhead = std::min(overhead, duration<double, std::nano>(end - begin).count());
+	}
+
+	std::vector<Scalar> c(batchSize);
+	std::vector<Scalar> lhs(batchSize), rhs(batchSize);
+	for (size_t oc = 0; oc < NR_OPERAND_CLASSES; ++oc) {
+		const std::vector<size_t>& index = classIndex[oc];
+		if (index.empty()) continue;
+		LatencyMeasurement m;
+		m.number_system = tag;
+		m.op = op;
+		m.operand_class = static_cast<OperandClass>(oc);
+		m.operations = 0;
+		m.elapsed = 0.0;
+		m.batch_size = batchSize;
+		size_t nrOfNonZero = 0;
+		for (size_t first = 0; first + batchSize <= index.size(); first += batchSize) {
+			// gather the operands so that the timed loop streams through contiguous memory
+			for (size_t k = 0; k < batchSize; ++k) {
+				lhs[k] = a[index[first + k]];
+				rhs[k] = b[index[first + k]];
+			}
+			steady_clock::time_point begin = steady_clock::now();
+			for (size_t k = 0; k < batchSize; ++k) c[k] = apply(op, lhs[k], rhs[k]);
+			steady_clock::time_point end = steady_clock::now();
+			double ns = duration<double, std::nano>(end - begin).count() - overhead;
+			if (ns < 0.0) ns = 0.0;
+			m.histogram.record(ns / double(batchSize));
+			m.elapsed += ns * 1.0e-9;
+			m.operations += batchSize;
+			// consume the results so that the optimizer cannot remove the operations
+			for (size_t k = 0; k < batchSize; ++k) if (!(c[k] == Scalar(0))) ++nrOfNonZero;
+		}
+		if (m.operations > 0) results.push_back(m);
+		latencySink = nrOfNonZero;
+	}
+}
+
+// Measure add, sub, mul, and div over a pair of operand streams
+template<typename Scalar>
+void MeasureArithmeticLatency(const std::string& tag, const std::vector<Scalar>& a, const std::vector<Scalar>& b, std::vector<LatencyMeasurement>& results, size_t batchSize = 16) {
+	MeasureOperatorLatency(tag, LatencyOperator::add, a, b, results, batchSize);
+	MeasureOperatorLatency(tag, LatencyOperator::sub, a, b, results, batchSize);
+	MeasureOperatorLatency(tag, LatencyOperator::mul, a, b, results, batchSize);
+	MeasureOperatorLatency(tag, LatencyOperator::div, a, b, results, batchSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// reporting
+
+// the percentiles are taken over the batch averages of the latency per operation
+inline void ReportLatency(std::ostream& ostr, const std::vector<LatencyMeasurement>& results) {
+	constexpr int TAG_WIDTH = 28;
+	constexpr int COLUMN_WIDTH = 12;
+	if (!results.empty()) ostr << "latency percentiles of the average ns/op over batches of " << results.front().batch_size << " operations\n";
+	ostr << std::setw(TAG_WIDTH) << std::left << "number system" << std::right
+		<< std::setw(5) << "op"
+		<< std::setw(COLUMN_WIDTH) << "class"
+		<< std::setw(COLUMN_WIDTH) << "ops"
+		<< std::setw(COLUMN_WIDTH) << "p50 [ns]"
+		<< std::setw(COLUMN_WIDTH) << "p90 [ns]"
+		<< std::setw(COLUMN_WIDTH) << "p99 [ns]"
+		<< std::setw(COLUMN_WIDTH) << "max [ns]"
+		<< std::setw(COLUMN_WIDTH) << "Mops/sec" << '\n';
+	auto old_precision = ostr.precision();
+	ostr << std::fixed << std::setprecision(2);
+	for (const auto& m : results) {
+		ostr << std::setw(TAG_WIDTH) << std::left << m.number_system << std::right
+			<< std::setw(5) << to_string(m.op)
+			<< std::setw(COLUMN_WIDTH) << to_string(m.operand_class)
+			<< std::setw(COLUMN_WIDTH) << m.operations
+			<< std::setw(COLUMN_WIDTH) << m.histogram.percentile(50.0)
+			<< std::setw(COLUMN_WIDTH) << m.histogram.percentile(90.0)
+			<< std::setw(COLUMN_WIDTH) << m.histogram.percentile(99.0)
+			<< std::setw(COLUMN_WIDTH) << m.histogram.max()
+			<< std::setw(COLUMN_WIDTH) << m.throughput() * 1.0e-6 << '\n';
+	}
+	ostr << std::defaultfloat << std::setprecision(old_precision);
+}
+
+inline std::string json_escape(const std::string& s) {
+	std::string escaped;
+	for (char c : s) {
+		if (c == '"' || c == '\\') escaped += '\\';
+		escaped += c;
+	}
+	return escaped;
+}
+
+// JSON has no encoding for infinity and NaN: non-finite values are written as null
+inline void json_number(std::ostream& ostr, double v) {
+	if (std::isfinite(v)) ostr << v; else ostr << "null";
+}
+
+// emit the measurements as a JSON document: { "benchmark": ..., "results": [ ... ] }
+// the latencies are the batch averages of the ns per operation, with batch_size operations per sample
+inline void ReportLatencyJson(std::ostream& ostr, const std::string& benchmark, const std::vector<LatencyMeasurement>& results) {
+	auto old_precision = ostr.precision();
+	ostr << std::setprecision(6);
+	ostr << "{\n  \"benchmark\": \"" << json_escape(benchmark) << "\",\n  \"results\": [";
+	for (size_t i = 0; i < results.size(); ++i) {
+		const LatencyMeasurement& m = results[i];
+		ostr << (i == 0 ? "\n" : ",\n")
+			<< "    {\n"
+			<< "      \"number_system\": \"" << json_escape(m.number_system) << "\",\n"
+			<< "      \"operator\": \"" << to_string(m.op) << "\",\n"
+			<< "      \"operand_class\": \"" << to_string(m.operand_class) << "\",\n"
+			<< "      \"operations\": " << m.operations << ",\n"
+			<< "      \"batch_size\": " << m.batch_size << ",\n"
+			<< "      \"throughput_ops_per_sec\": ";
+		json_number(ostr, m.throughput());
+		ostr << ",\n      \"batch_latency_ns\": { \"min\": ";
+		json_number(ostr, m.histogram.min());
+		ostr << ", \"mean\": ";
+		json_number(ostr, m.histogram.mean());
+		ostr << ", \"p50\": ";
+		json_number(ostr, m.histogram.percentile(50.0));
+		ostr << ", \"p90\": ";
+		json_number(ostr, m.histogram.percentile(90.0));
+		ostr << ", \"p99\": ";
+		json_number(ostr, m.histogram.percentile(99.0));
+		ostr << ", \"max\": ";
+		json_number(ostr, m.histogram.max());
+		ostr << " },\n"
+			<< "      \"histogram\": [";
+		auto bins = m.histogram.bins();
+		for (size_t j = 0; j < bins.size(); ++j) {
+			ostr << (j == 0 ? "[" : ", [");
+			json_number(ostr, bins[j].first);
+			ostr << ", " << bins[j].second << "]";
+		}
+		ostr << "]\n    }";
+	}
+	ostr << "\n  ]\n}\n";
+	ostr << std::setprecision(old_precision);
+}
+
+// common driver for the latency benchmarks: print the table, and write JSON when
+// the program is invoked as: program --json <file>
+inline int LatencyBenchmarkReport(int argc, char** argv, const std::string& benchmark, const std::vector<LatencyMeasurement>& results) {
+	std::cout << benchmark << '\n';
+	ReportLatency(std::cout, results);
+	for (int i = 1; i + 1 < argc; ++i) {
+		if (std::string(argv[i]) == "--json") {
+			std::ofstream json(argv[i + 1]);
+			if (!json) {
+				std::cerr << "unable to open " << argv[i + 1] << '\n';
+				return EXIT_FAILURE;
+			}
+			ReportLatencyJson(json, benchmark, results);
+			std::cout << "JSON report written to " << argv[i + 1] << '\n';
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+} // namespace sw::universal
@@ -9,7 +9,9 @@ namespace sw::universal {
 
 /** Convert from \p Source to \p Target in a functional style using \ref convert.
  * Example: 'convert_to<double>(p)' where 'p' is a posit.
- * The benefit is that no variable has to be created for converting into it. **/
+ * The benefit is that no variable has to be created for converting into it.
+ * For correctly rounded conversions between posit, cfloat, fixpnt, and integer arrays
+ * without a trip through double, see convert_direct in adapters/adapt_direct_conversion.hpp. **/
 template <typename Target, typename Source>
 Target convert_to(const Source& src) {
     Target t;
@@ -0,0 +1,376 @@
+#pragma once
+// instrumented.hpp: number system adapter that counts operations and rounding events
+//
+// instrumented<Number> wraps any Universal number system, or a native type, and
+// counts the loads, stores, arithmetic operations, rounding events, saturations,
+// and NaN/NaR productions that a computation performs with it, without any
+// modification to the number system itself.
+//
+//   using Real = instrumented< posit<32,2> >;
+//   {
+//       instrumentation_region<posit<32,2>> region("matvec");
+//       b = A * x;    // A, x, b are containers of Real
+//   }
+//   instrumentation<posit<32,2>>::report(std::cout);
+//
+// Counters are process-wide per Number type and updated atomically, so
+// multi-threaded kernels can be instrumented as is. A region records the
+// counter deltas between its construction and destruction across all threads.
+//
+// Rounding events, saturations, and NaN productions are detected against a
+// reference computed in double precision, or in long double for number systems
+// with more than 26 bits of precision: the classification is exact when the
+// products of two significants fit in the reference, that is, up to 26 bits of
+// precision with double and up to 32 bits with an 80-bit long double. Number
+// systems beyond the reference do not classify rounding events.
+//
+// Setting INSTRUMENTED_OPERATIONS_COUNT to 0 reduces instrumented<Number> to an
+// alias of Number and the regions and reports to no-ops, so that instrumented
+// code compiles to the exact same code as the uninstrumented version.
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <iostream>
+#include <iomanip>
+
+#if !defined(INSTRUMENTED_OPERATIONS_COUNT)
+#define INSTRUMENTED_OPERATIONS_COUNT 1
+#endif
+
+namespace sw::universal {
+
+// snapshot of the instrumentation counters
+struct instrumentation_counts {
+	uint64_t load{ 0 };
+	uint64_t store{ 0 };
+	uint64_t add{ 0 };
+	uint64_t sub{ 0 };
+	uint64_t mul{ 0 };
+	uint64_t div{ 0 };
+	uint64_t sqrt{ 0 };
+	uint64_t rounding{ 0 };    // results that are not exact
+	uint64_t saturate{ 0 };    // results whose reference value lies outside of the dynamic range
+	uint64_t nan{ 0 };         // NaN or NaR results from non-NaN operands
+
+	uint64_t arithmetic() const { return add + sub + mul + div + sqrt; }
+
+	instrumentation_counts& operator-=(const instrumentation_counts& rhs) {
+		load -= rhs.load; store -= rhs.store;
+		add -= rhs.add; sub -= rhs.sub; mul -= rhs.mul; div -= rhs.div; sqrt -= rhs.sqrt;
+		rounding -= rhs.rounding; saturate -= rhs.saturate; nan -= rhs.nan;
+		return *this;
+	}
+	instrumentation_counts& operator+=(const instrumentation_counts& rhs) {
+		load += rhs.load; store += rhs.store;
+		add += rhs.add; sub += rhs.sub; mul += rhs.mul; div += rhs.div; sqrt += rhs.sqrt;
+		rounding += rhs.rounding; saturate += rhs.saturate; nan += rhs.nan;
+		return *this;
+	}
+};
+
+inline instrumentation_counts operator-(instrumentation_counts lhs, const instrumentation_counts& rhs) { return lhs -= rhs; }
+
+// print the counts as a single table row
+inline void ReportInstrumentationCounts(std::ostream& ostr, const std::string& label, const instrumentation_counts& c) {
+	ostr << std::setw(24) << std::left << label << std::right
+		<< std::setw(12) << c.load
+		<< std::setw(12) << c.store
+		<< std::setw(12) << c.add
+		<< std::setw(12) << c.sub
+		<< std::setw(12) << c.mul
+		<< std::setw(12) << c.div
+		<< std::setw(10) << c.sqrt
+		<< std::setw(12) << c.rounding
+		<< std::setw(10) << c.saturate
+		<< std::setw(10) << c.nan << '\n';
+}
+
+inline void ReportInstrumentationHeader(std::ostream& ostr) {
+	ostr << std::setw(24) << std::left << "region" << std::right
+		<< std::setw(12) << "load"
+		<< std::setw(12) << "store"
+		<< std::setw(12) << "add"
+		<< std::setw(12) << "sub"
+		<< std::setw(12) << "mul"
+		<< std::setw(12) << "div"
+		<< std::setw(10) << "sqrt"
+		<< std::setw(12) << "rounding"
+		<< std::setw(10) << "saturate"
+		<< std::setw(10) << "nan" << '\n';
+}
+
+#if INSTRUMENTED_OPERATIONS_COUNT
+
+// process-wide counters and region records of a number system
+template<typename Number>
+class instrumentation {
+public:
+	// atomic counters, one set per Number type
+	struct counters {
+		std::atomic<uint64_t> load{ 0 };
+		std::atomic<uint64_t> store{ 0 };
+		std::atomic<uint64_t> add{ 0 };
+		std::atomic<uint64_t> sub{ 0 };
+		std::atomic<uint64_t> mul{ 0 };
+		std::atomic<uint64_t> div{ 0 };
+		std::atomic<uint64_t> sqrt{ 0 };
+		std::atomic<uint64_t> rounding{ 0 };
+		std::atomic<uint64_t> saturate{ 0 };
+		std::atomic<uint64_t> nan{ 0 };
+	};
+
+	static counters& global() {
+		static counters c;
+		return c;
+	}
+
+	static inline void count(std::atomic<uint64_t>& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+
+	static instrumentation_counts snapshot() {
+		counters& c = global();
+		instrumentation_counts s;
+		s.load     = c.load.load(std::memory_order_relaxed);
+		s.store    = c.store.load(std::memory_order_relaxed);
+		s.add      = c.add.load(std::memory_order_relaxed);
+		s.sub      = c.sub.load(std::memory_order_relaxed);
+		s.mul      = c.mul.load(std::memory_order_relaxed);
+		s.div      = c.div.load(std::memory_order_relaxed);
+		s.sqrt     = c.sqrt.load(std::memory_order_relaxed);
+		s.rounding = c.rounding.load(std::memory_order_relaxed);
+		s.saturate = c.saturate.load(std::memory_order_relaxed);
+		s.nan      = c.nan.load(std::memory_order_relaxed);
+		return s;
+	}
+
+	// clear the counters and the region records
+	static void reset() {
+		counters& c = global();
+		for (std::atomic<uint64_t>* p : { &c.load, &c.store, &c.add, &c.sub, &c.mul, &c.div, &c.sqrt, &c.rounding, &c.saturate, &c.nan }) p->store(0, std::memory_order_relaxed);
+		std::lock_guard<std::mutex> lock(regionMutex());
+		regionRecords().clear();
+	}
+
+	// accumulate the counts of a completed region: regions with the same name are merged
+	static void record(const std::string& name, const instrumentation_counts& delta) {
+		std::lock_guard<std::mutex> lock(regionMutex());
+		for (auto& r : regionRecords()) {
+			if (r.first == name) {
+				r.second += delta;
+				return;
+			}
+		}
+		regionRecords().emplace_back(name, delta);
+	}
+
+	static std::vector< std::pair<std::string, instrumentation_counts> > regions() {
+		std::lock_guard<std::mutex> lock(regionMutex());
+		return regionRecords();
+	}
+
+	// summary report: the recorded regions in order of first completion, followed by the totals
+	static void report(std::ostream& ostr, const std::string& title = "") {
+		if (!title.empty()) ostr << title << '\n';
+		ReportInstrumentationHeader(ostr);
+		for (const auto& r : regions()) ReportInstrumentationCounts(ostr, r.first, r.second);
+		ReportInstrumentationCounts(ostr, "total", snapshot());
+	}
+
+private:
+	static std::mutex& regionMutex() {
+		static std::mutex m;
+		return m;
+	}
+	static std::vector< std::pair<std::string, instrumentation_counts> >& regionRecords() {
+		static std::vector< std::pair<std::string, instrumentation_counts> > records;
+		return records;
+	}
+};
+
+// RAII scope that attributes the operations executed during its lifetime to a named region
+template<typename Number>
+class instrumentation_region {
+public:
+	explicit instrumentation_region(const std::string& name) : _name{ name }, _start{ instrumentation<Number>::snapshot() } {}
+	instrumentation_region(const instrumentation_region&) = delete;
+	instrumentation_region& operator=(const instrumentation_region&) = delete;
+	~instrumentation_region() { instrumentation<Number>::record(_name, counts()); }
+
+	// counts accumulated so far in this region
+	instrumentation_counts counts() const { return instrumentation<Number>::snapshot() - _start; }
+
+private:
+	std::string _name;
+	instrumentation_counts _start;
+};
+
+template<typename Number>
+class instrumented {
+	using stats = instrumentation<Number>;
+public:
+	typedef Number value_type;
+
+	instrumented() : _v{} {}
+	// a new value counts a load and an assignment counts a store, whether copied or moved
+	instrumented(const instrumented& rhs) : _v{ rhs._v } { stats::count(stats::global().load); }
+	instrumented(instrumented&& rhs) : _v{ std::move(rhs._v) } { stats::count(stats::global().load); }
+	// construction from the wrapped type or anything it can be constructed from
+	template<typename T,
+		typename = typename std::enable_if_t<std::is_constructible_v<Number, const T&> && !std::is_same_v<std::decay_t<T>, instrumented> > >
+	instrumented(const T& v) : _v(v) {}
+
+	instrumented& operator=(const instrumented& rhs) { _v = rhs._v; stats::count(stats::global().store); return *this; }
+	instrumented& operator=(instrumented&& rhs) { _v = std::move(rhs._v); stats::count(stats::global().store); return *this; }
+
+	// arithmetic operators
+	instrumented operator-() const { return instrumented(-_v, raw{}); }
+	instrumented& operator+=(const instrumented& rhs) { _v = add(_v, rhs._v); return *this; }
+	instrumented& operator-=(const instrumented& rhs) { _v = sub(_v, rhs._v); return *this; }
+	instrumented& operator*=(const instrumented& rhs) { _v = mul(_v, rhs._v); return *this; }
+	instrumented& operator/=(const instrumented& rhs) { _v = div(_v, rhs._v); return *this; }
+
+	friend instrumented operator+(const instrumented& lhs, const instrumented& rhs) { return instrumented(add(lhs._v, rhs._v), raw{}); }
+	friend instrumented operator-(const instrumented& lhs, const instrumented& rhs) { return instrumented(sub(lhs._v, rhs._v), raw{}); }
+	friend instrumented operator*(const instrumented& lhs, const instrumented& rhs) { return instrumented(mul(lhs._v, rhs._v), raw{}); }
+	friend instrumented operator/(const instrumented& lhs, const instrumented& rhs) { return instrumented(div(lhs._v, rhs._v), raw{}); }
+
+	friend instrumented sqrt(const instrumented& a) {
+		using std::sqrt;
+		stats::count(stats::global().sqrt);
+		Number r = sqrt(a._v);
+		Reference ra = static_cast<Reference>(a._v);
+		classify(ra < 0 ? std::numeric_limits<Reference>::quiet_NaN() : std::sqrt(ra), r, ra, Reference(0));
+		return instrumented(r, raw{});
+	}
+	friend instrumented abs(const instrumented& a) { return (a._v < Number(0)) ? instrumented(-a._v, raw{}) : instrumented(a._v, raw{}); }
+
+	// logic operators
+	friend bool operator==(const instrumented& lhs, const instrumented& rhs) { return lhs._v == rhs._v; }
+	friend bool operator!=(const instrumented& lhs, const instrumented& rhs) { return lhs._v != rhs._v; }
+	friend bool operator< (const instrumented& lhs, const instrumented& rhs) { return lhs._v <  rhs._v; }
+	friend bool operator> (const instrumented& lhs, const instrumented& rhs) { return lhs._v >  rhs._v; }
+	friend bool operator<=(const instrumented& lhs, const instrumented& rhs) { return lhs._v <= rhs._v; }
+	friend bool operator>=(const instrumented& lhs, const instrumented& rhs) { return lhs._v >= rhs._v; }
+
+	friend std::ostream& operator<<(std::ostream& ostr, const instrumented& v) { return ostr << v._v; }
+
+	// selectors
+	const Number& value() const { return _v; }
+	// explicit conversion to the wrapped type and to the native types it converts to
+	template<typename T, typename = typename std::enable_if_t<std::is_same_v<T, Number> || std::is_arithmetic_v<T> > >
+	explicit operator T() const { return static_cast<T>(_v); }
+
+private:
+	Number _v;
+
+	struct raw {};
+	// results of arithmetic operators are not counted as loads
+	instrumented(const Number& v, raw) : _v{ v } {}
+
+	// the reference needs to hold the product of two significants exactly
+	static constexpr int digits = std::numeric_limits<Number>::digits;
+	using Reference = std::conditional_t<(2 * digits <= std::numeric_limits<double>::digits), double, long double>;
+	static constexpr bool classifyRounding = (2 * digits <= std::numeric_limits<Reference>::digits);
+
+	static void classify(Reference reference, const Number& r, Reference a, Reference b) {
+		typename stats::counters& c = stats::global();
+		Reference result = static_cast<Reference>(r);
+		if (std::isnan(result)) {
+			if (!std::isnan(a) && !std::isnan(b)) stats::count(c.nan);
+			return;
+		}
+		if (std::isnan(reference)) return;
+		if (std::isfinite(reference) && std::abs(reference) > static_cast<Reference>(std::numeric_limits<Number>::max())) {
+			stats::count(c.saturate);
+		}
+		if constexpr (classifyRounding) {
+			if (result != reference) stats::count(c.rounding);
+		}
+	}
+	static Number add(const Number& a, const Number& b) {
+		stats::count(stats::global().add);
+		Number r = a + b;
+		Reference ra = static_cast<Reference>(a), rb = static_cast<Reference>(b);
+		classify(ra + rb, r, ra, rb);
+		return r;
+	}
+	static Number sub(const Number& a, const Number& b) {
+		stats::count(stats::global().sub);
+		Number r = a - b;
+		Reference ra = static_cast<Reference>(a), rb = static_cast<Reference>(b);
+		classify(ra - rb, r, ra, rb);
+		return r;
+	}
+	static Number mul(const Number& a, const Number& b) {
+		stats::count(stats::global().mul);
+		Number r = a * b;
+		Reference ra = static_cast<Reference>(a), rb = static_cast<Reference>(b);
+		classify(ra * rb, r, ra, rb);
+		return r;
+	}
+	static Number div(const Number& a, const Number& b) {
+		stats::count(stats::global().div);
+		Number r = a / b;
+		Reference ra = static_cast<Reference>(a), rb = static_cast<Reference>(b);
+		// division by zero produces a NaN reference for 0/0 and infinity otherwise
+		classify(ra / rb, r, ra, rb);
+		return r;
+	}
+};
+
+#else // !INSTRUMENTED_OPERATIONS_COUNT
+
+// instrumentation is disabled: the API compiles away
+template<typename Number>
+class instrumentation {
+public:
+	static instrumentation_counts snapshot() { return instrumentation_counts{}; }
+	static void reset() {}
+	static void record(const std::string&, const instrumentation_counts&) {}
+	static std::vector< std::pair<std::string, instrumentation_counts> > regions() { return {}; }
+	static void report(std::ostream& ostr, const std::string& title = "") {
+		if (!title.empty()) ostr << title << '\n';
+		ostr << "instrumentation disabled: set INSTRUMENTED_OPERATIONS_COUNT to 1 to enable\n";
+	}
+};
+
+template<typename Number>
+class instrumentation_region {
+public:
+	explicit instrumentation_region(const std::string&) {}
+	instrumentation_counts counts() const { return instrumentation_counts{}; }
+};
+
+template<typename Number>
+using instrumented = Number;
+
+#endif // INSTRUMENTED_OPERATIONS_COUNT
+
+}  // namespace sw::universal
+
+#if INSTRUMENTED_OPERATIONS_COUNT
+// numeric_limits of the instrumented type are those of the wrapped number system
+template<typename Number>
+class std::numeric_limits< sw::universal::instrumented<Number> > : public std::numeric_limits<Number> {
+	using Instrumented = sw::universal::instrumented<Number>;
+public:
+	static Instrumented min() { return Instrumented(std::numeric_limits<Number>::min()); }
+	static Instrumented max() { return Instrumented(std::numeric_limits<Number>::max()); }
+	static Instrumented lowest() { return Instrumented(std::numeric_limits<Number>::lowest()); }
+	static Instrumented epsilon() { return Instrumented(std::numeric_limits<Number>::epsilon()); }
+	static Instrumented round_error() { return Instrumented(std::numeric_limits<Number>::round_error()); }
+	static Instrumented infinity() { return Instrumented(std::numeric_limits<Number>::infinity()); }
+	static Instrumented quiet_NaN() { return Instrumented(std::numeric_limits<Number>::quiet_NaN()); }
+	static Instrumented signaling_NaN() { return Instrumented(std::numeric_limits<Number>::signaling_NaN()); }
+	static Instrumented denorm_min() { return Instrumented(std::numeric_limits<Number>::denorm_min()); }
+};
+#endif
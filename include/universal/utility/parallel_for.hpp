@@ -0,0 +1,56 @@
+#pragma once
+// parallel_for.hpp: minimal fork-join helper to partition an index range across threads
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace sw::universal {
+
+// number of worker threads to use when the caller does not specify a count
+inline size_t default_concurrency() {
+	size_t nrThreads = std::thread::hardware_concurrency();
+	return (nrThreads == 0 ? 1 : nrThreads);
+}
+
+// parallel_for partitions the index range [first, last) into contiguous chunks
+// and calls kernel(chunkBegin, chunkEnd) for each chunk on its own thread.
+// The calling thread processes the last chunk, so nrThreads == 1 runs serially
+// without creating any threads. Chunk boundaries are aligned to grain so that
+// kernels that operate on tiles of the index space never see a partial tile
+// other than at the end of the range.
+template<typename Kernel>
+void parallel_for(size_t first, size_t last, Kernel&& kernel, size_t nrThreads = 0, size_t grain = 1) {
+	if (last <= first) return;
+	if (grain == 0) grain = 1;
+	if (nrThreads == 0) nrThreads = default_concurrency();
+	size_t nrGrains = (last - first + grain - 1) / grain;
+	if (nrThreads > nrGrains) nrThreads = nrGrains;
+	if (nrThreads <= 1) {
+		kernel(first, last);
+		return;
+	}
+	size_t grainsPerThread = nrGrains / nrThreads;
+	size_t remainder = nrGrains % nrThreads;
+	std::vector<std::thread> workers;
+	workers.reserve(nrThreads - 1);
+	size_t begin = first;
+	for (size_t t = 0; t < nrThreads; ++t) {
+		size_t nrGrainsInChunk = grainsPerThread + (t < remainder ? 1 : 0);
+		size_t end = begin + nrGrainsInChunk * grain;
+		if (end > last) end = last;
+		if (t == nrThreads - 1) {
+			kernel(begin, end);
+		}
+		else {
+			workers.emplace_back([&kernel, begin, end]() { kernel(begin, end); });
+		}
+		begin = end;
+	}
+	for (auto& w : workers) w.join();
+}
+
+}  // namespace sw::universal
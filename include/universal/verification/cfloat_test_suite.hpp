@@ -1008,5 +1008,142 @@ namespace sw::universal {
 		return nrOfFailedTests;
 	}
 
+	/// <summary>
+	/// Round an exact double value to the nearest cfloat, ties to even, through a binary search of the
+	/// ascending encodings of the positive cfloats. The conversion from double truncates subnormal
+	/// values, so the verification of operators that produce subnormals uses this reference instead.
+	/// </summary>
+	/// <param name="v">value that is exactly representable as a double and no larger than maxpos</param>
+	/// <returns>correctly rounded cfloat</returns>
+	template<typename Cfloat>
+	Cfloat RoundToNearestCfloat(double v) {
+		Cfloat probe, result;
+		// the largest positive encodings are the nan and inf encodings
+		uint64_t maxposBits = (1ull << (Cfloat::nbits - 1)) - 1;
+		for (probe.setbits(maxposBits); probe.isnan() || probe.isinf(); probe.setbits(maxposBits)) --maxposBits;
+
+		// find the largest encoding with a value not larger than |v|
+		double magnitude = (v < 0 ? -v : v);
+		uint64_t lo = 0, hi = maxposBits;
+		while (lo < hi) {
+			uint64_t mid = (lo + hi + 1) / 2;
+			probe.setbits(mid);
+			if (double(probe) <= magnitude) lo = mid; else hi = mid - 1;
+		}
+		uint64_t bits = lo;
+		probe.setbits(bits);
+		double below = double(probe);
+		if (below != magnitude && bits < maxposBits) {
+			probe.setbits(bits + 1);
+			double midpoint = below + (double(probe) - below) / 2.0;
+			if (magnitude > midpoint || (magnitude == midpoint && (bits & 1ull))) ++bits;
+		}
+		result.setbits(bits);
+		if (v < 0) result = -result;
+		return result;
+	}
+
+	/// <summary>
+	/// Enumerate all multiplication cases for a number system configuration.
+	/// Uses doubles to create an exact product that RoundToNearestCfloat rounds to the reference.
+	/// </summary>
+	/// <typeparam name="TestType">the number system type to verify</typeparam>
+	/// <param name="bReportIndividualTestCases">if yes, report on individual test failures</param>
+	/// <returns>nr of failed test cases</returns>
+	template<typename TestType>
+	int VerifyCfloatMultiplication(bool bReportIndividualTestCases) {
+		constexpr size_t nbits = TestType::nbits;
+		static_assert(nbits < 16, "the double reference is exact only for small configurations");
+		constexpr size_t NR_VALUES = (size_t(1) << nbits);
+		int nrOfFailedTests = 0;
+
+		double maxpos = double(TestType(SpecificValue::maxpos));
+		TestType a, b, nut, cref;
+		for (size_t i = 0; i < NR_VALUES; i++) {
+			a.setbits(i);
+			double da = double(a);
+			for (size_t j = 0; j < NR_VALUES; j++) {
+				b.setbits(j);
+				double db = double(b);
+				double ref = da * db;
+				nut = a * b;
+				if (std::isnan(ref)) {
+					if (nut.isnan()) continue;
+					cref.setnan(NAN_TYPE_QUIET);
+				}
+				else if (std::isinf(ref)) {
+					if (nut.isinf() && nut.sign() == std::signbit(ref)) continue;
+					cref.setinf(std::signbit(ref));
+				}
+				else if (std::fabs(ref) > maxpos) {
+					continue;  // overflow is rounded by the same conversion as addition
+				}
+				else {
+					cref = RoundToNearestCfloat<TestType>(ref);
+				}
+				if (nut != cref) {
+					if (nut.iszero() && cref.iszero()) continue; // mismatched sign of zero is ignored as in addition
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "*", a, b, nut, cref);
+				}
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	/// <summary>
+	/// Enumerate all fused multiply-add cases a * b + c for a number system configuration.
+	/// The double fma is exact for small configurations, and RoundToNearestCfloat rounds it once.
+	/// </summary>
+	/// <typeparam name="TestType">the number system type to verify</typeparam>
+	/// <param name="bReportIndividualTestCases">if yes, report on individual test failures</param>
+	/// <returns>nr of failed test cases</returns>
+	template<typename TestType>
+	int VerifyCfloatFma(bool bReportIndividualTestCases) {
+		constexpr size_t nbits = TestType::nbits;
+		static_assert(nbits < 12, "the double reference is exact only for small configurations");
+		constexpr size_t NR_VALUES = (size_t(1) << nbits);
+		int nrOfFailedTests = 0;
+
+		double maxpos = double(TestType(SpecificValue::maxpos));
+		TestType a, b, c, nut, cref;
+		for (size_t i = 0; i < NR_VALUES; i++) {
+			a.setbits(i);
+			double da = double(a);
+			for (size_t j = 0; j < NR_VALUES; j++) {
+				b.setbits(j);
+				double db = double(b);
+				for (size_t k = 0; k < NR_VALUES; k++) {
+					c.setbits(k);
+					double ref = std::fma(da, db, double(c));
+					nut = fma(a, b, c);
+					if (std::isnan(ref)) {
+						if (nut.isnan()) continue;
+						cref.setnan(NAN_TYPE_QUIET);
+					}
+					else if (std::isinf(ref)) {
+						if (nut.isinf() && nut.sign() == std::signbit(ref)) continue;
+						cref.setinf(std::signbit(ref));
+					}
+					else if (std::fabs(ref) > maxpos) {
+						continue;
+					}
+					else {
+						cref = RoundToNearestCfloat<TestType>(ref);
+					}
+					if (nut != cref) {
+						if (nut.iszero() && cref.iszero()) continue;
+						nrOfFailedTests++;
+						if (bReportIndividualTestCases) {
+							std::cerr << "FAIL fma(" << a << ", " << b << ", " << c << ") = " << nut << " : " << to_binary(nut) << " reference " << cref << " : " << to_binary(cref) << '\n';
+						}
+						if (nrOfFailedTests > 24) return nrOfFailedTests;
+					}
+				}
+			}
+		}
+		return nrOfFailedTests;
+	}
+
 } // namespace sw::universal
 
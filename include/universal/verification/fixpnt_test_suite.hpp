@@ -357,6 +357,51 @@ int VerifyMultiplication(bool bReportIndividualTestCases) {
 	return nrOfFailedTests;
 }
 
+// enumerate all fused multiply-add cases a * b + c for an fixpnt<nbits,rbits> configuration
+// The reference is computed on the raw two's complement encodings: the exact sum carries 2 * rbits
+// fraction bits and is rounded to nearest even at rbits, and then wrapped or saturated.
+template<size_t nbits, size_t rbits, bool arithmetic, typename BlockType>
+int VerifyFusedMultiplyAdd(bool bReportIndividualTestCases) {
+	static_assert(nbits < 16, "the reference needs 2 * nbits + 1 bits of a long long to be exact");
+	constexpr long long NR_VALUES = (1ll << nbits);
+	auto signExtend = [](long long raw) { raw &= (NR_VALUES - 1); return (raw >= NR_VALUES / 2 ? raw - NR_VALUES : raw); };
+	int nrOfFailedTests = 0;
+	fixpnt<nbits, rbits, arithmetic, BlockType> a, b, c, result, cref;
+	for (long long i = 0; i < NR_VALUES; i++) {
+		a.setbits(static_cast<uint64_t>(i));
+		for (long long j = 0; j < NR_VALUES; j++) {
+			b.setbits(static_cast<uint64_t>(j));
+			for (long long k = 0; k < NR_VALUES; k++) {
+				c.setbits(static_cast<uint64_t>(k));
+				long long exact = signExtend(i) * signExtend(j) + signExtend(k) * (1ll << rbits);
+				long long rounded = exact >> rbits; // floor
+				if constexpr (rbits > 0) {
+					long long remainder = exact - rounded * (1ll << rbits);
+					long long half = (1ll << (rbits - 1));
+					if (remainder > half || (remainder == half && (rounded & 1))) ++rounded;
+				}
+				if constexpr (arithmetic == Modulo) {
+					rounded = signExtend(rounded);
+				}
+				else {
+					if (rounded > NR_VALUES / 2 - 1) rounded = NR_VALUES / 2 - 1;
+					if (rounded < -NR_VALUES / 2) rounded = -NR_VALUES / 2;
+				}
+				cref.setbits(static_cast<uint64_t>(rounded));
+				result = fma(a, b, c);
+				if (result != cref) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases) {
+						std::cerr << "FAIL fma(" << a << ", " << b << ", " << c << ") = " << result << " : " << to_binary(result) << " reference " << cref << " : " << to_binary(cref) << '\n';
+					}
+				}
+				if (nrOfFailedTests > 24) return nrOfFailedTests;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
 // enumerate all division cases for an fixpnt<nbits,rbits> configuration
 template<size_t nbits, size_t rbits, bool arithmetic, typename BlockType>
 int VerifyDivision(bool bReportIndividualTestCases) {
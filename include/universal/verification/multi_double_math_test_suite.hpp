@@ -0,0 +1,169 @@
+#pragma once
+//  multi_double_math_test_suite.hpp : test suite runners for the mathematical library of the multi-component floating-point types
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+
+/*
+   dd_real and qd_real run the same checks against high-precision references: the bound is
+   the binary exponent of the largest acceptable relative error, so each type passes the
+   precision it promises. The reference values are computed with 90-digit decimal arithmetic.
+ */
+
+namespace sw::universal {
+
+	// the relative error of a result against a reference, as a binary exponent
+	template<typename Real>
+	bool MultiDoubleWithinBound(const Real& result, const Real& reference, int bound) {
+		if (reference.iszero()) return result.iszero();
+		Real error = abs((result - reference) / reference);
+		return error.iszero() || double(error) <= std::ldexp(1.0, -bound);
+	}
+
+	template<typename Real>
+	Real MultiDoubleDecimal(const std::string& number) {
+		Real v;
+		parse(number, v);
+		return v;
+	}
+
+	template<typename Real>
+	bool CheckMultiDouble(bool reportTestCases, const std::string& label, const Real& result, const std::string& reference, int bound) {
+		Real ref = MultiDoubleDecimal<Real>(reference);
+		if (MultiDoubleWithinBound(result, ref, bound)) return true;
+		if (reportTestCases) std::cerr << "FAIL: " << std::setw(16) << label << " = " << result << " expected " << ref << '\n';
+		return false;
+	}
+
+	template<typename Real>
+	int VerifyMultiDoubleExponentials(bool reportTestCases, int bound) {
+		int nrOfFailedTests = 0;
+		if (!CheckMultiDouble(reportTestCases, "exp(1)", exp(Real(1.0)), "2.718281828459045235360287471352662497757247093699959574966967627724", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "exp(0.5)", exp(Real(0.5)), "1.648721270700128146848650787814163571653776100710148011575079311641", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "exp(-30)", exp(Real(-30.0)), "9.357622968840174604915832223378706744958322688935880416413318619961e-14", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "exp(700)", exp(Real(700.0)), "1.014232054735004509455329595231267615204679572243073348780536281249e+304", bound - 4)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "log(3)", log(Real(3.0)), "1.098612288668109691395245236922525704647490557822749451734694333637", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "log(1e300)", log(MultiDoubleDecimal<Real>("1e300")), "6.907755278982137052053974364053092622803304465886318928099983702903e+2", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "log(2^-1000)", log(ldexp(Real(1.0), -1000)), "-6.931471805599453094172321214581765680755001343602552541206800094934e+2", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "log(2^-96)", log(ldexp(Real(1.0), -96)), "-6.654212933375474970405428365998495053524801289858450439558528091137e+1", bound)) ++nrOfFailedTests;
+		if (log2(ldexp(Real(1.0), -28)) != Real(-28.0) || log10(Real(1.0e20)) != Real(20.0) || exp2(Real(-7.0)) != Real(0.0078125)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: exact powers of two and ten\n";
+		}
+		if (!CheckMultiDouble(reportTestCases, "log10(7)", log10(Real(7.0)), "8.450980400142568307122162585926361934835723963239654065036349537183e-1", bound - 1)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "log2(7)", log2(Real(7.0)), "2.807354922057604107441969317231830808641026625966140783677291724070", bound - 1)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "pow(3,2.5)", pow(Real(3.0), Real(2.5)), "1.558845726811989564174701707355285130248524728429342565250226281507e+1", bound - 2)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "cbrt(2)", cbrt(Real(2.0)), "1.259921049894873164767210607278228350570251464701507980081975112155", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "exp2(10)", exp2(Real(10.0)), "1024", bound - 2)) ++nrOfFailedTests;
+		if (pow(Real(2.0), 100) != ldexp(Real(1.0), 100) || pow(Real(2.0), -3) != Real(0.125)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: integer powers are exact\n";
+		}
+
+		// small arguments keep their full relative precision: compare against the leading terms of the series
+		Real x = ldexp(Real(1.0), -60);
+		Real series = x + sqr(x) / 2.0 + x * sqr(x) / 6.0 + sqr(sqr(x)) / 24.0;
+		if (!MultiDoubleWithinBound(expm1(x), series, bound)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: expm1(2^-60) = " << expm1(x) << " expected " << series << '\n';
+		}
+		series = x - sqr(x) / 2.0 + x * sqr(x) / 3.0 - sqr(sqr(x)) / 4.0;
+		if (!MultiDoubleWithinBound(log1p(x), series, bound)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: log1p(2^-60) = " << log1p(x) << " expected " << series << '\n';
+		}
+
+		// exp and log are inverses of each other
+		for (double v : { 0.001, 0.75, 2.5, 123.456, 1.0e10 }) {
+			Real a(v);
+			if (!MultiDoubleWithinBound(exp(log(a)), a, bound - 3)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: exp(log(" << v << ")) = " << exp(log(a)) << '\n';
+			}
+		}
+
+		// special values follow IEEE semantics
+		if (!exp(Real(1000.0)).isinf() || !exp(Real(-1000.0)).iszero() || !log(Real(-1.0)).isnan() || !log(Real(0.0)).isinf()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: special values of exp and log\n";
+		}
+		return nrOfFailedTests;
+	}
+
+	template<typename Real>
+	int VerifyMultiDoubleTrigonometry(bool reportTestCases, int bound) {
+		int nrOfFailedTests = 0;
+		if (!CheckMultiDouble(reportTestCases, "sin(1)", sin(Real(1.0)), "8.414709848078965066525023216302989996225630607983710656727517099919e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "cos(1)", cos(Real(1.0)), "5.403023058681397174009366074429766037323104206179222276700972553811e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "sin(100)", sin(Real(100.0)), "-5.063656411097587936565576104597854320650327212906573234433924735944e-1", bound - 2)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "atan(0.5)", atan(Real(0.5)), "4.636476090008061162142562314612144020285370542861202638109330887202e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "atan(-3)", atan(Real(-3.0)), "-1.249045772398254425829917077281090123077829404129896719054669236797", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "asin(0.3)", asin(MultiDoubleDecimal<Real>("0.3")), "3.046926540153975079720029612275291669545600317067763873929779487465e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "4 atan(1)", 4.0 * atan(Real(1.0)), "3.141592653589793238462643383279502884197169399375105820974944592308", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "sin(pi/6)", sin(multi_double_traits<Real>::pi / 6.0), "0.5", bound - 2)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "acos(-1)", acos(Real(-1.0)), "3.141592653589793238462643383279502884197169399375105820974944592308", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "atan2(-1,-1)", atan2(Real(-1.0), Real(-1.0)), "-2.356194490192344928846982537459627163147877049531329365731208444231", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "tan(pi/4)", tan(multi_double_traits<Real>::pi_4), "1", bound - 2)) ++nrOfFailedTests;
+
+		// the Pythagorean identity and inverse functions over a range of arguments
+		for (double v : { -7.5, -1.25, 0.001, 0.5, 1.5, 3.0, 42.0 }) {
+			Real a(v), s, c;
+			sincos(a, s, c);
+			if (!MultiDoubleWithinBound(sqr(s) + sqr(c), Real(1.0), bound)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: sin^2 + cos^2 at " << v << '\n';
+			}
+			if (s != sin(a) || c != cos(a)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: sincos differs from sin and cos at " << v << '\n';
+			}
+		}
+		for (double v : { -0.9, -0.25, 0.125, 0.6, 0.99 }) {
+			Real a(v);
+			if (!MultiDoubleWithinBound(sin(asin(a)), a, bound - 2) || !MultiDoubleWithinBound(cos(acos(a)), a, bound - 4) || !MultiDoubleWithinBound(tan(atan(a)), a, bound - 2)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: inverse trigonometric functions at " << v << '\n';
+			}
+		}
+		if (!asin(Real(1.5)).isnan() || !sin(Real(INFINITY)).isnan()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: special values of the trigonometric functions\n";
+		}
+		return nrOfFailedTests;
+	}
+
+	template<typename Real>
+	int VerifyMultiDoubleHyperbolic(bool reportTestCases, int bound) {
+		int nrOfFailedTests = 0;
+		if (!CheckMultiDouble(reportTestCases, "sinh(1)", sinh(Real(1.0)), "1.175201193643801456882381850595600815155717981334095870229565413013", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "cosh(1)", cosh(Real(1.0)), "1.543080634815243778477905620757061682601529112365863704737402214711", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "tanh(0.5)", tanh(Real(0.5)), "4.621171572600097585023184836436725487302892803301130385527318158381e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "asinh(2)", asinh(Real(2.0)), "1.443635475178810342493276740273105269405553003156981558983054506520", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "acosh(3)", acosh(Real(3.0)), "1.762747174039086050465218649959584618056320656523270821506591217307", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "atanh(0.3)", atanh(MultiDoubleDecimal<Real>("0.3")), "3.095196042031117154740673490610694375840916075891729639798276803629e-1", bound)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "sinh(-40)", sinh(Real(-40.0)), "-1.1769263341850999270394995537451740013025868098148323595370823416531557e+17", bound - 2)) ++nrOfFailedTests;
+		// sinh and cosh overflow above ln(2 DBL_MAX), not at the overflow threshold of exp
+		if (!CheckMultiDouble(reportTestCases, "sinh(709.875)", sinh(Real(709.875)), "9.8574673076395374321146619454459835757499337169775451702618596411668447e+307", bound - 4)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "sinh(-710.25)", sinh(Real(-710.25)), "-1.4342530302495123030347795601215930451088304822241257469408568564354529e+308", bound - 4)) ++nrOfFailedTests;
+		if (!CheckMultiDouble(reportTestCases, "cosh(710.25)", cosh(Real(710.25)), "1.4342530302495123030347795601215930451088304822241257469408568564354529e+308", bound - 4)) ++nrOfFailedTests;
+		if (!sinh(Real(710.5)).isinf() || !cosh(Real(-710.5)).isinf()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: overflow of sinh and cosh\n";
+		}
+		if (!CheckMultiDouble(reportTestCases, "atanh(2^-60+2^-140)", atanh(ldexp(Real(1.0), -60) + ldexp(Real(1.0), -140)), "8.6736173798840354720596295816076710366447546188283079532740289222986719e-19", bound)) ++nrOfFailedTests;
+		for (double v : { -5.0, -0.01, 0.3, 2.0, 20.0 }) {
+			Real a(v);
+			if (!MultiDoubleWithinBound(sqr(cosh(a)) - sqr(sinh(a)), Real(1.0), bound - 2 * int(std::abs(v) * 1.45))) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: cosh^2 - sinh^2 at " << v << '\n';
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+} // namespace sw::universal
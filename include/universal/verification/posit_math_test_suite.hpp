@@ -15,6 +15,7 @@
 #include <universal/number/posit/math_functions.hpp>
 #include <universal/verification/test_reporters.hpp>
 #include <universal/verification/posit_test_suite.hpp>
+#include <universal/verification/posit_test_randoms.hpp>  // SaturatingReference
 
 namespace sw::universal {
 
@@ -108,7 +109,7 @@ int VerifyExp(bool bReportIndividualTestCases) {
 		pexp = sw::universal::exp(pa);
 		// generate reference
 		double da = double(pa);
-		pref = std::exp(da);
+		pref = SaturatingReference<posit<nbits, es>>(std::exp(da));
 		if (pexp != pref) {
 			if (std::exp(da) != 0.0) { // exclude special posit rounding rule that projects to minpos
 				nrOfFailedTests++;
@@ -134,7 +135,7 @@ int VerifyExp2(bool bReportIndividualTestCases) {
 		pexp2 = sw::universal::exp2(pa);
 		// generate reference
 		double da = double(pa);
-		pref = std::exp2(da);
+		pref = SaturatingReference<posit<nbits, es>>(std::exp2(da));
 		if (pexp2 != pref) {
 			if (std::exp2(da) != 0.0) { // exclude special posit rounding rule that projects to minpos
 				nrOfFailedTests++;
@@ -177,7 +178,7 @@ int VerifyPowerFunction(bool bReportIndividualTestCases, unsigned int maxSamples
 #else
 			ppow = pow(pa, pb);
 #endif
-			pref = std::pow(da, db);
+			pref = (da == 0.0 ? posit<nbits, es>(std::pow(da, db)) : SaturatingReference<posit<nbits, es>>(std::pow(da, db)));
 			if (ppow != pref) {
 				nrOfFailedTests++;
 				if (bReportIndividualTestCases)	ReportTwoInputFunctionError("FAIL", "pow", pa, pb, pref, ppow);
@@ -352,7 +353,7 @@ int VerifySinh(bool bReportIndividualTestCases) {
 		psinh = sw::universal::sinh(pa);
 		// generate reference
 		double da = double(pa);
-		pref = std::sinh(da);
+		pref = SaturatingReference<posit<nbits, es>>(std::sinh(da));
 		if (psinh != pref) {
 			nrOfFailedTests++;
 			if (bReportIndividualTestCases)	ReportOneInputFunctionError("FAIL", "sinh", pa, pref, psinh);
@@ -376,7 +377,7 @@ int VerifyCosh(bool bReportIndividualTestCases) {
 		pcosh = sw::universal::cosh(pa);
 		// generate reference
 		double da = double(pa);
-		pref = std::cosh(da);
+		pref = SaturatingReference<posit<nbits, es>>(std::cosh(da));
 		if (pcosh != pref) {
 			nrOfFailedTests++;
 			if (bReportIndividualTestCases)	ReportOneInputFunctionError("FAIL", "cosh", pa, pref, pcosh);
@@ -10,6 +10,8 @@
 #include <typeinfo>
 #include <random>
 #include <limits>
+#include <cmath>
+#include <type_traits>
 
 #include <universal/verification/test_status.hpp> // ReportTestResult
 #include <universal/verification/test_reporters.hpp>
@@ -111,91 +113,118 @@ namespace sw::universal {
 		testref = reference;
 	}
 
-	// Execute a unary operator
+	// the posit reference of a function value that overflowed double: posits do not overflow, they saturate to maxpos
 	template<typename TestType>
-	void executeUnary(int opcode, double da, const TestType& testa, TestType& testref, TestType& testresult, double dminpos) {
-		double reference = 0.0;
+	TestType SaturatingReference(double v) {
+		TestType p;
+		if (std::isinf(v)) {
+			p.maxpos();
+			return (v < 0 ? -p : p);
+		}
+		p = v;
+		return p;
+	}
+
+	// Execute a unary operator, with the reference evaluated in the Reference type:
+	// double, or an extended precision type for posits whose fraction is wider than that of double
+	template<typename TestType, typename Reference = double>
+	void executeUnary(int opcode, const Reference& da, const TestType& testa, TestType& testref, TestType& testresult, double dminpos) {
+		using std::sqrt; using std::exp; using std::exp2; using std::log; using std::log2; using std::log10;
+		using std::sin; using std::cos; using std::tan; using std::asin; using std::acos; using std::atan;
+		using std::sinh; using std::cosh; using std::tanh; using std::asinh; using std::acosh; using std::atanh;
+		Reference reference(0.0);
+		bool saturates = false;  // the posit function saturates where the double reference overflows
 		switch (opcode) {
 		case OPCODE_SQRT:
 			testresult = sw::universal::sqrt(testa);
-			reference = std::sqrt(da);
+			reference = sqrt(da);
 			break;
 		case OPCODE_EXP:
 			testresult = sw::universal::exp(testa);
-			reference = std::exp(da);
-			if (0.0 == reference) reference = dminpos;
+			reference = exp(da);
+			saturates = true;
+			if (reference == Reference(0.0)) reference = Reference(dminpos);
 			break;
 		case OPCODE_EXP2:
 			testresult = sw::universal::exp2(testa);
-			reference = std::exp2(da);
-			if (0.0 == reference) reference = dminpos;
+			reference = exp2(da);
+			saturates = true;
+			if (reference == Reference(0.0)) reference = Reference(dminpos);
 			break;
 		case OPCODE_LOG:
 			testresult = sw::universal::log(testa);
-			reference = std::log(da);
+			reference = log(da);
 			break;
 		case OPCODE_LOG2:
 			testresult = sw::universal::log2(testa);
-			reference = std::log2(da);
+			reference = log2(da);
 			break;
 		case OPCODE_LOG10:
 			testresult = sw::universal::log10(testa);
-			reference = std::log10(da);
+			reference = log10(da);
 			break;
 		case OPCODE_SIN:
 			testresult = sw::universal::sin(testa);
-			reference = std::sin(da);
+			reference = sin(da);
 			break;
 		case OPCODE_COS:
 			testresult = sw::universal::cos(testa);
-			reference = std::cos(da);
+			reference = cos(da);
 			break;
 		case OPCODE_TAN:
 			testresult = sw::universal::tan(testa);
-			reference = std::tan(da);
+			reference = tan(da);
 			break;
 		case OPCODE_ASIN:
 			testresult = sw::universal::asin(testa);
-			reference = std::asin(da);
+			reference = asin(da);
 			break;
 		case OPCODE_ACOS:
 			testresult = sw::universal::acos(testa);
-			reference = std::acos(da);
+			reference = acos(da);
 			break;
 		case OPCODE_ATAN:
 			testresult = sw::universal::atan(testa);
-			reference = std::atan(da);
+			reference = atan(da);
 			break;
 		case OPCODE_SINH:
 			testresult = sw::universal::sinh(testa);
-			reference = std::sinh(da);
+			reference = sinh(da);
+			saturates = true;
 			break;
 		case OPCODE_COSH:
 			testresult = sw::universal::cosh(testa);
-			reference = std::cosh(da);
+			reference = cosh(da);
+			saturates = true;
 			break;
 		case OPCODE_TANH:
 			testresult = sw::universal::tanh(testa);
-			reference = std::tanh(da);
+			reference = tanh(da);
 			break;
 		case OPCODE_ASINH:
 			testresult = sw::universal::asinh(testa);
-			reference = std::asinh(da);
+			reference = asinh(da);
 			break;
 		case OPCODE_ACOSH:
 			testresult = sw::universal::acosh(testa);
-			reference = std::acosh(da);
+			reference = acosh(da);
 			break;
 		case OPCODE_ATANH:
 			testresult = sw::universal::atanh(testa);
-			reference = std::atanh(da);
+			reference = atanh(da);
 			break;
 		case OPCODE_NOP:
 		default:
 			std::cerr << "Unsupported binary operator: operation ignored\n";
 			break;
 		}
-		testref = reference;
+		if constexpr (std::is_same_v<Reference, double>) {
+			if (saturates) testref = SaturatingReference<TestType>(reference); else testref = reference;
+		}
+		else {
+			// rounds once, saturates infinities to maxpos, and maps NaN to NaR
+			testref = internal::posit_from_extended<TestType::nbits, TestType::es>(reference);
+		}
 	}
 
 	// generate a random set of operands to test the binary operators for a posit configuration
@@ -285,7 +314,9 @@ namespace sw::universal {
 	// Basic design is that we generate nrOfRandom posit values and store them in an operand array.
 	// We will then execute the binary operator nrOfRandom combinations.
 	// provide 		double dminpos = double(minpos<nbits, es>(pminpos));
-	template<typename TestType>
+	// The Reference type evaluates the reference function values: double by default, and qd_real for
+	// posits with more fraction bits than double, whose correctly rounded results double cannot reproduce.
+	template<typename TestType, typename Reference = double>
 	int VerifyUnaryOperatorThroughRandoms(bool bReportIndividualTestCases, int opcode, uint32_t nrOfRandoms, double dminpos) {
 		std::string operation_string;
 		bool sqrtOperator = false;  // we need to filter negative values from the randoms
@@ -352,7 +383,8 @@ namespace sw::universal {
 			TestType testa, testresult, testref;
 			testa.setbits(distr(eng));
 			if (sqrtOperator && testa < 0) testa = -testa;
-			double da = double(testa);
+			Reference da;
+			if constexpr (std::is_same_v<Reference, double>) da = double(testa); else da = internal::posit_to_extended<Reference>(testa);
 			// in case you have numeric_limits<long double>::digits trouble... this will show that
 			//std::cout << "sizeof da: " << sizeof(da) << " bits in significant " << (std::numeric_limits<long double>::digits - 1) << " value da " << da << " at index " << ia << " testa " << testa << std::endl;
 #if POSIT_THROW_ARITHMETIC_EXCEPTION
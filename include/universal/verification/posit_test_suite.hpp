@@ -866,6 +866,59 @@ namespace sw::universal {
 		return nrOfFailedTests;
 	}
 
+	// enumerate all fused multiply-add cases for a posit configuration: is within 10sec till about nbits = 7
+	// the reference is the exact product plus addend accumulated in a quire and rounded once
+	template<size_t nbits, size_t es>
+	int VerifyFma(bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		const size_t NR_POSITS = (size_t(1) << nbits);
+		for (size_t i = 0; i < NR_POSITS; i++) {
+			posit<nbits, es> pa;
+			pa.setbits(i);
+			for (size_t j = 0; j < NR_POSITS; j++) {
+				posit<nbits, es> pb;
+				pb.setbits(j);
+				for (size_t k = 0; k < NR_POSITS; k++) {
+					posit<nbits, es> pc, pfma, pref;
+					pc.setbits(k);
+					if (pa.isnar() || pb.isnar() || pc.isnar()) {
+						pref.setnar();
+					}
+					else {
+						quire<nbits, es, 2> q(pc);
+						q += quire_mul(pa, pb);
+						convert(q.to_value(), pref);
+					}
+#if POSIT_THROW_ARITHMETIC_EXCEPTION
+					try {
+						pfma = fma(pa, pb, pc);
+					}
+					catch (const operand_is_nar&) {
+						if (pref.isnar()) {
+							// correctly caught the exception
+							pfma.setnar();
+						}
+						else {
+							throw;  // rethrow
+						}
+					}
+#else
+					pfma = fma(pa, pb, pc);
+#endif
+					posit<nbits, es> pvalue;
+					pvalue = fma_value(pa, pb, pc);  // the unrounded interface rounds on assignment
+					if (pfma != pref || pvalue != pref) {
+						if (bReportIndividualTestCases) {
+							std::cerr << "FAIL fma(" << pa << ", " << pb << ", " << pc << ") = " << pfma << " : " << pfma.get() << " fma_value " << pvalue << " reference " << pref << " : " << pref.get() << '\n';
+						}
+						nrOfFailedTests++;
+					}
+				}
+			}
+		}
+		return nrOfFailedTests;
+	}
+
 	// enumerate all multiplication cases for a posit configuration: is within 10sec till about nbits = 14
 	template<size_t nbits, size_t es>
 	int VerifyInPlaceMultiplication(bool bReportIndividualTestCases) {
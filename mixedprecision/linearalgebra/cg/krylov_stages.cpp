@@ -0,0 +1,89 @@
+// krylov_stages.cpp: tuning the precision of the matvec, dot, and update stages of the Krylov solvers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+// configure the posit library with fast posits
+#define POSIT_FAST_POSIT_32_2 1
+#define POSIT_FAST_POSIT_16_1 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/blas.hpp>
+
+void PrintReport(const std::string& label, const sw::universal::blas::krylov_report& report) {
+	double total = 0.0;
+	for (auto t : report.iterationTimes) total += t;
+	std::cout << std::setw(36) << std::left << label << std::right
+		<< std::setw(6) << report.iterations
+		<< std::setw(14) << std::scientific << std::setprecision(3) << report.residual
+		<< std::setw(12) << std::fixed << std::setprecision(2) << 1000.0 * total
+		<< std::setw(10) << 1000.0 * report.matvecTime
+		<< std::setw(10) << 1000.0 * report.dotTime
+		<< std::setw(10) << 1000.0 * report.updateTime
+		<< std::setw(10) << 1000.0 * report.preconditionerTime
+		<< (report.converged ? "" : "  (not converged)") << '\n';
+}
+
+// solve the Poisson problem in the precision policy Precision with vectors of Scalar
+template<typename Precision, typename Scalar, typename Preconditioner>
+void Solve(const std::string& label, const sw::universal::blas::compressed_matrix<Scalar>& A, const Preconditioner& M, double tolerance) {
+	using namespace sw::universal::blas;
+	vector<Scalar> b(A.rows()), x(A.rows());
+	for (size_t i = 0; i < b.size(); ++i) { b[i] = Scalar(1.0); x[i] = Scalar(0.0); }
+	krylov_options options;
+	options.tolerance = tolerance;
+	options.maxIterations = 400;
+	PrintReport(label, pcg<Precision>(A, M, b, x, options));
+}
+
+int main()
+try {
+	using namespace sw::universal;
+	using namespace sw::universal::blas;
+
+	constexpr size_t N = 32;
+	compressed_matrix<double> A;
+	laplace2D(A, N, N);
+	compressed_matrix<float> Af(A);
+	compressed_matrix< posit<32, 2> > Ap(A);
+	compressed_matrix< posit<16, 1> > Ah(A);
+
+	std::cout << "PCG on the " << N << "x" << N << " Poisson problem: time per stage in milliseconds\n";
+	std::cout << std::setw(36) << std::left << "matvec / dot / update" << std::right
+		<< std::setw(6) << "itr" << std::setw(14) << "residual" << std::setw(12) << "total"
+		<< std::setw(10) << "matvec" << std::setw(10) << "dot" << std::setw(10) << "update" << std::setw(10) << "precond" << '\n';
+
+	Solve<void, double>("double / double / double", A, identity_preconditioner{}, 1.0e-10);
+	Solve<void, double>("double + ILU(0)", A, ilu0_preconditioner<double>(A), 1.0e-10);
+	Solve<void, float>("float / float / float", Af, identity_preconditioner{}, 1.0e-6);
+	Solve<krylov_precision<float, double>, float>("float / double / float", Af, identity_preconditioner{}, 1.0e-6);
+	Solve<krylov_precision<double, double, float>, float>("double / double / float", Af, identity_preconditioner{}, 1.0e-6);
+
+	using P32 = posit<32, 2>;
+	using Q32 = quire<32, 2>;
+	Solve<void, P32>("posit32 / posit32 / posit32", Ap, identity_preconditioner{}, 1.0e-6);
+	Solve<krylov_precision<P32, Q32>, P32>("posit32 / quire / posit32", Ap, identity_preconditioner{}, 1.0e-6);
+	Solve<krylov_precision<Q32, Q32>, P32>("quire / quire / posit32", Ap, identity_preconditioner{}, 1.0e-6);
+	Solve<krylov_precision<Q32, Q32>, P32>("quire / quire / posit32 + Jacobi", Ap, jacobi_preconditioner<P32>(Ap), 1.0e-6);
+
+	using P16 = posit<16, 1>;
+	using Q16 = quire<16, 1>;
+	Solve<void, P16>("posit16 / posit16 / posit16", Ah, identity_preconditioner{}, 1.0e-3);
+	Solve<krylov_precision<Q16, Q16>, P16>("quire / quire / posit16", Ah, identity_preconditioner{}, 1.0e-3);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -8,70 +8,204 @@
 #include <string>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <vector>
+#include <algorithm>
 
 // minimum set of include files to reflect source code dependencies
 #include <universal/number/adaptivefloat/adaptivefloat.hpp>
 #include <universal/verification/test_status.hpp> // ReportTestResult
 
-// generate specific test case that you can trace with the trace conditions in mpreal.hpp
-// for most bugs they are traceable with _trace_conversion and _trace_add
+// generate specific test case that you can trace
 template<typename Ty>
 void GenerateTestCase(Ty _a, Ty _b) {
 	Ty ref;
-	sw::universal::adaptivefloat a, b, aref, asum;
+	sw::universal::adaptivefloat a, b, asum;
 	a = _a;
 	b = _b;
 	asum = a + b;
 	ref = _a + _b;
-	aref = ref;
 
 	auto precision = std::cout.precision();
 	constexpr size_t ndigits = std::numeric_limits<Ty>::digits10;
 	std::cout << std::setprecision(ndigits);
 	std::cout << std::setw(ndigits) << _a << " + " << std::setw(ndigits) << _b << " = " << std::setw(ndigits) << ref << std::endl;
-	std::cout << a << " + " << b << " = " << asum << " (reference: " << aref << ")   " ;
-	std::cout << (aref == asum ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << a << " + " << b << " = " << asum.str() << " (rounded reference: " << ref << ")" << std::endl;
 	std::cout << std::setprecision(precision);
 }
 
-// progressions
-void Progressions(uint32_t digit) {
-	using namespace std;
-	using BlockType = uint32_t;
-	sw::universal::adaptivefloat f;
-	vector<BlockType> coef;
-
-	constexpr size_t digitsInWord = 9;
-	coef.clear();
-	coef.push_back(digit);
-	for (size_t i = 0; i < digitsInWord; ++i) {
-		f.test(false, -1, coef);
-		cout << "(+, exp = -1, coef = " << coef[0] << ") = " << f << endl;
-		coef[0] *= 10;
-		coef[0] += digit;
+// operands spread over a wide dynamic range so that a double accumulator loses most of them
+std::vector<double> WideRangeOperands(std::mt19937_64& engine, size_t n, int range) {
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-range, range);
+	std::vector<double> v(n);
+	for (double& x : v) x = std::ldexp(mantissa(engine), exponent(engine));
+	return v;
+}
+
+// adding a sequence and then subtracting it in a different order leaves exactly zero
+int VerifyExactReduction(bool reportTestCases, size_t nrOfTests, size_t n, int range) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(n + size_t(range));
+	for (size_t t = 0; t < nrOfTests; ++t) {
+		std::vector<double> v = WideRangeOperands(engine, n, range);
+		adaptivefloat sum;
+		for (double x : v) sum += x;
+		std::shuffle(v.begin(), v.end(), engine);
+		adaptivefloat residual(sum);
+		for (double x : v) residual -= x;
+		if (!residual.iszero()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: residual of a " << n << " term reduction is " << residual.str(20) << '\n';
+		}
+		// pairwise summation of expansions must agree with the running sum
+		std::vector<adaptivefloat> partial(v.size());
+		for (size_t i = 0; i < v.size(); ++i) partial[i] = v[i];
+		while (partial.size() > 1) {
+			std::vector<adaptivefloat> next;
+			for (size_t i = 0; i + 1 < partial.size(); i += 2) next.push_back(partial[i] + partial[i + 1]);
+			if (partial.size() & 1) next.push_back(partial.back());
+			partial.swap(next);
+		}
+		if (partial[0] != sum) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: pairwise sum " << partial[0].str(20) << " != running sum " << sum.str(20) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// catastrophic cancellation that defeats double and Kahan summation
+int VerifyCancellation(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	{
+		adaptivefloat sum;
+		for (double x : { 1.0e100, 1.0, -1.0e100, 1.0e-100, 3.0, -1.0e-100 }) sum += x;
+		if (sum != 4 || double(sum) != 4.0) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: 1e100 + 1 - 1e100 + 1e-100 + 3 - 1e-100 = " << sum.str() << '\n';
+		}
+	}
+	{
+		// the sum of 2^k for k in [-1074, 1022] needs every bit of the double exponent range
+		adaptivefloat sum;
+		for (int k = 1022; k >= -1074; --k) sum += std::ldexp(1.0, k);
+		adaptivefloat expected(std::ldexp(1.0, 1023));
+		expected -= std::ldexp(1.0, -1074);
+		adaptivefloat residual = sum - expected;
+		if (!residual.iszero() || sum.components() > adaptivefloat::compressionThreshold) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: full range sum with " << sum.components() << " components, residual " << residual.str(20) << '\n';
+		}
+	}
+	{
+		adaptivefloat a(0.1), b(0.2), c(0.3);
+		adaptivefloat d = a + b - c;
+		// 0.1 + 0.2 = s + r exactly, and s - 0.3 is exact by Sterbenz' lemma
+		auto [s, r] = sw::function::twoSum(0.1, 0.2);
+		adaptivefloat expected(s - 0.3);
+		expected += r;
+		if (d != expected || d.iszero()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: 0.1 + 0.2 - 0.3 = " << d.str() << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// compression keeps the number of components bounded during long accumulations
+int VerifyCompression(bool reportTestCases, size_t n) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(3);
+	// a dynamic range of 2^200 needs at most five nonadjacent components
+	std::vector<double> v = WideRangeOperands(engine, n, 100);
+	adaptivefloat sum;
+	size_t maxComponents = 0;
+	for (double x : v) {
+		sum += x;
+		maxComponents = std::max(maxComponents, sum.components());
+	}
+	if (maxComponents > adaptivefloat::compressionThreshold + 1) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: expansion grew to " << maxComponents << " components\n";
+	}
+	adaptivefloat compressed(sum);
+	compressed.compress();
+	if (compressed != sum || compressed.components() > sum.components() || double(compressed) != double(sum)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: compression changed the value " << compressed.str(30) << " vs " << sum.str(30) << '\n';
 	}
-	coef.clear();
-	coef.push_back(digit);
-	for (size_t i = 0; i < digitsInWord; ++i) {
-		f.test(false, 0, coef);
-		cout << "(+, exp = 0, coef = " << coef[0] << ") = " << f << endl;
-		coef[0] *= 10;
-		coef[0] += digit;
+	return nrOfFailedTests;
+}
+
+// after a warm-up, a reduction loop recycles its blocks instead of calling the global allocator
+int VerifyArenaRecycling(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(5);
+	std::vector<double> v = WideRangeOperands(engine, 1000, 300);
+	auto reduce = [&v]() {
+		adaptivefloat sum;
+		for (size_t i = 0; i + 1 < v.size(); i += 2) {
+			adaptivefloat pair(v[i]);
+			pair += v[i + 1];
+			sum += pair;
+		}
+		return sum;
+	};
+	adaptivefloat warmup = reduce();
+	expansion_arena::statistics before = expansion_arena::stats();
+	adaptivefloat result = reduce();
+	expansion_arena::statistics after = expansion_arena::stats();
+	uint64_t fresh = (after.allocations - before.allocations) - (after.recycled - before.recycled);
+	if (result != warmup || fresh > 4) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: " << fresh << " fresh blocks out of " << (after.allocations - before.allocations) << " allocations\n";
+	}
+	return nrOfFailedTests;
+}
+
+// integer conversions and the decimal representation
+int VerifyConversion(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	struct { long long v; const char* s; } integers[] = {
+		{ 0, "0" }, { 1, "1" }, { -7, "-7" }, { 9007199254740993LL, "9007199254740993" },
+		{ std::numeric_limits<long long>::min(), "-9223372036854775808" }, { std::numeric_limits<long long>::max(), "9223372036854775807" },
+	};
+	for (auto& c : integers) {
+		adaptivefloat a(c.v);
+		if (a.str() != c.s || a != c.v) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << c.v << " converts to " << a.str() << '\n';
+		}
+	}
+	struct { double v; size_t digits; const char* s; } reals[] = {
+		{ 0.5, 0, "0.5" }, { -0.375, 0, "-0.375" }, { 1.0e-5, 3, "1e-05" }, { 0.1, 0, "0.1000000000000000055511151231257827021181583404541015625" },
+		{ 0.1, 6, "0.1" }, { 123456789.0, 6, "1.23457e+08" }, { 999999.5, 6, "1e+06" }, { 0.0001234, 3, "0.000123" },
+	};
+	for (auto& c : reals) {
+		adaptivefloat a(c.v);
+		if (a.str(c.digits) != c.s || double(a) != c.v) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << c.v << " with " << c.digits << " digits renders as " << a.str(c.digits) << " instead of " << c.s << '\n';
+		}
 	}
-	coef.clear();
-	coef.push_back(digit);
-	for (size_t i = 0; i < digitsInWord; ++i) {
-		f.test(false, 1, coef);
-		cout << "(+, exp = 1, coef = " << coef[0] << ") = " << f << endl;
-		coef[0] *= 10;
-		coef[0] += digit;
+	adaptivefloat big("-123456789012345678901234567890"), exact("1.5e-3"), p;
+	if (big.str() != "-123456789012345678901234567890" || exact.str(2) != "0.0015" || parse("12x", p) || !parse("-2.5E+2", p) || p != -250) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: parse " << big.str() << ' ' << exact.str(2) << ' ' << p << '\n';
 	}
+	return nrOfFailedTests;
 }
 
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
-int main(int argc, char** argv)
+int main()
 try {
 	using namespace std;
 	using namespace sw::universal;
@@ -81,50 +215,25 @@ try {
 	std::string tag = "adaptive precision linear float addition failed: ";
 
 #if MANUAL_TESTING
-//	bool bReportIndividualTestCases = false;
 
 	// generate individual testcases to hand trace/debug
-	GenerateTestCase(INFINITY, INFINITY);
-
-	adaptivefloat f;
-	f = 0;
-	cout << f << endl;
-
-	vector<uint32_t> coef;
-
-	Progressions(1);
-	Progressions(9);
-
-	coef.clear();
-	coef.push_back(0);
-	f.test(false, 0, coef);
-	for (int i = 0; i < 13; ++i) {
-		coef[0] += 1;
-		f.test(false, 0, coef);
-		cout << "(+, exp = 0, coef = " << coef[0] << ") = " << f << endl;
-	}
-	coef[0] = 999999999;
-	f.test(false, 0, coef);
-	cout << "(+, exp = 0, coef = " << coef[0] << ") = " << f << endl;
-	coef.push_back(0);
-	for (int i = 0; i < 13; ++i) {
-		coef[0] = 0;
-		coef[1] += 1;
-		f.test(false, 0, coef);
-		cout << "(+, exp = 0, coef = " << coef[0] << ", " << coef[1] << ") = " << f << endl;
-		coef[0] = 999999999;
-		f.test(false, 0, coef);
-		cout << "(+, exp = 0, coef = " << coef[0] << ", " << coef[1] << ") = " << f << endl;
-
-	}
+	GenerateTestCase(1.0e100, 1.0);
+	GenerateTestCase(0.1, 0.2);
 
 #else
 
 	cout << "adaptive precision linear float addition validation" << endl;
 
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyConversion(bReportIndividualTestCases), "adaptivefloat", "conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyCancellation(bReportIndividualTestCases), "adaptivefloat", "cancellation");
+	nrOfFailedTestCases += ReportTestResult(VerifyExactReduction(bReportIndividualTestCases, 100, 100, 60), "adaptivefloat", "exact reduction");
+	nrOfFailedTestCases += ReportTestResult(VerifyExactReduction(bReportIndividualTestCases, 20, 1000, 900), "adaptivefloat", "exact reduction");
+	nrOfFailedTestCases += ReportTestResult(VerifyCompression(bReportIndividualTestCases, 10000), "adaptivefloat", "compression");
+	nrOfFailedTestCases += ReportTestResult(VerifyArenaRecycling(bReportIndividualTestCases), "adaptivefloat", "arena recycling");
 
 #if STRESS_TESTING
-
+	nrOfFailedTestCases += ReportTestResult(VerifyExactReduction(bReportIndividualTestCases, 100, 100000, 1000), "adaptivefloat", "exact reduction");
 #endif  // STRESS_TESTING
 
 #endif  // MANUAL_TESTING
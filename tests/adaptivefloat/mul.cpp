@@ -0,0 +1,155 @@
+// mul.cpp: functional tests for multiplication and division on adaptive precision linear floating point
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <random>
+
+// configure the adaptivefloat arithmetic class
+#define ADAPTIVEFLOAT_THROW_ARITHMETIC_EXCEPTION 1
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/adaptivefloat/adaptivefloat.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+// an expansion of a few random doubles that are spread over a moderate range
+sw::universal::adaptivefloat RandomExpansion(std::mt19937_64& engine, size_t nrTerms) {
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-80, 80);
+	sw::universal::adaptivefloat v;
+	for (size_t i = 0; i < nrTerms; ++i) v += std::ldexp(mantissa(engine), exponent(engine));
+	return v;
+}
+
+// products of integers against adaptive precision integer products
+int VerifyIntegerProducts(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(11);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		long long x = static_cast<long long>(engine()) >> (engine() % 40);
+		long long y = static_cast<long long>(engine()) >> (engine() % 40);
+		adaptivefloat a(x), b(y), c(x), d(y);
+		adaptivefloat p = a * b * c * d;
+		adaptiveint ia(x), ib(y);
+		adaptiveint ip = ia * ib * ia * ib;
+		if (p.str() != to_string(ip)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: (" << x << " * " << y << ")^2 = " << p.str() << " reference " << ip << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// distributivity and commutativity hold exactly for exact products
+int VerifyExactProducts(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(13);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		adaptivefloat a = RandomExpansion(engine, 1 + i % 4), b = RandomExpansion(engine, 1 + i % 3), c = RandomExpansion(engine, 2);
+		adaptivefloat lhs = a * (b + c), rhs = a * b + a * c;
+		if (lhs != rhs || a * b != b * a || (a * b) * c != a * (b * c)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: a * (b + c) = " << lhs.str(40) << " a * b + a * c = " << rhs.str(40) << '\n';
+		}
+	}
+	// the product of two doubles is the pair of two_prod
+	double x = 1.0 + std::ldexp(1.0, -52), y = 1.0 - std::ldexp(1.0, -53);
+	adaptivefloat p = adaptivefloat(x) * adaptivefloat(y);
+	double lo;
+	double hi = two_prod(x, y, lo);
+	if (p.components() != 2 || p.component(0) != lo || p.component(1) != hi) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: two_prod " << p.str() << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// quotients are developed to divisionComponents doubles: q * b reproduces a to that precision
+int VerifyDivision(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(17);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		adaptivefloat a = RandomExpansion(engine, 1 + i % 4), b = RandomExpansion(engine, 1 + i % 3);
+		if (b.iszero()) continue;
+		adaptivefloat q = a / b;
+		adaptivefloat residual = q * b - a;
+		// the relative residual must be below 2^-(53 * divisionComponents - 8)
+		int bound = int(53 * adaptivefloat::divisionComponents) - 8;
+		if (!residual.iszero() && residual.scale() - a.scale() > -bound) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a.str(20) << " / " << b.str(20) << " residual scale " << residual.scale() - a.scale() << '\n';
+		}
+	}
+	// dyadic quotients are exact
+	adaptivefloat one(1), three(3), six(6), half = three / six;
+	if (half != adaptivefloat(0.5) || half.components() != 1) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 3 / 6 = " << half.str() << '\n';
+	}
+	// a third carries 53 * divisionComponents significant bits
+	adaptivefloat third = one / three;
+	if (third.str(60) != "0.333333333333333333333333333333333333333333333333333333333333") {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1 / 3 = " << third.str(60) << '\n';
+	}
+	try {
+		adaptivefloat q = one / adaptivefloat(0);
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: division by zero returned " << q << '\n';
+	}
+	catch (const adaptivefloat_divide_by_zero&) {
+		// the expected outcome
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	adaptivefloat a(2), b(3);
+	cout << setprecision(50) << a / b << endl;
+
+#else
+
+	cout << "adaptive precision linear float multiplication and division validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyIntegerProducts(bReportIndividualTestCases, 1000), "adaptivefloat", "integer products");
+	nrOfFailedTestCases += ReportTestResult(VerifyExactProducts(bReportIndividualTestCases, 1000), "adaptivefloat", "exact products");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivision(bReportIndividualTestCases, 1000), "adaptivefloat", "division");
+
+#if STRESS_TESTING
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -8,9 +8,11 @@
 #include <string>
 #include <cmath>
 #include <limits>
+#include <random>
 
 // minimum set of include files to reflect source code dependencies
 #include <universal/number/adaptiveint/adaptiveint.hpp>
+#include <universal/number/integer/integer.hpp>
 #include <universal/verification/test_status.hpp> // ReportTestResult
 
 // generate specific test case that you can trace with the trace conditions in mpreal.hpp
@@ -30,7 +32,86 @@ void GenerateTestCase(Ty _a, Ty _b) {
 	std::cout << (aref == asum ? "PASS" : "FAIL") << std::endl << std::endl;
 }
 
-#define MANUAL_TESTING 1
+// sums and differences of values that fit in 62 bits against native arithmetic
+int VerifyNativeAddition(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(1);
+	std::uniform_int_distribution<long long> dist(-(1ll << 62), (1ll << 62));
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		long long a = dist(engine) >> (i % 63), b = dist(engine) >> ((i * 7) % 63);
+		adaptiveint sum = adaptiveint(a) + adaptiveint(b);
+		adaptiveint difference = adaptiveint(a) - adaptiveint(b);
+		if (sum.to_long_long() != a + b || difference.to_long_long() != a - b || !sum.isinline()) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " +/- " << b << " = " << sum << ", " << difference << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// multi-limb sums and differences against integer<nbits> through the decimal representation
+template<size_t nbits>
+int VerifyAdditionAgainstInteger(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Integer = integer<nbits, uint32_t>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		// operands of up to nbits - 2 bits, with runs of ones and zeros to exercise carries and borrows
+		Integer ia(0), ib(0);
+		std::vector<uint32_t> la, lb;
+		size_t na = 1 + engine() % ((nbits - 2) / 32), nb = 1 + engine() % ((nbits - 2) / 32);
+		for (size_t k = 0; k < na; ++k) la.push_back(engine() % 4 == 0 ? 0xFFFF'FFFFu : uint32_t(engine()));
+		for (size_t k = 0; k < nb; ++k) lb.push_back(engine() % 4 == 0 ? 0u : uint32_t(engine()));
+		for (size_t k = na; k-- > 0;) { ia <<= 32; ia += Integer(la[k]); }
+		for (size_t k = nb; k-- > 0;) { ib <<= 32; ib += Integer(lb[k]); }
+		bool sa = (engine() & 1), sb = (engine() & 1);
+		if (sa) ia = -ia;
+		if (sb) ib = -ib;
+		adaptiveint a, b;
+		a.setlimbs(la, sa);
+		b.setlimbs(lb, sb);
+		std::string sum = to_string(a + b), difference = to_string(a - b);
+		if (sum != to_string(ia + ib) || difference != to_string(ia - ib)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " +/- " << b << " = " << sum << ", " << difference << " reference " << (ia + ib) << ", " << (ia - ib) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// carry propagation across limbs and the transitions between inline and heap storage
+int VerifyCarryPropagation(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	adaptiveint allOnes, one(1);
+	allOnes.setlimbs(std::vector<uint32_t>(8, 0xFFFF'FFFFu));
+	adaptiveint power = allOnes + one;  // 2^256
+	if (power != (one << 256) || power.limbs() != 9 || power - one != allOnes) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: carry propagation " << power << '\n';
+	}
+	adaptiveint small = power - allOnes;
+	if (small != one || !small.isinline()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: heap to inline transition " << small << '\n';
+	}
+	adaptiveint negative = one - power;
+	if (!negative.isneg() || negative + power != one || negative + allOnes != adaptiveint(0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: negative difference " << negative << '\n';
+	}
+	adaptiveint x(std::numeric_limits<long long>::min());
+	adaptiveint y = x + x;
+	if (y != -(one << 64) || !y.isneg() || y.isinline()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: INT64_MIN doubled " << y << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -50,11 +131,15 @@ try {
 
 #else
 
-	cout << "adaptive precision linear float addition validation" << endl;
+	cout << "adaptive precision binary integer addition validation" << endl;
 
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeAddition(bReportIndividualTestCases, 10000), "adaptiveint", "native addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyAdditionAgainstInteger<256>(bReportIndividualTestCases, 1000), "adaptiveint", "integer<256> addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyCarryPropagation(bReportIndividualTestCases), "adaptiveint", "carry propagation");
 
 #if STRESS_TESTING
-
+	nrOfFailedTestCases += ReportTestResult(VerifyAdditionAgainstInteger<1024>(bReportIndividualTestCases, 10000), "adaptiveint", "integer<1024> addition");
 #endif  // STRESS_TESTING
 
 #endif  // MANUAL_TESTING
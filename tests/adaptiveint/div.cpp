@@ -0,0 +1,156 @@
+// div.cpp: test suite runner for division and remainder on adaptive precision binary integer
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+
+// configure the adaptiveint arithmetic class
+#define ADAPTIVEINT_THROW_ARITHMETIC_EXCEPTION 1
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/adaptiveint/adaptiveint.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+sw::universal::adaptiveint RandomAdaptiveint(std::mt19937_64& engine, size_t nrLimbs) {
+	std::vector<uint32_t> limbs(nrLimbs);
+	for (uint32_t& l : limbs) {
+		// saturated and sparse limbs exercise the add-back step of Knuth's algorithm D
+		switch (engine() % 8) {
+		case 0: l = 0xFFFF'FFFFu; break;
+		case 1: l = 0; break;
+		case 2: l = 0x8000'0000u; break;
+		default: l = uint32_t(engine()); break;
+		}
+	}
+	if (limbs.back() == 0) limbs.back() = 1;
+	sw::universal::adaptiveint v;
+	v.setlimbs(limbs, engine() & 1);
+	return v;
+}
+
+// truncating division against the native 64-bit integer
+int VerifyNativeDivision(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(17);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		long long x = static_cast<long long>(engine()) >> (engine() % 63);
+		long long y = static_cast<long long>(engine()) >> (engine() % 63);
+		if (y == 0 || (x == INT64_MIN && y == -1)) continue;
+		adaptiveint a(x), b(y), q, r;
+		divide(a, b, q, r);
+		if (q.to_long_long() != x / y || r.to_long_long() != x % y || (a / b) != q || (a % b) != r) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << x << " / " << y << " = " << q << " rem " << r << " reference " << x / y << " rem " << x % y << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// a = q * b + r with |r| < |b| and r carrying the sign of a
+int VerifyDivisionIdentity(bool reportTestCases, size_t maxLimbs, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(maxLimbs);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		size_t na = 1 + engine() % maxLimbs;
+		size_t nb = 1 + engine() % na;
+		adaptiveint a = RandomAdaptiveint(engine, na), b = RandomAdaptiveint(engine, nb);
+		adaptiveint q, r;
+		divide(a, b, q, r);
+		bool pass = (q * b + r == a) && (abs(r) < abs(b)) && (r.iszero() || r.sign() == a.sign());
+		if (!pass) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " / " << b << " = " << q << " rem " << r << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// divisors that push the quotient digit estimate of algorithm D to its correction steps
+int VerifyEdgeDivisors(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	const char* cases[][2] = {
+		{ "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", "0xFFFFFFFFFFFFFFFF" },
+		{ "0x800000000000000000000000", "0x800000000000000000000001" },
+		{ "0x7FFFFFFF800000000000000000000000", "0x800000000000000000000001" },
+		{ "0x80000000000000000000000000000000", "0x800000000000000F" },
+		{ "0x100000000000000000000000000000000", "0xFFFFFFFF00000001" },
+		{ "0xFFFFFFFF00000000FFFFFFFF00000000", "0xFFFFFFFF" },
+		{ "0x1000000000000000000000000", "0x100000000" },
+		{ "0x1234567890ABCDEF", "0x1234567890ABCDEF0" },
+	};
+	for (auto& c : cases) {
+		adaptiveint a(c[0]), b(c[1]), q, r;
+		divide(a, b, q, r);
+		if (!(q * b + r == a) || !(r < b)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << c[0] << " / " << c[1] << " = " << q << " rem " << r << '\n';
+		}
+	}
+	adaptiveint googol("10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+	adaptiveint tenToTheFifty("100000000000000000000000000000000000000000000000000");
+	if (googol / tenToTheFifty != tenToTheFifty || !(googol % tenToTheFifty).iszero()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 10^100 / 10^50 = " << googol / tenToTheFifty << '\n';
+	}
+	try {
+		adaptiveint q = googol / adaptiveint(0);
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: division by zero returned " << q << '\n';
+	}
+	catch (const adaptiveint_divide_by_zero&) {
+		// the expected outcome
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	adaptiveint a("-123456789012345678901234567890"), b("987654321");
+	cout << a << " / " << b << " = " << a / b << " rem " << a % b << endl;
+
+#else
+
+	cout << "adaptive precision binary integer division validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeDivision(bReportIndividualTestCases, 10000), "adaptiveint", "native division");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivisionIdentity(bReportIndividualTestCases, 8, 5000), "adaptiveint", "a = q * b + r");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivisionIdentity(bReportIndividualTestCases, 100, 500), "adaptiveint", "a = q * b + r");
+	nrOfFailedTestCases += ReportTestResult(VerifyEdgeDivisors(bReportIndividualTestCases), "adaptiveint", "edge divisors");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyDivisionIdentity(bReportIndividualTestCases, 1000, 500), "adaptiveint", "a = q * b + r");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
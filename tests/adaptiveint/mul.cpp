@@ -0,0 +1,145 @@
+// mul.cpp: test suite runner for multiplication on adaptive precision binary integer
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <random>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/adaptiveint/adaptiveint.hpp>
+#include <universal/number/integer/integer.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+sw::universal::adaptiveint RandomAdaptiveint(std::mt19937_64& engine, size_t nrLimbs) {
+	std::vector<uint32_t> limbs(nrLimbs);
+	for (uint32_t& l : limbs) {
+		// saturated limbs maximize the carries in the intermediate sums
+		l = (engine() % 8 == 0 ? 0xFFFF'FFFFu : uint32_t(engine()));
+	}
+	sw::universal::adaptiveint v;
+	v.setlimbs(limbs, engine() & 1);
+	return v;
+}
+
+// Karatsuba and Toom-3 against the schoolbook algorithm, for balanced and unbalanced operands
+int VerifyFastMultiplication(bool reportTestCases, size_t karatsubaThreshold, size_t toom3Threshold, size_t maxLimbs, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(karatsubaThreshold * 1000 + toom3Threshold);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		size_t na = 1 + engine() % maxLimbs;
+		size_t nb = (i % 3 == 0 ? na : 1 + engine() % maxLimbs);
+		adaptiveint a = RandomAdaptiveint(engine, na), b = RandomAdaptiveint(engine, nb);
+		adaptiveint::karatsubaThreshold = std::numeric_limits<size_t>::max();
+		adaptiveint reference = a * b;
+		adaptiveint::karatsubaThreshold = karatsubaThreshold;
+		adaptiveint::toom3Threshold = toom3Threshold;
+		adaptiveint product = a * b;
+		if (product != reference) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << na << " x " << nb << " limbs: " << product << " != " << reference << '\n';
+		}
+	}
+	adaptiveint::karatsubaThreshold = ADAPTIVEINT_KARATSUBA_THRESHOLD;
+	adaptiveint::toom3Threshold = ADAPTIVEINT_TOOM3_THRESHOLD;
+	return nrOfFailedTests;
+}
+
+// products against integer<nbits> through the decimal representation
+template<size_t nbits>
+int VerifyMultiplicationAgainstInteger(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Integer = integer<nbits, uint32_t>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		// the product must fit in nbits - 1 bits
+		long long x = static_cast<long long>(engine() >> 2), y = static_cast<long long>(engine() >> (2 + i % 40));
+		if (i & 1) x = -x;
+		if (i & 2) y = -y;
+		Integer ia(x), ib(y);
+		ia *= ib;
+		adaptiveint a(x), b(y);
+		adaptiveint product = a * b;
+		adaptiveint square = product * product;
+		Integer isquare = ia * ia;
+		if (to_string(product) != to_string(ia) || to_string(square) != to_string(isquare)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << x << " * " << y << " = " << product << " reference " << ia << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// algebraic identities on large operands
+int VerifyIdentities(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(7);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		adaptiveint a = RandomAdaptiveint(engine, 50 + engine() % 300);
+		adaptiveint b = RandomAdaptiveint(engine, 50 + engine() % 300);
+		// (a + b)^2 = a^2 + 2ab + b^2 and (a + b)(a - b) = a^2 - b^2
+		adaptiveint lhs = (a + b) * (a + b);
+		adaptiveint rhs = a * a + (a * b << 1) + b * b;
+		adaptiveint lhs2 = (a + b) * (a - b);
+		adaptiveint rhs2 = a * a - b * b;
+		if (lhs != rhs || lhs2 != rhs2) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: identities for " << a.limbs() << " x " << b.limbs() << " limbs\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	adaptiveint a("123456789012345678901234567890"), b("-987654321098765432109876543210");
+	cout << a << " * " << b << " = " << a * b << endl;
+
+#else
+
+	cout << "adaptive precision binary integer multiplication validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiplicationAgainstInteger<256>(bReportIndividualTestCases, 1000), "adaptiveint", "integer<256> multiplication");
+	// low thresholds drive the recursions deep on small operands
+	nrOfFailedTestCases += ReportTestResult(VerifyFastMultiplication(bReportIndividualTestCases, 2, 1000, 64, 500), "adaptiveint", "karatsuba");
+	nrOfFailedTestCases += ReportTestResult(VerifyFastMultiplication(bReportIndividualTestCases, 2, 3, 64, 500), "adaptiveint", "toom-3");
+	nrOfFailedTestCases += ReportTestResult(VerifyFastMultiplication(bReportIndividualTestCases, 4, 9, 300, 200), "adaptiveint", "karatsuba/toom-3");
+	nrOfFailedTestCases += ReportTestResult(VerifyIdentities(bReportIndividualTestCases, 50), "adaptiveint", "identities");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyFastMultiplication(bReportIndividualTestCases, 8, 24, 2000, 100), "adaptiveint", "karatsuba/toom-3");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
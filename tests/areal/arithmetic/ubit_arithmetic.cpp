@@ -0,0 +1,257 @@
+// ubit_arithmetic.cpp: exhaustive tests of areal arithmetic and the propagation of the uncertainty bit
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <universal/number/areal/areal.hpp>
+#include <universal/verification/test_status.hpp>
+
+/*
+   An areal encoding with the uncertainty bit set represents the open interval between the value
+   of the encoding and the next encoding away from zero. The arithmetic operators compute the
+   operation on the values of the encodings and truncate the result toward zero: the result is
+   the largest exact areal magnitude that does not exceed the magnitude of the exact result,
+   and the uncertainty bit is set when the truncation is inexact or when an operand is uncertain.
+   Magnitudes beyond maxpos map to (maxpos, inf), magnitudes below minpos to (0, minpos).
+
+   The reference enumerates the exact positive magnitudes of the encoding, which are exact in double
+   for the small configurations tested here, as are the sums, products, and the products of a
+   candidate quotient and the divisor.
+ */
+
+// exact positive magnitudes indexed by the encoding without sign and uncertainty bit
+template<size_t nbits, size_t es>
+std::vector<double> ExactMagnitudes() {
+	using Areal = sw::universal::areal<nbits, es, uint8_t>;
+	constexpr size_t fbits = Areal::fbits;
+	std::vector<double> v;
+	size_t nrEncodings = (size_t(1) << (nbits - 2)) - 1;  // the all ones encoding is inf or nan
+	for (size_t k = 0; k < nrEncodings; ++k) {
+		size_t e = k >> fbits;
+		size_t f = k & ((size_t(1) << fbits) - 1);
+		if (e == 0) {
+			v.push_back(std::ldexp(double(f), Areal::MIN_EXP_NORMAL - int(fbits)));
+		}
+		else {
+			v.push_back(std::ldexp(double((size_t(1) << fbits) + f), int(e) - Areal::EXP_BIAS - int(fbits)));
+		}
+	}
+	return v;
+}
+
+// index of the largest exact magnitude that does not exceed x, and whether it equals x
+inline size_t Truncate(const std::vector<double>& magnitudes, double x, bool& exact) {
+	auto it = std::upper_bound(magnitudes.begin(), magnitudes.end(), x);
+	size_t k = size_t(it - magnitudes.begin()) - 1;
+	exact = (magnitudes[k] == x);
+	return k;
+}
+
+// the largest magnitude c with c * divisor <= dividend
+inline size_t TruncateQuotient(const std::vector<double>& magnitudes, double dividend, double divisor, bool& exact) {
+	size_t lo = 0, hi = magnitudes.size();
+	while (hi - lo > 1) {
+		size_t mid = (lo + hi) / 2;
+		if (magnitudes[mid] * divisor <= dividend) lo = mid; else hi = mid;
+	}
+	exact = (magnitudes[lo] * divisor == dividend);
+	return lo;
+}
+
+template<size_t nbits, size_t es>
+int VerifyUbitArithmetic(int op, bool reportTestCases) {
+	using namespace sw::universal;
+	using Areal = areal<nbits, es, uint8_t>;
+	constexpr uint64_t NR_ENCODINGS = (uint64_t(1) << nbits);
+	constexpr uint64_t SIGN_BIT = (uint64_t(1) << (nbits - 1));
+	const char* opname[] = { " + ", " - ", " * ", " / " };
+	std::vector<double> magnitudes = ExactMagnitudes<nbits, es>();
+	const size_t maxposIndex = magnitudes.size() - 1;
+
+	int nrOfFailedTests = 0;
+	Areal a, b, c;
+	for (uint64_t i = 0; i < NR_ENCODINGS; ++i) {
+		a.setbits(i);
+		if (a.isnan() || a.isinf()) continue;
+		bool asign = (i & SIGN_BIT) != 0;
+		double av = magnitudes[(i & ~SIGN_BIT) >> 1];
+		for (uint64_t j = 0; j < NR_ENCODINGS; ++j) {
+			b.setbits(j);
+			if (b.isnan() || b.isinf()) continue;
+			bool bsign = (j & SIGN_BIT) != 0;
+			double bv = magnitudes[(j & ~SIGN_BIT) >> 1];
+			bool ubit = (i & 1) || (j & 1);
+			double x{ 0.0 };
+			bool exact{ true };
+			size_t k{ 0 };
+			switch (op) {
+			case 0:
+			case 1:
+				x = (asign ? -av : av) + ((bsign != (op == 1)) ? -bv : bv);
+				if (av == 0.0 && bv == 0.0) x = ((asign && (bsign != (op == 1))) ? -0.0 : 0.0);
+				k = Truncate(magnitudes, std::fabs(x), exact);
+				break;
+			case 2:
+				x = (asign != bsign ? -1.0 : 1.0) * av * bv;
+				k = Truncate(magnitudes, std::fabs(x), exact);
+				// an exact zero factor makes the product exact
+				if ((av == 0.0 && !(i & 1)) || (bv == 0.0 && !(j & 1))) ubit = false;
+				break;
+			default:
+				if (bv == 0.0) continue;  // division by zero is covered by the special cases
+				x = (asign != bsign ? -1.0 : 1.0) * av / bv;
+				k = TruncateQuotient(magnitudes, av, bv, exact);
+				if (av == 0.0) ubit = (i & 1);  // only the uncertainty of the dividend matters
+				break;
+			}
+			if (k > maxposIndex) k = maxposIndex;
+			uint64_t expected = (uint64_t(k) << 1) | ((!exact || ubit) ? 1 : 0);
+			if (std::signbit(x)) expected |= SIGN_BIT;
+
+			switch (op) {
+			case 0: c = a + b; break;
+			case 1: c = a - b; break;
+			case 2: c = a * b; break;
+			default: c = a / b; break;
+			}
+			Areal ref;
+			ref.setbits(expected);
+			// exact cancellation yields +0
+			bool cancellation = (op < 2 && x == 0.0 && exact && !ubit);
+			bool pass = cancellation ? (c.iszero()) : (c == ref);
+			if (!pass) {
+				++nrOfFailedTests;
+				if (reportTestCases && nrOfFailedTests < 25) {
+					std::cerr << "FAIL: " << to_binary(a) << opname[op] << to_binary(b) << " = " << to_binary(c) << " : " << c
+						<< " reference " << to_binary(ref) << " : " << ref << '\n';
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// special values: nan and inf propagation, division by zero, and areals wider than 64 bits
+template<size_t nbits, size_t es>
+int VerifySpecialCases(bool reportTestCases) {
+	using namespace sw::universal;
+	using Areal = areal<nbits, es, uint8_t>;
+	int nrOfFailedTests = 0;
+	Areal inf, ninf, nan, one, zero;
+	inf.setinf(false);
+	ninf.setinf(true);
+	nan.setnan(NAN_TYPE_QUIET);
+	one.setbits(uint64_t(Areal::EXP_BIAS) << (Areal::fbits + 1));
+	zero.setzero();
+	auto check = [&](bool pass, const char* name, const Areal& v) {
+		if (!pass) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << name << " : " << to_binary(v) << " : " << v << '\n';
+		}
+	};
+	check((inf + ninf).isnan(), "inf + -inf", inf + ninf);
+	check((inf + one).isinf(INF_TYPE_POSITIVE), "inf + 1", inf + one);
+	check((inf - inf).isnan(), "inf - inf", inf - inf);
+	check((inf * zero).isnan(), "inf * 0", inf * zero);
+	check((ninf * one).isinf(INF_TYPE_NEGATIVE), "-inf * 1", ninf * one);
+	check((inf / inf).isnan(), "inf / inf", inf / inf);
+	check((one / inf).iszero(), "1 / inf", one / inf);
+	check((nan + one).isnan(), "nan + 1", nan + one);
+	check((one * nan).isnan(), "1 * nan", one * nan);
+#if !AREAL_THROW_ARITHMETIC_EXCEPTION
+	check((one / zero).isinf(INF_TYPE_POSITIVE), "1 / 0", one / zero);
+	check((zero / zero).isnan(), "0 / 0", zero / zero);
+#endif
+	return nrOfFailedTests;
+}
+
+// an areal wider than 64 bits takes the bitwise path through the conversion from blocktriple
+int VerifyWideAreal(bool reportTestCases) {
+	using namespace sw::universal;
+	using Areal = areal<80, 11, uint32_t>;
+	int nrOfFailedTests = 0;
+	// 1.5 and 3.0: biased exponent 1023 and 1024, fraction msb set
+	Areal a, b, c;
+	a.set(Areal::fbits);
+	for (size_t i = 0; i < 10; ++i) a.set(Areal::fbits + 1 + i);    // biased exponent 1023
+	b.set(Areal::fbits);
+	b.set(Areal::fbits + 11);                                        // biased exponent 1024
+	c = a * b;  // 4.5 = 1.125 * 2^2
+	if (c.at(0) || c.scale() != 2 || !c.at(Areal::fbits - 2) || c.at(Areal::fbits)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1.5 * 3.0 = " << to_binary(c) << '\n';
+	}
+	c = a / b;  // 0.5 exact
+	if (c.at(0) || c.scale() != -1 || c.at(Areal::fbits)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1.5 / 3.0 = " << to_binary(c) << '\n';
+	}
+	c = b / a;
+	c = a / c;  // 1.5 / 2 = 0.75 exact
+	if (c.at(0) || c.scale() != -1 || !c.at(Areal::fbits)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1.5 / (3.0 / 1.5) = " << to_binary(c) << '\n';
+	}
+	c = a + b - a;  // 3.0 exact
+	if (c.at(0) || c.scale() != 1 || !c.at(Areal::fbits)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1.5 + 3.0 - 1.5 = " << to_binary(c) << '\n';
+	}
+	Areal one;
+	for (size_t i = 0; i < 10; ++i) one.set(Areal::fbits + 1 + i);  // biased exponent 1023
+	Areal third = one / b;  // inexact
+	if (!third.at(0) || third.scale() != -2) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1 / 3 = " << to_binary(third) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "areal arithmetic with uncertainty bit propagation";
+	std::string test_tag = "ubit arithmetic";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	const char* opname[] = { "addition", "subtraction", "multiplication", "division" };
+	for (int op = 0; op < 4; ++op) {
+		nrOfFailedTestCases += ReportTestResult(VerifyUbitArithmetic<8, 2>(op, reportTestCases), "areal<8,2>", opname[op]);
+		nrOfFailedTestCases += ReportTestResult(VerifyUbitArithmetic<8, 3>(op, reportTestCases), "areal<8,3>", opname[op]);
+		nrOfFailedTestCases += ReportTestResult(VerifyUbitArithmetic<8, 4>(op, reportTestCases), "areal<8,4>", opname[op]);
+		nrOfFailedTestCases += ReportTestResult(VerifyUbitArithmetic<9, 3>(op, reportTestCases), "areal<9,3>", opname[op]);
+		nrOfFailedTestCases += ReportTestResult(VerifyUbitArithmetic<10, 3>(op, reportTestCases), "areal<10,3>", opname[op]);
+	}
+
+	nrOfFailedTestCases += ReportTestResult(VerifySpecialCases<8, 2>(reportTestCases), "areal<8,2>", "special cases");
+	nrOfFailedTestCases += ReportTestResult(VerifySpecialCases<16, 5>(reportTestCases), "areal<16,5>", "special cases");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideAreal(reportTestCases), "areal<80,11>", "wide areal");
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::areal_arithmetic_exception& err) {
+	std::cerr << "Uncaught areal arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
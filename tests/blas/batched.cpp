@@ -0,0 +1,246 @@
+// batched.cpp: test suite for fixed-size small matrices and the batched LU/solve/inverse kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+// configure posit environment using fast posits
+#define POSIT_FAST_POSIT_32_2 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/small_matrix.hpp>
+#include <universal/blas/batched.hpp>
+#include <universal/verification/test_status.hpp>
+
+// generate a diagonally dominant instance so that all the systems are well-conditioned
+template<typename Scalar, size_t N>
+sw::universal::blas::small_matrix<Scalar, N, N> GenerateInstance(std::mt19937_64& engine) {
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	sw::universal::blas::small_matrix<Scalar, N, N> A;
+	for (size_t i = 0; i < N; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			A(i, j) = Scalar(dist(engine));
+		}
+		A(i, (i + 1) % N) += Scalar(double(N)); // off-diagonal dominance forces pivoting
+	}
+	return A;
+}
+
+// the residual of A x = b must be small relative to the precision of the Scalar
+template<typename Scalar, size_t N>
+double Residual(const sw::universal::blas::small_matrix<Scalar, N, N>& A, const sw::universal::blas::small_vector<Scalar, N>& x, const sw::universal::blas::small_vector<Scalar, N>& b) {
+	double maxResidual = 0.0;
+	for (size_t i = 0; i < N; ++i) {
+		double r = double(b[i]);
+		for (size_t j = 0; j < N; ++j) r -= double(A(i, j)) * double(x[j]);
+		maxResidual = std::max(maxResidual, std::abs(r));
+	}
+	return maxResidual;
+}
+
+template<typename Scalar, size_t N>
+int VerifySmallMatrixSolve(bool reportTestCases, double tolerance) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(N);
+	for (int t = 0; t < 10; ++t) {
+		small_matrix<Scalar, N, N> A = GenerateInstance<Scalar, N>(engine);
+		small_vector<Scalar, N> b;
+		for (size_t i = 0; i < N; ++i) b[i] = Scalar(double(i) + 1.0);
+		small_vector<Scalar, N> x;
+		if (solve(A, b, x) != 0) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: small_matrix solve reported a singular matrix\n";
+		}
+		double r = Residual(A, x, b);
+		if (r > tolerance) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: small_matrix solve residual " << r << '\n';
+		}
+		// A * inv(A) must be close to the identity
+		small_matrix<Scalar, N, N> Ainv;
+		inv(A, Ainv);
+		small_matrix<Scalar, N, N> I = A * Ainv;
+		for (size_t i = 0; i < N; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				double e = double(I(i, j)) - (i == j ? 1.0 : 0.0);
+				if (std::abs(e) > tolerance) {
+					++nrOfFailedTests;
+					if (reportTestCases) std::cerr << "FAIL: A * inv(A) (" << i << ',' << j << ") = " << I(i, j) << '\n';
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the batched kernels must produce bit-identical results to the per-instance small_matrix solvers
+template<typename Scalar, size_t N>
+int VerifyBatchedSolve(bool reportTestCases, size_t batchSize, size_t nrThreads) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(batchSize);
+	batched_matrix<Scalar, N, N> A(batchSize), Ainv;
+	batched_vector<Scalar, N> B(batchSize);
+	std::vector< small_matrix<Scalar, N, N> > reference(batchSize);
+	for (size_t b = 0; b < batchSize; ++b) {
+		reference[b] = GenerateInstance<Scalar, N>(engine);
+		A.store(b, reference[b]);
+		for (size_t i = 0; i < N; ++i) B(b, i, 0) = Scalar(double(b % 7) - double(i));
+	}
+	batched_matrix<Scalar, N, N> A2(A);
+	batched_vector<Scalar, N> X(B);
+	batched_matrix<int, 1, 1> info;
+	size_t nrOfSingularInstances = batched_solve(A, X, info, nrThreads);
+	if (nrOfSingularInstances != 0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: batched_solve reported " << nrOfSingularInstances << " singular instances\n";
+	}
+	batched_inv(A2, Ainv, info, nrThreads);
+	for (size_t b = 0; b < batchSize; ++b) {
+		small_vector<Scalar, N> x;
+		for (size_t i = 0; i < N; ++i) x[i] = B(b, i, 0);
+		small_matrix<Scalar, N, N> LU(reference[b]);
+		small_vector<size_t, N> piv;
+		ludcmp(LU, piv);
+		lubksb(LU, piv, x);
+		for (size_t i = 0; i < N; ++i) {
+			if (x[i] != X(b, i, 0)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: instance " << b << " x[" << i << "] = " << X(b, i, 0) << " reference " << x[i] << '\n';
+			}
+		}
+		small_matrix<Scalar, N, N> ref;
+		inv(reference[b], ref);
+		if (ref != Ainv.load(b)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: instance " << b << " inverse differs from small_matrix inv()\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// singular instances are factored as ludcmp() does, and reported per instance by the solvers
+template<typename Scalar>
+int VerifySingularDetection(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	constexpr size_t batchSize = 5;
+	batched_matrix<Scalar, 3, 3> A(batchSize);
+	batched_matrix<size_t, 3, 1> piv;
+	batched_matrix<int, 1, 1> info;
+	batched_vector<Scalar, 3> X(batchSize);
+	std::vector< small_matrix<Scalar, 3, 3> > reference(batchSize);
+	for (size_t b = 0; b < batchSize; ++b) {
+		small_matrix<Scalar, 3, 3> I;
+		I = Scalar(1);
+		if (b == 2) I(1, 1) = Scalar(0);  // rank deficient instance
+		if (b == 4) {
+			// a zero first column: skipping the elimination keeps the infinity out of the trailing rows
+			I(0, 0) = Scalar(0);
+			I(0, 1) = Scalar(std::numeric_limits<double>::infinity());
+		}
+		reference[b] = I;
+		A.store(b, I);
+		for (size_t i = 0; i < 3; ++i) X(b, i, 0) = Scalar(1);
+	}
+	batched_matrix<Scalar, 3, 3> LU(A);
+	size_t nrOfSingularInstances = batched_ludcmp(LU, piv, info);
+	if (nrOfSingularInstances != 2 || info(2, 0, 0) != 2 || info(4, 0, 0) != 1) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: singular instance not detected\n";
+	}
+	for (size_t b = 0; b < batchSize; ++b) {
+		small_matrix<Scalar, 3, 3> ref(reference[b]);
+		small_vector<size_t, 3> p;
+		int status = ludcmp(ref, p);
+		bool identical = (status == info(b, 0, 0));
+		for (size_t i = 0; i < 3; ++i) {
+			if (p[i] != piv(b, i, 0)) identical = false;
+			for (size_t j = 0; j < 3; ++j) {
+				// compare the encodings: NaN entries would compare unequal to themselves
+				if (!(ref(i, j) == LU(b, i, j)) && !(std::isnan(double(ref(i, j))) && std::isnan(double(LU(b, i, j))))) identical = false;
+			}
+		}
+		if (!identical) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: instance " << b << " LU factors differ from small_matrix ludcmp()\n";
+		}
+	}
+
+	// the solvers report the status per instance and zero the solutions of the singular instances
+	nrOfSingularInstances = batched_solve(A, X, info);
+	for (size_t b = 0; b < batchSize; ++b) {
+		int expected = (b == 2 ? 2 : (b == 4 ? 1 : 0));
+		Scalar x = (expected == 0 ? Scalar(1) : Scalar(0));
+		if (info(b, 0, 0) != expected || X(b, 0, 0) != x || X(b, 1, 0) != x || X(b, 2, 0) != x) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: instance " << b << " batched_solve status " << info(b, 0, 0) << " expected " << expected << '\n';
+		}
+	}
+	small_vector<Scalar, 3> b{ Scalar(1), Scalar(1), Scalar(1) }, x;
+	small_matrix<Scalar, 3, 3> Ainv;
+	if (solve(reference[2], b, x) != 2 || x[1] != Scalar(0) || inv(reference[2], Ainv) != 2 || Ainv(0, 0) != Scalar(0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: small_matrix solve/inv did not report the singular matrix\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "batched small matrix solvers";
+	std::string test_tag = "batched";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+#if MANUAL_TESTING
+
+	using Scalar = float;
+	std::mt19937_64 engine(0);
+	auto A = GenerateInstance<Scalar, 4>(engine);
+	blas::small_matrix<Scalar, 4, 4> Ainv;
+	blas::inv(A, Ainv);
+	std::cout << A << '\n' << Ainv << '\n';
+
+	nrOfFailedTestCases = 0; // disregard any test failures in manual testing mode
+
+#else
+
+	nrOfFailedTestCases += ReportTestResult(VerifySmallMatrixSolve<double, 4>(reportTestCases, 1.0e-12), "small_matrix<double,4,4>", "solve/inv");
+	nrOfFailedTestCases += ReportTestResult(VerifySmallMatrixSolve<double, 32>(reportTestCases, 1.0e-10), "small_matrix<double,32,32>", "solve/inv");
+	nrOfFailedTestCases += ReportTestResult(VerifySmallMatrixSolve<float, 8>(reportTestCases, 1.0e-4), "small_matrix<float,8,8>", "solve/inv");
+	nrOfFailedTestCases += ReportTestResult(VerifySmallMatrixSolve<posit<32, 2>, 8>(reportTestCases, 1.0e-5), "small_matrix<posit<32,2>,8,8>", "solve/inv");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchedSolve<double, 4>(reportTestCases, 1000, 1), "batched_matrix<double,4,4>", "single thread");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchedSolve<double, 4>(reportTestCases, 1000, 4), "batched_matrix<double,4,4>", "four threads");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchedSolve<float, 16>(reportTestCases, 129, 3), "batched_matrix<float,16,16>", "partial tiles");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchedSolve<posit<32, 2>, 5>(reportTestCases, 100, 2), "batched_matrix<posit<32,2>,5,5>", "two threads");
+
+	nrOfFailedTestCases += ReportTestResult(VerifySingularDetection<double>(reportTestCases), "batched_matrix<double,3,3>", "singular");
+
+#endif
+
+	std::cout << (nrOfFailedTestCases > 0 ? "FAIL" : "PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,168 @@
+// fused_vector_ops.cpp: test suite for the single-pass axpy/xpby/axpby vector update kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <random>
+#include <cmath>
+// configure posit environment using fast posits
+#define POSIT_FAST_POSIT_16_1 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/verification/test_status.hpp>
+
+// types without a fused multiply-add: the kernels must yield bit-identical results to the
+// temporaries-based operator expressions
+template<typename Scalar>
+int VerifyOperatorForm(bool reportTestCases, const sw::universal::blas::vector<Scalar>& x, const sw::universal::blas::vector<Scalar>& y, const Scalar& a, const Scalar& b) {
+	using namespace sw::universal::blas;
+	using Vector = sw::universal::blas::vector<Scalar>;
+	int nrOfFailedTests = 0;
+
+	Vector ref, fused;
+	ref = y + a * x;
+	fused = y;
+	axpy(a, x, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpy\n";
+	}
+
+	ref = x + b * y;
+	fused = y;
+	xpby(x, b, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: xpby\n";
+	}
+
+	ref = a * x + b * y;
+	fused = y;
+	axpby(a, x, b, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpby\n";
+	}
+
+	ref = y + a * x;
+	Scalar refNorm = norm(y - ref, 1);
+	fused = y;
+	Scalar fusedNorm = axpy_normL1(a, x, fused);
+	if (ref != fused || refNorm != fusedNorm) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpy_normL1 " << fusedNorm << " vs " << refNorm << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// a * b + c rounded once, independent of the fma under test: posits accumulate in a quire
+template<typename Scalar>
+Scalar RoundedMultiplyAdd(const Scalar& a, const Scalar& b, const Scalar& c) {
+	if constexpr (sw::universal::is_posit<Scalar>) {
+		sw::universal::quire<Scalar::nbits, Scalar::es> q(c);
+		q += sw::universal::quire_mul(a, b);
+		Scalar result;
+		sw::universal::convert(q.to_value(), result);
+		return result;
+	}
+	else {
+		return std::fma(a, b, c);
+	}
+}
+
+// types with a fused multiply-add: every multiply-add pair of the kernels rounds once
+template<typename Scalar>
+int VerifySingleRounding(bool reportTestCases, const sw::universal::blas::vector<Scalar>& x, const sw::universal::blas::vector<Scalar>& y, const Scalar& a, const Scalar& b) {
+	using namespace sw::universal::blas;
+	using Vector = sw::universal::blas::vector<Scalar>;
+	int nrOfFailedTests = 0;
+	size_t N = size(x);
+
+	Vector ref(N), fused;
+	for (size_t i = 0; i < N; ++i) ref[i] = RoundedMultiplyAdd(a, x[i], y[i]);
+	fused = y;
+	axpy(a, x, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpy is not correctly rounded\n";
+	}
+
+	for (size_t i = 0; i < N; ++i) ref[i] = RoundedMultiplyAdd(b, y[i], x[i]);
+	fused = y;
+	xpby(x, b, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: xpby is not correctly rounded\n";
+	}
+
+	// a * x + b * y rounds the second product, and fuses the first one into the sum
+	for (size_t i = 0; i < N; ++i) ref[i] = RoundedMultiplyAdd(a, x[i], Scalar(b * y[i]));
+	fused = y;
+	axpby(a, x, b, fused);
+	if (ref != fused) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpby is not correctly rounded\n";
+	}
+
+	for (size_t i = 0; i < N; ++i) ref[i] = RoundedMultiplyAdd(a, x[i], y[i]);
+	Scalar refNorm = norm(y - ref, 1);
+	fused = y;
+	Scalar fusedNorm = axpy_normL1(a, x, fused);
+	if (ref != fused || refNorm != fusedNorm) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: axpy_normL1 " << fusedNorm << " vs " << refNorm << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+template<typename Scalar>
+int VerifyFusedUpdates(bool reportTestCases, size_t N) {
+	using Vector = sw::universal::blas::vector<Scalar>;
+	std::mt19937_64 engine(N);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	Vector x(N), y(N);
+	for (size_t i = 0; i < N; ++i) {
+		x[i] = Scalar(dist(engine));
+		y[i] = Scalar(dist(engine));
+	}
+	Scalar a = Scalar(dist(engine)), b = Scalar(dist(engine));
+	if constexpr (sw::universal::has_fused_multiply_add<Scalar>::value) {
+		return VerifySingleRounding(reportTestCases, x, y, a, b);
+	}
+	else {
+		return VerifyOperatorForm(reportTestCases, x, y, a, b);
+	}
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "fused vector update kernels";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedUpdates<float>(reportTestCases, 1000), "vector<float>", "fused updates");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedUpdates<double>(reportTestCases, 1000), "vector<double>", "fused updates");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedUpdates< posit<16, 1> >(reportTestCases, 1000), "vector<posit<16,1>>", "fused updates");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedUpdates< posit<24, 1> >(reportTestCases, 100), "vector<posit<24,1>>", "fused updates");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedUpdates< posit<32, 2> >(reportTestCases, 100), "vector<posit<32,2>>", "fused updates");
+
+	std::cout << (nrOfFailedTestCases > 0 ? "FAIL" : "PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
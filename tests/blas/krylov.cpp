@@ -0,0 +1,242 @@
+// krylov.cpp: test suite for the mixed-precision Krylov solvers and their preconditioners
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <tuple>
+#include <vector>
+// configure posit environment using fast posits
+#define POSIT_FAST_POSIT_32_2 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/verification/test_status.hpp>
+
+// nonsymmetric convection-diffusion operator on an m x n grid: the 5-point Laplacian with an upwinded convection term
+template<typename Scalar>
+sw::universal::blas::compressed_matrix<Scalar> ConvectionDiffusion(size_t m, size_t n, double convection) {
+	std::vector< std::tuple<size_t, size_t, Scalar> > triplets;
+	for (size_t i = 0; i < m; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			size_t row = i * n + j;
+			triplets.emplace_back(row, row, Scalar(4.0 + convection));
+			if (j > 0)     triplets.emplace_back(row, row - 1, Scalar(-1.0 - convection));
+			if (j < n - 1) triplets.emplace_back(row, row + 1, Scalar(-1.0));
+			if (i > 0)     triplets.emplace_back(row, row - n, Scalar(-1.0));
+			if (i < m - 1) triplets.emplace_back(row, row + n, Scalar(-1.0));
+		}
+	}
+	return sw::universal::blas::compressed_matrix<Scalar>(m * n, m * n, triplets);
+}
+
+// the sparse matrix agrees with the dense generator, and so do their matrix-vector products
+int VerifyCompressedMatrix(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	matrix<double> D(48, 48);
+	laplace2D(D, 6, 8);
+	compressed_matrix<double> S;
+	laplace2D(S, 6, 8);
+	if (S.nonzeros() != compressed_matrix<double>(D).nonzeros()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: nonzeros " << S.nonzeros() << '\n';
+	}
+	vector<double> x(48), yd(48), ys(48);
+	for (size_t i = 0; i < 48; ++i) x[i] = double(i % 7) - 3.0;
+	yd = D * x;
+	ys = S * x;
+	for (size_t i = 0; i < 48; ++i) {
+		for (size_t j = 0; j < 48; ++j) {
+			if (S(i, j) != D(i, j)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: (" << i << ", " << j << ") " << S(i, j) << " != " << D(i, j) << '\n';
+			}
+		}
+		if (yd[i] != ys[i]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: y[" << i << "] " << ys[i] << " != " << yd[i] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// ILU(0) of a tridiagonal matrix is its exact LU factorization, so the preconditioner solves the system
+int VerifyILU0(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 20;
+	std::vector< std::tuple<size_t, size_t, double> > triplets;
+	for (size_t i = 0; i < N; ++i) {
+		triplets.emplace_back(i, i, 3.0);
+		if (i > 0) triplets.emplace_back(i, i - 1, -1.0);
+		if (i < N - 1) triplets.emplace_back(i, i + 1, -1.5);
+	}
+	compressed_matrix<double> A(N, N, triplets);
+	ilu0_preconditioner<double> M(A);
+	vector<double> x(N), b(N), z(N);
+	for (size_t i = 0; i < N; ++i) x[i] = 1.0 + double(i);
+	b = A * x;
+	M.apply(b, z);
+	for (size_t i = 0; i < N; ++i) {
+		if (std::fabs(z[i] - x[i]) > 1.0e-12 * std::fabs(x[i])) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: z[" << i << "] " << z[i] << " != " << x[i] << '\n';
+		}
+	}
+
+	// a structurally missing diagonal and a numerically zero pivot are reported
+	std::vector< std::tuple<size_t, size_t, double> > singular{ { 0, 1, 1.0 }, { 1, 0, 1.0 }, { 1, 1, 1.0 } };
+	try {
+		ilu0_preconditioner<double> S(compressed_matrix<double>(2, 2, singular));
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: missing diagonal not detected\n";
+	}
+	catch (const zero_pivot&) {}
+	std::vector< std::tuple<size_t, size_t, double> > zero{ { 0, 0, 1.0 }, { 0, 1, 1.0 }, { 1, 0, 1.0 }, { 1, 1, 1.0 } };
+	try {
+		ilu0_preconditioner<double> S(compressed_matrix<double>(2, 2, zero));
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: zero pivot not detected\n";
+	}
+	catch (const zero_pivot&) {}
+	return nrOfFailedTests;
+}
+
+// solve A x = b for the known solution x = 1, and check the true relative residual of the result
+template<typename Precision, typename Scalar, typename Solver, typename Matrix, typename Preconditioner>
+int VerifySolver(bool reportTestCases, const std::string& label, Solver solver, const Matrix& A, const Preconditioner& M, double tolerance, size_t maxIterations = 500) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	size_t N = A.rows();
+	vector<Scalar> x(N), b(N), ones(N), r(N);
+	for (size_t i = 0; i < N; ++i) { ones[i] = Scalar(1.0); x[i] = Scalar(0.0); }
+	mixed_matvec<double>(A, ones, b);
+	krylov_options options;
+	options.tolerance = tolerance;
+	options.maxIterations = maxIterations;
+	options.restart = 20;
+	krylov_report report = solver.template operator()<Precision>(A, M, b, x, options);
+
+	mixed_matvec<double>(A, x, r);
+	double rnorm = 0.0, bnorm = 0.0;
+	for (size_t i = 0; i < N; ++i) {
+		double d = double(b[i]) - double(r[i]);
+		rnorm += d * d;
+		bnorm += double(b[i]) * double(b[i]);
+	}
+	double relativeResidual = std::sqrt(rnorm / bnorm);
+	if (!report.converged || relativeResidual > 10.0 * tolerance
+		|| report.residuals.size() != report.iterations || report.iterationTimes.size() != report.iterations) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: " << label << " converged " << report.converged << " iterations " << report.iterations
+			<< " estimated residual " << report.residual << " true residual " << relativeResidual << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+struct PCG {
+	template<typename Precision, typename... Args> auto operator()(Args&&... args) const { return sw::universal::blas::pcg<Precision>(std::forward<Args>(args)...); }
+};
+struct BiCGSTAB {
+	template<typename Precision, typename... Args> auto operator()(Args&&... args) const { return sw::universal::blas::bicgstab<Precision>(std::forward<Args>(args)...); }
+};
+struct GMRES {
+	template<typename Precision, typename... Args> auto operator()(Args&&... args) const { return sw::universal::blas::gmres<Precision>(std::forward<Args>(args)...); }
+};
+
+// the preconditioners reduce the number of iterations of the Poisson problem
+int VerifyPreconditioning(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	compressed_matrix<double> A;
+	laplace2D(A, 24, 24);
+	vector<double> b(A.rows()), x(A.rows());
+	for (size_t i = 0; i < b.size(); ++i) b[i] = 1.0;
+	krylov_options options;
+	options.tolerance = 1.0e-10;
+	x = 0.0;
+	size_t plain = pcg(A, identity_preconditioner{}, b, x, options).iterations;
+	x = 0.0;
+	size_t ilu = pcg(A, ilu0_preconditioner<double>(A), b, x, options).iterations;
+	if (ilu >= plain) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: ILU(0) iterations " << ilu << " not less than unpreconditioned " << plain << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+	using namespace sw::universal::blas;
+
+	std::string test_suite = "mixed-precision Krylov solvers";
+	std::string test_tag = "krylov";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	using Posit = posit<32, 2>;
+	compressed_matrix<double> Ad;
+	laplace2D(Ad, 16, 16);
+	compressed_matrix<double> Cd = ConvectionDiffusion<double>(16, 16, 0.5);
+	compressed_matrix<Posit> Ap(Ad), Cp(Cd);
+	compressed_matrix<float> Af(Ad);
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<Posit, quire<32, 2>>, Posit>(reportTestCases, "pcg", PCG{}, Ap, identity_preconditioner{}, 1.0e-6), "posit<32,2>", "pcg fdp");
+
+	nrOfFailedTestCases = 0; // disregard any test failures in manual testing mode
+
+#else
+
+	nrOfFailedTestCases += ReportTestResult(VerifyCompressedMatrix(reportTestCases), "compressed_matrix<double>", "laplace2D");
+	nrOfFailedTestCases += ReportTestResult(VerifyILU0(reportTestCases), "compressed_matrix<double>", "ilu0");
+	nrOfFailedTestCases += ReportTestResult(VerifyPreconditioning(reportTestCases), "compressed_matrix<double>", "preconditioning");
+
+	// uniform double precision
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "pcg", PCG{}, Ad, identity_preconditioner{}, 1.0e-10), "double", "pcg");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "pcg jacobi", PCG{}, Ad, jacobi_preconditioner<double>(Ad), 1.0e-10), "double", "pcg jacobi");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "pcg ilu0", PCG{}, Ad, ilu0_preconditioner<double>(Ad), 1.0e-10), "double", "pcg ilu0");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "bicgstab", BiCGSTAB{}, Cd, identity_preconditioner{}, 1.0e-10), "double", "bicgstab");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "bicgstab ilu0", BiCGSTAB{}, Cd, ilu0_preconditioner<double>(Cd), 1.0e-10), "double", "bicgstab ilu0");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "gmres", GMRES{}, Cd, identity_preconditioner{}, 1.0e-10), "double", "gmres(20)");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "gmres jacobi", GMRES{}, Cd, jacobi_preconditioner<double>(Cd), 1.0e-10), "double", "gmres(20) jacobi");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<void, double>(reportTestCases, "gmres ilu0", GMRES{}, Cd, ilu0_preconditioner<double>(Cd), 1.0e-10), "double", "gmres(20) ilu0");
+
+	// mixed precision: float vectors with double dot products
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<float, double>, float>(reportTestCases, "pcg", PCG{}, Af, identity_preconditioner{}, 1.0e-5), "float/double", "pcg");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<double, double, float>, float>(reportTestCases, "gmres", GMRES{}, Cd, ilu0_preconditioner<float>(Cd), 1.0e-5), "float/double", "gmres(20) ilu0");
+
+	// posits with quire accumulation of the dot products, of the matvec, and of both
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<Posit, quire<32, 2>>, Posit>(reportTestCases, "pcg", PCG{}, Ap, identity_preconditioner{}, 1.0e-6), "posit<32,2>", "pcg dot/fdp");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<quire<32, 2>, Posit>, Posit>(reportTestCases, "pcg", PCG{}, Ap, jacobi_preconditioner<Posit>(Ap), 1.0e-6), "posit<32,2>", "pcg fdp/dot jacobi");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<quire<32, 2>>, Posit>(reportTestCases, "bicgstab", BiCGSTAB{}, Cp, ilu0_preconditioner<Posit>(Cp), 1.0e-6), "posit<32,2>", "bicgstab fdp/fdp ilu0");
+	nrOfFailedTestCases += ReportTestResult(VerifySolver<krylov_precision<quire<32, 2>>, Posit>(reportTestCases, "gmres", GMRES{}, Cp, identity_preconditioner{}, 1.0e-6), "posit<32,2>", "gmres(20) fdp/fdp");
+
+#endif
+
+	std::cout << (nrOfFailedTestCases > 0 ? "FAIL" : "PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::blas::blas_exception& err) {
+	std::cerr << "Uncaught blas exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
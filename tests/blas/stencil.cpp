@@ -0,0 +1,229 @@
+// stencil.cpp: test suite for the matrix-free stencil operators and relaxation solvers on structured grids
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <random>
+// small tiles so that the test grids span many tiles, including partial ones
+#define BLAS_STENCIL_TILE_X 16
+#define BLAS_STENCIL_TILE_Y 8
+#define BLAS_STENCIL_TILE_Z 4
+// configure posit environment using fast posits
+#define POSIT_FAST_POSIT_32_2 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/blas/stencil.hpp>
+#include <universal/verification/test_status.hpp>
+
+template<typename Scalar, size_t Dim>
+void RandomGrid(sw::universal::blas::structured_grid<Scalar, Dim>& u, std::mt19937_64& engine) {
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	for (size_t k = 0; k < (Dim == 3 ? u.extent(2) + 2 : 1); ++k) {
+		for (size_t j = 0; j < u.extent(1) + 2; ++j) {
+			for (size_t i = 0; i < u.extent(0) + 2; ++i) u(i, j, k) = Scalar(dist(engine));
+		}
+	}
+}
+
+// the stencil operator equals the matrix of the laplace2D() generator for zero boundary values
+int VerifyApplyAgainstDense(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	constexpr size_t nx = 37, ny = 11;
+	std::mt19937_64 engine(1);
+	grid2D<double> u(nx, ny), y(nx, ny);
+	RandomGrid(u, engine);
+	for (size_t j = 0; j < ny + 2; ++j) { u(0, j) = 0.0; u(nx + 1, j) = 0.0; }
+	for (size_t i = 0; i < nx + 2; ++i) { u(i, 0) = 0.0; u(i, ny + 1) = 0.0; }
+	apply(laplacian<double, 2>(), u, y, 3);
+
+	matrix<double> A;
+	laplace2D(A, ny, nx);
+	vector<double> x(nx * ny);
+	for (size_t j = 0; j < ny; ++j) for (size_t i = 0; i < nx; ++i) x[j * nx + i] = u(i + 1, j + 1);
+	vector<double> b = A * x;
+	for (size_t j = 0; j < ny; ++j) {
+		for (size_t i = 0; i < nx; ++i) {
+			if (std::fabs(b[j * nx + i] - y(i + 1, j + 1)) > 1.0e-14) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: (" << i << ", " << j << ") dense " << b[j * nx + i] << " stencil " << y(i + 1, j + 1) << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the 3D stencil with distinct coefficients matches a direct evaluation
+int VerifyApply3D(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	constexpr size_t nx = 19, ny = 10, nz = 7;
+	std::mt19937_64 engine(2);
+	grid3D<double> u(nx, ny, nz), y(nx, ny, nz);
+	RandomGrid(u, engine);
+	star_stencil<double, 3> A{ 6.5, { -1.0, -1.25, -0.5 }, { -0.75, -1.5, -2.0 } };
+	apply(A, u, y, 2);
+	for (size_t k = 1; k <= nz; ++k) {
+		for (size_t j = 1; j <= ny; ++j) {
+			for (size_t i = 1; i <= nx; ++i) {
+				double ref = 6.5 * u(i, j, k) - u(i - 1, j, k) - 0.75 * u(i + 1, j, k) - 1.25 * u(i, j - 1, k) - 1.5 * u(i, j + 1, k) - 0.5 * u(i, j, k - 1) - 2.0 * u(i, j, k + 1);
+				if (std::fabs(ref - y(i, j, k)) > 1.0e-13) {
+					++nrOfFailedTests;
+					if (reportTestCases) std::cerr << "FAIL: (" << i << ", " << j << ", " << k << ") " << ref << " stencil " << y(i, j, k) << '\n';
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// temporal blocking and the number of threads do not change the Jacobi iterates
+template<typename Scalar, size_t Dim>
+int VerifyTemporalBlocking(bool reportTestCases, size_t nx, size_t ny, size_t nz) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(3);
+	structured_grid<Scalar, Dim> f(nx, ny, nz), u0(nx, ny, nz);
+	RandomGrid(f, engine);
+	RandomGrid(u0, engine);
+	auto A = laplacian<Scalar, Dim>();
+	structured_grid<Scalar, Dim> reference(u0);
+	jacobi(A, f, reference, 7, Scalar(0.8), 1, 1);
+	for (size_t T : { 2, 3, 4, 7, 9 }) {
+		for (size_t nrThreads : { 1, 3 }) {
+			structured_grid<Scalar, Dim> u(u0);
+			jacobi(A, f, u, 7, Scalar(0.8), nrThreads, T);
+			for (size_t p = 0; p < u.size(); ++p) {
+				if (u.begin()[p] != reference.begin()[p]) {
+					++nrOfFailedTests;
+					if (reportTestCases) std::cerr << "FAIL: temporal block " << T << " threads " << nrThreads << " point " << p << " " << u.begin()[p] << " != " << reference.begin()[p] << '\n';
+					break;
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// red-black SOR is independent of the number of threads
+template<typename Scalar, size_t Dim>
+int VerifyRedBlackThreads(bool reportTestCases, size_t nx, size_t ny, size_t nz) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(4);
+	structured_grid<Scalar, Dim> f(nx, ny, nz), u1(nx, ny, nz);
+	RandomGrid(f, engine);
+	RandomGrid(u1, engine);
+	structured_grid<Scalar, Dim> u4(u1);
+	auto A = laplacian<Scalar, Dim>();
+	sor(A, f, u1, Scalar(1.5), 5, 1);
+	sor(A, f, u4, Scalar(1.5), 5, 4);
+	for (size_t p = 0; p < u1.size(); ++p) {
+		if (u1.begin()[p] != u4.begin()[p]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: point " << p << " " << u1.begin()[p] << " != " << u4.begin()[p] << '\n';
+			break;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+/*
+-laplace(u) = g on the unit square with u = x(1-x) y(1-y), which is a polynomial of degree 2 in each
+variable, so that the 5-point stencil is exact and the discrete solution is the exact solution
+*/
+template<typename Scalar>
+int VerifyPoisson(bool reportTestCases, const std::string& method, size_t n, double tolerance) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	double h = 1.0 / double(n + 1);
+	grid2D<Scalar> f(n, n), u(n, n);
+	for (size_t j = 1; j <= n; ++j) {
+		for (size_t i = 1; i <= n; ++i) {
+			double x = double(i) * h, y = double(j) * h;
+			f(i, j) = Scalar(h * h * 2.0 * (x * (1.0 - x) + y * (1.0 - y)));
+		}
+	}
+	auto A = laplacian<Scalar, 2>();
+	const double pi = 3.14159265358979323846;
+	if (method == "sor") {
+		sor(A, f, u, Scalar(2.0 / (1.0 + std::sin(pi * h))), 4 * n, 2);
+	}
+	else if (method == "gauss-seidel") {
+		gauss_seidel(A, f, u, 2 * n * n, 2);
+	}
+	else {
+		jacobi(A, f, u, 4 * n * n, Scalar(1.0), 2, 4);
+	}
+	double maxError = 0.0;
+	for (size_t j = 1; j <= n; ++j) {
+		for (size_t i = 1; i <= n; ++i) {
+			double x = double(i) * h, y = double(j) * h;
+			maxError = std::max(maxError, std::fabs(double(u(i, j)) - x * (1.0 - x) * y * (1.0 - y)));
+		}
+	}
+	if (!(maxError <= tolerance)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: " << method << " error " << maxError << " tolerance " << tolerance << '\n';
+	}
+	double r = residual(A, u, f);
+	if (reportTestCases && nrOfFailedTests) std::cerr << "      residual " << r << '\n';
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "matrix-free stencil operators and solvers";
+	std::string test_tag = "stencil";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+#if MANUAL_TESTING
+
+	VerifyPoisson<posit<32, 2>>(true, "sor", 64, 0.0);
+
+	nrOfFailedTestCases = 0; // disregard any test failures in manual testing mode
+
+#else
+
+	nrOfFailedTestCases += ReportTestResult(VerifyApplyAgainstDense(reportTestCases), "grid2D<double>", "apply vs laplace2D");
+	nrOfFailedTestCases += ReportTestResult(VerifyApply3D(reportTestCases), "grid3D<double>", "apply");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyTemporalBlocking<double, 2>(reportTestCases, 45, 21, 1), "grid2D<double>", "temporal blocking");
+	nrOfFailedTestCases += ReportTestResult(VerifyTemporalBlocking<posit<32, 2>, 2>(reportTestCases, 33, 17, 1), "grid2D<posit<32,2>>", "temporal blocking");
+	nrOfFailedTestCases += ReportTestResult(VerifyTemporalBlocking<double, 3>(reportTestCases, 20, 11, 9), "grid3D<double>", "temporal blocking");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRedBlackThreads<double, 2>(reportTestCases, 45, 21, 1), "grid2D<double>", "red-black threads");
+	nrOfFailedTestCases += ReportTestResult(VerifyRedBlackThreads<float, 3>(reportTestCases, 20, 11, 9), "grid3D<float>", "red-black threads");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyPoisson<double>(reportTestCases, "sor", 63, 1.0e-9), "grid2D<double>", "poisson sor");
+	nrOfFailedTestCases += ReportTestResult(VerifyPoisson<double>(reportTestCases, "gauss-seidel", 31, 1.0e-6), "grid2D<double>", "poisson gauss-seidel");
+	nrOfFailedTestCases += ReportTestResult(VerifyPoisson<double>(reportTestCases, "jacobi", 31, 1.0e-6), "grid2D<double>", "poisson jacobi");
+	nrOfFailedTestCases += ReportTestResult(VerifyPoisson<posit<32, 2>>(reportTestCases, "sor", 63, 1.0e-6), "grid2D<posit<32,2>>", "poisson sor");
+	nrOfFailedTestCases += ReportTestResult(VerifyPoisson<posit<16, 1>>(reportTestCases, "sor", 15, 1.0e-2), "grid2D<posit<16,1>>", "poisson sor");
+
+#endif
+
+	std::cout << (nrOfFailedTestCases > 0 ? "FAIL" : "PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
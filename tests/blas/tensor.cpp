@@ -0,0 +1,332 @@
+// tensor.cpp: test suite for tensors, strided views, packed storage, and the inference kernels
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <cstdint>
+#include <random>
+// small tiles so that the test shapes span several tiles, including partial ones
+#define BLAS_TENSOR_TILE_M 4
+#define BLAS_TENSOR_TILE_N 8
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/verification/test_status.hpp>
+
+template<typename Scalar, size_t Rank>
+void RandomTensor(sw::universal::blas::tensor<Scalar, Rank>& t, std::mt19937_64& engine, double range = 1.0) {
+	std::uniform_real_distribution<double> dist(-range, range);
+	for (size_t i = 0; i < t.size(); ++i) t.data()[i] = Scalar(dist(engine));
+}
+
+// slicing, sub-ranges, transposition, permutation, and reshaping refer to the elements of the tensor
+int VerifyViews(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	auto check = [&](bool condition, const char* what) {
+		if (!condition) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << what << '\n';
+		}
+	};
+	tensor<double, 3> t({ 3, 4, 5 });
+	for (size_t i = 0; i < 3; ++i) for (size_t j = 0; j < 4; ++j) for (size_t k = 0; k < 5; ++k) t(i, j, k) = double(100 * i + 10 * j + k);
+	check(reinterpret_cast<std::uintptr_t>(t.data()) % BLAS_TENSOR_ALIGNMENT == 0, "alignment");
+	check(t.view().is_contiguous(), "contiguous");
+
+	auto s = t.slice(1, 2);         // t(i, 2, k)
+	check(s.extent(0) == 3 && s.extent(1) == 5 && s(2, 3) == 223.0, "slice");
+	auto sub = t.subview(2, 1, 4);  // t(i, j, 1..3)
+	check(sub.extent(2) == 3 && sub(1, 1, 0) == 111.0 && !sub.is_contiguous(), "subview");
+	auto tr = t.transpose(0, 2);    // tr(k, j, i)
+	check(tr.extent(0) == 5 && tr(4, 3, 2) == 234.0, "transpose");
+	auto p = t.permute({ 2, 0, 1 }); // p(k, i, j)
+	check(p.extent(0) == 5 && p.extent(1) == 3 && p(1, 2, 3) == 231.0, "permute");
+	auto flat = t.reshape<2>({ 12, 5 });
+	check(flat(7, 4) == 134.0, "reshape");
+	try {
+		sub.reshape<1>({ 36 });
+		check(false, "reshape of a strided view");
+	}
+	catch (const incompatible_tensors&) {}
+
+	// views write through to the tensor
+	tr(0, 0, 0) = -1.0;
+	s.slice(0, 1)(4) = -2.0;        // t(1, 2, 4)
+	check(t(0, 0, 0) == -1.0 && t(1, 2, 4) == -2.0, "write through views");
+	t.subview(0, 2, 3).fill(7.0);
+	check(t(2, 3, 4) == 7.0 && t(1, 3, 4) == 130.0 + 4.0, "fill of a subview");
+
+	// a copy of a strided view is contiguous
+	tensor<float, 3> c(t.transpose(0, 2));
+	check(c.extent(0) == 5 && c(4, 3, 1) == 134.0f && c.view().is_contiguous(), "copy of a view");
+	return nrOfFailedTests;
+}
+
+// every encoding survives packing and unpacking, at every bit offset
+template<typename Scalar>
+int VerifyPacking(bool reportTestCases, std::mt19937_64& engine) {
+	using namespace sw::universal::blas;
+	using traits = packing_traits<Scalar>;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 1000;
+	std::uniform_int_distribution<unsigned> dist(0, (1u << traits::nbits) - 1u);
+	std::vector<uint8_t> codes(N);
+	packed_tensor<Scalar, 2> pt({ 40, 25 });
+	for (size_t i = 0; i < N; ++i) {
+		codes[i] = uint8_t(i < (1u << traits::nbits) ? i : dist(engine));
+		pt.set(i, traits::decode(codes[i]));
+	}
+	if (pt.bytes() != (N * traits::nbits + 7) / 8 + 1) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: " << pt.bytes() << " bytes\n";
+	}
+	tensor<Scalar, 2> t = pt.unpack();
+	for (size_t i = 0; i < N; ++i) {
+		if (traits::encode(pt.get(i)) != codes[i] || traits::encode(t.data()[i]) != codes[i]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: element " << i << " encoding " << int(codes[i]) << " unpacked as " << int(traits::encode(pt.get(i))) << '\n';
+		}
+	}
+	if (traits::encode(pt(39, 24)) != codes[N - 1]) ++nrOfFailedTests;
+	// packing a tensor reproduces its encodings
+	packed_tensor<Scalar, 2> repacked(t);
+	for (size_t i = 0; i < N; ++i) {
+		if (traits::encode(repacked.get(i)) != codes[i]) ++nrOfFailedTests;
+	}
+	return nrOfFailedTests;
+}
+
+// matmul agrees with a sequential evaluation of the same policy, for views, strided views, and packed weights, and any number of threads
+template<typename Accumulator, typename AScalar, typename BScalar, typename CScalar>
+int VerifyMatmul(bool reportTestCases, size_t M, size_t K, size_t N, double range, std::mt19937_64& engine) {
+	using namespace sw::universal::blas;
+	using policy = sw::universal::dsp::accumulation<Accumulator>;
+	int nrOfFailedTests = 0;
+	tensor<AScalar, 2> A({ M, K });
+	tensor<BScalar, 2> B({ K, N }), Bt({ N, K });
+	RandomTensor(A, engine, range);
+	RandomTensor(B, engine, range);
+	for (size_t k = 0; k < K; ++k) for (size_t j = 0; j < N; ++j) Bt(j, k) = B(k, j);
+	tensor<CScalar, 2> ref({ M, N });
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			Accumulator acc;
+			policy::clear(acc);
+			for (size_t k = 0; k < K; ++k) policy::mac(acc, A(i, k), B(k, j));
+			CScalar y;
+			policy::round(acc, y);
+			ref(i, j) = y;
+		}
+	}
+	auto compare = [&](const tensor<CScalar, 2>& C, const char* what) {
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				if (C(i, j) != ref(i, j)) {
+					++nrOfFailedTests;
+					if (reportTestCases) std::cerr << "FAIL: " << what << " (" << i << ", " << j << ") " << C(i, j) << " != " << ref(i, j) << '\n';
+					return;
+				}
+			}
+		}
+	};
+	tensor<CScalar, 2> C({ M, N });
+	matmul<Accumulator>(A, B, C, 1);
+	compare(C, "matmul");
+	C.setzero();
+	matmul<Accumulator>(A, Bt.transpose(), C, 3);
+	compare(C, "matmul of a transposed view");
+	if constexpr (!std::is_floating_point_v<BScalar>) {  // native types have no packed storage
+		C.setzero();
+		matmul<Accumulator>(A, packed_tensor<BScalar, 2>(B), C, 2);
+		compare(C, "matmul of packed weights");
+	}
+	return nrOfFailedTests;
+}
+
+// conv2d agrees with the exact convolution rounded once
+template<typename Scalar, typename Accumulator>
+int VerifyConv2d(bool reportTestCases, const sw::universal::blas::conv2d_params& params, bool withBias, std::mt19937_64& engine) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	tensor<Scalar, 4> in({ 2, 3, 11, 13 }), W({ 5, 3, 3, 3 });
+	tensor<Scalar, 1> bias({ 5 });
+	RandomTensor(in, engine, 2.0);
+	RandomTensor(W, engine, 1.0);
+	RandomTensor(bias, engine, 1.0);
+	tensor<Scalar, 4> out(conv2d_extents(in.extents(), W.extents(), params)), out2(out.extents());
+	if (withBias) {
+		conv2d<Accumulator>(in, W, bias, out, params, 1);
+		conv2d<Accumulator>(in, packed_tensor<Scalar, 4>(W), bias, out2, params, 4);
+	}
+	else {
+		conv2d<Accumulator>(in, W, out, params, 1);
+		conv2d<Accumulator>(in, packed_tensor<Scalar, 4>(W), out2, params, 4);
+	}
+	size_t s = params.stride, p = params.padding, d = params.dilation;
+	for (size_t n = 0; n < out.extent(0); ++n) {
+		for (size_t o = 0; o < out.extent(1); ++o) {
+			for (size_t oh = 0; oh < out.extent(2); ++oh) {
+				for (size_t ow = 0; ow < out.extent(3); ++ow) {
+					// the products of 8-bit values are exact in double, and so are short sums of them
+					double sum = withBias ? double(bias(o)) : 0.0;
+					for (size_t c = 0; c < 3; ++c) {
+						for (size_t kh = 0; kh < 3; ++kh) {
+							for (size_t kw = 0; kw < 3; ++kw) {
+								long ih = long(oh * s + kh * d) - long(p), iw = long(ow * s + kw * d) - long(p);
+								if (ih < 0 || iw < 0 || ih >= 11 || iw >= 13) continue;
+								sum += double(W(o, c, kh, kw)) * double(in(n, c, size_t(ih), size_t(iw)));
+							}
+						}
+					}
+					Scalar ref = Scalar(sum);
+					if (out(n, o, oh, ow) != ref || out2(n, o, oh, ow) != ref) {
+						++nrOfFailedTests;
+						if (reportTestCases) std::cerr << "FAIL: conv2d (" << n << ", " << o << ", " << oh << ", " << ow << ") " << out(n, o, oh, ow) << " packed " << out2(n, o, oh, ow) << " != " << ref << '\n';
+						return nrOfFailedTests;
+					}
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// softmax rows sum to one and agree with the double precision evaluation, also along a strided dimension
+template<typename Scalar, typename Wide>
+int VerifySoftmax(bool reportTestCases, double tolerance, std::mt19937_64& engine) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	tensor<Scalar, 3> x({ 4, 7, 10 });
+	RandomTensor(x, engine, 4.0);
+	tensor<Scalar, 3> y(x.extents());
+	tensor<Scalar, 3> yt({ 4, 10, 7 });
+	softmax<Wide>(x, y, 3);
+	softmax<Wide>(x.transpose(1, 2), yt, 2);
+	for (size_t i = 0; i < 4; ++i) {
+		for (size_t j = 0; j < 7; ++j) {
+			double m = -1.0e300, sum = 0.0, total = 0.0;
+			for (size_t k = 0; k < 10; ++k) m = std::max(m, double(x(i, j, k)));
+			for (size_t k = 0; k < 10; ++k) sum += std::exp(double(x(i, j, k)) - m);
+			for (size_t k = 0; k < 10; ++k) {
+				double ref = std::exp(double(x(i, j, k)) - m) / sum;
+				total += double(y(i, j, k));
+				if (std::fabs(double(y(i, j, k)) - ref) > tolerance) {
+					++nrOfFailedTests;
+					if (reportTestCases) std::cerr << "FAIL: softmax (" << i << ", " << j << ", " << k << ") " << y(i, j, k) << " != " << ref << '\n';
+				}
+			}
+			if (std::fabs(total - 1.0) > 10 * tolerance) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: softmax row sum " << total << '\n';
+			}
+		}
+	}
+	// the softmax of the transpose along its rows is the softmax of x along its columns
+	for (size_t i = 0; i < 4; ++i) {
+		for (size_t k = 0; k < 10; ++k) {
+			double sum = 0.0;
+			for (size_t j = 0; j < 7; ++j) sum += double(yt(i, k, j));
+			if (std::fabs(sum - 1.0) > 10 * tolerance) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: softmax of a transposed view, row sum " << sum << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+int VerifyShapeChecks(bool reportTestCases) {
+	using namespace sw::universal::blas;
+	int nrOfFailedTests = 0;
+	tensor<float, 2> A({ 3, 4 }), B({ 5, 6 }), C({ 3, 6 });
+	try {
+		matmul<float>(A, B, C);
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: matmul shape mismatch not detected\n";
+	}
+	catch (const incompatible_tensors&) {}
+	tensor<float, 4> in({ 1, 2, 5, 5 }), W({ 3, 1, 3, 3 }), out({ 1, 3, 3, 3 });
+	try {
+		conv2d<float>(in, W, out);
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: conv2d channel mismatch not detected\n";
+	}
+	catch (const incompatible_tensors&) {}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+	using namespace sw::universal::blas;
+
+	std::string test_suite = "tensors and inference kernels";
+	std::string test_tag = "tensor";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	std::mt19937_64 engine(7);
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<quire<8, 0>, posit<8, 0>, posit<8, 0>, posit<8, 0>>(reportTestCases, 5, 7, 9, 2.0, engine), "posit<8,0>", "matmul quire");
+
+	nrOfFailedTestCases = 0; // disregard any test failures in manual testing mode
+
+#else
+
+	nrOfFailedTestCases += ReportTestResult(VerifyViews(reportTestCases), "tensor<double,3>", "views");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<posit<4, 0>>(reportTestCases, engine), "posit<4,0>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<posit<6, 1>>(reportTestCases, engine), "posit<6,1>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<posit<8, 0>>(reportTestCases, engine), "posit<8,0>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<cfloat<4, 2>>(reportTestCases, engine), "cfloat<4,2>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<cfloat<8, 4>>(reportTestCases, engine), "cfloat<8,4>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<fixpnt<3, 1>>(reportTestCases, engine), "fixpnt<3,1>", "packing");
+	nrOfFailedTestCases += ReportTestResult(VerifyPacking<fixpnt<8, 4>>(reportTestCases, engine), "fixpnt<8,4>", "packing");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<quire<8, 0>, posit<8, 0>, posit<8, 0>, posit<8, 0>>(reportTestCases, 13, 21, 19, 2.0, engine), "posit<8,0>", "matmul quire");
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<float, cfloat<8, 4>, cfloat<8, 4>, cfloat<8, 4>>(reportTestCases, 11, 17, 23, 2.0, engine), "cfloat<8,4>", "matmul float");
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<float, cfloat<8, 4>, posit<4, 0>, cfloat<8, 4>>(reportTestCases, 11, 17, 23, 2.0, engine), "cfloat<8,4> x posit<4,0>", "matmul float");
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<fixpnt<24, 8>, fixpnt<8, 4>, fixpnt<8, 4>, fixpnt<8, 4>>(reportTestCases, 9, 16, 17, 0.5, engine), "fixpnt<8,4>", "matmul fixpnt<24,8>");
+	nrOfFailedTestCases += ReportTestResult(VerifyMatmul<double, double, double, double>(reportTestCases, 17, 5, 31, 1.0, engine), "double", "matmul double");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyConv2d<posit<8, 0>, quire<8, 0>>(reportTestCases, conv2d_params{}, false, engine), "posit<8,0>", "conv2d");
+	nrOfFailedTestCases += ReportTestResult(VerifyConv2d<posit<8, 0>, quire<8, 0>>(reportTestCases, conv2d_params{ 2, 1, 1 }, true, engine), "posit<8,0>", "conv2d stride 2 pad 1 bias");
+	nrOfFailedTestCases += ReportTestResult(VerifyConv2d<posit<8, 0>, quire<8, 0>>(reportTestCases, conv2d_params{ 1, 2, 2 }, true, engine), "posit<8,0>", "conv2d dilation 2 pad 2 bias");
+
+	nrOfFailedTestCases += ReportTestResult(VerifySoftmax<double, double>(reportTestCases, 1.0e-15, engine), "double", "softmax");
+	nrOfFailedTestCases += ReportTestResult(VerifySoftmax<posit<8, 0>, double>(reportTestCases, 1.0 / 64, engine), "posit<8,0>", "softmax");
+	nrOfFailedTestCases += ReportTestResult(VerifySoftmax<cfloat<8, 4>, float>(reportTestCases, 1.0 / 16, engine), "cfloat<8,4>", "softmax");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyShapeChecks(reportTestCases), "tensor<float>", "shape checks");
+
+#endif
+
+	std::cout << (nrOfFailedTestCases > 0 ? "FAIL" : "PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::blas::blas_exception& err) {
+	std::cerr << "Uncaught blas exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,79 @@
+// fma.cpp: test suite runner for fused multiply-add on classic floats
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/cfloat/cfloat_impl.hpp>
+#include <universal/verification/test_status.hpp>
+#include <universal/verification/cfloat_test_suite.hpp>
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = false;
+	constexpr bool hasSubnormals = true;
+	constexpr bool hasSupernormals = true;
+	constexpr bool isSaturating = true;
+
+#if MANUAL_TESTING
+
+	{
+		// the addend is far below the product: the fused result rounds on the sticky bit it leaves behind
+		cfloat<8, 3, uint8_t> a(1.25f), b(1.25f), c(0.015625f);
+		std::cout << "fma(" << a << ", " << b << ", " << c << ") = " << fma(a, b, c) << " vs unfused " << (a * b + c) << '\n';
+	}
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat<6, 2, uint8_t> >(true), "cfloat<6,2,uint8_t>", "fma");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+	std::cout << "classic floating-point fused multiply-add validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 4, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 4, 1,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 4, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 4, 2,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 5, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 1,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 5, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 2,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 5, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 3,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 6, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 1,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 6, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 2,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 6, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 3,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 6, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 4,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 7, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 2,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 7, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 3,uint8_t,subnormals,supernormals,!saturating>", "fma");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 8, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 2,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 8, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 3,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 8, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 4,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 9, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 3,uint8_t,subnormals,supernormals,!saturating>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatFma< cfloat< 9, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 4,uint8_t,subnormals,supernormals,!saturating>", "fma");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::cfloat_arithmetic_exception& err) {
+	std::cerr << "Uncaught cfloat arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
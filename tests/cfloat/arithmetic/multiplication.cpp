@@ -0,0 +1,98 @@
+// multiplication.cpp: test suite runner for multiplication on classic floats
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/cfloat/cfloat_impl.hpp>
+#include <universal/verification/test_status.hpp>
+#include <universal/verification/cfloat_test_suite.hpp>
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = false;
+	constexpr bool hasSubnormals = true;
+	constexpr bool hasSupernormals = true;
+	constexpr bool isSaturating = true;
+
+#if MANUAL_TESTING
+
+	{
+		// the product 0.1875 * 0.09375 = 0.017578125 rounds up to the smallest subnormal 0.03125
+		cfloat<8, 2, uint8_t> a(0.1875f), b(0.09375f), c;
+		c = a * b;
+		std::cout << a << " * " << b << " = " << c << " : " << to_binary(c) << '\n';
+	}
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<8, 2, uint8_t> >(true), "cfloat<8,2,uint8_t>", "multiplication");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+	std::cout << "classic floating-point multiplication validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 4, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 4, 1,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 4, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 4, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 5, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 1,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 5, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 5, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 5, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 6, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 1,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 6, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 6, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 6, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 6, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 7, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 1,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 7, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 7, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 7, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 7, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 7, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 1, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 1,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 8, 6, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 8, 6,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 9, 2, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 2,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 9, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 9, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat< 9, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat< 9, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<10, 3, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<10, 3,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<10, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<10, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<10, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<10, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<11, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<11, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<11, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<11, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<12, 4, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<12, 4,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<12, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<12, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<12, 6, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<12, 6,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<13, 5, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<13, 5,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyCfloatMultiplication< cfloat<14, 6, uint8_t, hasSubnormals, hasSupernormals, !isSaturating> >(bReportIndividualTestCases), "cfloat<14, 6,uint8_t,subnormals,supernormals,!saturating>", "multiplication");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::cfloat_arithmetic_exception& err) {
+	std::cerr << "Uncaught cfloat arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
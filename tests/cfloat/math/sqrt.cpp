@@ -0,0 +1,119 @@
+// sqrt.cpp: test suite runner for the correctly rounded sqrt and rsqrt functions of cfloat
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <random>
+// use default number system library configuration
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/qd/qd.hpp>
+#include <universal/verification/cfloat_math_test_suite.hpp>
+
+// every encoding of a small cfloat, against the double root rounded into the cfloat
+template<typename TestType>
+int VerifySqrt(bool reportTestCases) {
+	using namespace sw::universal;
+	constexpr size_t NR_VALUES = (size_t(1) << TestType::nbits);
+	int nrOfFailedTestCases = 0;
+
+	TestType a;
+	for (size_t i = 0; i < NR_VALUES; ++i) {
+		a.setbits(i);
+		if (a.isnan()) continue;
+		double d = double(a);
+		TestType root = sw::universal::sqrt(a), rroot = sw::universal::rsqrt(a);
+		TestType ref(std::sqrt(d)), rref(1.0 / std::sqrt(d));
+		if (root != ref && !(root.isnan() && ref.isnan())) {
+			++nrOfFailedTestCases;
+			if (reportTestCases) ReportOneInputFunctionError("sqrt", "sqrt", a, root, ref);
+		}
+		if (rroot != rref && !(rroot.isnan() && rref.isnan())) {
+			++nrOfFailedTestCases;
+			if (reportTestCases) ReportOneInputFunctionError("rsqrt", "rsqrt", a, rroot, rref);
+		}
+	}
+	return nrOfFailedTestCases;
+}
+
+// random encodings of an IEEE-754 double configuration, against std::sqrt and a double-double reciprocal root
+int VerifyDoublePrecisionSqrt(bool reportTestCases, size_t nrOfRandoms) {
+	using namespace sw::universal;
+	using Double = cfloat<64, 11, uint32_t, true, false, false>;
+	int nrOfFailedTestCases = 0;
+	std::mt19937_64 engine(64);
+	Double a;
+	for (size_t i = 0; i < nrOfRandoms; ++i) {
+		uint64_t bits = engine() & 0x7FFF'FFFF'FFFF'FFFFull;
+		if (((bits >> 52) & 0x7FF) == 0x7FF) continue;
+		if (i % 8 == 0) bits &= 0x000F'FFFF'FFFF'FFFFull;  // subnormals
+		a.setbits(bits);
+		double d = double(a);
+		if (d == 0.0) continue;
+		// scale into the normal range of double-double before taking the reference reciprocal root
+		int e = std::ilogb(d) & ~1;
+		double rref = std::ldexp(double(dd_real(1.0) / sqrt(dd_real(std::ldexp(d, -e)))), -e / 2);
+		Double root = sw::universal::sqrt(a), rroot = sw::universal::rsqrt(a);
+		if (double(root) != std::sqrt(d)) {
+			++nrOfFailedTestCases;
+			if (reportTestCases) ReportOneInputFunctionError("sqrt", "sqrt", a, root, Double(std::sqrt(d)));
+		}
+		if (double(rroot) != rref) {
+			++nrOfFailedTestCases;
+			if (reportTestCases) ReportOneInputFunctionError("rsqrt", "rsqrt", a, rroot, Double(rref));
+		}
+	}
+	return nrOfFailedTestCases;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	bool bReportIndividualTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+	// generate individual testcases to hand trace/debug
+
+	cfloat<16, 5, uint16_t> a(2.0f);
+	cout << sqrt(a) << ' ' << rsqrt(a) << endl;
+
+	nrOfFailedTestCases = 0; // nullify accumulated test failures in manual testing
+
+#else
+
+	cout << "cfloat sqrt/rsqrt function validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt< cfloat<8, 2, uint8_t> >(bReportIndividualTestCases), "cfloat<8,2>", "sqrt/rsqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt< cfloat<12, 3, uint16_t> >(bReportIndividualTestCases), "cfloat<12,3>", "sqrt/rsqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt< cfloat<16, 5, uint16_t> >(bReportIndividualTestCases), "cfloat<16,5>", "sqrt/rsqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt< cfloat<16, 8, uint16_t> >(bReportIndividualTestCases), "cfloat<16,8>", "sqrt/rsqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifyDoublePrecisionSqrt(bReportIndividualTestCases, 100000), "cfloat<64,11>", "sqrt/rsqrt");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt< cfloat<20, 8, uint32_t> >(bReportIndividualTestCases), "cfloat<20,8>", "sqrt/rsqrt");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
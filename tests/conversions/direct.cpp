@@ -0,0 +1,271 @@
+// direct.cpp: test suite for the direct, triple-based conversions between Universal number systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <vector>
+// configure the number systems
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/adapters/adapt_direct_conversion.hpp>
+#include <universal/verification/test_status.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+/*
+   All sources below are at most 53 bits of precision, so double(src) is exact. The
+   references compute the correctly rounded target from that double independently of
+   the conversions of the number systems themselves: the floating-point targets by a
+   nearest search through all their encodings, the fixed-point targets by rounding the
+   scaled value to an integer.
+ */
+
+template<typename Number>
+uint64_t Encoding(const Number& v) {
+	if constexpr (requires { v.encoding(); }) {
+		return uint64_t(v.encoding());
+	}
+	else {
+		uint64_t bits{ 0 };
+		for (size_t i = 0; i < Number::nbits; ++i) if (v.at(i)) bits |= uint64_t(1) << i;
+		return bits;
+	}
+}
+
+// the encodings that the nearest search considers: all posits except NaR
+template<size_t nbits, size_t es>
+bool Candidate(uint64_t i, const sw::universal::posit<nbits, es>&) {
+	return i != (uint64_t(1) << (nbits - 1));
+}
+
+// the non-negative cfloat encodings that are valid for the configuration: no inf and NaN,
+// the all-ones exponent only with supernormals, and the zero exponent only with subnormals
+template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+bool Candidate(uint64_t i, const sw::universal::cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>&) {
+	constexpr size_t fbits = nbits - 1 - es;
+	constexpr uint64_t exponentMask = (uint64_t(1) << es) - 1, fractionMask = (uint64_t(1) << fbits) - 1;
+	uint64_t e = (i >> fbits) & exponentMask, f = i & fractionMask;
+	if (i >> (nbits - 1)) return false;
+	if (e == exponentMask) return hasSupernormals && f < fractionMask - 1;
+	if (e == 0) return hasSubnormals || f == 0;
+	return true;
+}
+
+// nearest search through the sorted candidate values of a floating-point target, ties to the even encoding
+template<typename Target>
+const std::vector<std::pair<double, uint64_t>>& ValueTable() {
+	static std::vector<std::pair<double, uint64_t>> table = [] {
+		std::vector<std::pair<double, uint64_t>> t;
+		Target v;
+		for (uint64_t i = 0; i < (uint64_t(1) << Target::nbits); ++i) {
+			if (!Candidate(i, v)) continue;
+			v.setbits(i);
+			t.push_back({ double(v), i });
+		}
+		std::sort(t.begin(), t.end());
+		return t;
+	}();
+	return table;
+}
+
+template<typename Target>
+uint64_t NearestEncoding(double d) {
+	const auto& table = ValueTable<Target>();
+	auto it = std::lower_bound(table.begin(), table.end(), std::make_pair(d, uint64_t(0)));
+	if (it == table.end()) return table.back().second;
+	if (it == table.begin()) return it->second;
+	auto below = it - 1;
+	double dl = d - below->first, du = it->first - d;
+	if (dl < du) return below->second;
+	if (du < dl) return it->second;
+	return ((below->second & 1) == 0 ? below->second : it->second);
+}
+
+template<size_t nbits, size_t es>
+uint64_t Reference(double d, const sw::universal::posit<nbits, es>&) {
+	using Posit = sw::universal::posit<nbits, es>;
+	if (!std::isfinite(d)) return uint64_t(1) << (nbits - 1);
+	if (d == 0.0) return 0;
+	uint64_t bits = NearestEncoding<Posit>(d);
+	if (bits == 0) bits = (d > 0 ? 1 : (uint64_t(1) << nbits) - 1);  // posits do not underflow to zero
+	return bits;
+}
+
+template<size_t nbits, size_t es, typename bt, bool hasSubnormals, bool hasSupernormals, bool isSaturating>
+uint64_t Reference(double d, const sw::universal::cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>&) {
+	using Cfloat = sw::universal::cfloat<nbits, es, bt, hasSubnormals, hasSupernormals, isSaturating>;
+	constexpr uint64_t nan = (uint64_t(1) << (nbits - 1)) - 1;  // quiet NaN: all ones with a positive sign
+	constexpr uint64_t inf = nan - 1;
+	uint64_t sign = (std::signbit(d) ? uint64_t(1) << (nbits - 1) : 0);
+	if (std::isnan(d)) return nan | sign;
+	// beyond maxpos plus half an ulp the value overflows
+	const auto& table = ValueTable<Cfloat>();
+	double maxpos = table.back().first, prev = table[table.size() - 2].first;
+	if (std::fabs(d) >= maxpos + (maxpos - prev) / 2) return (isSaturating ? table.back().second : inf) | sign;
+	return NearestEncoding<Cfloat>(std::fabs(d)) | sign;
+}
+
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+uint64_t Reference(double d, const sw::universal::fixpnt<nbits, rbits, arithmetic, bt>&) {
+	constexpr int64_t maxpos = (int64_t(1) << (nbits - 1)) - 1, maxneg = -maxpos - 1;
+	if (std::isnan(d)) return 0;
+	double scaled = std::nearbyint(std::ldexp(d, int(rbits)));
+	int64_t raw = (std::isinf(d) ? (d > 0 ? maxpos : maxneg) : int64_t(scaled));
+	if (arithmetic == sw::universal::Saturating) raw = std::clamp(raw, maxneg, maxpos);
+	return uint64_t(raw) & ((uint64_t(1) << nbits) - 1);
+}
+
+template<size_t nbits, typename BlockType>
+uint64_t Reference(double d, const sw::universal::integer<nbits, BlockType>&) {
+	if (std::isnan(d)) return 0;
+	if (std::isinf(d)) return (d > 0 ? (uint64_t(1) << (nbits - 1)) - 1 : uint64_t(1) << (nbits - 1));
+	return uint64_t(int64_t(std::nearbyint(d))) & ((uint64_t(1) << nbits) - 1);
+}
+
+// enumerate all encodings of the source and compare the direct conversion to the reference
+template<typename Source, typename Target>
+int VerifyDirectConversion(bool reportTestCases) {
+	using namespace sw::universal;
+	constexpr size_t nbits = Source::nbits;
+	static_assert(nbits <= 16, "exhaustive enumeration is limited to 16-bit sources");
+	int nrOfFailedTests = 0;
+	Source src;
+	for (uint64_t i = 0; i < (uint64_t(1) << nbits); ++i) {
+		src.setbits(i);
+		double d = double(src);
+		Target tgt = convert_direct<Target>(src);
+		uint64_t ref = Reference(d, tgt);
+		// the direct conversion preserves signalling and quiet NaNs, which double does not carry
+		if (std::isnan(d) && Encoding(tgt) == Reference(-d, tgt)) continue;
+		if (Encoding(tgt) != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases && nrOfFailedTests < 10) {
+				std::cerr << "FAIL: " << to_binary(src) << " : " << d << " -> " << to_binary(tgt) << " != " << std::hex << ref << std::dec << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the batch interfaces must agree with the scalar conversion
+template<typename Source, typename Target>
+int VerifyBatchConversion(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::vector<Source> src(1000);
+	for (size_t i = 0; i < src.size(); ++i) src[i] = double(i) / 7.0 - 50.0;
+	std::vector<Target> tgt;
+	convert_direct(src, tgt);
+	for (size_t i = 0; i < src.size(); ++i) {
+		if (tgt.size() != src.size() || Encoding(tgt[i]) != Encoding(convert_direct<Target>(src[i]))) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: batch conversion of " << src[i] << '\n';
+			break;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// integers wider than 64 bits: leading bits beyond the significand feed the sticky bit
+int VerifyWideIntegers(bool reportTestCases) {
+	using namespace sw::universal;
+	using Integer = integer<128, uint32_t>;
+	int nrOfFailedTests = 0;
+	// 2^100 + 2^47 + 1 is a tie between 2^100 and 2^100 + 2^48 in double precision without
+	// the least significant bit, which is only visible through the sticky bit of the triple
+	Integer big(1), half(1);
+	big <<= 100;
+	half <<= 47;
+	big += half;
+	big += Integer(1);
+	cfloat<64, 11, uint64_t, true, false, false> c = convert_direct< cfloat<64, 11, uint64_t, true, false, false> >(big);
+	double ref = std::ldexp(1.0, 100) + std::ldexp(1.0, 48);
+	if (double(c) != ref) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer<128> to cfloat<64,11> " << to_binary(c) << '\n';
+	}
+	// -2^127 is the most negative value and its own two's complement
+	Integer minneg(1);
+	minneg <<= 127;
+	posit<32, 2> p = convert_direct< posit<32, 2> >(minneg);
+	if (double(p) != -std::ldexp(1.0, 120)) {  // posit<32,2> saturates at maxneg = -2^120
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer<128> maxneg to posit<32,2> " << p << '\n';
+	}
+	// integer to integer sign extends and wraps modulo 2^nbits
+	integer<200, uint8_t> wide = convert_direct< integer<200, uint8_t> >(Integer(-12345));
+	integer<12, uint8_t> narrow = convert_direct< integer<12, uint8_t> >(Integer(4096 + 77));
+	if (wide != -12345 || narrow != 77) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer to integer " << wide << " " << narrow << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "direct conversions";
+	std::string test_tag = "convert_direct";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	using Posit8   = posit<8, 0>;
+	using Posit16  = posit<16, 1>;
+	using Cfloat8  = cfloat<8, 2, uint8_t, true, false, false>;
+	using Cfloat16 = cfloat<16, 5, uint16_t, true, false, false>;
+	using Bfloat16 = cfloat<16, 8, uint16_t, false, false, true>;
+	using Fixpnt16 = fixpnt<16, 8, Modulo, uint16_t>;
+	using Fixpnt8  = fixpnt<8, 4, Saturating, uint8_t>;
+	using Integer16 = integer<16, uint16_t>;
+	using Integer8  = integer<8, uint8_t>;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Posit8>(reportTestCases), "posit<16,1>", "posit<8,0>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit8, Posit16>(reportTestCases), "posit<8,0>", "posit<16,1>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Cfloat16>(reportTestCases), "posit<16,1>", "cfloat<16,5>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Cfloat8>(reportTestCases), "posit<16,1>", "cfloat<8,2>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Bfloat16>(reportTestCases), "posit<16,1>", "cfloat<16,8,sat>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Fixpnt16>(reportTestCases), "posit<16,1>", "fixpnt<16,8>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Fixpnt8>(reportTestCases), "posit<16,1>", "fixpnt<8,4,sat>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Posit16, Integer16>(reportTestCases), "posit<16,1>", "integer<16>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Posit16>(reportTestCases), "cfloat<16,5>", "posit<16,1>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Posit8>(reportTestCases), "cfloat<16,5>", "posit<8,0>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Cfloat8>(reportTestCases), "cfloat<16,5>", "cfloat<8,2>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Bfloat16>(reportTestCases), "cfloat<16,5>", "cfloat<16,8,sat>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Fixpnt16>(reportTestCases), "cfloat<16,5>", "fixpnt<16,8>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Cfloat16, Integer16>(reportTestCases), "cfloat<16,5>", "integer<16>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Posit16>(reportTestCases), "fixpnt<16,8>", "posit<16,1>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Posit8>(reportTestCases), "fixpnt<16,8>", "posit<8,0>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Cfloat16>(reportTestCases), "fixpnt<16,8>", "cfloat<16,5>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Cfloat8>(reportTestCases), "fixpnt<16,8>", "cfloat<8,2>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Fixpnt8>(reportTestCases), "fixpnt<16,8>", "fixpnt<8,4,sat>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Fixpnt16, Integer8>(reportTestCases), "fixpnt<16,8>", "integer<8>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Integer16, Posit8>(reportTestCases), "integer<16>", "posit<8,0>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Integer16, Cfloat8>(reportTestCases), "integer<16>", "cfloat<8,2>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Integer16, Bfloat16>(reportTestCases), "integer<16>", "cfloat<16,8,sat>");
+	nrOfFailedTestCases += ReportTestResult(VerifyDirectConversion<Integer16, Fixpnt16>(reportTestCases), "integer<16>", "fixpnt<16,8>");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchConversion<posit<32, 2>, cfloat<32, 8, uint32_t, true, false, false>>(reportTestCases), "posit<32,2>", "batch");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchConversion<cfloat<32, 8, uint32_t, true, false, false>, fixpnt<32, 16, Modulo, uint32_t>>(reportTestCases), "cfloat<32,8>", "batch");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideIntegers(reportTestCases), "integer<128>", "wide integers");
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,222 @@
+// arithmetic.cpp: functional tests for double-double arithmetic against exact expansion references
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <random>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/dd/dd.hpp>
+#include <universal/number/adaptivefloat/adaptivefloat.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+// the exact value of a double-double
+sw::universal::adaptivefloat Exact(const sw::universal::dd_real& v) {
+	sw::universal::adaptivefloat e(v.high());
+	e += v.low();
+	return e;
+}
+
+// a normalized double-double with a random low component and a moderate exponent
+sw::universal::dd_real RandomDoubleDouble(std::mt19937_64& engine) {
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-60, 60);
+	double hi = std::ldexp(mantissa(engine), exponent(engine));
+	double lo = std::ldexp(hi * mantissa(engine), -53);
+	return sw::universal::add(hi, lo);
+}
+
+// the relative error of a result against its exact reference, as a binary exponent
+bool WithinBound(const sw::universal::dd_real& result, const sw::universal::adaptivefloat& reference, int bound) {
+	sw::universal::adaptivefloat error = Exact(result) - reference;
+	if (error.iszero()) return true;
+	if (reference.iszero()) return false;
+	return error.scale() - reference.scale() <= -bound;
+}
+
+// sums, differences, and products against their exact values, including catastrophic cancellation
+int VerifyAddSubMul(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(31);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		dd_real a = RandomDoubleDouble(engine), b = RandomDoubleDouble(engine);
+		// every fourth case cancels the leading components
+		if (i % 4 == 0) b = -a + dd_real(std::ldexp(a.high(), -40 - int(i % 50)));
+		adaptivefloat ea = Exact(a), eb = Exact(b);
+		if (!WithinBound(a + b, ea + eb, 104)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " + " << b << " = " << a + b << '\n';
+		}
+		if (!WithinBound(a - b, ea - eb, 104)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " - " << b << " = " << a - b << '\n';
+		}
+		if (!WithinBound(a * b, ea * eb, 103)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " * " << b << " = " << a * b << '\n';
+		}
+		double c = b.high();
+		if (!WithinBound(a + c, ea + adaptivefloat(c), 104) || !WithinBound(a * c, ea * adaptivefloat(c), 104)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " with double " << c << '\n';
+		}
+	}
+	// the sum of two doubles is error free
+	dd_real one(1.0), tiny(std::ldexp(1.0, -80));
+	dd_real sum = one + tiny;
+	if (sum.high() != 1.0 || sum.low() != std::ldexp(1.0, -80) || sum - one != tiny) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1 + 2^-80 = " << sum << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// quotients and square roots against the exact product of the result with the operand
+int VerifyDivSqrt(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(37);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		dd_real a = RandomDoubleDouble(engine), b = RandomDoubleDouble(engine);
+		if (b.iszero()) continue;
+		dd_real q = a / b;
+		adaptivefloat reference = Exact(a) / Exact(b);
+		if (!WithinBound(q, reference, 102)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " / " << b << " = " << q << '\n';
+		}
+		dd_real qd = a / b.high();
+		if (!WithinBound(qd, Exact(a) / adaptivefloat(b.high()), 102)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " / " << b.high() << " = " << qd << '\n';
+		}
+		dd_real x = abs(a);
+		dd_real r = sqrt(x);
+		// r^2 reproduces x to twice the relative error of r
+		if (!WithinBound(r * r, Exact(x), 101)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: sqrt(" << x << ") = " << r << '\n';
+		}
+	}
+	// special cases follow the leading component
+	dd_real zero(0.0), one(1.0);
+	if (!(one / zero).isinf() || !(zero / zero).isnan() || !sqrt(-one).isnan() || sqrt(zero) != zero) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: special cases of division and square root\n";
+	}
+	dd_real big(SpecificValue::maxpos);
+	if (!(big * 2.0).isinf() || (big * 2.0).low() != 0.0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: overflow " << big * 2.0 << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// native conversions, decimal conversion, and numeric_limits
+int VerifyConversions(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	long long big = 9'007'199'254'740'993LL;  // 2^53 + 1 is not a double
+	dd_real a(big);
+	if ((long long)(a) != big || (long long)(-a) != -big || (long long)(dd_real(9.5)) != 9 || (long long)(dd_real(-9.5)) != -9) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer conversion " << a << '\n';
+	}
+	if ((long long)(dd_real(5.0, -std::ldexp(1.0, -60))) != 4 || (unsigned long long)(dd_real(18'446'744'073'709'551'615ull)) != 18'446'744'073'709'551'615ull) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: truncation of the low component\n";
+	}
+	dd_real third = dd_real(1.0) / 3.0;
+	if (third.str(31) != "3.3333333333333333333333333333333e-01") {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1/3 = " << third.str(31) << '\n';
+	}
+	dd_real pi;
+	if (!parse("3.14159265358979323846264338327950288", pi) || pi != dd_pi) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: parse pi = " << pi << " expected " << dd_pi << '\n';
+	}
+	std::stringstream s;
+	s << std::setprecision(10) << dd_pi << ' ' << std::fixed << std::setprecision(3) << dd_real(1234.5678) << ' ' << std::scientific << std::setprecision(2) << dd_real(-0.00125);
+	if (s.str() != "3.141592654 1234.568 -1.25e-03") {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: stream formatting " << s.str() << '\n';
+	}
+	dd_real eps = std::numeric_limits<dd_real>::epsilon();
+	if (dd_real(1.0) + eps == dd_real(1.0) || std::numeric_limits<dd_real>::digits != 106) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: epsilon " << eps << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the blas kernels instantiate with dd_real: a dot product that cancels exactly in double-double
+int VerifyBlas(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	blas::vector<dd_real> x = { dd_real(1.0e20), dd_real(1.0), dd_real(-1.0e20) };
+	blas::vector<dd_real> y = { dd_real(1.0), dd_real(1.0), dd_real(1.0) };
+	dd_real dot = blas::dot(x, y);
+	if (dot != dd_real(1.0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: blas dot " << dot << '\n';
+	}
+	blas::vector<dd_real> z = { dd_real(3.0), dd_real(4.0) };
+	if (blas::norm(z, 2) != dd_real(5.0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: blas norm " << blas::norm(z, 2) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	dd_real a(1.0), b(3.0);
+	cout << setprecision(32) << a / b << endl;
+
+#else
+
+	cout << "double-double arithmetic validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyAddSubMul(bReportIndividualTestCases, 10000), "dd_real", "add/sub/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivSqrt(bReportIndividualTestCases, 10000), "dd_real", "div/sqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifyConversions(bReportIndividualTestCases), "dd_real", "conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyBlas(bReportIndividualTestCases), "dd_real", "blas");
+
+#if STRESS_TESTING
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
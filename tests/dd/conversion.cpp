@@ -0,0 +1,118 @@
+// conversion.cpp: functional tests for the direct conversions between multi-double and fixed-size encodings
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <random>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/adapters/adapt_direct_conversion.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+// a double-precision cfloat rounds the exact sum of the components exactly like the native addition does
+int VerifyDoubleDoubleToCfloat(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Double = cfloat<64, 11, uint32_t, true, false, false>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(41);
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		double hi = std::ldexp(mantissa(engine), int(engine() % 200) - 100);
+		double lo = hi * std::ldexp(mantissa(engine), -53 - int(engine() % 10));
+		// every third case is a tie of the leading component that only the sticky bit resolves
+		if (i % 3 == 0) lo = std::ldexp((engine() & 1) ? 0.5 : -0.5, std::ilogb(hi) - 52);
+		dd_real a = dd_real(hi) + lo;
+		double reference = a.high() + a.low();
+		Double c = convert_direct<Double>(a);
+		if (double(c) != reference) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << to_binary(a) << " -> " << double(c) << " expected " << reference << '\n';
+		}
+		if (convert_direct<dd_real>(c) != dd_real(reference)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << c << " -> dd_real " << convert_direct<dd_real>(c) << '\n';
+		}
+		posit<32, 2> p = convert_direct<posit<32, 2>>(a);
+		if (p != posit<32, 2>(reference)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << to_binary(a) << " -> " << p << " expected " << posit<32, 2>(reference) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the trailing components of a quad-double decide the rounding of a tie in the leading component
+int VerifyQuadDouble(bool reportTestCases) {
+	using namespace sw::universal;
+	using Double = cfloat<64, 11, uint32_t, true, false, false>;
+	int nrOfFailedTests = 0;
+	double ulp = std::ldexp(1.0, -52);
+	qd_real above(1.0, ulp / 2.0, std::ldexp(1.0, -120), 0.0);
+	qd_real below(1.0, ulp / 2.0, -std::ldexp(1.0, -120), 0.0);
+	if (double(convert_direct<Double>(above)) != 1.0 + ulp || double(convert_direct<Double>(below)) != 1.0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: quad-double ties " << double(convert_direct<Double>(above)) - 1.0 << ' ' << double(convert_direct<Double>(below)) - 1.0 << '\n';
+	}
+	integer<128> big;
+	big = 1;
+	big <<= 60;
+	big += 1;  // 2^60 + 1 is not a double
+	qd_real q = convert_direct<qd_real>(big);
+	if (q != ldexp(qd_real(1.0), 60) + 1.0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer<128> -> qd_real " << q << '\n';
+	}
+	integer<64> i = convert_direct<integer<64>>(dd_real(9'007'199'254'740'993LL));
+	if ((long long)(i) != 9'007'199'254'740'993LL) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: dd_real -> integer<64> " << i << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	cout << convert_direct<posit<32, 2>>(dd_pi) << endl;
+
+#else
+
+	cout << "multi-double direct conversion validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyDoubleDoubleToCfloat(bReportIndividualTestCases, 10000), "dd_real", "cfloat<64,11>/posit<32,2>");
+	nrOfFailedTestCases += ReportTestResult(VerifyQuadDouble(bReportIndividualTestCases), "qd_real", "cfloat<64,11>/integer");
+
+#if STRESS_TESTING
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,58 @@
+// math.cpp: functional tests for the double-double mathematical library against high-precision references
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/dd/dd.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+#include <universal/verification/multi_double_math_test_suite.hpp>
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	cout << setprecision(32) << exp(dd_real(1.0)) << '\n' << dd_e << endl;
+
+#else
+
+	cout << "double-double mathematical library validation" << endl;
+
+	// the largest acceptable relative error of a result, as a binary exponent
+	constexpr int bound = 100;
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiDoubleExponentials<dd_real>(bReportIndividualTestCases, bound), "dd_real", "exp/log/pow");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiDoubleTrigonometry<dd_real>(bReportIndividualTestCases, bound), "dd_real", "trigonometry");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiDoubleHyperbolic<dd_real>(bReportIndividualTestCases, bound), "dd_real", "hyperbolic");
+
+#if STRESS_TESTING
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,201 @@
+// fft.cpp: test suite for the fast Fourier transforms of the DSP library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/dsp/dsp.hpp>
+#include <universal/verification/test_status.hpp>
+
+// the discrete Fourier transform by its definition in extended precision
+std::vector< std::complex<long double> > ReferenceDFT(const std::vector< std::complex<long double> >& x, bool inverse = false) {
+	const long double pi = 3.141592653589793238462643383279502884L;
+	size_t n = x.size();
+	std::vector< std::complex<long double> > X(n);
+	for (size_t k = 0; k < n; ++k) {
+		std::complex<long double> sum(0, 0);
+		for (size_t j = 0; j < n; ++j) {
+			long double angle = (inverse ? 2.0L : -2.0L) * pi * (long double)((j * k) % n) / (long double)n;
+			sum += x[j] * std::complex<long double>(std::cos(angle), std::sin(angle));
+		}
+		X[k] = (inverse ? sum / (long double)n : sum);
+	}
+	return X;
+}
+
+template<typename Scalar>
+std::vector< std::complex<Scalar> > RandomSequence(size_t n, uint64_t seed) {
+	std::mt19937_64 engine(seed);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector< std::complex<Scalar> > x(n);
+	for (auto& v : x) v = std::complex<Scalar>(Scalar(dist(engine)), Scalar(dist(engine)));
+	return x;
+}
+
+// largest deviation of a transform from the reference, relative to the largest magnitude of the reference
+// for floating-point formats, and absolute for the scaled transforms of fixed-point formats
+template<typename Scalar>
+double TransformError(const std::vector< std::complex<Scalar> >& X, const std::vector< std::complex<long double> >& ref, bool absolute) {
+	long double maxError = 0, maxMagnitude = 0;
+	for (size_t k = 0; k < X.size(); ++k) {
+		std::complex<long double> v((long double)double(X[k].real()), (long double)double(X[k].imag()));
+		maxError = std::max(maxError, std::abs(v - ref[k]));
+		maxMagnitude = std::max(maxMagnitude, std::abs(ref[k]));
+	}
+	return double(absolute ? maxError : maxError / (maxMagnitude > 0 ? maxMagnitude : 1));
+}
+
+// forward and inverse transforms of sizes with an even and an odd number of radix-2 stages
+// must be within a few rounding errors per stage of the extended precision DFT
+template<typename Scalar>
+int VerifyTransform(bool reportTestCases, size_t maxSize, double epsilon, bool scaled = false) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	for (size_t n = 1, log2n = 0; n <= maxSize; n <<= 1, ++log2n) {
+		std::vector< std::complex<Scalar> > x = RandomSequence<Scalar>(n, n);
+		std::vector< std::complex<long double> > xl(n);
+		for (size_t i = 0; i < n; ++i) xl[i] = std::complex<long double>(double(x[i].real()), double(x[i].imag()));
+		std::vector< std::complex<long double> > ref = ReferenceDFT(xl);
+		if (scaled) for (auto& v : ref) v /= (long double)n;
+
+		dsp::fft_plan<Scalar> plan(n, scaled);
+		std::vector< std::complex<Scalar> > X = x;
+		plan.forward(X);
+		double tolerance = 2.0 * double(log2n + 1) * epsilon;
+		double error = TransformError(X, ref, scaled);
+		if (error > tolerance) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: forward transform of size " << n << " error " << error << " > " << tolerance << '\n';
+		}
+		// the unscaled inverse of a scaled transform sums the absolute errors of the n bins of the spectrum
+		double inverseTolerance = (scaled ? std::sqrt(double(n)) : 2.0) * tolerance;
+		plan.inverse(X);
+		error = TransformError(X, xl, scaled);
+		if (error > inverseTolerance) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: inverse transform of size " << n << " error " << error << " > " << inverseTolerance << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the real transform must produce the non-redundant half of the complex transform of the real sequence
+template<typename Scalar>
+int VerifyRealTransform(bool reportTestCases, size_t maxSize, double epsilon, bool scaled = false) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(maxSize);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	for (size_t n = 2, log2n = 1; n <= maxSize; n <<= 1, ++log2n) {
+		std::vector<Scalar> x(n);
+		std::vector< std::complex<long double> > xl(n);
+		for (size_t i = 0; i < n; ++i) {
+			x[i] = Scalar(dist(engine));
+			xl[i] = std::complex<long double>(double(x[i]), 0);
+		}
+		std::vector< std::complex<long double> > ref = ReferenceDFT(xl);
+		ref.resize(n / 2 + 1);
+		if (scaled) for (auto& v : ref) v /= (long double)n;
+
+		dsp::real_fft_plan<Scalar> plan(n, scaled);
+		std::vector< std::complex<Scalar> > X = plan.forward(x);
+		double tolerance = 2.0 * double(log2n + 2) * epsilon;
+		double error = TransformError(X, ref, scaled);
+		if (error > tolerance) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: real forward transform of size " << n << " error " << error << " > " << tolerance << '\n';
+		}
+		std::vector<Scalar> y = plan.inverse(X);
+		double maxError = 0;
+		for (size_t i = 0; i < n; ++i) maxError = std::max(maxError, std::abs(double(y[i]) - double(x[i])));
+		double inverseTolerance = (scaled ? std::sqrt(double(n)) : 2.0) * tolerance;
+		if (maxError > inverseTolerance) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: real inverse transform of size " << n << " error " << maxError << " > " << inverseTolerance << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// batched and multithreaded transforms must be bit-identical to the serial transform of each sequence
+template<typename Scalar>
+int VerifyBatched(bool reportTestCases, size_t n, size_t count) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::vector< std::complex<Scalar> > batch = RandomSequence<Scalar>(n * count, count);
+	std::vector< std::complex<Scalar> > serial = batch, threaded = batch, large = RandomSequence<Scalar>(1 << 13, 13);
+	dsp::fft_plan<Scalar> plan(n), parallel(n, false, 4);
+	for (size_t b = 0; b < count; ++b) plan.forward(serial.data() + b * n);
+	parallel.forward(threaded.data(), count);
+	if (serial != threaded) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: batched transforms differ from the serial transforms\n";
+	}
+	// a single large transform splits its passes over the threads
+	std::vector< std::complex<Scalar> > largeSerial = large;
+	dsp::fft_plan<Scalar>(large.size()).forward(largeSerial);
+	dsp::fft_plan<Scalar>(large.size(), false, 4).forward(large);
+	if (large != largeSerial) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: multithreaded transform differs from the serial transform\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< posit<16, 1> >(true, 16, std::ldexp(1.0, -12)), "posit<16,1>", "fft");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+	std::cout << "dsp fast Fourier transform validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< double >(bReportIndividualTestCases, 1024, std::ldexp(1.0, -52)), "double", "fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< posit<16, 1> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -12)), "posit<16,1>", "fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< posit<32, 2> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -27)), "posit<32,2>", "fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< cfloat<32, 8, uint32_t, true, false, false> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -23)), "cfloat<32,8>", "fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< fixpnt<16, 14, Saturating, uint16_t> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -14), true), "fixpnt<16,14>", "scaled fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyRealTransform< double >(bReportIndividualTestCases, 1024, std::ldexp(1.0, -52)), "double", "real fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyRealTransform< posit<16, 1> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -12)), "posit<16,1>", "real fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyRealTransform< fixpnt<16, 14, Saturating, uint16_t> >(bReportIndividualTestCases, 256, std::ldexp(1.0, -14), true), "fixpnt<16,14>", "scaled real fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatched< posit<16, 1> >(bReportIndividualTestCases, 64, 16), "posit<16,1>", "batched fft");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyTransform< posit<32, 2> >(bReportIndividualTestCases, 4096, std::ldexp(1.0, -27)), "posit<32,2>", "fft");
+	nrOfFailedTestCases += ReportTestResult(VerifyRealTransform< posit<32, 2> >(bReportIndividualTestCases, 4096, std::ldexp(1.0, -27)), "posit<32,2>", "real fft");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
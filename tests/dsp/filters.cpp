@@ -0,0 +1,257 @@
+// filters.cpp: test suite for the streaming FIR and IIR filter components of the DSP library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cstdint>
+#include <random>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/dsp/dsp.hpp>
+#include <universal/verification/test_status.hpp>
+
+// random samples of a number system with nbits, generated from their raw encoding
+template<typename Scalar, size_t nbits>
+std::vector<Scalar> RandomSignal(size_t N, uint64_t seed) {
+	std::mt19937_64 engine(seed);
+	std::vector<Scalar> signal(N);
+	for (auto& s : signal) s.setbits(engine() & (0xFFFF'FFFF'FFFF'FFFFull >> (64 - nbits)));
+	return signal;
+}
+
+// round an integer sum of products with shift fraction bits too many to nearest, ties to even
+int64_t RoundToNearestEven(int64_t v, int shift) {
+	if (shift == 0) return v;
+	int64_t q = v >> shift;   // floor
+	int64_t rem = v - (q << shift);
+	int64_t half = int64_t(1) << (shift - 1);
+	if (rem > half || (rem == half && (q & 1))) ++q;
+	return q;
+}
+
+// a Q15 FIR filter on fixpnt<16,12> samples with a 40-bit accumulator must match the exact integer sum of products
+// rounded once to the sample: saturating samples clip the result, modulo samples wrap it
+template<bool arithmetic>
+int VerifyFixpntFir(bool reportTestCases, size_t nrTaps, size_t N) {
+	using namespace sw::universal;
+	using Sample = fixpnt<16, 12, arithmetic, uint8_t>;
+	using Coeff = fixpnt<16, 15, Modulo, uint8_t>;
+	using Accumulator = fixpnt<40, 27, Modulo, uint8_t>;
+	int nrOfFailedTests = 0;
+
+	std::vector<Coeff> h = RandomSignal<Coeff, 16>(nrTaps, 1);
+	std::vector<Sample> x = RandomSignal<Sample, 16>(N, 2);
+	dsp::fir_filter<Sample, Coeff, Accumulator> fir;
+	{
+		std::vector<double> taps(nrTaps);
+		for (size_t k = 0; k < nrTaps; ++k) taps[k] = double(h[k]);
+		fir = dsp::fir_filter<Sample, Coeff, Accumulator>(taps);
+	}
+	std::vector<Sample> y = fir.process(x);
+
+	for (size_t n = 0; n < N; ++n) {
+		int64_t sum = 0;
+		for (size_t k = 0; k < nrTaps && k <= n; ++k) {
+			sum += int64_t(h[k].getbb()) * int64_t(x[n - k].getbb());
+		}
+		int64_t raw = RoundToNearestEven(sum, 15);
+		if constexpr (arithmetic == Saturating) {
+			if (raw > 32767) raw = 32767;
+			if (raw < -32768) raw = -32768;
+		}
+		Sample ref;
+		ref.setbits(uint64_t(raw) & 0xFFFF);
+		if (y[n] != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: fixpnt fir y[" << n << "] = " << to_binary(y[n]) << " vs " << to_binary(ref) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// a posit FIR filter with a quire accumulator must yield the correctly rounded convolution
+template<size_t nbits, size_t es>
+int VerifyPositFir(bool reportTestCases, size_t nrTaps, size_t N) {
+	using namespace sw::universal;
+	using Sample = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+
+	std::vector<double> taps = dsp::lowpass(nrTaps, 0.2);
+	std::mt19937_64 engine(nrTaps);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<Sample> x(N);
+	for (auto& s : x) s = dist(engine);
+
+	dsp::fir_filter<Sample, Sample, quire<nbits, es>> fir(taps);
+	std::vector<Sample> y(N);
+	// stream the signal in blocks of irregular size
+	for (size_t start = 0, block = 1; start < N; start += block, ++block) {
+		size_t n = (start + block > N ? N - start : block);
+		fir.process(x.data() + start, y.data() + start, n);
+	}
+
+	const std::vector<Sample>& h = fir.taps();
+	for (size_t n = 0; n < N; ++n) {
+		quire<nbits, es> q(0);
+		for (size_t k = 0; k < nrTaps && k <= n; ++k) q += quire_mul(h[k], x[n - k]);
+		Sample ref;
+		convert(q.to_value(), ref);
+		if (y[n] != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: posit fir y[" << n << "] = " << y[n] << " vs " << ref << '\n';
+		}
+	}
+
+	// reset clears the history: the filter must reproduce its first outputs
+	fir.reset();
+	for (size_t n = 0; n < nrTaps && n < N; ++n) {
+		if (fir(x[n]) != y[n]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: posit fir after reset y[" << n << "]\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// a biquad with a quire accumulator rounds the five products of each output once
+template<size_t nbits, size_t es>
+int VerifyPositBiquad(bool reportTestCases, size_t N) {
+	using namespace sw::universal;
+	using Sample = posit<nbits, es>;
+	using Section = dsp::biquad<Sample, Sample, quire<nbits, es>>;
+	int nrOfFailedTests = 0;
+
+	// second order Butterworth lowpass sections at 0.1 and 0.2 of the sample rate
+	Section s1(0.0674552738890719, 0.1349105477781438, 0.0674552738890719, -1.1429805025399011, 0.4128015980961886);
+	Section s2(0.2065720838261827, 0.4131441676523654, 0.2065720838261827, -0.3695273773512413, 0.1958157126558331);
+
+	std::mt19937_64 engine(N);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<Sample> x(N);
+	for (auto& s : x) s = dist(engine);
+
+	// reference: the Direct Form I recurrence of the first section with an independent quire
+	{
+		const Sample* c = s1.coefficients();
+		Sample x1(0), x2(0), y1(0), y2(0);
+		Section s = s1;
+		for (size_t n = 0; n < N; ++n) {
+			quire<nbits, es> q(0);
+			q += quire_mul(c[0], x[n]);
+			q += quire_mul(c[1], x1);
+			q += quire_mul(c[2], x2);
+			q += quire_mul(c[3], y1);
+			q += quire_mul(c[4], y2);
+			Sample ref;
+			convert(q.to_value(), ref);
+			Sample y = s(x[n]);
+			if (y != ref) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: biquad y[" << n << "] = " << y << " vs " << ref << '\n';
+			}
+			x2 = x1; x1 = x[n]; y2 = y1; y1 = ref;
+		}
+	}
+
+	// the block processing of a cascade matches the sample by sample evaluation of its sections
+	{
+		dsp::iir_cascade<Sample, Sample, quire<nbits, es>> cascade;
+		cascade.add(s1);
+		cascade.add(s2);
+		std::vector<Sample> y = cascade.process(x);
+		Section a = s1, b = s2;
+		for (size_t n = 0; n < N; ++n) {
+			Sample ref = b(a(x[n]));
+			if (y[n] != ref) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: cascade y[" << n << "] = " << y[n] << " vs " << ref << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the cascade of two Butterworth sections with a double accumulator must track the filter evaluated in double precision
+int VerifyBiquadAccuracy(bool reportTestCases, size_t N) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	const double b[2][3] = { { 0.0674552738890719, 0.1349105477781438, 0.0674552738890719 }, { 0.2065720838261827, 0.4131441676523654, 0.2065720838261827 } };
+	const double a[2][2] = { { -1.1429805025399011, 0.4128015980961886 }, { -0.3695273773512413, 0.1958157126558331 } };
+
+	using Sample = posit<32, 2>;
+	dsp::iir_cascade<Sample, Sample, double> cascade;
+	for (int s = 0; s < 2; ++s) cascade.add(dsp::biquad<Sample, Sample, double>(b[s][0], b[s][1], b[s][2], a[s][0], a[s][1]));
+
+	double state[2][4] = { { 0.0 } };
+	double maxError = 0.0;
+	for (size_t n = 0; n < N; ++n) {
+		double x = (n % 50 < 25 ? 1.0 : -1.0);
+		double y = x;
+		for (int s = 0; s < 2; ++s) {
+			double* st = state[s];
+			double v = b[s][0] * y + b[s][1] * st[0] + b[s][2] * st[1] - a[s][0] * st[2] - a[s][1] * st[3];
+			st[1] = st[0]; st[0] = y; st[3] = st[2]; st[2] = v;
+			y = v;
+		}
+		double e = std::abs(double(cascade(Sample(x))) - y);
+		if (e > maxError) maxError = e;
+	}
+	if (maxError > 1.0e-6) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: cascade deviates from the double precision recurrence by " << maxError << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFixpntFir<Saturating>(true, 4, 16), "fixpnt<16,12,Saturating>", "fir");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+	std::cout << "dsp FIR and IIR filter validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFixpntFir<Saturating>(bReportIndividualTestCases, 16, 500), "fixpnt<16,12,Saturating>", "fir");
+	nrOfFailedTestCases += ReportTestResult(VerifyFixpntFir<Modulo>(bReportIndividualTestCases, 16, 500), "fixpnt<16,12,Modulo>", "fir");
+	nrOfFailedTestCases += ReportTestResult(VerifyPositFir<16, 1>(bReportIndividualTestCases, 32, 300), "posit<16,1>", "fir");
+	nrOfFailedTestCases += ReportTestResult(VerifyPositBiquad<16, 1>(bReportIndividualTestCases, 300), "posit<16,1>", "biquad");
+	nrOfFailedTestCases += ReportTestResult(VerifyBiquadAccuracy(bReportIndividualTestCases, 500), "posit<32,2>", "iir cascade");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyPositFir<32, 2>(bReportIndividualTestCases, 31, 1000), "posit<32,2>", "fir");
+	nrOfFailedTestCases += ReportTestResult(VerifyPositBiquad<32, 2>(bReportIndividualTestCases, 1000), "posit<32,2>", "biquad");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,144 @@
+// multirate.cpp: test suite for the polyphase decimation and interpolation filters of the DSP library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <random>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/dsp/dsp.hpp>
+#include <universal/verification/test_status.hpp>
+
+template<typename Sample>
+std::vector<Sample> RandomSignal(size_t N, uint64_t seed) {
+	std::mt19937_64 engine(seed);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<Sample> signal(N);
+	for (auto& s : signal) s = dist(engine);
+	return signal;
+}
+
+// decimation by M must yield every M-th output of the full rate filter, independent of the block size of the stream
+template<typename Sample, typename Coeff, typename Accumulator>
+int VerifyDecimator(bool reportTestCases, size_t nrTaps, size_t M, size_t N) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+
+	std::vector<double> taps = dsp::lowpass(nrTaps, 0.5 / double(M));
+	std::vector<Sample> x = RandomSignal<Sample>(N, nrTaps + M);
+
+	dsp::fir_filter<Sample, Coeff, Accumulator> fir(taps);
+	std::vector<Sample> full = fir.process(x);
+
+	dsp::polyphase_decimator<Sample, Coeff, Accumulator> decimator(taps, M);
+	std::vector<Sample> y;
+	for (size_t start = 0, block = 1; start < N; start += block, block = (block % 7) + 1) {
+		size_t n = (start + block > N ? N - start : block);
+		std::vector<Sample> out = decimator.process(std::vector<Sample>(x.begin() + start, x.begin() + start + n));
+		y.insert(y.end(), out.begin(), out.end());
+	}
+
+	if (y.size() != (N + M - 1) / M) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: decimator produced " << y.size() << " outputs\n";
+		return nrOfFailedTests;
+	}
+	for (size_t m = 0; m < y.size(); ++m) {
+		if (y[m] != full[m * M]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: decimator y[" << m << "] = " << y[m] << " vs " << full[m * M] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// interpolation by L must yield the output of the full rate filter on the zero-stuffed input
+template<typename Sample, typename Coeff, typename Accumulator>
+int VerifyInterpolator(bool reportTestCases, size_t nrTaps, size_t L, size_t N) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+
+	std::vector<double> taps = dsp::lowpass(nrTaps, 0.5 / double(L));
+	std::vector<Sample> x = RandomSignal<Sample>(N, nrTaps + L);
+
+	std::vector<Sample> stuffed(N * L, Sample(0));
+	for (size_t n = 0; n < N; ++n) stuffed[n * L] = x[n];
+	dsp::fir_filter<Sample, Coeff, Accumulator> fir(taps);
+	std::vector<Sample> full = fir.process(stuffed);
+
+	dsp::polyphase_interpolator<Sample, Coeff, Accumulator> interpolator(taps, L);
+	std::vector<Sample> y(N * L);
+	size_t half = N / 2;
+	interpolator.process(x.data(), half, y.data());
+	interpolator.process(x.data() + half, N - half, y.data() + half * L);
+
+	for (size_t n = 0; n < N * L; ++n) {
+		if (y[n] != full[n]) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: interpolator y[" << n << "] = " << y[n] << " vs " << full[n] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+	using Posit = posit<16, 1>;
+	using Quire = quire<16, 1>;
+	using Sample = fixpnt<16, 12, Saturating, uint8_t>;
+	using Coeff = fixpnt<16, 15, Modulo, uint8_t>;
+	using Accumulator = fixpnt<40, 27, Modulo, uint8_t>;
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<Posit, Posit, Quire>(true, 8, 2, 20), "posit<16,1>", "decimate by 2");
+	nrOfFailedTestCases += ReportTestResult(VerifyInterpolator<Posit, Posit, Quire>(true, 8, 2, 20), "posit<16,1>", "interpolate by 2");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+	std::cout << "dsp polyphase decimation and interpolation validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<Posit, Posit, Quire>(bReportIndividualTestCases, 32, 4, 400), "posit<16,1>", "decimate by 4");
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<Posit, Posit, Quire>(bReportIndividualTestCases, 31, 3, 400), "posit<16,1>", "decimate by 3");
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<Sample, Coeff, Accumulator>(bReportIndividualTestCases, 32, 4, 400), "fixpnt<16,12>", "decimate by 4");
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<double, double, double>(bReportIndividualTestCases, 24, 5, 400), "double", "decimate by 5");
+	nrOfFailedTestCases += ReportTestResult(VerifyInterpolator<Posit, Posit, Quire>(bReportIndividualTestCases, 32, 4, 100), "posit<16,1>", "interpolate by 4");
+	nrOfFailedTestCases += ReportTestResult(VerifyInterpolator<Posit, Posit, Quire>(bReportIndividualTestCases, 30, 4, 100), "posit<16,1>", "interpolate by 4");
+	nrOfFailedTestCases += ReportTestResult(VerifyInterpolator<Sample, Coeff, Accumulator>(bReportIndividualTestCases, 33, 3, 100), "fixpnt<16,12>", "interpolate by 3");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyDecimator<posit<32, 2>, posit<32, 2>, quire<32, 2>>(bReportIndividualTestCases, 64, 8, 4000), "posit<32,2>", "decimate by 8");
+	nrOfFailedTestCases += ReportTestResult(VerifyInterpolator<posit<32, 2>, posit<32, 2>, quire<32, 2>>(bReportIndividualTestCases, 64, 8, 500), "posit<32,2>", "interpolate by 8");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,95 @@
+// sat_fma.cpp: test suite runner for arbitrary configuration fixed-point saturating fused multiply-add
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <iostream>
+#include <iomanip>
+
+// Configure the fixpnt template environment
+// first: enable general or specialized fixed-point configurations
+#define FIXPNT_FAST_SPECIALIZATION
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/fixpnt/fixpnt_impl.hpp>
+#include <universal/number/fixpnt/manipulators.hpp>
+#include <universal/number/fixpnt/math_functions.hpp>
+#include <universal/verification/fixpnt_test_suite.hpp>
+
+// generate specific test case that you can trace
+template<size_t nbits, size_t rbits, typename Ty>
+void GenerateTestCase(Ty _a, Ty _b, Ty _c) {
+	sw::universal::fixpnt<nbits, rbits, sw::universal::Saturating> a, b, c, result, unfused;
+	a = _a;
+	b = _b;
+	c = _c;
+	result = fma(a, b, c);
+	unfused = a * b + c;
+	std::cout << "fma(" << a << ", " << b << ", " << c << ") = " << result << " : " << to_binary(result) << '\n';
+	std::cout << a << " * " << b << " + " << c << "  = " << unfused << " : " << to_binary(unfused) << '\n';
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	bool bReportIndividualTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << "Fixed-point saturating fused multiply-add validation\n";
+
+#if MANUAL_TESTING
+
+	// the product 0.375 * 0.375 = 0.140625 is a tie at rbits = 4 that the addend breaks
+	GenerateTestCase<8, 4>(0.375f, 0.375f, 0.0625f);
+	GenerateTestCase<8, 4>(-0.375f, 0.375f, 0.0625f);
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<4, 2, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<4,2,Saturating,uint8_t>", "fma");
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<4, 0, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<4,0,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<4, 1, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<4,1,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<4, 4, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<4,4,Saturating,uint8_t>", "fma");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<6, 0, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<6,0,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<6, 3, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<6,3,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<6, 6, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<6,6,Saturating,uint8_t>", "fma");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<8, 4, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<8,4,Saturating,uint8_t>", "fma");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<8, 0, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<8,0,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<8, 7, Saturating, uint8_t>(bReportIndividualTestCases), "fixpnt<8,7,Saturating,uint8_t>", "fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedMultiplyAdd<10, 5, Saturating, uint16_t>(bReportIndividualTestCases), "fixpnt<10,5,Saturating,uint16_t>", "fma");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::fixpnt_arithmetic_exception& err) {
+	std::cerr << "Uncaught fixpnt arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::fixpnt_internal_exception& err) {
+	std::cerr << "Uncaught fixpnt internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
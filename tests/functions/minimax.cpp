@@ -0,0 +1,241 @@
+// minimax.cpp: generation of minimax polynomial kernels and their evaluation in the Universal number systems
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the UNIVERSAL project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <sstream>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/cfloat/cfloat.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/number/dd/dd.hpp>
+#include <universal/functions/minimax.hpp>
+#include <universal/number/posit/math/minimax_tables.hpp>
+#include <universal/number/cfloat/math/minimax_tables.hpp>
+#include <universal/verification/test_status.hpp>
+
+// the interval of the reduced argument of exp(x) = 2^k * exp(r)
+constexpr long double ln2half = 0.346573590279972654708616060729088284L;
+
+struct Exp { template<typename Real> Real operator()(const Real& x) const { using std::exp; return exp(x); } };
+struct Log1p { template<typename Real> Real operator()(const Real& x) const { using std::log1p; return log1p(x); } };
+struct Sin { template<typename Real> Real operator()(const Real& x) const { using std::sin; return sin(x); } };
+
+// the Remez polynomial equioscillates and improves on the Chebyshev interpolant
+template<size_t Degree, typename Function>
+int VerifyRemez(const std::string& name, const Function& f, long double a, long double b, sw::function::approximation_error kind, bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	auto cheby = chebyshev_approximation<Degree, long double>(f, a, b, kind);
+	auto best  = minimax_approximation<Degree, long double>(f, a, b, kind);
+	if (!(best.error <= cheby.error) || !(best.error > 0.0L)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " minimax error " << double(best.error) << " chebyshev error " << double(cheby.error) << '\n';
+	}
+	// the error of a best approximation reaches its extreme value with alternating signs at Degree + 2 points
+	constexpr size_t samples = 20000;
+	int alternations = 0, sign = 0;
+	long double threshold = best.error * 0.99L;
+	for (size_t i = 0; i <= samples; ++i) {
+		long double x = a + (b - a) * (long double)i / (long double)samples;
+		long double fx = f(x);
+		long double e = best(x) - fx;
+		if (kind == approximation_error::relative) e /= std::fabs(fx);
+		if (std::fabs(e) >= threshold) {
+			int s = (e < 0.0L ? -1 : 1);
+			if (s != sign) { ++alternations; sign = s; }
+		}
+	}
+	if (alternations < int(Degree + 2)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " error alternates " << alternations << " times, expected " << Degree + 2 << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// Estrin's scheme and Horner's rule evaluate the same polynomial
+template<typename Scalar>
+int VerifyEstrin(bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	// small integer coefficients and arguments: every intermediate is exact in double
+	std::array<Scalar, 7> c = { 1.0, -2.0, 3.0, 1.0, -1.0, 2.0, 1.0 };
+	std::vector<Scalar> v(c.begin(), c.end());
+	for (int i = -4; i <= 4; ++i) {
+		Scalar x = Scalar(double(i));
+		Scalar h = horner(c, x), e = estrin(c, x), ev = estrin(v, x);
+		if (h != e || e != ev) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << "FAIL: estrin(" << x << ") = " << e << " horner = " << h << '\n';
+		}
+	}
+	// degrees 0 to 9: the schemes agree to within rounding
+	for (size_t n = 0; n <= 10; ++n) {
+		std::vector<Scalar> coef(n);
+		for (size_t j = 0; j < n; ++j) coef[j] = Scalar(1.0 / double(j + 1));
+		Scalar x(0.375);
+		double h = double(horner(coef, x)), e = double(estrin(coef, x));
+		if (std::fabs(h - e) > 1.0e-5 * (std::fabs(h) + 1.0)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << "FAIL: degree " << n << " estrin = " << e << " horner = " << h << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// largest error of a kernel evaluated in Scalar against f in long double
+template<typename Scalar, size_t Degree, typename Function>
+double KernelError(const sw::function::polynomial_kernel<Scalar, Degree>& kernel, const Function& f, long double a, long double b, sw::function::approximation_error kind) {
+	using namespace sw::function;
+	double maxError = 0.0;
+	constexpr size_t samples = 2000;
+	for (size_t i = 0; i <= samples; ++i) {
+		Scalar x = Scalar(double(a + (b - a) * (long double)i / (long double)samples));
+		long double fx = f((long double)double(x));
+		double e = double(std::fabs((long double)double(kernel(x)) - fx));
+		if (kind == approximation_error::relative) e /= double(std::fabs(fx));
+		if (e > maxError) maxError = e;
+	}
+	return maxError;
+}
+
+// the kernel with coefficients in Scalar approximates f to within a few ulp of the format
+template<typename Scalar, size_t Degree, typename Function>
+int VerifyKernel(const std::string& name, const Function& f, long double a, long double b, sw::function::approximation_error kind, double tolerance, bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	double maxError = KernelError(minimax_kernel<Scalar, Degree, long double>(f, a, b, kind), f, a, b, kind);
+	if (!(maxError <= tolerance)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " kernel error " << maxError << " tolerance " << tolerance << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the committed coefficient table of a format meets the same tolerance as a generated kernel
+template<typename Scalar, size_t Degree, typename Function>
+int VerifyTable(const std::string& name, const Function& f, long double a, long double b, sw::function::approximation_error kind, double center, const double (&table)[Degree + 1], double tolerance, bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	double maxError = KernelError(polynomial_kernel<Scalar, Degree>::from_table(center, table), f, a, b, kind);
+	if (!(maxError <= tolerance)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " table error " << maxError << " tolerance " << tolerance << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// a table printed by emit() loads back into the same kernel
+template<typename Scalar, size_t Degree>
+int VerifyEmit(bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	auto kernel = minimax_kernel<Scalar, Degree, long double>(Exp(), -ln2half, ln2half);
+	std::stringstream ss;
+	emit(ss, "exp_kernel", kernel, "exp(x) on [-ln2/2, ln2/2]");
+	// parse the hexadecimal literals of the table back
+	double table[Degree + 1];
+	std::string text = ss.str();
+	size_t pos = text.find('{');
+	for (size_t j = 0; j <= Degree; ++j) {
+		pos = text.find("0x", pos);
+		size_t start = pos;
+		if (start > 0 && text[start - 1] == '-') --start;
+		table[j] = std::strtod(text.c_str() + start, nullptr);
+		pos = text.find('\n', pos);
+	}
+	auto loaded = polynomial_kernel<Scalar, Degree>::from_table(0.0, table);
+	for (size_t j = 0; j <= Degree; ++j) {
+		if (loaded.coefficients[j] != kernel.coefficients[j]) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << "FAIL: coefficient " << j << " " << loaded.coefficients[j] << " != " << kernel.coefficients[j] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::universal;
+	using namespace sw::function;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+
+	auto p = minimax_approximation<5>(Exp(), -ln2half, ln2half);
+	cout << "relative error of the degree 5 minimax polynomial of exp : " << double(p.error) << '\n';
+	emit(cout, "exp_posit32", minimax_kernel<posit<32, 2>, 7>(Exp(), -ln2half, ln2half), "exp(x) on [-ln2/2, ln2/2] for posit<32,2>");
+
+	nrOfFailedTestCases = 0;
+#else
+	cout << "minimax polynomial kernel validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRemez<5>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, bReportIndividualTestCases), "long double", "remez exp");
+	nrOfFailedTestCases += ReportTestResult(VerifyRemez<6>("log1p", Log1p(), -0.25L, 0.5L, approximation_error::absolute, bReportIndividualTestCases), "long double", "remez log1p");
+	nrOfFailedTestCases += ReportTestResult(VerifyRemez<4>("sin", Sin(), 0.0L, 0.785398163397448309615660845819875721L, approximation_error::absolute, bReportIndividualTestCases), "long double", "remez sin");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyEstrin<double>(bReportIndividualTestCases), "double", "estrin");
+	nrOfFailedTestCases += ReportTestResult(VerifyEstrin<posit<32, 2>>(bReportIndividualTestCases), "posit<32,2>", "estrin");
+	nrOfFailedTestCases += ReportTestResult(VerifyEstrin<cfloat<32, 8, uint32_t, true, false, false>>(bReportIndividualTestCases), "cfloat<32,8>", "estrin");
+
+	// kernels in the target formats: the tolerances are a few ulp of the formats
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<posit<16, 1>, 3>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, 4.0 * std::ldexp(1.0, -12), bReportIndividualTestCases), "posit<16,1>", "exp kernel");
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<posit<32, 2>, 7>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, 4.0 * std::ldexp(1.0, -27), bReportIndividualTestCases), "posit<32,2>", "exp kernel");
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<cfloat<32, 8, uint32_t, true, false, false>, 6>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, 4.0 * std::ldexp(1.0, -24), bReportIndividualTestCases), "cfloat<32,8>", "exp kernel");
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<fixpnt<16, 14>, 4>("log1p", Log1p(), -0.25L, 0.5L, approximation_error::absolute, 4.0 * std::ldexp(1.0, -14), bReportIndividualTestCases), "fixpnt<16,14>", "log1p kernel");
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<double, 12>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, 4.0 * std::ldexp(1.0, -53), bReportIndividualTestCases), "double", "exp kernel");
+
+	// the tables generated by applications/chebyshev/minimax.cpp
+	nrOfFailedTestCases += ReportTestResult(VerifyTable<posit<16, 1>, 3>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, exp_posit16_center, exp_posit16_coefficients, 4.0 * std::ldexp(1.0, -12), bReportIndividualTestCases), "posit<16,1>", "exp table");
+	nrOfFailedTestCases += ReportTestResult(VerifyTable<posit<32, 2>, 7>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, exp_posit32_center, exp_posit32_coefficients, 4.0 * std::ldexp(1.0, -27), bReportIndividualTestCases), "posit<32,2>", "exp table");
+	nrOfFailedTestCases += ReportTestResult(VerifyTable<cfloat<32, 8, uint32_t, true, false, false>, 6>("exp", Exp(), -ln2half, ln2half, approximation_error::relative, exp_cfloat32_center, exp_cfloat32_coefficients, 4.0 * std::ldexp(1.0, -24), bReportIndividualTestCases), "cfloat<32,8>", "exp table");
+	nrOfFailedTestCases += ReportTestResult(VerifyTable<posit<16, 1>, 5>("log1p", Log1p(), -0.25L, 0.5L, approximation_error::absolute, log1p_posit16_center, log1p_posit16_coefficients, 4.0 * std::ldexp(1.0, -13), bReportIndividualTestCases), "posit<16,1>", "log1p table");
+	nrOfFailedTestCases += ReportTestResult(VerifyTable<posit<32, 2>, 12>("log1p", Log1p(), -0.25L, 0.5L, approximation_error::absolute, log1p_posit32_center, log1p_posit32_coefficients, 4.0 * std::ldexp(1.0, -28), bReportIndividualTestCases), "posit<32,2>", "log1p table");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyEmit<posit<32, 2>, 7>(bReportIndividualTestCases), "posit<32,2>", "emit");
+	nrOfFailedTestCases += ReportTestResult(VerifyEmit<cfloat<32, 8, uint32_t, true, false, false>, 6>(bReportIndividualTestCases), "cfloat<32,8>", "emit");
+
+	{
+		// generation in double-double precision for a double target
+		dd_real a(-0.25), b(0.25);
+		auto p = minimax_approximation<11, dd_real>(Exp(), a, b, approximation_error::relative);
+		int nrOfFailures = (double(p.error) < std::ldexp(1.0, -60) && double(p.error) > 0.0) ? 0 : 1;
+		if (nrOfFailures && bReportIndividualTestCases) cerr << "FAIL: dd_real minimax error " << double(p.error) << '\n';
+		nrOfFailedTestCases += ReportTestResult(nrOfFailures, "dd_real", "remez exp");
+	}
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyRemez<10>("exp", Exp(), -1.0L, 1.0L, approximation_error::relative, bReportIndividualTestCases), "long double", "remez exp degree 10");
+	nrOfFailedTestCases += ReportTestResult(VerifyKernel<posit<32, 2>, 9>("log1p", Log1p(), -0.25L, 0.5L, approximation_error::absolute, 4.0 * std::ldexp(1.0, -28), bReportIndividualTestCases), "posit<32,2>", "log1p kernel");
+#endif
+
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::cfloat_arithmetic_exception& err) {
+	std::cerr << "Uncaught cfloat arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,171 @@
+// modular.cpp: test suite for the Montgomery/word-level modular arithmetic engine on arbitrary precision integers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/integer/integer.hpp>
+#include <universal/verification/test_status.hpp>
+
+// reference modular arithmetic on native 64-bit values, with a portable 128-bit product and remainder
+inline uint64_t ref_mulmod(uint64_t a, uint64_t b, uint64_t m) {
+	uint64_t hi, lo;
+	sw::universal::internal::multiply_64x64(a, b, hi, lo);
+	return sw::universal::internal::remainder_128x64(hi, lo, m);
+}
+inline uint64_t ref_powmod(uint64_t a, uint64_t e, uint64_t m) {
+	uint64_t r = 1 % m;
+	a %= m;
+	while (e) {
+		if (e & 1) r = ref_mulmod(r, a, m);
+		a = ref_mulmod(a, a, m);
+		e >>= 1;
+	}
+	return r;
+}
+
+// compare against the 128-bit reference for moduli up to 62 bits, odd and even
+int VerifyNativeReference(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Integer = integer<64, uint32_t>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(1);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		uint64_t m = (engine() >> (2 + i % 60)) | 1u;
+		if (i & 1) m += 1;  // even moduli exercise the non-Montgomery path
+		uint64_t a = engine() >> 2, b = engine() >> 2, e = engine() >> (1 + i % 63);  // non-negative exponents
+		modular_context<64, uint32_t> ctx{ Integer(m) };
+		uint64_t mul = uint64_t(ctx.mulmod(Integer(a), Integer(b)));
+		uint64_t pow = uint64_t(ctx.powmod(Integer(a), Integer(e)));
+		uint64_t add = uint64_t(ctx.addmod(Integer(a), Integer(b)));
+		uint64_t sub = uint64_t(ctx.submod(Integer(a), Integer(b)));
+		if (mul != ref_mulmod(a, b, m) || pow != ref_powmod(a, e, m) || add != (a % m + b % m) % m || sub != (a % m + m - b % m) % m) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: m = " << m << " a = " << a << " b = " << b << " e = " << e << '\n';
+		}
+		uint64_t inv = uint64_t(ctx.invmod(Integer(a)));
+		if (inv != 0 && ref_mulmod(a, inv, m) != 1 % m) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: invmod(" << a << ", " << m << ") = " << inv << '\n';
+		}
+	}
+	// negative operands reduce into [0, m)
+	modular_context<64, uint32_t> ctx{ Integer(97) };
+	if (ctx.reduce(Integer(-5)) != 92 || ctx.mulmod(Integer(-3), Integer(5)) != 82 || ctx.powmod(Integer(3), Integer(-1)) != 65) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: negative operands\n";
+	}
+	return nrOfFailedTests;
+}
+
+// compare the multi-limb path against the bit-serial integer operators
+template<size_t nbits>
+int VerifyMultiLimb(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Integer = integer<nbits, uint32_t>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	auto random = [&engine](size_t bits) {
+		Integer v(0);
+		for (size_t i = 0; i < bits; i += 32) {
+			v <<= 32;
+			v += Integer(engine() & 0xFFFF'FFFFu);
+		}
+		v >>= int(((bits + 31) / 32) * 32 - bits);
+		return v;
+	};
+	constexpr size_t mbits = nbits / 2 - 2;  // products of residues must fit the integer
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		Integer m = random(mbits);
+		if (i & 1) m.setbit(0, false); else m.setbit(0, true);
+		Integer a = random(mbits) % m, b = random(mbits) % m;
+		modular_context<nbits, uint32_t> ctx(m);
+		Integer result = ctx.mulmod(a, b);
+		Integer ref = (a * b) % m;
+		if (result != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: mulmod " << result << " != " << ref << '\n';
+		}
+		// small exponents against repeated multiplication
+		Integer power(1);
+		for (int e = 0; e < 5; ++e) {
+			if (ctx.powmod(a, Integer(e)) != power) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: powmod " << a << "^" << e << " mod " << m << '\n';
+			}
+			power = (power * a) % m;
+		}
+		Integer inv = ctx.invmod(a);
+		if (!inv.iszero() && (a * inv) % m != 1) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: invmod " << a << " mod " << m << '\n';
+		}
+		if (inv.iszero() && gcd(a, m) == 1) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: invmod missed the inverse of " << a << " mod " << m << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// Fermat's little theorem a^(p-1) = 1 mod p and a^p = a mod p for the prime 2^255 - 19
+int VerifyFermat(bool reportTestCases) {
+	using namespace sw::universal;
+	using Integer = integer<256, uint32_t>;
+	int nrOfFailedTests = 0;
+	Integer p(1);
+	p <<= 255;
+	p -= 19;
+	modular_context<256, uint32_t> ctx(p);
+	for (int a : { 2, 3, 5, 7, 1234567 }) {
+		if (ctx.powmod(Integer(a), p - 1) != 1 || ctx.powmod(Integer(a), p) != a) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: Fermat's little theorem for a = " << a << '\n';
+		}
+	}
+	// the residue interface stays in the Montgomery domain
+	auto x = ctx.enter(Integer(3));
+	auto y = ctx.one();
+	for (int i = 0; i < 10; ++i) y = ctx.mul(y, x);
+	if (ctx.leave(y) != 59049) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: residue products " << ctx.leave(y) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "integer modular arithmetic";
+	std::string test_tag = "modular";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeReference(reportTestCases, 2000), "integer<64>", "mulmod/powmod/invmod");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiLimb<128>(reportTestCases, 50), "integer<128>", "mulmod/powmod/invmod");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiLimb<256>(reportTestCases, 20), "integer<256>", "mulmod/powmod/invmod");
+	nrOfFailedTestCases += ReportTestResult(VerifyFermat(reportTestCases), "integer<256>", "Fermat");
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
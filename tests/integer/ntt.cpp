@@ -0,0 +1,178 @@
+// ntt.cpp: test suite for the number theoretic transform and the transform-based multiplication of large integers
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/integer/integer.hpp>
+#include <universal/verification/test_status.hpp>
+
+constexpr uint64_t P = sw::universal::ntt_field::modulus;
+// reference field arithmetic with a portable 128-bit product and remainder
+inline uint64_t ref_mulmod(uint64_t a, uint64_t b) {
+	uint64_t hi, lo;
+	sw::universal::internal::multiply_64x64(a, b, hi, lo);
+	return sw::universal::internal::remainder_128x64(hi, lo, P);
+}
+inline uint64_t ref_addmod(uint64_t a, uint64_t b) { return (a >= P - b ? a - (P - b) : a + b); }
+inline uint64_t ref_submod(uint64_t a, uint64_t b) { return (a >= b ? a - b : a + (P - b)); }
+
+// the field operations against the reference arithmetic, including the residues next to p and to 2^32
+int VerifyField(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(1);
+	const uint64_t edges[] = { 0, 1, 2, 0xFFFF'FFFFull, 0x1'0000'0000ull, 0x1'0000'0001ull, P - 2, P - 1 };
+	std::vector<uint64_t> values(std::begin(edges), std::end(edges));
+	for (size_t i = 0; i < nrOfTests; ++i) values.push_back(engine() % P);
+	for (size_t i = 0; i < values.size(); ++i) {
+		for (size_t j = 0; j < values.size(); j += (i < 8 ? 1 : values.size() / 8)) {
+			uint64_t a = values[i], b = values[j];
+			uint64_t mul = ntt_field::mul(a, b), add = ntt_field::add(a, b), sub = ntt_field::sub(a, b);
+			if (mul != ref_mulmod(a, b) || add != ref_addmod(a, b) || sub != ref_submod(a, b)) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: field operations on " << a << " and " << b << '\n';
+			}
+		}
+	}
+	// the generator has order p - 1: it is not a root of unity of any proper divisor
+	const uint64_t primeFactors[] = { 2, 3, 5, 17, 257, 65537 };
+	for (uint64_t q : primeFactors) {
+		if (ntt_field::pow(ntt_field::generator, (P - 1) / q) == 1) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: generator is not primitive for factor " << q << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the transform of a convolution is the product of the transforms: compare against the schoolbook convolution
+int VerifyConvolution(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(2);
+	for (size_t t = 0; t < nrOfTests; ++t) {
+		std::vector<uint64_t> a(1 + engine() % 100), b(1 + engine() % 100);
+		for (auto& v : a) v = engine() % P;
+		for (auto& v : b) v = engine() % P;
+		std::vector<uint64_t> ref(a.size() + b.size() - 1, 0);
+		for (size_t i = 0; i < a.size(); ++i) {
+			for (size_t j = 0; j < b.size(); ++j) ref[i + j] = ref_addmod(ref[i + j], ref_mulmod(a[i], b[j]));
+		}
+		if (ntt_convolution(a, b) != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: convolution of sizes " << a.size() << " and " << b.size() << '\n';
+		}
+	}
+	// the inverse transform undoes the forward transform, also when the stages run on several threads
+	std::vector<uint64_t> x(1 << 15), y;
+	for (auto& v : x) v = engine() % P;
+	y = x;
+	ntt_plan plan(x.size(), 4);
+	plan.forward(y);
+	ntt_plan serial(x.size());
+	std::vector<uint64_t> z = x;
+	serial.forward(z);
+	if (y != z) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: multithreaded transform differs from the serial transform\n";
+	}
+	plan.inverse(y);
+	if (x != y) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: inverse transform does not reproduce the sequence\n";
+	}
+	// a transform size that is not a power of two is rejected
+	try {
+		ntt_plan invalid(12);
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: ntt_plan accepted a transform size of 12\n";
+	}
+	catch (const ntt_size_not_power_of_two&) {
+		// expected
+	}
+	return nrOfFailedTests;
+}
+
+// ntt_multiply must agree with the bit-serial operator*, including the wrap-around modulo 2^nbits of signed values
+template<size_t nbits>
+int VerifyMultiply(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	using Integer = integer<nbits, uint32_t>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	for (size_t t = 0; t < nrOfTests; ++t) {
+		Integer a, b;
+		// operands of various lengths: full width products wrap, half width products are exact
+		size_t abytes = 1 + engine() % Integer::nrBytes, bbytes = 1 + engine() % Integer::nrBytes;
+		a.clear();
+		b.clear();
+		for (size_t i = 0; i < abytes; ++i) a.setbyte(i, uint8_t(engine()));
+		for (size_t i = 0; i < bbytes; ++i) b.setbyte(i, uint8_t(engine()));
+		a.setbyte(Integer::nrBytes - 1, uint8_t(a.byte(Integer::nrBytes - 1) & Integer::MS_BYTE_MASK));
+		b.setbyte(Integer::nrBytes - 1, uint8_t(b.byte(Integer::nrBytes - 1) & Integer::MS_BYTE_MASK));
+		if (t & 1) a = -a;
+		Integer ref = a * b;
+		Integer c = ntt_multiply(a, b);
+		if (c != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: ntt_multiply " << to_binary(c) << " vs " << to_binary(ref) << '\n';
+		}
+	}
+	// (2^(n/2) - 1)^2 = 2^n - 2^(n/2+1) + 1 modulo 2^n: every digit of the convolution carries
+	Integer m(1);
+	m <<= int(nbits / 2);
+	m -= 1;
+	Integer expected(1);
+	expected <<= int(nbits / 2 + 1);
+	expected = Integer(1) - expected;
+	if (ntt_multiply(m, m) != expected) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: ntt_multiply of all ones digits\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "integer number theoretic transform";
+	std::string test_tag = "ntt";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	nrOfFailedTestCases += ReportTestResult(VerifyField(reportTestCases, 200), "ntt_field", "add/sub/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyConvolution(reportTestCases, 50), "ntt_plan", "convolution");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiply<72>(reportTestCases, 200), "integer<72>", "ntt_multiply");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiply<256>(reportTestCases, 100), "integer<256>", "ntt_multiply");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiply<1024>(reportTestCases, 20), "integer<1024>", "ntt_multiply");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiply<8192>(reportTestCases, 5), "integer<8192>", "ntt_multiply");
+#endif
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+// primes.cpp: test suite for Miller-Rabin primality and the segmented sieve of Eratosthenes
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/integer/integer.hpp>
+#include <universal/verification/test_status.hpp>
+
+// Miller-Rabin on native values against the plain sieve, and on known primes and pseudoprimes
+int VerifyNativePrimality(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	constexpr uint64_t limit = 100000;
+	std::vector<uint64_t> primes = sieveOfEratosthenes(limit);
+	size_t k = 0;
+	for (uint64_t n = 0; n <= limit; ++n) {
+		bool ref = (k < primes.size() && primes[k] == n);
+		if (ref) ++k;
+		if (isPrime(n) != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: isPrime(" << n << ")\n";
+		}
+	}
+	// Mersenne prime 2^61 - 1 and the largest 64-bit prime
+	for (uint64_t p : { 2305843009213693951ull, 18446744073709551557ull, 1000000000039ull }) {
+		if (!isPrime(p)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: prime " << p << '\n';
+		}
+	}
+	// Carmichael numbers and strong pseudoprimes to several small bases
+	for (uint64_t c : { 561ull, 41041ull, 3215031751ull, 2152302898747ull, 3474749660383ull, 341550071728321ull, 3825123056546413051ull, 18446744073709551615ull }) {
+		if (isPrime(c)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: composite " << c << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// segmented sieve counts and lists for different segment sizes and thread counts
+int VerifySegmentedSieve(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	// pi(10^6) = 78498, pi(10^7) = 664579
+	if (countPrimes(0, 1000000) != 78498 || countPrimes(0, 10000000, 4) != 664579) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: prime counting function\n";
+	}
+	std::vector<uint64_t> ref = sieveOfEratosthenes(300000);
+	for (size_t segmentBytes : { size_t(8), size_t(100), size_t(4096), size_t(SIEVE_SEGMENT_BYTES) }) {
+		for (size_t nrThreads : { size_t(1), size_t(3) }) {
+			std::vector<uint64_t> primes = primesInRange(0, 300001, nrThreads, segmentBytes);
+			if (primes != ref) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: primesInRange with " << segmentBytes << " byte segments and " << nrThreads << " threads\n";
+			}
+		}
+	}
+	// sub-ranges that start and end on primes, on even numbers, and on 2
+	for (uint64_t low : { 0ull, 1ull, 2ull, 3ull, 97ull, 98ull, 1000ull }) {
+		for (uint64_t high : { 2ull, 3ull, 4ull, 97ull, 98ull, 200000ull }) {
+			uint64_t count = 0;
+			for (uint64_t p : ref) if (p >= low && p < high) ++count;
+			if (countPrimes(low, high) != count) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: countPrimes(" << low << ", " << high << ")\n";
+			}
+		}
+	}
+	// a window high up: every reported value must be prime, and the count must match Miller-Rabin
+	uint64_t low = 1000000000000ull, high = low + 100000;
+	uint64_t count = 0;
+	for (uint64_t n = low; n < high; ++n) if (isPrime(n)) ++count;
+	std::vector<uint64_t> primes = primesInRange(low, high, 2);
+	if (primes.size() != count || countPrimes(low, high, 2) != count) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: primes in [10^12, 10^12 + 10^5): " << primes.size() << " vs " << count << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// primality and factorization of arbitrary precision integers
+int VerifyIntegerPrimality(bool reportTestCases) {
+	using namespace sw::universal;
+	using Integer = integer<256, uint32_t>;
+	int nrOfFailedTests = 0;
+	Integer m127(1), m61(1);
+	m127 <<= 127; m127 -= 1;
+	m61 <<= 61; m61 -= 1;
+	if (!isPrime(m127) || isPrime(m127 * m61) || !isPrime(Integer(1000003)) || isPrime(Integer(1000001))) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: Miller-Rabin on integer<256>\n";
+	}
+
+	std::vector<Integer> v;
+	primeNumbersInRange(Integer(90), Integer(110), v);
+	std::vector<Integer> ref = { 97, 101, 103, 107, 109 };
+	if (v != ref) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: primeNumbersInRange\n";
+	}
+
+	// 2^5 * 3^4 * 1000003 * (2^61 - 1): the cofactor after trial division is prime
+	primefactors<256, uint32_t> factors;
+	primeFactorization(Integer(32 * 81) * Integer(1000003) * m61, factors);
+	if (factors.size() != 4 || factors[0].first != 2 || factors[0].second != 5 || factors[1].first != 3 || factors[1].second != 4
+		|| factors[2].first != 1000003 || factors[3].first != m61) {
+		++nrOfFailedTests;
+		if (reportTestCases) {
+			std::cerr << "FAIL: primeFactorization\n";
+			for (auto& f : factors) std::cerr << f.first << " ^ " << f.second << '\n';
+		}
+	}
+	factors.clear();
+	primeFactorization(Integer(1049), factors);
+	if (factors.size() != 1 || factors[0].first != 1049) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: primeFactorization of a prime\n";
+	}
+	return nrOfFailedTests;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "integer primality and sieves";
+	std::string test_tag = "primes";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativePrimality(reportTestCases), "uint64_t", "Miller-Rabin");
+	nrOfFailedTestCases += ReportTestResult(VerifySegmentedSieve(reportTestCases), "uint64_t", "segmented sieve");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntegerPrimality(reportTestCases), "integer<256>", "primality");
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+// instrumented.cpp: test suite for the operation and rounding counts of the instrumented number system adapter
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <universal/number/posit/posit.hpp>
+#define INSTRUMENTED_OPERATIONS_COUNT 1
+#include <universal/utility/instrumented.hpp>
+#include <universal/verification/test_status.hpp>
+
+// compare a counter to its expected value
+int VerifyCount(const std::string& counter, uint64_t count, uint64_t expected, bool bReportIndividualTestCases) {
+	if (count == expected) return 0;
+	if (bReportIndividualTestCases) std::cerr << "FAIL: " << counter << " count " << count << " != " << expected << '\n';
+	return 1;
+}
+
+// every operator counts one operation, new values count loads and assignments count stores
+template<typename Number>
+int VerifyOperationCounts(bool bReportIndividualTestCases) {
+	using namespace sw::universal;
+	using Real = instrumented<Number>;
+	int nrOfFailedTests = 0;
+
+	instrumentation<Number>::reset();
+	Real a(2.0), b(0.25), c;          // construction from a value is not a load
+	Real d(a);                        // load
+	Real e(std::move(d));             // load
+	c = a + b;                        // add, store
+	c = c - b;                        // sub, store
+	c *= a;                           // mul
+	c /= b;                           // div
+	c = sqrt(c);                      // sqrt, store: 2.25 - 0.25 = 2, 2 * 2 / 0.25 = 16, sqrt(16) = 4
+	e = c;                            // store
+	Real f = -a;                      // negation and abs are not counted
+	f = abs(f);                       // store
+
+	instrumentation_counts counts = instrumentation<Number>::snapshot();
+	nrOfFailedTests += VerifyCount("load",  counts.load,  2, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("store", counts.store, 5, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("add",   counts.add,   1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("sub",   counts.sub,   1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("mul",   counts.mul,   1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("div",   counts.div,   1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("sqrt",  counts.sqrt,  1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("arithmetic", counts.arithmetic(), 5, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("rounding", counts.rounding, 0, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+// exact results do not count, inexact results count a rounding event, overflow a saturation, and 1/0 a NaR
+template<size_t nbits, size_t es>
+int VerifyRoundingCounts(bool bReportIndividualTestCases) {
+	using namespace sw::universal;
+	using Number = posit<nbits, es>;
+	using Real = instrumented<Number>;
+	int nrOfFailedTests = 0;
+
+	instrumentation<Number>::reset();
+	Real one(1.0), two(2.0), three(3.0), zero(0.0), r;
+	r = one + two;
+	r = three * two;
+	r = three / two;
+	r = sqrt(Real(4.0));
+	nrOfFailedTests += VerifyCount("exact rounding", instrumentation<Number>::snapshot().rounding, 0, bReportIndividualTestCases);
+
+	r = one / three;
+	r = sqrt(two);
+	r = one + Real(double(std::numeric_limits<Number>::epsilon()) / 4.0);
+	nrOfFailedTests += VerifyCount("inexact rounding", instrumentation<Number>::snapshot().rounding, 3, bReportIndividualTestCases);
+
+	Real maxpos(std::numeric_limits<Number>::max());
+	r = maxpos * maxpos;
+	nrOfFailedTests += VerifyCount("saturate", instrumentation<Number>::snapshot().saturate, 1, bReportIndividualTestCases);
+
+	r = one / zero;
+	nrOfFailedTests += VerifyCount("nan", instrumentation<Number>::snapshot().nan, 1, bReportIndividualTestCases);
+	r = r + one;   // NaR operands do not produce a new NaR
+	nrOfFailedTests += VerifyCount("nan propagation", instrumentation<Number>::snapshot().nan, 1, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+// with 28 bits of precision the product (1 + 2^-27)^2 = 1 + 2^-26 + 2^-54 rounds to 1 + 2^-26:
+// a double reference drops the 2^-54 term as well and would report an exact result
+int VerifyWideRoundingCounts(bool bReportIndividualTestCases) {
+	using namespace sw::universal;
+	using Number = posit<32, 2>;
+	using Real = instrumented<Number>;
+	int nrOfFailedTests = 0;
+
+	instrumentation<Number>::reset();
+	Real a(1.0 + std::ldexp(1.0, -27)), r;
+	r = a * a;
+	uint64_t expected = (std::numeric_limits<long double>::digits >= 2 * std::numeric_limits<Number>::digits) ? 1 : 0;
+	nrOfFailedTests += VerifyCount("posit<32,2> rounding", instrumentation<Number>::snapshot().rounding, expected, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+// regions record the operations between their construction and destruction, regions with the same name are merged
+template<typename Number>
+int VerifyRegions(bool bReportIndividualTestCases) {
+	using namespace sw::universal;
+	using Real = instrumented<Number>;
+	int nrOfFailedTests = 0;
+
+	instrumentation<Number>::reset();
+	Real a(1.0), b(2.0), c;
+	c = a + b;   // outside of any region
+	{
+		instrumentation_region<Number> outer("outer");
+		c = a * b;
+		{
+			instrumentation_region<Number> inner("inner");
+			c = a - b;
+			nrOfFailedTests += VerifyCount("inner sub in scope", inner.counts().sub, 1, bReportIndividualTestCases);
+		}
+		c = a / b;
+		nrOfFailedTests += VerifyCount("outer arithmetic in scope", outer.counts().arithmetic(), 3, bReportIndividualTestCases);
+	}
+	for (int i = 0; i < 2; ++i) {
+		instrumentation_region<Number> inner("inner");
+		c = a - b;
+	}
+	c = a + b;   // outside of any region
+
+	auto regions = instrumentation<Number>::regions();
+	if (regions.size() != 2) {
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << regions.size() << " regions recorded instead of 2\n";
+		return nrOfFailedTests + 1;
+	}
+	// regions are listed in order of first completion
+	nrOfFailedTests += VerifyCount("inner region order", (regions[0].first == "inner" ? 0 : 1), 0, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("inner sub",   regions[0].second.sub, 3, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("inner mul",   regions[0].second.mul, 0, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("outer add",   regions[1].second.add, 0, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("outer mul",   regions[1].second.mul, 1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("outer sub",   regions[1].second.sub, 1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("outer div",   regions[1].second.div, 1, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("total add",   instrumentation<Number>::snapshot().add, 2, bReportIndividualTestCases);
+
+	instrumentation<Number>::reset();
+	nrOfFailedTests += VerifyCount("reset regions", instrumentation<Number>::regions().size(), 0, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyCount("reset counts", instrumentation<Number>::snapshot().arithmetic(), 0, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+	using Number = posit<16, 1>;
+	using Real = instrumented<Number>;
+	{
+		instrumentation_region<Number> region("manual");
+		Real a(1.0), b(3.0), c;
+		c = a / b;
+		c = sqrt(c);
+	}
+	instrumentation<Number>::report(std::cout, "posit<16,1>");
+
+	nrOfFailedTestCases = 0;
+#else
+	std::cout << "instrumented number system adapter validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyOperationCounts< posit<16, 1> >(bReportIndividualTestCases), "posit<16,1>", "operation counts");
+	nrOfFailedTestCases += ReportTestResult(VerifyOperationCounts< double >(bReportIndividualTestCases), "double", "operation counts");
+	nrOfFailedTestCases += ReportTestResult(VerifyRoundingCounts<8, 0>(bReportIndividualTestCases), "posit<8,0>", "rounding counts");
+	nrOfFailedTestCases += ReportTestResult(VerifyRoundingCounts<16, 1>(bReportIndividualTestCases), "posit<16,1>", "rounding counts");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideRoundingCounts(bReportIndividualTestCases), "posit<32,2>", "rounding counts");
+	nrOfFailedTestCases += ReportTestResult(VerifyRegions< posit<16, 1> >(bReportIndividualTestCases), "posit<16,1>", "regions");
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,80 @@
+// instrumented_disabled.cpp: test suite for the instrumented number system adapter compiled without instrumentation
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <universal/number/posit/posit.hpp>
+// disable operation counts: instrumented<Number> is an alias of Number
+#define INSTRUMENTED_OPERATIONS_COUNT 0
+#include <universal/utility/instrumented.hpp>
+#include <universal/verification/test_status.hpp>
+
+// the instrumented type is the number system itself, so the instrumented code is the uninstrumented code
+static_assert(std::is_same_v<sw::universal::instrumented< sw::universal::posit<16, 1> >, sw::universal::posit<16, 1> >, "instrumented<posit<16,1>> is not an alias of posit<16,1>");
+static_assert(std::is_same_v<sw::universal::instrumented<double>, double>, "instrumented<double> is not an alias of double");
+
+// regions and snapshots report no operations and the report states that instrumentation is disabled
+template<typename Number>
+int VerifyDisabledInstrumentation(bool bReportIndividualTestCases) {
+	using namespace sw::universal;
+	using Real = instrumented<Number>;
+	int nrOfFailedTests = 0;
+
+	instrumentation<Number>::reset();
+	Real a(2.0), b(0.25), c;
+	{
+		instrumentation_region<Number> region("disabled");
+		c = a + b;
+		c = c * a;
+		if (region.counts().arithmetic() != 0) ++nrOfFailedTests;
+	}
+	if (instrumentation<Number>::snapshot().arithmetic() != 0) ++nrOfFailedTests;
+	if (!instrumentation<Number>::regions().empty()) ++nrOfFailedTests;
+	if (c != Number(4.5)) ++nrOfFailedTests;
+
+	std::stringstream report;
+	instrumentation<Number>::report(report);
+	if (report.str().find("instrumentation disabled") == std::string::npos) ++nrOfFailedTests;
+
+	if (bReportIndividualTestCases && nrOfFailedTests > 0) std::cerr << "FAIL: disabled instrumentation recorded operations\n";
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+
+int main()
+try {
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+	instrumentation< posit<16, 1> >::report(std::cout, "posit<16,1>");
+
+	nrOfFailedTestCases = 0;
+#else
+	std::cout << "instrumented number system adapter with INSTRUMENTED_OPERATIONS_COUNT = 0 validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyDisabledInstrumentation< posit<16, 1> >(bReportIndividualTestCases), "posit<16,1>", "disabled instrumentation");
+	nrOfFailedTestCases += ReportTestResult(VerifyDisabledInstrumentation< double >(bReportIndividualTestCases), "double", "disabled instrumentation");
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,300 @@
+// runge_kutta.cpp: test suite for the batched Runge-Kutta integrators of the ODE library
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <cmath>
+#include <universal/number/posit/posit.hpp>
+#include <universal/number/fixpnt/fixpnt.hpp>
+#include <universal/ode/ode.hpp>
+#include <universal/verification/test_status.hpp>
+
+// y' = -lambda y with lambda = 0.5 + s / N stored in the second component, which stays constant
+template<typename Scalar>
+struct Decay {
+	void operator()(const Scalar& t, const sw::universal::ode::system_view<const Scalar>& y, const sw::universal::ode::system_view<Scalar>& dydt) const {
+		dydt[0] = -(y[1] * y[0]);
+		dydt[1] = Scalar(0.0);
+	}
+};
+
+// x'' = -w^2 x, with w^2 stored in the third component
+template<typename Scalar>
+struct Oscillator {
+	void operator()(const Scalar& t, const sw::universal::ode::system_view<const Scalar>& y, const sw::universal::ode::system_view<Scalar>& dydt) const {
+		dydt[0] = y[1];
+		dydt[1] = -(y[2] * y[0]);
+		dydt[2] = Scalar(0.0);
+	}
+};
+
+template<typename Scalar>
+void InitializeDecay(sw::universal::ode::ensemble<Scalar>& y) {
+	for (size_t s = 0; s < y.size(); ++s) {
+		y(s, 0) = Scalar(1.0);
+		y(s, 1) = Scalar(0.5 + double(s) / double(y.size()));
+	}
+}
+
+template<typename Scalar>
+void InitializeOscillators(sw::universal::ode::ensemble<Scalar>& y) {
+	for (size_t s = 0; s < y.size(); ++s) {
+		y(s, 0) = Scalar(1.0);
+		y(s, 1) = Scalar(0.0);
+		y(s, 2) = Scalar(1.0 + 0.25 * double(s % 8));
+	}
+}
+
+// largest error of the decay ensemble at time T against exp(-lambda T)
+template<typename Scalar>
+double DecayError(const sw::universal::ode::ensemble<Scalar>& y, double T) {
+	double maxError = 0.0;
+	for (size_t s = 0; s < y.size(); ++s) {
+		double lambda = double(y(s, 1));
+		maxError = std::max(maxError, std::fabs(double(y(s, 0)) - std::exp(-lambda * T)));
+	}
+	return maxError;
+}
+
+template<typename Scalar>
+double OscillatorError(const sw::universal::ode::ensemble<Scalar>& y, double T) {
+	double maxError = 0.0;
+	for (size_t s = 0; s < y.size(); ++s) {
+		double w = std::sqrt(double(y(s, 2)));
+		maxError = std::max(maxError, std::fabs(double(y(s, 0)) - std::cos(w * T)));
+		maxError = std::max(maxError, std::fabs(double(y(s, 1)) + w * std::sin(w * T)));
+	}
+	return maxError;
+}
+
+// the global error of a method of order p decreases by 2^p when the step size is halved
+template<typename Tableau>
+int VerifyConvergenceOrder(const std::string& name, bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 16;
+	double T = 2.0;
+	double previous = 0.0;
+	for (size_t nrSteps = 16; nrSteps <= 128; nrSteps *= 2) {
+		ensemble<double> y(N, 2);
+		InitializeDecay(y);
+		runge_kutta<Tableau, double> rk(N, 2);
+		rk.integrate(Decay<double>(), 0.0, T / double(nrSteps), nrSteps, y);
+		double error = DecayError(y, T);
+		if (previous > 0.0) {
+			double observed = std::log2(previous / error);
+			if (std::fabs(observed - double(Tableau::order)) > 0.3) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " observed order " << observed << " expected " << Tableau::order << '\n';
+			}
+		}
+		previous = error;
+	}
+	return nrOfFailedTests;
+}
+
+// the batched integrator matches the scalar textbook RK4 loop for every system
+int VerifyBatchAgainstScalar(bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 37;
+	ensemble<double> y(N, 3);
+	InitializeOscillators(y);
+	double h = 0.01;
+	size_t nrSteps = 300;
+	runge_kutta<rk4, double> rk(N, 3);
+	rk.integrate(Oscillator<double>(), 0.0, h, nrSteps, y);
+	for (size_t s = 0; s < N; ++s) {
+		double w2 = 1.0 + 0.25 * double(s % 8);
+		double x = 1.0, v = 0.0;
+		for (size_t n = 0; n < nrSteps; ++n) {
+			double k1x = v, k1v = -w2 * x;
+			double k2x = v + 0.5 * h * k1v, k2v = -w2 * (x + 0.5 * h * k1x);
+			double k3x = v + 0.5 * h * k2v, k3v = -w2 * (x + 0.5 * h * k2x);
+			double k4x = v + h * k3v, k4v = -w2 * (x + h * k3x);
+			x += h / 6.0 * (k1x + 2.0 * k2x + 2.0 * k3x + k4x);
+			v += h / 6.0 * (k1v + 2.0 * k2v + 2.0 * k3v + k4v);
+		}
+		if (std::fabs(x - y(s, 0)) > 1.0e-12 || std::fabs(v - y(s, 1)) > 1.0e-12) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << "FAIL: system " << s << " batch (" << y(s, 0) << ", " << y(s, 1) << ") scalar (" << x << ", " << v << ")\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// partitioning the batch over threads does not change the results
+template<typename Scalar, typename Accumulator>
+int VerifyThreadInvariance(bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 101;
+	ensemble<Scalar> serial(N, 3), parallel(N, 3);
+	InitializeOscillators(serial);
+	InitializeOscillators(parallel);
+	runge_kutta<rk4, Scalar, Accumulator> rk1(N, 3, 1), rk4threads(N, 3, 4);
+	rk1.integrate(Oscillator<Scalar>(), Scalar(0.0), Scalar(0.03125), 64, serial);
+	rk4threads.integrate(Oscillator<Scalar>(), Scalar(0.0), Scalar(0.03125), 64, parallel);
+	adaptive_runge_kutta<dormand_prince, Scalar, Accumulator> dp1(N, 3, 1.0e-6, 1.0e-6, 1), dp3(N, 3, 1.0e-6, 1.0e-6, 3);
+	dp1.integrate(Oscillator<Scalar>(), 0.0, 1.0, serial);
+	dp3.integrate(Oscillator<Scalar>(), 0.0, 1.0, parallel);
+	for (size_t s = 0; s < N; ++s) {
+		for (size_t d = 0; d < 3; ++d) {
+			if (serial(s, d) != parallel(s, d)) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cerr << "FAIL: system " << s << " component " << d << " serial " << serial(s, d) << " parallel " << parallel(s, d) << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// fixed-step RK4 in a number system stays within tolerance of the exact oscillation
+template<typename Scalar, typename Accumulator>
+int VerifyOscillators(const std::string& name, double tolerance, bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 64;
+	ensemble<Scalar> y(N, 3);
+	InitializeOscillators(y);
+	runge_kutta<rk4, Scalar, Accumulator> rk(N, 3);
+	double T = 4.0;
+	size_t nrSteps = 256;
+	rk.integrate(Oscillator<Scalar>(), Scalar(0.0), Scalar(T / double(nrSteps)), nrSteps, y);
+	double error = OscillatorError(y, T);
+	if (!(error <= tolerance)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " error " << error << " tolerance " << tolerance << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the adaptive integrator meets the tolerance with fewer steps for the slower systems
+template<typename Tableau>
+int VerifyAdaptive(const std::string& name, double tolerance, bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	constexpr size_t N = 24;
+	ensemble<double> y(N, 3);
+	InitializeOscillators(y);
+	adaptive_runge_kutta<Tableau, double> integrator(N, 3, tolerance, tolerance);
+	double T = 10.0;
+	integrator.integrate(Oscillator<double>(), 0.0, T, y);
+	double error = OscillatorError(y, T);
+	// the global error is a modest multiple of the local tolerance over the interval
+	if (!(error <= 1000.0 * tolerance)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " error " << error << " tolerance " << tolerance << '\n';
+	}
+	// system 0 has w^2 = 1, system 7 has w^2 = 2.75
+	if (!(integrator.accepted(0) < integrator.accepted(7))) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: " << name << " accepted steps " << integrator.accepted(0) << " and " << integrator.accepted(7) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// shape mismatches and unreachable tolerances are reported with exceptions
+int VerifyExceptions(bool bReportIndividualTestCases) {
+	using namespace sw::universal::ode;
+	int nrOfFailedTests = 0;
+	ensemble<double> y(8, 3);
+	InitializeOscillators(y);
+	runge_kutta<rk4, double> rk(8, 2);
+	try {
+		rk.step(Oscillator<double>(), 0.0, 0.1, y);
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: no ensemble_shape_mismatch\n";
+	}
+	catch (const ensemble_shape_mismatch&) {}
+	adaptive_runge_kutta<dormand_prince, double> dp(8, 3, 1.0e-12, 1.0e-12);
+	dp.max_steps(10);
+	try {
+		dp.integrate(Oscillator<double>(), 0.0, 100.0, y);
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << "FAIL: no step_size_underflow\n";
+	}
+	catch (const step_size_underflow&) {}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::universal;
+	using namespace sw::universal::ode;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = true;
+
+#if MANUAL_TESTING
+
+	{
+		constexpr size_t N = 4;
+		ensemble<posit<32, 2>> y(N, 3);
+		InitializeOscillators(y);
+		adaptive_runge_kutta<dormand_prince, posit<32, 2>, quire<32, 2>> integrator(N, 3, 1.0e-7, 1.0e-7);
+		integrator.integrate(Oscillator<posit<32, 2>>(), 0.0, 10.0, y);
+		for (size_t s = 0; s < N; ++s) cout << "system " << s << " : x(10) = " << y(s, 0) << " accepted " << integrator.accepted(s) << " rejected " << integrator.rejected(s) << '\n';
+	}
+
+	nrOfFailedTestCases = 0;
+#else
+	cout << "batched Runge-Kutta integrator validation\n";
+
+	nrOfFailedTestCases += ReportTestResult(VerifyConvergenceOrder<euler>("euler", bReportIndividualTestCases), "double", "euler order");
+	nrOfFailedTestCases += ReportTestResult(VerifyConvergenceOrder<heun_euler>("heun", bReportIndividualTestCases), "double", "heun order");
+	nrOfFailedTestCases += ReportTestResult(VerifyConvergenceOrder<rk4>("rk4", bReportIndividualTestCases), "double", "rk4 order");
+	nrOfFailedTestCases += ReportTestResult(VerifyConvergenceOrder<bogacki_shampine>("bogacki-shampine", bReportIndividualTestCases), "double", "bs23 order");
+	nrOfFailedTestCases += ReportTestResult(VerifyConvergenceOrder<dormand_prince>("dormand-prince", bReportIndividualTestCases), "double", "dopri5 order");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchAgainstScalar(bReportIndividualTestCases), "double", "batch vs scalar rk4");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyThreadInvariance<double, double>(bReportIndividualTestCases), "double", "thread invariance");
+	nrOfFailedTestCases += ReportTestResult(VerifyThreadInvariance<posit<32, 2>, quire<32, 2>>(bReportIndividualTestCases), "posit<32,2>", "thread invariance");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyOscillators<posit<32, 2>, posit<32, 2>>("posit<32,2>", 1.0e-6, bReportIndividualTestCases), "posit<32,2>", "rk4 oscillators");
+	nrOfFailedTestCases += ReportTestResult(VerifyOscillators<posit<32, 2>, quire<32, 2>>("posit<32,2> quire", 1.0e-6, bReportIndividualTestCases), "posit<32,2>", "rk4 quire oscillators");
+	nrOfFailedTestCases += ReportTestResult(VerifyOscillators<posit<16, 1>, quire<16, 1>>("posit<16,1> quire", 2.0e-2, bReportIndividualTestCases), "posit<16,1>", "rk4 quire oscillators");
+	nrOfFailedTestCases += ReportTestResult(VerifyOscillators<fixpnt<32, 24>, fixpnt<32, 24>>("fixpnt<32,24>", 1.0e-4, bReportIndividualTestCases), "fixpnt<32,24>", "rk4 oscillators");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyAdaptive<dormand_prince>("dormand-prince", 1.0e-8, bReportIndividualTestCases), "double", "dopri5 adaptive");
+	nrOfFailedTestCases += ReportTestResult(VerifyAdaptive<bogacki_shampine>("bogacki-shampine", 1.0e-6, bReportIndividualTestCases), "double", "bs23 adaptive");
+	nrOfFailedTestCases += ReportTestResult(VerifyExceptions(bReportIndividualTestCases), "double", "exceptions");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyAdaptive<dormand_prince>("dormand-prince", 1.0e-12, bReportIndividualTestCases), "double", "dopri5 adaptive");
+#endif
+
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::universal::ode::ode_exception& err) {
+	std::cerr << "Uncaught ODE exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
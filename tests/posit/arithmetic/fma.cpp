@@ -10,9 +10,8 @@
 // minimum set of include files to reflect source code dependencies
 // enable/disable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 0
-#include <universal/number/posit/posit_impl.hpp>
-// posit type manipulators such as pretty printers
-#include <universal/number/posit/manipulators.hpp>
+#include <universal/number/posit/posit.hpp>
+#include <universal/verification/posit_test_suite.hpp>
 #include <universal/verification/posit_math_test_suite.hpp>
 
 // generate specific test case that you can trace with the trace conditions in posit.h
@@ -35,7 +34,7 @@ void GenerateTestCase(Ty a, Ty b, Ty c) {
 	std::cout << std::setprecision(5);
 }
 
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 // forward references
@@ -48,10 +47,9 @@ try {
 	using namespace std;
 	using namespace sw::universal;
 
-	//bool bReportIndividualTestCases = false;
+	bool bReportIndividualTestCases = false;
 	int nrOfFailedTestCases = 0;
 
-	std::string tag = "Fused Multiply-Accumulate failed: ";
 
 #if MANUAL_TESTING
 
@@ -92,11 +90,23 @@ try {
 
 #else
 
-	nrOfFailedTestCases += ReportTestResult(ValidateFMA<2, 0>(tag, bReportIndividualTestCases), "posit<2,0>", "fused multiply-accumulate");
+	std::cout << "posit fused multiply-add validation\n";
 
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<3, 0>(bReportIndividualTestCases), "posit<3,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<4, 0>(bReportIndividualTestCases), "posit<4,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<4, 1>(bReportIndividualTestCases), "posit<4,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<5, 0>(bReportIndividualTestCases), "posit<5,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<5, 1>(bReportIndividualTestCases), "posit<5,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<5, 2>(bReportIndividualTestCases), "posit<5,2>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<6, 0>(bReportIndividualTestCases), "posit<6,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<6, 1>(bReportIndividualTestCases), "posit<6,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<6, 2>(bReportIndividualTestCases), "posit<6,2>", "fused multiply-add");
 
 #if STRESS_TESTING
-
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<7, 0>(bReportIndividualTestCases), "posit<7,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<7, 1>(bReportIndividualTestCases), "posit<7,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<8, 0>(bReportIndividualTestCases), "posit<8,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(VerifyFma<8, 1>(bReportIndividualTestCases), "posit<8,1>", "fused multiply-add");
 #endif
 
 #endif
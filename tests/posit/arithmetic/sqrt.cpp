@@ -41,6 +41,35 @@ void GenerateTestCase(Ty a) {
 	std::cout << std::setprecision(5);
 }
 
+// sqrt and rsqrt must be the correctly rounded quad-double values, for random encodings of the wide posits
+template<size_t nbits, size_t es>
+int VerifyCorrectlyRoundedSqrt(bool reportTestCases, size_t nrOfRandoms) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	posit<nbits, es> a, ref, rref;
+	for (size_t i = 0; i < nrOfRandoms; ++i) {
+		uint64_t bits = engine();
+		if (i % 4 == 0) bits >>= (engine() % 64);  // favor the long regimes
+		if constexpr (nbits < 64) bits &= (uint64_t(1) << nbits) - 1;
+		a.setbits(bits);
+		if (a.isnar() || a.isneg() || a.iszero()) continue;
+		qd_real v = internal::posit_to_extended<qd_real>(a);
+		ref = internal::posit_from_extended<nbits, es>(sqrt(v));
+		rref = internal::posit_from_extended<nbits, es>(qd_real(1.0) / sqrt(v));
+		posit<nbits, es> root = sw::universal::sqrt(a), rroot = sw::universal::rsqrt(a);
+		if (root != ref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: sqrt(" << to_binary(a) << ") = " << to_binary(root) << " expected " << to_binary(ref) << '\n';
+		}
+		if (rroot != rref) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: rsqrt(" << to_binary(a) << ") = " << to_binary(rroot) << " expected " << to_binary(rref) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
 #define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
@@ -166,6 +195,9 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifySqrt<16, 1>(bReportIndividualTestCases), "posit<16,1>", "sqrt");
 	nrOfFailedTestCases += ReportTestResult(VerifySqrt<16, 2>(bReportIndividualTestCases), "posit<16,2>", "sqrt");
 
+	nrOfFailedTestCases += ReportTestResult(VerifyCorrectlyRoundedSqrt<32, 2>(bReportIndividualTestCases, 10000), "posit<32,2>", "sqrt/rsqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifyCorrectlyRoundedSqrt<64, 3>(bReportIndividualTestCases, 10000), "posit<64,3>", "sqrt/rsqrt");
+
 
 #if STRESS_TESTING
 	// nbits=64 requires long double compiler support
@@ -0,0 +1,152 @@
+// constexpr_arithmetic.cpp: compile-time arithmetic, comparison, and conversion tests for the fast posit specializations
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <universal/utility/directives.hpp>
+#include <array>
+// enable the fast specializations
+#define POSIT_FAST_POSIT_8_0  1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+#include <universal/number/posit/posit.hpp>
+#include <universal/verification/test_status.hpp>
+
+// All the tests below are evaluated by the compiler: if a specialization loses
+// its constexpr capability, this file no longer compiles.
+
+namespace constexpr_tests {
+	using namespace sw::universal;
+
+	// a polynomial evaluated with Horner's rule on a compile-time coefficient table
+	template<typename Posit, size_t N>
+	constexpr Posit horner(const std::array<Posit, N>& coef, const Posit& x) {
+		Posit v = coef[N - 1];
+		for (size_t i = N - 1; i > 0; --i) v = v * x + coef[i - 1];
+		return v;
+	}
+
+	template<typename Posit>
+	constexpr Posit harmonic(int n) {
+		Posit sum(0);
+		for (int i = 1; i <= n; ++i) sum += Posit(1) / Posit(i);
+		return sum;
+	}
+
+	template<typename Posit>
+	constexpr bool VerifyArithmetic() {
+		constexpr Posit a(1.5), b(0.25);
+		static_assert(a + b == Posit(1.75));
+		static_assert(a - b == Posit(1.25));
+		static_assert(a * b == Posit(0.375));
+		static_assert(a / b == Posit(6));
+		static_assert(-a == Posit(-1.5));
+		static_assert(Posit(3) - Posit(5) == Posit(-2));
+		static_assert(Posit(1).reciprocate() == Posit(1));
+		static_assert(abs(Posit(-2)) == Posit(2));
+		constexpr Posit c = [] { Posit x(2); x += Posit(1); x *= Posit(4); x -= Posit(2); x /= Posit(5); return x; }();
+		static_assert(c == Posit(2));
+		// increment and decrement step through the encodings
+		constexpr Posit d = [] { Posit x(1); ++x; ++x; --x; return x; }();
+		static_assert(d.encoding() == Posit(1).encoding() + 1);
+		return true;
+	}
+
+	template<typename Posit>
+	constexpr bool VerifyComparison() {
+		constexpr Posit a(-1), b(0.5), nar = [] { Posit x; x.setnar(); return x; }();
+		static_assert(a < b && b > a && a <= a && b >= b && a != b && a == a);
+		// NaR is equal to itself and smaller than any other value
+		static_assert(nar == nar && nar < a);
+		static_assert((a + nar).isnar() && (b * nar).isnar() && (b / Posit(0)).isnar());
+		return true;
+	}
+
+	template<typename Posit>
+	constexpr bool VerifyConversion() {
+		static_assert(double(Posit(0.75)) == 0.75);
+		static_assert(float(Posit(-0.5f)) == -0.5f);
+		static_assert((long double)(Posit(3.0L)) == 3.0L);
+		static_assert(int(Posit(7)) == 7);
+		static_assert(Posit(1.0) == Posit(1));
+		static_assert(double(Posit(SpecificValue::maxpos)) == double(std::numeric_limits<Posit>::max()));
+		static_assert(double(Posit(SpecificValue::minpos)) > 0.0);
+		static_assert(Posit(SpecificValue::zero).iszero());
+		// conversion saturates instead of overflowing to NaR or underflowing to zero
+		static_assert(Posit(1.0e300) == Posit(SpecificValue::maxpos));
+		static_assert(Posit(-1.0e-300) == Posit(SpecificValue::minneg));
+		return true;
+	}
+}
+
+int main()
+try {
+	using namespace sw::universal;
+	using namespace constexpr_tests;
+
+	std::string test_suite = "constexpr posit specializations";
+	std::string test_tag = "constexpr";
+	bool reportTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	static_assert(VerifyArithmetic< posit<8, 0> >() && VerifyComparison< posit<8, 0> >() && VerifyConversion< posit<8, 0> >());
+	static_assert(VerifyArithmetic< posit<16, 1> >() && VerifyComparison< posit<16, 1> >() && VerifyConversion< posit<16, 1> >());
+	static_assert(VerifyArithmetic< posit<32, 2> >() && VerifyComparison< posit<32, 2> >() && VerifyConversion< posit<32, 2> >());
+
+	// encodings are known at compile time
+	static_assert(posit<8, 0>(1).encoding() == 0x40);
+	static_assert(posit<16, 1>(1).encoding() == 0x4000);
+	static_assert(posit<32, 2>(1).encoding() == 0x4000'0000);
+	static_assert(posit<8, 0>(SpecificValue::maxpos).encoding() == 0x7F);
+	static_assert(posit<16, 1>(SpecificValue::maxpos).encoding() == 0x7FFF);
+	static_assert(posit<32, 2>(SpecificValue::maxpos).encoding() == 0x7FFF'FFFF);
+
+	// compile-time coefficient tables: 1 + x + x^2/2 + x^3/6 + x^4/24
+	using Posit = posit<32, 2>;
+	constexpr std::array<Posit, 5> taylorExp = { Posit(1), Posit(1), Posit(1) / Posit(2), Posit(1) / Posit(6), Posit(1) / Posit(24) };
+	constexpr Posit e = horner(taylorExp, Posit(1));
+	static_assert(double(e) > 2.708 && double(e) < 2.709);
+
+	// compile-time results must match the run-time results
+	{
+		posit<16, 1> a(1.0);
+		posit<16, 1> runtime = harmonic< posit<16, 1> >(a.encoding() == 0 ? 0 : 100);
+		constexpr posit<16, 1> compiletime = harmonic< posit<16, 1> >(100);
+		int nrOfFailedTests = (runtime != compiletime ? 1 : 0);
+		if (reportTestCases && nrOfFailedTests) std::cerr << "FAIL: " << runtime << " != " << compiletime << '\n';
+		nrOfFailedTestCases += ReportTestResult(nrOfFailedTests, "posit<16,1>", "harmonic sum");
+	}
+	{
+		posit<32, 2> x(0.5);
+		posit<32, 2> runtime = horner(taylorExp, x);
+		constexpr posit<32, 2> compiletime = horner(taylorExp, posit<32, 2>(0.5));
+		int nrOfFailedTests = (runtime != compiletime ? 1 : 0);
+		if (reportTestCases && nrOfFailedTests) std::cerr << "FAIL: " << runtime << " != " << compiletime << '\n';
+		nrOfFailedTestCases += ReportTestResult(nrOfFailedTests, "posit<32,2>", "polynomial");
+	}
+	{
+		posit<8, 0> a(0.3);
+		posit<8, 0> runtime = a * a + a;
+		constexpr posit<8, 0> compiletime = posit<8, 0>(0.3) * posit<8, 0>(0.3) + posit<8, 0>(0.3);
+		int nrOfFailedTests = (runtime != compiletime ? 1 : 0);
+		if (reportTestCases && nrOfFailedTests) std::cerr << "FAIL: " << runtime << " != " << compiletime << '\n';
+		nrOfFailedTestCases += ReportTestResult(nrOfFailedTests, "posit<8,0>", "multiply-add");
+	}
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,231 @@
+// arithmetic.cpp: functional tests for quad-double arithmetic against exact expansion references
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <random>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/number/qd/qd.hpp>
+#include <universal/number/adaptivefloat/adaptivefloat.hpp>
+#include <universal/blas/blas.hpp>
+#include <universal/verification/test_status.hpp> // ReportTestResult
+
+// the exact value of a quad-double
+sw::universal::adaptivefloat Exact(const sw::universal::qd_real& v) {
+	sw::universal::adaptivefloat e(v[0]);
+	for (int i = 1; i < 4; ++i) e += v[i];
+	return e;
+}
+
+// a normalized quad-double with random trailing components and a moderate exponent
+sw::universal::qd_real RandomQuadDouble(std::mt19937_64& engine) {
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-60, 60);
+	double x = std::ldexp(mantissa(engine), exponent(engine));
+	sw::universal::qd_real v(x);
+	for (int i = 1; i < 4; ++i) {
+		x = std::ldexp(x * mantissa(engine), -53);
+		v += x;
+	}
+	return v;
+}
+
+// the relative error of a result against its exact reference, as a binary exponent
+bool WithinBound(const sw::universal::qd_real& result, const sw::universal::adaptivefloat& reference, int bound) {
+	sw::universal::adaptivefloat error = Exact(result) - reference;
+	if (error.iszero()) return true;
+	if (reference.iszero()) return false;
+	return error.scale() - reference.scale() <= -bound;
+}
+
+// sums, differences, and products against their exact values, including catastrophic cancellation
+int VerifyAddSubMul(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(31);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		qd_real a = RandomQuadDouble(engine), b = RandomQuadDouble(engine);
+		// every fourth case cancels the leading components
+		if (i % 4 == 0) b = -a + qd_real(std::ldexp(a[0], -40 - int(i % 150)));
+		adaptivefloat ea = Exact(a), eb = Exact(b);
+		if (!WithinBound(a + b, ea + eb, 208)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " + " << b << " = " << a + b << '\n';
+		}
+		if (!WithinBound(a - b, ea - eb, 208)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " - " << b << " = " << a - b << '\n';
+		}
+		if (!WithinBound(a * b, ea * eb, 205)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " * " << b << " = " << a * b << '\n';
+		}
+		double c = b[0];
+		if (!WithinBound(a + c, ea + adaptivefloat(c), 208) || !WithinBound(a * c, ea * adaptivefloat(c), 207)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " with double " << c << '\n';
+		}
+	}
+	// the sum of two doubles is error free
+	qd_real one(1.0), tiny(std::ldexp(1.0, -180));
+	qd_real sum = one + tiny;
+	if (sum[0] != 1.0 || sum[1] != std::ldexp(1.0, -180) || sum - one != tiny) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1 + 2^-180 = " << sum << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// quotients and square roots against the exact product of the result with the operand
+int VerifyDivSqrt(bool reportTestCases, size_t nrOfTests) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(37);
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		qd_real a = RandomQuadDouble(engine), b = RandomQuadDouble(engine);
+		if (b.iszero()) continue;
+		qd_real q = a / b;
+		adaptivefloat reference = Exact(a) / Exact(b);
+		if (!WithinBound(q, reference, 204)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " / " << b << " = " << q << '\n';
+		}
+		qd_real qdouble = a / b[0];
+		if (!WithinBound(qdouble, Exact(a) / adaptivefloat(b[0]), 204)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: " << a << " / " << b[0] << " = " << qdouble << '\n';
+		}
+		qd_real x = abs(a);
+		qd_real r = sqrt(x);
+		// r^2 reproduces x to twice the relative error of r
+		if (!WithinBound(r * r, Exact(x), 203)) {
+			++nrOfFailedTests;
+			if (reportTestCases) std::cerr << "FAIL: sqrt(" << x << ") = " << r << '\n';
+		}
+	}
+	// special cases follow the leading component
+	qd_real zero(0.0), one(1.0);
+	if (!(one / zero).isinf() || !(zero / zero).isnan() || !sqrt(-one).isnan() || sqrt(zero) != zero) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: special cases of division and square root\n";
+	}
+	qd_real big(SpecificValue::maxpos);
+	if (!(big * 2.0).isinf() || (big * 2.0)[1] != 0.0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: overflow " << big * 2.0 << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// native conversions, decimal conversion, and numeric_limits
+int VerifyConversions(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	long long big = 9'007'199'254'740'993LL;  // 2^53 + 1 is not a double
+	qd_real a(big);
+	if ((long long)(a) != big || (long long)(-a) != -big || (long long)(qd_real(9.5)) != 9 || (long long)(qd_real(-9.5)) != -9) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: integer conversion " << a << '\n';
+	}
+	if ((long long)(qd_real(5.0, 0.0, -std::ldexp(1.0, -160), 0.0)) != 4 || (unsigned long long)(qd_real(18'446'744'073'709'551'615ull)) != 18'446'744'073'709'551'615ull) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: truncation of the low component\n";
+	}
+	qd_real third = qd_real(1.0) / 3.0;
+	if (third.str(61) != "3.3333333333333333333333333333333333333333333333333333333333333e-01") {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: 1/3 = " << third.str(61) << '\n';
+	}
+	// a double-double converts exactly, and back to the nearest double-double
+	if (qd_real(dd_pi) != qd_real(dd_pi.high(), dd_pi.low(), 0.0, 0.0) || dd_real(qd_pi) != dd_pi) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: double-double conversion " << dd_real(qd_pi) << '\n';
+	}
+	qd_real pi;
+	if (!parse("3.141592653589793238462643383279502884197169399375105820974944592307816", pi) || abs(pi - qd_pi) > std::numeric_limits<qd_real>::epsilon() * 8.0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: parse pi = " << pi << " expected " << qd_pi << '\n';
+	}
+	std::stringstream s;
+	s << std::setprecision(10) << qd_pi << ' ' << std::fixed << std::setprecision(3) << qd_real(1234.5678) << ' ' << std::scientific << std::setprecision(2) << qd_real(-0.00125);
+	if (s.str() != "3.141592654 1234.568 -1.25e-03") {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: stream formatting " << s.str() << '\n';
+	}
+	qd_real eps = std::numeric_limits<qd_real>::epsilon();
+	if (qd_real(1.0) + eps == qd_real(1.0) || std::numeric_limits<qd_real>::digits != 212) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: epsilon " << eps << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the blas kernels instantiate with qd_real: a dot product that cancels exactly in quad-double
+int VerifyBlas(bool reportTestCases) {
+	using namespace sw::universal;
+	int nrOfFailedTests = 0;
+	blas::vector<qd_real> x = { qd_real(1.0e40), qd_real(1.0), qd_real(-1.0e40) };
+	blas::vector<qd_real> y = { qd_real(1.0), qd_real(1.0), qd_real(1.0) };
+	qd_real dot = blas::dot(x, y);
+	if (dot != qd_real(1.0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: blas dot " << dot << '\n';
+	}
+	blas::vector<qd_real> z = { qd_real(3.0), qd_real(4.0) };
+	if (blas::norm(z, 2) != qd_real(5.0)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: blas norm " << blas::norm(z, 2) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::universal;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	qd_real a(1.0), b(3.0);
+	cout << setprecision(64) << a / b << endl;
+
+#else
+
+	cout << "quad-double arithmetic validation" << endl;
+
+	bool bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ReportTestResult(VerifyAddSubMul(bReportIndividualTestCases, 10000), "qd_real", "add/sub/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivSqrt(bReportIndividualTestCases, 10000), "qd_real", "div/sqrt");
+	nrOfFailedTestCases += ReportTestResult(VerifyConversions(bReportIndividualTestCases), "qd_real", "conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyBlas(bReportIndividualTestCases), "qd_real", "blas");
+
+#if STRESS_TESTING
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << "Caught exception: " << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,220 @@
+// directed_rounding.cpp: enclosure and tightness tests for valid arithmetic with outward rounded endpoints
+//
+// Copyright (C) 2017-2021 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+#include <cmath>
+// enable the fast posit specializations for the endpoints
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/number/valid/valid.hpp>
+#include <universal/verification/test_status.hpp>
+
+/*
+   The operands are drawn from a limited dynamic range so that sums, products, and
+   quotients of the endpoints are exact in long double, or, for quotients, far enough
+   from the posit grid that the long double rounding error cannot hide a bad bound.
+ */
+
+template<size_t nbits, size_t es>
+long double lower(const sw::universal::valid<nbits, es>& v) {
+	sw::universal::posit<nbits, es> p;
+	v.getlb(p);
+	return p.isnar() ? -INFINITY : (long double)(p);
+}
+template<size_t nbits, size_t es>
+long double upper(const sw::universal::valid<nbits, es>& v) {
+	sw::universal::posit<nbits, es> p;
+	v.getub(p);
+	return p.isnar() ? INFINITY : (long double)(p);
+}
+
+template<size_t nbits, size_t es>
+long double Reference(int op, long double a, long double b) {
+	switch (op) {
+	case 0: return a + b;
+	case 1: return a - b;
+	case 2: return a * b;
+	default: return a / b;
+	}
+}
+
+template<size_t nbits, size_t es>
+sw::universal::valid<nbits, es> Compute(int op, const sw::universal::valid<nbits, es>& a, const sw::universal::valid<nbits, es>& b) {
+	switch (op) {
+	case 0: return a + b;
+	case 1: return a - b;
+	case 2: return a * b;
+	default: return a / b;
+	}
+}
+
+// point operands: the result must be the exact value, closed, or the two posits around it, open
+template<size_t nbits, size_t es>
+int VerifyPointOperands(bool reportTestCases, size_t nrOfTests, int range) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits);
+	std::uniform_real_distribution<double> mantissa(-2.0, 2.0);
+	std::uniform_int_distribution<int> exponent(-range, range);
+	const char* opname[] = { "+", "-", "*", "/" };
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		Posit pa(std::ldexp(mantissa(engine), exponent(engine))), pb(std::ldexp(mantissa(engine), exponent(engine)));
+		if (pa.iszero() || pb.iszero()) continue;
+		valid<nbits, es> a{ double(pa) }, b{ double(pb) };
+		for (int op = 0; op < 4; ++op) {
+			valid<nbits, es> c = Compute(op, a, b);
+			long double ref = Reference<nbits, es>(op, (long double)(pa), (long double)(pb));
+			Posit lb, ub;
+			bool lclosed = c.getlb(lb), uclosed = c.getub(ub);
+			bool pass{ true };
+			if (lclosed || uclosed) {
+				pass = lclosed && uclosed && lb == ub && (long double)(lb) == ref;
+			}
+			else {
+				// beyond maxpos the enclosure opens to NaR, which ++maxpos reaches as well
+				Posit next(lb);
+				++next;
+				pass = lower(c) < ref && ref < upper(c) && next == ub;
+			}
+			if (!pass) {
+				++nrOfFailedTests;
+				if (reportTestCases) std::cerr << "FAIL: " << pa << ' ' << opname[op] << ' ' << pb << " = " << double(ref) << " not tightly enclosed by " << c << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// interval operands: every combination of the endpoints and the midpoints must be enclosed
+template<size_t nbits, size_t es>
+int VerifyEnclosure(bool reportTestCases, size_t nrOfTests, int range) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 engine(nbits + 1);
+	std::uniform_real_distribution<double> mantissa(-2.0, 2.0);
+	std::uniform_int_distribution<int> exponent(-range, range);
+	const char* opname[] = { "+", "-", "*", "/" };
+	for (size_t i = 0; i < nrOfTests; ++i) {
+		double x[4];
+		for (double& v : x) v = double(Posit(std::ldexp(mantissa(engine), exponent(engine))));
+		if (x[0] > x[1]) std::swap(x[0], x[1]);
+		if (x[2] > x[3]) std::swap(x[2], x[3]);
+		// build the intervals from their endpoints: a + [0, 0] adds nothing
+		valid<nbits, es> a(x[0]), b(x[2]), ahi(x[1]), bhi(x[3]);
+		Posit p;
+		ahi.getub(p); a.setub(p, true);
+		bhi.getub(p); b.setub(p, true);
+		for (int op = 0; op < 4; ++op) {
+			valid<nbits, es> c = Compute(op, a, b);
+			for (long double s : { (long double)(x[0]), (long double)(x[1]), ((long double)(x[0]) + x[1]) / 2 }) {
+				for (long double t : { (long double)(x[2]), (long double)(x[3]), ((long double)(x[2]) + x[3]) / 2 }) {
+					if (op == 3 && x[2] <= 0.0 && x[3] >= 0.0) continue;  // covered by the projective line
+					long double ref = Reference<nbits, es>(op, s, t);
+					if (ref < lower(c) || ref > upper(c)) {
+						++nrOfFailedTests;
+						if (reportTestCases) std::cerr << "FAIL: " << a << ' ' << opname[op] << ' ' << b << " = " << c << " does not contain " << double(ref) << '\n';
+					}
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// open and closed bounds, the projective line, and the range limits
+template<size_t nbits, size_t es>
+int VerifySpecialCases(bool reportTestCases) {
+	using namespace sw::universal;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	valid<nbits, es> one(1.0), tenth(0.1), zero(0.0), straddle(-1.0);
+	Posit p(1.0);
+	straddle.setub(p, true);  // [-1, 1]
+	if (!one.isclosed() || tenth.isclosed() || !(lower(tenth) < 0.1L && 0.1L < upper(tenth))) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: assignment " << one << ' ' << tenth << '\n';
+	}
+	valid<nbits, es> whole = one / straddle;
+	Posit lb, ub;
+	whole.getlb(lb);
+	whole.getub(ub);
+	if (!lb.isnar() || !ub.isnar()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: division by an interval containing zero " << whole << '\n';
+	}
+	// zero times anything finite is a closed zero
+	valid<nbits, es> product = zero * tenth;
+	if (!product.isclosed() || lower(product) != 0 || upper(product) != 0) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: zero product " << product << '\n';
+	}
+	// beyond maxpos the upper bound opens to infinity instead of saturating
+	valid<nbits, es> big(double(Posit(SpecificValue::maxpos)));
+	valid<nbits, es> overflow = big + big;
+	overflow.getub(ub);
+	overflow.getlb(lb);
+	if (!ub.isnar() || overflow.isopenlower() == false || lb != Posit(SpecificValue::maxpos)) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: overflow " << overflow << '\n';
+	}
+	// below minpos the lower bound opens to zero
+	valid<nbits, es> small(double(Posit(SpecificValue::minpos)));
+	valid<nbits, es> underflow = small * small;
+	if (lower(underflow) != 0 || !underflow.isopenlower() || upper(underflow) != (long double)(Posit(SpecificValue::minpos))) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: underflow " << underflow << '\n';
+	}
+	// negation swaps the bounds and their ubits
+	valid<nbits, es> negated = -(one + tenth);
+	if (lower(negated) != -upper(one + tenth) || negated.isopenlower() != (one + tenth).isopenupper()) {
+		++nrOfFailedTests;
+		if (reportTestCases) std::cerr << "FAIL: negation " << negated << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+int main()
+try {
+	using namespace sw::universal;
+
+	std::string test_suite = "valid arithmetic with directed rounding";
+	std::string test_tag = "directed rounding";
+	bool reportTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::cout << test_suite << '\n';
+
+	nrOfFailedTestCases += ReportTestResult(VerifyPointOperands<8, 0>(reportTestCases, 1000, 3), "valid<8,0>", "point operands");
+	nrOfFailedTestCases += ReportTestResult(VerifyPointOperands<16, 1>(reportTestCases, 5000, 10), "valid<16,1>", "point operands");
+	nrOfFailedTestCases += ReportTestResult(VerifyPointOperands<32, 2>(reportTestCases, 5000, 16), "valid<32,2>", "point operands");
+	nrOfFailedTestCases += ReportTestResult(VerifyPointOperands<24, 1>(reportTestCases, 2000, 12), "valid<24,1>", "point operands");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyEnclosure<16, 1>(reportTestCases, 2000, 10), "valid<16,1>", "enclosure");
+	nrOfFailedTestCases += ReportTestResult(VerifyEnclosure<32, 2>(reportTestCases, 2000, 16), "valid<32,2>", "enclosure");
+
+	nrOfFailedTestCases += ReportTestResult(VerifySpecialCases<8, 0>(reportTestCases), "valid<8,0>", "special cases");
+	nrOfFailedTestCases += ReportTestResult(VerifySpecialCases<16, 1>(reportTestCases), "valid<16,1>", "special cases");
+	nrOfFailedTestCases += ReportTestResult(VerifySpecialCases<32, 2>(reportTestCases), "valid<32,2>", "special cases");
+
+	std::cout << test_tag << (nrOfFailedTestCases > 0 ? ": FAIL" : ": PASS") << '\n';
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
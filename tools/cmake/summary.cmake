@@ -139,6 +139,8 @@ function(universal_print_configuration_summary)
     universal_status("")
     universal_status("  BUILD_BLAS                       :   ${BUILD_BLAS}")
     universal_status("  BUILD_VMATH                      :   ${BUILD_VMATH}")
+    universal_status("  BUILD_DSP                        :   ${BUILD_DSP}")
+    universal_status("  BUILD_ODE                        :   ${BUILD_ODE}")
     universal_status("")
     universal_status("")
     universal_status("  BUILD_C_API_PURE_LIB             :   ${BUILD_C_API_PURE_LIB}")